@@ -19,6 +19,7 @@
 #include "ocudu/adt/expected.h"
 #include "ocudu/adt/to_array.h"
 #include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/compression/compression_factory.h"
 #include "ocudu/ofh/compression/compression_params.h"
 #include "ocudu/ofh/ecpri/ecpri_constants.h"
 #include "ocudu/ofh/ecpri/ecpri_packet_properties.h"
@@ -31,14 +32,17 @@
 #include "ocudu/ran/prach/prach_preamble_information.h"
 #include "ocudu/ran/resource_block.h"
 #include "ocudu/ran/slot_point.h"
+#include "ocudu/ocuduvec/conversion.h"
 #include "ocudu/support/config_parsers.h"
 #include "ocudu/support/executors/task_execution_manager.h"
 #include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/file_tensor.h"
 #include "ocudu/support/format/fmt_to_c_str.h"
 #include "ocudu/support/signal_handling.h"
 #include "fmt/chrono.h"
 #include "fmt/color.h"
 #include <arpa/inet.h>
+#include <fstream>
 #include <random>
 #ifdef DPDK_FOUND
 #include "ocudu/hal/dpdk/dpdk_eal_factory.h"
@@ -110,6 +114,10 @@ struct ru_emulator_config {
   std::vector<unsigned> prach_eaxc;
   /// PRACH format.
   ru_emulator_prach_format prach_format;
+  /// Binary file with the uplink IQ grid, random IQ data is sent when empty.
+  std::string ul_iq_file;
+  /// Binary file with the PRACH IQ grid, random IQ data is sent when empty.
+  std::string prach_iq_file;
 };
 
 /// RU emulator dependencies.
@@ -189,6 +197,48 @@ static void fill_random_data(span<uint8_t> frame, unsigned seed)
   std::generate(frame.begin(), frame.end(), [&]() { return dist(rgen); });
 }
 
+/// \brief Loads the IQ grids of consecutive slots from a binary file of complex floats.
+///
+/// \param[in] filename Binary file name.
+/// \param[in] dims     Dimensions of the grid of one slot, namely the number of subcarriers, symbols and ports.
+/// \return The IQ grids, indexed by subcarrier, symbol, port and slot.
+static dynamic_tensor<4, cf_t> load_iq_grids(const std::string& filename, const std::array<unsigned, 3>& dims)
+{
+  std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    report_error("Unable to open the IQ file '{}'", filename);
+  }
+
+  size_t file_size = file.tellg();
+  size_t grid_size = size_t(dims[0]) * dims[1] * dims[2] * sizeof(cf_t);
+  if ((file_size == 0) || ((file_size % grid_size) != 0)) {
+    report_error("The IQ file '{}' has {} bytes, which is not a multiple of the {} bytes of a grid of {} subcarriers, {} "
+                 "symbols and {} ports",
+                 filename,
+                 file_size,
+                 grid_size,
+                 dims[0],
+                 dims[1],
+                 dims[2]);
+  }
+
+  unsigned nof_grids = file_size / grid_size;
+  return file_tensor<4, cf_t>(filename.c_str(), {dims[0], dims[1], dims[2], nof_grids}).read();
+}
+
+/// Fills the given IQ data field with the compressed resource elements of a PRB range of the given grid symbol.
+static void fill_iq_data(span<uint8_t>                iq_data,
+                         span<const cf_t>             symbol_re,
+                         unsigned                     start_prb,
+                         unsigned                     nof_prbs,
+                         iq_compressor&               compressor,
+                         const ru_compression_params& params)
+{
+  std::vector<cbf16_t> re(nof_prbs * NOF_SUBCARRIERS_PER_RB);
+  ocuduvec::convert(re, symbol_re.subspan(start_prb * NOF_SUBCARRIERS_PER_RB, re.size()));
+  compressor.compress(iq_data, re, params);
+}
+
 /// Fills static OFH header parameters given the static RU config.
 static void set_static_header_params(span<uint8_t> frame, header_parameters params, const ru_emulator_config& cfg)
 {
@@ -229,11 +279,15 @@ static void set_static_header_params(span<uint8_t> frame, header_parameters para
   frame[34] = octet;
 }
 
-/// Returns pre-generated test data for each symbol for each configured eAxC.
-static std::vector<eaxc_buffers> generate_test_data(const ru_emulator_config& cfg, span<const unsigned> ul_eaxc)
+/// \brief Returns pre-generated test data for each symbol for each configured eAxC, for each replayed slot.
+///
+/// The IQ data is compressed from the uplink IQ grids file of the configuration, if any, with one set of buffers per
+/// grid. Otherwise, a single set of buffers is filled with random bytes.
+static std::vector<std::vector<eaxc_buffers>>
+generate_test_data(const ru_emulator_config& cfg, span<const unsigned> ul_eaxc, ocudulog::basic_logger& logger)
 {
-  // Vector of bytes for each frame (up to 2) of each OFDM symbol of each eAxC.
-  std::vector<eaxc_buffers> test_data;
+  // Vector of bytes for each frame (up to 2) of each OFDM symbol of each eAxC, for each replayed slot.
+  std::vector<std::vector<eaxc_buffers>> test_data;
 
   const units::bytes ecpri_iq_data_header_size(8);
   const units::bytes ofh_header_size(10);
@@ -259,51 +313,82 @@ static std::vector<eaxc_buffers> generate_test_data(const ru_emulator_config& cf
     nof_frame_prbs.push_back(nof_prbs_second);
   }
 
+  // Load the uplink IQ grids to replay.
+  std::unique_ptr<iq_compressor>         compressor;
+  std::optional<dynamic_tensor<4, cf_t>> iq_grids;
+  unsigned                               nof_grids = 1;
+  if (!cfg.ul_iq_file.empty()) {
+    std::array<unsigned, 3> dims = {
+        unsigned(cfg.nof_prb * NOF_SUBCARRIERS_PER_RB), unsigned(MAX_NOF_SYMBOLS), unsigned(ul_eaxc.size())};
+    compressor = create_iq_compressor(cfg.compr_params.type, logger);
+    iq_grids.emplace(load_iq_grids(cfg.ul_iq_file, dims));
+    nof_grids = iq_grids->get_dimension_size(3);
+    logger.info("Replaying the {} uplink IQ grid(s) of the file '{}'", nof_grids, cfg.ul_iq_file);
+  }
+
   // Initializes IQ data and Ethernet packet headers for all configured eAxCs (timestamp and sequence index
   // will be updated on every transmission).
-  for (unsigned port = 0, last = ul_eaxc.size(); port != last; ++port) {
-    test_data.emplace_back();
-    auto& eaxc_frames = test_data.back();
-
-    for (unsigned symbol = 0, end = MAX_NOF_SYMBOLS; symbol != end; ++symbol) {
-      eaxc_frames.emplace_back();
-      auto& symbol_frames = eaxc_frames.back();
-
-      unsigned start_prb = 0;
-      for (unsigned j = 0; j != nof_frames; ++j) {
-        unsigned data_size = nof_frame_prbs[j] * prb_size.value();
-
-        symbol_frames.emplace_back();
-        std::vector<uint8_t>& frame = symbol_frames.back();
-        frame.resize(headers_size + data_size);
-
-        // Prepare header.
-        span<uint8_t>     frame_header(frame.data(), headers_size);
-        header_parameters params;
-        params.port         = ul_eaxc[port];
-        params.payload_size = data_size + ofh_header_size.value() + ecpri::ECPRI_COMMON_HEADER_SIZE.value();
-        params.start_prb    = start_prb;
-        params.nof_prbs     = nof_frame_prbs[j];
-        params.filter_index = to_value(filter_index_type::standard_channel_filter);
-
-        set_static_header_params(frame_header, params, cfg);
-
-        // Prepare IQ data.
-        fill_random_data(span<uint8_t>(frame).last(data_size), ul_eaxc[port] + symbol);
-
-        start_prb += nof_frame_prbs[j];
+  for (unsigned grid = 0; grid != nof_grids; ++grid) {
+    auto& grid_frames = test_data.emplace_back();
+    for (unsigned port = 0, last = ul_eaxc.size(); port != last; ++port) {
+      grid_frames.emplace_back();
+      auto& eaxc_frames = grid_frames.back();
+
+      for (unsigned symbol = 0, end = MAX_NOF_SYMBOLS; symbol != end; ++symbol) {
+        eaxc_frames.emplace_back();
+        auto& symbol_frames = eaxc_frames.back();
+
+        unsigned start_prb = 0;
+        for (unsigned j = 0; j != nof_frames; ++j) {
+          unsigned data_size = nof_frame_prbs[j] * prb_size.value();
+
+          symbol_frames.emplace_back();
+          std::vector<uint8_t>& frame = symbol_frames.back();
+          frame.resize(headers_size + data_size);
+
+          // Prepare header.
+          span<uint8_t>     frame_header(frame.data(), headers_size);
+          header_parameters params;
+          params.port         = ul_eaxc[port];
+          params.payload_size = data_size + ofh_header_size.value() + ecpri::ECPRI_COMMON_HEADER_SIZE.value();
+          params.start_prb    = start_prb;
+          params.nof_prbs     = nof_frame_prbs[j];
+          params.filter_index = to_value(filter_index_type::standard_channel_filter);
+
+          set_static_header_params(frame_header, params, cfg);
+
+          // Prepare IQ data.
+          span<uint8_t> iq_data = span<uint8_t>(frame).last(data_size);
+          if (compressor) {
+            fill_iq_data(iq_data,
+                         iq_grids->get_view<1>({symbol, port, grid}),
+                         start_prb,
+                         nof_frame_prbs[j],
+                         *compressor,
+                         cfg.compr_params);
+          } else {
+            fill_random_data(iq_data, ul_eaxc[port] + symbol);
+          }
+
+          start_prb += nof_frame_prbs[j];
+        }
       }
     }
   }
   return test_data;
 }
 
-/// Returns pre-generated PRACH U-Plane data for each configured eAxC.
-static std::vector<prach_eaxc_buffers>
-generate_test_prach(const ru_emulator_config& cfg, span<const unsigned> prach_eaxc, unsigned nof_prach_symbols)
+/// \brief Returns pre-generated PRACH U-Plane data for each configured eAxC.
+///
+/// The IQ data is compressed from the PRACH IQ grids file of the configuration, if any, with one set of buffers per
+/// grid. Otherwise, a single set of buffers is filled with random bytes.
+static std::vector<std::vector<prach_eaxc_buffers>> generate_test_prach(const ru_emulator_config& cfg,
+                                                                        span<const unsigned>      prach_eaxc,
+                                                                        unsigned                  nof_prach_symbols,
+                                                                        ocudulog::basic_logger&   logger)
 {
-  // Vector of bytes for each OFDM symbol of each eAxC.
-  std::vector<prach_eaxc_buffers> test_data;
+  // Vector of bytes for each OFDM symbol of each eAxC, for each replayed slot.
+  std::vector<std::vector<prach_eaxc_buffers>> test_data;
   // Number of PRBs used by IQ samples in each U-Plane packet.
   unsigned nof_prbs = cfg.prach_format == ocudu::ru_emulator_prach_format::LONG_F0 ? PRACH_LONG_FORMAT_NOF_PRB
                                                                                    : PRACH_SHORT_FORMAT_NOF_PRB;
@@ -319,27 +404,49 @@ generate_test_prach(const ru_emulator_config& cfg, span<const unsigned> prach_ea
                               .round_up_to_bytes();
   unsigned iq_data_size = nof_prbs * prb_size.value();
 
-  for (unsigned port = 0, last = prach_eaxc.size(); port != last; ++port) {
-    auto& eaxc_frames = test_data.emplace_back();
-
-    for (unsigned symbol = 0; symbol != nof_prach_symbols; ++symbol) {
-      std::vector<uint8_t>& frame = eaxc_frames.emplace_back();
-      frame.resize(headers_size + iq_data_size);
-
-      // Prepare header.
-      span<uint8_t>     frame_header(frame.data(), headers_size);
-      header_parameters params;
-      params.port         = prach_eaxc[port];
-      params.payload_size = iq_data_size + ofh_header_size.value() + ecpri::ECPRI_COMMON_HEADER_SIZE.value();
-      params.start_prb    = 0;
-      params.nof_prbs     = nof_prbs;
-      params.filter_index = to_value(cfg.prach_format == ocudu::ru_emulator_prach_format::LONG_F0
-                                         ? filter_index_type::ul_prach_preamble_1p25khz
-                                         : filter_index_type::ul_prach_preamble_short);
-      set_static_header_params(frame_header, params, cfg);
-
-      // Prepare IQ data.
-      fill_random_data(span<uint8_t>(frame).last(iq_data_size), prach_eaxc[port] + symbol);
+  // Load the PRACH IQ grids to replay.
+  std::unique_ptr<iq_compressor>         compressor;
+  std::optional<dynamic_tensor<4, cf_t>> iq_grids;
+  unsigned                               nof_grids = 1;
+  if (!cfg.prach_iq_file.empty()) {
+    std::array<unsigned, 3> dims = {
+        unsigned(nof_prbs * NOF_SUBCARRIERS_PER_RB), nof_prach_symbols, unsigned(prach_eaxc.size())};
+    compressor = create_iq_compressor(cfg.compr_params.type, logger);
+    iq_grids.emplace(load_iq_grids(cfg.prach_iq_file, dims));
+    nof_grids = iq_grids->get_dimension_size(3);
+    logger.info("Replaying the {} PRACH IQ grid(s) of the file '{}'", nof_grids, cfg.prach_iq_file);
+  }
+
+  for (unsigned grid = 0; grid != nof_grids; ++grid) {
+    auto& grid_frames = test_data.emplace_back();
+    for (unsigned port = 0, last = prach_eaxc.size(); port != last; ++port) {
+      auto& eaxc_frames = grid_frames.emplace_back();
+
+      for (unsigned symbol = 0; symbol != nof_prach_symbols; ++symbol) {
+        std::vector<uint8_t>& frame = eaxc_frames.emplace_back();
+        frame.resize(headers_size + iq_data_size);
+
+        // Prepare header.
+        span<uint8_t>     frame_header(frame.data(), headers_size);
+        header_parameters params;
+        params.port         = prach_eaxc[port];
+        params.payload_size = iq_data_size + ofh_header_size.value() + ecpri::ECPRI_COMMON_HEADER_SIZE.value();
+        params.start_prb    = 0;
+        params.nof_prbs     = nof_prbs;
+        params.filter_index = to_value(cfg.prach_format == ocudu::ru_emulator_prach_format::LONG_F0
+                                           ? filter_index_type::ul_prach_preamble_1p25khz
+                                           : filter_index_type::ul_prach_preamble_short);
+        set_static_header_params(frame_header, params, cfg);
+
+        // Prepare IQ data.
+        span<uint8_t> iq_data = span<uint8_t>(frame).last(iq_data_size);
+        if (compressor) {
+          fill_iq_data(
+              iq_data, iq_grids->get_view<1>({symbol, port, grid}), 0, nof_prbs, *compressor, cfg.compr_params);
+        } else {
+          fill_random_data(iq_data, prach_eaxc[port] + symbol);
+        }
+      }
     }
   }
   return test_data;
@@ -479,10 +586,11 @@ class ru_emulator : public frame_notifier
   ru_emulator_rx_window_checker dl_up_window_checker;
   ru_emulator_rx_window_checker ul_cp_window_checker;
 
-  // Pre-generated test data for each symbol for each configured eAxC.
-  std::vector<eaxc_buffers> test_data;
-  // Pre-generated PRACH data. Depending on the format it may comprise 1 or 12 symbols for each eAxC.
-  std::vector<prach_eaxc_buffers> test_prach;
+  // Pre-generated test data for each symbol for each configured eAxC, for each replayed slot.
+  std::vector<std::vector<eaxc_buffers>> test_data;
+  // Pre-generated PRACH data for each replayed slot. Depending on the format it may comprise 1 or 12 symbols for each
+  // eAxC.
+  std::vector<std::vector<prach_eaxc_buffers>> test_prach;
   // Number of OFDM symbols comprising PRACH U-Plane transmission.
   unsigned nof_prach_symbols;
   // Keeps track of last used seq_id for each eAxC.
@@ -544,8 +652,8 @@ public:
           get_prach_preamble_short_info(prach_format_type::B4, prach_subcarrier_spacing::kHz30, true).nof_symbols;
     }
 
-    test_data  = generate_test_data(cfg, ul_eaxc);
-    test_prach = generate_test_prach(cfg, prach_eaxc, nof_prach_symbols);
+    test_data  = generate_test_data(cfg, ul_eaxc, logger);
+    test_prach = generate_test_prach(cfg, prach_eaxc, nof_prach_symbols, logger);
   }
 
   // See interface for documentation.
@@ -698,8 +806,10 @@ private:
   {
     static_vector<span<const uint8_t>, MAX_BURST_SIZE> frame_burst;
 
+    // The replayed slots are keyed by the slot index within the frame.
+    auto&    slot_data   = test_data[message_info.symbol_point.get_slot().slot_index() % test_data.size()];
     unsigned eaxc_idx    = std::distance(ul_eaxc.begin(), std::find(ul_eaxc.begin(), ul_eaxc.end(), message_info.eaxc));
-    auto&    eaxc_frames = test_data[eaxc_idx];
+    auto&    eaxc_frames = slot_data[eaxc_idx];
 
     // Set correct header parameters and send UL U-Plane packets for each symbol.
     for (unsigned symbol = message_info.symbol_point.get_symbol_index(), end = message_info.nof_symbols; symbol != end;
@@ -726,7 +836,9 @@ private:
 
     unsigned eaxc_idx =
         std::distance(prach_eaxc.begin(), std::find(prach_eaxc.begin(), prach_eaxc.end(), message_info.eaxc));
-    auto& eaxc_frames = test_prach[eaxc_idx];
+    // The replayed slots are keyed by the slot index within the frame.
+    auto& slot_data   = test_prach[message_info.symbol_point.get_slot().slot_index() % test_prach.size()];
+    auto& eaxc_frames = slot_data[eaxc_idx];
 
     // Set correct header parameters and send PRACH U-Plane packets for each symbol.
     unsigned start_symbol = message_info.symbol_point.get_symbol_index();
@@ -1015,6 +1127,8 @@ int main(int argc, char** argv)
     cfg.mtu_size                    = units::bytes{ETHERNET_FRAME_SIZE};
     cfg.is_promiscuous_mode_enabled = ru_cfg.enable_promiscuous;
     cfg.are_metrics_enabled         = false;
+    cfg.mode                        = ru_cfg.socket_mode;
+    cfg.shm_endpoint                = shm_link_endpoint::ru;
 #ifdef DPDK_FOUND
     if (uses_dpdk) {
       auto ctx = create_dpdk_port_context(cfg);
@@ -1048,6 +1162,8 @@ int main(int argc, char** argv)
     emu_cfg.ul_eaxc       = ru_cfg.ru_ul_port_id;
     emu_cfg.prach_eaxc    = ru_cfg.ru_prach_port_id;
     emu_cfg.prach_format  = ru_cfg.prach_format;
+    emu_cfg.ul_iq_file    = ru_cfg.ul_iq_file;
+    emu_cfg.prach_iq_file = ru_cfg.prach_iq_file;
 
     ru_emulators.push_back(std::make_unique<ru_emulator>(
         resolve_ru_emulator_dependencies(logger, *workers.ru_emulators_exec[i], *transceivers[i]), emu_cfg));
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
 #include "ocudu/ran/bs_channel_bandwidth.h"
 #include <string>
 #include <vector>
@@ -34,8 +35,10 @@ struct ru_emulator_ofh_appconfig {
   std::chrono::microseconds T2a_max_up{300};
   /// T2a minimum parameter for downlink User-Plane in microseconds.
   std::chrono::microseconds T2a_min_up{85};
-  /// Ethernet network interface name or PCI bus identifier.
+  /// Ethernet network interface name, PCI bus identifier or shared-memory link name.
   std::string network_interface;
+  /// Input/output mode of the Ethernet sockets, ignored when DPDK is used.
+  ether::socket_mode socket_mode = ether::socket_mode::standard;
   /// RU emulator MAC address.
   std::string ru_mac_address;
   /// Distributed Unit MAC address.
@@ -58,6 +61,20 @@ struct ru_emulator_ofh_appconfig {
   unsigned ul_compr_bitwidth = 9;
   /// PRACH format used when sending dummy PRACH U-Plane packets.
   ru_emulator_prach_format prach_format = ru_emulator_prach_format::LONG_F0;
+  /// \brief Binary file with the uplink IQ grids of consecutive slots.
+  ///
+  /// The file stores complex floats ordered by slot, port, symbol and subcarrier, covering all the uplink ports, the
+  /// symbols of a slot and the subcarriers of the bandwidth. The grid replayed in a slot is selected by the slot index
+  /// within the frame modulo the number of grids in the file. Since the DU decodes the uplink of a slot according to
+  /// what it scheduled, decoding only succeeds when the grid replayed in the slot was recorded for the same
+  /// allocation. Random IQ data is sent when empty.
+  std::string ul_iq_file;
+  /// \brief Binary file with the PRACH IQ grids of consecutive slots.
+  ///
+  /// The file stores complex floats ordered by slot, port, symbol and subcarrier, covering all the PRACH ports, the
+  /// symbols of the PRACH format and the PRACH subcarriers. The grid replayed in a PRACH occasion is selected by the
+  /// slot index within the frame modulo the number of grids in the file. Random IQ data is sent when empty.
+  std::string prach_iq_file;
 };
 
 /// RU emulator logging parameters.
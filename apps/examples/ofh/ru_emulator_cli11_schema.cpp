@@ -103,8 +103,24 @@ static void configure_cli11_ru_emu_args(CLI::App& app, ru_emulator_ofh_appconfig
   app.add_option("--compr_bitwidth_ul", config.ul_compr_bitwidth, "Uplink compression bit width")
       ->capture_default_str()
       ->check(CLI::IsMember({9, 16}));
-  app.add_option("--network_interface", config.network_interface, "PCIe identifier of network device")
+  app.add_option("--network_interface",
+                 config.network_interface,
+                 "PCIe identifier of network device, or link name when using shared memory")
       ->capture_default_str();
+  add_option_function<std::string>(
+      app,
+      "--socket_mode",
+      [&config](const std::string& value) { config.socket_mode = ether::to_socket_mode(value).value(); },
+      "Input/output mode of the Ethernet sockets, ignored when DPDK is used")
+      ->default_function([&config]() { return to_string(config.socket_mode); })
+      ->capture_default_str()
+      ->check([](const std::string& value) -> std::string {
+        if (ether::to_socket_mode(value).has_value()) {
+          return {};
+        }
+
+        return "Socket mode not supported. Accepted values [standard, tpacket, af_xdp, shm]";
+      });
   app.add_option("--ru_mac_addr", config.ru_mac_address, "Radio Unit MAC address")->capture_default_str();
   app.add_option("--du_mac_addr", config.du_mac_address, "Distributed Unit MAC address")->capture_default_str();
   app.add_option("--vlan_tag", config.vlan_tag, "V-LAN identifier")->capture_default_str()->check(CLI::Range(1, 4094));
@@ -154,6 +170,18 @@ static void configure_cli11_ru_emu_args(CLI::App& app, ru_emulator_ofh_appconfig
                                    "PRACH format. Set to 'long' to use format 0, or 'short' to use format B4")
       ->default_str(prach_format_to_str(config.prach_format))
       ->check(check_prach_format);
+
+  app.add_option("--ul_iq_file",
+                 config.ul_iq_file,
+                 "Binary file with the uplink IQ grids of consecutive slots. The grid replayed in a slot is selected by\n"
+                 "the slot index within the frame modulo the number of grids. The DU only decodes the replayed grid\n"
+                 "when it was recorded for the allocation the DU schedules in that slot")
+      ->check(CLI::ExistingFile);
+  app.add_option("--prach_iq_file",
+                 config.prach_iq_file,
+                 "Binary file with the PRACH IQ grids of consecutive slots. The grid replayed in a PRACH occasion is\n"
+                 "selected by the slot index within the frame modulo the number of grids")
+      ->check(CLI::ExistingFile);
 }
 
 void ocudu::configure_cli11_with_ru_emulator_appconfig_schema(CLI::App& app, ru_emulator_appconfig& ru_emu_parsed_cfg)
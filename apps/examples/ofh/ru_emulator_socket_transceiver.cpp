@@ -15,20 +15,6 @@
 using namespace ocudu;
 using namespace ether;
 
-ru_emu_socket_receiver::ru_emu_socket_receiver(ocudulog::basic_logger&   logger_,
-                                               ocudu::task_executor&     executor_,
-                                               const transmitter_config& config)
-{
-  receiver = create_receiver({config.interface, config.is_promiscuous_mode_enabled, false}, executor_, logger_);
-  ocudu_assert(receiver, "RU emulator failed to initialize Ethernet receiver");
-}
-
-ru_emu_socket_transmitter::ru_emu_socket_transmitter(ocudulog::basic_logger& logger_, const transmitter_config& config)
-{
-  transmitter = create_transmitter(config, logger_);
-  ocudu_assert(transmitter, "RU emulator failed to initialize Ethernet transmitter");
-}
-
 void ru_emu_socket_receiver::start(ether::frame_notifier& notifier_)
 {
   receiver->get_operation_controller().start(notifier_);
@@ -48,6 +34,10 @@ std::unique_ptr<ru_emulator_transceiver> ocudu::ru_emu_create_socket_transceiver
                                                                                  task_executor&            executor,
                                                                                  const transmitter_config& config)
 {
-  return std::make_unique<ru_emulator_transceiver>(std::make_unique<ru_emu_socket_receiver>(logger, executor, config),
-                                                   std::make_unique<ru_emu_socket_transmitter>(logger, config));
+  receiver_config rx_config = {
+      config.interface, config.is_promiscuous_mode_enabled, false, config.mode, config.shm_endpoint};
+  auto [tx, rx] = create_txrx(config, rx_config, executor, logger);
+
+  return std::make_unique<ru_emulator_transceiver>(std::make_unique<ru_emu_socket_receiver>(std::move(rx)),
+                                                   std::make_unique<ru_emu_socket_transmitter>(std::move(tx)));
 }
@@ -114,13 +114,14 @@ private:
   ether::dpdk_port_context&                 port_ctx;
 };
 
-/// Ethernet receiver implementation based on regular UNIX sockets.
+/// Ethernet receiver implementation based on regular UNIX sockets or shared memory.
 class ru_emu_socket_receiver : public ether::receiver, public ether::receiver_operation_controller
 {
 public:
-  ru_emu_socket_receiver(ocudulog::basic_logger&          logger_,
-                         task_executor&                   executor_,
-                         const ether::transmitter_config& cfg);
+  explicit ru_emu_socket_receiver(std::unique_ptr<ether::receiver> receiver_) : receiver(std::move(receiver_))
+  {
+    ocudu_assert(receiver, "RU emulator failed to initialize Ethernet receiver");
+  }
 
   // See interface for documentation.
   ether::receiver_operation_controller& get_operation_controller() override { return *this; }
@@ -138,11 +139,15 @@ private:
   std::unique_ptr<ether::receiver> receiver;
 };
 
-/// Ethernet transmitter implementation based on regular UNIX sockets.
+/// Ethernet transmitter implementation based on regular UNIX sockets or shared memory.
 class ru_emu_socket_transmitter : public ether::transmitter
 {
 public:
-  ru_emu_socket_transmitter(ocudulog::basic_logger& logger_, const ether::transmitter_config& cfg);
+  explicit ru_emu_socket_transmitter(std::unique_ptr<ether::transmitter> transmitter_) :
+    transmitter(std::move(transmitter_))
+  {
+    ocudu_assert(transmitter, "RU emulator failed to initialize Ethernet transmitter");
+  }
 
   // See interface for documentation.
   ether::transmitter_metrics_collector* get_metrics_collector() override { return nullptr; }
@@ -160,7 +165,7 @@ ru_emu_create_dpdk_transceiver(ocudulog::basic_logger&                   logger,
                                task_executor&                            executor,
                                std::shared_ptr<ether::dpdk_port_context> context);
 
-/// Creates RU emulator transceiver based on regular UNIX sockets.
+/// Creates RU emulator transceiver based on regular UNIX sockets or shared memory, depending on the configured mode.
 std::unique_ptr<ru_emulator_transceiver> ru_emu_create_socket_transceiver(ocudulog::basic_logger&          logger,
                                                                           task_executor&                   executor,
                                                                           const ether::transmitter_config& config);
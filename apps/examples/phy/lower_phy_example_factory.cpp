@@ -22,13 +22,15 @@ std::unique_ptr<lower_phy> ocudu::create_lower_phy(const lower_phy_configuration
     fr = frequency_range::FR2;
   }
 
-  // Create DFT factory. It tries to create a FFTW based factory. If FFTW library is not available, it creates a generic
-  // DFT factory.
-  std::shared_ptr<dft_processor_factory> dft_factory = create_dft_processor_factory_fftw_fast();
-  if (dft_factory == nullptr) {
+  // Create DFT factory of the selected type.
+  std::shared_ptr<dft_processor_factory> dft_factory;
+  if ((config.dft_type == "fftw") || (config.dft_type == "auto")) {
+    dft_factory = create_dft_processor_factory_fftw_fast();
+  }
+  if ((dft_factory == nullptr) && (config.dft_type != "fftw")) {
     dft_factory = create_dft_processor_factory_generic();
   }
-  report_fatal_error_if_not(dft_factory, "Failed to create DFT factory.");
+  report_fatal_error_if_not(dft_factory, "Failed to create DFT factory of type {}.", config.dft_type);
 
   // Create OFDM modulator factory.
   ofdm_factory_generic_configuration ofdm_common_config;
@@ -108,16 +108,18 @@ void to_json(nlohmann::json& json, const scheduler_ue_metrics& metrics)
 void to_json(nlohmann::json& json, const scheduler_cell_metrics& metrics)
 {
   // Cell metrics.
-  auto& cell_json                      = json["cell_metrics"];
-  cell_json["pci"]                     = metrics.pci;
-  cell_json["error_indication_count"]  = metrics.nof_error_indications;
-  cell_json["average_latency"]         = metrics.average_decision_latency.count();
-  cell_json["max_latency"]             = metrics.max_decision_latency.count();
-  cell_json["nof_failed_pdcch_allocs"] = metrics.nof_failed_pdcch_allocs;
-  cell_json["nof_failed_uci_allocs"]   = metrics.nof_failed_uci_allocs;
-  cell_json["latency_histogram"]       = metrics.latency_histogram;
-  cell_json["msg3_nof_ok"]             = metrics.nof_msg3_ok;
-  cell_json["msg3_nof_nok"]            = metrics.nof_msg3_nok;
+  auto& cell_json                         = json["cell_metrics"];
+  cell_json["pci"]                        = metrics.pci;
+  cell_json["error_indication_count"]     = metrics.nof_error_indications;
+  cell_json["average_latency"]            = metrics.average_decision_latency.count();
+  cell_json["max_latency"]                = metrics.max_decision_latency.count();
+  cell_json["average_cell_group_latency"] = metrics.average_cell_group_latency.count();
+  cell_json["max_cell_group_latency"]     = metrics.max_cell_group_latency.count();
+  cell_json["nof_failed_pdcch_allocs"]    = metrics.nof_failed_pdcch_allocs;
+  cell_json["nof_failed_uci_allocs"]      = metrics.nof_failed_uci_allocs;
+  cell_json["latency_histogram"]          = metrics.latency_histogram;
+  cell_json["msg3_nof_ok"]                = metrics.nof_msg3_ok;
+  cell_json["msg3_nof_nok"]               = metrics.nof_msg3_nok;
   cell_json["avg_prach_delay"] = metrics.avg_prach_delay_slots.has_value() ? metrics.avg_prach_delay_slots : 0.0f;
   cell_json["late_dl_harqs"]   = metrics.nof_failed_pdsch_allocs_late_harqs;
   cell_json["late_ul_harqs"]   = metrics.nof_failed_pusch_allocs_late_harqs;
@@ -30,6 +30,10 @@ void to_json(nlohmann::json& json, const timing_metrics& metrics)
 {
   json["nof_skipped_symbols"]       = metrics.nof_skipped_symbols;
   json["skipped_symbols_max_burst"] = metrics.skipped_symbols_max_burst;
+  json["wakeup_jitter_min_us"]      = metrics.wakeup_jitter_min_us;
+  json["wakeup_jitter_max_us"]      = metrics.wakeup_jitter_max_us;
+  json["wakeup_jitter_avg_us"]      = metrics.wakeup_jitter_avg_us;
+  json["wakeup_jitter_histogram"]   = metrics.wakeup_jitter_histogram;
 }
 
 } // namespace ofh
@@ -151,6 +155,10 @@ static nlohmann::json generate_message_transmitter(const ofh::message_transmitte
   json["max_latency_us"]     = validate_fp_value(metrics.message_tx_max_latency_us);
   json["cpu_usage_percent"] =
       validate_fp_value(validate_fp_value(metrics.cpu_usage_us / (metrics_period_ms * 1e3) * 100.0f));
+  json["average_symbol_burst_size"] = validate_fp_value(metrics.avg_symbol_burst_size);
+  json["max_symbol_burst_size"]     = metrics.max_symbol_burst_size;
+  json["nof_on_time_batches"]       = metrics.nof_on_time_batches;
+  json["nof_late_batches"]          = metrics.nof_late_batches;
 
   return json;
 }
@@ -512,8 +512,9 @@ void worker_manager::create_ofh_executors(const worker_manager_config::ru_ofh_co
   }
 
   // Downlink and uplink executors.
-  exec_mapper_config.downlink_executor = rt_hi_prio_exec;
-  exec_mapper_config.uplink_executor   = rt_hi_prio_exec;
+  exec_mapper_config.downlink_executor               = rt_hi_prio_exec;
+  exec_mapper_config.uplink_executor                 = rt_hi_prio_exec;
+  exec_mapper_config.nof_uplink_executors_per_sector = config.nof_uplink_executors_per_cell;
 
   // Executor for Open Fronthaul messages transmission and reception.
   {
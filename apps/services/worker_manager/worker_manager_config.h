@@ -27,6 +27,8 @@ struct worker_manager_config {
     os_sched_affinity_bitmask ru_timing_cpu;
     /// Vector of affinities for the txrx workers.
     std::vector<os_sched_affinity_bitmask> txrx_affinities;
+    /// Number of uplink executors per cell.
+    unsigned nof_uplink_executors_per_cell = 1;
   };
 
   /// RU SDR worker configuration.
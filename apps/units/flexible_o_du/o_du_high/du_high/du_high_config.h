@@ -62,6 +62,8 @@ struct du_high_unit_logger_config {
   bool f1ap_json_enabled = false;
   /// Log metrics (e.g. context switches) when RT slowdowns are detected.
   bool high_latency_diagnostics_enabled = false;
+  /// Path of the file where the scheduler inputs are recorded for offline replay. Empty to disable the recording.
+  std::string sched_input_trace_filename;
 };
 
 /// DU high tracing functionalities.
@@ -1199,6 +1201,9 @@ struct du_high_unit_execution_queues_config {
 struct du_high_unit_expert_execution_config {
   /// \brief Task executor configuration for the DU.
   du_high_unit_execution_queues_config du_queue_cfg;
+  /// \brief Number of dedicated scheduler threads that schedule the independent cell groups concurrently. If zero, each
+  /// cell is scheduled in the context of its slot indication.
+  unsigned nof_scheduler_cell_group_workers = 0;
 };
 
 /// RLC UM TX configuration
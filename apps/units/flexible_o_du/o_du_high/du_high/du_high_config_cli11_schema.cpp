@@ -139,6 +139,11 @@ static void configure_cli11_log_args(CLI::App& app, du_high_unit_logger_config&
              log_params.high_latency_diagnostics_enabled,
              "Log performance diagnostics when high computational latencies are detected")
       ->always_capture_default();
+  add_option(app,
+             "--sched_input_trace_filename",
+             log_params.sched_input_trace_filename,
+             "Record the scheduler inputs in the given binary trace file for offline replay. Empty to disable")
+      ->capture_default_str();
 }
 
 static void configure_cli11_trace_args(CLI::App& app, du_high_unit_tracer_config& config)
@@ -156,6 +161,15 @@ static void configure_cli11_expert_execution_args(CLI::App& app, du_high_unit_ex
              config.du_queue_cfg.ue_data_executor_queue_size,
              "DU's UE executor task queue size for PDU processing")
       ->capture_default_str();
+
+  CLI::App* sched_subcmd = add_subcommand(app, "scheduler", "Scheduler execution parameters")->configurable();
+  add_option(*sched_subcmd,
+             "--nof_cell_group_workers",
+             config.nof_scheduler_cell_group_workers,
+             "Number of dedicated threads that schedule the independent cell groups concurrently. Zero to schedule "
+             "each cell in the context of its slot indication")
+      ->capture_default_str()
+      ->check(CLI::Range(0U, static_cast<unsigned>(MAX_DU_CELL_GROUPS)));
 }
 
 static void configure_cli11_pdcch_common_args(CLI::App& app, pdcch_common_unit_config& common_params)
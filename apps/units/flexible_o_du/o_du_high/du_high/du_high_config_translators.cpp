@@ -1193,6 +1193,10 @@ static scheduler_expert_config generate_scheduler_expert_config(const du_high_un
   // Logging and tracing.
   out_cfg.log_broadcast_messages       = config.loggers.broadcast_enabled;
   out_cfg.log_high_latency_diagnostics = config.loggers.high_latency_diagnostics_enabled;
+  out_cfg.input_trace_file             = config.loggers.sched_input_trace_filename;
+
+  // Execution parameters.
+  out_cfg.nof_cell_group_workers = config.expert_execution_cfg.nof_scheduler_cell_group_workers;
 
   const error_type<std::string> error = is_scheduler_expert_config_valid(out_cfg);
   if (!error) {
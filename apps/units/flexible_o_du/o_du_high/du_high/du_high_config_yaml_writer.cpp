@@ -58,6 +58,7 @@ static void fill_du_high_log_section(YAML::Node node, const du_high_unit_logger_
   node["broadcast_enabled"]                = config.broadcast_enabled;
   node["high_latency_diagnostics_enabled"] = config.high_latency_diagnostics_enabled;
   node["f1ap_json_enabled"]                = config.f1ap_json_enabled;
+  node["sched_input_trace_filename"]       = config.sched_input_trace_filename;
 }
 
 static void fill_du_high_tracer_layers_section(YAML::Node node, const du_high_unit_tracer_config& config)
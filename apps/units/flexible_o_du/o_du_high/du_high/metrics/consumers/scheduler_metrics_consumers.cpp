@@ -241,6 +241,12 @@ void scheduler_cell_metrics_consumer_log::handle_metric(const std::optional<sche
           " pdsch_rbs_per_tdd_slot_idx=[{}]",
           fmt::join(cell.pdsch_prbs_used_per_tdd_slot_idx.begin(), cell.pdsch_prbs_used_per_tdd_slot_idx.end(), ", "));
     }
+    if (cell.max_cell_group_latency.count() > 0) {
+      fmt::format_to(std::back_inserter(buffer),
+                     " mean_cell_group_latency={}usec max_cell_group_latency={}usec",
+                     cell.average_cell_group_latency.count(),
+                     cell.max_cell_group_latency.count());
+    }
     if (max_crc_delay != std::numeric_limits<float>::min()) {
       fmt::format_to(std::back_inserter(buffer), " max_crc_delay={}ms", max_crc_delay);
     }
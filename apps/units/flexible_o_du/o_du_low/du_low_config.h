@@ -31,6 +31,11 @@ struct du_low_unit_expert_upper_phy_config {
   bool pusch_decoder_early_stop = true;
   /// Set to true for forcing the LDPC decoder to decode even if the number of soft bits is insufficient.
   bool pusch_decoder_force_decoding = false;
+  /// \brief Maximum number of PUSCH codeblocks decoded jointly by the LDPC decoder.
+  ///
+  /// Codeblocks from concurrent PUSCH transmissions are batched when there are more codeblocks to decode than PUSCH
+  /// decoder threads. Set to one to disable batching.
+  unsigned pusch_decoder_max_codeblock_batch_size = 1;
   /// \brief Selects a PUSCH SINR calculation method.
   ///
   /// Available methods:
@@ -59,9 +64,16 @@ struct du_low_unit_expert_upper_phy_config {
   /// \brief PUSCH channel equalizer algorithm.
   ///
   /// Use one of these options:
-  /// - \c zf: use zero-forcing algorithm, or
-  /// - \c mmse: use minimum mean square error algorithm.
+  /// - \c zf: use zero-forcing algorithm,
+  /// - \c mmse: use minimum mean square error algorithm, or
+  /// - \c mmse_irc: use minimum mean square error algorithm with interference rejection combining.
   std::string pusch_channel_equalizer_algorithm = "zf";
+  /// \brief Enables PUSCH pipelining.
+  ///
+  /// The PUSCH processing starts when the last DM-RS symbol of the transmission is received, and the data symbols are
+  /// demodulated as they are received. It reduces the PUSCH processing latency at the expense of a higher number of
+  /// PUSCH tasks.
+  bool enable_pusch_pipelining = false;
   /// \brief Request headroom size in slots.
   ///
   /// The request headroom size is the number of delayed slots that the upper physical layer will accept, ie, if the
@@ -14,6 +14,7 @@
 #include "apps/services/worker_manager/cli11_cpu_affinities_parser_helper.h"
 #include "du_low_config.h"
 #include "ocudu/adt/expected.h"
+#include "ocudu/phy/upper/channel_coding/ldpc/ldpc_decoder.h"
 #include "ocudu/ran/slot_point.h"
 #include "ocudu/ran/slot_point_extended.h"
 #include "ocudu/support/cli11_utils.h"
@@ -180,10 +181,10 @@ static void configure_cli11_expert_phy_args(CLI::App& app, du_low_unit_expert_up
     return "Invalid PUSCH channel estimator time-domain strategy. Accepted values [average,interpolate]";
   };
   auto pusch_channel_equalizer_algorithm_method_check = [](const std::string& value) -> std::string {
-    if ((value == "zf") || (value == "mmse")) {
+    if ((value == "zf") || (value == "mmse") || (value == "mmse_irc")) {
       return {};
     }
-    return "Invalid PUSCH channel equalizer algorithm. Accepted values [zf,mmse]";
+    return "Invalid PUSCH channel equalizer algorithm. Accepted values [zf,mmse,mmse_irc]";
   };
 
   add_option(app,
@@ -208,6 +209,12 @@ static void configure_cli11_expert_phy_args(CLI::App& app, du_low_unit_expert_up
              expert_phy_params.pusch_decoder_force_decoding,
              "Forces PUSCH LDPC decoder to decode always")
       ->capture_default_str();
+  add_option(app,
+             "--pusch_dec_max_codeblock_batch_size",
+             expert_phy_params.pusch_decoder_max_codeblock_batch_size,
+             "Maximum number of PUSCH codeblocks decoded jointly by the LDPC decoder")
+      ->capture_default_str()
+      ->check(CLI::Range(1U, ldpc_decoder::max_batch_size));
   add_option(app,
              "--pusch_sinr_calc_method",
              expert_phy_params.pusch_sinr_calc_method,
@@ -234,9 +241,14 @@ static void configure_cli11_expert_phy_args(CLI::App& app, du_low_unit_expert_up
   add_option(app,
              "--pusch_channel_equalizer_algorithm",
              expert_phy_params.pusch_channel_equalizer_algorithm,
-             "PUSCH channel equalizer algorithm: zf and mmse.")
+             "PUSCH channel equalizer algorithm: zf, mmse and mmse_irc.")
       ->capture_default_str()
       ->check(pusch_channel_equalizer_algorithm_method_check);
+  add_option(app,
+             "--enable_pusch_pipelining",
+             expert_phy_params.enable_pusch_pipelining,
+             "Starts the PUSCH processing before the last OFDM symbol of the transmission is received.")
+      ->capture_default_str();
   add_option(app,
              "--max_request_headroom_slots",
              expert_phy_params.nof_slots_request_headroom,
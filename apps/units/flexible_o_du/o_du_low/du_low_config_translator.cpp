@@ -58,6 +58,8 @@ static odu::du_low_config generate_du_low_config(const du_low_unit_config&
   upper_phy_factory_config.ldpc_decoder_iterations           = du_low.expert_phy_cfg.pusch_decoder_max_iterations;
   upper_phy_factory_config.ldpc_decoder_early_stop           = du_low.expert_phy_cfg.pusch_decoder_early_stop;
   upper_phy_factory_config.ldpc_decoder_force_decoding       = du_low.expert_phy_cfg.pusch_decoder_force_decoding;
+  upper_phy_factory_config.pusch_max_codeblock_batch_size =
+      du_low.expert_phy_cfg.pusch_decoder_max_codeblock_batch_size;
   upper_phy_factory_config.nof_rx_ports                      = max_nof_rx_antennas;
   upper_phy_factory_config.ul_bw_rb                          = max_ul_bw_rb;
   upper_phy_factory_config.pusch_max_nof_layers              = pusch_max_nof_layers;
@@ -166,6 +168,7 @@ static odu::du_low_config generate_du_low_config(const du_low_unit_config&
     upper_phy_cell.dl_bw_rb                   = bw_rb;
     upper_phy_cell.ul_bw_rb                   = bw_rb;
     upper_phy_cell.pusch_max_nof_layers       = cell.pusch_max_nof_layers;
+    upper_phy_cell.enable_pusch_pipelining    = du_low.expert_phy_cfg.enable_pusch_pipelining;
     upper_phy_cell.active_scs                 = {};
     upper_phy_cell.active_scs[to_numerology_value(cell.scs_common)] = true;
     upper_phy_cell.rx_buffer_config.nof_buffers                     = nof_buffers;
@@ -58,11 +58,13 @@ static void fill_du_low_expert_section(YAML::Node node, const du_low_unit_expert
   node["pusch_dec_max_iterations"]                 = config.pusch_decoder_max_iterations;
   node["pusch_dec_enable_early_stop"]              = config.pusch_decoder_early_stop;
   node["pusch_decoder_force_decoding"]             = config.pusch_decoder_force_decoding;
+  node["pusch_dec_max_codeblock_batch_size"]       = config.pusch_decoder_max_codeblock_batch_size;
   node["pusch_sinr_calc_method"]                   = config.pusch_sinr_calc_method;
   node["pusch_channel_estimator_fd_strategy"]      = config.pusch_channel_estimator_fd_strategy;
   node["pusch_channel_estimator_td_strategy"]      = config.pusch_channel_estimator_td_strategy;
   node["pusch_channel_estimator_cfo_compensation"] = config.pusch_channel_estimator_cfo_compensation;
   node["pusch_channel_equalizer_algorithm"]        = config.pusch_channel_equalizer_algorithm;
+  node["enable_pusch_pipelining"]                  = config.enable_pusch_pipelining;
   node["max_request_headroom_slots"]               = config.nof_slots_request_headroom;
   node["allow_request_on_empty_uplink_slot"]       = config.allow_request_on_empty_uplink_slot;
   node["enable_phy_tap"]                           = config.enable_phy_tap;
@@ -12,6 +12,7 @@
 
 #include "apps/helpers/metrics/metrics_config.h"
 #include "apps/services/worker_manager/os_sched_affinity_manager.h"
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
 #include "ocudu/ofh/receiver/ofh_receiver_configuration.h"
 #include "ocudu/ofh/serdes/ofh_cplane_message_properties.h"
 #include "ocudu/ran/bs_channel_bandwidth.h"
@@ -134,6 +135,12 @@ struct ru_ofh_unit_cell_config {
   bool enable_promiscuous_mode = false;
   /// Ethernet link status checking flag.
   bool check_link_status = false;
+  /// Socket input/output mode, ignored when DPDK is used.
+  ether::socket_mode socket_mode = ether::socket_mode::standard;
+  /// \brief Number of batches in which the frames transmitted in a symbol are spread across the symbol duration.
+  ///
+  /// One batch disables the transmission pacing.
+  unsigned nof_tx_batches_per_symbol = 1;
   /// MTU size.
   units::bytes mtu_size{9000};
   /// Radio Unit MAC address.
@@ -171,6 +178,8 @@ struct ru_ofh_unit_expert_execution_config {
   std::vector<os_sched_affinity_bitmask> txrx_affinities;
   /// CPU affinities per cell.
   std::vector<ru_ofh_unit_cpu_affinities_cell_config> cell_affinities = {{}};
+  /// Number of uplink executors per cell that decode the received Open Fronthaul messages in parallel.
+  unsigned nof_uplink_executors_per_cell = 1;
 };
 
 /// HAL configuration.
@@ -193,6 +202,12 @@ struct ru_ofh_unit_config {
   unsigned gps_Alpha = 0;
   /// GPS Beta - Valid value range: [-32768, 32767].
   int gps_Beta = 0;
+  /// PTP hardware clock device used as timing source, for example /dev/ptp0. When empty, the system clock is used.
+  std::string ptp_clock_device;
+  /// Offset in seconds between the time of the PTP hardware clock and UTC.
+  unsigned ptp_clock_utc_offset_s = 37;
+  /// Time in microseconds before each OTA symbol boundary from which the timing worker polls the clock continuously.
+  unsigned timing_spin_margin_us = 10;
   /// Downlink processing time in microseconds.
   unsigned dl_processing_time = 400U;
   /// Uplink request processing time in microseconds.
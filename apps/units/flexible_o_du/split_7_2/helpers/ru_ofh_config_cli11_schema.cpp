@@ -315,6 +315,27 @@ static void configure_cli11_ru_ofh_cells_args(CLI::App& app, ru_ofh_unit_cell_co
       ->capture_default_str();
   add_option(app, "--check_link_status", config.check_link_status, "Ethernet link status checking flag")
       ->capture_default_str();
+  add_option_function<std::string>(
+      app,
+      "--socket_mode",
+      [&config](const std::string& value) { config.socket_mode = ether::to_socket_mode(value).value(); },
+      "Input/output mode of the Ethernet sockets, ignored when DPDK is used")
+      ->default_function([&config]() { return to_string(config.socket_mode); })
+      ->capture_default_str()
+      ->check([](const std::string& value) -> std::string {
+        if (ether::to_socket_mode(value).has_value()) {
+          return {};
+        }
+
+        return "Socket mode not supported. Accepted values [standard, tpacket, af_xdp, shm]";
+      });
+  add_option(app,
+             "--nof_tx_batches_per_symbol",
+             config.nof_tx_batches_per_symbol,
+             "Number of batches in which the frames transmitted in a symbol are spread across the symbol duration. "
+             "Set to 1 to transmit the frames of a symbol back to back")
+      ->capture_default_str()
+      ->check(CLI::Range(1, 32));
   add_option(app, "--mtu", config.mtu_size, "NIC interface MTU size")
       ->capture_default_str()
       ->check(CLI::Range(1500, 9600));
@@ -338,6 +359,22 @@ static void configure_cli11_ru_ofh_args(CLI::App& app, ru_ofh_unit_parsed_config
       ->capture_default_str()
       ->check(CLI::Range(0.0, 1.2288e7));
   add_option(app, "--gps_beta", ofh_cfg.gps_Beta, "GPS Beta")->capture_default_str()->check(CLI::Range(-32768, 32767));
+  add_option(app,
+             "--ptp_clock",
+             ofh_cfg.ptp_clock_device,
+             "PTP hardware clock device used as timing source, e.g. /dev/ptp0. Uses the system clock when empty")
+      ->capture_default_str();
+  add_option(app,
+             "--ptp_clock_utc_offset",
+             ofh_cfg.ptp_clock_utc_offset_s,
+             "Offset in seconds between the PTP hardware clock time and UTC")
+      ->capture_default_str();
+  add_option(app,
+             "--timing_spin_margin",
+             ofh_cfg.timing_spin_margin_us,
+             "Time in microseconds before each symbol boundary from which the timing worker polls the clock")
+      ->capture_default_str()
+      ->check(CLI::Range(0, 100));
 
   // Common cell parameters.
   auto* base_cell_group = app.add_option_group("base_cell");
@@ -400,6 +437,18 @@ static void configure_cli11_cell_affinity_args(CLI::App& app, ru_ofh_unit_cpu_af
 
 static void configure_cli11_expert_execution_args(CLI::App& app, ru_ofh_unit_expert_execution_config& config)
 {
+  // Threads section.
+  CLI::App* threads_subcmd = add_subcommand(app, "threads", "Threads configuration")->configurable();
+  CLI::App* ofh_threads_subcmd =
+      add_subcommand(*threads_subcmd, "ofh", "Open Fronthaul threads configuration")->configurable();
+  add_option(*ofh_threads_subcmd,
+             "--nof_uplink_executors",
+             config.nof_uplink_executors_per_cell,
+             "Number of uplink executors per cell that decode the received messages in parallel. The messages are "
+             "distributed among the executors by eAxC")
+      ->capture_default_str()
+      ->check(CLI::Range(1U, static_cast<unsigned>(ofh::MAX_SUPPORTED_EAXC_ID_VALUE)));
+
   // Affinities section.
   CLI::App* affinities_subcmd = add_subcommand(app, "affinities", "gNB CPU affinities configuration")->configurable();
   CLI::App* ofh_subcmd =
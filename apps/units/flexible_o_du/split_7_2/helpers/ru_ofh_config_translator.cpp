@@ -68,8 +68,11 @@ static void generate_config(ru_ofh_configuration&                            out
                             span<const flexible_o_du_ru_config::cell_config> cells,
                             unsigned                                         max_processing_delay_slots)
 {
-  out_cfg.gps_Alpha = ru_cfg.gps_Alpha;
-  out_cfg.gps_Beta  = ru_cfg.gps_Beta;
+  out_cfg.gps_Alpha            = ru_cfg.gps_Alpha;
+  out_cfg.gps_Beta             = ru_cfg.gps_Beta;
+  out_cfg.ptp_clock_device     = ru_cfg.ptp_clock_device;
+  out_cfg.ptp_clock_utc_offset = std::chrono::seconds(ru_cfg.ptp_clock_utc_offset_s);
+  out_cfg.timing_spin_margin   = std::chrono::microseconds(ru_cfg.timing_spin_margin_us);
 
   // Add one cell.
   for (unsigned i = 0, e = ru_cfg.cells.size(); i != e; ++i) {
@@ -85,6 +88,8 @@ static void generate_config(ru_ofh_configuration&                            out
     sector_cfg.interface                    = ofh_cell_cfg.network_interface;
     sector_cfg.is_promiscuous_mode_enabled  = ofh_cell_cfg.enable_promiscuous_mode;
     sector_cfg.is_link_status_check_enabled = ofh_cell_cfg.check_link_status;
+    sector_cfg.socket_mode                  = ofh_cell_cfg.socket_mode;
+    sector_cfg.nof_tx_batches_per_symbol    = ofh_cell_cfg.nof_tx_batches_per_symbol;
     sector_cfg.are_metrics_enabled          = ru_cfg.metrics_cfg.enable_ru_metrics;
     sector_cfg.mtu_size                     = ofh_cell_cfg.mtu_size;
     if (!parse_mac_address(ofh_cell_cfg.du_mac_address, sector_cfg.mac_src_address)) {
@@ -181,10 +186,11 @@ ru_ofh_configuration ocudu::generate_ru_ofh_config(const ru_ofh_unit_config&
 
 void ocudu::fill_ofh_worker_manager_config(worker_manager_config& config, const ru_ofh_unit_config& ru_cfg)
 {
-  auto& ofh_cfg           = config.ru_ofh_cfg.emplace();
-  ofh_cfg.nof_cells       = ru_cfg.cells.size();
-  ofh_cfg.ru_timing_cpu   = ru_cfg.expert_execution_cfg.ru_timing_cpu;
-  ofh_cfg.txrx_affinities = ru_cfg.expert_execution_cfg.txrx_affinities;
+  auto& ofh_cfg                         = config.ru_ofh_cfg.emplace();
+  ofh_cfg.nof_cells                     = ru_cfg.cells.size();
+  ofh_cfg.ru_timing_cpu                 = ru_cfg.expert_execution_cfg.ru_timing_cpu;
+  ofh_cfg.txrx_affinities               = ru_cfg.expert_execution_cfg.txrx_affinities;
+  ofh_cfg.nof_uplink_executors_per_cell = ru_cfg.expert_execution_cfg.nof_uplink_executors_per_cell;
 
   // If ru_txrx_cpus parameters are not specified, use the affinities of ru_cpus parameters of the cells.
   if (ofh_cfg.txrx_affinities.empty()) {
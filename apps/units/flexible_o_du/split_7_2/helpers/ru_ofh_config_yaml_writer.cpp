@@ -21,6 +21,12 @@ static void fill_ru_ofh_log_section(YAML::Node node, const ru_ofh_unit_logger_co
 
 static void fill_ru_ofh_expert_execution_section(YAML::Node node, const ru_ofh_unit_expert_execution_config& config)
 {
+  {
+    YAML::Node threads_node                  = node["threads"];
+    YAML::Node ofh_threads_node              = threads_node["ofh"];
+    ofh_threads_node["nof_uplink_executors"] = config.nof_uplink_executors_per_cell;
+  }
+
   YAML::Node affinities_node = node["affinities"];
   YAML::Node ofh_node        = affinities_node["ofh"];
   ofh_node["timing_cpu"]     = fmt::format("{:,}", span<const size_t>(config.ru_timing_cpu.get_cpu_ids()));
@@ -100,12 +106,14 @@ static YAML::Node build_ru_ofh_cell_section(const ru_ofh_unit_cell_config& confi
                  std::get_if<ru_ofh_legacy_scaling_config>(&config.cell.iq_scaling_config)) {
     node["iq_scaling"] = legacy_scaling_params->iq_scaling;
   }
-  node["network_interface"]  = config.network_interface;
-  node["enable_promiscuous"] = config.enable_promiscuous_mode;
-  node["mtu"]                = config.mtu_size.value();
-  node["ru_mac_addr"]        = config.ru_mac_address;
-  node["du_mac_addr"]        = config.du_mac_address;
-  node["check_link_status"]  = config.check_link_status;
+  node["network_interface"]         = config.network_interface;
+  node["enable_promiscuous"]        = config.enable_promiscuous_mode;
+  node["mtu"]                       = config.mtu_size.value();
+  node["ru_mac_addr"]               = config.ru_mac_address;
+  node["du_mac_addr"]               = config.du_mac_address;
+  node["check_link_status"]         = config.check_link_status;
+  node["socket_mode"]               = to_string(config.socket_mode);
+  node["nof_tx_batches_per_symbol"] = config.nof_tx_batches_per_symbol;
 
   if (config.vlan_tag_cp.has_value()) {
     node["vlan_tag_cp"] = config.vlan_tag_cp.value();
@@ -128,8 +136,11 @@ static YAML::Node build_ru_ofh_cell_section(const ru_ofh_unit_cell_config& confi
 
 static void fill_ru_ofh_section(YAML::Node node, const ru_ofh_unit_config& config)
 {
-  node["gps_alpha"] = config.gps_Alpha;
-  node["gps_beta"]  = config.gps_Beta;
+  node["gps_alpha"]            = config.gps_Alpha;
+  node["gps_beta"]             = config.gps_Beta;
+  node["ptp_clock"]            = config.ptp_clock_device;
+  node["ptp_clock_utc_offset"] = config.ptp_clock_utc_offset_s;
+  node["timing_spin_margin"]   = config.timing_spin_margin_us;
 
   for (const auto& cell : config.cells) {
     node["cells"].push_back(build_ru_ofh_cell_section(cell));
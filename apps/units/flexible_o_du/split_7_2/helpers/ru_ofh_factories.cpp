@@ -39,6 +39,10 @@ std::unique_ptr<radio_unit> ocudu::create_ofh_radio_unit(const ru_ofh_unit_confi
     sector_deps.uplink_executor   = &ofh_exec_map[i].uplink_executor();
     sector_deps.downlink_executor = &ofh_exec_map[i].downlink_executor();
     sector_deps.logger            = dependencies.logger;
+
+    span<task_executor* const> additional_uplink_executors = ofh_exec_map[i].additional_uplink_executors();
+    sector_deps.additional_uplink_executors.assign(additional_uplink_executors.begin(),
+                                                   additional_uplink_executors.end());
   }
 
   return create_ofh_ru(generate_ru_ofh_config(ru_cfg, ru_config.cells, ru_config.max_processing_delay),
@@ -20,6 +20,8 @@ namespace ocudu {
 struct ru_sdr_unit_expert_config {
   /// System time-based throttling. See \ref lower_phy_configuration::system_time_throttling for more information.
   float lphy_dl_throttling = 0.0F;
+  /// DFT implementation of the lower PHY. See \ref lower_phy_configuration::dft_type for more information.
+  std::string lphy_dft_type = "generic";
   /// \brief Selects the radio transmission mode.
   ///
   /// Selects the radio transmission mode between the available options:
@@ -48,6 +48,15 @@ static void configure_cli11_ru_sdr_expert_args(CLI::App& app, ru_sdr_unit_expert
              "that the downlink packets are processed with a minimum period of 90% of the buffer duration.\n"
              "Set to zero to disable this feature.")
       ->capture_default_str();
+  add_option(app,
+             "--low_phy_dft_type",
+             config.lphy_dft_type,
+             "DFT implementation of the lower PHY.\n"
+             "  generic: the DFT tables are precomputed at startup.\n"
+             "  fftw:    FFTW, which measures the DFT plans at startup.\n"
+             "  auto:    FFTW if it is available, otherwise generic.\n")
+      ->capture_default_str()
+      ->check(CLI::IsMember({"generic", "fftw", "auto"}));
   add_option(app,
              "--tx_mode",
              config.transmission_mode,
@@ -53,6 +53,9 @@ static lower_phy_configuration generate_lower_phy_config(const flexible_o_du_ru_
   // Get lower PHY system time throttling.
   out_cfg.system_time_throttling = ru_cfg.expert_cfg.lphy_dl_throttling;
 
+  // Get lower PHY DFT implementation.
+  out_cfg.dft_type = ru_cfg.expert_cfg.lphy_dft_type;
+
   // Set max concurrent PRACH requests to the max processing delay (in slots) plus 2 extra slots: one for sample
   // collection and one for potential processing delay.
   out_cfg.max_nof_prach_concurrent_requests = max_processing_delay_slot + 2;
@@ -116,6 +116,7 @@ static void fill_ru_sdr_section(YAML::Node node, const ru_sdr_unit_config& confi
   {
     YAML::Node expert_node               = node["expert_cfg"];
     expert_node["low_phy_dl_throttling"] = config.expert_cfg.lphy_dl_throttling;
+    expert_node["low_phy_dft_type"]      = config.expert_cfg.lphy_dft_type;
     expert_node["tx_mode"]               = config.expert_cfg.transmission_mode;
     expert_node["power_ramping_time_us"] = config.expert_cfg.power_ramping_time_us;
   }
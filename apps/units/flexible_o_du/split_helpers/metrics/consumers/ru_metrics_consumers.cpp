@@ -15,6 +15,7 @@
 #include "apps/services/remote_control/remote_server_metrics_gateway.h"
 #include "ocudu/ru/ru_metrics.h"
 #include "ocudu/support/format/fmt_to_c_str.h"
+#include "fmt/ranges.h"
 
 using namespace ocudu;
 using namespace app_helpers;
@@ -134,11 +135,16 @@ static void log_ru_ofh_performance_metrics_verbose(fmt::basic_memory_buffer<char
                  validate_fp_value(ul_cp_df_metrics.message_packing_avg_latency_us));
 
   fmt::format_to(std::back_inserter(buffer),
-                 "{} cpu_usage={:.1f}% max_latency={:.2f}us avg_latency={:.2f}us; ",
+                 "{} cpu_usage={:.1f}% max_latency={:.2f}us avg_latency={:.2f}us avg_burst={:.1f} max_burst={} "
+                 "on_time_batches={} late_batches={}; ",
                  "message_tx:",
                  validate_fp_value(msg_tx_cpu_usage),
                  validate_fp_value(msg_tx_metrics.message_tx_max_latency_us),
-                 validate_fp_value(msg_tx_metrics.message_tx_avg_latency_us));
+                 validate_fp_value(msg_tx_metrics.message_tx_avg_latency_us),
+                 validate_fp_value(msg_tx_metrics.avg_symbol_burst_size),
+                 msg_tx_metrics.max_symbol_burst_size,
+                 msg_tx_metrics.nof_on_time_batches,
+                 msg_tx_metrics.nof_late_batches);
 
   fmt::format_to(std::back_inserter(buffer),
                  "{} nof_late_dl_rgs={} nof_late_ul_req={} nof_late_cp_dl={} nof_late_up_dl={} nof_late_cp_ul={}",
@@ -160,11 +166,17 @@ static void log_ru_ofh_metrics(ocudulog::log_channel&   log_chan,
 
   fmt::format_to(std::back_inserter(buffer),
                  "OFH metrics: timing metrics: nof_skipped_symbols={} skipped_symbols_max_burst={} "
-                 "symbol_notification_max_latency={:.2f}us symbol_notification_avg_latency={:.2f}us; ",
+                 "symbol_notification_max_latency={:.2f}us symbol_notification_avg_latency={:.2f}us "
+                 "wakeup_jitter_min={:.2f}us wakeup_jitter_max={:.2f}us wakeup_jitter_avg={:.2f}us "
+                 "wakeup_jitter_histogram=[{}]; ",
                  metrics.timing.nof_skipped_symbols,
                  metrics.timing.skipped_symbols_max_burst,
                  metrics.timing.notification_max_latency_us,
-                 metrics.timing.notification_avg_latency_us);
+                 metrics.timing.notification_avg_latency_us,
+                 metrics.timing.wakeup_jitter_min_us,
+                 metrics.timing.wakeup_jitter_max_us,
+                 metrics.timing.wakeup_jitter_avg_us,
+                 fmt::join(metrics.timing.wakeup_jitter_histogram, ", "));
 
   for (const auto& cell_metrics : metrics.sectors) {
     const ofh::received_messages_metrics& rx_ofh_metrics    = cell_metrics.rx_metrics.rx_messages_metrics;
@@ -20,6 +20,9 @@ namespace ofh {
 /// Maximum allowed bit width of compressed IQ data.
 constexpr unsigned MAX_IQ_WIDTH = 16U;
 
+/// Minimum bit width of mu-law compressed IQ data, which carries a sign bit, a 3-bit segment and a mantissa.
+constexpr unsigned MIN_MU_LAW_IQ_WIDTH = 5U;
+
 /// Bit width used by quantization of input complex IQ samples.
 constexpr unsigned Q_BIT_WIDTH = MAX_IQ_WIDTH;
 
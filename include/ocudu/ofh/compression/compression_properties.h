@@ -20,8 +20,9 @@ namespace ofh {
 /// Returns true if the compression parameter is present based on the given compression type.
 constexpr bool is_compression_param_present(compression_type type)
 {
-  return (type == compression_type::BFP) || (type == compression_type::mu_law) ||
-         (type == compression_type::bfp_selective) || (type == compression_type::mod_selective);
+  return (type == compression_type::BFP) || (type == compression_type::block_scaling) ||
+         (type == compression_type::mu_law) || (type == compression_type::bfp_selective) ||
+         (type == compression_type::mod_selective);
 }
 
 /// Returns size of a PRB compressed according to the given compression parameters.
@@ -18,6 +18,7 @@
 #include "ocudu/ofh/ethernet/ethernet_transmitter_config.h"
 #include "ocudu/ofh/ethernet/vlan_ethernet_frame_decoder.h"
 #include <memory>
+#include <utility>
 
 namespace ocudu {
 
@@ -34,6 +35,15 @@ std::unique_ptr<transmitter> create_transmitter(const transmitter_config& config
 std::unique_ptr<receiver>
 create_receiver(const receiver_config& config, task_executor& executor, ocudulog::basic_logger& logger);
 
+/// \brief Creates an Ethernet transmitter and an Ethernet receiver.
+///
+/// When both use the same NIC interface, they share the resources of the interface that cannot be claimed twice, such
+/// as the AF_XDP socket bound to a NIC queue.
+std::pair<std::unique_ptr<transmitter>, std::unique_ptr<receiver>> create_txrx(const transmitter_config& tx_config,
+                                                                               const receiver_config&    rx_config,
+                                                                               task_executor&            rx_executor,
+                                                                               ocudulog::basic_logger&   logger);
+
 /// Creates an Ethernet frame builder with VLAN tag insertion.
 std::unique_ptr<frame_builder> create_vlan_frame_builder(const vlan_frame_params& eth_params);
 
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
 #include <string>
 
 namespace ocudu {
@@ -23,6 +24,10 @@ struct receiver_config {
   bool is_promiscuous_mode_enabled;
   /// If set to true, metrics are enabled in the Ethernet receiver.
   bool are_metrics_enabled = false;
+  /// Socket input/output mode.
+  socket_mode mode = socket_mode::standard;
+  /// Link endpoint, only used by the shared-memory mode.
+  shm_link_endpoint shm_endpoint = shm_link_endpoint::du;
 };
 
 } // namespace ether
@@ -0,0 +1,79 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/expected.h"
+#include <algorithm>
+#include <string>
+
+namespace ocudu {
+namespace ether {
+
+/// \brief Input/output mode of the socket-based Ethernet transmitter and receiver.
+///
+/// standard: one system call per transmitted and received frame.
+/// tpacket: memory-mapped TPACKET rings shared with the kernel. Received frames are handed over one by one without
+/// copies and the transmitted frames are flushed with a single system call per burst.
+/// af_xdp: AF_XDP sockets sharing a UMEM with the kernel, fed by an XDP program attached to the NIC. It reaches packet
+/// rates close to DPDK while the NIC stays under the control of the kernel.
+/// shared_memory: frames are exchanged through rings in POSIX shared memory with a peer process on the same host, such
+/// as the RU emulator. The interface name identifies the link and no NIC is involved.
+enum class socket_mode { standard, tpacket, af_xdp, shared_memory };
+
+/// \brief Endpoint of a shared-memory Ethernet link.
+///
+/// The DU endpoint transmits in the downlink ring and receives from the uplink ring, while the RU endpoint does the
+/// opposite.
+enum class shm_link_endpoint { du, ru };
+
+/// Converts the given socket mode to string.
+inline const char* to_string(socket_mode value)
+{
+  switch (value) {
+    case socket_mode::standard:
+      return "standard";
+    case socket_mode::tpacket:
+      return "tpacket";
+    case socket_mode::af_xdp:
+      return "af_xdp";
+    case socket_mode::shared_memory:
+      return "shm";
+  }
+
+  return "standard";
+}
+
+/// Converts the given string to socket mode.
+inline expected<socket_mode> to_socket_mode(std::string value)
+{
+  std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+
+  if (value == "standard") {
+    return socket_mode::standard;
+  }
+
+  if (value == "tpacket") {
+    return socket_mode::tpacket;
+  }
+
+  if (value == "af_xdp") {
+    return socket_mode::af_xdp;
+  }
+
+  if (value == "shm") {
+    return socket_mode::shared_memory;
+  }
+
+  return make_unexpected(default_error_t());
+}
+
+} // namespace ether
+} // namespace ocudu
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ocudu/ofh/ethernet/ethernet_mac_address.h"
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
 #include "ocudu/support/units.h"
 
 namespace ocudu {
@@ -30,6 +31,10 @@ struct transmitter_config {
   units::bytes mtu_size;
   /// Destination MAC address.
   mac_address mac_dst_address;
+  /// Socket input/output mode, ignored when DPDK is used.
+  socket_mode mode = socket_mode::standard;
+  /// Link endpoint, only used by the shared-memory mode.
+  shm_link_endpoint shm_endpoint = shm_link_endpoint::du;
 };
 
 } // namespace ether
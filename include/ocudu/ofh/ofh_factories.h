@@ -16,7 +16,9 @@
 #include "ocudu/ofh/ofh_uplane_rx_symbol_notifier.h"
 #include "ocudu/ofh/receiver/ofh_sequence_id_checker.h"
 #include "ocudu/ofh/timing/ofh_timing_manager.h"
+#include <chrono>
 #include <memory>
+#include <string>
 
 namespace ocudu {
 class task_executor;
@@ -38,6 +40,14 @@ struct controller_config {
   int gps_Beta;
   /// If set to true, logs late events as warnings, otherwise as info.
   bool enable_log_warnings_for_lates;
+  /// \brief PTP hardware clock device used as timing source, for example \c /dev/ptp0.
+  ///
+  /// When empty, the timing is derived from the system realtime clock.
+  std::string ptp_clock_device;
+  /// Offset between the time of the PTP hardware clock and UTC, which is the TAI-UTC offset for clocks in TAI time.
+  std::chrono::seconds ptp_clock_utc_offset = std::chrono::seconds(37);
+  /// Time before each OTA symbol boundary from which the timing worker polls the clock instead of sleeping.
+  std::chrono::microseconds timing_spin_margin = std::chrono::microseconds(10);
 };
 
 /// Creates an Open Fronthaul timing manager with the given parameters.
@@ -15,6 +15,7 @@
 #include "ocudu/ofh/compression/compression_params.h"
 #include "ocudu/ofh/ethernet/ethernet_mac_address.h"
 #include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
 #include "ocudu/ofh/ethernet/ethernet_transmitter.h"
 #include "ocudu/ofh/ofh_constants.h"
 #include "ocudu/ofh/ofh_uplane_rx_symbol_notifier.h"
@@ -23,6 +24,7 @@
 #include "ocudu/ran/bs_channel_bandwidth.h"
 #include "ocudu/ran/cyclic_prefix.h"
 #include <string>
+#include <vector>
 
 namespace ocudu {
 
@@ -117,8 +119,12 @@ struct sector_configuration {
 
   /// Indicates if DPDK should be used by the underlying implementation.
   bool uses_dpdk;
+  /// Socket input/output mode, used when DPDK is not used.
+  ether::socket_mode socket_mode = ether::socket_mode::standard;
   /// Optional TDD configuration.
   std::optional<tdd_ul_dl_config_common> tdd_config;
+  /// Number of batches in which the frames transmitted in a symbol are spread across the symbol duration.
+  unsigned nof_tx_batches_per_symbol = 1;
 };
 
 /// Open Fronthaul sector dependencies.
@@ -133,6 +139,11 @@ struct sector_dependencies {
   task_executor* txrx_executor = nullptr;
   /// Uplink task executor.
   task_executor* uplink_executor = nullptr;
+  /// \brief Additional uplink task executors.
+  ///
+  /// When not empty, the received messages are steered by eAxC to the uplink executor and these executors, which
+  /// decode them in parallel.
+  std::vector<task_executor*> additional_uplink_executors;
   /// User-Plane received symbol notifier.
   uplane_rx_symbol_notifier* notifier = nullptr;
   /// Optional Ethernet transmitter.
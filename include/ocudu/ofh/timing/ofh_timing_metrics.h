@@ -10,9 +10,20 @@
 
 #pragma once
 
+#include <array>
+
 namespace ocudu {
 namespace ofh {
 
+/// \brief Upper edges, in microseconds, of the bins of the symbol boundary wake-up jitter histogram.
+///
+/// The bin \f$i\f$ counts the wake-ups whose jitter is smaller than the edge \f$i\f$ and greater than or equal to the
+/// edge \f$i-1\f$. An additional last bin counts the wake-ups whose jitter is greater than or equal to the last edge.
+inline constexpr std::array<unsigned, 7> wakeup_jitter_histogram_edges_us = {1, 2, 5, 10, 20, 50, 100};
+
+/// Number of bins of the symbol boundary wake-up jitter histogram.
+inline constexpr unsigned NOF_WAKEUP_JITTER_HISTOGRAM_BINS = wakeup_jitter_histogram_edges_us.size() + 1;
+
 /// Open Fronthaul timing metrics.
 struct timing_metrics {
   /// Number of symbols skipped when the timing worker wakes up late.
@@ -23,6 +34,15 @@ struct timing_metrics {
   float notification_min_latency_us;
   float notification_max_latency_us;
   float notification_avg_latency_us;
+  /// \brief Histogram of the symbol boundary wake-up jitter.
+  ///
+  /// The wake-up jitter is the time elapsed between an OTA symbol boundary and the instant the timing worker detects
+  /// it. The bins are delimited by \ref wakeup_jitter_histogram_edges_us.
+  std::array<unsigned, NOF_WAKEUP_JITTER_HISTOGRAM_BINS> wakeup_jitter_histogram;
+  /// Symbol boundary wake-up jitter statistics.
+  float wakeup_jitter_min_us;
+  float wakeup_jitter_max_us;
+  float wakeup_jitter_avg_us;
 };
 
 } // namespace ofh
@@ -86,6 +86,10 @@ struct transmitter_config {
   bool are_metrics_enabled = false;
   /// If set to true, logs late events as warnings, otherwise as info.
   bool enable_log_warnings_for_lates;
+  /// \brief Number of batches in which the frames transmitted in a symbol are spread across the symbol duration.
+  ///
+  /// One batch disables the transmission pacing and sends the frames of a symbol back to back.
+  unsigned nof_tx_batches_per_symbol = 1;
 };
 
 } // namespace ofh
@@ -49,6 +49,15 @@ struct message_transmitter_metrics {
 
   /// CPU usage in microseconds of the message transmitter processing.
   float cpu_usage_us;
+
+  /// Average number of frames transmitted per symbol, considering only the symbols with frames to transmit.
+  float avg_symbol_burst_size;
+  /// Maximum number of frames transmitted in a symbol.
+  unsigned max_symbol_burst_size;
+  /// Number of paced transmission batches sent within their time slot.
+  unsigned nof_on_time_batches;
+  /// Number of paced transmission batches sent after their time slot.
+  unsigned nof_late_batches;
 };
 
 /// Open Fronthaul transmitter metrics.
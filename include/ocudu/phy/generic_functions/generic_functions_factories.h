@@ -28,7 +28,10 @@ public:
   virtual std::unique_ptr<dft_processor> create(const dft_processor::configuration& config) = 0;
 };
 
-/// \brief Creates a DFT processor factory based on a generic Radix-2 DFT implementation.
+/// \brief Creates a DFT processor factory based on a generic mixed radix DFT implementation.
+///
+/// The DFT sizes that do not factorize in the available radixes are computed with Bluestein's algorithm, so the DFT
+/// processors do not require any run-time planning.
 std::shared_ptr<dft_processor_factory> create_dft_processor_factory_generic();
 
 /// \brief Creates a DFT processor factory based on FFTW library.
@@ -95,6 +98,13 @@ public:
   virtual std::unique_ptr<dft_processor_ci16> create(const dft_processor_ci16::configuration& config) = 0;
 };
 
+/// \brief Creates a factory for generic DFT processors for 16-bit complex integer values.
+///
+/// The DFT processors are available for any processor architecture and for the same sizes as the generic DFT.
+///
+/// \return A DFT processor factory.
+std::shared_ptr<dft_processor_ci16_factory> create_dft_processor_ci16_factory_generic();
+
 /// \brief Creates a factory for DFT processors for 16-bit complex integer values.
 ///
 /// \return A DFT processor factory.
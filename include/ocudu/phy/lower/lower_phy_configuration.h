@@ -24,6 +24,7 @@
 #include "ocudu/ran/n_ta_offset.h"
 #include "ocudu/ran/subcarrier_spacing.h"
 #include "ocudu/support/executors/task_executor.h"
+#include <string>
 
 namespace ocudu {
 
@@ -64,6 +65,13 @@ struct lower_phy_configuration {
   unsigned nof_rx_ports;
   /// Shifts the DFT window by a fraction of the cyclic prefix [0, 1).
   float dft_window_offset;
+  /// \brief DFT implementation used by the OFDM modulators and demodulators.
+  ///
+  /// Use one of these options:
+  /// - \c generic: uses the generic DFT, whose tables are precomputed when the lower PHY is created,
+  /// - \c fftw: uses FFTW, which measures the DFT plans when the lower PHY is created, or
+  /// - \c auto: uses FFTW if it is available, otherwise the generic DFT.
+  std::string dft_type = "generic";
   /// \brief Number of slots the timing handler is notified in advance of the transmission time.
   ///
   /// Sets the maximum allowed processing delay in slots.
@@ -113,7 +113,7 @@ public:
   virtual std::unique_ptr<polar_rate_matcher>   create_rate_matcher()                  = 0;
 };
 
-std::shared_ptr<polar_factory> create_polar_factory_sw();
+std::shared_ptr<polar_factory> create_polar_factory_sw(const std::string& dec_type = "auto");
 
 class short_block_detector_factory
 {
@@ -42,6 +42,23 @@ public:
     unsigned max_iterations = 6;
   };
 
+  /// Maximum number of codeblocks that are decoded jointly by decode_batch().
+  static constexpr unsigned max_batch_size = 8;
+
+  /// Describes a codeblock decoded as part of a batch, see decode_batch().
+  struct batch_entry {
+    /// Reconstructed message of information bits.
+    bit_buffer output = bit_buffer::from_bytes({});
+    /// Log-likelihood ratios of the codeblock to be decoded.
+    span<const log_likelihood_ratio> input;
+    /// Pointer to a CRC calculator for early stopping. Set to \c nullptr for disabling early stopping.
+    crc_calculator* crc = nullptr;
+    /// Number of filler bits in the full codeblock.
+    unsigned nof_filler_bits = 0;
+    /// Decoding result: number of LDPC iterations if the decoding is successful, no value otherwise.
+    std::optional<unsigned> result;
+  };
+
   /// \brief Decodes a codeblock.
   ///
   /// By passing a CRC calculator, the CRC is verified after each iteration allowing, when successful, an early stop of
@@ -62,6 +79,27 @@ public:
   /// CRC) and set all the output bits to one.
   virtual std::optional<unsigned>
   decode(bit_buffer& output, span<const log_likelihood_ratio> input, crc_calculator* crc, const configuration& cfg) = 0;
+
+  /// \brief Decodes a batch of codeblocks.
+  ///
+  /// All the codeblocks in the batch share the base graph, the lifting size and the maximum number of iterations given
+  /// by \c cfg, while the number of filler bits is given by each entry. The decoder may process several codeblocks of
+  /// the batch in parallel and evaluates the early stop conditions of each codeblock independently. Codeblocks with the
+  /// same number of soft bits give the same outcome as decode(), whereas shorter codeblocks may be processed with the
+  /// parity checks of the longest one in the batch.
+  ///
+  /// The default implementation decodes the codeblocks one by one.
+  ///
+  /// \param[in,out] entries Codeblocks to decode. The decoding outputs and results are written in the entries.
+  /// \param[in]     cfg     Decoder configuration.
+  virtual void decode_batch(span<batch_entry> entries, const configuration& cfg)
+  {
+    for (batch_entry& entry : entries) {
+      configuration entry_cfg   = cfg;
+      entry_cfg.nof_filler_bits = entry.nof_filler_bits;
+      entry.result              = decode(entry.output, entry.input, entry.crc, entry_cfg);
+    }
+  }
 };
 
 } // namespace ocudu
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "ocudu/phy/upper/channel_estimation.h"
+#include "ocudu/phy/upper/channel_processors/pucch/pucch_format0_map.h"
 #include "ocudu/phy/upper/channel_processors/pucch/pucch_format1_map.h"
 #include "ocudu/phy/upper/channel_processors/pucch/pucch_uci_message.h"
 #include "ocudu/phy/upper/channel_state_information.h"
@@ -70,6 +71,14 @@ public:
     static_vector<uint8_t, MAX_PORTS> ports;
   };
 
+  /// Collects the UE dedicated parameters of a multiplexed PUCCH Format 0 transmission.
+  struct format0_mux_configuration {
+    /// Number of expected HARQ-ACK bits {0, 1, 2}.
+    unsigned nof_harq_ack;
+    /// Set to \c true if the PUCCH is used for reporting scheduling request.
+    bool sr_opportunity;
+  };
+
   /// Collects PUCCH Format 1 detector parameters.
   struct format1_configuration {
     /// Slot and numerology.
@@ -131,6 +140,22 @@ public:
   virtual std::pair<pucch_uci_message, channel_state_information> detect(const resource_grid_reader&  grid,
                                                                          const format0_configuration& config) = 0;
 
+  /// \brief Detects multiplexed PUCCH Format 0 transmissions.
+  ///
+  /// All multiplexed PUCCH transmissions share the configuration parameters in \c config, except for the initial cyclic
+  /// shift, the number of HARQ-ACK bits and the scheduling request opportunity, which are specified in \c mux_map. The
+  /// received resource elements are correlated only once with each of the cyclic shifts used by the transmissions.
+  /// \param[in]  grid    Input resource grid.
+  /// \param[in]  config  PUCCH Format 0 common configuration parameters.
+  /// \param[in]  mux_map Multiplexed PUCCHs - each initial cyclic shift is mapped to the UE dedicated parameters of the
+  ///                     corresponding PUCCH.
+  /// \return A reference to a map of results - each initial cyclic shift in \c mux_map is mapped to the corresponding
+  ///         detection result.
+  virtual const pucch_format0_map<pucch_detection_result_csi>&
+  detect(const resource_grid_reader&                         grid,
+         const format0_configuration&                        config,
+         const pucch_format0_map<format0_mux_configuration>& mux_map) = 0;
+
   /// \brief Detects multiplexed PUCCH Format 1 transmissions.
   ///
   /// All multiplexed PUCCH transmissions share the configuration parameters in \c config, except for the initial cyclic
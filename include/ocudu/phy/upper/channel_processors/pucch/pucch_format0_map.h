@@ -0,0 +1,26 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/circular_map.h"
+#include "ocudu/ran/pucch/pucch_constants.h"
+
+namespace ocudu {
+
+/// \brief Maps elements of type \c T to the corresponding PUCCH Format 0 initial cyclic shift.
+///
+/// Multiplexed PUCCH Format 0 transmissions sharing the same time and frequency allocation are identified by their
+/// initial cyclic shift. The map is traversed in increasing order of initial cyclic shifts.
+template <typename T>
+using pucch_format0_map =
+    static_circular_map<unsigned, T, pucch_constants::format0_initial_cyclic_shift_range.stop()>;
+
+} // namespace ocudu
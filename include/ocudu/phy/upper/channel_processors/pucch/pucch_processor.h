@@ -12,6 +12,7 @@
 
 #include "ocudu/adt/expected.h"
 #include "ocudu/adt/static_vector.h"
+#include "ocudu/phy/upper/channel_processors/pucch/pucch_format0_map.h"
 #include "ocudu/phy/upper/channel_processors/pucch/pucch_format1_map.h"
 #include "ocudu/phy/upper/channel_processors/pucch/pucch_processor_result.h"
 #include "ocudu/ran/cyclic_prefix.h"
@@ -78,6 +79,91 @@ public:
     static_vector<uint8_t, MAX_PORTS> ports;
   };
 
+  /// Collects common PUCCH Format 0 parameters.
+  struct format0_common_configuration {
+    /// Slot and numerology.
+    slot_point slot;
+    /// Cyclic prefix.
+    cyclic_prefix cp;
+    /// Number of contiguous PRBs allocated to the BWP {1, ..., 275}.
+    unsigned bwp_size_rb;
+    /// BWP start RB index from Point A {0, ..., 274}.
+    unsigned bwp_start_rb;
+    /// \brief PRB index used for the PUCCH transmission within the BWP {0, ..., 274}.
+    ///
+    /// Index of the PRB prior to frequency hopping or for no frequency hopping as per TS38.213 Section 9.2.1.
+    unsigned starting_prb;
+    /// \brief PRB index used for the PUCCH transmission within the BWP after frequency hopping {0, ..., 274}.
+    ///
+    /// Index of the PRB posterior to frequency hopping as per TS38.213 Section 9.2.1, if intra-slot frequency hopping
+    /// is enabled, empty otherwise.
+    std::optional<unsigned> second_hop_prb;
+    /// Index of the first OFDM symbol allocated to the PUCCH {0, ..., 13}.
+    unsigned start_symbol_index;
+    /// Number of OFDM symbols allocated to the PUCCH {1, 2}.
+    unsigned nof_symbols;
+    /// Sequence hopping identifier {0, ..., 1023}.
+    unsigned n_id;
+    /// Port indices used for the PUCCH reception.
+    static_vector<uint8_t, MAX_PORTS> ports;
+
+    /// Default constructor.
+    format0_common_configuration() = default;
+
+    /// Construct the configuration from a complete Format 0 configuration parameters.
+    explicit format0_common_configuration(const format0_configuration& config) :
+      slot(config.slot),
+      cp(config.cp),
+      bwp_size_rb(config.bwp_size_rb),
+      bwp_start_rb(config.bwp_start_rb),
+      starting_prb(config.starting_prb),
+      second_hop_prb(config.second_hop_prb),
+      start_symbol_index(config.start_symbol_index),
+      nof_symbols(config.nof_symbols),
+      n_id(config.n_id),
+      ports(config.ports)
+    {
+    }
+
+    /// Determines whether the Format 0 common configuration is equal to another.
+    bool operator==(const format0_common_configuration& other) const
+    {
+      return (other.slot == slot) && (cp == other.cp) && (other.bwp_size_rb == bwp_size_rb) &&
+             (other.bwp_start_rb == bwp_start_rb) && (starting_prb == other.starting_prb) &&
+             (second_hop_prb == other.second_hop_prb) && (start_symbol_index == other.start_symbol_index) &&
+             (nof_symbols == other.nof_symbols) && (n_id == other.n_id) && (ports == other.ports);
+    }
+  };
+
+  /// Collects PUCCH Format 0 batch parameters.
+  struct format0_batch_configuration {
+    /// Collects UE dedicated entries.
+    struct ue_dedicated_entry {
+      /// Context information.
+      std::optional<pucch_context> context;
+      /// Number of expected HARQ-ACK bits {0, 1, 2}.
+      uint16_t nof_harq_ack;
+      /// Set to \c true if the PUCCH is used for reporting scheduling request.
+      bool sr_opportunity;
+    };
+
+    /// Default constructor.
+    format0_batch_configuration() = default;
+
+    /// Construct the configuration from a complete Format 0 configuration parameters.
+    explicit format0_batch_configuration(const format0_configuration& config) : common_config(config)
+    {
+      entries.insert(
+          config.initial_cyclic_shift,
+          {.context = config.context, .nof_harq_ack = config.nof_harq_ack, .sr_opportunity = config.sr_opportunity});
+    }
+
+    /// Common configuration.
+    format0_common_configuration common_config;
+    /// UE entry map, indexed by initial cyclic shift.
+    pucch_format0_map<ue_dedicated_entry> entries;
+  };
+
   /// Collects PUCCH Format 1 parameters.
   struct format1_configuration {
     /// Context information.
@@ -392,6 +478,15 @@ public:
   /// \return The PUCCH process result.
   virtual pucch_processor_result process(const resource_grid_reader& grid, const format0_configuration& config) = 0;
 
+  /// \brief Processes a batch of PUCCH Format 0 configurations.
+  ///
+  /// All the transmissions share the time and frequency allocation and are distinguished by their initial cyclic shift.
+  /// \param[in] grid   Resource grid.
+  /// \param[in] config PUCCH Format 0 batch configuration.
+  /// \return A map the PUCCH Format 0 detection results.
+  virtual pucch_format0_map<pucch_processor_result> process(const resource_grid_reader&        grid,
+                                                            const format0_batch_configuration& config) = 0;
+
   /// \brief Processes a batch of PUCCH Format 1 configurations.
   /// \param[in] grid   Resource grid.
   /// \param[in] config PUCCH Format 1 batch configuration.
@@ -54,6 +54,7 @@ struct pusch_decoder_factory_sw_configuration {
   task_executor*                               executor                  = nullptr;
   unsigned                                     nof_prb;
   unsigned                                     nof_layers;
+  unsigned                                     max_codeblock_batch_size = 1;
 };
 
 std::shared_ptr<pusch_decoder_factory> create_pusch_decoder_factory_sw(pusch_decoder_factory_sw_configuration config);
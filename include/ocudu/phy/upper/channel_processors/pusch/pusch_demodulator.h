@@ -88,6 +88,36 @@ public:
                           const resource_grid_reader&         grid,
                           const dmrs_pusch_estimator_results& est_results,
                           const configuration&                config) = 0;
+
+  /// \brief Starts the demodulation of a PUSCH transmission without processing any OFDM symbol.
+  ///
+  /// The OFDM symbols of the transmission are demodulated by successive calls to demodulate_symbols(), as they become
+  /// available in the resource grid. The parameters are the same as for demodulate(); they must remain valid until the
+  /// last OFDM symbol of the transmission is demodulated.
+  ///
+  /// \param[out] codeword_buffer Codeword buffer.
+  /// \param[in]  notifier        Demodulation statistics notifier.
+  /// \param[in]  grid            Resource grid for the current slot.
+  /// \param[in]  est_results     Interface to access the channel estimates for the REs allocated to the PUSCH
+  ///                             transmission.
+  /// \param[in]  config          Configuration parameters.
+  virtual void start(pusch_codeword_buffer&              codeword_buffer,
+                     pusch_demodulator_notifier&         notifier,
+                     const resource_grid_reader&         grid,
+                     const dmrs_pusch_estimator_results& est_results,
+                     const configuration&                config) = 0;
+
+  /// \brief Demodulates the OFDM symbols of the started transmission up to the given symbol.
+  ///
+  /// Processes, in order, the OFDM symbols of the transmission that have not been demodulated yet and whose index does
+  /// not exceed \c end_symbol_index. The final statistics and the end of the codeword are notified when the last OFDM
+  /// symbol of the transmission is demodulated.
+  ///
+  /// \param[in] end_symbol_index Index of the last OFDM symbol to demodulate, relative to the beginning of the slot.
+  /// \param[in] is_valid         Set to \c false if the OFDM symbols were not received. In that case, their soft bits
+  ///                             are set to zero.
+  /// \remark An assertion is triggered if no transmission was started.
+  virtual void demodulate_symbols(unsigned end_symbol_index, bool is_valid) = 0;
 };
 
 } // namespace ocudu
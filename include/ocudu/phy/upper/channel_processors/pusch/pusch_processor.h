@@ -25,6 +25,7 @@
 namespace ocudu {
 
 class pusch_processor_result_notifier;
+class pusch_rx_symbol_monitor;
 class resource_grid_reader;
 class unique_rx_buffer;
 
@@ -186,6 +187,27 @@ public:
                        pusch_processor_result_notifier& notifier,
                        const resource_grid_reader&      grid,
                        const pdu_t&                     pdu) = 0;
+
+  /// \brief Processes a PUSCH transmission before all its OFDM symbols are received.
+  ///
+  /// Same as the previous method, except that only the OFDM symbols carrying DM-RS must be available in the resource
+  /// grid at the time of the call. The channel estimation starts immediately and the rest of the OFDM symbols are
+  /// demodulated as the symbol monitor reports their reception. Only the decoding is left after the last OFDM symbol of
+  /// the transmission is received.
+  ///
+  /// \param[out]    data           Received transport block.
+  /// \param[in,out] rm_buffer      Rate matcher buffer.
+  /// \param[in]     notifier       Result notification interface.
+  /// \param[in]     grid           Source resource grid.
+  /// \param[in]     symbol_monitor Reception progress of the resource grid OFDM symbols. It must remain valid until the
+  ///                               transmission is processed.
+  /// \param[in]     pdu            Necessary parameters to process the PUSCH transmission.
+  virtual void process(span<uint8_t>                    data,
+                       unique_rx_buffer                 rm_buffer,
+                       pusch_processor_result_notifier& notifier,
+                       const resource_grid_reader&      grid,
+                       pusch_rx_symbol_monitor&         symbol_monitor,
+                       const pdu_t&                     pdu) = 0;
 };
 
 /// \brief Describes the PUSCH processor validator interface.
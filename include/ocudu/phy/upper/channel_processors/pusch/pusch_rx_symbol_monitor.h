@@ -0,0 +1,58 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+namespace ocudu {
+
+/// PUSCH receive symbol listener interface, notified when new OFDM symbols are available in the resource grid.
+class pusch_rx_symbol_listener
+{
+public:
+  /// Default destructor.
+  virtual ~pusch_rx_symbol_listener() = default;
+
+  /// Notifies that new OFDM symbols were received or that the rest of the slot was discarded.
+  virtual void on_new_rx_symbols() = 0;
+};
+
+/// \brief PUSCH receive symbol monitor interface.
+///
+/// Informs a PUSCH processor about the OFDM symbols of the slot that are available in the resource grid. It allows the
+/// demodulation of a PUSCH transmission to start before the last OFDM symbol of the transmission is received.
+class pusch_rx_symbol_monitor
+{
+public:
+  /// Default destructor.
+  virtual ~pusch_rx_symbol_monitor() = default;
+
+  /// \brief Gets the number of OFDM symbols available in the resource grid.
+  ///
+  /// The OFDM symbols are received in order, the available symbols are the first ones of the slot.
+  virtual unsigned get_nof_rx_symbols() const = 0;
+
+  /// \brief Determines whether the rest of the slot was discarded.
+  ///
+  /// The OFDM symbols of a discarded slot that are not available yet will never be received.
+  virtual bool is_discarded() const = 0;
+
+  /// \brief Requests a notification for the reception of new OFDM symbols.
+  ///
+  /// The listener is notified asynchronously, and only once, when the number of available OFDM symbols becomes larger
+  /// than \c nof_rx_symbols or when the slot is discarded. The request is ignored if that is already the case.
+  ///
+  /// \param[in] nof_rx_symbols Number of OFDM symbols already available to the caller.
+  /// \param[in] listener       Listener to notify.
+  /// \return \c true if the listener will be notified, \c false if new symbols are already available or the slot was
+  ///         discarded.
+  virtual bool request_notification(unsigned nof_rx_symbols, pusch_rx_symbol_listener& listener) = 0;
+};
+
+} // namespace ocudu
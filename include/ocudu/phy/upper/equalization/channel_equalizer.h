@@ -52,6 +52,12 @@ public:
   /// Determines if the dimensions and algorithm are valid.
   virtual bool is_supported(unsigned nof_ports, unsigned nof_layers) = 0;
 
+  /// \brief Determines whether the equalizer rejects spatially correlated interference.
+  ///
+  /// Interference-aware equalizers make use of the interference-plus-noise covariance matrix across the receive ports.
+  /// Therefore, they should be called through the \ref equalize overload that takes the covariance matrix.
+  virtual bool is_interference_aware() const = 0;
+
   /// \brief Equalizes the MIMO channel and combines Tx&ndash;Rx paths.
   ///
   /// For each transmit layer, the contributions of all receive ports are combined with weights obtained from the
@@ -80,6 +86,28 @@ public:
                         const ch_est_list&               ch_estimates,
                         span<const float>                noise_var_estimates,
                         float                            tx_scaling) = 0;
+
+  /// \brief Equalizes the MIMO channel taking into account the spatial correlation of the interference.
+  ///
+  /// Same as the \ref equalize overload above, except that the receive port perturbations are characterized by their
+  /// interference-plus-noise covariance matrix instead of a noise variance per port. Equalizers that do not reject
+  /// interference only consider the diagonal of the covariance matrix.
+  ///
+  /// \param[out] eq_symbols       Equalized modulation symbols.
+  /// \param[out] eq_noise_vars    Post-equalization noise variances.
+  /// \param[in]  ch_symbols       Channel symbols, i.e., complex samples organized by receive port.
+  /// \param[in]  ch_estimates     Channel estimation coefficients, indexed by receive port and transmission layer.
+  /// \param[in]  noise_covariance Interference-plus-noise covariance matrix across receive ports, in row-major order.
+  /// \param[in]  tx_scaling       Transmission gain scaling factor.
+  /// \note The size of \c noise_covariance must be equal to the square of the number of receive ports.
+  /// \warning If the covariance matrix is not Hermitian positive definite, the interference-aware equalizers fall back
+  /// to the equalization using only the diagonal of the matrix.
+  virtual void equalize(span<cf_t>                       eq_symbols,
+                        span<float>                      eq_noise_vars,
+                        const re_buffer_reader<cbf16_t>& ch_symbols,
+                        const ch_est_list&               ch_estimates,
+                        span<const cf_t>                 noise_covariance,
+                        float                            tx_scaling) = 0;
 };
 
 } // namespace ocudu
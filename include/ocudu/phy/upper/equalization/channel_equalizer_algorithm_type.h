@@ -17,7 +17,9 @@ enum class channel_equalizer_algorithm_type {
   /// Zero Forcing.
   zf = 0,
   /// Minimum Mean Square Error.
-  mmse
+  mmse,
+  /// Minimum Mean Square Error with Interference Rejection Combining.
+  mmse_irc
 };
 
 /// Convert channel equalizer algorithm type to string.
@@ -26,6 +28,8 @@ inline const char* to_string(channel_equalizer_algorithm_type type)
   switch (type) {
     case channel_equalizer_algorithm_type::zf:
       return "ZF";
+    case channel_equalizer_algorithm_type::mmse_irc:
+      return "MMSE-IRC";
     case channel_equalizer_algorithm_type::mmse:
     default:
       return "MMSE";
@@ -39,6 +39,7 @@ public:
   /// \param[in]     symbol        Current symbol index within the slot.
   /// \param[in]     pusch_pdus    PUSCH PDUs scheduled in the slot up to the current symbol.
   /// \param[in]     pucch_pdus    PUCCH PDUs scheduled in the slot up to the current symbol.
+  /// \param[in]     pucch_f0_pdus Common parameters of PUCCH Format 0 PDUs scheduled up to the current symbol.
   /// \param[in]     pucch_f1_pdus Common parameters of PUCCH Format 1 PDUs scheduled up to the current symbol.
   /// \param[in]     srs_pdus      SRS PDUs scheduled in the slot up to the current symbol.
   ///
@@ -59,6 +60,7 @@ public:
                                 unsigned                                                  symbol,
                                 span<const uplink_pdu_slot_repository::pusch_pdu>         pusch_pdus,
                                 span<const uplink_pdu_slot_repository::pucch_pdu>         pucch_pdus,
+                                span<const pucch_processor::format0_common_configuration> pucch_f0_pdus,
                                 span<const pucch_processor::format1_common_configuration> pucch_f1_pdus,
                                 span<const uplink_pdu_slot_repository::srs_pdu>           srs_pdus) = 0;
 
@@ -133,6 +133,14 @@ public:
   /// Gets the estimated signal-to-noise ratio (linear scale).
   virtual float get_snr() const = 0;
 
+  /// \brief Gets the noise samples the noise variance is estimated from.
+  ///
+  /// The noise samples are the differences between the DM-RS regenerated from the channel estimates and the received
+  /// ones. They are ordered by frequency hop, CDM group, OFDM symbol and subcarrier. Since the order only depends on
+  /// the estimator configuration, the noise samples of different receive ports can be combined for estimating the
+  /// spatial correlation of the interference.
+  virtual span<const cf_t> get_noise_samples() const = 0;
+
   /// Gets the estimated RSRP for the given transmission layer.
   virtual float get_rsrp(unsigned tx_layer) const = 0;
 
@@ -139,6 +139,14 @@ public:
   /// Returns the estimated noise variance for the given Rx port (dB scale).
   float get_noise_variance_dB(unsigned rx_port) const { return convert_power_to_dB(get_noise_variance(rx_port)); }
 
+  /// \brief Gets the interference-plus-noise covariance matrix across all Rx ports (linear scale).
+  ///
+  /// The off-diagonal elements are estimated from the DM-RS noise samples of each pair of Rx ports, while the diagonal
+  /// contains the noise variances given by \ref get_noise_variance.
+  /// \param[out] covariance Covariance matrix in row-major order. Its size must be the square of the number of Rx
+  ///                        ports.
+  virtual void get_noise_covariance(span<cf_t> covariance) const = 0;
+
   /// Returns the estimated RSRP for the path between the given Rx port and Tx layer (linear scale).
   virtual float get_rsrp(unsigned rx_port, unsigned tx_layer = 0) const = 0;
 
@@ -41,6 +41,11 @@ struct uplink_processor_config {
   unsigned nof_rb;
   /// PUSCH allocation maximum number of layers.
   unsigned max_nof_layers;
+  /// \brief Set to true for processing PUSCH transmissions before the end of their allocation.
+  ///
+  /// The PUSCH processing starts when its last DM-RS symbol is received, and the data symbols are demodulated as they
+  /// are received.
+  bool enable_pusch_pipelining = false;
 };
 
 /// Uplink processor factory.
@@ -235,6 +240,8 @@ struct upper_phy_configuration {
   unsigned ul_bw_rb;
   /// Maximum number of layers for PUSCH transmissions.
   unsigned pusch_max_nof_layers;
+  /// Set to true for starting the PUSCH processing before the last OFDM symbol of the transmission is received.
+  bool enable_pusch_pipelining = false;
   /// List of active subcarrier spacing, indexed by numerology.
   std::array<bool, to_numerology_value(subcarrier_spacing::invalid)> active_scs;
   /// Receive buffer pool configuration.
@@ -343,8 +350,9 @@ struct upper_phy_factory_configuration {
   /// \brief PUSCH channel equalizer algorithm.
   ///
   /// Use one of these options:
-  /// - \c zf: use zero-forcing algorithm, or
-  /// - \c mmse: use minimum mean square error algorithm.
+  /// - \c zf: use zero-forcing algorithm,
+  /// - \c mmse: use minimum mean square error algorithm, or
+  /// - \c mmse_irc: use minimum mean square error algorithm with interference rejection combining.
   std::string pusch_channel_equalizer_algorithm;
   /// Number of LDPC decoder iterations.
   unsigned ldpc_decoder_iterations;
@@ -352,6 +360,10 @@ struct upper_phy_factory_configuration {
   bool ldpc_decoder_early_stop;
   /// Set to true for forcing the LDPC decoder to decode even if the number of soft bits is insufficient.
   bool ldpc_decoder_force_decoding;
+  /// \brief Maximum number of PUSCH codeblocks decoded jointly by the LDPC decoder.
+  ///
+  /// Codeblocks of concurrent PUSCH transmissions are batched only when it is greater than one.
+  unsigned pusch_max_codeblock_batch_size = 1;
   /// Number of receive antenna ports.
   unsigned nof_rx_ports;
   /// Number of RBs for uplink.
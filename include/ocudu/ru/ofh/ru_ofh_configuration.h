@@ -12,6 +12,8 @@
 
 #include "ocudu/ocudulog/logger.h"
 #include "ocudu/ofh/ofh_sector_config.h"
+#include <chrono>
+#include <string>
 
 namespace ocudu {
 
@@ -28,6 +30,12 @@ struct ru_ofh_configuration {
   unsigned gps_Alpha;
   /// GPS Beta - Valid value range: [-32768, 32767].
   int gps_Beta;
+  /// PTP hardware clock device used as timing source. When empty, the system realtime clock is used.
+  std::string ptp_clock_device;
+  /// Offset between the time of the PTP hardware clock and UTC.
+  std::chrono::seconds ptp_clock_utc_offset = std::chrono::seconds(37);
+  /// Time before each OTA symbol boundary from which the timing worker polls the clock instead of sleeping.
+  std::chrono::microseconds timing_spin_margin = std::chrono::microseconds(10);
 };
 
 /// Radio Unit dependencies for the Open Fronthaul implementation.
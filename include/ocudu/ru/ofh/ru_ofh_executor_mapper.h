@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "ocudu/adt/span.h"
+
 namespace ocudu {
 
 class task_executor;
@@ -29,6 +31,11 @@ public:
 
   /// Retrieves Open Fronthaul sector uplink processing executor.
   virtual task_executor& uplink_executor() = 0;
+
+  /// \brief Retrieves Open Fronthaul sector additional uplink processing executors.
+  ///
+  /// The received messages are decoded in parallel in the uplink executor and these executors.
+  virtual span<task_executor* const> additional_uplink_executors() = 0;
 };
 
 /// \brief Open Fronthaul RU executor mapper interface.
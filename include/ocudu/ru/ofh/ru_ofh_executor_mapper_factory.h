@@ -26,6 +26,10 @@ struct ru_ofh_executor_mapper_config {
   task_executor* downlink_executor;
   /// Executor dedicated to IQ sample decompression and OFH message deserialization.
   task_executor* uplink_executor;
+  /// \brief Number of uplink executors per sector.
+  ///
+  /// Each sector decodes the received messages in parallel in this number of strands of the uplink executor.
+  unsigned nof_uplink_executors_per_sector = 1;
   /// Set of executors dedicated to Ethernet messages reception and transmission for all configured sectors.
   std::vector<task_executor*> txrx_executors;
   /// A single timing executor for all sectors.
@@ -23,6 +23,7 @@
 #include "ocudu/ran/slot_pdu_capacity_constants.h"
 #include "ocudu/ran/srs/srs_configuration.h"
 #include <chrono>
+#include <string>
 #include <variant>
 #include <vector>
 
@@ -259,6 +260,12 @@ struct scheduler_expert_config {
   scheduler_ue_expert_config     ue;
   bool                           log_broadcast_messages       = false;
   bool                           log_high_latency_diagnostics = false;
+  /// \brief Number of dedicated worker threads that schedule the independent DU cell groups concurrently.
+  ///
+  /// If zero, each cell is scheduled in the context of its slot indication.
+  unsigned nof_cell_group_workers = 0;
+  /// Path of the file where the scheduler inputs are recorded for offline replay. Empty if recording is disabled.
+  std::string input_trace_file;
 };
 
 } // namespace ocudu
@@ -170,6 +170,12 @@ struct scheduler_cell_metrics {
   std::chrono::microseconds               max_decision_latency{0};
   slot_point                              max_decision_latency_slot;
   std::array<unsigned, latency_hist_bins> latency_histogram{0};
+  /// \brief Average time taken to schedule all the cells of the cell group of this cell in a slot.
+  ///
+  /// Only measured when the cell groups are scheduled by dedicated workers. Zero otherwise.
+  std::chrono::microseconds average_cell_group_latency{0};
+  /// Maximum time taken to schedule all the cells of the cell group of this cell in a slot.
+  std::chrono::microseconds max_cell_group_latency{0};
   /// Average number of RBs used for PUSCH per slot index in the TDD pattern.
   std::vector<unsigned>             pusch_prbs_used_per_tdd_slot_idx;
   std::vector<unsigned>             pdsch_prbs_used_per_tdd_slot_idx;
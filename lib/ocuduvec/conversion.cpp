@@ -10,10 +10,20 @@
 
 #include "ocudu/ocuduvec/conversion.h"
 #include "ocudu/ocuduvec/simd.h"
+#include <algorithm>
+#include <limits>
 
 using namespace ocudu;
 using namespace ocuduvec;
 
+/// Converts a rounded floating point value to a 16-bit integer, saturating it like the SIMD conversion does.
+static int16_t saturate_to_int16(float value)
+{
+  return static_cast<int16_t>(std::clamp(value,
+                                         static_cast<float>(std::numeric_limits<int16_t>::min()),
+                                         static_cast<float>(std::numeric_limits<int16_t>::max())));
+}
+
 static void convert_fi_simd(const float* x, int16_t* z, float scale, unsigned len)
 {
   unsigned i = 0;
@@ -48,7 +58,7 @@ static void convert_fi_simd(const float* x, int16_t* z, float scale, unsigned le
 #endif /* OCUDU_SIMD_F_SIZE && OCUDU_SIMD_S_SIZE */
 
   for (; i != len; ++i) {
-    z[i] = static_cast<int16_t>(std::round(x[i] * scale));
+    z[i] = saturate_to_int16(std::round(x[i] * scale));
   }
 }
 
@@ -210,7 +220,7 @@ static void convert_bf16_to_int16_simd(int16_t* out, const bf16_t* in, float sca
 #endif // OCUDU_SIMD_F_SIZE && OCUDU_SIMD_S_SIZE
 
   for (; i != len; ++i) {
-    out[i] = static_cast<int16_t>(std::round(to_float(in[i]) * scale));
+    out[i] = saturate_to_int16(std::round(to_float(in[i]) * scale));
   }
 }
 
@@ -94,6 +94,26 @@ static void sc_prod_ccc_simd(const cbf16_t* x, cf_t h, cbf16_t* z, std::size_t l
   }
 }
 
+static void sc_prod_ccc_simd(const cf_t* x, cf_t h, cbf16_t* z, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t b = ocudu_simd_cf_set1(h);
+  for (unsigned i_end = (len / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i != i_end; i += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t a = ocudu_simd_cfi_loadu(x + i);
+
+    simd_cf_t r = ocudu_simd_cf_prod(a, b);
+
+    ocudu_simd_cbf16_storeu(z + i, r);
+  }
+#endif
+
+  for (; i != len; ++i) {
+    z[i] = to_cbf16(x[i] * h);
+  }
+}
+
 static void sc_prod_sss_simd(const int16_t* x, int16_t h, int16_t* z, std::size_t len)
 {
   std::size_t i = 0;
@@ -221,3 +241,9 @@ void ocudu::ocuduvec::sc_prod(span<cbf16_t> z, span<const cf_t> x, float h)
   ocudu_ocuduvec_assert_size(x, z);
   sc_prod_cfc_simd(x.data(), h, z.data(), x.size());
 }
+
+void ocudu::ocuduvec::sc_prod(span<cbf16_t> z, span<const cf_t> x, cf_t h)
+{
+  ocudu_ocuduvec_assert_size(x, z);
+  sc_prod_ccc_simd(x.data(), h, z.data(), x.size());
+}
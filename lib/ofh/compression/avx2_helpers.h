@@ -113,6 +113,41 @@ inline void calculate_max_abs(span<unsigned> max_abs, __m256i rb0_epi16, __m256i
   max_abs[1] = std::max<unsigned>(abs_max_values[1], abs_min_values[1]);
 }
 
+/// \brief Finds maximum magnitude across 16bit IQ samples in each of the two input resource blocks passed in three
+/// AVX2 registers.
+///
+/// Unlike \ref calculate_max_abs, the magnitude of negative samples is not reduced by one. The content of the three
+/// input AVX2 registers is represented in the table below. Here RBx means one unique RE (pair of IQ samples, 32 bits
+/// long) pertaining to a respective RB:
+/// |       |         |         |         |         |
+/// | ----- | ------- | ------- | ------- | ------- |
+/// | \c rb0_epi16:  | RB0 RB0 | RB0 RB0 | RB0 RB0 | RB0 RB0 |
+/// | \c rb01_epi16: | RB0 RB0 | RB0 RB0 | RB1 RB1 | RB1 RB1 |
+/// | \c rb1_epi16:  | RB1 RB1 | RB1 RB1 | RB1 RB1 | RB1 RB1 |
+///
+/// \param[out] max_abs   A span of two maximum magnitudes in the two input RBs.
+/// \param[in] rb0_epi16  AVX2 register storing 16bit IQ pairs of the first RB.
+/// \param[in] rb01_epi16 AVX2 register storing 16bit IQ pairs of the first and second RBs.
+/// \param[in] rb1_epi16  AVX2 register storing 16bit IQ pairs of the second RB.
+inline void
+calculate_max_magnitude(span<unsigned> max_abs, __m256i rb0_epi16, __m256i rb01_epi16, __m256i rb1_epi16)
+{
+  std::array<uint16_t, 2> abs_max_values;
+
+  __m256i abs0_epi16 = _mm256_abs_epi16(rb0_epi16);
+  __m256i abs1_epi16 = _mm256_abs_epi16(rb1_epi16);
+
+  // Reorganize vectors to be able to vertically compare 16bit samples pertaining to the same resource block.
+  __m256i v0_epi16 = _mm256_permute2f128_si256(abs0_epi16, abs1_epi16, 0x20);
+  __m256i v2_epi16 = _mm256_permute2f128_si256(abs0_epi16, abs1_epi16, 0x31);
+  __m256i v1_epi16 = _mm256_abs_epi16(rb01_epi16);
+
+  find_rbs_abs_min_max_values<_mm256_max_epi16, 0>(abs_max_values, v0_epi16, v1_epi16, v2_epi16);
+
+  max_abs[0] = abs_max_values[0];
+  max_abs[1] = abs_max_values[1];
+}
+
 } // namespace mm256
 } // namespace ofh
 } // namespace ocudu
@@ -13,7 +13,7 @@
 
 #pragma once
 
-#include <immintrin.h>
+#include "ocudu/ocuduvec/simd.h"
 
 namespace ocudu {
 namespace ofh {
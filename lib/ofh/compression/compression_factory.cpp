@@ -10,7 +10,9 @@
 
 #include "ocudu/ofh/compression/compression_factory.h"
 #include "iq_compression_bfp_impl.h"
+#include "iq_compression_block_scaling_impl.h"
 #include "iq_compression_death_impl.h"
+#include "iq_compression_mu_law_impl.h"
 #include "iq_compression_none_impl.h"
 #include "iq_compressor_selector.h"
 #include "iq_decompressor_selector.h"
@@ -20,12 +22,18 @@
 #ifdef __x86_64__
 #include "iq_compression_bfp_avx2.h"
 #include "iq_compression_bfp_avx512.h"
+#include "iq_compression_block_scaling_avx2.h"
+#include "iq_compression_block_scaling_avx512.h"
+#include "iq_compression_mu_law_avx2.h"
+#include "iq_compression_mu_law_avx512.h"
 #include "iq_compression_none_avx2.h"
 #include "iq_compression_none_avx512.h"
 #endif
 
 #ifdef __ARM_NEON
 #include "iq_compression_bfp_neon.h"
+#include "iq_compression_block_scaling_neon.h"
+#include "iq_compression_mu_law_neon.h"
 #include "iq_compression_none_neon.h"
 #endif // __ARM_NEON
 
@@ -81,9 +89,45 @@ std::unique_ptr<iq_compressor> ocudu::ofh::create_iq_compressor(compression_type
 #endif // __ARM_NEON
       return std::make_unique<iq_compression_bfp_impl>(logger, iq_scaling);
     case compression_type::block_scaling:
-      return std::make_unique<iq_compression_death_impl>();
+#ifdef __x86_64__
+    {
+      bool supports_avx2   = cpu_supports_feature(cpu_feature::avx2);
+      bool supports_avx512 = cpu_supports_feature(cpu_feature::avx512f) &&
+                             cpu_supports_feature(cpu_feature::avx512vl) && cpu_supports_feature(cpu_feature::avx512bw);
+      if (((impl_type == "avx512") || (impl_type == "auto")) && supports_avx512) {
+        return std::make_unique<iq_compression_block_scaling_avx512>(logger, iq_scaling);
+      }
+      if (((impl_type == "avx2") || (impl_type == "auto")) && supports_avx2) {
+        return std::make_unique<iq_compression_block_scaling_avx2>(logger, iq_scaling);
+      }
+    }
+#endif
+#ifdef __ARM_NEON
+      if ((impl_type == "neon") || (impl_type == "auto")) {
+        return std::make_unique<iq_compression_block_scaling_neon>(logger, iq_scaling);
+      }
+#endif // __ARM_NEON
+      return std::make_unique<iq_compression_block_scaling_impl>(logger, iq_scaling);
     case compression_type::mu_law:
-      return std::make_unique<iq_compression_death_impl>();
+#ifdef __x86_64__
+    {
+      bool supports_avx2   = cpu_supports_feature(cpu_feature::avx2);
+      bool supports_avx512 = cpu_supports_feature(cpu_feature::avx512f) &&
+                             cpu_supports_feature(cpu_feature::avx512vl) && cpu_supports_feature(cpu_feature::avx512bw);
+      if (((impl_type == "avx512") || (impl_type == "auto")) && supports_avx512) {
+        return std::make_unique<iq_compression_mu_law_avx512>(logger, iq_scaling);
+      }
+      if (((impl_type == "avx2") || (impl_type == "auto")) && supports_avx2) {
+        return std::make_unique<iq_compression_mu_law_avx2>(logger, iq_scaling);
+      }
+    }
+#endif
+#ifdef __ARM_NEON
+      if ((impl_type == "neon") || (impl_type == "auto")) {
+        return std::make_unique<iq_compression_mu_law_neon>(logger, iq_scaling);
+      }
+#endif // __ARM_NEON
+      return std::make_unique<iq_compression_mu_law_impl>(logger, iq_scaling);
     case compression_type::modulation:
       return std::make_unique<iq_compression_death_impl>();
     case compression_type::bfp_selective:
@@ -142,9 +186,47 @@ ocudu::ofh::create_iq_decompressor(compression_type type, ocudulog::basic_logger
 #endif // __ARM_NEON
       return std::make_unique<iq_compression_bfp_impl>(logger);
     case compression_type::block_scaling:
-      return std::make_unique<iq_compression_death_impl>();
+#ifdef __x86_64__
+    {
+      bool supports_avx2 = cpu_supports_feature(cpu_feature::avx2);
+      bool supports_avx512 =
+          cpu_supports_feature(cpu_feature::avx512f) && cpu_supports_feature(cpu_feature::avx512vl) &&
+          cpu_supports_feature(cpu_feature::avx512bw) && cpu_supports_feature(cpu_feature::avx512vbmi);
+      if (((impl_type == "avx512") || (impl_type == "auto")) && supports_avx512) {
+        return std::make_unique<iq_compression_block_scaling_avx512>(logger);
+      }
+      if (((impl_type == "avx2") || (impl_type == "auto")) && supports_avx2) {
+        return std::make_unique<iq_compression_block_scaling_avx2>(logger);
+      }
+    }
+#endif
+#ifdef __ARM_NEON
+      if ((impl_type == "neon") || (impl_type == "auto")) {
+        return std::make_unique<iq_compression_block_scaling_neon>(logger);
+      }
+#endif // __ARM_NEON
+      return std::make_unique<iq_compression_block_scaling_impl>(logger);
     case compression_type::mu_law:
-      return std::make_unique<iq_compression_death_impl>();
+#ifdef __x86_64__
+    {
+      bool supports_avx2 = cpu_supports_feature(cpu_feature::avx2);
+      bool supports_avx512 =
+          cpu_supports_feature(cpu_feature::avx512f) && cpu_supports_feature(cpu_feature::avx512vl) &&
+          cpu_supports_feature(cpu_feature::avx512bw) && cpu_supports_feature(cpu_feature::avx512vbmi);
+      if (((impl_type == "avx512") || (impl_type == "auto")) && supports_avx512) {
+        return std::make_unique<iq_compression_mu_law_avx512>(logger);
+      }
+      if (((impl_type == "avx2") || (impl_type == "auto")) && supports_avx2) {
+        return std::make_unique<iq_compression_mu_law_avx2>(logger);
+      }
+    }
+#endif
+#ifdef __ARM_NEON
+      if ((impl_type == "neon") || (impl_type == "auto")) {
+        return std::make_unique<iq_compression_mu_law_neon>(logger);
+      }
+#endif // __ARM_NEON
+      return std::make_unique<iq_compression_mu_law_impl>(logger);
     case compression_type::modulation:
       return std::make_unique<iq_compression_death_impl>();
     case compression_type::bfp_selective:
@@ -0,0 +1,188 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_block_scaling_avx2.h"
+#include "avx2_helpers.h"
+#include "packing_utils_avx2.h"
+#include "quantizer.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+/// \brief Applies the compression gains to the 16bit samples stored in an AVX2 register.
+///
+/// The samples are scaled, rounded to the nearest integer and saturated to the range of the compressed samples.
+///
+/// \param[in] samples_epi16 AVX2 register storing 16bit IQ samples.
+/// \param[in] gain_lo_ps    Gain applied to the samples in the lower 128bit lane.
+/// \param[in] gain_hi_ps    Gain applied to the samples in the upper 128bit lane.
+/// \param[in] min_epi16     Minimum value of the compressed samples.
+/// \param[in] max_epi16     Maximum value of the compressed samples.
+/// \return An AVX2 register storing the compressed samples.
+static __m256i
+scale_samples(__m256i samples_epi16, __m256 gain_lo_ps, __m256 gain_hi_ps, __m256i min_epi16, __m256i max_epi16)
+{
+  // Convert to single precision floating point, scale and round.
+  __m256i lo_epi32 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(samples_epi16));
+  __m256i hi_epi32 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(samples_epi16, 1));
+  lo_epi32         = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(lo_epi32), gain_lo_ps));
+  hi_epi32         = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(hi_epi32), gain_hi_ps));
+
+  // Pack back to 16bit samples with saturation, restoring the original order of the samples.
+  __m256i scaled_epi16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo_epi32, hi_epi32), 0xd8);
+
+  return _mm256_max_epi16(_mm256_min_epi16(scaled_epi16, max_epi16), min_epi16);
+}
+
+void iq_compression_block_scaling_avx2::compress(span<uint8_t>                buffer,
+                                                 span<const cbf16_t>          iq_data,
+                                                 const ru_compression_params& params)
+{
+  // Use generic implementation if AVX2 utils don't support requested bit width.
+  if (!mm256::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // AVX2 register size in a number of 16bit words.
+  static constexpr size_t AVX2_REG_SIZE = 16;
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+  // Performs conversion of input complex float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  // Range of the compressed samples.
+  const __m256i max_epi16 = _mm256_set1_epi16((1 << (params.data_width - 1)) - 1);
+  const __m256i min_epi16 = _mm256_set1_epi16(-(1 << (params.data_width - 1)));
+
+  unsigned sample_idx = 0;
+  unsigned rb         = 0;
+
+  // One AVX2 register stores 8 16-bit IQ pairs. We can process 2 PRBs at a time by using 3 AVX2 registers.
+  for (size_t rb_index_end = (nof_prbs / 2) * 2; rb != rb_index_end; rb += 2) {
+    // Get view over bytes corresponding to two PRBs processed in this iteration.
+    span<uint8_t> comp_prb0_buffer(&buffer[rb * prb_size], prb_size);
+    span<uint8_t> comp_prb1_buffer(&buffer[(rb + 1) * prb_size], prb_size);
+
+    // Load symbols.
+    const auto* start_it   = input_quantized.begin() + sample_idx;
+    __m256i     rb0_epi16  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + 0));
+    __m256i     rb01_epi16 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + AVX2_REG_SIZE));
+    __m256i     rb1_epi16  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + AVX2_REG_SIZE * 2));
+
+    // Find the block scalers of the 2 PRBs.
+    std::array<unsigned, 2> max_abs;
+    mm256::calculate_max_magnitude(max_abs, rb0_epi16, rb01_epi16, rb1_epi16);
+    uint8_t block_scaler_0 = determine_block_scaler(max_abs[0]);
+    uint8_t block_scaler_1 = determine_block_scaler(max_abs[1]);
+
+    __m256 gain_0_ps = _mm256_set1_ps(get_compression_gain(block_scaler_0, params.data_width));
+    __m256 gain_1_ps = _mm256_set1_ps(get_compression_gain(block_scaler_1, params.data_width));
+
+    // Scale the IQ samples.
+    __m256i rb0_sc_epi16  = scale_samples(rb0_epi16, gain_0_ps, gain_0_ps, min_epi16, max_epi16);
+    __m256i rb01_sc_epi16 = scale_samples(rb01_epi16, gain_0_ps, gain_1_ps, min_epi16, max_epi16);
+    __m256i rb1_sc_epi16  = scale_samples(rb1_epi16, gain_1_ps, gain_1_ps, min_epi16, max_epi16);
+
+    // Write compression parameters to the output buffer.
+    std::memcpy(comp_prb0_buffer.data(), &block_scaler_0, sizeof(uint8_t));
+    std::memcpy(comp_prb1_buffer.data(), &block_scaler_1, sizeof(uint8_t));
+
+    comp_prb0_buffer = comp_prb0_buffer.last(comp_prb0_buffer.size() - sizeof(uint8_t));
+    comp_prb1_buffer = comp_prb1_buffer.last(comp_prb1_buffer.size() - sizeof(uint8_t));
+
+    // Pack 2 PRBs using utility function.
+    mm256::pack_prbs_big_endian(
+        comp_prb0_buffer, comp_prb1_buffer, rb0_sc_epi16, rb01_sc_epi16, rb1_sc_epi16, params.data_width);
+
+    sample_idx += (NOF_SAMPLES_PER_PRB * 2);
+  }
+
+  // Use generic implementation for the remaining resource blocks.
+  for (; rb != nof_prbs; ++rb) {
+    // Get view over buffer bytes corresponding to one PRB.
+    span<uint8_t> comp_prb_buffer(&buffer[rb * prb_size], prb_size);
+
+    const auto* start_it = input_quantized.begin() + sample_idx;
+    compress_prb_generic(comp_prb_buffer, {start_it, NOF_SAMPLES_PER_PRB}, params.data_width);
+    sample_idx += NOF_SAMPLES_PER_PRB;
+  }
+}
+
+void iq_compression_block_scaling_avx2::decompress(span<cbf16_t>                iq_data,
+                                                   span<const uint8_t>          compressed_data,
+                                                   const ru_compression_params& params)
+{
+  // Use generic implementation if AVX2 utils don't support requested bit width.
+  if (!mm256::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  const float fixp_gain = (1 << (Q_BIT_WIDTH - 1)) - 1.0f;
+
+  // Determine array size so that AVX2 store operation doesn't write the data out of array bounds.
+  constexpr size_t avx2_size_iqs = 16;
+  constexpr size_t prb_size      = divide_ceil(NOF_SUBCARRIERS_PER_RB * 2, avx2_size_iqs) * avx2_size_iqs;
+
+  alignas(64) std::array<int16_t, MAX_NOF_PRBS * prb_size> unpacked_iq_data;
+  alignas(64) std::array<float, MAX_NOF_SUBCARRIERS * 2>   unpacked_iq_scaling;
+
+  unsigned idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the block scaler.
+    uint8_t block_scaler = comp_prb_buffer[0];
+    float   scaler       = get_decompression_scaling(block_scaler, params.data_width);
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(block_scaler));
+
+    // Unpack resource block.
+    span<int16_t> unpacked_prb_span(&unpacked_iq_data[idx], prb_size);
+    mm256::unpack_prb_big_endian(unpacked_prb_span, comp_prb_buffer, params.data_width);
+
+    // Save scaling factor.
+    std::fill(&unpacked_iq_scaling[idx], &unpacked_iq_scaling[idx] + (NOF_SUBCARRIERS_PER_RB * 2), scaler / fixp_gain);
+
+    idx += (NOF_SUBCARRIERS_PER_RB * 2);
+  }
+  span<int16_t> unpacked_iq_int16_span(unpacked_iq_data.data(), iq_data.size() * 2);
+  span<float>   unpacked_iq_scaling_span(unpacked_iq_scaling.data(), iq_data.size() * 2);
+
+  // Scale unpacked IQ samples using saved block scalers and convert to complex samples.
+  ocuduvec::convert(iq_data, unpacked_iq_int16_span, unpacked_iq_scaling_span);
+}
@@ -0,0 +1,142 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_block_scaling_avx512.h"
+#include "packing_utils_avx512.h"
+#include "quantizer.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+void iq_compression_block_scaling_avx512::compress_prb_avx512(span<uint8_t>  comp_prb_buffer,
+                                                              const int16_t* uncomp_samples,
+                                                              unsigned       data_width)
+{
+  const __mmask32 load_mask = 0x00ffffff;
+
+  // Load from memory and extend the samples to 32 bits.
+  __m512i rb_epi16    = _mm512_maskz_loadu_epi16(load_mask, uncomp_samples);
+  __m512i rb_lo_epi32 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(rb_epi16));
+  __m512i rb_hi_epi32 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(rb_epi16, 1));
+
+  // Determine the block scaler from the maximum absolute value of the resource block.
+  unsigned max_abs =
+      _mm512_reduce_max_epi32(_mm512_max_epi32(_mm512_abs_epi32(rb_lo_epi32), _mm512_abs_epi32(rb_hi_epi32)));
+  uint8_t block_scaler = determine_block_scaler(max_abs);
+
+  // Scale and round the samples.
+  __m512 gain_ps = _mm512_set1_ps(get_compression_gain(block_scaler, data_width));
+  rb_lo_epi32    = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(rb_lo_epi32), gain_ps));
+  rb_hi_epi32    = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(rb_hi_epi32), gain_ps));
+
+  // Narrow back to 16 bits and saturate to the range of the compressed samples.
+  __m512i rb_scaled_epi16 = _mm512_inserti64x4(
+      _mm512_castsi256_si512(_mm512_cvtsepi32_epi16(rb_lo_epi32)), _mm512_cvtsepi32_epi16(rb_hi_epi32), 1);
+  rb_scaled_epi16 = _mm512_min_epi16(rb_scaled_epi16, _mm512_set1_epi16((1 << (data_width - 1)) - 1));
+  rb_scaled_epi16 = _mm512_max_epi16(rb_scaled_epi16, _mm512_set1_epi16(-(1 << (data_width - 1))));
+
+  // Save the block scaler.
+  std::memcpy(comp_prb_buffer.data(), &block_scaler, sizeof(uint8_t));
+
+  // Pack compressed samples.
+  mm512::pack_prb_big_endian(
+      comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(block_scaler)), rb_scaled_epi16, data_width);
+}
+
+void iq_compression_block_scaling_avx512::compress(span<uint8_t>                buffer,
+                                                   span<const cbf16_t>          iq_data,
+                                                   const ru_compression_params& params)
+{
+  // Use generic implementation if AVX512 utils don't support requested bit width.
+  if (!mm512::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  for (unsigned rb = 0, sample_idx = 0; rb != nof_prbs; ++rb, sample_idx += NOF_SAMPLES_PER_PRB) {
+    span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
+    compress_prb_avx512(output_span, &input_quantized[sample_idx], params.data_width);
+  }
+}
+
+void iq_compression_block_scaling_avx512::decompress(span<cbf16_t>                iq_data,
+                                                     span<const uint8_t>          compressed_data,
+                                                     const ru_compression_params& params)
+{
+  // Use generic implementation if AVX512 utils don't support requested bit width.
+  if (!mm512::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  const float fixp_gain = (1 << (Q_BIT_WIDTH - 1)) - 1.0f;
+
+  // Determine array size so that AVX512 store operation doesn't write the data out of array bounds.
+  constexpr size_t avx512_size_iqs = 32;
+  constexpr size_t prb_size        = divide_ceil(NOF_SUBCARRIERS_PER_RB * 2, avx512_size_iqs) * avx512_size_iqs;
+
+  alignas(64) std::array<int16_t, MAX_NOF_PRBS * prb_size> unpacked_iq_data;
+  alignas(64) std::array<float, MAX_NOF_SUBCARRIERS * 2>   unpacked_iq_scaling;
+
+  unsigned idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the block scaler.
+    uint8_t block_scaler = comp_prb_buffer[0];
+    float   scaler       = get_decompression_scaling(block_scaler, params.data_width);
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(block_scaler));
+
+    // Unpack resource block.
+    span<int16_t> unpacked_prb_span(&unpacked_iq_data[idx], prb_size);
+    mm512::unpack_prb_big_endian(unpacked_prb_span, comp_prb_buffer, params.data_width);
+
+    // Save scaling factor.
+    std::fill(&unpacked_iq_scaling[idx], &unpacked_iq_scaling[idx] + (NOF_SUBCARRIERS_PER_RB * 2), scaler / fixp_gain);
+
+    idx += (NOF_SUBCARRIERS_PER_RB * 2);
+  }
+  span<int16_t> unpacked_iq_int16_span(unpacked_iq_data.data(), iq_data.size() * 2);
+  span<float>   unpacked_iq_scaling_span(unpacked_iq_scaling.data(), iq_data.size() * 2);
+
+  // Scale unpacked IQ samples using saved block scalers and convert to complex samples.
+  ocuduvec::convert(iq_data, unpacked_iq_int16_span, unpacked_iq_scaling_span);
+}
@@ -0,0 +1,146 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_block_scaling_impl.h"
+#include "packing_utils_generic.h"
+#include "ocudu/ocuduvec/dot_prod.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+void iq_compression_block_scaling_impl::quantize_input(span<int16_t> out, span<const bf16_t> in)
+{
+  ocudu_assert(in.size() == out.size(), "Input and output spans must have the same size");
+
+  // Quantizer object.
+  quantizer q(Q_BIT_WIDTH);
+
+  // Convert input to int16_t representation.
+  q.to_fixed_point(out, in, iq_scaling);
+
+  if (OCUDU_UNLIKELY(logger.debug.enabled() && !out.empty())) {
+    // Calculate and print RMS of quantized samples.
+    float sum_squares = ocuduvec::dot_prod(out, out, 0);
+    float rms         = std::sqrt(sum_squares / out.size());
+    if (std::isnormal(rms)) {
+      logger.debug("Quantized IQ samples RMS value of '{}'", rms);
+    }
+  }
+}
+
+void iq_compression_block_scaling_impl::compress_prb_generic(span<uint8_t>       comp_prb_buffer,
+                                                             span<const int16_t> input_quantized,
+                                                             unsigned            data_width)
+{
+  // Determine maximum absolute value and the block scaler.
+  unsigned max_abs = 0;
+  for (int16_t sample : input_quantized.first(NOF_SAMPLES_PER_PRB)) {
+    max_abs = std::max(max_abs, static_cast<unsigned>(std::abs(sample)));
+  }
+  uint8_t block_scaler = determine_block_scaler(max_abs);
+  float   gain         = get_compression_gain(block_scaler, data_width);
+
+  // Range of the compressed samples.
+  const long max_value = (1L << (data_width - 1)) - 1;
+  const long min_value = -(1L << (data_width - 1));
+
+  // Auxiliary arrays to store compressed samples before packing.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB> compressed_samples;
+
+  // Compress data.
+  for (unsigned i = 0; i != NOF_SAMPLES_PER_PRB; ++i) {
+    compressed_samples[i] = std::clamp(std::lrint(input_quantized[i] * gain), min_value, max_value);
+  }
+
+  // Save block scaler.
+  std::memcpy(comp_prb_buffer.data(), &block_scaler, sizeof(block_scaler));
+  comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(block_scaler));
+
+  bit_buffer buffer = bit_buffer::from_bytes(comp_prb_buffer);
+  pack_bytes(buffer, compressed_samples, data_width);
+}
+
+void iq_compression_block_scaling_impl::compress(span<uint8_t>                buffer,
+                                                 span<const cbf16_t>          iq_data,
+                                                 const ru_compression_params& params)
+{
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  for (unsigned i = 0; i != nof_prbs; ++i) {
+    const auto* in_start_it = input_quantized.begin() + NOF_SAMPLES_PER_PRB * i;
+    auto*       out_it      = &buffer[i * prb_size];
+    // Compress one resource block.
+    compress_prb_generic({out_it, prb_size}, {in_start_it, NOF_SAMPLES_PER_PRB}, params.data_width);
+  }
+}
+
+void iq_compression_block_scaling_impl::decompress_prb_generic(span<cbf16_t>       output,
+                                                               span<const uint8_t> comp_prb,
+                                                               const quantizer&    q_in,
+                                                               unsigned            data_width)
+{
+  const float fixp_gain = (1 << (Q_BIT_WIDTH - 1)) - 1.0f;
+
+  // Compute scaling factor, first byte contains the block scaler.
+  uint8_t block_scaler = comp_prb[0];
+  float   scaling      = get_decompression_scaling(block_scaler, data_width) / fixp_gain;
+
+  comp_prb             = comp_prb.last(comp_prb.size() - sizeof(block_scaler));
+  auto bit_buff_reader = bit_buffer_reader::from_bytes(comp_prb);
+
+  for (unsigned i = 0, read_pos = 0; i != NOF_SUBCARRIERS_PER_RB; ++i) {
+    int16_t re = q_in.sign_extend(unpack_bits(bit_buff_reader, read_pos, data_width));
+    int16_t im = q_in.sign_extend(unpack_bits(bit_buff_reader, read_pos + data_width, data_width));
+    read_pos += (data_width * 2);
+
+    output[i] = {re * scaling, im * scaling};
+  }
+}
+
+void iq_compression_block_scaling_impl::decompress(span<cbf16_t>                iq_data,
+                                                   span<const uint8_t>          compressed_data,
+                                                   const ru_compression_params& params)
+{
+  // Quantizer.
+  quantizer q_in(params.data_width);
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    span<const uint8_t> comp_prb(&compressed_data[c_prb_idx * prb_size], prb_size);
+
+    // Decompress resource block.
+    decompress_prb_generic(
+        iq_data.subspan(c_prb_idx * NOF_SUBCARRIERS_PER_RB, NOF_SUBCARRIERS_PER_RB), comp_prb, q_in, params.data_width);
+  }
+}
@@ -0,0 +1,113 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+#pragma once
+
+#include "quantizer.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/compression/iq_compressor.h"
+#include "ocudu/ofh/compression/iq_decompressor.h"
+#include "ocudu/ran/resource_block.h"
+
+namespace ocudu {
+namespace ofh {
+
+/// \brief Implementation of the block scaling IQ data compression.
+///
+/// Each resource block carries an 8-bit unsigned block scaler in Q1.7 format. A decompressed sample, normalized to one,
+/// is the product of the compressed sample, normalized to one, and the block scaler.
+class iq_compression_block_scaling_impl : public iq_compressor, public iq_decompressor
+{
+public:
+  // Constructor.
+  explicit iq_compression_block_scaling_impl(ocudulog::basic_logger& logger_, float iq_scaling_ = 1.0) :
+    logger(logger_), iq_scaling(iq_scaling_)
+  {
+  }
+
+  // See interface for the documentation.
+  virtual void
+  compress(span<uint8_t> buffer, span<const cbf16_t> iq_data, const ru_compression_params& params) override;
+
+  // See interface for the documentation.
+  virtual void
+  decompress(span<cbf16_t> iq_data, span<const uint8_t> compressed_data, const ru_compression_params& params) override;
+
+protected:
+  /// Number of quantized samples per resource block.
+  static constexpr size_t NOF_SAMPLES_PER_PRB = 2 * NOF_SUBCARRIERS_PER_RB;
+
+  /// Number of fractional bits of the block scaler.
+  static constexpr unsigned BLOCK_SCALER_FRAC_BITS = 7;
+
+  /// \brief Determines the block scaler of a resource block.
+  ///
+  /// The block scaler is the smallest Q1.7 value that is not smaller than the maximum absolute value of the resource
+  /// block samples, normalized to one.
+  ///
+  /// \param[in] max_abs Maximum absolute value of the quantized samples of the resource block.
+  /// \return The block scaler, in the range [1, 128].
+  static uint8_t determine_block_scaler(unsigned max_abs)
+  {
+    static constexpr unsigned scaler_step = 1U << (Q_BIT_WIDTH - 1 - BLOCK_SCALER_FRAC_BITS);
+    return std::max(1U, (max_abs + scaler_step - 1) / scaler_step);
+  }
+
+  /// \brief Gets the gain applied to the quantized samples of a resource block to compress them.
+  ///
+  /// \param[in] block_scaler Block scaler of the resource block.
+  /// \param[in] data_width   Bit width of the compressed samples.
+  /// \return The gain to apply before rounding the samples to \c data_width bits.
+  static float get_compression_gain(uint8_t block_scaler, unsigned data_width)
+  {
+    return static_cast<float>(1U << data_width) /
+           static_cast<float>(block_scaler << (Q_BIT_WIDTH - BLOCK_SCALER_FRAC_BITS));
+  }
+
+  /// \brief Gets the scaling factor that converts the compressed samples of a resource block back to 16-bit samples.
+  ///
+  /// \param[in] block_scaler Block scaler of the resource block.
+  /// \param[in] data_width   Bit width of the compressed samples.
+  /// \return The scaling factor to apply to the compressed samples.
+  static float get_decompression_scaling(uint8_t block_scaler, unsigned data_width)
+  {
+    return static_cast<float>(block_scaler << (Q_BIT_WIDTH - 1 - BLOCK_SCALER_FRAC_BITS)) /
+           static_cast<float>(1U << (data_width - 1));
+  }
+
+  /// \brief Compresses one resource block using the generic implementation of the algorithm.
+  ///
+  /// \param[out] c_prb          Compressed PRB.
+  /// \param[in] input_quantized Span of quantized IQ samples of a resource block to be compressed.
+  /// \param[in] data_width      Bit width of the compressed samples.
+  static void compress_prb_generic(span<uint8_t> c_prb, span<const int16_t> input_quantized, unsigned data_width);
+
+  /// \brief Decompresses one resource block using the generic implementation of the algorithm.
+  ///
+  /// \param[out] output    Span of decompressed complex samples of a resource block (12 samples).
+  /// \param[in] comp_prb   Compressed PRB IQ samples and compression parameter.
+  /// \param[in] q          Quantizer object.
+  /// \param[in] data_width Bit width of the compressed samples.
+  static void
+  decompress_prb_generic(span<cbf16_t> output, span<const uint8_t> comp_prb, const quantizer& q, unsigned data_width);
+
+  /// \brief Quantizes complex brain float samples to 16-bit integers.
+  ///
+  /// \param[out] out Quantized samples.
+  /// \param[in] in   Span of input brain float samples.
+  void quantize_input(span<int16_t> out, span<const bf16_t> in);
+
+private:
+  ocudulog::basic_logger& logger;
+  /// Scaling factor applied to IQ data prior to quantization.
+  const float iq_scaling;
+};
+
+} // namespace ofh
+} // namespace ocudu
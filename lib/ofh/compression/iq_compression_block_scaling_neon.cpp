@@ -0,0 +1,148 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_block_scaling_neon.h"
+#include "packing_utils_neon.h"
+#include "quantizer.h"
+#include "ocudu/ocuduvec/conversion.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+/// \brief Applies the compression gain to the 16-bit samples stored in a NEON register.
+///
+/// The samples are scaled, rounded to the nearest integer and saturated to the range of the compressed samples.
+///
+/// \param[in] samples_s16 NEON register storing 16-bit IQ samples.
+/// \param[in] gain        Compression gain.
+/// \param[in] min_s16     Minimum value of the compressed samples.
+/// \param[in] max_s16     Maximum value of the compressed samples.
+/// \return A NEON register storing the compressed samples.
+static inline int16x8_t scale_samples(int16x8_t samples_s16, float gain, int16x8_t min_s16, int16x8_t max_s16)
+{
+  // Convert to single precision floating point, scale and round.
+  int32x4_t lo_s32 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples_s16))), gain));
+  int32x4_t hi_s32 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_high_s16(samples_s16)), gain));
+
+  // Narrow back to 16-bit samples with saturation.
+  int16x8_t scaled_s16 = vqmovn_high_s32(vqmovn_s32(lo_s32), hi_s32);
+
+  return vmaxq_s16(vminq_s16(scaled_s16, max_s16), min_s16);
+}
+
+void iq_compression_block_scaling_neon::compress(span<uint8_t>                buffer,
+                                                 span<const cbf16_t>          iq_data,
+                                                 const ru_compression_params& params)
+{
+  // Use generic implementation if NEON utils don't support requested bit width.
+  if (!neon::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  // Range of the compressed samples.
+  const int16x8_t max_s16 = vdupq_n_s16((1 << (params.data_width - 1)) - 1);
+  const int16x8_t min_s16 = vdupq_n_s16(-(1 << (params.data_width - 1)));
+
+  // One NEON register can store 8 16-bit samples. A PRB is comprised of 24 16-bit IQ samples, thus we need three NEON
+  // registers to process one PRB.
+  for (unsigned rb = 0, sample_idx = 0; rb != nof_prbs; ++rb, sample_idx += NOF_SAMPLES_PER_PRB) {
+    // Load samples.
+    int16x8x3_t vec_s16x3 = vld1q_s16_x3(&input_quantized[sample_idx]);
+
+    // Determine the block scaler from the maximum absolute value of the resource block.
+    uint16x8_t max_abs_u16 = vmaxq_u16(vmaxq_u16(vreinterpretq_u16_s16(vqabsq_s16(vec_s16x3.val[0])),
+                                                 vreinterpretq_u16_s16(vqabsq_s16(vec_s16x3.val[1]))),
+                                       vreinterpretq_u16_s16(vqabsq_s16(vec_s16x3.val[2])));
+    uint8_t    block_scaler = determine_block_scaler(vmaxvq_u16(max_abs_u16));
+    float      gain         = get_compression_gain(block_scaler, params.data_width);
+
+    // Scale the IQ samples.
+    int16x8x3_t scaled_data;
+    scaled_data.val[0] = scale_samples(vec_s16x3.val[0], gain, min_s16, max_s16);
+    scaled_data.val[1] = scale_samples(vec_s16x3.val[1], gain, min_s16, max_s16);
+    scaled_data.val[2] = scale_samples(vec_s16x3.val[2], gain, min_s16, max_s16);
+
+    // Save the block scaler of the compressed PRB and pack its compressed IQ samples using utility function.
+    span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
+    std::memcpy(output_span.data(), &block_scaler, sizeof(uint8_t));
+    neon::pack_prb_big_endian(output_span.last(output_span.size() - sizeof(uint8_t)), scaled_data, params.data_width);
+  }
+}
+
+void iq_compression_block_scaling_neon::decompress(span<cbf16_t>                iq_data,
+                                                   span<const uint8_t>          compressed_data,
+                                                   const ru_compression_params& params)
+{
+  // Use generic implementation if NEON utils don't support requested bit width.
+  if (!neon::iq_width_packing_supported(params.data_width)) {
+    iq_compression_block_scaling_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  const float fixp_gain = (1 << (Q_BIT_WIDTH - 1)) - 1.0f;
+
+  unsigned out_idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the block scaler.
+    uint8_t block_scaler = comp_prb_buffer[0];
+    float   scaler       = get_decompression_scaling(block_scaler, params.data_width);
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(block_scaler));
+
+    // Determine array size so that NEON store operation doesn't write the data out of array bounds.
+    constexpr size_t neon_size_iqs = 8;
+    constexpr size_t arr_size      = divide_ceil(NOF_SAMPLES_PER_PRB, neon_size_iqs) * neon_size_iqs;
+    alignas(64) std::array<int16_t, arr_size> unpacked_iq_data;
+
+    // Unpack resource block.
+    neon::unpack_prb_big_endian(unpacked_iq_data, comp_prb_buffer, params.data_width);
+
+    span<cbf16_t>       output_span = iq_data.subspan(out_idx, NOF_SUBCARRIERS_PER_RB);
+    span<const int16_t> unpacked_span(unpacked_iq_data.data(), NOF_SUBCARRIERS_PER_RB * 2);
+
+    // Convert to complex samples.
+    ocuduvec::convert(output_span, unpacked_span, fixp_gain / scaler);
+    out_idx += NOF_SUBCARRIERS_PER_RB;
+  }
+}
@@ -0,0 +1,278 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_mu_law_avx2.h"
+#include "avx2_helpers.h"
+#include "packing_utils_avx2.h"
+#include "quantizer.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// \brief Mu-law compander working on eight 32-bit samples stored in an AVX2 register.
+///
+/// The position of the most significant bit of each magnitude is obtained from the exponent of its single precision
+/// floating point representation, which is exact for 16-bit integers.
+class mu_law_compander_avx2
+{
+public:
+  /// \brief Constructor.
+  ///
+  /// \param[in] mantissa_width  Bit width of the mantissa of the compressed samples.
+  /// \param[in] magnitude_shift Number of LSBs discarded from the magnitudes before companding them.
+  /// \param[in] data_width      Bit width of the compressed samples.
+  mu_law_compander_avx2(unsigned mantissa_width, unsigned magnitude_shift, unsigned data_width) :
+    mantissa_width_epi32(_mm_cvtsi32_si128(mantissa_width)),
+    magnitude_shift_epi32(_mm_cvtsi32_si128(magnitude_shift)),
+    segment_bias_epi32(_mm256_set1_epi32(126 + mantissa_width)),
+    mantissa_mask_epi32(_mm256_set1_epi32((1U << mantissa_width) - 1U)),
+    magnitude_mask_epi32(_mm256_set1_epi32((1U << (data_width - 1)) - 1U)),
+    sign_bits_epi32(_mm256_set1_epi32(~0U << (data_width - 1)))
+  {
+  }
+
+  /// \brief Compands 16 quantized samples.
+  ///
+  /// \param[in] samples_epi16 AVX2 register storing 16bit IQ samples.
+  /// \param[in] shift_lo      compShift of the samples in the lower 128bit lane.
+  /// \param[in] shift_hi      compShift of the samples in the upper 128bit lane.
+  /// \return An AVX2 register storing the compressed samples, with the sign bit extended to the 16 bits.
+  __m256i compress(__m256i samples_epi16, unsigned shift_lo, unsigned shift_hi) const
+  {
+    __m256i lo_epi32 = compress_epi32(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(samples_epi16)), shift_lo);
+    __m256i hi_epi32 = compress_epi32(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(samples_epi16, 1)), shift_hi);
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo_epi32, hi_epi32), 0xd8);
+  }
+
+  /// \brief Expands 16 compressed samples.
+  ///
+  /// \param[in] codes_epi16 AVX2 register storing 16 compressed samples, with the sign bit extended to the 16 bits.
+  /// \return An AVX2 register storing the expanded samples, before undoing the compShift.
+  __m256i expand(__m256i codes_epi16) const
+  {
+    __m256i lo_epi32 = expand_epi32(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(codes_epi16)));
+    __m256i hi_epi32 = expand_epi32(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(codes_epi16, 1)));
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo_epi32, hi_epi32), 0xd8);
+  }
+
+private:
+  /// Compands eight 32-bit samples sharing the given compShift.
+  __m256i compress_epi32(__m256i samples_epi32, unsigned comp_shift) const
+  {
+    const __m256i zero_epi32 = _mm256_setzero_si256();
+    const __m256i one_epi32  = _mm256_set1_epi32(1);
+
+    __m256i magnitude_epi32 = _mm256_sll_epi32(_mm256_abs_epi32(samples_epi32), _mm_cvtsi32_si128(comp_shift));
+    magnitude_epi32         = _mm256_srl_epi32(magnitude_epi32, magnitude_shift_epi32);
+
+    // The segment is the number of bits of the magnitude exceeding the mantissa width.
+    __m256i exponent_epi32 = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(magnitude_epi32)), 23);
+    __m256i segment_epi32  = _mm256_max_epi32(_mm256_sub_epi32(exponent_epi32, segment_bias_epi32), zero_epi32);
+
+    // The mantissa keeps the bits following the most significant one.
+    __m256i mantissa_shift_epi32 = _mm256_max_epi32(_mm256_sub_epi32(segment_epi32, one_epi32), zero_epi32);
+    __m256i mantissa_epi32 =
+        _mm256_and_si256(_mm256_srlv_epi32(magnitude_epi32, mantissa_shift_epi32), mantissa_mask_epi32);
+
+    __m256i code_epi32 = _mm256_or_si256(_mm256_sll_epi32(segment_epi32, mantissa_width_epi32), mantissa_epi32);
+
+    // Extend the sign bit of negative samples.
+    __m256i negative_epi32 = _mm256_srai_epi32(samples_epi32, 31);
+    return _mm256_or_si256(code_epi32, _mm256_and_si256(negative_epi32, sign_bits_epi32));
+  }
+
+  /// Expands eight 32-bit compressed samples.
+  __m256i expand_epi32(__m256i codes_epi32) const
+  {
+    const __m256i zero_epi32 = _mm256_setzero_si256();
+    const __m256i one_epi32  = _mm256_set1_epi32(1);
+
+    __m256i magnitude_code_epi32 = _mm256_and_si256(codes_epi32, magnitude_mask_epi32);
+    __m256i segment_epi32        = _mm256_srl_epi32(magnitude_code_epi32, mantissa_width_epi32);
+    __m256i mantissa_epi32       = _mm256_and_si256(magnitude_code_epi32, mantissa_mask_epi32);
+
+    // Restore the implicit leading one of the non-zero segments.
+    __m256i leading_one_epi32 = _mm256_sll_epi32(_mm256_min_epi32(segment_epi32, one_epi32), mantissa_width_epi32);
+    __m256i base_epi32        = _mm256_or_si256(mantissa_epi32, leading_one_epi32);
+
+    // Reconstruct the magnitude in the middle of the interval covered by the compressed sample.
+    __m256i shift_epi32 = _mm256_max_epi32(_mm256_sub_epi32(segment_epi32, one_epi32), zero_epi32);
+    shift_epi32         = _mm256_add_epi32(shift_epi32, _mm256_broadcastd_epi32(magnitude_shift_epi32));
+    __m256i half_epi32  = _mm256_srli_epi32(_mm256_sllv_epi32(one_epi32, shift_epi32), 1);
+    __m256i mag_epi32   = _mm256_add_epi32(_mm256_sllv_epi32(base_epi32, shift_epi32), half_epi32);
+
+    // Apply the sign.
+    __m256i negative_epi32 = _mm256_srai_epi32(codes_epi32, 31);
+    return _mm256_sub_epi32(_mm256_xor_si256(mag_epi32, negative_epi32), negative_epi32);
+  }
+
+  const __m128i mantissa_width_epi32;
+  const __m128i magnitude_shift_epi32;
+  const __m256i segment_bias_epi32;
+  const __m256i mantissa_mask_epi32;
+  const __m256i magnitude_mask_epi32;
+  const __m256i sign_bits_epi32;
+};
+
+} // namespace
+
+void iq_compression_mu_law_avx2::compress(span<uint8_t>                buffer,
+                                          span<const cbf16_t>          iq_data,
+                                          const ru_compression_params& params)
+{
+  // Use generic implementation if AVX2 utils don't support requested bit width.
+  if (!mm256::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // AVX2 register size in a number of 16bit words.
+  static constexpr size_t AVX2_REG_SIZE = 16;
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  mu_law_compander_avx2 compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  unsigned sample_idx = 0;
+  unsigned rb         = 0;
+
+  // One AVX2 register stores 8 16-bit IQ pairs. We can process 2 PRBs at a time by using 3 AVX2 registers.
+  for (size_t rb_index_end = (nof_prbs / 2) * 2; rb != rb_index_end; rb += 2) {
+    // Get view over bytes corresponding to two PRBs processed in this iteration.
+    span<uint8_t> comp_prb0_buffer(&buffer[rb * prb_size], prb_size);
+    span<uint8_t> comp_prb1_buffer(&buffer[(rb + 1) * prb_size], prb_size);
+
+    // Load symbols.
+    const auto* start_it   = input_quantized.begin() + sample_idx;
+    __m256i     rb0_epi16  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + 0));
+    __m256i     rb01_epi16 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + AVX2_REG_SIZE));
+    __m256i     rb1_epi16  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start_it + AVX2_REG_SIZE * 2));
+
+    // Find the compShift of the 2 PRBs.
+    std::array<unsigned, 2> max_abs;
+    mm256::calculate_max_magnitude(max_abs, rb0_epi16, rb01_epi16, rb1_epi16);
+    uint8_t comp_shift_0 = determine_comp_shift(max_abs[0]);
+    uint8_t comp_shift_1 = determine_comp_shift(max_abs[1]);
+
+    // Compand the IQ samples.
+    __m256i rb0_comp_epi16  = compander.compress(rb0_epi16, comp_shift_0, comp_shift_0);
+    __m256i rb01_comp_epi16 = compander.compress(rb01_epi16, comp_shift_0, comp_shift_1);
+    __m256i rb1_comp_epi16  = compander.compress(rb1_epi16, comp_shift_1, comp_shift_1);
+
+    // Write compression parameters to the output buffer.
+    uint8_t comp_param_0 = build_comp_param(comp_shift_0, params.data_width);
+    uint8_t comp_param_1 = build_comp_param(comp_shift_1, params.data_width);
+    std::memcpy(comp_prb0_buffer.data(), &comp_param_0, sizeof(uint8_t));
+    std::memcpy(comp_prb1_buffer.data(), &comp_param_1, sizeof(uint8_t));
+
+    comp_prb0_buffer = comp_prb0_buffer.last(comp_prb0_buffer.size() - sizeof(uint8_t));
+    comp_prb1_buffer = comp_prb1_buffer.last(comp_prb1_buffer.size() - sizeof(uint8_t));
+
+    // Pack 2 PRBs using utility function.
+    mm256::pack_prbs_big_endian(
+        comp_prb0_buffer, comp_prb1_buffer, rb0_comp_epi16, rb01_comp_epi16, rb1_comp_epi16, params.data_width);
+
+    sample_idx += (NOF_SAMPLES_PER_PRB * 2);
+  }
+
+  // Use generic implementation for the remaining resource blocks.
+  for (; rb != nof_prbs; ++rb) {
+    // Get view over buffer bytes corresponding to one PRB.
+    span<uint8_t> comp_prb_buffer(&buffer[rb * prb_size], prb_size);
+
+    const auto* start_it = input_quantized.begin() + sample_idx;
+    compress_prb_generic(comp_prb_buffer, {start_it, NOF_SAMPLES_PER_PRB}, params.data_width);
+    sample_idx += NOF_SAMPLES_PER_PRB;
+  }
+}
+
+void iq_compression_mu_law_avx2::decompress(span<cbf16_t>                iq_data,
+                                            span<const uint8_t>          compressed_data,
+                                            const ru_compression_params& params)
+{
+  // Use generic implementation if AVX2 utils don't support requested bit width.
+  if (!mm256::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  // Determine array size so that AVX2 store operation doesn't write the data out of array bounds.
+  constexpr size_t avx2_size_iqs = 16;
+  constexpr size_t prb_size      = divide_ceil(NOF_SUBCARRIERS_PER_RB * 2, avx2_size_iqs) * avx2_size_iqs;
+
+  alignas(64) std::array<int16_t, MAX_NOF_PRBS * prb_size> unpacked_iq_data;
+  alignas(64) std::array<float, MAX_NOF_SUBCARRIERS * 2>   unpacked_iq_scaling;
+
+  mu_law_compander_avx2 compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  unsigned idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the compression parameter.
+    uint8_t comp_param = comp_prb_buffer[0];
+    float   scaler     = get_decompression_scaling(get_comp_shift(comp_param));
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(comp_param));
+
+    // Unpack resource block.
+    span<int16_t> unpacked_prb_span(&unpacked_iq_data[idx], prb_size);
+    mm256::unpack_prb_big_endian(unpacked_prb_span, comp_prb_buffer, params.data_width);
+
+    // Expand the compressed samples in place, before the padding is overwritten by the next resource block.
+    for (unsigned i = 0; i != prb_size; i += avx2_size_iqs) {
+      auto*   samples_ptr = reinterpret_cast<__m256i*>(&unpacked_prb_span[i]);
+      __m256i codes_epi16 = _mm256_loadu_si256(samples_ptr);
+      _mm256_storeu_si256(samples_ptr, compander.expand(codes_epi16));
+    }
+
+    // Save scaling factor.
+    std::fill(&unpacked_iq_scaling[idx], &unpacked_iq_scaling[idx] + (NOF_SUBCARRIERS_PER_RB * 2), scaler);
+
+    idx += (NOF_SUBCARRIERS_PER_RB * 2);
+  }
+  span<int16_t> unpacked_iq_int16_span(unpacked_iq_data.data(), iq_data.size() * 2);
+  span<float>   unpacked_iq_scaling_span(unpacked_iq_scaling.data(), iq_data.size() * 2);
+
+  // Scale expanded IQ samples using saved compShifts and convert to complex samples.
+  ocuduvec::convert(iq_data, unpacked_iq_int16_span, unpacked_iq_scaling_span);
+}
@@ -0,0 +1,248 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_mu_law_avx512.h"
+#include "packing_utils_avx512.h"
+#include "quantizer.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// \brief Mu-law compander working on the 32 16-bit samples stored in an AVX512 register.
+///
+/// The position of the most significant bit of each magnitude is obtained from the exponent of its single precision
+/// floating point representation, which is exact for 16-bit integers.
+class mu_law_compander_avx512
+{
+public:
+  /// \brief Constructor.
+  ///
+  /// \param[in] mantissa_width  Bit width of the mantissa of the compressed samples.
+  /// \param[in] magnitude_shift Number of LSBs discarded from the magnitudes before companding them.
+  /// \param[in] data_width      Bit width of the compressed samples.
+  mu_law_compander_avx512(unsigned mantissa_width, unsigned magnitude_shift, unsigned data_width) :
+    mantissa_width_epi32(_mm_cvtsi32_si128(mantissa_width)),
+    magnitude_shift_epi32(_mm_cvtsi32_si128(magnitude_shift)),
+    segment_bias_epi32(_mm512_set1_epi32(126 + mantissa_width)),
+    mantissa_mask_epi32(_mm512_set1_epi32((1U << mantissa_width) - 1U)),
+    magnitude_mask_epi32(_mm512_set1_epi32((1U << (data_width - 1)) - 1U)),
+    sign_bits_epi32(_mm512_set1_epi32(~0U << (data_width - 1)))
+  {
+  }
+
+  /// \brief Compands the quantized samples of a resource block.
+  ///
+  /// \param[in] samples_epi16 AVX512 register storing the 16-bit IQ samples of the resource block.
+  /// \param[in] comp_shift    compShift of the resource block.
+  /// \return An AVX512 register storing the compressed samples, with the sign bit extended to the 16 bits.
+  __m512i compress(__m512i samples_epi16, unsigned comp_shift) const
+  {
+    __m512i lo_epi32 = compress_epi32(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(samples_epi16)), comp_shift);
+    __m512i hi_epi32 = compress_epi32(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(samples_epi16, 1)), comp_shift);
+    return _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtsepi32_epi16(lo_epi32)), _mm512_cvtsepi32_epi16(hi_epi32), 1);
+  }
+
+  /// \brief Expands 32 compressed samples.
+  ///
+  /// \param[in] codes_epi16 AVX512 register storing 32 compressed samples, with the sign bit extended to the 16 bits.
+  /// \return An AVX512 register storing the expanded samples, before undoing the compShift.
+  __m512i expand(__m512i codes_epi16) const
+  {
+    __m512i lo_epi32 = expand_epi32(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(codes_epi16)));
+    __m512i hi_epi32 = expand_epi32(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(codes_epi16, 1)));
+    return _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtsepi32_epi16(lo_epi32)), _mm512_cvtsepi32_epi16(hi_epi32), 1);
+  }
+
+private:
+  /// Compands 16 32-bit samples sharing the given compShift.
+  __m512i compress_epi32(__m512i samples_epi32, unsigned comp_shift) const
+  {
+    const __m512i zero_epi32 = _mm512_setzero_si512();
+    const __m512i one_epi32  = _mm512_set1_epi32(1);
+
+    __m512i magnitude_epi32 = _mm512_sll_epi32(_mm512_abs_epi32(samples_epi32), _mm_cvtsi32_si128(comp_shift));
+    magnitude_epi32         = _mm512_srl_epi32(magnitude_epi32, magnitude_shift_epi32);
+
+    // The segment is the number of bits of the magnitude exceeding the mantissa width.
+    __m512i exponent_epi32 = _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(magnitude_epi32)), 23);
+    __m512i segment_epi32  = _mm512_max_epi32(_mm512_sub_epi32(exponent_epi32, segment_bias_epi32), zero_epi32);
+
+    // The mantissa keeps the bits following the most significant one.
+    __m512i mantissa_shift_epi32 = _mm512_max_epi32(_mm512_sub_epi32(segment_epi32, one_epi32), zero_epi32);
+    __m512i mantissa_epi32 =
+        _mm512_and_si512(_mm512_srlv_epi32(magnitude_epi32, mantissa_shift_epi32), mantissa_mask_epi32);
+
+    __m512i code_epi32 = _mm512_or_si512(_mm512_sll_epi32(segment_epi32, mantissa_width_epi32), mantissa_epi32);
+
+    // Extend the sign bit of negative samples.
+    __mmask16 negative = _mm512_cmplt_epi32_mask(samples_epi32, _mm512_setzero_si512());
+    return _mm512_mask_or_epi32(code_epi32, negative, code_epi32, sign_bits_epi32);
+  }
+
+  /// Expands 16 32-bit compressed samples.
+  __m512i expand_epi32(__m512i codes_epi32) const
+  {
+    const __m512i zero_epi32 = _mm512_setzero_si512();
+    const __m512i one_epi32  = _mm512_set1_epi32(1);
+
+    __m512i magnitude_code_epi32 = _mm512_and_si512(codes_epi32, magnitude_mask_epi32);
+    __m512i segment_epi32        = _mm512_srl_epi32(magnitude_code_epi32, mantissa_width_epi32);
+    __m512i mantissa_epi32       = _mm512_and_si512(magnitude_code_epi32, mantissa_mask_epi32);
+
+    // Restore the implicit leading one of the non-zero segments.
+    __m512i leading_one_epi32 = _mm512_sll_epi32(_mm512_min_epi32(segment_epi32, one_epi32), mantissa_width_epi32);
+    __m512i base_epi32        = _mm512_or_si512(mantissa_epi32, leading_one_epi32);
+
+    // Reconstruct the magnitude in the middle of the interval covered by the compressed sample.
+    __m512i shift_epi32 = _mm512_max_epi32(_mm512_sub_epi32(segment_epi32, one_epi32), zero_epi32);
+    shift_epi32         = _mm512_add_epi32(shift_epi32, _mm512_broadcastd_epi32(magnitude_shift_epi32));
+    __m512i half_epi32  = _mm512_srli_epi32(_mm512_sllv_epi32(one_epi32, shift_epi32), 1);
+    __m512i mag_epi32   = _mm512_add_epi32(_mm512_sllv_epi32(base_epi32, shift_epi32), half_epi32);
+
+    // Apply the sign.
+    __mmask16 negative = _mm512_cmplt_epi32_mask(codes_epi32, zero_epi32);
+    return _mm512_mask_sub_epi32(mag_epi32, negative, zero_epi32, mag_epi32);
+  }
+
+  const __m128i mantissa_width_epi32;
+  const __m128i magnitude_shift_epi32;
+  const __m512i segment_bias_epi32;
+  const __m512i mantissa_mask_epi32;
+  const __m512i magnitude_mask_epi32;
+  const __m512i sign_bits_epi32;
+};
+
+} // namespace
+
+void iq_compression_mu_law_avx512::compress(span<uint8_t>                buffer,
+                                            span<const cbf16_t>          iq_data,
+                                            const ru_compression_params& params)
+{
+  // Use generic implementation if AVX512 utils don't support requested bit width.
+  if (!mm512::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  mu_law_compander_avx512 compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  const __mmask32 load_mask = 0x00ffffff;
+
+  for (unsigned rb = 0, sample_idx = 0; rb != nof_prbs; ++rb, sample_idx += NOF_SAMPLES_PER_PRB) {
+    __m512i rb_epi16 = _mm512_maskz_loadu_epi16(load_mask, &input_quantized[sample_idx]);
+
+    // Determine the compShift from the maximum absolute value of the resource block. The maximum is found as the
+    // complement of the minimum of the complemented absolute values.
+    __m512i abs_epu16 = _mm512_abs_epi16(rb_epi16);
+    __m256i max_256_epu16 =
+        _mm256_max_epu16(_mm512_castsi512_si256(abs_epu16), _mm512_extracti64x4_epi64(abs_epu16, 1));
+    __m128i max_128_epu16 =
+        _mm_max_epu16(_mm256_castsi256_si128(max_256_epu16), _mm256_extracti128_si256(max_256_epu16, 1));
+    __m128i  min_pos_epu16 = _mm_minpos_epu16(_mm_xor_si128(max_128_epu16, _mm_set1_epi16(-1)));
+    unsigned max_abs       = 0xffff - _mm_extract_epi16(min_pos_epu16, 0);
+    uint8_t  comp_shift    = determine_comp_shift(max_abs);
+
+    span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
+
+    // Save the compression parameter.
+    uint8_t comp_param = build_comp_param(comp_shift, params.data_width);
+    std::memcpy(output_span.data(), &comp_param, sizeof(uint8_t));
+
+    // Compand and pack a PRB using utility function.
+    mm512::pack_prb_big_endian(output_span.last(output_span.size() - sizeof(uint8_t)),
+                               compander.compress(rb_epi16, comp_shift),
+                               params.data_width);
+  }
+}
+
+void iq_compression_mu_law_avx512::decompress(span<cbf16_t>                iq_data,
+                                              span<const uint8_t>          compressed_data,
+                                              const ru_compression_params& params)
+{
+  // Use generic implementation if AVX512 utils don't support requested bit width.
+  if (!mm512::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  // Determine array size so that AVX512 store operation doesn't write the data out of array bounds.
+  constexpr size_t avx512_size_iqs = 32;
+  constexpr size_t prb_size        = divide_ceil(NOF_SUBCARRIERS_PER_RB * 2, avx512_size_iqs) * avx512_size_iqs;
+
+  alignas(64) std::array<int16_t, MAX_NOF_PRBS * prb_size> unpacked_iq_data;
+  alignas(64) std::array<float, MAX_NOF_SUBCARRIERS * 2>   unpacked_iq_scaling;
+
+  mu_law_compander_avx512 compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  unsigned idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the compression parameter.
+    uint8_t comp_param = comp_prb_buffer[0];
+    float   scaler     = get_decompression_scaling(get_comp_shift(comp_param));
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(comp_param));
+
+    // Unpack resource block.
+    span<int16_t> unpacked_prb_span(&unpacked_iq_data[idx], prb_size);
+    mm512::unpack_prb_big_endian(unpacked_prb_span, comp_prb_buffer, params.data_width);
+
+    // Expand the compressed samples in place, before the padding is overwritten by the next resource block.
+    auto* samples_ptr = reinterpret_cast<__m512i*>(unpacked_prb_span.data());
+    _mm512_storeu_si512(samples_ptr, compander.expand(_mm512_loadu_si512(samples_ptr)));
+
+    // Save scaling factor.
+    std::fill(&unpacked_iq_scaling[idx], &unpacked_iq_scaling[idx] + (NOF_SUBCARRIERS_PER_RB * 2), scaler);
+
+    idx += (NOF_SUBCARRIERS_PER_RB * 2);
+  }
+  span<int16_t> unpacked_iq_int16_span(unpacked_iq_data.data(), iq_data.size() * 2);
+  span<float>   unpacked_iq_scaling_span(unpacked_iq_scaling.data(), iq_data.size() * 2);
+
+  // Scale expanded IQ samples using saved compShifts and convert to complex samples.
+  ocuduvec::convert(iq_data, unpacked_iq_int16_span, unpacked_iq_scaling_span);
+}
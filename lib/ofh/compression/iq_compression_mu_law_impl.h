@@ -0,0 +1,190 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+#pragma once
+
+#include "quantizer.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/compression/iq_compressor.h"
+#include "ocudu/ofh/compression/iq_decompressor.h"
+#include "ocudu/ran/resource_block.h"
+
+namespace ocudu {
+namespace ofh {
+
+/// \brief Implementation of the mu-law IQ data compression.
+///
+/// The samples of a resource block are first amplified by a common left shift, the compShift, so that the largest
+/// magnitude uses all 15 magnitude bits. Then each sample is companded to a sign bit, a 3-bit segment and a mantissa,
+/// where the segment encodes the position of the most significant bit of the magnitude and the mantissa keeps the bits
+/// following it. The compression parameter of each resource block carries the compression bit width in the 4 MSBs and
+/// the compShift in the 4 LSBs.
+class iq_compression_mu_law_impl : public iq_compressor, public iq_decompressor
+{
+public:
+  // Constructor.
+  explicit iq_compression_mu_law_impl(ocudulog::basic_logger& logger_, float iq_scaling_ = 1.0) :
+    logger(logger_), iq_scaling(iq_scaling_)
+  {
+  }
+
+  // See interface for the documentation.
+  virtual void
+  compress(span<uint8_t> buffer, span<const cbf16_t> iq_data, const ru_compression_params& params) override;
+
+  // See interface for the documentation.
+  virtual void
+  decompress(span<cbf16_t> iq_data, span<const uint8_t> compressed_data, const ru_compression_params& params) override;
+
+protected:
+  /// Number of quantized samples per resource block.
+  static constexpr size_t NOF_SAMPLES_PER_PRB = 2 * NOF_SUBCARRIERS_PER_RB;
+
+  /// Bit width of the segment field of a compressed sample.
+  static constexpr unsigned SEGMENT_WIDTH = 3;
+
+  /// Maximum segment value.
+  static constexpr unsigned MAX_SEGMENT = (1U << SEGMENT_WIDTH) - 1;
+
+  /// Bit width of the magnitude of a quantized sample.
+  static constexpr unsigned MAGNITUDE_WIDTH = Q_BIT_WIDTH - 1;
+
+  /// Maximum magnitude of a quantized sample.
+  static constexpr unsigned MAX_MAGNITUDE = (1U << MAGNITUDE_WIDTH) - 1;
+
+  /// Maximum value of the compShift.
+  static constexpr unsigned MAX_COMP_SHIFT = 15;
+
+  /// Minimum supported bit width of the compressed samples.
+  static constexpr unsigned MIN_DATA_WIDTH = MIN_MU_LAW_IQ_WIDTH;
+
+  /// Returns the bit width of the mantissa of the compressed samples.
+  static constexpr unsigned get_mantissa_width(unsigned data_width) { return data_width - 1 - SEGMENT_WIDTH; }
+
+  /// \brief Returns the number of LSBs discarded from the sample magnitudes before companding them.
+  ///
+  /// The segments cover magnitudes of up to <tt>mantissa width + MAX_SEGMENT</tt> bits, the remaining LSBs are
+  /// discarded.
+  static constexpr unsigned get_magnitude_shift(unsigned data_width)
+  {
+    return MAGNITUDE_WIDTH - std::min(MAGNITUDE_WIDTH, get_mantissa_width(data_width) + MAX_SEGMENT);
+  }
+
+  /// \brief Determines the compShift of a resource block.
+  ///
+  /// \param[in] max_abs Maximum absolute value of the quantized samples of the resource block.
+  /// \return The largest left shift that keeps \c max_abs within the magnitude bits of a 16-bit sample.
+  static uint8_t determine_comp_shift(unsigned max_abs)
+  {
+    if (max_abs == 0) {
+      return MAX_COMP_SHIFT;
+    }
+    // A magnitude of 32768 does not fit in the magnitude bits, it is handled as the maximum magnitude.
+    max_abs = std::min(max_abs, MAX_MAGNITUDE);
+    return std::min(MAX_COMP_SHIFT, static_cast<unsigned>(__builtin_clz(max_abs)) - 16U - 1U);
+  }
+
+  /// Builds the compression parameter of a resource block.
+  static uint8_t build_comp_param(uint8_t comp_shift, unsigned data_width)
+  {
+    // Note that a bit width of 16 bits translates to a value of 0.
+    return ((data_width & 0xfU) << 4U) | comp_shift;
+  }
+
+  /// Extracts the compShift from the compression parameter of a resource block.
+  static uint8_t get_comp_shift(uint8_t comp_param) { return comp_param & 0xfU; }
+
+  /// \brief Compands a quantized sample.
+  ///
+  /// \param[in] sample     Quantized sample.
+  /// \param[in] comp_shift compShift of the resource block.
+  /// \param[in] data_width Bit width of the compressed samples.
+  /// \return The compressed sample, with the sign bit extended to the 16 bits.
+  static int16_t compress_sample(int16_t sample, unsigned comp_shift, unsigned data_width)
+  {
+    unsigned mantissa_width = get_mantissa_width(data_width);
+    unsigned abs_sample     = std::min(static_cast<unsigned>(std::abs(sample)), MAX_MAGNITUDE);
+    unsigned magnitude      = (abs_sample << comp_shift) >> get_magnitude_shift(data_width);
+
+    // Segment zero holds the magnitudes that fit in the mantissa, the others carry an implicit leading one.
+    unsigned nof_bits = (magnitude == 0) ? 0 : (32U - __builtin_clz(magnitude));
+    unsigned segment  = (nof_bits > mantissa_width) ? (nof_bits - mantissa_width) : 0;
+    unsigned mantissa = (magnitude >> (segment == 0 ? 0 : segment - 1)) & ((1U << mantissa_width) - 1U);
+    unsigned code     = (segment << mantissa_width) | mantissa;
+
+    if (sample < 0) {
+      code |= ~0U << (data_width - 1);
+    }
+    return static_cast<int16_t>(code);
+  }
+
+  /// \brief Expands a compressed sample.
+  ///
+  /// The magnitude is reconstructed in the middle of the interval covered by the compressed sample.
+  ///
+  /// \param[in] code       Compressed sample, with the sign bit extended to the 16 bits.
+  /// \param[in] data_width Bit width of the compressed samples.
+  /// \return The expanded sample, before undoing the compShift.
+  static int16_t decompress_sample(int16_t code, unsigned data_width)
+  {
+    unsigned mantissa_width = get_mantissa_width(data_width);
+    unsigned magnitude_code = static_cast<uint16_t>(code) & ((1U << (data_width - 1)) - 1U);
+    unsigned segment        = magnitude_code >> mantissa_width;
+    unsigned mantissa       = magnitude_code & ((1U << mantissa_width) - 1U);
+
+    unsigned base      = (segment == 0) ? mantissa : ((1U << mantissa_width) | mantissa);
+    unsigned shift     = (segment == 0 ? 0 : segment - 1) + get_magnitude_shift(data_width);
+    int      magnitude = (base << shift) + ((1U << shift) >> 1U);
+
+    return static_cast<int16_t>((code < 0) ? -magnitude : magnitude);
+  }
+
+  /// \brief Gets the scaling factor that converts the expanded samples of a resource block to floating point.
+  ///
+  /// \param[in] comp_shift compShift of the resource block.
+  /// \return The scaling factor to apply to the expanded samples.
+  static float get_decompression_scaling(uint8_t comp_shift)
+  {
+    const float fixp_gain = (1 << (Q_BIT_WIDTH - 1)) - 1.0f;
+    return 1.0f / (static_cast<float>(1U << comp_shift) * fixp_gain);
+  }
+
+  /// \brief Compresses one resource block using the generic implementation of the algorithm.
+  ///
+  /// \param[out] c_prb          Compressed PRB.
+  /// \param[in] input_quantized Span of quantized IQ samples of a resource block to be compressed.
+  /// \param[in] data_width      Bit width of the compressed samples.
+  static void compress_prb_generic(span<uint8_t> c_prb, span<const int16_t> input_quantized, unsigned data_width);
+
+  /// \brief Decompresses one resource block using the generic implementation of the algorithm.
+  ///
+  /// \param[out] output    Span of decompressed complex samples of a resource block (12 samples).
+  /// \param[in] comp_prb   Compressed PRB IQ samples and compression parameter.
+  /// \param[in] q          Quantizer object.
+  /// \param[in] data_width Bit width of the compressed samples.
+  static void
+  decompress_prb_generic(span<cbf16_t> output, span<const uint8_t> comp_prb, const quantizer& q, unsigned data_width);
+
+  /// \brief Quantizes complex brain float samples to 16-bit integers.
+  ///
+  /// The quantized samples are saturated to the symmetric range of the magnitude bits, i.e. -32768 is quantized as
+  /// -32767, since the SIMD absolute value instructions wrap its magnitude back to -32768.
+  ///
+  /// \param[out] out Quantized samples.
+  /// \param[in] in   Span of input brain float samples.
+  void quantize_input(span<int16_t> out, span<const bf16_t> in);
+
+private:
+  ocudulog::basic_logger& logger;
+  /// Scaling factor applied to IQ data prior to quantization.
+  const float iq_scaling;
+};
+
+} // namespace ofh
+} // namespace ocudu
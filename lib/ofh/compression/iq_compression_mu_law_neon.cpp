@@ -0,0 +1,233 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "iq_compression_mu_law_neon.h"
+#include "packing_utils_neon.h"
+#include "quantizer.h"
+#include "ocudu/ocuduvec/conversion.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/math/math_utils.h"
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// Mu-law compander working on the eight 16-bit samples stored in a NEON register.
+class mu_law_compander_neon
+{
+public:
+  /// \brief Constructor.
+  ///
+  /// \param[in] mantissa_width  Bit width of the mantissa of the compressed samples.
+  /// \param[in] magnitude_shift Number of LSBs discarded from the magnitudes before companding them.
+  /// \param[in] data_width      Bit width of the compressed samples.
+  mu_law_compander_neon(unsigned mantissa_width, unsigned magnitude_shift, unsigned data_width) :
+    mantissa_width_u32(vdupq_n_u32(mantissa_width)),
+    mantissa_width_s32(vdupq_n_s32(mantissa_width)),
+    magnitude_shift_u32(vdupq_n_u32(magnitude_shift)),
+    mantissa_mask_u32(vdupq_n_u32((1U << mantissa_width) - 1U)),
+    magnitude_mask_u32(vdupq_n_u32((1U << (data_width - 1)) - 1U)),
+    sign_bits_u32(vdupq_n_u32(~0U << (data_width - 1)))
+  {
+  }
+
+  /// \brief Compands eight quantized samples.
+  ///
+  /// \param[in] samples_s16 NEON register storing 16-bit IQ samples.
+  /// \param[in] comp_shift  compShift of the resource block.
+  /// \return A NEON register storing the compressed samples, with the sign bit extended to the 16 bits.
+  int16x8_t compress(int16x8_t samples_s16, unsigned comp_shift) const
+  {
+    int32x4_t shift_s32 = vdupq_n_s32(comp_shift);
+    int32x4_t lo_s32    = compress_s32(vmovl_s16(vget_low_s16(samples_s16)), shift_s32);
+    int32x4_t hi_s32    = compress_s32(vmovl_high_s16(samples_s16), shift_s32);
+    return vqmovn_high_s32(vqmovn_s32(lo_s32), hi_s32);
+  }
+
+  /// \brief Expands eight compressed samples.
+  ///
+  /// \param[in] codes_s16 NEON register storing compressed samples, with the sign bit extended to the 16 bits.
+  /// \return A NEON register storing the expanded samples, before undoing the compShift.
+  int16x8_t expand(int16x8_t codes_s16) const
+  {
+    int32x4_t lo_s32 = expand_s32(vmovl_s16(vget_low_s16(codes_s16)));
+    int32x4_t hi_s32 = expand_s32(vmovl_high_s16(codes_s16));
+    return vqmovn_high_s32(vqmovn_s32(lo_s32), hi_s32);
+  }
+
+private:
+  /// Compands four 32-bit samples sharing the given compShift.
+  int32x4_t compress_s32(int32x4_t samples_s32, int32x4_t comp_shift_s32) const
+  {
+    const uint32x4_t one_u32 = vdupq_n_u32(1);
+
+    uint32x4_t magnitude_u32 = vshlq_u32(vreinterpretq_u32_s32(vabsq_s32(samples_s32)), comp_shift_s32);
+    magnitude_u32            = vshlq_u32(magnitude_u32, vnegq_s32(vreinterpretq_s32_u32(magnitude_shift_u32)));
+
+    // The segment is the number of bits of the magnitude exceeding the mantissa width.
+    uint32x4_t nof_bits_u32 = vsubq_u32(vdupq_n_u32(32), vclzq_u32(magnitude_u32));
+    uint32x4_t segment_u32  = vqsubq_u32(nof_bits_u32, mantissa_width_u32);
+
+    // The mantissa keeps the bits following the most significant one.
+    int32x4_t  mantissa_shift_s32 = vnegq_s32(vreinterpretq_s32_u32(vqsubq_u32(segment_u32, one_u32)));
+    uint32x4_t mantissa_u32       = vandq_u32(vshlq_u32(magnitude_u32, mantissa_shift_s32), mantissa_mask_u32);
+
+    uint32x4_t code_u32 = vorrq_u32(vshlq_u32(segment_u32, mantissa_width_s32), mantissa_u32);
+
+    // Extend the sign bit of negative samples.
+    uint32x4_t negative_u32 = vcltzq_s32(samples_s32);
+    return vreinterpretq_s32_u32(vorrq_u32(code_u32, vandq_u32(negative_u32, sign_bits_u32)));
+  }
+
+  /// Expands four 32-bit compressed samples.
+  int32x4_t expand_s32(int32x4_t codes_s32) const
+  {
+    const uint32x4_t one_u32 = vdupq_n_u32(1);
+
+    uint32x4_t magnitude_code_u32 = vandq_u32(vreinterpretq_u32_s32(codes_s32), magnitude_mask_u32);
+    uint32x4_t segment_u32        = vshlq_u32(magnitude_code_u32, vnegq_s32(mantissa_width_s32));
+    uint32x4_t mantissa_u32       = vandq_u32(magnitude_code_u32, mantissa_mask_u32);
+
+    // Restore the implicit leading one of the non-zero segments.
+    uint32x4_t leading_one_u32 = vshlq_u32(vminq_u32(segment_u32, one_u32), mantissa_width_s32);
+    uint32x4_t base_u32        = vorrq_u32(mantissa_u32, leading_one_u32);
+
+    // Reconstruct the magnitude in the middle of the interval covered by the compressed sample.
+    int32x4_t  shift_s32     = vreinterpretq_s32_u32(vaddq_u32(vqsubq_u32(segment_u32, one_u32), magnitude_shift_u32));
+    uint32x4_t half_u32      = vshrq_n_u32(vshlq_u32(one_u32, shift_s32), 1);
+    int32x4_t  magnitude_s32 = vreinterpretq_s32_u32(vaddq_u32(vshlq_u32(base_u32, shift_s32), half_u32));
+
+    // Apply the sign.
+    return vbslq_s32(vcltzq_s32(codes_s32), vnegq_s32(magnitude_s32), magnitude_s32);
+  }
+
+  const uint32x4_t mantissa_width_u32;
+  const int32x4_t  mantissa_width_s32;
+  const uint32x4_t magnitude_shift_u32;
+  const uint32x4_t mantissa_mask_u32;
+  const uint32x4_t magnitude_mask_u32;
+  const uint32x4_t sign_bits_u32;
+};
+
+} // namespace
+
+void iq_compression_mu_law_neon::compress(span<uint8_t>                buffer,
+                                          span<const cbf16_t>          iq_data,
+                                          const ru_compression_params& params)
+{
+  // Use generic implementation if NEON utils don't support requested bit width.
+  if (!neon::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  mu_law_compander_neon compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  // One NEON register can store 8 16-bit samples. A PRB is comprised of 24 16-bit IQ samples, thus we need three NEON
+  // registers to process one PRB.
+  for (unsigned rb = 0, sample_idx = 0; rb != nof_prbs; ++rb, sample_idx += NOF_SAMPLES_PER_PRB) {
+    // Load samples.
+    int16x8x3_t vec_s16x3 = vld1q_s16_x3(&input_quantized[sample_idx]);
+
+    // Determine the compShift from the maximum absolute value of the resource block.
+    int16x8_t max_abs_s16 =
+        vmaxq_s16(vmaxq_s16(vabsq_s16(vec_s16x3.val[0]), vabsq_s16(vec_s16x3.val[1])), vabsq_s16(vec_s16x3.val[2]));
+    uint8_t comp_shift = determine_comp_shift(vmaxvq_s16(max_abs_s16));
+
+    // Compand the IQ samples.
+    int16x8x3_t companded_data;
+    companded_data.val[0] = compander.compress(vec_s16x3.val[0], comp_shift);
+    companded_data.val[1] = compander.compress(vec_s16x3.val[1], comp_shift);
+    companded_data.val[2] = compander.compress(vec_s16x3.val[2], comp_shift);
+
+    // Save the compression parameter of the compressed PRB and pack its compressed IQ samples using utility function.
+    span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
+    uint8_t       comp_param = build_comp_param(comp_shift, params.data_width);
+    std::memcpy(output_span.data(), &comp_param, sizeof(uint8_t));
+    neon::pack_prb_big_endian(
+        output_span.last(output_span.size() - sizeof(uint8_t)), companded_data, params.data_width);
+  }
+}
+
+void iq_compression_mu_law_neon::decompress(span<cbf16_t>                iq_data,
+                                            span<const uint8_t>          compressed_data,
+                                            const ru_compression_params& params)
+{
+  // Use generic implementation if NEON utils don't support requested bit width.
+  if (!neon::iq_width_packing_supported(params.data_width)) {
+    iq_compression_mu_law_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  ocudu_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+               "Input does not contain enough bytes to decompress {} PRBs",
+               nof_prbs);
+
+  mu_law_compander_neon compander(
+      get_mantissa_width(params.data_width), get_magnitude_shift(params.data_width), params.data_width);
+
+  unsigned out_idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the compression parameter.
+    uint8_t comp_param = comp_prb_buffer[0];
+    float   scaler     = get_decompression_scaling(get_comp_shift(comp_param));
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(comp_param));
+
+    // Determine array size so that NEON store operation doesn't write the data out of array bounds.
+    constexpr size_t neon_size_iqs = 8;
+    constexpr size_t arr_size      = divide_ceil(NOF_SAMPLES_PER_PRB, neon_size_iqs) * neon_size_iqs;
+    alignas(64) std::array<int16_t, arr_size> unpacked_iq_data;
+
+    // Unpack resource block.
+    neon::unpack_prb_big_endian(unpacked_iq_data, comp_prb_buffer, params.data_width);
+
+    // Expand the compressed samples in place.
+    for (unsigned i = 0; i != arr_size; i += neon_size_iqs) {
+      vst1q_s16(&unpacked_iq_data[i], compander.expand(vld1q_s16(&unpacked_iq_data[i])));
+    }
+
+    span<cbf16_t>       output_span = iq_data.subspan(out_idx, NOF_SUBCARRIERS_PER_RB);
+    span<const int16_t> unpacked_span(unpacked_iq_data.data(), NOF_SUBCARRIERS_PER_RB * 2);
+
+    // Convert to complex samples, the conversion divides the samples by the given factor.
+    ocuduvec::convert(output_span, unpacked_span, 1.0f / scaler);
+    out_idx += NOF_SUBCARRIERS_PER_RB;
+  }
+}
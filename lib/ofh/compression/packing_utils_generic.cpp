@@ -23,7 +23,7 @@ void ocudu::ofh::pack_bytes(bit_buffer& buffer, span<const int16_t> compressed_i
 
     while (left_to_pack != 0) {
       unsigned nbits  = std::min(NUM_BITS_IN_BYTE, left_to_pack);
-      uint8_t  masked = static_cast<uint8_t>(sample & 0x00ff);
+      uint8_t  masked = static_cast<uint8_t>(sample & mask_lsb_ones<uint16_t>(nbits));
       if (left_to_pack > NUM_BITS_IN_BYTE) {
         masked = sample >> (left_to_pack - NUM_BITS_IN_BYTE);
         sample &= mask_lsb_ones<uint16_t>(left_to_pack - NUM_BITS_IN_BYTE);
@@ -11,7 +11,13 @@
 #include "ocudu/ofh/ethernet/ethernet_factories.h"
 #include "ethernet_frame_builder_impl.h"
 #include "ethernet_receiver_impl.h"
+#include "ethernet_shm_receiver_impl.h"
+#include "ethernet_shm_transmitter_impl.h"
+#include "ethernet_tpacket_receiver_impl.h"
+#include "ethernet_tpacket_transmitter_impl.h"
 #include "ethernet_transmitter_impl.h"
+#include "ethernet_xdp_receiver_impl.h"
+#include "ethernet_xdp_transmitter_impl.h"
 #include "vlan_ethernet_frame_builder_impl.h"
 #include "vlan_ethernet_frame_decoder_impl.h"
 
@@ -21,15 +27,52 @@ using namespace ether;
 std::unique_ptr<transmitter> ocudu::ether::create_transmitter(const transmitter_config& config,
                                                               ocudulog::basic_logger&   logger)
 {
+  if (config.mode == socket_mode::tpacket) {
+    return std::make_unique<tpacket_transmitter_impl>(config, logger);
+  }
+  if (config.mode == socket_mode::af_xdp) {
+    return std::make_unique<xdp_transmitter_impl>(
+        config, std::make_shared<xdp_socket>(config.interface, logger), logger);
+  }
+  if (config.mode == socket_mode::shared_memory) {
+    return std::make_unique<shm_transmitter_impl>(config, logger);
+  }
   return std::make_unique<transmitter_impl>(config, logger);
 }
 
 std::unique_ptr<receiver>
 ocudu::ether::create_receiver(const receiver_config& config, task_executor& executor, ocudulog::basic_logger& logger)
 {
+  if (config.mode == socket_mode::tpacket) {
+    return std::make_unique<tpacket_receiver_impl>(config, executor, logger);
+  }
+  if (config.mode == socket_mode::af_xdp) {
+    return std::make_unique<xdp_receiver_impl>(
+        config, executor, std::make_shared<xdp_socket>(config.interface, logger), logger);
+  }
+  if (config.mode == socket_mode::shared_memory) {
+    return std::make_unique<shm_receiver_impl>(config, executor, logger);
+  }
   return std::make_unique<receiver_impl>(config, executor, logger);
 }
 
+std::pair<std::unique_ptr<transmitter>, std::unique_ptr<receiver>>
+ocudu::ether::create_txrx(const transmitter_config& tx_config,
+                          const receiver_config&    rx_config,
+                          task_executor&            rx_executor,
+                          ocudulog::basic_logger&   logger)
+{
+  // A NIC queue only admits a single AF_XDP socket per UMEM, so the transmitter and the receiver share the socket.
+  if (tx_config.mode == socket_mode::af_xdp && rx_config.mode == socket_mode::af_xdp &&
+      tx_config.interface == rx_config.interface) {
+    auto socket = std::make_shared<xdp_socket>(tx_config.interface, logger);
+    return {std::make_unique<xdp_transmitter_impl>(tx_config, socket, logger),
+            std::make_unique<xdp_receiver_impl>(rx_config, rx_executor, socket, logger)};
+  }
+
+  return {create_transmitter(tx_config, logger), create_receiver(rx_config, rx_executor, logger)};
+}
+
 std::unique_ptr<frame_builder> ocudu::ether::create_vlan_frame_builder(const vlan_frame_params& eth_params)
 {
   return std::make_unique<vlan_frame_builder_impl>(eth_params);
@@ -0,0 +1,148 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_shm_receiver_impl.h"
+#include "ethernet_constants.h"
+#include "ethernet_rx_buffer_impl.h"
+#include "ocudu/instrumentation/traces/ofh_traces.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_notifier.h"
+#include "ocudu/support/error_handling.h"
+#include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/synchronization/sync_event.h"
+#include <cstring>
+#include <thread>
+
+using namespace ocudu;
+using namespace ether;
+
+namespace {
+
+class dummy_frame_notifier : public frame_notifier
+{
+  // See interface for documentation.
+  void on_new_frame(ether::unique_rx_buffer buffer) override {}
+};
+
+} // namespace
+
+/// This dummy object is passed to the constructor of the receiver implementation as a placeholder for the
+/// actual frame notifier, which will be later set up through the \ref start() method.
+static dummy_frame_notifier dummy_notifier;
+
+shm_receiver_impl::shm_receiver_impl(const receiver_config&  config,
+                                     task_executor&          executor_,
+                                     ocudulog::basic_logger& logger_) :
+  logger(logger_),
+  executor(executor_),
+  notifier(&dummy_notifier),
+  ring(config.interface, get_shm_rx_direction(config.shm_endpoint), logger),
+  buffer_pool(BUFFER_SIZE),
+  metrics_collector(config.are_metrics_enabled)
+{
+  logger.info("Opened successfully the shared-memory link '{}' used by the Ethernet receiver", config.interface);
+}
+
+void shm_receiver_impl::start(frame_notifier& notifier_)
+{
+  logger.info("Starting the ethernet frame receiver");
+
+  stop_manager.reset();
+
+  notifier = &notifier_;
+
+  // Frames left in the ring by a previous run of the peer process are outdated.
+  ring.discard_pending();
+
+  sync_event wait_event;
+  if (!executor.defer([this, token = wait_event.get_token()] { receive_loop(); })) {
+    report_error("Unable to start the ethernet frame receiver, segment = '{}'", ring.get_name());
+  }
+
+  // Block waiting for receiver executor to start.
+  wait_event.wait();
+
+  logger.info("Started the ethernet frame receiver with segment = '{}'", ring.get_name());
+}
+
+void shm_receiver_impl::stop()
+{
+  logger.info("Requesting stop of the ethernet frame receiver with segment = '{}'", ring.get_name());
+  stop_manager.stop();
+  logger.info("Stopped the ethernet frame receiver with segment = '{}'", ring.get_name());
+}
+
+void shm_receiver_impl::receive_loop()
+{
+  auto token = stop_manager.get_token();
+  if (OCUDU_UNLIKELY(token.is_stop_requested())) {
+    return;
+  }
+
+  receive();
+
+  // Retry the task deferring when it fails.
+  while (!executor.defer([this, tk = std::move(token)]() { receive_loop(); })) {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+  }
+}
+
+/// Copies the given frame in the given buffer removing its VLAN tag, if present, and returns the copied size.
+static unsigned copy_without_vlan_tag(span<uint8_t> buffer, span<const uint8_t> frame)
+{
+  static constexpr unsigned eth_type_offset = 2 * ETH_ADDR_LEN;
+  if (frame.size() < (ETH_HEADER_SIZE + ETH_VLAN_TAG_SIZE).value() ||
+      frame[eth_type_offset] != (VLAN_TPID >> 8U) || frame[eth_type_offset + 1] != (VLAN_TPID & 0xffU)) {
+    std::memcpy(buffer.data(), frame.data(), frame.size());
+    return frame.size();
+  }
+
+  std::memcpy(buffer.data(), frame.data(), eth_type_offset);
+  span<const uint8_t> payload = frame.last(frame.size() - eth_type_offset - ETH_VLAN_TAG_SIZE.value());
+  std::memcpy(buffer.data() + eth_type_offset, payload.data(), payload.size());
+  return eth_type_offset + payload.size();
+}
+
+void shm_receiver_impl::receive()
+{
+  unsigned nof_frames = ring.get_nof_pending(MAX_BURST_SIZE);
+  if (nof_frames == 0) {
+    return;
+  }
+
+  auto        meas = metrics_collector.create_time_execution_measurer();
+  trace_point tp   = ofh_tracer.now();
+
+  uint64_t nof_bytes = 0;
+  unsigned i_frame   = 0;
+  for (; i_frame != nof_frames; ++i_frame) {
+    auto exp_buffer = buffer_pool.reserve();
+    if (!exp_buffer) {
+      logger.warning("No buffer is available for receiving an Ethernet packet from the segment '{}'",
+                     ring.get_name());
+      break;
+    }
+
+    span<const uint8_t>     frame  = ring.get_pending(i_frame);
+    ethernet_rx_buffer_impl buffer = std::move(*exp_buffer);
+    buffer.resize(copy_without_vlan_tag(buffer.storage(), frame));
+    nof_bytes += frame.size();
+
+    notifier->on_new_frame(unique_rx_buffer(std::move(buffer)));
+  }
+  ring.release(i_frame);
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, i_frame);
+  ofh_tracer << trace_event("ofh_receiver", tp);
+}
+
+receiver_metrics_collector* shm_receiver_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
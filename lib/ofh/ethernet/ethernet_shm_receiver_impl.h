@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_rx_buffer_pool.h"
+#include "ethernet_rx_metrics_collector_impl.h"
+#include "ethernet_shm_ring.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver_config.h"
+#include "ocudu/support/synchronization/stop_event.h"
+
+namespace ocudu {
+
+class task_executor;
+
+namespace ether {
+
+/// \brief Ethernet receiver implementation based on a shared-memory frame ring.
+///
+/// The receiver polls the ring shared with the peer process of the link and copies the frames in the buffers of an
+/// \ref ethernet_rx_buffer_pool, removing the VLAN tag as a NIC with VLAN offloading does, so that the ring slots are
+/// handed back to the producer right away.
+class shm_receiver_impl : public receiver, private receiver_operation_controller
+{
+  /// Maximum number of frames processed in a burst.
+  static constexpr unsigned MAX_BURST_SIZE = 64;
+  /// Size of the receive buffers.
+  static constexpr unsigned BUFFER_SIZE = 9600;
+
+public:
+  shm_receiver_impl(const receiver_config& config, task_executor& executor_, ocudulog::basic_logger& logger_);
+
+  // See interface for documentation.
+  receiver_operation_controller& get_operation_controller() override { return *this; }
+
+  // See interface for documentation.
+  receiver_metrics_collector* get_metrics_collector() override;
+
+private:
+  // See interface for documentation.
+  void start(frame_notifier& notifier_) override;
+
+  // See interface for documentation.
+  void stop() override;
+
+  /// Main receiving loop.
+  void receive_loop();
+
+  /// Receives a burst of frames from the ring.
+  void receive();
+
+  ocudulog::basic_logger&         logger;
+  task_executor&                  executor;
+  frame_notifier*                 notifier;
+  shm_frame_ring                  ring;
+  rt_stop_event_source            stop_manager;
+  ethernet_rx_buffer_pool         buffer_pool;
+  receiver_metrics_collector_impl metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
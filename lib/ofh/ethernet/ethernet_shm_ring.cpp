@@ -0,0 +1,151 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_shm_ring.h"
+#include "ocudu/support/error_handling.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+/// Initialization states of a shared-memory segment.
+static constexpr uint32_t SEGMENT_UNINITIALIZED = 0;
+static constexpr uint32_t SEGMENT_INITIALIZING  = 1;
+static constexpr uint32_t SEGMENT_READY         = 2;
+
+/// Maximum time waited for the peer process to initialize the segment.
+static constexpr std::chrono::seconds SEGMENT_INIT_TIMEOUT{1};
+
+/// Builds the name of the shared-memory segment of the given link and direction.
+static std::string get_segment_name(const std::string& link_name, shm_ring_direction direction)
+{
+  return fmt::format("/ocudu_ofh_{}_{}", link_name, direction == shm_ring_direction::downlink ? "dl" : "ul");
+}
+
+shm_frame_ring::shm_frame_ring(const std::string&      link_name,
+                               shm_ring_direction      direction,
+                               ocudulog::basic_logger& logger_) :
+  logger(logger_), name(get_segment_name(link_name, direction))
+{
+  if (link_name.empty() || link_name.find('/') != std::string::npos) {
+    report_error("Invalid shared-memory Ethernet link name '{}'", link_name);
+  }
+
+  fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0660);
+  if (fd < 0) {
+    report_error("Unable to open the shared-memory segment '{}': {}", name, ::strerror(errno));
+  }
+
+  // Both processes set the same size, so the call is idempotent.
+  segment_size = sizeof(control_block) + sizeof(slot) * NOF_SLOTS;
+  if (::ftruncate(fd, segment_size) < 0) {
+    report_error("Unable to set the size of the shared-memory segment '{}': {}", name, ::strerror(errno));
+  }
+
+  segment = ::mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (segment == MAP_FAILED) {
+    report_error("Unable to map the shared-memory segment '{}': {}", name, ::strerror(errno));
+  }
+
+  control = static_cast<control_block*>(segment);
+  slots   = reinterpret_cast<slot*>(static_cast<uint8_t*>(segment) + sizeof(control_block));
+
+  // The process that finds the segment uninitialized initializes it, the other one waits for it to be ready.
+  uint32_t state = SEGMENT_UNINITIALIZED;
+  if (control->state.compare_exchange_strong(state, SEGMENT_INITIALIZING, std::memory_order_acq_rel)) {
+    control->nof_slots = NOF_SLOTS;
+    control->producer_index.store(0, std::memory_order_relaxed);
+    control->consumer_index.store(0, std::memory_order_relaxed);
+    control->state.store(SEGMENT_READY, std::memory_order_release);
+  } else {
+    auto deadline = std::chrono::steady_clock::now() + SEGMENT_INIT_TIMEOUT;
+    while (control->state.load(std::memory_order_acquire) != SEGMENT_READY) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        report_error("Timed out waiting for the initialization of the shared-memory segment '{}'", name);
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+
+  if (control->nof_slots != NOF_SLOTS) {
+    report_error("The shared-memory segment '{}' has '{}' slots while '{}' slots were expected",
+                 name,
+                 control->nof_slots,
+                 NOF_SLOTS);
+  }
+
+  logger.info("Opened successfully the shared-memory segment '{}' with '{}' slots", name, NOF_SLOTS);
+}
+
+shm_frame_ring::~shm_frame_ring()
+{
+  if (segment != nullptr && segment != MAP_FAILED) {
+    ::munmap(segment, segment_size);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+unsigned shm_frame_ring::push(span<const span<const uint8_t>> frames)
+{
+  uint64_t producer = control->producer_index.load(std::memory_order_relaxed);
+  uint64_t consumer = control->consumer_index.load(std::memory_order_acquire);
+  uint64_t nof_free = NOF_SLOTS - (producer - consumer);
+
+  unsigned nof_written = 0;
+  for (span<const uint8_t> frame : frames) {
+    if (nof_written == nof_free) {
+      break;
+    }
+    if (OCUDU_UNLIKELY(frame.size() > MAX_ETH_FRAME_LENGTH)) {
+      logger.warning("Discarding a frame of '{}' bytes that exceeds the slot size of the shared-memory segment '{}'",
+                     frame.size(),
+                     name);
+      continue;
+    }
+
+    slot& entry  = get_slot(producer + nof_written);
+    entry.length = frame.size();
+    std::memcpy(entry.data, frame.data(), frame.size());
+    ++nof_written;
+  }
+
+  control->producer_index.store(producer + nof_written, std::memory_order_release);
+  return nof_written;
+}
+
+unsigned shm_frame_ring::get_nof_pending(unsigned max_nof_frames) const
+{
+  uint64_t consumer = control->consumer_index.load(std::memory_order_relaxed);
+  uint64_t producer = control->producer_index.load(std::memory_order_acquire);
+
+  return std::min<uint64_t>(producer - consumer, max_nof_frames);
+}
+
+span<const uint8_t> shm_frame_ring::get_pending(unsigned i_frame) const
+{
+  const slot& entry = get_slot(control->consumer_index.load(std::memory_order_relaxed) + i_frame);
+  return {entry.data, std::min<uint32_t>(entry.length, MAX_ETH_FRAME_LENGTH)};
+}
+
+void shm_frame_ring::release(unsigned nof_frames)
+{
+  control->consumer_index.fetch_add(nof_frames, std::memory_order_release);
+}
+
+void shm_frame_ring::discard_pending()
+{
+  control->consumer_index.store(control->producer_index.load(std::memory_order_acquire), std::memory_order_release);
+}
@@ -0,0 +1,116 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/span.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
+#include "ocudu/ofh/ethernet/ethernet_socket_mode.h"
+#include <atomic>
+#include <string>
+
+namespace ocudu {
+namespace ether {
+
+/// Direction of a shared-memory frame ring.
+enum class shm_ring_direction { downlink, uplink };
+
+/// \brief Single producer, single consumer ring of Ethernet frames stored in POSIX shared memory.
+///
+/// Both processes of a link map the same segment, which is created by the first one opening it. The producer writes the
+/// frames in fixed size slots and publishes them with a single store of the producer index, while the consumer releases
+/// the slots with a single store of the consumer index. The segment outlives the processes, so a restarted process
+/// reattaches to the ring of its peer.
+class shm_frame_ring
+{
+  /// Number of slots of the ring. It must be a power of two.
+  static constexpr unsigned NOF_SLOTS = 2048;
+
+  /// Control block placed at the beginning of the segment.
+  struct control_block {
+    /// Initialization state of the segment.
+    alignas(64) std::atomic<uint32_t> state;
+    /// Number of slots of the ring stored in the segment.
+    uint32_t nof_slots;
+    /// Total number of frames written by the producer.
+    alignas(64) std::atomic<uint64_t> producer_index;
+    /// Total number of frames released by the consumer.
+    alignas(64) std::atomic<uint64_t> consumer_index;
+  };
+
+  /// Slot storing one frame.
+  struct slot {
+    uint32_t length;
+    uint8_t  data[MAX_ETH_FRAME_LENGTH];
+  };
+
+  static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared-memory rings require lock-free 64-bit atomics");
+  static_assert((NOF_SLOTS & (NOF_SLOTS - 1)) == 0, "The number of slots must be a power of two");
+
+public:
+  /// Opens the ring of the given link and direction, creating the shared-memory segment if it does not exist.
+  shm_frame_ring(const std::string& link_name, shm_ring_direction direction, ocudulog::basic_logger& logger_);
+
+  /// Unmaps the segment.
+  ~shm_frame_ring();
+
+  shm_frame_ring(const shm_frame_ring&)            = delete;
+  shm_frame_ring& operator=(const shm_frame_ring&) = delete;
+
+  /// Returns the name of the shared-memory segment.
+  const std::string& get_name() const { return name; }
+
+  /// \brief Writes the given frames in the ring and publishes them to the consumer.
+  ///
+  /// The frames that do not fit in the free slots of the ring are discarded.
+  ///
+  /// \return The number of frames written.
+  unsigned push(span<const span<const uint8_t>> frames);
+
+  /// Returns the number of frames available to the consumer, up to the given maximum.
+  unsigned get_nof_pending(unsigned max_nof_frames) const;
+
+  /// Returns the i-th frame available to the consumer.
+  span<const uint8_t> get_pending(unsigned i_frame) const;
+
+  /// Releases the given number of frames available to the consumer, handing the slots back to the producer.
+  void release(unsigned nof_frames);
+
+  /// Discards all the frames available to the consumer.
+  void discard_pending();
+
+private:
+  /// Returns the slot of the given ring index.
+  slot& get_slot(uint64_t index) const { return slots[index & (NOF_SLOTS - 1)]; }
+
+  ocudulog::basic_logger& logger;
+  std::string             name;
+  int                     fd           = -1;
+  void*                   segment      = nullptr;
+  size_t                  segment_size = 0;
+  control_block*          control      = nullptr;
+  slot*                   slots        = nullptr;
+};
+
+/// Returns the direction of the ring a link endpoint transmits in.
+inline shm_ring_direction get_shm_tx_direction(shm_link_endpoint endpoint)
+{
+  return endpoint == shm_link_endpoint::du ? shm_ring_direction::downlink : shm_ring_direction::uplink;
+}
+
+/// Returns the direction of the ring a link endpoint receives from.
+inline shm_ring_direction get_shm_rx_direction(shm_link_endpoint endpoint)
+{
+  return endpoint == shm_link_endpoint::du ? shm_ring_direction::uplink : shm_ring_direction::downlink;
+}
+
+} // namespace ether
+} // namespace ocudu
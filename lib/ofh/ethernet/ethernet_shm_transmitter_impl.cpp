@@ -0,0 +1,46 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_shm_transmitter_impl.h"
+
+using namespace ocudu;
+using namespace ether;
+
+shm_transmitter_impl::shm_transmitter_impl(const transmitter_config& config, ocudulog::basic_logger& logger_) :
+  logger(logger_),
+  ring(config.interface, get_shm_tx_direction(config.shm_endpoint), logger),
+  metrics_collector(config.are_metrics_enabled)
+{
+  logger.info("Opened successfully the shared-memory link '{}' used by the Ethernet transmitter", config.interface);
+}
+
+void shm_transmitter_impl::send(span<span<const uint8_t>> frames)
+{
+  auto meas = metrics_collector.create_time_execution_measurer();
+
+  unsigned nof_written = ring.push(frames);
+  if (OCUDU_UNLIKELY(nof_written != frames.size())) {
+    logger.warning("Ethernet transmitter could not write '{}' frames in the shared-memory segment '{}'",
+                   frames.size() - nof_written,
+                   ring.get_name());
+  }
+
+  uint64_t nof_bytes = 0;
+  for (span<const uint8_t> frame : frames.first(nof_written)) {
+    nof_bytes += frame.size();
+  }
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, nof_written);
+}
+
+transmitter_metrics_collector* shm_transmitter_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
@@ -0,0 +1,44 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_shm_ring.h"
+#include "ethernet_tx_metrics_collector_impl.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter_config.h"
+
+namespace ocudu {
+namespace ether {
+
+/// \brief Ethernet transmitter implementation based on a shared-memory frame ring.
+///
+/// The frames of a burst are copied in the ring shared with the peer process of the link and published at once, without
+/// any system call. Frames that do not fit in the ring are discarded.
+class shm_transmitter_impl : public transmitter
+{
+public:
+  shm_transmitter_impl(const transmitter_config& config, ocudulog::basic_logger& logger_);
+
+  // See interface for documentation.
+  void send(span<span<const uint8_t>> frames) override;
+
+  // See interface for documentation.
+  transmitter_metrics_collector* get_metrics_collector() override;
+
+private:
+  ocudulog::basic_logger&            logger;
+  shm_frame_ring                     ring;
+  transmitter_metrics_collector_impl metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
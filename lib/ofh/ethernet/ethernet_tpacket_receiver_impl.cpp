@@ -0,0 +1,222 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_tpacket_receiver_impl.h"
+#include "ocudu/instrumentation/traces/ofh_traces.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_notifier.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
+#include "ocudu/support/error_handling.h"
+#include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/synchronization/sync_event.h"
+#include <arpa/inet.h>
+#include <cstring>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+namespace {
+
+class dummy_frame_notifier : public frame_notifier
+{
+  // See interface for documentation.
+  void on_new_frame(ether::unique_rx_buffer buffer) override {}
+};
+
+} // namespace
+
+/// This dummy object is passed to the constructor of the receiver implementation as a placeholder for the
+/// actual frame notifier, which will be later set up through the \ref start() method.
+static dummy_frame_notifier dummy_notifier;
+
+tpacket_receiver_impl::tpacket_receiver_impl(const receiver_config&  config,
+                                             task_executor&          executor_,
+                                             ocudulog::basic_logger& logger_) :
+  logger(logger_),
+  executor(executor_),
+  notifier(&dummy_notifier),
+  slots(NOF_FRAMES),
+  metrics_collector(config.are_metrics_enabled)
+{
+  socket_fd = ::socket(AF_PACKET, SOCK_RAW, htons(ECPRI_ETH_TYPE));
+  if (socket_fd < 0) {
+    report_error("Unable to open raw socket for Ethernet receiver: {}", ::strerror(errno));
+  }
+
+  if (config.interface.size() > (IFNAMSIZ - 1)) {
+    report_error("The Ethernet receiver interface name '{}' exceeds the maximum allowed length", config.interface);
+  }
+
+  // TPACKET_V2 hands each frame over as soon as it is written, whereas TPACKET_V3 only hands over complete blocks of
+  // frames, which delays the last frame before a reception gap until the block retire timeout expires.
+  int version = TPACKET_V2;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+    report_error("Unable to select TPACKET_V2 in the Ethernet receiver: {}", ::strerror(errno));
+  }
+
+  // Frames sent through the same interface by this host are not of interest to the receiver.
+  int ignore_outgoing = 1;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignore_outgoing, sizeof(ignore_outgoing)) < 0) {
+    logger.info("Unable to ignore outgoing frames in the Ethernet receiver: {}", ::strerror(errno));
+  }
+
+  static_assert(BLOCK_SIZE % FRAME_SIZE == 0, "The ring blocks must hold an integer number of frames");
+  ::tpacket_req req = {};
+  req.tp_block_size = BLOCK_SIZE;
+  req.tp_block_nr   = (NOF_FRAMES * FRAME_SIZE) / BLOCK_SIZE;
+  req.tp_frame_size = FRAME_SIZE;
+  req.tp_frame_nr   = NOF_FRAMES;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
+    report_error("Unable to set up the TPACKET_V2 receive ring in the Ethernet receiver: {}", ::strerror(errno));
+  }
+
+  ring_size = FRAME_SIZE * NOF_FRAMES;
+  void* map = ::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, socket_fd, 0);
+  if (map == MAP_FAILED) {
+    // Locking the ring in memory may exceed the process limits, retry without it.
+    map = ::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, socket_fd, 0);
+  }
+  if (map == MAP_FAILED) {
+    report_error("Unable to map the TPACKET_V2 receive ring in the Ethernet receiver: {}", ::strerror(errno));
+  }
+  ring = static_cast<uint8_t*>(map);
+
+  for (unsigned i_frame = 0; i_frame != NOF_FRAMES; ++i_frame) {
+    slots[i_frame].set_header(reinterpret_cast<::tpacket2_hdr*>(ring + i_frame * FRAME_SIZE));
+  }
+
+  ::ifreq if_opts = {};
+  ::strncpy(if_opts.ifr_name, config.interface.c_str(), IFNAMSIZ - 1);
+
+  if (config.is_promiscuous_mode_enabled) {
+    // Set interface to promiscuous mode.
+    if (::ioctl(socket_fd, SIOCGIFFLAGS, &if_opts) < 0) {
+      report_error("Unable to get flags for NIC interface '{}' in the Ethernet receiver", config.interface);
+    }
+    if_opts.ifr_flags |= IFF_PROMISC;
+    if (::ioctl(socket_fd, SIOCSIFFLAGS, &if_opts) < 0) {
+      report_error("Unable to set flags for NIC interface '{}' in the Ethernet receiver", config.interface);
+    }
+  }
+
+  // Bind the ring to the NIC.
+  if (::ioctl(socket_fd, SIOCGIFINDEX, &if_opts) < 0) {
+    report_error("Unable to get index for NIC interface '{}' in the Ethernet receiver", config.interface);
+  }
+  ::sockaddr_ll address = {};
+  address.sll_family    = AF_PACKET;
+  address.sll_protocol  = htons(ECPRI_ETH_TYPE);
+  address.sll_ifindex   = if_opts.ifr_ifindex;
+  if (::bind(socket_fd, reinterpret_cast<::sockaddr*>(&address), sizeof(address)) < 0) {
+    report_error("Unable to bind socket to the NIC interface '{}' in Ethernet receiver", config.interface);
+  }
+
+  logger.info("Opened successfully the NIC interface '{}' (fd = '{}') used by the TPACKET_V2 Ethernet receiver",
+              config.interface,
+              socket_fd);
+}
+
+tpacket_receiver_impl::~tpacket_receiver_impl()
+{
+  ::munmap(ring, ring_size);
+  ::close(socket_fd);
+}
+
+void tpacket_receiver_impl::start(frame_notifier& notifier_)
+{
+  logger.info("Starting the ethernet frame receiver");
+
+  stop_manager.reset();
+
+  notifier = &notifier_;
+
+  sync_event wait_event;
+  if (!executor.defer([this, token = wait_event.get_token()] { receive_loop(); })) {
+    report_error("Unable to start the ethernet frame receiver, fd = '{}'", socket_fd);
+  }
+
+  // Block waiting for receiver executor to start.
+  wait_event.wait();
+
+  logger.info("Started the ethernet frame receiver with fd = '{}'", socket_fd);
+}
+
+void tpacket_receiver_impl::stop()
+{
+  logger.info("Requesting stop of the ethernet frame receiver with fd = '{}'", socket_fd);
+  stop_manager.stop();
+  logger.info("Stopped the ethernet frame receiver with fd = '{}'", socket_fd);
+}
+
+void tpacket_receiver_impl::receive_loop()
+{
+  auto token = stop_manager.get_token();
+  if (OCUDU_UNLIKELY(token.is_stop_requested())) {
+    return;
+  }
+
+  receive();
+
+  // Retry the task deferring when it fails.
+  while (!executor.defer([this, tk = std::move(token)]() { receive_loop(); })) {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+  }
+}
+
+/// Blocking function that waits until the kernel writes a frame in the ring or the specified timeout expires.
+static void wait_for_frame(int socket, std::chrono::microseconds timeout)
+{
+  ::pollfd fds  = {};
+  fds.fd        = socket;
+  fds.events    = POLLIN | POLLERR;
+  ::timespec ts = {0, static_cast<long>(std::chrono::nanoseconds(timeout).count())};
+
+  ::ppoll(&fds, 1, &ts, nullptr);
+}
+
+void tpacket_receiver_impl::receive()
+{
+  if (!slots[frame_index].is_ready()) {
+    wait_for_frame(socket_fd, std::chrono::microseconds(5));
+    if (!slots[frame_index].is_ready()) {
+      return;
+    }
+  }
+
+  auto        meas       = metrics_collector.create_time_execution_measurer();
+  trace_point tp         = ofh_tracer.now();
+  unsigned    nof_frames = 0;
+  uint64_t    nof_bytes  = 0;
+
+  for (; nof_frames != MAX_BURST_SIZE && slots[frame_index].is_ready(); ++nof_frames) {
+    tpacket_rx_frame_context& slot      = slots[frame_index];
+    const ::tpacket2_hdr&     frame_hdr = *slot.get_header();
+    span<const uint8_t> frame(reinterpret_cast<const uint8_t*>(&frame_hdr) + frame_hdr.tp_mac, frame_hdr.tp_snaplen);
+    nof_bytes += frame.size();
+
+    // The slot is returned to the kernel when the buffer is released.
+    notifier->on_new_frame(unique_rx_buffer(tpacket_rx_buffer_impl(slot, frame)));
+
+    frame_index = (frame_index + 1) % NOF_FRAMES;
+  }
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, nof_frames);
+  ofh_tracer << trace_event("ofh_receiver", tp);
+}
+
+receiver_metrics_collector* tpacket_receiver_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
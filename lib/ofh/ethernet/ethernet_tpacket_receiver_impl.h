@@ -0,0 +1,167 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_rx_metrics_collector_impl.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver_config.h"
+#include "ocudu/ofh/ethernet/ethernet_unique_buffer.h"
+#include "ocudu/support/ocudu_assert.h"
+#include "ocudu/support/synchronization/stop_event.h"
+#include <atomic>
+#include <linux/if_packet.h>
+#include <vector>
+
+namespace ocudu {
+
+class task_executor;
+
+namespace ether {
+
+/// \brief Context of a frame slot of the TPACKET_V2 receive ring.
+///
+/// A slot is handed back to the kernel once the frame stored in it has been released.
+class tpacket_rx_frame_context
+{
+public:
+  /// Sets the frame header inside the memory-mapped ring.
+  void set_header(::tpacket2_hdr* hdr_) { hdr = hdr_; }
+
+  /// Returns the frame header inside the memory-mapped ring.
+  const ::tpacket2_hdr* get_header() const { return hdr; }
+
+  /// Returns true if the kernel has written a frame in the slot and the frame from a previous turn of the ring is not
+  /// still held.
+  bool is_ready() const
+  {
+    return !in_use.load(std::memory_order_acquire) &&
+           (__atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER);
+  }
+
+  /// Marks the slot as in use by the application.
+  void acquire() { in_use.store(true, std::memory_order_relaxed); }
+
+  /// Returns the slot to the kernel.
+  void release()
+  {
+    __atomic_store_n(&hdr->tp_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+    in_use.store(false, std::memory_order_release);
+  }
+
+private:
+  ::tpacket2_hdr*   hdr = nullptr;
+  std::atomic<bool> in_use{false};
+};
+
+/// Receive buffer wrapper pointing to a frame stored in a slot of the TPACKET_V2 receive ring.
+class tpacket_rx_buffer_impl : public rx_buffer
+{
+public:
+  /// Constructor takes ownership of the given slot.
+  tpacket_rx_buffer_impl(tpacket_rx_frame_context& slot_, span<const uint8_t> frame) :
+    slot(&slot_), frame_data(frame.data()), size(frame.size())
+  {
+    slot->acquire();
+  }
+
+  /// Destructor returns the slot to the kernel.
+  ~tpacket_rx_buffer_impl() override
+  {
+    if (slot != nullptr) {
+      slot->release();
+    }
+  }
+
+  /// Copy constructor is deleted.
+  tpacket_rx_buffer_impl(const tpacket_rx_buffer_impl& other) = delete;
+
+  /// Copy assignment operator is deleted.
+  tpacket_rx_buffer_impl& operator=(const tpacket_rx_buffer_impl& other) = delete;
+
+  /// Move constructor.
+  tpacket_rx_buffer_impl(tpacket_rx_buffer_impl&& other) noexcept :
+    slot(other.slot), frame_data(other.frame_data), size(other.size)
+  {
+    other.slot = nullptr;
+  }
+
+  /// Move assignment operator is deleted.
+  tpacket_rx_buffer_impl& operator=(tpacket_rx_buffer_impl&& other) = delete;
+
+  // See interface for documentation.
+  span<const uint8_t> data() const override
+  {
+    ocudu_assert(slot != nullptr, "Invalid tpacket_rx_buffer_impl accessed");
+    return {frame_data, size};
+  }
+
+private:
+  tpacket_rx_frame_context* slot;
+  const uint8_t*            frame_data;
+  unsigned                  size;
+};
+
+/// \brief Ethernet receiver implementation based on a TPACKET_V2 memory-mapped receive ring.
+///
+/// The kernel writes each received frame directly in its own slot of a ring shared with the application and hands the
+/// slot over as soon as the frame is written, so the frames are notified without copying them and without waiting for
+/// further frames to arrive.
+class tpacket_receiver_impl : public receiver, private receiver_operation_controller
+{
+  /// Size of each frame slot of the ring in bytes, which holds a single jumbo frame.
+  static constexpr unsigned FRAME_SIZE = 1U << 14;
+  /// Number of frame slots of the ring.
+  static constexpr unsigned NOF_FRAMES = 1024;
+  /// Size of each contiguous memory block of the ring in bytes.
+  static constexpr unsigned BLOCK_SIZE = 1U << 16;
+  /// Maximum number of frames notified in a single receive call.
+  static constexpr unsigned MAX_BURST_SIZE = 64;
+
+public:
+  tpacket_receiver_impl(const receiver_config& config, task_executor& executor_, ocudulog::basic_logger& logger_);
+
+  ~tpacket_receiver_impl() override;
+
+  // See interface for documentation.
+  receiver_operation_controller& get_operation_controller() override { return *this; }
+
+  // See interface for documentation.
+  receiver_metrics_collector* get_metrics_collector() override;
+
+private:
+  // See interface for documentation.
+  void start(frame_notifier& notifier_) override;
+
+  // See interface for documentation.
+  void stop() override;
+
+  /// Main receiving loop.
+  void receive_loop();
+
+  /// Notifies the frames available in the ring.
+  void receive();
+
+  ocudulog::basic_logger&               logger;
+  task_executor&                        executor;
+  frame_notifier*                       notifier;
+  int                                   socket_fd   = -1;
+  uint8_t*                              ring        = nullptr;
+  unsigned                              ring_size   = 0;
+  unsigned                              frame_index = 0;
+  std::vector<tpacket_rx_frame_context> slots;
+  rt_stop_event_source                  stop_manager;
+  receiver_metrics_collector_impl       metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
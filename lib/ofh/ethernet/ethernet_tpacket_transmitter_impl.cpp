@@ -0,0 +1,179 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_tpacket_transmitter_impl.h"
+#include "ocudu/support/error_handling.h"
+#include <arpa/inet.h>
+#include <cstring>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+tpacket_transmitter_impl::tpacket_transmitter_impl(const transmitter_config& config, ocudulog::basic_logger& logger_) :
+  logger(logger_), metrics_collector(config.are_metrics_enabled)
+{
+  // The socket is not bound to any protocol, so that it never receives frames.
+  socket_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+  if (socket_fd < 0) {
+    report_error("Unable to open raw socket for Ethernet transmitter: {}", ::strerror(errno));
+  }
+
+  if (config.interface.size() > (IFNAMSIZ - 1)) {
+    report_error("The Ethernet transmitter interface name '{}' exceeds the maximum allowed length", config.interface);
+  }
+
+  ::ifreq if_idx = {};
+  ::strncpy(if_idx.ifr_name, config.interface.c_str(), IFNAMSIZ - 1);
+
+  // Set requested MTU size.
+  if_idx.ifr_mtu = config.mtu_size.value();
+  if (::ioctl(socket_fd, SIOCSIFMTU, &if_idx) < 0) {
+    // Get the MTU size of the NIC.
+    int current_mtu = -1;
+    if (::ioctl(socket_fd, SIOCGIFMTU, &if_idx) < 0) {
+      logger.warning("Could not check MTU of the NIC interface '{}' in the Ethernet transmitter", config.interface);
+    } else {
+      current_mtu = if_idx.ifr_mtu;
+    }
+    report_error(
+        "Unable to set MTU size to '{}' bytes for NIC interface '{}' in the Ethernet transmitter, current MTU size "
+        "set to '{}' bytes",
+        config.mtu_size,
+        config.interface,
+        current_mtu);
+  }
+
+  if (config.mtu_size.value() + FRAME_DATA_OFFSET > FRAME_SIZE) {
+    report_error("The MTU size of '{}' bytes exceeds the capacity of the TPACKET_V3 Ethernet transmitter ring slots",
+                 config.mtu_size);
+  }
+
+  // Get the index of the NIC.
+  if (::ioctl(socket_fd, SIOCGIFINDEX, &if_idx) < 0) {
+    report_error("Unable to get index for NIC interface in the Ethernet transmitter");
+  }
+
+  int version = TPACKET_V3;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+    report_error("Unable to select TPACKET_V3 in the Ethernet transmitter: {}", ::strerror(errno));
+  }
+
+  // Hand the frames directly to the NIC driver, skipping the kernel queueing discipline.
+  int qdisc_bypass = 1;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_QDISC_BYPASS, &qdisc_bypass, sizeof(qdisc_bypass)) < 0) {
+    logger.info("Unable to bypass the queueing discipline in the Ethernet transmitter: {}", ::strerror(errno));
+  }
+
+  ::tpacket_req3 req = {};
+  req.tp_block_size  = BLOCK_SIZE;
+  req.tp_block_nr    = NOF_BLOCKS;
+  req.tp_frame_size  = FRAME_SIZE;
+  req.tp_frame_nr    = NOF_FRAMES;
+  if (::setsockopt(socket_fd, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req)) < 0) {
+    report_error("Unable to set up the TPACKET_V3 transmit ring in the Ethernet transmitter: {}", ::strerror(errno));
+  }
+
+  ring_size = BLOCK_SIZE * NOF_BLOCKS;
+  void* map = ::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, socket_fd, 0);
+  if (map == MAP_FAILED) {
+    report_error("Unable to map the TPACKET_V3 transmit ring in the Ethernet transmitter: {}", ::strerror(errno));
+  }
+  ring = static_cast<uint8_t*>(map);
+
+  ::sockaddr_ll address = {};
+  address.sll_family    = AF_PACKET;
+  address.sll_ifindex   = if_idx.ifr_ifindex;
+  if (::bind(socket_fd, reinterpret_cast<::sockaddr*>(&address), sizeof(address)) < 0) {
+    report_error("Unable to bind socket to the NIC interface '{}' in the Ethernet transmitter", config.interface);
+  }
+
+  logger.info("Opened successfully the NIC interface '{}' (fd = '{}') used by the TPACKET_V3 Ethernet transmitter",
+              config.interface,
+              socket_fd);
+}
+
+tpacket_transmitter_impl::~tpacket_transmitter_impl()
+{
+  ::munmap(ring, ring_size);
+  ::close(socket_fd);
+}
+
+/// Returns the status of the given ring slot.
+static unsigned get_status(const ::tpacket3_hdr& hdr)
+{
+  return __atomic_load_n(&hdr.tp_status, __ATOMIC_ACQUIRE);
+}
+
+/// Returns true if the given ring slot is still owned by the kernel.
+static bool is_slot_busy(const ::tpacket3_hdr& hdr)
+{
+  return get_status(hdr) & (TP_STATUS_SEND_REQUEST | TP_STATUS_SENDING);
+}
+
+void tpacket_transmitter_impl::flush()
+{
+  if (::send(socket_fd, nullptr, 0, MSG_DONTWAIT) < 0 && errno != EAGAIN && errno != ENOBUFS) {
+    logger.warning("Ethernet transmitter with fd = '{}' could not flush the transmit ring: {}",
+                   socket_fd,
+                   ::strerror(errno));
+  }
+}
+
+void tpacket_transmitter_impl::send(span<span<const uint8_t>> frames)
+{
+  auto meas = metrics_collector.create_time_execution_measurer();
+
+  uint64_t nof_bytes   = 0;
+  unsigned nof_written = 0;
+  for (auto frame : frames) {
+    auto& hdr = *reinterpret_cast<::tpacket3_hdr*>(ring + frame_index * FRAME_SIZE);
+
+    // The ring is full, flush the pending frames so that the kernel frees some slots.
+    if (is_slot_busy(hdr)) {
+      flush();
+      if (is_slot_busy(hdr)) {
+        logger.warning("Ethernet transmitter with fd = '{}' could not transmit '{}' bytes, the transmit ring is full",
+                       socket_fd,
+                       frame.size());
+        continue;
+      }
+    }
+
+    if (get_status(hdr) & TP_STATUS_WRONG_FORMAT) {
+      logger.warning("Ethernet transmitter with fd = '{}' discarded a malformed frame", socket_fd);
+    }
+
+    std::memcpy(ring + frame_index * FRAME_SIZE + FRAME_DATA_OFFSET, frame.data(), frame.size());
+    hdr.tp_len         = frame.size();
+    hdr.tp_snaplen     = frame.size();
+    hdr.tp_next_offset = 0;
+    __atomic_store_n(&hdr.tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+    frame_index = (frame_index + 1) % NOF_FRAMES;
+    nof_bytes += frame.size();
+    ++nof_written;
+  }
+
+  // Hand over the whole burst to the kernel with a single system call.
+  if (nof_written != 0) {
+    flush();
+  }
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, nof_written);
+}
+
+transmitter_metrics_collector* tpacket_transmitter_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_tx_metrics_collector_impl.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter_config.h"
+#include <linux/if_packet.h>
+
+namespace ocudu {
+namespace ether {
+
+/// \brief Ethernet transmitter implementation based on a TPACKET_V3 memory-mapped transmit ring.
+///
+/// The frames of a burst are written in consecutive slots of a ring shared with the kernel, and the whole burst is
+/// handed over to the kernel with a single system call.
+class tpacket_transmitter_impl : public transmitter
+{
+  /// Size of each block of the ring in bytes.
+  static constexpr unsigned BLOCK_SIZE = 1U << 18;
+  /// Number of blocks of the ring.
+  static constexpr unsigned NOF_BLOCKS = 16;
+  /// Size of each frame slot of the ring in bytes.
+  static constexpr unsigned FRAME_SIZE = 1U << 14;
+  /// Number of frame slots of the ring.
+  static constexpr unsigned NOF_FRAMES = (BLOCK_SIZE / FRAME_SIZE) * NOF_BLOCKS;
+  /// Offset of the frame data from the beginning of a slot in bytes.
+  static constexpr unsigned FRAME_DATA_OFFSET = TPACKET_ALIGN(sizeof(::tpacket3_hdr));
+
+public:
+  tpacket_transmitter_impl(const transmitter_config& config, ocudulog::basic_logger& logger_);
+  ~tpacket_transmitter_impl() override;
+
+  // See interface for documentation.
+  void send(span<span<const uint8_t>> frames) override;
+
+  // See interface for documentation.
+  transmitter_metrics_collector* get_metrics_collector() override;
+
+private:
+  /// Requests the kernel to transmit the frames written in the ring.
+  void flush();
+
+  ocudulog::basic_logger&            logger;
+  int                                socket_fd   = -1;
+  uint8_t*                           ring        = nullptr;
+  unsigned                           ring_size   = 0;
+  unsigned                           frame_index = 0;
+  transmitter_metrics_collector_impl metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
@@ -65,6 +65,15 @@ transmitter_impl::transmitter_impl(const transmitter_config& config, ocudulog::b
   socket_address.sll_halen   = ETH_ALEN;
   std::copy(std::begin(config.mac_dst_address), std::end(config.mac_dst_address), std::begin(socket_address.sll_addr));
 
+  // Prepare the message headers used by sendmmsg, each one pointing to its own scatter/gather entry.
+  for (unsigned i = 0; i != MAX_TX_BURST_SIZE; ++i) {
+    batch_headers[i]                     = {};
+    batch_headers[i].msg_hdr.msg_name    = &socket_address;
+    batch_headers[i].msg_hdr.msg_namelen = sizeof(socket_address);
+    batch_headers[i].msg_hdr.msg_iov     = &batch_iovecs[i];
+    batch_headers[i].msg_hdr.msg_iovlen  = 1;
+  }
+
   logger.info("Opened successfully the NIC interface '{}' (fd = '{}') used by the Ethernet transmitter",
               config.interface,
               socket_fd);
@@ -77,26 +86,36 @@ transmitter_impl::~transmitter_impl()
 
 void transmitter_impl::send(span<span<const uint8_t>> frames)
 {
-  for (auto frame : frames) {
+  while (!frames.empty()) {
     auto meas = metrics_collector.create_time_execution_measurer();
 
-    int ret = ::sendto(socket_fd,
-                       frame.data(),
-                       frame.size(),
-                       0,
-                       reinterpret_cast<::sockaddr*>(&socket_address),
-                       sizeof(socket_address));
+    // Hand a batch of frames to the kernel with a single system call.
+    unsigned batch_size = std::min<unsigned>(frames.size(), MAX_TX_BURST_SIZE);
+    for (unsigned i = 0; i != batch_size; ++i) {
+      batch_iovecs[i].iov_base = const_cast<uint8_t*>(frames[i].data());
+      batch_iovecs[i].iov_len  = frames[i].size();
+    }
+
+    int ret = ::sendmmsg(socket_fd, batch_headers.data(), batch_size, 0);
 
-    if (ret < 0) {
+    // The first frame of the batch could not be transmitted, skip it.
+    if (ret <= 0) {
       logger.warning("Ethernet transmitter with fd = '{}' could not transmit '{}' bytes, consider tuning "
                      "the NIC system settings to obtain higher performance or use DPDK",
                      socket_fd,
-                     frame.size());
+                     frames.front().size());
 
       metrics_collector.update_stats(meas.stop());
+      frames = frames.last(frames.size() - 1);
       continue;
     }
-    metrics_collector.update_stats(meas.stop(), frame.size());
+
+    uint64_t nof_bytes = 0;
+    for (unsigned i = 0; i != static_cast<unsigned>(ret); ++i) {
+      nof_bytes += frames[i].size();
+    }
+    metrics_collector.update_stats(meas.stop(), nof_bytes, ret);
+    frames = frames.last(frames.size() - ret);
   }
 }
 
@@ -13,13 +13,18 @@
 #include "ethernet_tx_metrics_collector_impl.h"
 #include "ocudu/ocudulog/logger.h"
 #include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
 #include "ocudu/ofh/ethernet/ethernet_transmitter_config.h"
+#include <array>
 #include <linux/if_packet.h>
+#include <sys/socket.h>
 
 namespace ocudu {
 namespace ether {
 
-/// Implementation for the Ethernet transmitter.
+/// \brief Implementation for the Ethernet transmitter.
+///
+/// The frames of a burst are handed to the kernel in batches with a single \c sendmmsg system call per batch.
 class transmitter_impl : public transmitter
 {
 public:
@@ -37,6 +42,10 @@ private:
   int                                socket_fd = -1;
   transmitter_metrics_collector_impl metrics_collector;
   ::sockaddr_ll                      socket_address;
+  /// Scatter/gather entries of the frames of a batch.
+  std::array<::iovec, MAX_TX_BURST_SIZE> batch_iovecs;
+  /// Message headers of the frames of a batch.
+  std::array<::mmsghdr, MAX_TX_BURST_SIZE> batch_headers;
 };
 
 } // namespace ether
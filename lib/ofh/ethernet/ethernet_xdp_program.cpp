@@ -0,0 +1,171 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_xdp_program.h"
+#include "ethernet_constants.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
+#include "ocudu/support/error_handling.h"
+#include <arpa/inet.h>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+/// Maximum number of NIC queues that can be steered to AF_XDP sockets.
+static constexpr unsigned MAX_NOF_QUEUES = 64;
+
+/// Invokes the bpf system call.
+static int bpf(::bpf_cmd cmd, ::bpf_attr& attr)
+{
+  return ::syscall(__NR_bpf, cmd, &attr, sizeof(attr));
+}
+
+/// Builds an eBPF instruction.
+static ::bpf_insn make_insn(uint8_t code, uint8_t dst, uint8_t src, int16_t off, int32_t imm)
+{
+  ::bpf_insn insn = {};
+  insn.code       = code;
+  insn.dst_reg    = dst;
+  insn.src_reg    = src;
+  insn.off        = off;
+  insn.imm        = imm;
+  return insn;
+}
+
+/// \brief Builds the program steering the eCPRI frames to the AF_XDP socket map.
+///
+/// The program is equivalent to:
+/// \code
+///   if (data + ETH_HEADER_SIZE + ETH_VLAN_TAG_SIZE > data_end) return XDP_PASS;
+///   if (eth_type != eCPRI && (eth_type != VLAN || inner_eth_type != eCPRI)) return XDP_PASS;
+///   return bpf_redirect_map(&map, ctx->rx_queue_index, XDP_PASS);
+/// \endcode
+static std::array<::bpf_insn, 18> build_program(int map_fd)
+{
+  const int32_t ecpri_type = htons(ECPRI_ETH_TYPE);
+  const int32_t vlan_type  = htons(VLAN_TPID);
+  const int32_t min_length = (ETH_HEADER_SIZE + ETH_VLAN_TAG_SIZE).value();
+
+  return {
+      // r2 = ctx->data, r3 = ctx->data_end.
+      make_insn(BPF_LDX | BPF_W | BPF_MEM, BPF_REG_2, BPF_REG_1, offsetof(::xdp_md, data), 0),
+      make_insn(BPF_LDX | BPF_W | BPF_MEM, BPF_REG_3, BPF_REG_1, offsetof(::xdp_md, data_end), 0),
+      // Pass the frames too short to hold a VLAN tagged Ethernet header.
+      make_insn(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0),
+      make_insn(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0, min_length),
+      make_insn(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 11, 0),
+      // Check the Ethernet type, looking into the VLAN tag when present.
+      make_insn(BPF_LDX | BPF_H | BPF_MEM, BPF_REG_5, BPF_REG_2, 2 * ETH_ADDR_LEN, 0),
+      make_insn(BPF_JMP | BPF_JEQ | BPF_K, BPF_REG_5, 0, 3, ecpri_type),
+      make_insn(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 8, vlan_type),
+      make_insn(BPF_LDX | BPF_H | BPF_MEM, BPF_REG_5, BPF_REG_2, 2 * ETH_ADDR_LEN + ETH_VLAN_TAG_SIZE.value(), 0),
+      make_insn(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 6, ecpri_type),
+      // Redirect to the socket of the receive queue, or pass the frame if there is none.
+      make_insn(BPF_LDX | BPF_W | BPF_MEM, BPF_REG_2, BPF_REG_1, offsetof(::xdp_md, rx_queue_index), 0),
+      make_insn(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD, 0, map_fd),
+      make_insn(0, 0, 0, 0, 0),
+      make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS),
+      make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+      make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+      // Pass the frame to the kernel network stack.
+      make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS),
+      make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+  };
+}
+
+xdp_program::xdp_program(unsigned ifindex, ocudulog::basic_logger& logger_) : logger(logger_)
+{
+  ::bpf_attr map_attr  = {};
+  map_attr.map_type    = BPF_MAP_TYPE_XSKMAP;
+  map_attr.key_size    = sizeof(uint32_t);
+  map_attr.value_size  = sizeof(uint32_t);
+  map_attr.max_entries = MAX_NOF_QUEUES;
+  map_fd               = bpf(BPF_MAP_CREATE, map_attr);
+  if (map_fd < 0) {
+    report_error("Unable to create the AF_XDP socket map: {}", ::strerror(errno));
+  }
+
+  std::array<::bpf_insn, 18> program   = build_program(map_fd);
+  static const char          license[] = "BSD";
+  std::array<char, 4096>     verifier_log;
+  verifier_log.front() = '\0';
+
+  ::bpf_attr prog_attr = {};
+  prog_attr.prog_type  = BPF_PROG_TYPE_XDP;
+  prog_attr.insn_cnt   = program.size();
+  prog_attr.insns      = reinterpret_cast<uint64_t>(program.data());
+  prog_attr.license    = reinterpret_cast<uint64_t>(license);
+  prog_attr.log_buf    = reinterpret_cast<uint64_t>(verifier_log.data());
+  prog_attr.log_size   = verifier_log.size();
+  prog_attr.log_level  = 1;
+  // Frames spanning several buffers only carry the Ethernet header in the first one, which is all the program reads.
+  prog_attr.prog_flags = BPF_F_XDP_HAS_FRAGS;
+  prog_fd              = bpf(BPF_PROG_LOAD, prog_attr);
+  if (prog_fd < 0 && errno == EINVAL) {
+    // Kernels without XDP multi-buffer support reject the flag.
+    prog_attr.prog_flags = 0;
+    prog_fd              = bpf(BPF_PROG_LOAD, prog_attr);
+  }
+  if (prog_fd < 0) {
+    report_error("Unable to load the XDP program: {}\n{}", ::strerror(errno), verifier_log.data());
+  }
+
+  // Prefer the native mode of the NIC driver, falling back to the generic mode.
+  for (uint32_t mode : {XDP_FLAGS_DRV_MODE, XDP_FLAGS_SKB_MODE}) {
+    ::bpf_attr link_attr                 = {};
+    link_attr.link_create.prog_fd        = prog_fd;
+    link_attr.link_create.target_ifindex = ifindex;
+    link_attr.link_create.attach_type    = BPF_XDP;
+    link_attr.link_create.flags          = mode;
+    link_fd                              = bpf(BPF_LINK_CREATE, link_attr);
+    if (link_fd >= 0) {
+      logger.info("Attached the XDP program to the NIC with index '{}' in {} mode",
+                  ifindex,
+                  (mode == XDP_FLAGS_DRV_MODE) ? "native" : "generic");
+      return;
+    }
+  }
+
+  report_error("Unable to attach the XDP program to the NIC with index '{}': {}", ifindex, ::strerror(errno));
+}
+
+xdp_program::~xdp_program()
+{
+  // Closing the link detaches the program from the NIC.
+  ::close(link_fd);
+  ::close(prog_fd);
+  ::close(map_fd);
+}
+
+void xdp_program::register_socket(unsigned queue_id, int socket_fd)
+{
+  if (queue_id >= MAX_NOF_QUEUES) {
+    report_error("The NIC queue '{}' exceeds the maximum of '{}' queues steered by the XDP program",
+                 queue_id,
+                 MAX_NOF_QUEUES);
+  }
+
+  uint32_t   key   = queue_id;
+  uint32_t   value = socket_fd;
+  ::bpf_attr attr  = {};
+  attr.map_fd      = map_fd;
+  attr.key         = reinterpret_cast<uint64_t>(&key);
+  attr.value       = reinterpret_cast<uint64_t>(&value);
+  attr.flags       = BPF_ANY;
+  if (bpf(BPF_MAP_UPDATE_ELEM, attr) < 0) {
+    report_error("Unable to register the AF_XDP socket in the XDP program: {}", ::strerror(errno));
+  }
+}
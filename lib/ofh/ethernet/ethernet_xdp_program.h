@@ -0,0 +1,45 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/ocudulog/logger.h"
+
+namespace ocudu {
+namespace ether {
+
+/// \brief XDP program steering the eCPRI frames received by a NIC to AF_XDP sockets.
+///
+/// The program redirects the eCPRI frames, with or without a VLAN tag, received on a NIC queue to the AF_XDP socket
+/// registered for that queue. Any other frame is passed to the kernel network stack. The program is detached from the
+/// NIC when the object is destroyed.
+class xdp_program
+{
+public:
+  /// Loads the program and attaches it to the NIC with the given index.
+  xdp_program(unsigned ifindex, ocudulog::basic_logger& logger_);
+
+  ~xdp_program();
+
+  xdp_program(const xdp_program&)            = delete;
+  xdp_program& operator=(const xdp_program&) = delete;
+
+  /// Redirects the eCPRI frames received on the given NIC queue to the given AF_XDP socket.
+  void register_socket(unsigned queue_id, int socket_fd);
+
+private:
+  ocudulog::basic_logger& logger;
+  int                     map_fd  = -1;
+  int                     prog_fd = -1;
+  int                     link_fd = -1;
+};
+
+} // namespace ether
+} // namespace ocudu
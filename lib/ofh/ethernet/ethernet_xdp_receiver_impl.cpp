@@ -0,0 +1,302 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_xdp_receiver_impl.h"
+#include "ethernet_constants.h"
+#include "ocudu/instrumentation/traces/ofh_traces.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_notifier.h"
+#include "ocudu/support/error_handling.h"
+#include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/synchronization/sync_event.h"
+#include <cstring>
+#include <linux/ethtool.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+namespace {
+
+class dummy_frame_notifier : public frame_notifier
+{
+  // See interface for documentation.
+  void on_new_frame(ether::unique_rx_buffer buffer) override {}
+};
+
+} // namespace
+
+/// This dummy object is passed to the constructor of the receiver implementation as a placeholder for the
+/// actual frame notifier, which will be later set up through the \ref start() method.
+static dummy_frame_notifier dummy_notifier;
+
+/// Enables the promiscuous mode of the given NIC interface.
+static void enable_promiscuous_mode(const std::string& interface)
+{
+  int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    report_error("Unable to open socket for setting the flags of NIC interface '{}': {}", interface, ::strerror(errno));
+  }
+
+  ::ifreq if_opts = {};
+  ::strncpy(if_opts.ifr_name, interface.c_str(), IFNAMSIZ - 1);
+  if (::ioctl(fd, SIOCGIFFLAGS, &if_opts) < 0) {
+    report_error("Unable to get flags for NIC interface '{}' in the Ethernet receiver", interface);
+  }
+  if_opts.ifr_flags |= IFF_PROMISC;
+  if (::ioctl(fd, SIOCSIFFLAGS, &if_opts) < 0) {
+    report_error("Unable to set flags for NIC interface '{}' in the Ethernet receiver", interface);
+  }
+  ::close(fd);
+}
+
+/// \brief Checks that the given NIC interface receives all the frames in a single queue.
+///
+/// The AF_XDP socket only receives the frames of the NIC queue it is bound to, so frames steered to other queues, for
+/// example by RSS, would be lost.
+static void check_single_rx_queue(const std::string& interface, ocudulog::basic_logger& logger)
+{
+  int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    report_error("Unable to open socket for querying the channels of NIC interface '{}': {}",
+                 interface,
+                 ::strerror(errno));
+  }
+
+  ::ethtool_channels channels = {};
+  channels.cmd                = ETHTOOL_GCHANNELS;
+  ::ifreq if_opts             = {};
+  ::strncpy(if_opts.ifr_name, interface.c_str(), IFNAMSIZ - 1);
+  if_opts.ifr_data = reinterpret_cast<char*>(&channels);
+  int ret          = ::ioctl(fd, SIOCETHTOOL, &if_opts);
+  ::close(fd);
+
+  if (ret < 0) {
+    logger.warning("Unable to query the channels of NIC interface '{}', make sure that it has a single receive queue",
+                   interface);
+    return;
+  }
+
+  unsigned nof_rx_queues = channels.rx_count + channels.combined_count;
+  if (nof_rx_queues > 1) {
+    report_error("NIC interface '{}' has {} receive queues but the AF_XDP Ethernet receiver only binds to one, "
+                 "configure a single queue with 'ethtool -L {} combined 1'",
+                 interface,
+                 nof_rx_queues,
+                 interface);
+  }
+}
+
+xdp_receiver_impl::xdp_receiver_impl(const receiver_config&      config,
+                                     task_executor&              executor_,
+                                     std::shared_ptr<xdp_socket> socket_,
+                                     ocudulog::basic_logger&     logger_) :
+  logger(logger_),
+  executor(executor_),
+  notifier(&dummy_notifier),
+  socket(std::move(socket_)),
+  program(socket->get_ifindex(), logger),
+  frame_pool(*socket),
+  buffer_pool(BUFFER_SIZE),
+  metrics_collector(config.are_metrics_enabled)
+{
+  check_single_rx_queue(config.interface, logger);
+
+  if (config.is_promiscuous_mode_enabled) {
+    enable_promiscuous_mode(config.interface);
+  }
+
+  // Hand all the UMEM frames to the kernel.
+  xdp_ring<uint64_t>& fill_ring = socket->get_fill_ring();
+  ocudu_assert(fill_ring.get_nof_free(xdp_socket::NOF_RX_FRAMES) == xdp_socket::NOF_RX_FRAMES,
+               "The fill ring cannot hold all the UMEM frames");
+  for (unsigned i_frame = 0; i_frame != xdp_socket::NOF_RX_FRAMES; ++i_frame) {
+    fill_ring.get_producer_entry(i_frame) = xdp_socket::get_rx_frame_addr(i_frame);
+  }
+  fill_ring.submit(xdp_socket::NOF_RX_FRAMES);
+
+  program.register_socket(xdp_socket::QUEUE_ID, socket->get_fd());
+
+  logger.info("Opened successfully the NIC interface '{}' (fd = '{}') used by the AF_XDP Ethernet receiver",
+              config.interface,
+              socket->get_fd());
+}
+
+void xdp_receiver_impl::start(frame_notifier& notifier_)
+{
+  logger.info("Starting the ethernet frame receiver");
+
+  stop_manager.reset();
+
+  notifier = &notifier_;
+
+  sync_event wait_event;
+  if (!executor.defer([this, token = wait_event.get_token()] { receive_loop(); })) {
+    report_error("Unable to start the ethernet frame receiver, fd = '{}'", socket->get_fd());
+  }
+
+  // Block waiting for receiver executor to start.
+  wait_event.wait();
+
+  logger.info("Started the ethernet frame receiver with fd = '{}'", socket->get_fd());
+}
+
+void xdp_receiver_impl::stop()
+{
+  logger.info("Requesting stop of the ethernet frame receiver with fd = '{}'", socket->get_fd());
+  stop_manager.stop();
+  logger.info("Stopped the ethernet frame receiver with fd = '{}'", socket->get_fd());
+}
+
+void xdp_receiver_impl::receive_loop()
+{
+  auto token = stop_manager.get_token();
+  if (OCUDU_UNLIKELY(token.is_stop_requested())) {
+    return;
+  }
+
+  receive();
+
+  // Retry the task deferring when it fails.
+  while (!executor.defer([this, tk = std::move(token)]() { receive_loop(); })) {
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
+  }
+}
+
+/// \brief Blocking function that waits for incoming data over the socket or until the specified timeout expires.
+///
+/// Polling the socket also wakes up the kernel when it needs to be notified of new frames in the fill ring.
+static void wait_for_data(int socket, std::chrono::microseconds timeout)
+{
+  ::pollfd fds  = {};
+  fds.fd        = socket;
+  fds.events    = POLLIN;
+  ::timespec ts = {0, static_cast<long>(std::chrono::nanoseconds(timeout).count())};
+
+  ::ppoll(&fds, 1, &ts, nullptr);
+}
+
+/// Removes in place the VLAN tag of the given frame, if present, and returns the resulting frame.
+static span<uint8_t> strip_vlan_tag(span<uint8_t> frame)
+{
+  static constexpr unsigned eth_type_offset = 2 * ETH_ADDR_LEN;
+  if (frame.size() < (ETH_HEADER_SIZE + ETH_VLAN_TAG_SIZE).value() ||
+      frame[eth_type_offset] != (VLAN_TPID >> 8U) || frame[eth_type_offset + 1] != (VLAN_TPID & 0xffU)) {
+    return frame;
+  }
+
+  std::memmove(frame.data() + ETH_VLAN_TAG_SIZE.value(), frame.data(), eth_type_offset);
+  return frame.last(frame.size() - ETH_VLAN_TAG_SIZE.value());
+}
+
+void xdp_receiver_impl::refill()
+{
+  xdp_ring<uint64_t>& fill_ring = socket->get_fill_ring();
+
+  unsigned nof_free   = fill_ring.get_nof_free(xdp_socket::NOF_RX_FRAMES);
+  unsigned nof_frames = 0;
+  for (uint64_t addr; nof_frames != nof_free && frame_pool.try_pop(addr); ++nof_frames) {
+    fill_ring.get_producer_entry(nof_frames) = addr;
+  }
+  if (nof_frames != 0) {
+    fill_ring.submit(nof_frames);
+  }
+}
+
+void xdp_receiver_impl::receive()
+{
+  refill();
+
+  xdp_ring<::xdp_desc>& rx_ring = socket->get_rx_ring();
+
+  unsigned nof_descs = rx_ring.get_nof_available(MAX_BURST_SIZE);
+  if (nof_descs == 0) {
+    wait_for_data(socket->get_fd(), std::chrono::microseconds(5));
+    return;
+  }
+
+  auto        meas = metrics_collector.create_time_execution_measurer();
+  trace_point tp   = ofh_tracer.now();
+
+  uint64_t nof_bytes  = 0;
+  unsigned nof_frames = 0;
+  for (unsigned i_desc = 0; i_desc != nof_descs; ++i_desc) {
+    const ::xdp_desc& desc = rx_ring.get_consumer_entry(i_desc);
+    span<uint8_t>     data(socket->get_data(desc.addr), desc.len);
+    bool              is_last = (desc.options & XDP_PKT_CONTD) == 0;
+    nof_bytes += desc.len;
+
+    if (is_gathering || !is_last) {
+      append_fragment(data, is_last);
+      nof_frames += is_last;
+      continue;
+    }
+
+    notifier->on_new_frame(unique_rx_buffer(xdp_rx_buffer_impl(frame_pool, strip_vlan_tag(data))));
+    ++nof_frames;
+  }
+  rx_ring.release(nof_descs);
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, nof_frames);
+  ofh_tracer << trace_event("ofh_receiver", tp);
+}
+
+void xdp_receiver_impl::append_fragment(span<uint8_t> fragment, bool is_last)
+{
+  if (!is_gathering) {
+    is_gathering = true;
+    gather_size  = 0;
+    fragment     = strip_vlan_tag(fragment);
+
+    auto exp_buffer = buffer_pool.reserve();
+    if (exp_buffer) {
+      gather_buffer.emplace(std::move(*exp_buffer));
+    } else {
+      logger.warning("No buffer is available for receiving an Ethernet packet on the port bound to fd = '{}'",
+                     socket->get_fd());
+    }
+  }
+
+  if (gather_buffer) {
+    span<uint8_t> storage = gather_buffer->storage();
+    if (gather_size + fragment.size() <= storage.size()) {
+      std::memcpy(storage.data() + gather_size, fragment.data(), fragment.size());
+      gather_size += fragment.size();
+    } else {
+      logger.warning("Dropped received Ethernet frame exceeding '{}' bytes on the port bound to fd = '{}'",
+                     storage.size(),
+                     socket->get_fd());
+      gather_buffer.reset();
+    }
+  }
+
+  frame_pool.free(fragment.data());
+
+  if (!is_last) {
+    return;
+  }
+
+  is_gathering = false;
+  if (gather_buffer) {
+    gather_buffer->resize(gather_size);
+    notifier->on_new_frame(unique_rx_buffer(std::move(*gather_buffer)));
+    gather_buffer.reset();
+  }
+}
+
+receiver_metrics_collector* xdp_receiver_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
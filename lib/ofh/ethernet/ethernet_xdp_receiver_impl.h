@@ -0,0 +1,168 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_rx_buffer_pool.h"
+#include "ethernet_rx_metrics_collector_impl.h"
+#include "ethernet_xdp_program.h"
+#include "ethernet_xdp_socket.h"
+#include "ocudu/adt/mpmc_queue.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver_config.h"
+#include "ocudu/ofh/ethernet/ethernet_unique_buffer.h"
+#include "ocudu/support/ocudu_assert.h"
+#include "ocudu/support/synchronization/stop_event.h"
+#include <memory>
+#include <optional>
+
+namespace ocudu {
+
+class task_executor;
+
+namespace ether {
+
+/// Pool of the UMEM frames of an AF_XDP receive socket that are not owned by the kernel.
+class xdp_rx_frame_pool
+{
+  using frame_addr_list =
+      concurrent_queue<uint64_t, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>;
+
+public:
+  /// Constructor takes the socket owning the UMEM.
+  explicit xdp_rx_frame_pool(const xdp_socket& socket_) : socket(socket_), free_list(xdp_socket::NOF_RX_FRAMES) {}
+
+  /// Returns the UMEM frame containing the given data to the pool.
+  void free(const uint8_t* data)
+  {
+    uint64_t addr = socket.get_addr(data) & ~static_cast<uint64_t>(xdp_socket::FRAME_SIZE - 1);
+    while (!free_list.try_push(addr)) {
+    }
+  }
+
+  /// Tries to get the address of a free UMEM frame.
+  bool try_pop(uint64_t& addr) { return free_list.try_pop(addr); }
+
+private:
+  const xdp_socket& socket;
+  frame_addr_list   free_list;
+};
+
+/// Receive buffer wrapper pointing to a frame stored in the UMEM of an AF_XDP socket.
+class xdp_rx_buffer_impl : public rx_buffer
+{
+public:
+  /// Constructor takes the ownership of the UMEM frame containing the given data.
+  xdp_rx_buffer_impl(xdp_rx_frame_pool& pool_, span<const uint8_t> frame) :
+    pool(&pool_), frame_data(frame.data()), size(frame.size())
+  {
+  }
+
+  /// Destructor returns the UMEM frame to the pool.
+  ~xdp_rx_buffer_impl() override
+  {
+    if (pool != nullptr) {
+      pool->free(frame_data);
+    }
+  }
+
+  /// Copy constructor is deleted.
+  xdp_rx_buffer_impl(const xdp_rx_buffer_impl& other) = delete;
+
+  /// Copy assignment operator is deleted.
+  xdp_rx_buffer_impl& operator=(const xdp_rx_buffer_impl& other) = delete;
+
+  /// Move constructor.
+  xdp_rx_buffer_impl(xdp_rx_buffer_impl&& other) noexcept :
+    pool(other.pool), frame_data(other.frame_data), size(other.size)
+  {
+    other.pool = nullptr;
+  }
+
+  /// Move assignment operator is deleted.
+  xdp_rx_buffer_impl& operator=(xdp_rx_buffer_impl&& other) = delete;
+
+  // See interface for documentation.
+  span<const uint8_t> data() const override
+  {
+    ocudu_assert(pool != nullptr, "Invalid xdp_rx_buffer_impl accessed");
+    return {frame_data, size};
+  }
+
+private:
+  xdp_rx_frame_pool* pool;
+  const uint8_t*     frame_data;
+  unsigned           size;
+};
+
+/// \brief Ethernet receiver implementation based on an AF_XDP socket.
+///
+/// An XDP program steers the eCPRI frames received by the NIC to the socket, which stores them in a UMEM shared with
+/// the kernel. Frames fitting in a UMEM frame are notified without copying them, while frames spanning several UMEM
+/// frames are gathered in a buffer of an \ref ethernet_rx_buffer_pool. The socket may be shared with the transmitter of
+/// the same interface, and the NIC must receive all the frames in the queue the socket is bound to.
+class xdp_receiver_impl : public receiver, private receiver_operation_controller
+{
+  /// Maximum number of frames processed in a burst.
+  static constexpr unsigned MAX_BURST_SIZE = 64;
+  /// Size of the buffers gathering the frames that span several UMEM frames.
+  static constexpr unsigned BUFFER_SIZE = 9600;
+
+public:
+  xdp_receiver_impl(const receiver_config&      config,
+                    task_executor&              executor_,
+                    std::shared_ptr<xdp_socket> socket_,
+                    ocudulog::basic_logger&     logger_);
+
+  // See interface for documentation.
+  receiver_operation_controller& get_operation_controller() override { return *this; }
+
+  // See interface for documentation.
+  receiver_metrics_collector* get_metrics_collector() override;
+
+private:
+  // See interface for documentation.
+  void start(frame_notifier& notifier_) override;
+
+  // See interface for documentation.
+  void stop() override;
+
+  /// Main receiving loop.
+  void receive_loop();
+
+  /// Receives a burst of frames from the socket.
+  void receive();
+
+  /// Gives the free UMEM frames to the kernel.
+  void refill();
+
+  /// \brief Appends a fragment of a frame spanning several UMEM frames.
+  ///
+  /// The frame is notified once its last fragment is appended. The UMEM frame of the fragment is returned to the pool.
+  void append_fragment(span<uint8_t> fragment, bool is_last);
+
+  ocudulog::basic_logger&                logger;
+  task_executor&                         executor;
+  frame_notifier*                        notifier;
+  std::shared_ptr<xdp_socket>            socket;
+  xdp_program                            program;
+  xdp_rx_frame_pool                      frame_pool;
+  ethernet_rx_buffer_pool                buffer_pool;
+  std::optional<ethernet_rx_buffer_impl> gather_buffer;
+  unsigned                               gather_size  = 0;
+  bool                                   is_gathering = false;
+  rt_stop_event_source                   stop_manager;
+  receiver_metrics_collector_impl        metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
@@ -0,0 +1,165 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_xdp_socket.h"
+#include "ocudu/support/error_handling.h"
+#include <cstring>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+/// Number of attempts to bind a socket to a busy NIC queue.
+static constexpr unsigned BIND_NOF_RETRIES = 100;
+
+/// Maps the ring at the given page offset of the socket and initializes it.
+template <typename T>
+static bool map_ring(xdp_ring<T>& ring, int socket_fd, const ::xdp_ring_offset& offsets, unsigned size, off_t pgoff)
+{
+  size_t map_size = offsets.desc + size * sizeof(T);
+  void*  map      = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, socket_fd, pgoff);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+  ring.init(static_cast<uint8_t*>(map), map_size, offsets, size);
+  return true;
+}
+
+/// Unmaps the given ring, if it was mapped.
+template <typename T>
+static void unmap_ring(xdp_ring<T>& ring)
+{
+  if (ring.get_map() != nullptr) {
+    ::munmap(ring.get_map(), ring.get_map_size());
+  }
+}
+
+xdp_socket::xdp_socket(const std::string& interface, ocudulog::basic_logger& logger_) : logger(logger_)
+{
+  static_assert((NOF_RX_FRAMES & (NOF_RX_FRAMES - 1)) == 0, "The number of reception frames must be a power of two");
+  static_assert((NOF_TX_FRAMES & (NOF_TX_FRAMES - 1)) == 0, "The number of transmission frames must be a power of two");
+
+  ifindex = ::if_nametoindex(interface.c_str());
+  if (ifindex == 0) {
+    report_error("Unable to get index for NIC interface '{}' in the AF_XDP socket", interface);
+  }
+
+  socket_fd = ::socket(AF_XDP, SOCK_RAW, 0);
+  if (socket_fd < 0) {
+    report_error("Unable to open AF_XDP socket: {}", ::strerror(errno));
+  }
+
+  // Allocate and register the UMEM.
+  void* umem_map = ::mmap(nullptr, UMEM_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (umem_map == MAP_FAILED) {
+    report_error("Unable to allocate '{}' bytes of UMEM for the AF_XDP socket: {}", UMEM_SIZE, ::strerror(errno));
+  }
+  umem = static_cast<uint8_t*>(umem_map);
+
+  ::xdp_umem_reg umem_reg = {};
+  umem_reg.addr           = reinterpret_cast<uint64_t>(umem);
+  umem_reg.len            = UMEM_SIZE;
+  umem_reg.chunk_size     = FRAME_SIZE;
+  if (::setsockopt(socket_fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) < 0) {
+    report_error("Unable to register the UMEM of the AF_XDP socket: {}", ::strerror(errno));
+  }
+
+  // Set up the rings, each of them can hold all the UMEM frames used in its direction.
+  int rx_ring_size = NOF_RX_FRAMES;
+  int tx_ring_size = NOF_TX_FRAMES;
+  if (::setsockopt(socket_fd, SOL_XDP, XDP_UMEM_FILL_RING, &rx_ring_size, sizeof(rx_ring_size)) < 0 ||
+      ::setsockopt(socket_fd, SOL_XDP, XDP_RX_RING, &rx_ring_size, sizeof(rx_ring_size)) < 0 ||
+      ::setsockopt(socket_fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &tx_ring_size, sizeof(tx_ring_size)) < 0 ||
+      ::setsockopt(socket_fd, SOL_XDP, XDP_TX_RING, &tx_ring_size, sizeof(tx_ring_size)) < 0) {
+    report_error("Unable to set up the rings of the AF_XDP socket: {}", ::strerror(errno));
+  }
+
+  ::xdp_mmap_offsets offsets     = {};
+  ::socklen_t        offsets_len = sizeof(offsets);
+  if (::getsockopt(socket_fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_len) < 0) {
+    report_error("Unable to get the ring offsets of the AF_XDP socket: {}", ::strerror(errno));
+  }
+
+  bool mapped = map_ring(fill_ring, socket_fd, offsets.fr, NOF_RX_FRAMES, XDP_UMEM_PGOFF_FILL_RING) &&
+                map_ring(rx_ring, socket_fd, offsets.rx, NOF_RX_FRAMES, XDP_PGOFF_RX_RING) &&
+                map_ring(completion_ring, socket_fd, offsets.cr, NOF_TX_FRAMES, XDP_UMEM_PGOFF_COMPLETION_RING) &&
+                map_ring(tx_ring, socket_fd, offsets.tx, NOF_TX_FRAMES, XDP_PGOFF_TX_RING);
+  if (!mapped) {
+    report_error("Unable to map the rings of the AF_XDP socket: {}", ::strerror(errno));
+  }
+
+  // Prefer zero-copy with multi-buffer support, falling back to copy mode and single-buffer frames when the driver or
+  // the kernel do not support them.
+  static constexpr uint16_t flag_list[] = {XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY | XDP_USE_SG,
+                                           XDP_USE_NEED_WAKEUP | XDP_COPY | XDP_USE_SG,
+                                           XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY,
+                                           XDP_USE_NEED_WAKEUP | XDP_COPY};
+  const uint16_t* flags =
+      std::find_if(std::begin(flag_list), std::end(flag_list), [this](uint16_t f) { return try_bind(f); });
+  if (flags == std::end(flag_list)) {
+    report_error("Unable to bind the AF_XDP socket to queue '{}' of NIC interface '{}': {}",
+                 QUEUE_ID,
+                 interface,
+                 ::strerror(errno));
+  }
+  multi_buffer = (*flags & XDP_USE_SG) != 0;
+
+  logger.info("Opened AF_XDP socket (fd = '{}') on queue '{}' of NIC interface '{}' in {} mode{}",
+              socket_fd,
+              QUEUE_ID,
+              interface,
+              (*flags & XDP_ZEROCOPY) ? "zero-copy" : "copy",
+              multi_buffer ? " with multi-buffer support" : "");
+}
+
+xdp_socket::~xdp_socket()
+{
+  unmap_ring(rx_ring);
+  unmap_ring(tx_ring);
+  unmap_ring(fill_ring);
+  unmap_ring(completion_ring);
+  ::close(socket_fd);
+  ::munmap(umem, UMEM_SIZE);
+}
+
+bool xdp_socket::try_bind(uint16_t flags)
+{
+  ::sockaddr_xdp address = {};
+  address.sxdp_family    = AF_XDP;
+  address.sxdp_flags     = flags;
+  address.sxdp_ifindex   = ifindex;
+  address.sxdp_queue_id  = QUEUE_ID;
+
+  // The kernel releases the queue of a closed AF_XDP socket asynchronously, so retry while the queue is busy.
+  for (unsigned i_retry = 0; i_retry != BIND_NOF_RETRIES; ++i_retry) {
+    if (::bind(socket_fd, reinterpret_cast<::sockaddr*>(&address), sizeof(address)) == 0) {
+      return true;
+    }
+    if (errno != EBUSY) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+uint64_t xdp_socket::get_nof_dropped_frames() const
+{
+  ::xdp_statistics stats     = {};
+  ::socklen_t      stats_len = sizeof(stats);
+  if (::getsockopt(socket_fd, SOL_XDP, XDP_STATISTICS, &stats, &stats_len) < 0) {
+    return 0;
+  }
+  return stats.rx_dropped + stats.rx_ring_full;
+}
@@ -0,0 +1,213 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/ocudulog/logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <linux/if_xdp.h>
+#include <string>
+
+// Definitions introduced by the AF_XDP multi-buffer support, missing in older kernel headers.
+#ifndef XDP_USE_SG
+#define XDP_USE_SG (1 << 4)
+#endif
+#ifndef XDP_PKT_CONTD
+#define XDP_PKT_CONTD (1 << 0)
+#endif
+
+namespace ocudu {
+namespace ether {
+
+/// \brief Ring shared between the application and the kernel by an AF_XDP socket.
+///
+/// The ring is used either as a producer (fill and transmit rings) or as a consumer (receive and completion rings) by
+/// the application, never as both.
+template <typename T>
+class xdp_ring
+{
+public:
+  /// Sets up the ring from the memory-mapped area and its offsets.
+  void init(uint8_t* map_, size_t map_size_, const ::xdp_ring_offset& offsets, unsigned size_)
+  {
+    map         = map_;
+    map_size    = map_size_;
+    producer    = reinterpret_cast<uint32_t*>(map + offsets.producer);
+    consumer    = reinterpret_cast<uint32_t*>(map + offsets.consumer);
+    flags       = reinterpret_cast<uint32_t*>(map + offsets.flags);
+    entries     = reinterpret_cast<T*>(map + offsets.desc);
+    size        = size_;
+    mask        = size_ - 1;
+    cached_prod = __atomic_load_n(producer, __ATOMIC_ACQUIRE);
+    cached_cons = __atomic_load_n(consumer, __ATOMIC_ACQUIRE);
+  }
+
+  /// Returns the memory-mapped area of the ring.
+  uint8_t* get_map() const { return map; }
+
+  /// Returns the size of the memory-mapped area of the ring.
+  size_t get_map_size() const { return map_size; }
+
+  /// Returns true if the kernel has to be woken up to process the ring.
+  bool needs_wakeup() const { return __atomic_load_n(flags, __ATOMIC_RELAXED) & XDP_RING_NEED_WAKEUP; }
+
+  /// Returns the number of entries, up to \c nof_entries, that can be produced.
+  unsigned get_nof_free(unsigned nof_entries)
+  {
+    unsigned nof_free = size - (cached_prod - cached_cons);
+    if (nof_free < nof_entries) {
+      cached_cons = __atomic_load_n(consumer, __ATOMIC_ACQUIRE);
+      nof_free    = size - (cached_prod - cached_cons);
+    }
+    return std::min(nof_free, nof_entries);
+  }
+
+  /// Returns the number of produced entries that the kernel has not consumed yet.
+  unsigned get_nof_pending()
+  {
+    cached_cons = __atomic_load_n(consumer, __ATOMIC_ACQUIRE);
+    return cached_prod - cached_cons;
+  }
+
+  /// Returns the i-th entry to produce.
+  T& get_producer_entry(unsigned i) { return entries[(cached_prod + i) & mask]; }
+
+  /// Hands the given number of produced entries over to the kernel.
+  void submit(unsigned nof_entries)
+  {
+    cached_prod += nof_entries;
+    __atomic_store_n(producer, cached_prod, __ATOMIC_RELEASE);
+  }
+
+  /// Returns the number of entries, up to \c nof_entries, that are available for consumption.
+  unsigned get_nof_available(unsigned nof_entries)
+  {
+    unsigned nof_available = cached_prod - cached_cons;
+    if (nof_available == 0) {
+      cached_prod   = __atomic_load_n(producer, __ATOMIC_ACQUIRE);
+      nof_available = cached_prod - cached_cons;
+    }
+    return std::min(nof_available, nof_entries);
+  }
+
+  /// Returns the i-th entry to consume.
+  const T& get_consumer_entry(unsigned i) const { return entries[(cached_cons + i) & mask]; }
+
+  /// Hands the given number of consumed entries back to the kernel.
+  void release(unsigned nof_entries)
+  {
+    cached_cons += nof_entries;
+    __atomic_store_n(consumer, cached_cons, __ATOMIC_RELEASE);
+  }
+
+private:
+  uint8_t*  map         = nullptr;
+  size_t    map_size    = 0;
+  uint32_t* producer    = nullptr;
+  uint32_t* consumer    = nullptr;
+  uint32_t* flags       = nullptr;
+  T*        entries     = nullptr;
+  uint32_t  size        = 0;
+  uint32_t  mask        = 0;
+  uint32_t  cached_prod = 0;
+  uint32_t  cached_cons = 0;
+};
+
+/// \brief AF_XDP socket bound to a queue of a NIC, together with its UMEM.
+///
+/// The UMEM is a memory area divided in frames of \ref FRAME_SIZE bytes shared with the kernel. Frames larger than a
+/// UMEM frame are split across several consecutive descriptors when the kernel supports AF_XDP multi-buffer.
+///
+/// A NIC queue only accepts one socket per UMEM, so the socket has both receive and transmit rings to be shared by the
+/// receiver and the transmitter of an interface. The first \ref NOF_RX_FRAMES UMEM frames are used for reception and
+/// the following \ref NOF_TX_FRAMES for transmission.
+class xdp_socket
+{
+public:
+  /// Size of a UMEM frame in bytes.
+  static constexpr unsigned FRAME_SIZE = 4096;
+  /// Number of UMEM frames used for reception, must be a power of two.
+  static constexpr unsigned NOF_RX_FRAMES = 4096;
+  /// Number of UMEM frames used for transmission, must be a power of two.
+  static constexpr unsigned NOF_TX_FRAMES = 4096;
+  /// NIC queue the socket is bound to.
+  static constexpr unsigned QUEUE_ID = 0;
+
+  /// \brief Creates the socket and its UMEM and binds them to the queue \ref QUEUE_ID of the NIC.
+  ///
+  /// \param[in] interface NIC interface name.
+  /// \param[in] logger_   Logger.
+  xdp_socket(const std::string& interface, ocudulog::basic_logger& logger_);
+
+  ~xdp_socket();
+
+  xdp_socket(const xdp_socket&)            = delete;
+  xdp_socket& operator=(const xdp_socket&) = delete;
+
+  /// Returns the socket file descriptor.
+  int get_fd() const { return socket_fd; }
+
+  /// Returns the NIC interface index.
+  unsigned get_ifindex() const { return ifindex; }
+
+  /// Returns true if frames larger than a UMEM frame can be transferred.
+  bool is_multi_buffer_enabled() const { return multi_buffer; }
+
+  /// Returns the UMEM address of the given reception frame.
+  static uint64_t get_rx_frame_addr(unsigned i_frame) { return static_cast<uint64_t>(i_frame) * FRAME_SIZE; }
+
+  /// Returns the UMEM address of the given transmission frame.
+  static uint64_t get_tx_frame_addr(unsigned i_frame)
+  {
+    return static_cast<uint64_t>(NOF_RX_FRAMES + i_frame) * FRAME_SIZE;
+  }
+
+  /// Returns a pointer to the UMEM data at the given address.
+  uint8_t* get_data(uint64_t addr) const { return umem + addr; }
+
+  /// Returns the UMEM address of the given data pointer.
+  uint64_t get_addr(const uint8_t* data) const { return data - umem; }
+
+  /// Fill ring, used to give UMEM frames to the kernel for reception.
+  xdp_ring<uint64_t>& get_fill_ring() { return fill_ring; }
+
+  /// Completion ring, used by the kernel to give back transmitted UMEM frames.
+  xdp_ring<uint64_t>& get_completion_ring() { return completion_ring; }
+
+  /// Receive ring.
+  xdp_ring<::xdp_desc>& get_rx_ring() { return rx_ring; }
+
+  /// Transmit ring.
+  xdp_ring<::xdp_desc>& get_tx_ring() { return tx_ring; }
+
+  /// Returns the number of frames dropped by the kernel for this socket.
+  uint64_t get_nof_dropped_frames() const;
+
+private:
+  /// Size of the UMEM in bytes.
+  static constexpr size_t UMEM_SIZE = static_cast<size_t>(NOF_RX_FRAMES + NOF_TX_FRAMES) * FRAME_SIZE;
+
+  /// Binds the socket to the NIC queue with the given flags, returns true on success.
+  bool try_bind(uint16_t flags);
+
+  ocudulog::basic_logger& logger;
+  int                     socket_fd    = -1;
+  unsigned                ifindex      = 0;
+  bool                    multi_buffer = false;
+  uint8_t*                umem         = nullptr;
+  xdp_ring<uint64_t>      fill_ring;
+  xdp_ring<uint64_t>      completion_ring;
+  xdp_ring<::xdp_desc>    rx_ring;
+  xdp_ring<::xdp_desc>    tx_ring;
+};
+
+} // namespace ether
+} // namespace ocudu
@@ -0,0 +1,183 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ethernet_xdp_transmitter_impl.h"
+#include "ethernet_constants.h"
+#include "ocudu/support/error_handling.h"
+#include "ocudu/support/math/math_utils.h"
+#include "ocudu/support/ocudu_assert.h"
+#include <cstring>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ether;
+
+/// Sets the MTU of the given NIC interface.
+static void set_mtu(const std::string& interface, units::bytes mtu_size, ocudulog::basic_logger& logger)
+{
+  int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    report_error("Unable to open socket for setting the MTU of NIC interface '{}': {}", interface, ::strerror(errno));
+  }
+
+  ::ifreq if_idx = {};
+  ::strncpy(if_idx.ifr_name, interface.c_str(), IFNAMSIZ - 1);
+  if_idx.ifr_mtu = mtu_size.value();
+  if (::ioctl(fd, SIOCSIFMTU, &if_idx) < 0) {
+    // Get the MTU size of the NIC.
+    int current_mtu = -1;
+    if (::ioctl(fd, SIOCGIFMTU, &if_idx) < 0) {
+      logger.warning("Could not check MTU of the NIC interface '{}' in the Ethernet transmitter", interface);
+    } else {
+      current_mtu = if_idx.ifr_mtu;
+    }
+    report_error(
+        "Unable to set MTU size to '{}' bytes for NIC interface '{}' in the Ethernet transmitter, current MTU size "
+        "set to '{}' bytes",
+        mtu_size,
+        interface,
+        current_mtu);
+  }
+  ::close(fd);
+}
+
+xdp_transmitter_impl::xdp_transmitter_impl(const transmitter_config&   config,
+                                           std::shared_ptr<xdp_socket> socket_,
+                                           ocudulog::basic_logger&     logger_) :
+  logger(logger_), socket(std::move(socket_)), metrics_collector(config.are_metrics_enabled)
+{
+  ocudu_assert(socket, "Invalid AF_XDP socket");
+
+  set_mtu(config.interface, config.mtu_size, logger);
+
+  if (!socket->is_multi_buffer_enabled() &&
+      (config.mtu_size + ETH_HEADER_SIZE + ETH_VLAN_TAG_SIZE).value() > xdp_socket::FRAME_SIZE) {
+    report_error("The MTU size of '{}' bytes requires AF_XDP multi-buffer support, which is not available for NIC "
+                 "interface '{}'",
+                 config.mtu_size,
+                 config.interface);
+  }
+
+  free_frames.reserve(xdp_socket::NOF_TX_FRAMES);
+  for (unsigned i_frame = 0; i_frame != xdp_socket::NOF_TX_FRAMES; ++i_frame) {
+    free_frames.push_back(xdp_socket::get_tx_frame_addr(i_frame));
+  }
+
+  logger.info("Opened successfully the NIC interface '{}' (fd = '{}') used by the AF_XDP Ethernet transmitter",
+              config.interface,
+              socket->get_fd());
+}
+
+void xdp_transmitter_impl::reclaim()
+{
+  xdp_ring<uint64_t>& completion_ring = socket->get_completion_ring();
+
+  unsigned nof_completed = completion_ring.get_nof_available(xdp_socket::NOF_TX_FRAMES);
+  for (unsigned i_frame = 0; i_frame != nof_completed; ++i_frame) {
+    free_frames.push_back(completion_ring.get_consumer_entry(i_frame));
+  }
+  completion_ring.release(nof_completed);
+}
+
+void xdp_transmitter_impl::flush()
+{
+  xdp_ring<::xdp_desc>& tx_ring = socket->get_tx_ring();
+
+  // In copy mode the kernel only transmits a limited batch of descriptors per system call, so keep waking it up until
+  // the ring is drained.
+  for (unsigned i_attempt = 0; i_attempt != MAX_FLUSH_ATTEMPTS && tx_ring.needs_wakeup() && tx_ring.get_nof_pending();
+       ++i_attempt) {
+    if (::sendto(socket->get_fd(), nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0 && errno != EAGAIN && errno != EBUSY &&
+        errno != ENOBUFS) {
+      logger.warning("Ethernet transmitter with fd = '{}' could not flush the transmit ring: {}",
+                     socket->get_fd(),
+                     ::strerror(errno));
+      return;
+    }
+  }
+}
+
+void xdp_transmitter_impl::send(span<span<const uint8_t>> frames)
+{
+  auto meas = metrics_collector.create_time_execution_measurer();
+
+  xdp_ring<::xdp_desc>& tx_ring = socket->get_tx_ring();
+
+  reclaim();
+
+  uint64_t nof_bytes       = 0;
+  unsigned nof_written     = 0;
+  unsigned nof_descriptors = 0;
+
+  // Returns true if the ring and the UMEM have room for the given number of additional fragments.
+  auto has_room = [this, &tx_ring, &nof_descriptors](unsigned nof_fragments) {
+    unsigned nof_required = nof_descriptors + nof_fragments;
+    return (free_frames.size() >= nof_fragments) && (tx_ring.get_nof_free(nof_required) == nof_required);
+  };
+
+  for (auto frame : frames) {
+    unsigned nof_fragments = divide_ceil(frame.size(), xdp_socket::FRAME_SIZE);
+    if (nof_fragments > 1 && !socket->is_multi_buffer_enabled()) {
+      logger.warning("Ethernet transmitter with fd = '{}' could not transmit '{}' bytes, the frame exceeds the "
+                     "AF_XDP frame size",
+                     socket->get_fd(),
+                     frame.size());
+      continue;
+    }
+
+    // Make room for the frame, handing the pending descriptors over to the kernel if needed.
+    if (!has_room(nof_fragments)) {
+      tx_ring.submit(nof_descriptors);
+      nof_descriptors = 0;
+      flush();
+      reclaim();
+      if (!has_room(nof_fragments)) {
+        logger.warning("Ethernet transmitter with fd = '{}' could not transmit '{}' bytes, the transmit ring is full",
+                       socket->get_fd(),
+                       frame.size());
+        continue;
+      }
+    }
+
+    for (unsigned i_fragment = 0; i_fragment != nof_fragments; ++i_fragment) {
+      unsigned            offset   = i_fragment * xdp_socket::FRAME_SIZE;
+      unsigned            length   = std::min<unsigned>(xdp_socket::FRAME_SIZE, frame.size() - offset);
+      span<const uint8_t> fragment = frame.subspan(offset, length);
+
+      uint64_t addr = free_frames.back();
+      free_frames.pop_back();
+      std::memcpy(socket->get_data(addr), fragment.data(), fragment.size());
+
+      ::xdp_desc& desc = tx_ring.get_producer_entry(nof_descriptors++);
+      desc.addr        = addr;
+      desc.len         = fragment.size();
+      desc.options     = (i_fragment + 1 != nof_fragments) ? XDP_PKT_CONTD : 0;
+    }
+
+    nof_bytes += frame.size();
+    ++nof_written;
+  }
+
+  // Hand over the whole burst to the kernel with a single system call.
+  if (nof_descriptors != 0) {
+    tx_ring.submit(nof_descriptors);
+    flush();
+  }
+
+  metrics_collector.update_stats(meas.stop(), nof_bytes, nof_written);
+}
+
+transmitter_metrics_collector* xdp_transmitter_impl::get_metrics_collector()
+{
+  return metrics_collector.disabled() ? nullptr : &metrics_collector;
+}
@@ -0,0 +1,59 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ethernet_tx_metrics_collector_impl.h"
+#include "ethernet_xdp_socket.h"
+#include "ocudu/ocudulog/logger.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter_config.h"
+#include <memory>
+#include <vector>
+
+namespace ocudu {
+namespace ether {
+
+/// \brief Ethernet transmitter implementation based on an AF_XDP socket.
+///
+/// The frames of a burst are written in the UMEM of the socket and handed over to the kernel with a single system call.
+/// Frames larger than a UMEM frame are split across several UMEM frames. The socket may be shared with the receiver of
+/// the same interface.
+class xdp_transmitter_impl : public transmitter
+{
+  /// Maximum number of system calls issued to flush a burst.
+  static constexpr unsigned MAX_FLUSH_ATTEMPTS = 256;
+
+public:
+  xdp_transmitter_impl(const transmitter_config&   config,
+                       std::shared_ptr<xdp_socket> socket_,
+                       ocudulog::basic_logger&     logger_);
+
+  // See interface for documentation.
+  void send(span<span<const uint8_t>> frames) override;
+
+  // See interface for documentation.
+  transmitter_metrics_collector* get_metrics_collector() override;
+
+private:
+  /// Takes back the UMEM frames of the transmissions completed by the kernel.
+  void reclaim();
+
+  /// Requests the kernel to transmit the frames written in the transmit ring.
+  void flush();
+
+  ocudulog::basic_logger&            logger;
+  std::shared_ptr<xdp_socket>        socket;
+  std::vector<uint64_t>              free_frames;
+  transmitter_metrics_collector_impl metrics_collector;
+};
+
+} // namespace ether
+} // namespace ocudu
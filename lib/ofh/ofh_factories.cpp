@@ -12,6 +12,7 @@
 #include "ofh_sector_impl.h"
 #include "receiver/ofh_receiver_factories.h"
 #include "receiver/ofh_sequence_id_checker_impl.h"
+#include "timing/ofh_timing_clock_impl.h"
 #include "timing/ofh_timing_manager_impl.h"
 #include "transmitter/ofh_transmitter_factories.h"
 #include "ocudu/ofh/ethernet/ethernet_factories.h"
@@ -34,8 +35,16 @@ std::unique_ptr<timing_manager> ocudu::ofh::create_ofh_timing_manager(const cont
 {
   realtime_worker_cfg rt_cfg = {
       config.cp, config.scs, config.gps_Alpha, config.gps_Beta, config.enable_log_warnings_for_lates};
+  rt_cfg.spin_margin = config.timing_spin_margin;
 
-  return std::make_unique<timing_manager_impl>(logger, executor, rt_cfg);
+  std::unique_ptr<timing_clock> clock;
+  if (config.ptp_clock_device.empty()) {
+    clock = std::make_unique<system_timing_clock>();
+  } else {
+    clock = std::make_unique<ptp_timing_clock>(logger, config.ptp_clock_device, config.ptp_clock_utc_offset);
+  }
+
+  return std::make_unique<timing_manager_impl>(logger, executor, std::move(clock), rt_cfg);
 }
 
 static receiver_config generate_receiver_config(const sector_configuration& config)
@@ -103,6 +112,7 @@ static transmitter_config generate_transmitter_config(const sector_configuration
   tx_config.are_metrics_enabled                  = sector_cfg.are_metrics_enabled;
   tx_config.c_plane_prach_fft_len                = sector_cfg.c_plane_prach_fft_len;
   tx_config.enable_log_warnings_for_lates        = sector_cfg.enable_log_warnings_for_lates;
+  tx_config.nof_tx_batches_per_symbol            = sector_cfg.nof_tx_batches_per_symbol;
 
   return tx_config;
 }
@@ -126,10 +136,10 @@ create_dpdk_txrx(const sector_configuration& sector_cfg, task_executor& rx_execu
 static std::pair<std::unique_ptr<ether::transmitter>, std::unique_ptr<ether::receiver>>
 create_socket_txrx(const sector_configuration& sector_cfg, task_executor& rx_executor, ocudulog::basic_logger& logger)
 {
-  auto eth_receiver_config = ether::receiver_config{
-      sector_cfg.interface, sector_cfg.is_promiscuous_mode_enabled, sector_cfg.are_metrics_enabled};
-
-  auto rx = ether::create_receiver(eth_receiver_config, rx_executor, logger);
+  auto eth_receiver_config = ether::receiver_config{sector_cfg.interface,
+                                                    sector_cfg.is_promiscuous_mode_enabled,
+                                                    sector_cfg.are_metrics_enabled,
+                                                    sector_cfg.socket_mode};
 
   ether::transmitter_config eth_cfg;
   eth_cfg.interface                   = sector_cfg.interface;
@@ -137,9 +147,9 @@ create_socket_txrx(const sector_configuration& sector_cfg, task_executor& rx_exe
   eth_cfg.are_metrics_enabled         = sector_cfg.are_metrics_enabled;
   eth_cfg.mtu_size                    = sector_cfg.mtu_size;
   eth_cfg.mac_dst_address             = sector_cfg.mac_dst_address;
-  auto tx                             = ether::create_transmitter(eth_cfg, logger);
+  eth_cfg.mode                        = sector_cfg.socket_mode;
 
-  return {std::move(tx), std::move(rx)};
+  return ether::create_txrx(eth_cfg, eth_receiver_config, rx_executor, logger);
 }
 
 static std::pair<std::unique_ptr<ether::transmitter>, std::unique_ptr<ether::receiver>>
@@ -191,10 +201,15 @@ std::unique_ptr<sector> ocudu::ofh::create_ofh_sector(const sector_configuration
   ether::receiver&    eth_receiver    = *eth_txrx.second;
 
   // Build the OFH receiver.
+  std::vector<task_executor*> uplink_executors = {sector_deps.uplink_executor};
+  uplink_executors.insert(uplink_executors.end(),
+                          sector_deps.additional_uplink_executors.begin(),
+                          sector_deps.additional_uplink_executors.end());
+
   auto rx_config = generate_receiver_config(sector_cfg);
   auto receiver  = create_receiver(rx_config,
                                   *sector_deps.logger,
-                                  *sector_deps.uplink_executor,
+                                  uplink_executors,
                                   std::move(eth_txrx.second),
                                   sector_deps.notifier,
                                   ul_prach_repo,
@@ -67,8 +67,9 @@ public:
   /// Starts logging unreceived OFH messages.
   void start_logging_unreceived_messages()
   {
-    if (warn_unreceived_frames == warn_unreceived_ru_frames::after_traffic_detection && !log_unreceived_messages) {
-      log_unreceived_messages = true;
+    if (warn_unreceived_frames == warn_unreceived_ru_frames::after_traffic_detection &&
+        !log_unreceived_messages.load(std::memory_order_relaxed)) {
+      log_unreceived_messages.store(true, std::memory_order_relaxed);
     }
   }
 
@@ -96,7 +97,7 @@ private:
   const unsigned                             notification_delay_in_symbols;
   const unsigned                             sector_id;
   const warn_unreceived_ru_frames            warn_unreceived_frames;
-  bool                                       log_unreceived_messages;
+  std::atomic<bool>                          log_unreceived_messages;
   ocudulog::basic_logger&                    logger;
   task_executor&                             executor;
   std::shared_ptr<prach_context_repository>  prach_repo;
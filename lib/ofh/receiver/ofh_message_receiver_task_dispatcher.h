@@ -12,28 +12,68 @@
 
 #include "ofh_message_receiver.h"
 #include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/ecpri/ecpri_constants.h"
 #include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_mac_address.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ofh_constants.h"
 #include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/synchronization/stop_event.h"
+#include <array>
 
 namespace ocudu {
 namespace ofh {
 
-/// Open Fronthaul message receiver interface implementation that dispatches tasks to the actual receiver.
+/// Open Fronthaul message receiver lane, made of a message receiver and the executor where it runs.
+struct message_receiver_lane {
+  /// Message receiver of the lane.
+  message_receiver* receiver = nullptr;
+  /// Task executor of the lane.
+  task_executor* executor = nullptr;
+};
+
+/// \brief Open Fronthaul message receiver interface implementation that dispatches tasks to the actual receivers.
+///
+/// The received frames are steered to the receiver lanes by eAxC, so that the messages of an eAxC are always processed
+/// in order by the same lane while different eAxCs are decoded in parallel. The configured uplink and PRACH eAxCs are
+/// distributed among the lanes in round-robin. Frames with an unknown or invalid eAxC are dispatched to the first lane,
+/// which filters them.
 class ofh_message_receiver_task_dispatcher : public message_receiver, public operation_controller
 {
+  /// Byte offset of the eCPRI PC_ID field, which carries the eAxC, within a received Ethernet frame. The VLAN tag is
+  /// stripped by the NIC.
+  static constexpr unsigned EAXC_BYTE_OFFSET = ether::ETH_ADDR_LEN * 2U + 2U + ecpri::ECPRI_COMMON_HEADER_SIZE.value();
+
 public:
-  ofh_message_receiver_task_dispatcher(ocudulog::basic_logger&          logger_,
-                                       message_receiver&                msg_receiver_,
-                                       task_executor&                   executor_,
-                                       unsigned                         sector_,
-                                       std::unique_ptr<ether::receiver> eth_receiver_) :
-    logger(logger_),
-    msg_receiver(msg_receiver_),
-    executor(executor_),
-    sector(sector_),
-    eth_receiver(std::move(eth_receiver_))
+  ofh_message_receiver_task_dispatcher(ocudulog::basic_logger&            logger_,
+                                       std::vector<message_receiver_lane> lanes_,
+                                       span<const unsigned>               ul_eaxc,
+                                       span<const unsigned>               prach_eaxc,
+                                       unsigned                           sector_,
+                                       std::unique_ptr<ether::receiver>   eth_receiver_) :
+    logger(logger_), lanes(std::move(lanes_)), sector(sector_), eth_receiver(std::move(eth_receiver_))
   {
     ocudu_assert(eth_receiver, "Invalid Ethernet receiver");
+    ocudu_assert(!lanes.empty(), "No message receiver lanes");
+    ocudu_assert(lanes.size() <= MAX_SUPPORTED_EAXC_ID_VALUE, "Too many message receiver lanes");
+    for (const auto& lane : lanes) {
+      ocudu_assert(lane.receiver && lane.executor, "Invalid message receiver lane");
+    }
+
+    // Distribute the configured eAxCs among the lanes.
+    eaxc_to_lane.fill(0);
+    std::array<bool, MAX_SUPPORTED_EAXC_ID_VALUE> is_assigned = {};
+    unsigned                                      next_lane   = 0;
+    for (span<const unsigned> eaxcs : {ul_eaxc, prach_eaxc}) {
+      for (unsigned eaxc : eaxcs) {
+        if (eaxc >= MAX_SUPPORTED_EAXC_ID_VALUE || is_assigned[eaxc]) {
+          continue;
+        }
+        is_assigned[eaxc]  = true;
+        eaxc_to_lane[eaxc] = next_lane;
+        next_lane          = (next_lane + 1) % lanes.size();
+      }
+    }
   }
 
   // See interface for documentation.
@@ -62,21 +102,37 @@ public:
       return;
     }
 
-    if (!executor.defer([this, buff = std::move(buffer), tk = std::move(token)]() mutable {
-          msg_receiver.on_new_frame(std::move(buff));
-        })) {
+    const message_receiver_lane& lane = lanes[get_lane_index(buffer.data())];
+    if (!lane.executor->defer(
+            [receiver = lane.receiver, buff = std::move(buffer), tk = std::move(token)]() mutable {
+              receiver->on_new_frame(std::move(buff));
+            })) {
       logger.warning("Failed to dispatch receiver task for sector#{}", sector);
     }
   }
 
   // See interface for the documentation.
-  message_receiver_metrics_collector* get_metrics_collector() override { return msg_receiver.get_metrics_collector(); }
+  message_receiver_metrics_collector* get_metrics_collector() override
+  {
+    return lanes.front().receiver->get_metrics_collector();
+  }
 
 private:
-  ocudulog::basic_logger&          logger;
-  message_receiver&                msg_receiver;
-  task_executor&                   executor;
-  const unsigned                   sector;
+  /// Returns the index of the lane that processes the given Ethernet frame.
+  unsigned get_lane_index(span<const uint8_t> frame) const
+  {
+    if (lanes.size() == 1 || frame.size() < EAXC_BYTE_OFFSET + 2U) {
+      return 0;
+    }
+
+    unsigned eaxc = (static_cast<unsigned>(frame[EAXC_BYTE_OFFSET]) << 8U) | frame[EAXC_BYTE_OFFSET + 1U];
+    return (eaxc < MAX_SUPPORTED_EAXC_ID_VALUE) ? eaxc_to_lane[eaxc] : 0;
+  }
+
+  ocudulog::basic_logger&                          logger;
+  const std::vector<message_receiver_lane>         lanes;
+  std::array<uint8_t, MAX_SUPPORTED_EAXC_ID_VALUE> eaxc_to_lane;
+  const unsigned                                   sector;
   std::unique_ptr<ether::receiver> eth_receiver;
   rt_stop_event_source             stop_manager;
 };
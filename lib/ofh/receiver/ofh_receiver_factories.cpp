@@ -18,6 +18,7 @@
 #include "ocudu/ofh/ecpri/ecpri_factories.h"
 #include "ocudu/ofh/ethernet/ethernet_factories.h"
 #include "ocudu/ofh/serdes/ofh_serdes_factories.h"
+#include <algorithm>
 
 using namespace ocudu;
 using namespace ofh;
@@ -104,7 +105,7 @@ create_uplink_data_flow(const receiver_config&                            receiv
 static receiver_impl_dependencies
 resolve_receiver_dependencies(const receiver_config&                                  receiver_cfg,
                               ocudulog::basic_logger&                                 logger,
-                              task_executor&                                          uplink_executor,
+                              span<task_executor* const>                              uplink_executors,
                               std::unique_ptr<ether::receiver>                        eth_receiver,
                               uplane_rx_symbol_notifier*                              notifier,
                               std::shared_ptr<prach_context_repository>               prach_context_repo,
@@ -114,10 +115,15 @@ resolve_receiver_dependencies(const receiver_config&
                               std::shared_ptr<uplink_notified_grid_symbol_repository> notifier_symbol_repo)
 {
   ocudu_assert(notifier, "Invalid received symbol notifier");
+  ocudu_assert(!uplink_executors.empty(), "No uplink executors");
+  ocudu_assert(std::all_of(uplink_executors.begin(),
+                           uplink_executors.end(),
+                           [](const task_executor* executor) { return executor != nullptr; }),
+               "Invalid uplink executor");
 
   receiver_impl_dependencies dependencies;
   dependencies.logger           = &logger;
-  dependencies.executor         = &uplink_executor;
+  dependencies.executor         = uplink_executors.front();
   dependencies.symbol_reorderer = std::make_shared<rx_symbol_reorderer>(*notifier, std::move(notifier_symbol_repo));
 
   auto& rx_window_handler_dependencies       = dependencies.window_handler_dependencies;
@@ -125,33 +131,31 @@ resolve_receiver_dependencies(const receiver_config&
   rx_window_handler_dependencies.uplink_repo = ul_slot_context_repo;
   rx_window_handler_dependencies.notifier    = dependencies.symbol_reorderer;
 
-  auto& msg_rx_dependencies  = dependencies.msg_rx_dependencies;
-  msg_rx_dependencies.logger = &logger;
-
-  if (receiver_cfg.ignore_ecpri_payload_size_field) {
-    msg_rx_dependencies.ecpri_decoder =
-        ecpri::create_ecpri_packet_decoder_ignoring_payload_size(logger, receiver_cfg.sector);
-  } else {
-    msg_rx_dependencies.ecpri_decoder =
-        ecpri::create_ecpri_packet_decoder_using_payload_size(logger, receiver_cfg.sector);
+  // Create one message receiver per uplink executor.
+  for (task_executor* executor : uplink_executors) {
+    auto& msg_rx_dependencies    = dependencies.msg_rx_dependencies.emplace_back();
+    msg_rx_dependencies.logger   = &logger;
+    msg_rx_dependencies.executor = executor;
+
+    if (receiver_cfg.ignore_ecpri_payload_size_field) {
+      msg_rx_dependencies.ecpri_decoder =
+          ecpri::create_ecpri_packet_decoder_ignoring_payload_size(logger, receiver_cfg.sector);
+    } else {
+      msg_rx_dependencies.ecpri_decoder =
+          ecpri::create_ecpri_packet_decoder_using_payload_size(logger, receiver_cfg.sector);
+    }
+    msg_rx_dependencies.eth_frame_decoder = ether::create_vlan_frame_decoder(logger, receiver_cfg.sector);
+
+    msg_rx_dependencies.data_flow_uplink = create_uplink_data_flow(
+        receiver_cfg, logger, dependencies.symbol_reorderer, ul_slot_context_repo, ul_cp_context_repo);
+    msg_rx_dependencies.data_flow_prach = create_uplink_prach_data_flow(
+        receiver_cfg, logger, dependencies.symbol_reorderer, prach_context_repo, prach_cp_context_repo);
+
+    msg_rx_dependencies.seq_id_checker =
+        (receiver_cfg.ignore_ecpri_seq_id_field)
+            ? static_cast<std::unique_ptr<sequence_id_checker>>(std::make_unique<sequence_id_checker_dummy_impl>())
+            : static_cast<std::unique_ptr<sequence_id_checker>>(std::make_unique<sequence_id_checker_impl>());
   }
-  msg_rx_dependencies.eth_frame_decoder = ether::create_vlan_frame_decoder(logger, receiver_cfg.sector);
-
-  msg_rx_dependencies.data_flow_uplink = create_uplink_data_flow(receiver_cfg,
-                                                                 logger,
-                                                                 dependencies.symbol_reorderer,
-                                                                 std::move(ul_slot_context_repo),
-                                                                 std::move(ul_cp_context_repo));
-  msg_rx_dependencies.data_flow_prach  = create_uplink_prach_data_flow(receiver_cfg,
-                                                                      logger,
-                                                                      dependencies.symbol_reorderer,
-                                                                      std::move(prach_context_repo),
-                                                                      std::move(prach_cp_context_repo));
-
-  msg_rx_dependencies.seq_id_checker =
-      (receiver_cfg.ignore_ecpri_seq_id_field)
-          ? static_cast<std::unique_ptr<sequence_id_checker>>(std::make_unique<sequence_id_checker_dummy_impl>())
-          : static_cast<std::unique_ptr<sequence_id_checker>>(std::make_unique<sequence_id_checker_impl>());
 
   dependencies.eth_receiver = std::move(eth_receiver);
 
@@ -161,7 +165,7 @@ resolve_receiver_dependencies(const receiver_config&
 std::unique_ptr<receiver>
 ocudu::ofh::create_receiver(const receiver_config&                                  receiver_cfg,
                             ocudulog::basic_logger&                                 logger,
-                            task_executor&                                          uplink_executor,
+                            span<task_executor* const>                              uplink_executors,
                             std::unique_ptr<ether::receiver>                        eth_rx,
                             uplane_rx_symbol_notifier*                              notifier,
                             std::shared_ptr<prach_context_repository>               prach_context_repo,
@@ -172,7 +176,7 @@ ocudu::ofh::create_receiver(const receiver_config&
 {
   auto rx_deps = resolve_receiver_dependencies(receiver_cfg,
                                                logger,
-                                               uplink_executor,
+                                               uplink_executors,
                                                std::move(eth_rx),
                                                notifier,
                                                std::move(prach_context_repo),
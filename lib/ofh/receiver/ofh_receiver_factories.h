@@ -25,10 +25,13 @@ class task_executor;
 
 namespace ofh {
 
-/// Creates a receiver with the given configuration and dependencies.
+/// \brief Creates a receiver with the given configuration and dependencies.
+///
+/// The receiver decodes the received messages in parallel in one lane per uplink executor, steering the messages to the
+/// lanes by eAxC.
 std::unique_ptr<receiver> create_receiver(const receiver_config&                                  receiver_cfg,
                                           ocudulog::basic_logger&                                 logger,
-                                          task_executor&                                          uplink_executor,
+                                          span<task_executor* const>                              uplink_executors,
                                           std::unique_ptr<ether::receiver>                        eth_receiver,
                                           uplane_rx_symbol_notifier*                              notifier,
                                           std::shared_ptr<prach_context_repository>               prach_context_repo,
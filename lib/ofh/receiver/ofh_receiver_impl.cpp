@@ -59,14 +59,58 @@ get_message_receiver_dependencies(receiver_impl_dependencies::message_rx_depende
   return dependencies;
 }
 
-static closed_rx_window_handler_config get_closed_rx_window_handler_config(const receiver_config& config)
+static std::vector<std::unique_ptr<message_receiver_impl>>
+create_message_receivers(const receiver_config&                                    config,
+                         span<receiver_impl_dependencies::message_rx_dependencies> rx_dependencies,
+                         rx_window_checker&                                        window_checker,
+                         closed_rx_window_handler&                                 window_handler)
+{
+  ocudu_assert(!rx_dependencies.empty(), "No message receiver dependencies");
+
+  std::vector<std::unique_ptr<message_receiver_impl>> receivers;
+  for (auto& lane_dependencies : rx_dependencies) {
+    receivers.push_back(std::make_unique<message_receiver_impl>(
+        get_message_receiver_configuration(config),
+        get_message_receiver_dependencies(std::move(lane_dependencies), window_checker, window_handler)));
+  }
+
+  return receivers;
+}
+
+static std::vector<message_receiver_lane>
+get_message_receiver_lanes(span<const std::unique_ptr<message_receiver_impl>>               receivers,
+                           span<const receiver_impl_dependencies::message_rx_dependencies> rx_dependencies)
+{
+  std::vector<message_receiver_lane> lanes;
+  for (unsigned i_lane = 0, nof_lanes = receivers.size(); i_lane != nof_lanes; ++i_lane) {
+    ocudu_assert(rx_dependencies[i_lane].executor, "Invalid message receiver executor");
+    lanes.push_back({receivers[i_lane].get(), rx_dependencies[i_lane].executor});
+  }
+
+  return lanes;
+}
+
+static std::vector<message_receiver_metrics_collector*>
+get_message_receiver_metrics_collectors(span<const std::unique_ptr<message_receiver_impl>> receivers)
+{
+  std::vector<message_receiver_metrics_collector*> collectors;
+  for (const auto& receiver : receivers) {
+    collectors.push_back(receiver->get_metrics_collector());
+  }
+
+  return collectors;
+}
+
+static closed_rx_window_handler_config get_closed_rx_window_handler_config(const receiver_config& config,
+                                                                           unsigned               nof_rx_lanes)
 {
   closed_rx_window_handler_config out_config;
   out_config.sector                 = config.sector;
   out_config.warn_unreceived_frames = config.log_unreceived_ru_frames;
   out_config.rx_timing_params       = config.rx_timing_params;
-  // As it runs in the same executor, do not delay the reception window close.
-  out_config.nof_symbols_to_process_uplink = 0;
+  // With a single receiver lane, the handler runs in the same executor, so do not delay the reception window close.
+  // Otherwise, give the other lanes one symbol to finish decoding the messages received before the window closed.
+  out_config.nof_symbols_to_process_uplink = (nof_rx_lanes > 1) ? 1 : 0;
 
   return out_config;
 }
@@ -95,7 +139,7 @@ void ota_symbol_boundary_dispatcher::on_new_symbol(const slot_symbol_point_conte
 
 receiver_impl::receiver_impl(const receiver_config& config, receiver_impl_dependencies&& dependencies) :
   symbol_reorderer(std::move(dependencies.symbol_reorderer)),
-  closed_window_handler(get_closed_rx_window_handler_config(config),
+  closed_window_handler(get_closed_rx_window_handler_config(config, dependencies.msg_rx_dependencies.size()),
                         generate_closed_rx_window_dependencies(std::move(dependencies.window_handler_dependencies),
                                                                *dependencies.logger,
                                                                *dependencies.executor)),
@@ -109,18 +153,17 @@ receiver_impl::receiver_impl(const receiver_config& config, receiver_impl_depend
 
     return handlers;
   }(closed_window_handler, window_checker)),
-  msg_receiver(get_message_receiver_configuration(config),
-               get_message_receiver_dependencies(std::move(dependencies.msg_rx_dependencies),
-                                                 window_checker,
-                                                 closed_window_handler)),
+  msg_receivers(
+      create_message_receivers(config, dependencies.msg_rx_dependencies, window_checker, closed_window_handler)),
   metrics_collector(config.are_metrics_enabled,
                     closed_window_handler,
                     window_checker,
-                    msg_receiver.get_metrics_collector(),
+                    get_message_receiver_metrics_collectors(msg_receivers),
                     dependencies.eth_receiver->get_metrics_collector()),
   rcv_task_dispatcher(*dependencies.logger,
-                      msg_receiver,
-                      *dependencies.executor,
+                      get_message_receiver_lanes(msg_receivers, dependencies.msg_rx_dependencies),
+                      config.ul_eaxc,
+                      config.prach_eaxc,
                       config.sector,
                       std::move(dependencies.eth_receiver)),
   ctrl(rcv_task_dispatcher, closed_window_handler)
@@ -33,6 +33,8 @@ struct receiver_impl_dependencies {
   struct message_rx_dependencies {
     /// Logger.
     ocudulog::basic_logger* logger = nullptr;
+    /// Task executor where the message receiver runs.
+    task_executor* executor = nullptr;
     /// eCPRI packet decoder.
     std::unique_ptr<ecpri::packet_decoder> ecpri_decoder;
     /// Ethernet frame decoder.
@@ -55,8 +57,10 @@ struct receiver_impl_dependencies {
   ocudulog::basic_logger* logger = nullptr;
   /// Task executor.
   task_executor* executor = nullptr;
-  /// Message receiver dependencies.
-  message_rx_dependencies msg_rx_dependencies;
+  /// \brief Message receiver dependencies, one per receiver lane.
+  ///
+  /// The received messages are steered by eAxC to the lanes, which decode them in parallel.
+  std::vector<message_rx_dependencies> msg_rx_dependencies;
   /// Closed reception window handler dependencies.
   close_rx_window_dependencies window_handler_dependencies;
   /// Received symbol reorderer.
@@ -99,14 +103,14 @@ public:
   receiver_metrics_collector* get_metrics_collector() override;
 
 private:
-  std::shared_ptr<rx_symbol_reorderer> symbol_reorderer;
-  closed_rx_window_handler             closed_window_handler;
-  rx_window_checker                    window_checker;
-  ota_symbol_boundary_dispatcher       symbol_boundary_dispatcher;
-  message_receiver_impl                msg_receiver;
-  receiver_metrics_collector_impl      metrics_collector;
-  ofh_message_receiver_task_dispatcher rcv_task_dispatcher;
-  receiver_controller                  ctrl;
+  std::shared_ptr<rx_symbol_reorderer>                 symbol_reorderer;
+  closed_rx_window_handler                             closed_window_handler;
+  rx_window_checker                                    window_checker;
+  ota_symbol_boundary_dispatcher                       symbol_boundary_dispatcher;
+  std::vector<std::unique_ptr<message_receiver_impl>> msg_receivers;
+  receiver_metrics_collector_impl                      metrics_collector;
+  ofh_message_receiver_task_dispatcher                 rcv_task_dispatcher;
+  receiver_controller                                  ctrl;
 };
 
 } // namespace ofh
@@ -15,6 +15,8 @@
 #include "ofh_rx_window_checker.h"
 #include "ocudu/ofh/ethernet/ethernet_receiver_metrics_collector.h"
 #include "ocudu/ofh/receiver/ofh_receiver_metrics_collector.h"
+#include <algorithm>
+#include <vector>
 
 namespace ocudu {
 namespace ofh {
@@ -23,19 +25,23 @@ namespace ofh {
 class receiver_metrics_collector_impl : public receiver_metrics_collector
 {
 public:
-  receiver_metrics_collector_impl(bool                                metrics_enabled,
-                                  closed_rx_window_handler&           closed_window_handler_,
-                                  rx_window_checker&                  window_checker_,
-                                  message_receiver_metrics_collector* msg_rcv_metrics_collector_,
-                                  ether::receiver_metrics_collector*  eth_rcv_metrics_collector_) :
+  receiver_metrics_collector_impl(bool                                             metrics_enabled,
+                                  closed_rx_window_handler&                        closed_window_handler_,
+                                  rx_window_checker&                               window_checker_,
+                                  std::vector<message_receiver_metrics_collector*> msg_rcv_metrics_collectors_,
+                                  ether::receiver_metrics_collector*               eth_rcv_metrics_collector_) :
     is_disabled(!metrics_enabled),
     closed_window_handler(closed_window_handler_),
     window_checker(window_checker_),
-    msg_rcv_metrics_collector(msg_rcv_metrics_collector_),
+    msg_rcv_metrics_collectors(std::move(msg_rcv_metrics_collectors_)),
     eth_rcv_metrics_collector(eth_rcv_metrics_collector_)
   {
     if (!is_disabled) {
-      ocudu_assert(msg_rcv_metrics_collector && eth_rcv_metrics_collector,
+      ocudu_assert(!msg_rcv_metrics_collectors.empty() &&
+                       std::all_of(msg_rcv_metrics_collectors.begin(),
+                                   msg_rcv_metrics_collectors.end(),
+                                   [](const auto* collector) { return collector != nullptr; }) &&
+                       eth_rcv_metrics_collector,
                    "Open fronthaul receiver metrics collectors must be initialized when the metrics are enabled");
     }
   }
@@ -49,7 +55,7 @@ public:
 
     closed_window_handler.collect_metrics(metrics.closed_window_metrics);
     window_checker.collect_metrics(metrics.rx_messages_metrics);
-    msg_rcv_metrics_collector->collect_metrics(metrics.rx_decoding_perf_metrics);
+    collect_message_decoding_metrics(metrics.rx_decoding_perf_metrics);
     eth_rcv_metrics_collector->collect_metrics(metrics.eth_receiver_metrics);
   }
 
@@ -57,11 +63,54 @@ public:
   bool disabled() const { return is_disabled; }
 
 private:
-  const bool                          is_disabled;
-  closed_rx_window_handler&           closed_window_handler;
-  rx_window_checker&                  window_checker;
-  message_receiver_metrics_collector* msg_rcv_metrics_collector;
-  ether::receiver_metrics_collector*  eth_rcv_metrics_collector;
+  /// Collects the message decoding metrics of all the message receivers and merges them.
+  void collect_message_decoding_metrics(message_decoding_performance_metrics& metrics)
+  {
+    msg_rcv_metrics_collectors.front()->collect_metrics(metrics);
+    for (unsigned i = 1, e = msg_rcv_metrics_collectors.size(); i != e; ++i) {
+      message_decoding_performance_metrics lane_metrics;
+      msg_rcv_metrics_collectors[i]->collect_metrics(lane_metrics);
+
+      merge_data_flow_metrics(metrics.data_processing_metrics, lane_metrics.data_processing_metrics);
+      merge_data_flow_metrics(metrics.prach_processing_metrics, lane_metrics.prach_processing_metrics);
+      metrics.nof_dropped_messages += lane_metrics.nof_dropped_messages;
+      metrics.nof_skipped_messages += lane_metrics.nof_skipped_messages;
+    }
+  }
+
+  /// \brief Merges the data flow metrics of a message receiver into the given metrics.
+  ///
+  /// A zero latency means that the message receiver decoded no message. The average latency is weighted by the number
+  /// of decoded messages, which is derived from the CPU usage.
+  static void merge_data_flow_metrics(rx_data_flow_perf_metrics& metrics, const rx_data_flow_perf_metrics& other)
+  {
+    metrics.nof_dropped_messages += other.nof_dropped_messages;
+    if (other.message_unpacking_avg_latency_us == 0) {
+      return;
+    }
+    if (metrics.message_unpacking_avg_latency_us == 0) {
+      unsigned nof_dropped_messages = metrics.nof_dropped_messages;
+      metrics                       = other;
+      metrics.nof_dropped_messages  = nof_dropped_messages;
+      return;
+    }
+
+    float count       = metrics.cpu_usage_us / metrics.message_unpacking_avg_latency_us;
+    float other_count = other.cpu_usage_us / other.message_unpacking_avg_latency_us;
+
+    metrics.message_unpacking_min_latency_us =
+        std::min(metrics.message_unpacking_min_latency_us, other.message_unpacking_min_latency_us);
+    metrics.message_unpacking_max_latency_us =
+        std::max(metrics.message_unpacking_max_latency_us, other.message_unpacking_max_latency_us);
+    metrics.cpu_usage_us += other.cpu_usage_us;
+    metrics.message_unpacking_avg_latency_us = metrics.cpu_usage_us / (count + other_count);
+  }
+
+  const bool                                       is_disabled;
+  closed_rx_window_handler&                        closed_window_handler;
+  rx_window_checker&                               window_checker;
+  std::vector<message_receiver_metrics_collector*> msg_rcv_metrics_collectors;
+  ether::receiver_metrics_collector*               eth_rcv_metrics_collector;
 };
 
 } // namespace ofh
@@ -20,10 +20,11 @@ bool uplane_rx_symbol_data_flow_writer::write_to_resource_grid(unsigned
 {
   trace_point access_repo_tp = ofh_tracer.now();
 
-  slot_point     slot       = results.params.slot;
-  unsigned       symbol     = results.params.symbol_id;
-  uplink_context ul_context = ul_context_repo->get(slot, symbol);
-  if (OCUDU_UNLIKELY(ul_context.empty())) {
+  slot_point slot   = results.params.slot;
+  unsigned   symbol = results.params.symbol_id;
+  // The DU cell bandwidth may be narrower than the operating bandwidth of the RU.
+  unsigned du_nof_prbs = ul_context_repo->get_grid_nof_prbs(slot, symbol);
+  if (OCUDU_UNLIKELY(du_nof_prbs == 0)) {
     logger.info(
         "Sector#{}: dropped received Open Fronthaul message as no uplink slot context was found for slot '{}', symbol "
         "'{}' and eAxC '{}'",
@@ -40,8 +41,6 @@ bool uplane_rx_symbol_data_flow_writer::write_to_resource_grid(unsigned
   unsigned rg_port = std::distance(ul_eaxc.begin(), std::find(ul_eaxc.begin(), ul_eaxc.end(), eaxc));
   ocudu_assert(rg_port < ul_eaxc.size(), "Invalid resource grid port value '{}'", rg_port);
 
-  // The DU cell bandwidth may be narrower than the operating bandwidth of the RU.
-  unsigned du_nof_prbs = ul_context.get_grid_nof_prbs();
   for (const auto& section : results.sections) {
     // Drop the whole section when all PRBs are outside the range of the DU bandwidth and the operating bandwidth of the
     // RU is larger.
@@ -43,6 +43,18 @@ uplane_message_decoder_dynamic_compression_impl::decode_compression_header(
   unsigned data_width            = value >> 4U;
   results.ud_comp_hdr.data_width = (data_width == 0) ? MAX_IQ_WIDTH : data_width;
 
+  // Mu-law compressed samples need room for the sign, segment and mantissa bits.
+  if (OCUDU_UNLIKELY(results.ud_comp_hdr.type == compression_type::mu_law &&
+                     results.ud_comp_hdr.data_width < MIN_MU_LAW_IQ_WIDTH)) {
+    logger.info("Sector#{}: detected malformed Open Fronthaul message as the decoded mu-law compression bit width '{}' "
+                "is smaller than '{}'",
+                sector_id,
+                results.ud_comp_hdr.data_width,
+                MIN_MU_LAW_IQ_WIDTH);
+
+    return uplane_message_decoder_impl::decoded_section_status::malformed;
+  }
+
   // Advance the reserved byte.
   deserializer.advance(1U);
 
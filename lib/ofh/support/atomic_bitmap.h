@@ -0,0 +1,141 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/bounded_bitset.h"
+#include "ocudu/support/math/bit_ops.h"
+#include "ocudu/support/math/math_utils.h"
+#include "ocudu/support/ocudu_assert.h"
+#include <array>
+#include <atomic>
+
+namespace ocudu {
+namespace ofh {
+
+/// \brief Fixed capacity bitmap whose bits can be set concurrently from multiple threads.
+///
+/// Setting a range of bits only performs one atomic OR per 64-bit word, which allows several threads to mark disjoint
+/// or overlapping ranges of the same bitmap without any lock.
+///
+/// \tparam N Maximum number of bits of the bitmap.
+template <size_t N>
+class atomic_bitmap
+{
+  using word_t                          = uint64_t;
+  using bit_helper                      = detail::bitset_builtin_helper<word_t>;
+  static constexpr size_t bits_per_word = 8U * sizeof(word_t);
+  static constexpr size_t max_nof_words = divide_ceil(N, bits_per_word);
+
+public:
+  /// Default constructor.
+  atomic_bitmap() = default;
+
+  /// Constructs an empty bitmap of the given size.
+  explicit atomic_bitmap(size_t nof_bits_) : nof_bits(nof_bits_)
+  {
+    ocudu_assert(nof_bits <= N, "The bitmap size (i.e., {}) exceeds the maximum size (i.e., {})", nof_bits, N);
+    reset();
+  }
+
+  /// Copy constructor. Takes a snapshot of the bits of the other bitmap.
+  atomic_bitmap(const atomic_bitmap& other) : nof_bits(other.nof_bits) { copy_words(other); }
+
+  /// Copy assignment. Takes a snapshot of the bits of the other bitmap.
+  atomic_bitmap& operator=(const atomic_bitmap& other)
+  {
+    nof_bits = other.nof_bits;
+    copy_words(other);
+    return *this;
+  }
+
+  /// Returns the number of bits of the bitmap.
+  size_t size() const { return nof_bits; }
+
+  /// Clears all the bits of the bitmap. Not thread safe.
+  void reset()
+  {
+    for (unsigned i_word = 0, nof_words = get_nof_words(); i_word != nof_words; ++i_word) {
+      words[i_word].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// Sets the bits within the range [start, end). Thread safe.
+  void fill(size_t start, size_t end)
+  {
+    ocudu_assert(start <= end && end <= nof_bits,
+                 "Invalid bit range [{}, {}) for a bitmap of size {}",
+                 start,
+                 end,
+                 nof_bits);
+
+    while (start != end) {
+      size_t i_word     = start / bits_per_word;
+      size_t word_start = start % bits_per_word;
+      size_t word_end   = std::min(end - i_word * bits_per_word, bits_per_word);
+
+      word_t mask = mask_lsb_ones<word_t>(word_end) & mask_lsb_zeros<word_t>(word_start);
+      words[i_word].fetch_or(mask, std::memory_order_relaxed);
+
+      start = i_word * bits_per_word + word_end;
+    }
+  }
+
+  /// Returns true if all the bits of the bitmap are set.
+  bool all() const
+  {
+    for (unsigned i_word = 0, nof_words = get_nof_words(); i_word != nof_words; ++i_word) {
+      size_t nof_word_bits = std::min(nof_bits - i_word * bits_per_word, bits_per_word);
+      word_t expected      = mask_lsb_ones<word_t>(nof_word_bits);
+      if ((words[i_word].load(std::memory_order_relaxed) & expected) != expected) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Returns a snapshot of the bitmap as a bounded bitset.
+  bounded_bitset<N> to_bounded_bitset() const
+  {
+    bounded_bitset<N> result(nof_bits);
+    for (unsigned i_word = 0, nof_words = get_nof_words(); i_word != nof_words; ++i_word) {
+      word_t word   = words[i_word].load(std::memory_order_relaxed);
+      size_t offset = i_word * bits_per_word;
+      // Fill the runs of consecutive ones of the word.
+      while (word != 0) {
+        unsigned run_start = bit_helper::zero_lsb_count(word);
+        unsigned run_end   = bit_helper::zero_lsb_count(~word & mask_lsb_zeros<word_t>(run_start));
+        result.fill(offset + run_start, offset + run_end);
+        word &= mask_lsb_zeros<word_t>(run_end);
+      }
+    }
+    return result;
+  }
+
+private:
+  /// Returns the number of words used by the bitmap.
+  unsigned get_nof_words() const { return divide_ceil(nof_bits, bits_per_word); }
+
+  /// Copies the words of the other bitmap.
+  void copy_words(const atomic_bitmap& other)
+  {
+    for (unsigned i_word = 0, nof_words = get_nof_words(); i_word != nof_words; ++i_word) {
+      words[i_word].store(other.words[i_word].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+  }
+
+  /// Number of bits of the bitmap.
+  size_t nof_bits = 0;
+  /// Bitmap storage.
+  std::array<std::atomic<word_t>, max_nof_words> words;
+};
+
+} // namespace ofh
+} // namespace ocudu
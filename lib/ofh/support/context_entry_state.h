@@ -0,0 +1,119 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "context_repository_helpers.h"
+#include <atomic>
+#include <thread>
+
+namespace ocudu {
+namespace ofh {
+
+/// \brief Access state of an entry of the Open Fronthaul uplink context repositories.
+///
+/// The state packs in a single atomic word the tag of the slot stored in the entry, an exclusive access flag and the
+/// number of threads with shared access to the entry. The Open Fronthaul receivers write the U-Plane sections with
+/// shared access, which never blocks, while adding, popping and clearing the entry of a slot require exclusive access.
+/// Shared access is only granted when the entry holds the requested slot, so that writers never touch a stale entry
+/// reused by a later slot.
+class context_entry_state
+{
+  static constexpr uint64_t EXCLUSIVE_FLAG = 1ULL << 31U;
+  static constexpr uint64_t COUNT_MASK     = EXCLUSIVE_FLAG - 1U;
+  static constexpr unsigned TAG_SHIFT      = 32U;
+
+public:
+  /// Tag of an entry that stores no context.
+  static constexpr uint32_t EMPTY_TAG = 0;
+
+  /// Returns the tag that identifies the given slot in the repositories.
+  static uint32_t make_tag(slot_point slot)
+  {
+    slot_point entry_slot(slot.numerology(), slot.sfn() % SFN_MAX_VALUE, slot.slot_index());
+    return entry_slot.system_slot() + 1U;
+  }
+
+  /// \brief Tries to get shared access to the entry.
+  ///
+  /// Shared access is granted if the entry holds the given tag and no thread has exclusive access to it.
+  bool try_lock_shared(uint32_t tag)
+  {
+    uint64_t current = state.load(std::memory_order_relaxed);
+    do {
+      if (get_tag(current) != tag || (current & EXCLUSIVE_FLAG)) {
+        return false;
+      }
+    } while (!state.compare_exchange_weak(current, current + 1U, std::memory_order_acquire, std::memory_order_relaxed));
+
+    return true;
+  }
+
+  /// Releases the shared access to the entry.
+  void unlock_shared() { state.fetch_sub(1U, std::memory_order_release); }
+
+  /// \brief Tries to get exclusive access to the entry.
+  ///
+  /// Exclusive access is granted if the entry holds the given tag and no other thread has exclusive access to it. Once
+  /// granted, the function waits for the threads with shared access to release the entry.
+  bool try_lock(uint32_t tag)
+  {
+    uint64_t current = state.load(std::memory_order_relaxed);
+    do {
+      if (get_tag(current) != tag || (current & EXCLUSIVE_FLAG)) {
+        return false;
+      }
+    } while (!state.compare_exchange_weak(
+        current, current | EXCLUSIVE_FLAG, std::memory_order_acquire, std::memory_order_relaxed));
+
+    wait_for_shared_owners();
+    return true;
+  }
+
+  /// Gets exclusive access to the entry regardless of the tag it holds and returns the tag.
+  uint32_t lock()
+  {
+    uint64_t current = state.load(std::memory_order_relaxed);
+    for (;;) {
+      if (current & EXCLUSIVE_FLAG) {
+        std::this_thread::yield();
+        current = state.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (state.compare_exchange_weak(
+              current, current | EXCLUSIVE_FLAG, std::memory_order_acquire, std::memory_order_relaxed)) {
+        break;
+      }
+    }
+
+    wait_for_shared_owners();
+    return get_tag(current);
+  }
+
+  /// Releases the exclusive access to the entry, setting the given tag.
+  void unlock(uint32_t new_tag) { state.store(static_cast<uint64_t>(new_tag) << TAG_SHIFT, std::memory_order_release); }
+
+private:
+  /// Returns the tag of the given state.
+  static uint32_t get_tag(uint64_t value) { return static_cast<uint32_t>(value >> TAG_SHIFT); }
+
+  /// Waits until the threads with shared access release the entry.
+  void wait_for_shared_owners() const
+  {
+    while (state.load(std::memory_order_acquire) & COUNT_MASK) {
+      std::this_thread::yield();
+    }
+  }
+
+  std::atomic<uint64_t> state = {static_cast<uint64_t>(EMPTY_TAG) << TAG_SHIFT};
+};
+
+} // namespace ofh
+} // namespace ocudu
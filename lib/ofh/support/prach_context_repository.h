@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "atomic_bitmap.h"
+#include "context_entry_state.h"
 #include "context_repository_helpers.h"
 #include "ocudu/adt/bounded_bitset.h"
 #include "ocudu/adt/expected.h"
@@ -24,7 +26,6 @@
 #include "ocudu/ran/prach/prach_constants.h"
 #include "ocudu/ran/prach/prach_frequency_mapping.h"
 #include "ocudu/ran/prach/prach_preamble_information.h"
-#include <mutex>
 #include <numeric>
 #include <optional>
 
@@ -37,12 +38,12 @@ class prach_context
   /// PRACH buffer writer statistics.
   struct prach_buffer_writer_stats {
     prach_buffer_writer_stats(unsigned nof_ports, size_t nof_res) :
-      re_written(nof_ports, bounded_bitset<prach_constants::LONG_SEQUENCE_LENGTH>(nof_res))
+      re_written(nof_ports, atomic_bitmap<prach_constants::LONG_SEQUENCE_LENGTH>(nof_res))
     {
     }
 
     /// Number of REs written indexed by port.
-    static_vector<bounded_bitset<prach_constants::LONG_SEQUENCE_LENGTH>, MAX_NOF_SUPPORTED_EAXC> re_written;
+    static_vector<atomic_bitmap<prach_constants::LONG_SEQUENCE_LENGTH>, MAX_NOF_SUPPORTED_EAXC> re_written;
 
     /// Returns true when all the REs for the current symbol have been written.
     bool have_all_res_been_written() const
@@ -129,15 +130,22 @@ public:
   /// Gets the maximum number of ports supported in PRACH buffer.
   unsigned get_max_nof_ports() const { return empty() ? 0U : context_info.buffer->get_max_nof_ports(); }
 
-  /// Returns a span of bitmaps that indicate the REs that have been written for the given symbol. Each element of the
-  /// span corresponds to a port.
-  span<const bounded_bitset<prach_constants::LONG_SEQUENCE_LENGTH>> get_symbol_re_written(unsigned symbol) const
+  /// Returns a snapshot of the bitmaps that indicate the REs that have been written for the given symbol. Each element
+  /// corresponds to a port.
+  static_vector<bounded_bitset<prach_constants::LONG_SEQUENCE_LENGTH>, MAX_NOF_SUPPORTED_EAXC>
+  get_symbol_re_written(unsigned symbol) const
   {
     ocudu_assert(symbol < nof_symbols, "Invalid symbol index");
-    return buffer_stats[symbol].re_written;
+    static_vector<bounded_bitset<prach_constants::LONG_SEQUENCE_LENGTH>, MAX_NOF_SUPPORTED_EAXC> mask;
+    for (const auto& port_re_written : buffer_stats[symbol].re_written) {
+      mask.push_back(port_re_written.to_bounded_bitset());
+    }
+    return mask;
   }
 
-  /// Writes the given IQ buffer corresponding to the given symbol and port.
+  /// \brief Writes the given IQ buffer corresponding to the given symbol and port.
+  ///
+  /// Several threads can write concurrently into the same context as long as they write different REs.
   void write_iq(unsigned port, unsigned symbol, unsigned re_start, span<const cbf16_t> iq_buffer)
   {
     if (is_long_preamble(context_info.context.format)) {
@@ -170,21 +178,14 @@ public:
     buffer_stats[symbol].re_written[port].fill(re_start, re_start + iq_buffer.size());
   }
 
-  /// Tries to get a complete PRACH buffer. A PRACH buffer is considered completed when all the PRBs for all the ports
-  /// have been written.
-  expected<prach_context_information> try_getting_complete_prach_buffer()
+  /// \brief Returns true if the PRACH buffer is complete, otherwise false.
+  ///
+  /// A PRACH buffer is considered completed when all the PRBs for all the ports have been written.
+  bool is_complete() const
   {
-    if (!context_info.buffer) {
-      return make_unexpected(default_error_t{});
-    }
-
-    if (!std::all_of(buffer_stats.begin(), buffer_stats.end(), [&](const auto& symbol) {
-          return symbol.have_all_res_been_written();
-        })) {
-      return make_unexpected(default_error_t{});
-    }
-
-    return {{context_info.context, std::move(context_info.buffer)}};
+    return context_info.buffer && std::all_of(buffer_stats.begin(), buffer_stats.end(), [](const auto& symbol) {
+             return symbol.have_all_res_been_written();
+           });
   }
 
   /// Returns the information of this PRACH context.
@@ -205,31 +206,46 @@ private:
   unsigned start_symbol;
 };
 
-/// PRACH context repository.
+/// \brief PRACH context repository.
+///
+/// Each entry is guarded by a \ref context_entry_state, so the Open Fronthaul receivers write the PRACH U-Plane
+/// sections without taking any lock.
 class prach_context_repository
 {
   using queue_type =
       concurrent_queue<unique_task, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>;
 
-  queue_type                 pending_context_to_add;
-  std::vector<prach_context> buffer;
-  //: TODO: make this lock free
-  mutable std::mutex mutex;
+  /// Repository entry.
+  struct repository_entry {
+    mutable context_entry_state state;
+    prach_context               context;
+  };
+
+  queue_type                    pending_context_to_add;
+  std::vector<repository_entry> buffer;
 
   /// Returns the entry of the repository for the given slot.
-  prach_context& entry(slot_point slot)
+  repository_entry& entry(slot_point slot)
   {
     unsigned index = calculate_repository_index(slot, buffer.size());
     return buffer[index];
   }
 
   /// Returns the entry of the repository for the given slot.
-  const prach_context& entry(slot_point slot) const
+  const repository_entry& entry(slot_point slot) const
   {
     unsigned index = calculate_repository_index(slot, buffer.size());
     return buffer[index];
   }
 
+  /// Clears the given repository entry.
+  static void clear_entry(repository_entry& entry)
+  {
+    entry.state.lock();
+    entry.context = {};
+    entry.state.unlock(context_entry_state::EMPTY_TAG);
+  }
+
 public:
   explicit prach_context_repository(unsigned size_) : pending_context_to_add(size_), buffer(size_) {}
 
@@ -240,8 +256,10 @@ public:
            std::optional<unsigned>     start_symbol)
   {
     if (!pending_context_to_add.try_push([context, prach_buff = std::move(buffer_), start_symbol, this]() mutable {
-          std::lock_guard<std::mutex> lock(mutex);
-          entry(context.slot) = prach_context(context, std::move(prach_buff), start_symbol);
+          repository_entry& slot_entry = entry(context.slot);
+          slot_entry.state.lock();
+          slot_entry.context = prach_context(context, std::move(prach_buff), start_symbol);
+          slot_entry.state.unlock(context_entry_state::make_tag(context.slot));
         })) {
       logger.warning("Failed to enqueue task to add the uplink context to the repository");
     }
@@ -256,18 +274,30 @@ public:
     }
   }
 
-  /// Function to write the uplink PRACH buffer.
+  /// \brief Function to write the uplink PRACH buffer.
+  ///
+  /// The IQ buffer is dropped if the repository holds no context for the given slot.
   void write_iq(slot_point slot, unsigned port, unsigned symbol, unsigned re_start, span<const cbf16_t> iq_buffer)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot).write_iq(port, symbol, re_start, iq_buffer);
+    repository_entry& slot_entry = entry(slot);
+    if (!slot_entry.state.try_lock_shared(context_entry_state::make_tag(slot))) {
+      return;
+    }
+    slot_entry.context.write_iq(port, symbol, re_start, iq_buffer);
+    slot_entry.state.unlock_shared();
   }
 
-  /// Returns the entry of the repository for the given slot.
+  /// Returns a snapshot of the entry of the repository for the given slot.
   prach_context get(slot_point slot) const
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    return entry(slot);
+    const repository_entry& slot_entry = entry(slot);
+    if (!slot_entry.state.try_lock_shared(context_entry_state::make_tag(slot))) {
+      return {};
+    }
+    prach_context result = slot_entry.context;
+    slot_entry.state.unlock_shared();
+
+    return result;
   }
 
   /// \brief Tries to pop a complete PRACH buffer from the repository.
@@ -276,45 +306,56 @@ public:
   /// successful it clears the entry of the repository for that slot.
   expected<prach_context::prach_context_information> try_popping_complete_prach_buffer(slot_point slot)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto                        result = entry(slot).try_getting_complete_prach_buffer();
+    repository_entry& slot_entry = entry(slot);
+    uint32_t          tag        = context_entry_state::make_tag(slot);
+
+    // Check the completion with shared access, so that the writers of the slot are not blocked.
+    if (!slot_entry.state.try_lock_shared(tag)) {
+      return make_unexpected(default_error_t());
+    }
+    bool is_complete = slot_entry.context.is_complete();
+    slot_entry.state.unlock_shared();
 
-    // Clear the entry if the pop was a success.
-    if (result) {
-      entry(slot) = {};
+    // Only one of the threads that find the buffer complete pops it.
+    if (!is_complete || !slot_entry.state.try_lock(tag)) {
+      return make_unexpected(default_error_t());
     }
 
+    auto result        = slot_entry.context.pop_context_information();
+    slot_entry.context = {};
+    slot_entry.state.unlock(context_entry_state::EMPTY_TAG);
+
     return result;
   }
 
-  /// Pops a PRACH buffer from the repository.
+  /// \brief Pops a PRACH buffer from the repository.
+  ///
+  /// The entry is popped regardless of the slot it was added for, which flushes the contexts left over by older slots.
   expected<prach_context::prach_context_information> pop_prach_buffer(slot_point slot)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto&                       context = entry(slot);
+    repository_entry& slot_entry = entry(slot);
+    uint32_t          tag        = slot_entry.state.lock();
 
-    if (context.empty()) {
+    if (slot_entry.context.empty()) {
+      slot_entry.state.unlock(tag);
       return make_unexpected(default_error_t());
     }
 
-    auto result = context.pop_context_information();
-    context     = {};
+    auto result        = slot_entry.context.pop_context_information();
+    slot_entry.context = {};
+    slot_entry.state.unlock(context_entry_state::EMPTY_TAG);
 
     return result;
   }
 
   /// Clears the given slot entry.
-  void clear(slot_point slot)
-  {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot) = {};
-  }
+  void clear(slot_point slot) { clear_entry(entry(slot)); }
 
   /// Clears the whole repository.
   void clear()
   {
-    for (auto& entry : buffer) {
-      entry = {};
+    for (auto& slot_entry : buffer) {
+      clear_entry(slot_entry);
     }
   }
 };
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "atomic_bitmap.h"
+#include "context_entry_state.h"
 #include "context_repository_helpers.h"
 #include "ocudu/adt/expected.h"
 #include "ocudu/adt/mpmc_queue.h"
@@ -25,7 +27,6 @@
 #include "ocudu/ran/cyclic_prefix.h"
 #include "ocudu/ran/resource_allocation/ofdm_symbol_range.h"
 #include "ocudu/ran/resource_block.h"
-#include <mutex>
 
 namespace ocudu {
 namespace ofh {
@@ -59,8 +60,8 @@ public:
   {
     const resource_grid_reader& reader = grid.grid->get_reader();
 
-    re_written = static_vector<bounded_bitset<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC>(
-        reader.get_nof_ports(), bounded_bitset<MAX_NOF_SUBCARRIERS>(size_t(reader.get_nof_subc())));
+    re_written = static_vector<atomic_bitmap<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC>(
+        reader.get_nof_ports(), atomic_bitmap<MAX_NOF_SUBCARRIERS>(size_t(reader.get_nof_subc())));
   }
 
   /// Returns true if this context is empty, otherwise false.
@@ -75,11 +76,20 @@ public:
   /// Returns the resource grid context.
   const resource_grid_context& get_grid_context() const { return grid.context; }
 
-  /// Returns a span of bitmaps that indicate the REs that have been written for the given symbol. Each element of the
-  /// span corresponds to a port.
-  span<const bounded_bitset<MAX_NOF_SUBCARRIERS>> get_re_written_mask() const { return re_written; }
+  /// Returns a snapshot of the bitmaps that indicate the REs that have been written for the given symbol. Each element
+  /// corresponds to a port.
+  static_vector<bounded_bitset<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC> get_re_written_mask() const
+  {
+    static_vector<bounded_bitset<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC> mask;
+    for (const auto& port_re_written : re_written) {
+      mask.push_back(port_re_written.to_bounded_bitset());
+    }
+    return mask;
+  }
 
-  /// Writes the given RE IQ buffer into the port and start RE.
+  /// \brief Writes the given RE IQ buffer into the port and start RE.
+  ///
+  /// Several threads can write concurrently into the same context as long as they write different REs.
   void write_grid(unsigned port, unsigned start_re, span<const cbf16_t> re_iq_buffer)
   {
     ocudu_assert(grid.grid, "Invalid resource grid");
@@ -94,20 +104,10 @@ public:
     re_written[port].fill(start_re, start_re + re_iq_buffer.size());
   }
 
-  /// Tries to get a complete resource grid. A resource grid is considered completed when all the PRBs for all the ports
-  /// have been written.
-  expected<uplink_context_resource_grid_info> try_getting_complete_resource_grid() const
-  {
-    if (!grid.grid) {
-      return make_unexpected(default_error_t{});
-    }
-
-    if (!have_all_prbs_been_written()) {
-      return make_unexpected(default_error_t{});
-    }
-
-    return uplink_context_resource_grid_info{grid.context, grid.grid.copy()};
-  }
+  /// \brief Returns true if the context resource grid is complete, otherwise false.
+  ///
+  /// A resource grid is considered completed when all the PRBs for all the ports have been written.
+  bool is_complete() const { return grid.grid && have_all_prbs_been_written(); }
 
   /// Returns the context grid information.
   const uplink_context_resource_grid_info& get_uplink_context_resource_grid_info() const { return grid; }
@@ -126,22 +126,29 @@ private:
 private:
   unsigned                                                                   symbol;
   uplink_context_resource_grid_info                                          grid;
-  static_vector<bounded_bitset<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC> re_written;
+  static_vector<atomic_bitmap<MAX_NOF_SUBCARRIERS>, MAX_NOF_SUPPORTED_EAXC>  re_written;
 };
 
-/// Uplink context repository.
+/// \brief Uplink context repository.
+///
+/// Each entry is guarded by a \ref context_entry_state, so the Open Fronthaul receivers write the U-Plane sections of a
+/// symbol without taking any lock, even when several receivers write into the same symbol concurrently.
 class uplink_context_repository
 {
   using queue_type =
       concurrent_queue<unique_task, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>;
 
-  queue_type                                                  pending_context_to_add;
-  std::vector<std::array<uplink_context, MAX_NSYMB_PER_SLOT>> buffer;
-  //: TODO: make this lock free
-  mutable std::mutex mutex;
+  /// Repository entry.
+  struct repository_entry {
+    mutable context_entry_state state;
+    uplink_context              context;
+  };
+
+  queue_type                                                    pending_context_to_add;
+  std::vector<std::array<repository_entry, MAX_NSYMB_PER_SLOT>> buffer;
 
   /// Returns the entry of the repository for the given slot and symbol.
-  uplink_context& entry(slot_point slot, unsigned symbol)
+  repository_entry& entry(slot_point slot, unsigned symbol)
   {
     ocudu_assert(symbol < MAX_NSYMB_PER_SLOT, "Invalid symbol index '{}'", symbol);
 
@@ -150,7 +157,7 @@ class uplink_context_repository
   }
 
   /// Returns the entry of the repository for the given slot and symbol.
-  const uplink_context& entry(slot_point slot, unsigned symbol) const
+  const repository_entry& entry(slot_point slot, unsigned symbol) const
   {
     ocudu_assert(symbol < MAX_NSYMB_PER_SLOT, "Invalid symbol index '{}'", symbol);
 
@@ -158,6 +165,14 @@ class uplink_context_repository
     return buffer[index][symbol];
   }
 
+  /// Clears the given repository entry.
+  static void clear_entry(repository_entry& entry)
+  {
+    entry.state.lock();
+    entry.context = {};
+    entry.state.unlock(context_entry_state::EMPTY_TAG);
+  }
+
 public:
   explicit uplink_context_repository(unsigned size_) : pending_context_to_add(size_), buffer(size_) {}
 
@@ -168,10 +183,13 @@ public:
            ocudulog::basic_logger&      logger)
   {
     if (!pending_context_to_add.try_push([context, rg = grid.copy(), symbol_range, this]() {
-          std::lock_guard<std::mutex> lock(mutex);
+          uint32_t tag = context_entry_state::make_tag(context.slot);
           for (unsigned symbol_id = symbol_range.start(), symbol_end = symbol_range.stop(); symbol_id != symbol_end;
                ++symbol_id) {
-            entry(context.slot, symbol_id) = uplink_context(symbol_id, context, rg);
+            repository_entry& slot_entry = entry(context.slot, symbol_id);
+            slot_entry.state.lock();
+            slot_entry.context = uplink_context(symbol_id, context, rg);
+            slot_entry.state.unlock(tag);
           }
         })) {
       logger.warning("Failed to enqueue task to add the uplink context to the repository");
@@ -187,18 +205,43 @@ public:
     }
   }
 
-  /// Writes to the grid at the given slot, port, symbol and start resource element the given IQ buffer.
+  /// \brief Writes to the grid at the given slot, port, symbol and start resource element the given IQ buffer.
+  ///
+  /// The IQ buffer is dropped if the repository holds no context for the given slot and symbol.
   void write_grid(slot_point slot, unsigned port, unsigned symbol, unsigned start_re, span<const cbf16_t> re_iq_buffer)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot, symbol).write_grid(port, start_re, re_iq_buffer);
+    repository_entry& slot_entry = entry(slot, symbol);
+    if (!slot_entry.state.try_lock_shared(context_entry_state::make_tag(slot))) {
+      return;
+    }
+    slot_entry.context.write_grid(port, start_re, re_iq_buffer);
+    slot_entry.state.unlock_shared();
+  }
+
+  /// Returns the number of PRBs of the grid stored for the given slot and symbol or zero if there is no context.
+  unsigned get_grid_nof_prbs(slot_point slot, unsigned symbol) const
+  {
+    const repository_entry& slot_entry = entry(slot, symbol);
+    if (!slot_entry.state.try_lock_shared(context_entry_state::make_tag(slot))) {
+      return 0U;
+    }
+    unsigned nof_prbs = slot_entry.context.get_grid_nof_prbs();
+    slot_entry.state.unlock_shared();
+
+    return nof_prbs;
   }
 
-  /// Returns the entry of the repository for the given slot and symbol.
+  /// Returns a snapshot of the entry of the repository for the given slot and symbol.
   uplink_context get(slot_point slot, unsigned symbol) const
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    return entry(slot, symbol).copy();
+    const repository_entry& slot_entry = entry(slot, symbol);
+    if (!slot_entry.state.try_lock_shared(context_entry_state::make_tag(slot))) {
+      return {};
+    }
+    uplink_context result = slot_entry.context.copy();
+    slot_entry.state.unlock_shared();
+
+    return result;
   }
 
   /// \brief Tries to pop a complete resource grid for the given slot and symbol.
@@ -207,49 +250,59 @@ public:
   expected<uplink_context::uplink_context_resource_grid_info> try_popping_complete_resource_grid_symbol(slot_point slot,
                                                                                                         unsigned symbol)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto                        result = entry(slot, symbol).try_getting_complete_resource_grid();
+    repository_entry& slot_entry = entry(slot, symbol);
+    uint32_t          tag        = context_entry_state::make_tag(slot);
 
-    // Symbol is complete or exists. Clear the context.
-    if (result) {
-      entry(slot, symbol) = {};
+    // Check the completion with shared access, so that the writers of the symbol are not blocked.
+    if (!slot_entry.state.try_lock_shared(tag)) {
+      return make_unexpected(default_error_t{});
     }
+    bool is_complete = slot_entry.context.is_complete();
+    slot_entry.state.unlock_shared();
 
-    return result;
+    // Only one of the threads that find the symbol complete pops it.
+    if (!is_complete || !slot_entry.state.try_lock(tag)) {
+      return make_unexpected(default_error_t{});
+    }
+
+    uplink_context::uplink_context_resource_grid_info info = slot_entry.context.pop_uplink_context_resource_grid_info();
+    slot_entry.context                                     = {};
+    slot_entry.state.unlock(context_entry_state::EMPTY_TAG);
+
+    return info;
   }
 
-  /// Pops a resource grid for the given slot and symbol.
+  /// \brief Pops a resource grid for the given slot and symbol.
+  ///
+  /// The entry is popped regardless of the slot it was added for, which flushes the contexts left over by older slots.
   expected<uplink_context::uplink_context_resource_grid_info> pop_resource_grid_symbol(slot_point slot, unsigned symbol)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-
-    auto& result = entry(slot, symbol);
+    repository_entry& slot_entry = entry(slot, symbol);
+    uint32_t          tag        = slot_entry.state.lock();
 
     // Symbol does not exist. Do nothing.
-    if (result.empty()) {
+    if (slot_entry.context.empty()) {
+      slot_entry.state.unlock(tag);
       return make_unexpected(default_error_t{});
     }
 
     // Pop and clear the slot/symbol information.
-    uplink_context::uplink_context_resource_grid_info info = result.pop_uplink_context_resource_grid_info();
+    uplink_context::uplink_context_resource_grid_info info = slot_entry.context.pop_uplink_context_resource_grid_info();
+    slot_entry.context                                     = {};
+    slot_entry.state.unlock(context_entry_state::EMPTY_TAG);
+
     return info;
   }
 
   /// Clears the repository entry for the given slot and symbol.
-  void clear(slot_point slot, unsigned symbol)
-  {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot, symbol) = {};
-  }
+  void clear(slot_point slot, unsigned symbol) { clear_entry(entry(slot, symbol)); }
 
   /// \brief Clears the whole repository, releasing the ownership of pending shared resource grids.
   void clear()
   {
-    std::lock_guard<std::mutex> lock(mutex);
-
     for (auto& elem : buffer) {
       for (auto& symbol : elem) {
-        symbol = {};
+        clear_entry(symbol);
       }
     }
   }
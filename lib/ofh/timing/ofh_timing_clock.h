@@ -0,0 +1,35 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace ocudu {
+namespace ofh {
+
+/// \brief Open Fronthaul timing clock.
+///
+/// Time source from which the realtime timing worker derives the OTA symbol boundaries.
+class timing_clock
+{
+public:
+  /// Default destructor.
+  virtual ~timing_clock() = default;
+
+  /// Returns the current UTC time as the time elapsed since the Unix epoch.
+  virtual std::chrono::nanoseconds now() = 0;
+
+  /// Blocks the calling thread for the given duration.
+  virtual void sleep_for(std::chrono::nanoseconds duration) = 0;
+};
+
+} // namespace ofh
+} // namespace ocudu
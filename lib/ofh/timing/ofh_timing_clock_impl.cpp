@@ -0,0 +1,89 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ofh_timing_clock_impl.h"
+#include "ocudu/support/error_handling.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace ocudu;
+using namespace ofh;
+
+/// Converts the given timespec to the time elapsed since the clock epoch.
+static std::chrono::nanoseconds to_nanoseconds(const ::timespec& ts)
+{
+  return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+std::chrono::nanoseconds system_timing_clock::now()
+{
+  ::timespec ts;
+  ::clock_gettime(CLOCK_REALTIME, &ts);
+
+  return to_nanoseconds(ts);
+}
+
+void system_timing_clock::sleep_for(std::chrono::nanoseconds duration)
+{
+  std::this_thread::sleep_for(duration);
+}
+
+/// Returns the dynamic POSIX clock identifier of the given clock device file descriptor, as per the Linux kernel
+/// documentation of dynamic POSIX clocks.
+static ::clockid_t fd_to_clock_id(int fd)
+{
+  return static_cast<::clockid_t>((~static_cast<unsigned>(fd) << 3U) | 3U);
+}
+
+ptp_timing_clock::ptp_timing_clock(ocudulog::basic_logger& logger,
+                                   const std::string&      device,
+                                   std::chrono::seconds    utc_offset_) :
+  utc_offset(utc_offset_)
+{
+  fd = ::open(device.c_str(), O_RDONLY);
+  if (fd < 0) {
+    report_error("Unable to open the PTP hardware clock '{}': {}", device, ::strerror(errno));
+  }
+  clock_id = fd_to_clock_id(fd);
+
+  ::timespec ts;
+  if (::clock_gettime(clock_id, &ts) != 0) {
+    report_error("Unable to read the PTP hardware clock '{}': {}", device, ::strerror(errno));
+  }
+
+  logger.info("Using PTP hardware clock '{}' with a UTC offset of '{}s' as the Open Fronthaul timing source",
+              device,
+              utc_offset.count());
+}
+
+ptp_timing_clock::~ptp_timing_clock()
+{
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+std::chrono::nanoseconds ptp_timing_clock::now()
+{
+  ::timespec ts;
+  ::clock_gettime(clock_id, &ts);
+
+  return to_nanoseconds(ts) - utc_offset;
+}
+
+void ptp_timing_clock::sleep_for(std::chrono::nanoseconds duration)
+{
+  // Dynamic clocks do not support sleeping, so sleep on the system clock. The PTP hardware clock and the system clock
+  // run at virtually the same rate, so the error introduced during a symbol duration is negligible.
+  std::this_thread::sleep_for(duration);
+}
@@ -0,0 +1,66 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ofh_timing_clock.h"
+#include "ocudu/ocudulog/logger.h"
+#include <ctime>
+#include <string>
+
+namespace ocudu {
+namespace ofh {
+
+/// Timing clock that reads the system realtime clock.
+class system_timing_clock : public timing_clock
+{
+public:
+  // See interface for documentation.
+  std::chrono::nanoseconds now() override;
+
+  // See interface for documentation.
+  void sleep_for(std::chrono::nanoseconds duration) override;
+};
+
+/// \brief Timing clock that reads a PTP hardware clock.
+///
+/// The hardware clock of the network interface, exposed by the kernel as a \c /dev/ptpN character device, is read
+/// through its dynamic POSIX clock identifier, which avoids the error added by synchronizing the system clock to it.
+/// PTP hardware clocks usually run in TAI time, so the configured UTC offset is subtracted from the clock readings.
+class ptp_timing_clock : public timing_clock
+{
+public:
+  /// \brief Opens the given PTP hardware clock device.
+  ///
+  /// \param[in] logger     Logger.
+  /// \param[in] device     Path of the PTP hardware clock device.
+  /// \param[in] utc_offset Offset between the time of the clock and UTC.
+  ptp_timing_clock(ocudulog::basic_logger& logger, const std::string& device, std::chrono::seconds utc_offset);
+
+  /// Closes the PTP hardware clock device.
+  ~ptp_timing_clock() override;
+
+  // See interface for documentation.
+  std::chrono::nanoseconds now() override;
+
+  // See interface for documentation.
+  void sleep_for(std::chrono::nanoseconds duration) override;
+
+private:
+  /// File descriptor of the PTP hardware clock device.
+  int fd = -1;
+  /// Dynamic clock identifier of the PTP hardware clock.
+  ::clockid_t clock_id;
+  /// Offset between the time of the clock and UTC.
+  const std::chrono::seconds utc_offset;
+};
+
+} // namespace ofh
+} // namespace ocudu
@@ -12,17 +12,22 @@
 
 #include "realtime_timing_worker.h"
 #include "ocudu/ofh/timing/ofh_timing_manager.h"
+#include <memory>
 
 namespace ocudu {
 namespace ofh {
 
 class timing_manager_impl : public timing_manager
 {
-  realtime_timing_worker worker;
+  std::unique_ptr<timing_clock> clock;
+  realtime_timing_worker        worker;
 
 public:
-  timing_manager_impl(ocudulog::basic_logger& logger, task_executor& executor, const realtime_worker_cfg& config) :
-    worker(logger, executor, config)
+  timing_manager_impl(ocudulog::basic_logger&       logger,
+                      task_executor&                executor,
+                      std::unique_ptr<timing_clock> clock_,
+                      const realtime_worker_cfg&    config) :
+    clock(std::move(clock_)), worker(logger, executor, *clock, config)
   {
   }
 
@@ -11,6 +11,7 @@
 #include "ofh_timing_metrics_collector_impl.h"
 #include "../support/metrics_helpers.h"
 #include "ocudu/ofh/timing/ofh_timing_metrics.h"
+#include <algorithm>
 
 using namespace ocudu;
 using namespace ofh;
@@ -30,6 +31,20 @@ void timing_metrics_collector_impl::collect_metrics(timing_metrics& metrics)
       (min_latency_val_ns == default_min_latency_ns) ? 0.f : static_cast<float>(min_latency_val_ns) / 1000.f;
   metrics.notification_max_latency_us =
       (max_latency_val_ns == default_max_latency_ns) ? 0.f : static_cast<float>(max_latency_val_ns) / 1000.f;
+
+  for (unsigned i_bin = 0; i_bin != NOF_WAKEUP_JITTER_HISTOGRAM_BINS; ++i_bin) {
+    metrics.wakeup_jitter_histogram[i_bin] = jitter_histogram[i_bin].exchange(0, std::memory_order_relaxed);
+  }
+  uint32_t jitter_count_val  = jitter_count.exchange(0, std::memory_order_relaxed);
+  uint64_t jitter_sum_val_ns = jitter_sum_ns.exchange(0, std::memory_order_relaxed);
+  uint32_t jitter_min_val_ns = jitter_min_ns.exchange(default_min_latency_ns, std::memory_order_relaxed);
+  uint32_t jitter_max_val_ns = jitter_max_ns.exchange(default_max_latency_ns, std::memory_order_relaxed);
+  metrics.wakeup_jitter_min_us =
+      (jitter_min_val_ns == default_min_latency_ns) ? 0.f : static_cast<float>(jitter_min_val_ns) / 1000.f;
+  metrics.wakeup_jitter_max_us =
+      (jitter_max_val_ns == default_max_latency_ns) ? 0.f : static_cast<float>(jitter_max_val_ns) / 1000.f;
+  metrics.wakeup_jitter_avg_us =
+      jitter_count_val ? static_cast<double>(jitter_sum_val_ns) / jitter_count_val / 1000.0 : 0.f;
 }
 
 void timing_metrics_collector_impl::update_skipped_symbols(unsigned num_skipped_symbols)
@@ -49,3 +64,19 @@ void timing_metrics_collector_impl::update_symbol_notification_latency(std::chro
   count.fetch_add(1u, std::memory_order_relaxed);
   update_minmax(static_cast<uint32_t>(notifier_latency.count()), max_latency_ns, min_latency_ns);
 }
+
+void timing_metrics_collector_impl::update_wakeup_jitter(std::chrono::nanoseconds jitter)
+{
+  // Look for the first bin whose upper edge is above the jitter, the last bin has no upper edge.
+  unsigned jitter_us = std::chrono::duration_cast<std::chrono::microseconds>(jitter).count();
+  unsigned i_bin     = std::distance(wakeup_jitter_histogram_edges_us.begin(),
+                                 std::upper_bound(wakeup_jitter_histogram_edges_us.begin(),
+                                                  wakeup_jitter_histogram_edges_us.end(),
+                                                  jitter_us));
+  jitter_histogram[i_bin].fetch_add(1, std::memory_order_relaxed);
+
+  jitter_sum_ns.fetch_add(jitter.count(), std::memory_order_relaxed);
+  jitter_count.fetch_add(1u, std::memory_order_relaxed);
+
+  update_minmax(static_cast<uint32_t>(jitter.count()), jitter_max_ns, jitter_min_ns);
+}
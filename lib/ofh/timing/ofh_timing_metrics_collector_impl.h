@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include "ocudu/ofh/timing/ofh_timing_metrics.h"
 #include "ocudu/ofh/timing/ofh_timing_metrics_collector.h"
+#include <array>
 #include <atomic>
 #include <chrono>
 
@@ -30,6 +32,9 @@ public:
   /// Updates symbol notification latency statistics.
   void update_symbol_notification_latency(std::chrono::nanoseconds notifier_latency);
 
+  /// Updates the symbol boundary wake-up jitter statistics.
+  void update_wakeup_jitter(std::chrono::nanoseconds jitter);
+
 private:
   /// Default values for min and max latencies.
   static constexpr uint32_t default_min_latency_ns = std::numeric_limits<uint32_t>::max();
@@ -42,6 +47,12 @@ private:
   std::atomic<uint64_t> sum_elapsed_ns = {};
   std::atomic<uint32_t> min_latency_ns = default_min_latency_ns;
   std::atomic<uint32_t> max_latency_ns = default_max_latency_ns;
+
+  std::array<std::atomic<unsigned>, NOF_WAKEUP_JITTER_HISTOGRAM_BINS> jitter_histogram = {};
+  std::atomic<uint32_t>                                                jitter_count     = {};
+  std::atomic<uint64_t>                                                jitter_sum_ns    = {};
+  std::atomic<uint32_t>                                                jitter_min_ns    = default_min_latency_ns;
+  std::atomic<uint32_t>                                                jitter_max_ns    = default_max_latency_ns;
 };
 
 } // namespace ofh
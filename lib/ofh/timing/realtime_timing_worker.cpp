@@ -16,21 +16,23 @@
 #include "ocudu/ran/slot_point_extended.h"
 #include "ocudu/support/rtsan.h"
 #include "ocudu/support/synchronization/sync_event.h"
-#include <thread>
 
 using namespace ocudu;
 using namespace ofh;
 
 realtime_timing_worker::realtime_timing_worker(ocudulog::basic_logger&    logger_,
                                                task_executor&             executor_,
+                                               timing_clock&              clock_,
                                                const realtime_worker_cfg& cfg) :
   logger(logger_),
   executor(executor_),
+  clock(clock_),
   scs(cfg.scs),
   nof_symbols_per_slot(get_nsymb_per_slot(cfg.cp)),
   nof_symbols_per_sec(nof_symbols_per_slot * get_nof_slots_per_subframe(scs) * NOF_SUBFRAMES_PER_FRAME * 100),
   symbol_duration(1e9 / nof_symbols_per_sec),
   sleep_time(std::chrono::duration_cast<std::chrono::nanoseconds>(symbol_duration) / 15),
+  spin_margin(cfg.spin_margin),
   enable_log_warnings_for_lates(cfg.enable_log_warnings_for_lates)
 {
   // The GPS time epoch starts on 1980.1.6 so make sure that the system time is set after this date.
@@ -67,7 +69,7 @@ void realtime_timing_worker::start()
         // Signal start() caller thread that the operation is complete.
         start_token.reset();
 
-        auto now                  = gps_clock::now();
+        auto now                  = get_gps_time();
         auto ns_fraction          = calculate_ns_fraction_from(now);
         last_wakeup_tp            = std::chrono::steady_clock::now();
         previous_symb_index       = get_symbol_index(ns_fraction, symbol_duration);
@@ -130,7 +132,7 @@ void realtime_timing_worker::poll()
 {
   auto sleeping_time = calculate_sleeping_time();
 
-  auto now         = gps_clock::now();
+  auto now         = get_gps_time();
   auto ns_fraction = calculate_ns_fraction_from(now);
 
   auto     current_time_since_epoch = now.time_since_epoch().count();
@@ -144,7 +146,7 @@ void realtime_timing_worker::poll()
     logger.info("Real-time timing worker detected PTP-synchronized time going backward by {}ns", -delta_ns);
 
     OCUDU_RTSAN_SCOPED_DISABLER(d);
-    std::this_thread::sleep_for(sleep_time);
+    clock.sleep_for(sleep_time);
     return;
   }
   // The values are updated after the condition above to avoid notifying again the symbols that have already been
@@ -154,11 +156,14 @@ void realtime_timing_worker::poll()
 
   // Are we still in the same symbol as before?
   if (delta == 0) {
-    OCUDU_RTSAN_SCOPED_DISABLER(d);
-    std::this_thread::sleep_for(sleep_time);
+    wait_for_next_symbol(ns_fraction, current_symbol_index);
     return;
   }
 
+  // Time elapsed between the symbol boundary and its detection.
+  metrics_collector.update_wakeup_jitter(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      ns_fraction - current_symbol_index * symbol_duration));
+
   // Check if we have missed more than one symbol.
   if (OCUDU_UNLIKELY(delta > 1)) {
     logger.info("Real-time timing worker woke up late, skipped '{}' symbols, current symbol is '{}'",
@@ -205,6 +210,20 @@ void realtime_timing_worker::poll()
   }
 }
 
+void realtime_timing_worker::wait_for_next_symbol(std::chrono::nanoseconds ns_fraction, unsigned symbol_index)
+{
+  auto time_to_boundary =
+      std::chrono::duration_cast<std::chrono::nanoseconds>((symbol_index + 1) * symbol_duration - ns_fraction);
+
+  // Spin when the next symbol boundary is close.
+  if (time_to_boundary <= spin_margin) {
+    return;
+  }
+
+  OCUDU_RTSAN_SCOPED_DISABLER(d);
+  clock.sleep_for(time_to_boundary - spin_margin);
+}
+
 void realtime_timing_worker::notify_slot_symbol_point(const slot_symbol_point_context& slot_context)
 {
   ofh_tracer << instant_trace_event("ofh_timing_notify_symbol", instant_trace_event::cpu_scope::global);
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ofh_timing_clock.h"
 #include "ofh_timing_metrics_collector_impl.h"
 #include "ocudu/adt/span.h"
 #include "ocudu/ocudulog/logger.h"
@@ -38,9 +39,17 @@ struct realtime_worker_cfg {
   int gps_Beta;
   /// If set to true, logs late events as warnings, otherwise as info.
   bool enable_log_warnings_for_lates;
+  /// \brief Time before each OTA symbol boundary from which the worker stops sleeping and polls the clock continuously.
+  ///
+  /// The worker sleeps until this time before the next symbol boundary and then spins on the clock until the boundary
+  /// is reached. Larger values reduce the wake-up jitter at the cost of a higher CPU usage.
+  std::chrono::microseconds spin_margin = std::chrono::microseconds(10);
 };
 
-/// Realtime worker that generates OTA symbol notifications.
+/// \brief Realtime worker that generates OTA symbol notifications.
+///
+/// The worker derives the OTA symbol boundaries from the time of the given timing clock. Between symbol boundaries, it
+/// sleeps until shortly before the next boundary and then polls the clock until the boundary is reached.
 class realtime_timing_worker : public operation_controller, public ota_symbol_boundary_notifier_manager
 {
   /// A GPS clock implementation.
@@ -62,25 +71,20 @@ class realtime_timing_worker : public operation_controller, public ota_symbol_bo
     using time_point = std::chrono::time_point<gps_clock>;
     // static constexpr bool is_steady = false;
 
-    static time_point now()
-    {
-      ::timespec ts;
-      ::clock_gettime(CLOCK_REALTIME, &ts);
-
-      time_point now(std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
-
-      return now - gps_offset;
-    }
+    /// Converts the given UTC time, expressed as the time elapsed since the Unix epoch, to GPS time.
+    static time_point from_utc(std::chrono::nanoseconds utc_time) { return time_point(utc_time) - gps_offset; }
   };
 
   ocudulog::basic_logger&                        logger;
   std::vector<ota_symbol_boundary_notifier*>     ota_notifiers;
   task_executor&                                 executor;
+  timing_clock&                                  clock;
   const subcarrier_spacing                       scs;
   const unsigned                                 nof_symbols_per_slot;
   const unsigned                                 nof_symbols_per_sec;
   const std::chrono::duration<double, std::nano> symbol_duration;
   const std::chrono::nanoseconds                 sleep_time;
+  const std::chrono::nanoseconds                 spin_margin;
   bool                                           enable_log_warnings_for_lates;
   unsigned                                       previous_symb_index       = 0;
   gps_clock::rep                                 previous_time_since_epoch = 0;
@@ -89,7 +93,10 @@ class realtime_timing_worker : public operation_controller, public ota_symbol_bo
   timing_metrics_collector_impl                  metrics_collector;
 
 public:
-  realtime_timing_worker(ocudulog::basic_logger& logger_, task_executor& executor_, const realtime_worker_cfg& cfg);
+  realtime_timing_worker(ocudulog::basic_logger&    logger_,
+                         task_executor&             executor_,
+                         timing_clock&              clock_,
+                         const realtime_worker_cfg& cfg);
 
   // See interface for documentation.
   void start() override;
@@ -110,6 +117,15 @@ private:
   /// Polls the system time checking for the start of a new OTA symbol.
   void poll();
 
+  /// Returns the current GPS time of the timing clock.
+  gps_clock::time_point get_gps_time() { return gps_clock::from_utc(clock.now()); }
+
+  /// \brief Waits for the boundary of the symbol that follows the given one.
+  ///
+  /// Sleeps until the spin margin before the next symbol boundary. Returns immediately when the boundary is closer than
+  /// the spin margin, so that the caller polls the clock continuously.
+  void wait_for_next_symbol(std::chrono::nanoseconds ns_fraction, unsigned symbol_index);
+
   /// Notifies the given slot symbol point through the registered notifiers.
   void notify_slot_symbol_point(const slot_symbol_point_context& slot_context);
 
@@ -11,6 +11,7 @@
 #include "ofh_data_flow_uplane_downlink_data_impl.h"
 #include "ofh_uplane_fragment_size_calculator.h"
 #include "ocudu/ocuduvec/conversion.h"
+#include "ocudu/ofh/compression/compression_properties.h"
 #include "ocudu/ofh/ethernet/ethernet_frame_pool.h"
 #include "ocudu/ofh/timing/slot_symbol_point.h"
 #include "ocudu/phy/support/resource_grid_context.h"
@@ -80,6 +81,10 @@ data_flow_uplane_downlink_data_impl::data_flow_uplane_downlink_data_impl(
   ocudu_assert(compressor_sel, "Invalid compressor selector");
   ocudu_assert(up_builder, "Invalid User-Plane message builder");
   ocudu_assert(frame_pool, "Invalid frame pool");
+
+  if (config.are_header_templates_enabled) {
+    header_templates.emplace(*eth_builder, *ecpri_builder, *up_builder, compr_params, config.dl_eaxc);
+  }
 }
 
 void data_flow_uplane_downlink_data_impl::enqueue_section_type_1_message(
@@ -164,11 +169,12 @@ void data_flow_uplane_downlink_data_impl::enqueue_section_type_1_message_symbol_
       uplane_message_params up_params =
           generate_dl_ofh_user_parameters(context.slot, symbol_id, fragment_start_prb, fragment_nof_prbs, compr_params);
 
-      unsigned used_size = enqueue_section_type_1_message_symbol(
-          iq_data.subspan(fragment_start_prb * NOF_SUBCARRIERS_PER_RB, fragment_nof_prbs * NOF_SUBCARRIERS_PER_RB),
-          up_params,
-          context.eaxc,
-          data);
+      span<const cbf16_t> fragment_iq_data =
+          iq_data.subspan(fragment_start_prb * NOF_SUBCARRIERS_PER_RB, fragment_nof_prbs * NOF_SUBCARRIERS_PER_RB);
+      unsigned used_size =
+          (header_templates)
+              ? enqueue_section_type_1_message_symbol_from_template(fragment_iq_data, up_params, context.eaxc, data)
+              : enqueue_section_type_1_message_symbol(fragment_iq_data, up_params, context.eaxc, data);
       scoped_buffer->set_size(used_size);
     } while (!is_last_fragment);
   }
@@ -213,6 +219,42 @@ unsigned data_flow_uplane_downlink_data_impl::enqueue_section_type_1_message_sym
   return eth_buffer.size();
 }
 
+unsigned data_flow_uplane_downlink_data_impl::enqueue_section_type_1_message_symbol_from_template(
+    span<const cbf16_t>          iq_symbol_data,
+    const uplane_message_params& params,
+    unsigned                     eaxc,
+    span<uint8_t>                buffer)
+{
+  // Compress the IQ data right after the headers.
+  units::bytes  header_size  = header_templates->get_header_size();
+  units::bytes  payload_size = get_compressed_prb_size(params.compression_params) * params.nof_prb;
+  span<uint8_t> frame        = buffer.first((header_size + payload_size).value());
+  compressor_sel->compress(frame.last(payload_size.value()), iq_symbol_data, params.compression_params);
+
+  // Copy the header template of the eAxC and patch the fields of this message.
+  header_templates->write_header(frame,
+                                 eaxc,
+                                 generate_ecpri_data_parameters(up_seq_gen.generate(eaxc), eaxc).seq_id,
+                                 params.slot,
+                                 params.symbol_id,
+                                 params.start_prb,
+                                 params.nof_prb);
+
+  if (OCUDU_UNLIKELY(logger.debug.enabled())) {
+    logger.debug("Sector#{}: packing a downlink User-Plane message for slot '{}' and eAxC '{}', symbol_id '{}', PRB "
+                 "range '{}:{}', size '{}' bytes",
+                 sector_id,
+                 params.slot,
+                 eaxc,
+                 params.symbol_id,
+                 params.start_prb,
+                 params.nof_prb,
+                 frame.size());
+  }
+
+  return frame.size();
+}
+
 data_flow_message_encoding_metrics_collector* data_flow_uplane_downlink_data_impl::get_metrics_collector()
 {
   return nullptr;
@@ -12,6 +12,7 @@
 
 #include "../operation_controller_dummy.h"
 #include "ofh_data_flow_uplane_downlink_data.h"
+#include "ofh_uplane_header_template_cache.h"
 #include "sequence_identifier_generator.h"
 #include "ocudu/instrumentation/traces/ofh_traces.h"
 #include "ocudu/ocudulog/ocudulog.h"
@@ -20,6 +21,7 @@
 #include "ocudu/ofh/ethernet/ethernet_frame_builder.h"
 #include "ocudu/ofh/serdes/ofh_uplane_message_builder.h"
 #include "ocudu/ran/cyclic_prefix.h"
+#include <optional>
 
 namespace ocudu {
 struct resource_grid_context;
@@ -42,6 +44,11 @@ struct data_flow_uplane_downlink_data_impl_config {
   static_vector<unsigned, MAX_NOF_SUPPORTED_EAXC> dl_eaxc;
   /// Compression parameters.
   ru_compression_params compr_params;
+  /// \brief Enables the User-Plane header templates.
+  ///
+  /// When enabled, the message headers are copied from templates pre-serialized for each downlink eAxC and only the
+  /// fields that change from one message to another are patched, instead of building the headers field by field.
+  bool are_header_templates_enabled = false;
 };
 
 /// Open Fronthaul User-Plane downlink data flow implementation dependencies.
@@ -112,23 +119,30 @@ private:
                                                  unsigned                     eaxc,
                                                  span<uint8_t>                buffer);
 
+  /// Enqueues an User-Plane message symbol using the header template of the eAxC.
+  unsigned enqueue_section_type_1_message_symbol_from_template(span<const cbf16_t>          iq_symbol_data,
+                                                               const uplane_message_params& params,
+                                                               unsigned                     eaxc,
+                                                               span<uint8_t>                buffer);
+
   // See interface for documentation.
   data_flow_message_encoding_metrics_collector* get_metrics_collector() override;
 
 private:
-  ocudulog::basic_logger&                   logger;
-  const unsigned                            nof_symbols_per_slot;
-  const unsigned                            ru_nof_prbs;
-  const unsigned                            sector_id;
-  const ru_compression_params               compr_params;
-  operation_controller_dummy                controller;
-  sequence_identifier_generator             up_seq_gen;
-  std::shared_ptr<ether::eth_frame_pool>    frame_pool;
-  std::unique_ptr<iq_compressor>            compressor_sel;
-  std::unique_ptr<ether::frame_builder>     eth_builder;
-  std::unique_ptr<ecpri::packet_builder>    ecpri_builder;
-  std::unique_ptr<uplane_message_builder>   up_builder;
-  ofh_uplane_trace_names<OFH_TRACE_ENABLED> formatted_trace_names;
+  ocudulog::basic_logger&                     logger;
+  const unsigned                              nof_symbols_per_slot;
+  const unsigned                              ru_nof_prbs;
+  const unsigned                              sector_id;
+  const ru_compression_params                 compr_params;
+  operation_controller_dummy                  controller;
+  sequence_identifier_generator               up_seq_gen;
+  std::shared_ptr<ether::eth_frame_pool>      frame_pool;
+  std::unique_ptr<iq_compressor>              compressor_sel;
+  std::unique_ptr<ether::frame_builder>       eth_builder;
+  std::unique_ptr<ecpri::packet_builder>      ecpri_builder;
+  std::unique_ptr<uplane_message_builder>     up_builder;
+  std::optional<uplane_header_template_cache> header_templates;
+  ofh_uplane_trace_names<OFH_TRACE_ENABLED>   formatted_trace_names;
 };
 
 } // namespace ofh
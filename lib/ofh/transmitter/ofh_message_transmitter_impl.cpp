@@ -11,29 +11,35 @@
 #include "ofh_message_transmitter_impl.h"
 #include "ocudu/adt/static_vector.h"
 #include "ocudu/instrumentation/traces/ofh_traces.h"
+#include <algorithm>
 
 using namespace ocudu;
 using namespace ofh;
 
 message_transmitter_impl::message_transmitter_impl(ocudulog::basic_logger&                logger_,
+                                                   task_executor&                         executor_,
                                                    const tx_window_timing_parameters&     timing_params_,
+                                                   const tx_pacing_parameters&            pacing_params_,
                                                    bool                                   are_metrics_enabled,
                                                    std::unique_ptr<ether::transmitter>    transmitter,
                                                    std::shared_ptr<ether::eth_frame_pool> pool_dl_cp_,
                                                    std::shared_ptr<ether::eth_frame_pool> pool_ul_cp_,
                                                    std::shared_ptr<ether::eth_frame_pool> pool_dl_up_) :
   logger(logger_),
+  executor(executor_),
   pool_dl_cp(std::move(pool_dl_cp_)),
   pool_ul_cp(std::move(pool_ul_cp_)),
   pool_dl_up(std::move(pool_dl_up_)),
   eth_transmitter(std::move(transmitter)),
   metrics_collector(are_metrics_enabled),
-  timing_params(timing_params_)
+  timing_params(timing_params_),
+  pacing_params(pacing_params_)
 {
   ocudu_assert(eth_transmitter, "Invalid Ethernet transmitter");
   ocudu_assert(pool_dl_cp, "Invalid Control-Plane downlink frame pool");
   ocudu_assert(pool_ul_cp, "Invalid Control-Plane uplink frame pool");
   ocudu_assert(pool_dl_up, "Invalid User-Plane downlink frame pool");
+  ocudu_assert(pacing_params.nof_batches_per_symbol > 0, "Invalid number of transmission batches per symbol");
 }
 
 void message_transmitter_impl::transmit_frame_burst(span<span<const uint8_t>> frame_burst)
@@ -49,6 +55,81 @@ void message_transmitter_impl::transmit_frame_burst(span<span<const uint8_t>> fr
   }
 }
 
+void message_transmitter_impl::transmit_paced_frame_burst(
+    static_vector<ether::scoped_frame_buffer, ether::MAX_TX_BURST_SIZE>& frames,
+    std::chrono::time_point<std::chrono::system_clock>                   symbol_start)
+{
+  // The batches of the previous symbol that are still pending are sent now, so that they precede the new ones.
+  transmit_paced_batches(true);
+
+  if (frames.empty()) {
+    return;
+  }
+
+  for (ether::scoped_frame_buffer& frame : frames) {
+    paced_burst.frame_burst.emplace_back(frame->data());
+    paced_burst.frames.push_back(std::move(frame));
+  }
+  paced_burst.symbol_start = symbol_start;
+  paced_burst.nof_batches  = std::min(pacing_params.nof_batches_per_symbol, unsigned(paced_burst.frames.size()));
+  paced_burst.next_batch   = 0;
+
+  transmit_paced_batches(false);
+
+  if (!is_paced_batch_task_pending && (paced_burst.next_batch != paced_burst.nof_batches)) {
+    run_paced_batch_task();
+  }
+}
+
+void message_transmitter_impl::transmit_paced_batches(bool flush)
+{
+  unsigned                 nof_frames     = paced_burst.frame_burst.size();
+  std::chrono::nanoseconds batch_interval = pacing_params.symbol_duration / pacing_params.nof_batches_per_symbol;
+  std::chrono::time_point<std::chrono::system_clock> now = std::chrono::system_clock::now();
+
+  for (; paced_burst.next_batch != paced_burst.nof_batches; ++paced_burst.next_batch) {
+    // Stop at the first batch whose time slot has not started yet.
+    std::chrono::time_point<std::chrono::system_clock> batch_start =
+        paced_burst.symbol_start + paced_burst.next_batch * batch_interval;
+    if (!flush && (now < batch_start)) {
+      return;
+    }
+    metrics_collector.update_batch_stats(now < batch_start + batch_interval);
+
+    // Distribute the frames evenly among the batches.
+    unsigned frame_begin = (paced_burst.next_batch * nof_frames) / paced_burst.nof_batches;
+    unsigned frame_end   = ((paced_burst.next_batch + 1) * nof_frames) / paced_burst.nof_batches;
+    transmit_frame_burst(
+        span<span<const uint8_t>>(paced_burst.frame_burst).subspan(frame_begin, frame_end - frame_begin));
+  }
+
+  // Release the frames once all the batches have been transmitted.
+  paced_burst.frame_burst.clear();
+  paced_burst.frames.clear();
+}
+
+void message_transmitter_impl::run_paced_batch_task()
+{
+  is_paced_batch_task_pending = false;
+
+  auto token = stop_manager.get_token();
+  if (OCUDU_UNLIKELY(token.is_stop_requested())) {
+    return;
+  }
+
+  transmit_paced_batches(false);
+  if (paced_burst.next_batch == paced_burst.nof_batches) {
+    return;
+  }
+
+  is_paced_batch_task_pending = true;
+  if (!executor.defer([this, tk = std::move(token)]() noexcept OCUDU_RTSAN_NONBLOCKING { run_paced_batch_task(); })) {
+    logger.warning("Failed to defer the transmission of the paced batches, sending the pending batches now");
+    is_paced_batch_task_pending = false;
+    transmit_paced_batches(true);
+  }
+}
+
 void message_transmitter_impl::enqueue_messages_into_burst(
     const ether::frame_pool_interval&                                    interval,
     ofh::message_type                                                    type,
@@ -113,7 +194,12 @@ void message_transmitter_impl::on_new_symbol(const slot_symbol_point_context& sy
 
   // Transmit the data.
   trace_point tp_ether = ofh_tracer.now();
-  transmit_frame_burst(frame_burst);
+  if (pacing_params.nof_batches_per_symbol > 1) {
+    transmit_paced_frame_burst(read_frames, symbol_point_context.time_point);
+  } else {
+    transmit_frame_burst(frame_burst);
+  }
+  metrics_collector.update_burst_stats(frame_burst.size());
 
   ofh_tracer << trace_event("ofh_ether_tx", tp_ether);
   ofh_tracer << trace_event("ofh_message_transmitter", tp);
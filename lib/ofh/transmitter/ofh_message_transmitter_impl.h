@@ -15,17 +15,47 @@
 #include "ocudu/ofh/ethernet/ethernet_transmitter.h"
 #include "ocudu/ofh/timing/ofh_ota_symbol_boundary_notifier.h"
 #include "ocudu/ofh/transmitter/ofh_transmitter_timing_parameters.h"
+#include "ocudu/support/executors/task_executor.h"
+#include "ocudu/support/synchronization/stop_event.h"
 
 namespace ocudu {
 namespace ofh {
 
+/// Message transmitter pacing parameters.
+struct tx_pacing_parameters {
+  /// Number of batches in which the frames of a symbol are transmitted. One batch disables the pacing.
+  unsigned nof_batches_per_symbol = 1;
+  /// OFDM symbol duration.
+  std::chrono::nanoseconds symbol_duration;
+};
+
 /// \brief Transmits enqueued Open Fronthaul messages through an Ethernet transmitter.
 ///
-/// Message transmission is managed according the given transmission window.
+/// Message transmission is managed according the given transmission window. When pacing is enabled, the frames
+/// transmitted in a symbol are split into batches that are spread evenly across the symbol duration, starting at the
+/// symbol boundary, instead of being sent back to back. The batches that are not due yet are sent by a task that
+/// defers itself in the transmitter executor until they are, so other tasks of the executor, such as the Ethernet
+/// receiver, keep running in the meantime.
 class message_transmitter_impl : public ota_symbol_boundary_notifier
 {
+  /// Frames of a symbol transmitted in paced batches.
+  struct paced_frame_burst {
+    /// Frames of the symbol, which are kept reserved until all the batches are transmitted.
+    static_vector<ether::scoped_frame_buffer, ether::MAX_TX_BURST_SIZE> frames;
+    /// Data of the frames of the symbol.
+    static_vector<span<const uint8_t>, ether::MAX_TX_BURST_SIZE> frame_burst;
+    /// Start time of the symbol.
+    std::chrono::time_point<std::chrono::system_clock> symbol_start;
+    /// Number of batches in which the frames are transmitted.
+    unsigned nof_batches = 0;
+    /// Index of the next batch to transmit.
+    unsigned next_batch = 0;
+  };
+
   /// Logger.
   ocudulog::basic_logger& logger;
+  /// Transmitter task executor, used to transmit the paced batches.
+  task_executor& executor;
   /// Downlink Control-Plane ethernet frame pool.
   std::shared_ptr<ether::eth_frame_pool> pool_dl_cp;
   /// Uplink Control-Plane ethernet frame pool.
@@ -38,16 +68,32 @@ class message_transmitter_impl : public ota_symbol_boundary_notifier
   message_transmitter_metrics_collector metrics_collector;
   /// Internal representation of timing parameters.
   const tx_window_timing_parameters timing_params;
+  /// Pacing parameters.
+  const tx_pacing_parameters pacing_params;
+  /// Frames of the last symbol transmitted with pacing.
+  paced_frame_burst paced_burst;
+  /// Set to true when a task transmitting the paced batches is deferred in the executor.
+  bool is_paced_batch_task_pending = false;
+  /// Stop manager of the tasks transmitting the paced batches.
+  rt_stop_event_source stop_manager;
 
 public:
   message_transmitter_impl(ocudulog::basic_logger&                logger_,
+                           task_executor&                         executor_,
                            const tx_window_timing_parameters&     timing_params_,
+                           const tx_pacing_parameters&            pacing_params_,
                            bool                                   are_metrics_enabled,
                            std::unique_ptr<ether::transmitter>    eth_transmitter,
                            std::shared_ptr<ether::eth_frame_pool> pool_dl_cp_,
                            std::shared_ptr<ether::eth_frame_pool> pool_ul_cp_,
                            std::shared_ptr<ether::eth_frame_pool> pool_dl_up_);
 
+  /// Starts the message transmitter.
+  void start() { stop_manager.reset(); }
+
+  /// Stops the message transmitter, waiting for the pending paced batch transmission task to finish.
+  void stop() { stop_manager.stop(); }
+
   // See interface for documentation.
   void on_new_symbol(const slot_symbol_point_context& symbol_point_context) override;
 
@@ -61,6 +107,20 @@ private:
   /// Transmits the given frame burst.
   void transmit_frame_burst(span<span<const uint8_t>> frame_burst);
 
+  /// \brief Transmits the given frames in batches spread evenly across the symbol that starts at the given time point.
+  ///
+  /// The batches that are due are transmitted right away and the rest are transmitted by a deferred task.
+  void transmit_paced_frame_burst(static_vector<ether::scoped_frame_buffer, ether::MAX_TX_BURST_SIZE>& frames,
+                                  std::chrono::time_point<std::chrono::system_clock>                   symbol_start);
+
+  /// \brief Transmits the pending paced batches.
+  ///
+  /// \param[in] flush Transmits all the pending batches when set to true, otherwise only the batches that are due.
+  void transmit_paced_batches(bool flush);
+
+  /// Transmits the due paced batches and defers itself in the executor while batches remain pending.
+  void run_paced_batch_task();
+
   /// Enqueues pending frames that match the given interval into the output buffer.
   void enqueue_messages_into_burst(const ether::frame_pool_interval&                                    interval,
                                    ofh::message_type                                                    type,
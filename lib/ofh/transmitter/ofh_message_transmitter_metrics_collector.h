@@ -37,6 +37,34 @@ public:
     update_minmax(static_cast<uint32_t>(exec_latency.count()), max_latency_ns, min_latency_ns);
   }
 
+  /// Updates the burst statistics given the number of frames transmitted in a symbol.
+  void update_burst_stats(unsigned nof_frames)
+  {
+    if (is_disabled || nof_frames == 0) {
+      return;
+    }
+
+    nof_bursts.fetch_add(1U, std::memory_order_relaxed);
+    sum_burst_frames.fetch_add(nof_frames, std::memory_order_relaxed);
+    if (nof_frames > max_burst_frames.load(std::memory_order_relaxed)) {
+      max_burst_frames.store(nof_frames, std::memory_order_relaxed);
+    }
+  }
+
+  /// Updates the pacing statistics given whether a transmission batch was sent within its time slot.
+  void update_batch_stats(bool is_on_time)
+  {
+    if (is_disabled) {
+      return;
+    }
+
+    if (is_on_time) {
+      nof_on_time_batches.fetch_add(1U, std::memory_order_relaxed);
+    } else {
+      nof_late_batches.fetch_add(1U, std::memory_order_relaxed);
+    }
+  }
+
   /// Collects message transmitter metrics.
   void collect_metrics(message_transmitter_metrics& metrics)
   {
@@ -59,6 +87,13 @@ public:
 
     metrics.cpu_usage_us = static_cast<double>(sum_elapsed_val_ns) / 1000.0;
 
+    uint32_t nof_bursts_val = nof_bursts.load(std::memory_order_relaxed);
+    metrics.avg_symbol_burst_size =
+        nof_bursts_val ? static_cast<float>(sum_burst_frames.load(std::memory_order_relaxed)) / nof_bursts_val : 0.f;
+    metrics.max_symbol_burst_size = max_burst_frames.load(std::memory_order_relaxed);
+    metrics.nof_on_time_batches   = nof_on_time_batches.load(std::memory_order_relaxed);
+    metrics.nof_late_batches      = nof_late_batches.load(std::memory_order_relaxed);
+
     reset();
   }
 
@@ -74,12 +109,22 @@ private:
     sum_elapsed_ns.store(0, std::memory_order_relaxed);
     min_latency_ns.store(default_min_latency_ns, std::memory_order_relaxed);
     max_latency_ns.store(default_max_latency_ns, std::memory_order_relaxed);
+    nof_bursts.store(0, std::memory_order_relaxed);
+    sum_burst_frames.store(0, std::memory_order_relaxed);
+    max_burst_frames.store(0, std::memory_order_relaxed);
+    nof_on_time_batches.store(0, std::memory_order_relaxed);
+    nof_late_batches.store(0, std::memory_order_relaxed);
   }
 
-  std::atomic<uint32_t> count          = {};
-  std::atomic<uint64_t> sum_elapsed_ns = {};
-  std::atomic<uint32_t> min_latency_ns = default_min_latency_ns;
-  std::atomic<uint32_t> max_latency_ns = default_max_latency_ns;
+  std::atomic<uint32_t> count               = {};
+  std::atomic<uint64_t> sum_elapsed_ns      = {};
+  std::atomic<uint32_t> min_latency_ns      = default_min_latency_ns;
+  std::atomic<uint32_t> max_latency_ns      = default_max_latency_ns;
+  std::atomic<uint32_t> nof_bursts          = {};
+  std::atomic<uint64_t> sum_burst_frames    = {};
+  std::atomic<uint32_t> max_burst_frames    = {};
+  std::atomic<uint32_t> nof_on_time_batches = {};
+  std::atomic<uint32_t> nof_late_batches    = {};
 
   const bool is_disabled;
 };
@@ -87,6 +87,8 @@ create_data_flow_uplane_data(const transmitter_config&              tx_config,
   config.dl_eaxc      = tx_config.dl_eaxc;
   config.compr_params = tx_config.dl_compr_params;
   config.cp           = tx_config.cp;
+  // The User-Plane headers only depend on the eAxC and the slot timing, so they are built from templates.
+  config.are_header_templates_enabled = true;
 
   ether::vlan_frame_params ether_params;
   ether_params.eth_type        = ether::ECPRI_ETH_TYPE;
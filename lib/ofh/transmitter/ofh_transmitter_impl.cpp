@@ -46,6 +46,16 @@ resolve_uplink_request_handler_dependencies(transmitter_impl_dependencies& tx_de
           tx_dependencies.frame_pool_ul_cp};
 }
 
+static tx_pacing_parameters generate_tx_pacing_parameters(const transmitter_config& tx_config)
+{
+  tx_pacing_parameters params;
+  params.nof_batches_per_symbol = tx_config.nof_tx_batches_per_symbol;
+  params.symbol_duration        = std::chrono::nanoseconds(
+      1000000 / (get_nsymb_per_slot(tx_config.cp) * get_nof_slots_per_subframe(tx_config.scs)));
+
+  return params;
+}
+
 static downlink_handler_impl_config generate_downlink_handler_config(const transmitter_config& tx_config)
 {
   downlink_handler_impl_config out_cfg;
@@ -81,7 +91,9 @@ transmitter_impl::transmitter_impl(const transmitter_config& config, transmitter
                      resolve_uplink_request_handler_dependencies(dependencies)),
   ul_task_dispatcher(config.sector, *dependencies.logger, ul_request_handler, *dependencies.dl_executor),
   msg_transmitter(*dependencies.logger,
+                  *dependencies.executor,
                   config.tx_timing_params,
+                  generate_tx_pacing_parameters(config),
                   config.are_metrics_enabled,
                   std::move(dependencies.eth_transmitter),
                   std::move(dependencies.frame_pool_dl_cp),
@@ -103,6 +115,7 @@ transmitter_impl::transmitter_impl(const transmitter_config& config, transmitter
 
 void transmitter_impl::start()
 {
+  msg_transmitter.start();
   ota_dispatcher.start();
   ul_task_dispatcher.start();
   dl_handler.start();
@@ -113,6 +126,7 @@ void transmitter_impl::stop()
   dl_handler.stop();
   ul_task_dispatcher.stop();
   ota_dispatcher.stop();
+  msg_transmitter.stop();
 }
 
 uplink_request_handler& transmitter_impl::get_uplink_request_handler()
@@ -0,0 +1,131 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ofh_uplane_header_template_cache.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/ofh/ecpri/ecpri_constants.h"
+#include "ocudu/ofh/ecpri/ecpri_packet_builder.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_builder.h"
+#include "ocudu/ofh/serdes/ofh_uplane_message_builder.h"
+#include "ocudu/ran/resource_block.h"
+#include <algorithm>
+#include <vector>
+
+using namespace ocudu;
+using namespace ofh;
+
+/// Offset of the payload size field within the eCPRI common header.
+static constexpr unsigned ECPRI_PAYLOAD_SIZE_OFFSET = 2;
+/// Offset of the sequence identifier field within the eCPRI IQ data header.
+static constexpr unsigned ECPRI_SEQ_ID_OFFSET = 6;
+/// Offset of the frame identifier field within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_FRAME_ID_OFFSET = 1;
+/// Offset of the subframe and slot identifier fields within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_SUBFRAME_SLOT_OFFSET = 2;
+/// Offset of the slot LSBs and symbol identifier fields within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_SLOT_SYMBOL_OFFSET = 3;
+/// Offset of the octet carrying the 2 MSBs of the start PRB within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_START_PRB_MSB_OFFSET = 5;
+/// Offset of the 8 LSBs of the start PRB within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_START_PRB_LSB_OFFSET = 6;
+/// Offset of the number of PRBs field within the Open Fronthaul User-Plane header.
+static constexpr unsigned OFH_NOF_PRB_OFFSET = 7;
+
+uplane_header_template_cache::uplane_header_template_cache(ether::frame_builder&        eth_builder,
+                                                           ecpri::packet_builder&       ecpri_builder,
+                                                           uplane_message_builder&      up_builder,
+                                                           const ru_compression_params& compr_params,
+                                                           span<const unsigned>         eaxcs)
+{
+  units::bytes eth_hdr_size   = eth_builder.get_header_size();
+  units::bytes ecpri_hdr_size = ecpri_builder.get_header_size(ecpri::message_type::iq_data);
+  units::bytes ofh_hdr_size   = up_builder.get_header_size(compr_params);
+
+  ecpri_offset = eth_hdr_size.value();
+  ofh_offset   = (eth_hdr_size + ecpri_hdr_size).value();
+  header_size  = (eth_hdr_size + ecpri_hdr_size + ofh_hdr_size).value();
+  ocudu_assert(header_size <= MAX_HEADER_SIZE,
+               "User-Plane header size (i.e., {}) exceeds the maximum template size (i.e., {})",
+               header_size,
+               MAX_HEADER_SIZE);
+
+  // Build a message of a single PRB per eAxC with the given builders and keep its headers.
+  unsigned                                    prb_size = get_compressed_prb_size(compr_params).value();
+  std::vector<uint8_t>                        frame(header_size + prb_size);
+  std::array<cbf16_t, NOF_SUBCARRIERS_PER_RB> iq_data = {};
+
+  uplane_message_params up_params;
+  up_params.direction                     = data_direction::downlink;
+  up_params.slot                          = slot_point(0, 0, 0);
+  up_params.filter_index                  = filter_index_type::standard_channel_filter;
+  up_params.start_prb                     = 0;
+  up_params.nof_prb                       = 1;
+  up_params.symbol_id                     = 0;
+  up_params.sect_type                     = section_type::type_1;
+  up_params.compression_params.type       = compr_params.type;
+  up_params.compression_params.data_width = compr_params.data_width;
+
+  for (unsigned eaxc : eaxcs) {
+    ocudu_assert(eaxc < MAX_SUPPORTED_EAXC_ID_VALUE,
+                 "Invalid eAxC value '{}'. Maximum eAxC value is '{}'",
+                 eaxc,
+                 MAX_SUPPORTED_EAXC_ID_VALUE);
+
+    std::fill(frame.begin(), frame.end(), 0);
+    span<uint8_t> frame_view(frame);
+
+    unsigned nof_bytes = up_builder.build_message(frame_view.last(frame.size() - ofh_offset), iq_data, up_params);
+    ecpri_builder.build_data_packet(frame_view.subspan(ecpri_offset, ecpri_hdr_size.value() + nof_bytes),
+                                    {static_cast<uint16_t>(eaxc), 0});
+    eth_builder.build_frame(frame_view.first(ofh_offset + nof_bytes));
+
+    std::copy(frame.begin(), frame.begin() + header_size, templates[eaxc].begin());
+    is_template_built[eaxc] = true;
+  }
+}
+
+void uplane_header_template_cache::write_header(span<uint8_t> frame,
+                                                unsigned      eaxc,
+                                                uint16_t      ecpri_seq_id,
+                                                slot_point    slot,
+                                                unsigned      symbol_id,
+                                                unsigned      start_prb,
+                                                unsigned      nof_prb) const
+{
+  ocudu_assert(eaxc < MAX_SUPPORTED_EAXC_ID_VALUE && is_template_built[eaxc],
+               "No User-Plane header template for eAxC '{}'",
+               eaxc);
+  ocudu_assert(frame.size() >= header_size,
+               "Frame size (i.e., {}) is smaller than the header size (i.e., {})",
+               frame.size(),
+               header_size);
+
+  std::copy(templates[eaxc].begin(), templates[eaxc].begin() + header_size, frame.begin());
+
+  // Patch the eCPRI payload size and sequence identifier.
+  uint8_t* ecpri_header = frame.data() + ecpri_offset;
+  uint16_t payload_size = frame.size() - ecpri_offset - ecpri::ECPRI_COMMON_HEADER_SIZE.value();
+  ecpri_header[ECPRI_PAYLOAD_SIZE_OFFSET]     = payload_size >> 8U;
+  ecpri_header[ECPRI_PAYLOAD_SIZE_OFFSET + 1] = payload_size & 0xffU;
+  ecpri_header[ECPRI_SEQ_ID_OFFSET]           = ecpri_seq_id >> 8U;
+  ecpri_header[ECPRI_SEQ_ID_OFFSET + 1]       = ecpri_seq_id & 0xffU;
+
+  // Patch the radio application header.
+  uint8_t* ofh_header                  = frame.data() + ofh_offset;
+  ofh_header[OFH_FRAME_ID_OFFSET]      = uint8_t(slot.sfn());
+  ofh_header[OFH_SUBFRAME_SLOT_OFFSET] = (uint8_t(slot.subframe_index()) << 4U) |
+                                         uint8_t(slot.subframe_slot_index() >> 2U);
+  ofh_header[OFH_SLOT_SYMBOL_OFFSET]   = (uint8_t(slot.subframe_slot_index() & 0x3) << 6U) | uint8_t(symbol_id);
+
+  // Patch the PRB range of the section, keeping the section identifier, rb and symInc fields of the template.
+  ofh_header[OFH_START_PRB_MSB_OFFSET] = (ofh_header[OFH_START_PRB_MSB_OFFSET] & 0xfcU) | ((start_prb >> 8U) & 0x3U);
+  ofh_header[OFH_START_PRB_LSB_OFFSET] = uint8_t(start_prb);
+  ofh_header[OFH_NOF_PRB_OFFSET]       = (nof_prb > std::numeric_limits<uint8_t>::max()) ? 0 : uint8_t(nof_prb);
+}
@@ -0,0 +1,100 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/span.h"
+#include "ocudu/ofh/compression/compression_params.h"
+#include "ocudu/ofh/ofh_constants.h"
+#include "ocudu/ran/slot_point.h"
+#include "ocudu/support/units.h"
+#include <array>
+
+namespace ocudu {
+
+namespace ether {
+class frame_builder;
+}
+
+namespace ecpri {
+class packet_builder;
+}
+
+namespace ofh {
+
+class uplane_message_builder;
+
+/// \brief Cache of pre-serialized downlink User-Plane message headers.
+///
+/// Stores, for every downlink eAxC, the Ethernet, eCPRI and Open Fronthaul headers of a downlink User-Plane message
+/// with a single section type 1, serialized once at construction by the given builders. The data direction, the
+/// section layout and the compression parameters are fixed for the data flow that owns the cache, so the eAxC is the
+/// only key of the cache.
+///
+/// Building a message header consists of copying the template of the eAxC and patching the fields that change from
+/// one message to another, which are the eCPRI payload size and sequence identifier, the frame, subframe, slot and
+/// symbol identifiers, and the PRB range of the section.
+class uplane_header_template_cache
+{
+public:
+  /// \brief Constructs the header templates of the given eAxCs.
+  ///
+  /// \param[in] eth_builder   Ethernet frame builder.
+  /// \param[in] ecpri_builder eCPRI packet builder.
+  /// \param[in] up_builder    User-Plane message builder.
+  /// \param[in] compr_params  Compression parameters of the User-Plane messages.
+  /// \param[in] eaxcs         Downlink eAxCs.
+  uplane_header_template_cache(ether::frame_builder&        eth_builder,
+                               ecpri::packet_builder&       ecpri_builder,
+                               uplane_message_builder&      up_builder,
+                               const ru_compression_params& compr_params,
+                               span<const unsigned>         eaxcs);
+
+  /// Returns the size of the headers, including the Ethernet, eCPRI and Open Fronthaul headers.
+  units::bytes get_header_size() const { return units::bytes(header_size); }
+
+  /// \brief Writes the headers of a downlink User-Plane message in the given buffer.
+  ///
+  /// \param[out] frame         Ethernet frame, including the headers and the compressed IQ data that follow them.
+  /// \param[in]  eaxc          eAxC of the message.
+  /// \param[in]  ecpri_seq_id  eCPRI sequence identifier field of the message.
+  /// \param[in]  slot          Slot of the message.
+  /// \param[in]  symbol_id     Symbol index within the slot.
+  /// \param[in]  start_prb     First PRB of the section.
+  /// \param[in]  nof_prb       Number of PRBs of the section.
+  void write_header(span<uint8_t> frame,
+                    unsigned      eaxc,
+                    uint16_t      ecpri_seq_id,
+                    slot_point    slot,
+                    unsigned      symbol_id,
+                    unsigned      start_prb,
+                    unsigned      nof_prb) const;
+
+private:
+  /// Maximum size of the headers of a User-Plane message.
+  static constexpr unsigned MAX_HEADER_SIZE = 64;
+
+  /// Header template type.
+  using header_template = std::array<uint8_t, MAX_HEADER_SIZE>;
+
+  /// Size of the headers.
+  unsigned header_size = 0;
+  /// Offset of the eCPRI header within the frame.
+  unsigned ecpri_offset = 0;
+  /// Offset of the Open Fronthaul User-Plane header within the frame.
+  unsigned ofh_offset = 0;
+  /// Header templates indexed by eAxC.
+  std::array<header_template, MAX_SUPPORTED_EAXC_ID_VALUE> templates;
+  /// Flags that tell whether the template of an eAxC has been built.
+  std::array<bool, MAX_SUPPORTED_EAXC_ID_VALUE> is_template_built = {};
+};
+
+} // namespace ofh
+} // namespace ocudu
@@ -0,0 +1,40 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "dft_processor_ci16_generic_impl.h"
+#include "ocudu/ocuduvec/conversion.h"
+
+using namespace ocudu;
+
+dft_processor_ci16_generic_impl::dft_processor_ci16_generic_impl(const configuration& config) :
+  dir(config.dir),
+  dft({.size = config.size,
+       .dir  = (config.dir == direction::direct) ? dft_processor::direction::DIRECT : dft_processor::direction::INVERSE})
+{
+}
+
+void dft_processor_ci16_generic_impl::run(span<ci16_t> out, span<const ci16_t> in)
+{
+  unsigned dft_size = dft.get_size();
+  ocudu_assert(out.size() == dft_size,
+               "The DFT output size (i.e., {}) is not equal to the DFT size (i.e., {})",
+               out.size(),
+               dft_size);
+  ocudu_assert(in.size() == dft_size,
+               "The DFT input size (i.e., {}) is not equal to the DFT size (i.e., {})",
+               in.size(),
+               dft_size);
+
+  ocuduvec::convert(dft.get_input(), in, 1.0F);
+  span<const cf_t> result = dft.run();
+
+  // The output is divided by the DFT size independently of the direction.
+  ocuduvec::convert(out, result, 1.0F / static_cast<float>(dft_size));
+}
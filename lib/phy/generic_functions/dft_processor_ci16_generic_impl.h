@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "dft_processor_generic_impl.h"
+#include "ocudu/phy/generic_functions/dft_processor_ci16.h"
+
+namespace ocudu {
+
+/// \brief Generic DFT processor for 16-bit complex integer samples.
+///
+/// The samples are converted to single precision floating point and transformed with the generic DFT. Therefore, it
+/// supports the same sizes as the generic DFT and it is available for any processor architecture.
+class dft_processor_ci16_generic_impl : public dft_processor_ci16
+{
+public:
+  /// \brief Constructs a generic DFT processor for 16-bit complex integer samples.
+  /// \param[in] config Provides the DFT processor parameters.
+  explicit dft_processor_ci16_generic_impl(const configuration& config);
+
+  /// Determines whether the initialization was successful.
+  bool is_valid() const { return dft.is_valid(); }
+
+  // See interface for documentation.
+  direction get_direction() const override { return dir; }
+
+  // See interface for documentation.
+  unsigned get_size() const override { return dft.get_size(); }
+
+  // See interface for documentation.
+  void run(span<ci16_t> out, span<const ci16_t> in) override;
+
+private:
+  /// DFT direction.
+  direction dir;
+  /// Floating point DFT.
+  dft_processor_generic_impl dft;
+};
+
+} // namespace ocudu
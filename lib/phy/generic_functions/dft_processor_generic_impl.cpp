@@ -9,6 +9,8 @@
  */
 
 #include "dft_processor_generic_impl.h"
+#include "ocudu/ocuduvec/prod.h"
+#include "ocudu/ocuduvec/sc_prod.h"
 #include "ocudu/ocuduvec/simd.h"
 #include "ocudu/support/math/math_utils.h"
 #include <cmath>
@@ -193,13 +195,18 @@ template <unsigned N>
 class generic_dft_dit<N, std::enable_if_t<(N % 5 == 0)>> : public generic_dft_N
 {
 private:
-  unsigned               stride;
-  generic_dft_dit<N / 5> radix5;
-  std::array<cf_t, N>    table;
-  const cf_t             w1;
-  const cf_t             w2;
-  const cf_t             w3;
-  const cf_t             w4;
+  static constexpr unsigned             N_5 = N / 5;
+  unsigned                              stride;
+  generic_dft_dit<N_5>                  radix5;
+  std::array<cf_t, N>                   table;
+  /// Twiddle factors of the m-th radix-5 branch, \f$W_N^{mk}\f$ for \f$m = 1, ..., 4\f$, split in real and imaginary
+  /// parts so that they can be loaded in SIMD registers.
+  std::array<std::array<float, N_5>, 4> tables_re;
+  std::array<std::array<float, N_5>, 4> tables_im;
+  const cf_t                            w1;
+  const cf_t                            w2;
+  const cf_t                            w3;
+  const cf_t                            w4;
 
 public:
   generic_dft_dit(float sign, unsigned stride_) :
@@ -213,32 +220,61 @@ public:
     for (unsigned idx = 0; idx != N; ++idx) {
       table[idx] = std::polar(1.0F, sign * TWOPI * static_cast<float>(idx) / static_cast<float>(N));
     }
+
+    for (unsigned m = 0; m != 4; ++m) {
+      for (unsigned idx = 0; idx != N_5; ++idx) {
+        cf_t w            = table[(m + 1) * idx];
+        tables_re[m][idx] = w.real();
+        tables_im[m][idx] = w.imag();
+      }
+    }
   }
 
   void run(cf_t* out, const cf_t* in) const override
   {
     // Radix 5.
     radix5.run(&out[0], in);
-    radix5.run(&out[N / 5], in + stride);
-    radix5.run(&out[2 * N / 5], in + 2 * stride);
-    radix5.run(&out[3 * N / 5], in + 3 * stride);
-    radix5.run(&out[4 * N / 5], in + 4 * stride);
+    radix5.run(&out[N_5], in + stride);
+    radix5.run(&out[2 * N_5], in + 2 * stride);
+    radix5.run(&out[3 * N_5], in + 3 * stride);
+    radix5.run(&out[4 * N_5], in + 4 * stride);
 
     unsigned k = 0;
 
-    for (; k != N / 5; ++k) {
+#if OCUDU_SIMD_CF_SIZE
+    simd_cf_t w1_simd = ocudu_simd_cf_set1(w1);
+    simd_cf_t w2_simd = ocudu_simd_cf_set1(w2);
+    simd_cf_t w3_simd = ocudu_simd_cf_set1(w3);
+    simd_cf_t w4_simd = ocudu_simd_cf_set1(w4);
+    for (; k != (N_5 / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; k += OCUDU_SIMD_CF_SIZE) {
+      simd_cf_t a0 = ocudu_simd_cfi_loadu(&out[k]);
+      simd_cf_t a1 = ocudu_simd_cf_loadu(&tables_re[0][k], &tables_im[0][k]) * ocudu_simd_cfi_loadu(&out[k + N_5]);
+      simd_cf_t a2 = ocudu_simd_cf_loadu(&tables_re[1][k], &tables_im[1][k]) * ocudu_simd_cfi_loadu(&out[k + 2 * N_5]);
+      simd_cf_t a3 = ocudu_simd_cf_loadu(&tables_re[2][k], &tables_im[2][k]) * ocudu_simd_cfi_loadu(&out[k + 3 * N_5]);
+      simd_cf_t a4 = ocudu_simd_cf_loadu(&tables_re[3][k], &tables_im[3][k]) * ocudu_simd_cfi_loadu(&out[k + 4 * N_5]);
+
+      // Radix-5 butterfly (like a 5-point DFT).
+      ocudu_simd_cfi_storeu(&out[k], a0 + a1 + a2 + a3 + a4);
+      ocudu_simd_cfi_storeu(&out[k + N_5], a0 + a1 * w1_simd + a2 * w2_simd + a3 * w3_simd + a4 * w4_simd);
+      ocudu_simd_cfi_storeu(&out[k + 2 * N_5], a0 + a1 * w2_simd + a2 * w4_simd + a3 * w1_simd + a4 * w3_simd);
+      ocudu_simd_cfi_storeu(&out[k + 3 * N_5], a0 + a1 * w3_simd + a2 * w1_simd + a3 * w4_simd + a4 * w2_simd);
+      ocudu_simd_cfi_storeu(&out[k + 4 * N_5], a0 + a1 * w4_simd + a2 * w3_simd + a3 * w2_simd + a4 * w1_simd);
+    }
+#endif // OCUDU_SIMD_CF_SIZE
+
+    for (; k != N_5; ++k) {
       cf_t a0 = out[k];
-      cf_t a1 = table[k] * out[k + N / 5];
-      cf_t a2 = table[2 * k % N] * out[k + 2 * N / 5];
-      cf_t a3 = table[3 * k % N] * out[k + 3 * N / 5];
-      cf_t a4 = table[4 * k % N] * out[k + 4 * N / 5];
+      cf_t a1 = table[k] * out[k + N_5];
+      cf_t a2 = table[2 * k] * out[k + 2 * N_5];
+      cf_t a3 = table[3 * k] * out[k + 3 * N_5];
+      cf_t a4 = table[4 * k] * out[k + 4 * N_5];
 
       // Radix-5 butterfly (like a 5-point DFT).
-      out[k]             = a0 + a1 + a2 + a3 + a4;
-      out[k + N / 5]     = a0 + a1 * w1 + a2 * w2 + a3 * w3 + a4 * w4;
-      out[k + 2 * N / 5] = a0 + a1 * w2 + a2 * w4 + a3 * w1 + a4 * w3;
-      out[k + 3 * N / 5] = a0 + a1 * w3 + a2 * w1 + a3 * w4 + a4 * w2;
-      out[k + 4 * N / 5] = a0 + a1 * w4 + a2 * w3 + a3 * w2 + a4 * w1;
+      out[k]           = a0 + a1 + a2 + a3 + a4;
+      out[k + N_5]     = a0 + a1 * w1 + a2 * w2 + a3 * w3 + a4 * w4;
+      out[k + 2 * N_5] = a0 + a1 * w2 + a2 * w4 + a3 * w1 + a4 * w3;
+      out[k + 3 * N_5] = a0 + a1 * w3 + a2 * w1 + a3 * w4 + a4 * w2;
+      out[k + 4 * N_5] = a0 + a1 * w4 + a2 * w3 + a3 * w2 + a4 * w1;
     }
   }
 };
@@ -467,21 +503,104 @@ public:
   }
 };
 
-} // namespace
+// Creates a mixed radix DFT of the given size, or returns nullptr if the size is not available.
+std::unique_ptr<generic_dft_N> create_generic_dft_dit(unsigned size, float sign);
+
+// Implements a DFT of any size using Bluestein's algorithm.
+//
+// The DFT of size N is rewritten as a circular convolution with a chirp sequence, which is computed with two mixed
+// radix DFTs of size M >= 2N - 1. The chirp sequence and the DFT of the convolution filter are precomputed. This makes
+// sizes that do not factorize in powers of 2, 3 and 5 available, such as the PRACH long sequence length 839.
+class generic_dft_bluestein : public generic_dft_N
+{
+private:
+  /// DFT size.
+  unsigned N;
+  /// Chirp sequence \f$c_n = e^{\pm j \pi n^2 / N}\f$, for \f$n = 0, ..., N - 1\f$.
+  std::vector<cf_t> chirp;
+  /// DFT of the convolution filter, scaled by \f$1/M\f$ to compensate the inverse DFT.
+  std::vector<cf_t> filter;
+  /// Direct DFT of size M.
+  std::unique_ptr<generic_dft_N> direct_dft;
+  /// Inverse DFT of size M.
+  std::unique_ptr<generic_dft_N> inverse_dft;
+  /// Temporary buffers of size M. They are not part of the DFT state.
+  mutable std::vector<cf_t> temp_in;
+  mutable std::vector<cf_t> temp_out;
+
+public:
+  generic_dft_bluestein(float sign, unsigned N_) : N(N_), chirp(N_)
+  {
+    // Select the smallest available convolution size, trying the sizes 2^k and 3 * 2^(k-1) in increasing order.
+    for (unsigned pow2 = 4; (direct_dft == nullptr) && (pow2 <= 65536); pow2 *= 2) {
+      for (unsigned M : {pow2, 3 * pow2 / 2}) {
+        if ((M >= 2 * N - 1) && (direct_dft == nullptr)) {
+          direct_dft  = create_generic_dft_dit(M, -1);
+          inverse_dft = create_generic_dft_dit(M, +1);
+        }
+        if (direct_dft != nullptr) {
+          temp_in.resize(M);
+          temp_out.resize(M);
+          break;
+        }
+      }
+    }
+
+    if (direct_dft == nullptr) {
+      return;
+    }
+
+    // The chirp phase is computed from the residue of n^2 modulo 2N to keep the precision for large indices.
+    for (unsigned n = 0; n != N; ++n) {
+      uint64_t n2    = (static_cast<uint64_t>(n) * static_cast<uint64_t>(n)) % (2 * N);
+      double   phase = M_PI * static_cast<double>(n2) / static_cast<double>(N);
+      chirp[n]       = std::polar(1.0F, sign * static_cast<float>(phase));
+    }
+
+    // Convolution filter, the conjugated chirp extended circularly to negative indices.
+    unsigned M = temp_in.size();
+    std::fill(temp_in.begin(), temp_in.end(), 0);
+    temp_in[0] = std::conj(chirp[0]);
+    for (unsigned n = 1; n != N; ++n) {
+      temp_in[n]     = std::conj(chirp[n]);
+      temp_in[M - n] = std::conj(chirp[n]);
+    }
+
+    filter.resize(M);
+    direct_dft->run(filter.data(), temp_in.data());
+    ocuduvec::sc_prod(filter, filter, 1.0F / static_cast<float>(M));
+  }
+
+  /// Determines whether a suitable convolution size is available.
+  bool is_valid() const { return direct_dft != nullptr; }
+
+  void run(cf_t* out, const cf_t* in) const override
+  {
+    span<cf_t> in_chirp = span<cf_t>(temp_in).first(N);
+
+    // Modulate the input with the chirp and pad with zeros.
+    ocuduvec::prod(in_chirp, span<const cf_t>(in, N), chirp);
+    std::fill(temp_in.begin() + N, temp_in.end(), 0);
+
+    // Circular convolution with the filter in the frequency domain.
+    direct_dft->run(temp_out.data(), temp_in.data());
+    ocuduvec::prod(temp_out, temp_out, filter);
+    inverse_dft->run(temp_in.data(), temp_out.data());
+
+    // Demodulate the convolution output with the chirp.
+    ocuduvec::prod(span<cf_t>(out, N), in_chirp, chirp);
+  }
+};
 
 #define CREATE_GENERIC_DFT_DIT(SIZE)                                                                                   \
   do {                                                                                                                 \
-    if (input.size() == (SIZE)) {                                                                                      \
-      generic_dft = std::make_unique<generic_dft_dit<SIZE>>(sign, 1);                                                  \
-      return;                                                                                                          \
+    if (size == (SIZE)) {                                                                                              \
+      return std::make_unique<generic_dft_dit<SIZE>>(sign, 1);                                                         \
     }                                                                                                                  \
   } while (false)
 
-dft_processor_generic_impl::dft_processor_generic_impl(const configuration& dft_config) :
-  dir(dft_config.dir), input(dft_config.size), output(dft_config.size)
+std::unique_ptr<generic_dft_N> create_generic_dft_dit(unsigned size, float sign)
 {
-  float sign = (dir == dft_processor::direction::DIRECT) ? -1 : +1;
-
   CREATE_GENERIC_DFT_DIT(12);
   CREATE_GENERIC_DFT_DIT(24);
   CREATE_GENERIC_DFT_DIT(36);
@@ -553,6 +672,30 @@ dft_processor_generic_impl::dft_processor_generic_impl(const configuration& dft_
   CREATE_GENERIC_DFT_DIT(36864);
   CREATE_GENERIC_DFT_DIT(49152);
   CREATE_GENERIC_DFT_DIT(98304);
+
+  return nullptr;
+}
+
+} // namespace
+
+dft_processor_generic_impl::dft_processor_generic_impl(const configuration& dft_config) :
+  dir(dft_config.dir), input(dft_config.size), output(dft_config.size)
+{
+  float sign = (dir == dft_processor::direction::DIRECT) ? -1 : +1;
+
+  // Use the mixed radix algorithm if the size is available.
+  generic_dft = create_generic_dft_dit(dft_config.size, sign);
+  if (generic_dft != nullptr) {
+    return;
+  }
+
+  // Otherwise, fall back to Bluestein's algorithm.
+  if (dft_config.size > 1) {
+    std::unique_ptr<generic_dft_bluestein> bluestein = std::make_unique<generic_dft_bluestein>(sign, dft_config.size);
+    if (bluestein->is_valid()) {
+      generic_dft = std::move(bluestein);
+    }
+  }
 }
 
 span<const cf_t> dft_processor_generic_impl::run()
@@ -9,6 +9,7 @@
  */
 
 #include "ocudu/phy/generic_functions/generic_functions_factories.h"
+#include "dft_processor_ci16_generic_impl.h"
 #include "dft_processor_generic_impl.h"
 #include "ocudu/support/cpu_features.h"
 #include "ocudu/support/error_handling.h"
@@ -42,6 +43,19 @@ public:
   }
 };
 
+class dft_processor_ci16_factory_generic : public dft_processor_ci16_factory
+{
+public:
+  std::unique_ptr<dft_processor_ci16> create(const dft_processor_ci16::configuration& config) override
+  {
+    std::unique_ptr<dft_processor_ci16_generic_impl> dft = std::make_unique<dft_processor_ci16_generic_impl>(config);
+    if (!dft->is_valid()) {
+      return nullptr;
+    }
+    return dft;
+  }
+};
+
 #ifdef __x86_64__
 class dft_processor_ci16_factory_avx2 : public dft_processor_ci16_factory
 {
@@ -137,6 +151,11 @@ std::shared_ptr<dft_processor_factory> ocudu::create_dft_processor_factory_fftz(
 #endif // HAVE_FFTZ
 }
 
+std::shared_ptr<dft_processor_ci16_factory> ocudu::create_dft_processor_ci16_factory_generic()
+{
+  return std::make_shared<dft_processor_ci16_factory_generic>();
+}
+
 std::shared_ptr<dft_processor_ci16_factory> ocudu::create_dft_processor_ci16_factory_avx2()
 {
 #ifdef __x86_64__
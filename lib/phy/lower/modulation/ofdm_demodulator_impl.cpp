@@ -44,9 +44,6 @@ ofdm_symbol_demodulator_impl::ofdm_symbol_demodulator_impl(const ofdm_demodulato
   // Fill DFT input with zeros.
   ocuduvec::zero(dft->get_input());
 
-  // Set the right size to the internal phase compensation buffer.
-  compensated_output.resize(dft_size);
-
   if (ofdm_config.nof_samples_window_offset != 0) {
     // Verify the window is valid.
     ocudu_assert(ofdm_config.nof_samples_window_offset < (144 * ofdm_config.dft_size) / 2048,
@@ -54,14 +51,17 @@ ofdm_symbol_demodulator_impl::ofdm_symbol_demodulator_impl(const ofdm_demodulato
                  ofdm_config.nof_samples_window_offset,
                  (144 * ofdm_config.dft_size) / 2048);
 
-    // Prepare phase compensation vector.
-    window_phase_compensation.resize(dft_size);
+    // Prepare phase compensation vectors. Only the DFT bins mapped to the resource grid are compensated.
+    window_phase_compensation.resize(rg_size);
+    compensation.resize(rg_size);
 
     // Discrete frequency of the complex exponential.
     float omega = static_cast<float>(ofdm_config.nof_samples_window_offset) * static_cast<float>(2.0 * M_PI) /
                   static_cast<float>(dft_size);
-    for (unsigned i = 0; i != dft_size; ++i) {
-      window_phase_compensation[i] = std::polar(1.0F, omega * static_cast<float>(i));
+    for (unsigned k = 0; k != rg_size; ++k) {
+      // The lower half of the resource grid corresponds to the upper DFT bins, and vice versa.
+      unsigned i_bin               = (k < rg_size / 2) ? (dft_size - rg_size / 2 + k) : (k - rg_size / 2);
+      window_phase_compensation[k] = std::polar(1.0F, omega * static_cast<float>(i_bin));
     }
   }
 }
@@ -114,24 +114,33 @@ void ofdm_symbol_demodulator_impl::demodulate(resource_grid_writer& grid,
   // Execute DFT.
   span<const cf_t> dft_output = dft->run();
 
-  // Get phase correction (TS138.211, Section 5.4)
-  cf_t phase_compensation = phase_compensation_table.get_coefficient(symbol_index);
-
-  // Apply scaling and phase compensation.
-  ocuduvec::sc_prod(compensated_output, dft_output, phase_compensation * scale);
-
-  // Compensate DFT window offset phase shift.
-  if (!window_phase_compensation.empty()) {
-    ocuduvec::prod(compensated_output, window_phase_compensation, compensated_output);
+  // Get phase correction (TS138.211, Section 5.4) and combine it with the scaling.
+  cf_t phase_compensation = phase_compensation_table.get_coefficient(symbol_index) * scale;
+
+  // Get a view of the resource grid symbol.
+  span<cbf16_t> grid_symbol = grid.get_view(port_index, symbol_index % nsymb);
+  ocudu_assert(grid_symbol.size() >= rg_size,
+               "The resource grid number of subcarriers (i.e., {}) is smaller than the bandwidth (i.e., {}).",
+               grid_symbol.size(),
+               rg_size);
+
+  // The upper bound frequency domain data is mapped at the beginning of the resource grid, and the lower bound
+  // frequency domain data is mapped after it.
+  span<const cf_t> upper_bound = dft_output.last(rg_size / 2);
+  span<const cf_t> lower_bound = dft_output.first(rg_size / 2);
+
+  // Apply scaling, phase compensation and conversion to the resource grid format while mapping the DFT output, so the
+  // DFT output is only traversed once.
+  if (window_phase_compensation.empty()) {
+    ocuduvec::sc_prod(grid_symbol.first(rg_size / 2), upper_bound, phase_compensation);
+    ocuduvec::sc_prod(grid_symbol.subspan(rg_size / 2, rg_size / 2), lower_bound, phase_compensation);
+  } else {
+    // Combine the DFT window offset phase compensation with the symbol phase compensation.
+    ocuduvec::sc_prod(compensation, window_phase_compensation, phase_compensation);
+    ocuduvec::prod(grid_symbol.first(rg_size / 2), upper_bound, span<const cf_t>(compensation).first(rg_size / 2));
+    ocuduvec::prod(
+        grid_symbol.subspan(rg_size / 2, rg_size / 2), lower_bound, span<const cf_t>(compensation).last(rg_size / 2));
   }
-
-  // Map the upper bound frequency domain data.
-  span<cf_t> upper_bound(&compensated_output[dft_size - rg_size / 2], rg_size / 2);
-  grid.put(port_index, symbol_index % nsymb, 0, upper_bound);
-
-  // Map the lower bound frequency domain data.
-  span<cf_t> lower_bound(&compensated_output[0], rg_size / 2);
-  grid.put(port_index, symbol_index % nsymb, rg_size / 2, lower_bound);
 }
 
 unsigned ofdm_slot_demodulator_impl::get_slot_size(unsigned slot_index) const
@@ -48,9 +48,10 @@ class ofdm_symbol_demodulator_impl : public ofdm_symbol_demodulator
   std::atomic<double> next_center_freq_Hz;
   /// Current center frequency in Hertz.
   double current_center_freq_Hz;
-  /// Internal buffer aimed at storing the phase compensated DFT outputs.
-  std::vector<cf_t> compensated_output;
-  /// DFT window offset phase compensation.
+  /// Internal buffer aimed at storing the DFT window offset phase compensation combined with the symbol phase
+  /// compensation and scaling.
+  std::vector<cf_t> compensation;
+  /// DFT window offset phase compensation of the resource grid subcarriers, in resource grid order.
   std::vector<cf_t> window_phase_compensation;
 
 public:
@@ -50,12 +50,35 @@ public:
     notifier.on_new_metric(metrics);
   }
 
+  // See interface for documentation.
+  void equalize(span<cf_t>                       eq_symbols,
+                span<float>                      eq_noise_vars,
+                const re_buffer_reader<cbf16_t>& ch_symbols,
+                const ch_est_list&               ch_estimates,
+                span<const cf_t>                 noise_covariance,
+                float                            tx_scaling) override
+  {
+    channel_equalizer_metrics metrics;
+    {
+      // Use scoped resource usage class to measure CPU usage of this block.
+      resource_usage_utils::scoped_resource_usage rusage_tracker(metrics.measurements);
+      base_equalizer->equalize(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_covariance, tx_scaling);
+    }
+    metrics.nof_re     = ch_estimates.get_nof_re();
+    metrics.nof_layers = ch_estimates.get_nof_tx_layers();
+    metrics.nof_ports  = ch_estimates.get_nof_rx_ports();
+    notifier.on_new_metric(metrics);
+  }
+
   // See interface for documentation.
   bool is_supported(unsigned nof_ports, unsigned nof_layers) override
   {
     return base_equalizer->is_supported(nof_ports, nof_layers);
   }
 
+  // See interface for documentation.
+  bool is_interference_aware() const override { return base_equalizer->is_interference_aware(); }
+
 private:
   std::unique_ptr<channel_equalizer> base_equalizer;
   channel_equalizer_metric_notifier& notifier;
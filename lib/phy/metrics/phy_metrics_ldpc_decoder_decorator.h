@@ -52,6 +52,36 @@ public:
     return ret;
   }
 
+  // See interface for documentation.
+  void decode_batch(span<batch_entry> entries, const configuration& cfg) override
+  {
+    if (entries.empty()) {
+      return;
+    }
+
+    resource_usage_utils::measurements measurements;
+    {
+      // Use scoped resource usage class to measure CPU usage of this block.
+      resource_usage_utils::scoped_resource_usage rusage_tracker(measurements);
+      base_decoder->decode_batch(entries, cfg);
+    }
+
+    // The resources are evenly attributed to all the codeblocks of the batch.
+    measurements.duration /= entries.size();
+    measurements.user_time /= entries.size();
+    measurements.system_time /= entries.size();
+
+    for (const batch_entry& entry : entries) {
+      ldpc_decoder_metrics metrics;
+      metrics.cb_sz          = units::bits(entry.output.size());
+      metrics.nof_iterations = entry.result.value_or(cfg.max_iterations);
+      metrics.crc_ok         = entry.result.has_value();
+      metrics.measurements   = measurements;
+
+      notifier.on_new_metric(metrics);
+    }
+  }
+
 private:
   std::unique_ptr<ldpc_decoder> base_decoder;
   ldpc_decoder_metric_notifier& notifier;
@@ -53,7 +53,53 @@ public:
     notifier.on_new_metric(metrics);
   }
 
+  void start(pusch_codeword_buffer&              codeword_buffer,
+             pusch_demodulator_notifier&         demodulator_notifier,
+             const resource_grid_reader&         grid,
+             const dmrs_pusch_estimator_results& est_results,
+             const configuration&                config) override
+  {
+    base_buffer             = &codeword_buffer;
+    elapsed_on_new_block    = {};
+    elapsed_on_end_codeword = {};
+    codeword_ended          = false;
+    pending_metrics         = {};
+
+    // The measurements of all the calls of the same transmission are accumulated.
+    measure([&]() { base->start(*this, demodulator_notifier, grid, est_results, config); });
+  }
+
+  void demodulate_symbols(unsigned end_symbol_index, bool is_valid) override
+  {
+    measure([&]() { base->demodulate_symbols(end_symbol_index, is_valid); });
+
+    // Notify metrics once the last OFDM symbol of the transmission is demodulated.
+    if (codeword_ended) {
+      codeword_ended                 = false;
+      pending_metrics.elapsed_buffer = elapsed_on_new_block + elapsed_on_end_codeword;
+      notifier.on_new_metric(pending_metrics);
+    }
+  }
+
 private:
+  /// Runs a demodulation step and accumulates its resource usage in the pending metrics.
+  template <typename Func>
+  void measure(const Func& func)
+  {
+    resource_usage_utils::measurements measurements;
+    {
+      // Use scoped resource usage class to measure CPU usage of this block.
+      resource_usage_utils::scoped_resource_usage rusage_tracker(measurements);
+      func();
+    }
+
+    resource_usage_utils::measurements& total = pending_metrics.measurements;
+    total.duration += measurements.duration;
+    total.user_time += measurements.user_time;
+    total.system_time += measurements.system_time;
+    total.max_rss = std::max(total.max_rss, measurements.max_rss);
+  }
+
   // See pusch_codeword_buffer interface for documentation.
   span<log_likelihood_ratio> get_next_block_view(unsigned block_size) override
   {
@@ -86,6 +132,7 @@ private:
     auto tp_after = std::chrono::high_resolution_clock::now();
 
     elapsed_on_end_codeword = tp_after - tp_before;
+    codeword_ended          = true;
   }
 
   std::unique_ptr<pusch_demodulator> base;
@@ -93,6 +140,8 @@ private:
   pusch_codeword_buffer*             base_buffer             = nullptr;
   std::chrono::nanoseconds           elapsed_on_new_block    = {};
   std::chrono::nanoseconds           elapsed_on_end_codeword = {};
+  bool                               codeword_ended          = false;
+  pusch_demodulator_metrics          pending_metrics         = {};
 };
 
 } // namespace ocudu
@@ -36,6 +36,32 @@ public:
                pusch_processor_result_notifier& proc_notifier,
                const resource_grid_reader&      grid,
                const pdu_t&                     pdu_) override
+  {
+    process_and_measure(data_, proc_notifier, pdu_, [&]() {
+      processor->process(data, std::move(rm_buffer), *this, grid, pdu);
+    });
+  }
+
+  // See pusch_processor interface for documentation.
+  void process(span<uint8_t>                    data_,
+               unique_rx_buffer                 rm_buffer,
+               pusch_processor_result_notifier& proc_notifier,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor,
+               const pdu_t&                     pdu_) override
+  {
+    process_and_measure(data_, proc_notifier, pdu_, [&]() {
+      processor->process(data, std::move(rm_buffer), *this, grid, symbol_monitor, pdu);
+    });
+  }
+
+private:
+  /// Saves the processing inputs and measures the processing function until it returns.
+  template <typename Func>
+  void process_and_measure(span<uint8_t>                    data_,
+                           pusch_processor_result_notifier& proc_notifier,
+                           const pdu_t&                     pdu_,
+                           const Func&                      process_func)
   {
     // Save reference to the notifier for this transmission. It must be nullptr to ensure that the processor was
     // released from previous processing.
@@ -56,7 +82,7 @@ public:
     {
       // Use scoped resource usage class to measure CPU usage of this block.
       resource_usage_utils::scoped_resource_usage rusage_tracker(measurements);
-      processor->process(data, std::move(rm_buffer), *this, grid, pdu);
+      process_func();
     }
     cpu_time_usage_ns.store(measurements.duration.count(), std::memory_order_relaxed);
     elapsed_data_and_return_ns |=
@@ -66,7 +92,6 @@ public:
     notify_metrics();
   }
 
-private:
   // See pusch_processor_result_notifier for documentation.
   void on_uci(const pusch_processor_result_control& uci) override
   {
@@ -20,7 +20,7 @@
 #include "polar/polar_allocator_impl.h"
 #include "polar/polar_code_impl.h"
 #include "polar/polar_deallocator_impl.h"
-#include "polar/polar_decoder_impl.h"
+#include "polar/polar_decoder_generic.h"
 #include "polar/polar_encoder_impl.h"
 #include "polar/polar_interleaver_impl.h"
 #include "polar/polar_rate_dematcher_impl.h"
@@ -35,6 +35,8 @@
 #include "ldpc/ldpc_encoder_avx2.h"
 #include "ldpc/ldpc_rate_dematcher_avx2_impl.h"
 #include "ldpc/ldpc_rate_dematcher_avx512_impl.h"
+#include "polar/polar_decoder_avx2.h"
+#include "polar/polar_decoder_avx512.h"
 #endif // __x86_64__
 
 #ifdef __ARM_NEON
@@ -42,6 +44,7 @@
 #include "ldpc/ldpc_decoder_neon.h"
 #include "ldpc/ldpc_encoder_neon.h"
 #include "ldpc/ldpc_rate_dematcher_neon_impl.h"
+#include "polar/polar_decoder_neon.h"
 #endif // __ARM_NEON
 
 using namespace ocudu;
@@ -233,7 +236,12 @@ public:
 
 class polar_factory_sw : public polar_factory
 {
+private:
+  std::string dec_type;
+
 public:
+  explicit polar_factory_sw(std::string dec_type_) : dec_type(std::move(dec_type_)) {}
+
   std::unique_ptr<polar_allocator>   create_allocator() override { return std::make_unique<polar_allocator_impl>(); }
   std::unique_ptr<polar_code>        create_code() override { return std::make_unique<polar_code_impl>(); }
   std::unique_ptr<polar_deallocator> create_deallocator() override
@@ -242,7 +250,28 @@ public:
   }
   std::unique_ptr<polar_decoder> create_decoder(unsigned code_size_log) override
   {
-    return std::make_unique<polar_decoder_impl>(create_encoder(), code_size_log);
+#ifdef __x86_64__
+    bool supports_avx2   = cpu_supports_feature(cpu_feature::avx2);
+    bool supports_avx512 = cpu_supports_feature(cpu_feature::avx512f) && cpu_supports_feature(cpu_feature::avx512bw);
+
+    if (((dec_type == "avx512") || (dec_type == "auto")) && supports_avx512) {
+      return std::make_unique<polar_decoder_avx512>(create_encoder(), code_size_log);
+    }
+    if (((dec_type == "avx2") || (dec_type == "auto")) && supports_avx2) {
+      return std::make_unique<polar_decoder_avx2>(create_encoder(), code_size_log);
+    }
+#endif // __x86_64__
+#ifdef __aarch64__
+    bool support_neon = cpu_supports_feature(cpu_feature::neon);
+
+    if (((dec_type == "neon") || (dec_type == "auto")) && support_neon) {
+      return std::make_unique<polar_decoder_neon>(create_encoder(), code_size_log);
+    }
+#endif // __aarch64__
+    if ((dec_type == "auto") || (dec_type == "generic")) {
+      return std::make_unique<polar_decoder_generic>(create_encoder(), code_size_log);
+    }
+    return {};
   }
   std::unique_ptr<polar_encoder>     create_encoder() override { return std::make_unique<polar_encoder_impl>(); }
   std::unique_ptr<polar_interleaver> create_interleaver() override
@@ -308,9 +337,9 @@ std::shared_ptr<crc_calculator_factory> ocudu::create_crc_calculator_factory_sw(
   return std::make_shared<crc_calculator_factory_sw_impl>(type);
 }
 
-std::shared_ptr<polar_factory> ocudu::create_polar_factory_sw()
+std::shared_ptr<polar_factory> ocudu::create_polar_factory_sw(const std::string& dec_type)
 {
-  return std::make_shared<polar_factory_sw>();
+  return std::make_shared<polar_factory_sw>(dec_type);
 }
 
 std::shared_ptr<short_block_detector_factory> ocudu::create_short_block_detector_factory_sw()
@@ -10,17 +10,19 @@
 
 #include "ldpc_decoder_impl.h"
 #include "ldpc_luts_impl.h"
+#include "ocudu/adt/static_vector.h"
 #include "ocudu/ocuduvec/binary.h"
 #include "ocudu/ocuduvec/circ_shift.h"
 #include "ocudu/ocuduvec/copy.h"
 #include "ocudu/ocuduvec/fill.h"
 #include "ocudu/ocuduvec/zero.h"
+#include "ocudu/support/math/math_utils.h"
 #include "ocudu/support/ocudu_assert.h"
 
 using namespace ocudu;
 using namespace ocudu::ldpc;
 
-void ldpc_decoder_impl::init(const configuration& cfg)
+void ldpc_decoder_impl::init(const configuration& cfg, unsigned nof_codeblocks)
 {
   uint8_t  pos   = get_lifting_size_position(cfg.lifting_size);
   unsigned skip  = (cfg.base_graph == ldpc_base_graph_type::BG2) ? NOF_LIFTING_SIZES : 0;
@@ -31,7 +33,13 @@ void ldpc_decoder_impl::init(const configuration& cfg)
   bg_K           = current_graph->get_nof_BG_info_nodes();
   bg_N_high_rate = bg_K + 4;
   ocudu_assert(bg_K == bg_N_full - bg_M, "Invalid bg_K value '{}'", bg_K);
-  lifting_size = static_cast<uint16_t>(cfg.lifting_size);
+  cb_lifting_size = static_cast<uint16_t>(cfg.lifting_size);
+  nof_lanes       = static_cast<uint16_t>(nof_codeblocks);
+  lifting_size    = cb_lifting_size * nof_lanes;
+  ocudu_assert((nof_lanes > 0) && (lifting_size <= MAX_LIFTING_SIZE),
+               "Invalid number of jointly decoded codeblocks (i.e., {}) for lifting size {}.",
+               nof_codeblocks,
+               cb_lifting_size);
 
   max_iterations = cfg.max_iterations;
   ocudu_assert(max_iterations > 0, "Max iterations must be different to 0");
@@ -39,7 +47,7 @@ void ldpc_decoder_impl::init(const configuration& cfg)
   unsigned nof_crc_bits = cfg.nof_crc_bits;
   ocudu_assert((nof_crc_bits == 16) || (nof_crc_bits == 24), "Invalid number of CRC bits.");
 
-  nof_significant_bits = bg_K * lifting_size - cfg.nof_filler_bits;
+  nof_significant_bits = bg_K * cb_lifting_size - cfg.nof_filler_bits;
 
   specific_init();
 }
@@ -128,7 +136,7 @@ std::optional<unsigned> ldpc_decoder_impl::decode(bit_buffer&
       bool hard_bits_success = get_hard_bits(output);
 
       // Early stop condition: check syndrome.
-      if (hard_bits_success && check_syndrome()) {
+      if (hard_bits_success && check_syndrome(nof_layers)) {
         return i_iteration + 1;
       }
     }
@@ -143,13 +151,158 @@ std::optional<unsigned> ldpc_decoder_impl::decode(bit_buffer&
   bool hard_bits_success = get_hard_bits(output);
 
   // Check syndrome for determining if the codeblock decoding is successful.
-  if (!hard_bits_success || !check_syndrome()) {
+  if (!hard_bits_success || !check_syndrome(nof_layers)) {
     return std::nullopt;
   }
 
   return max_iterations;
 }
 
+void ldpc_decoder_impl::decode_batch(span<batch_entry> entries, const configuration& cfg)
+{
+  // Maximum number of codeblocks that fit in a single lifted node.
+  unsigned max_nof_lanes = std::min(max_batch_size, MAX_LIFTING_SIZE / static_cast<unsigned>(cfg.lifting_size));
+
+  while (!entries.empty()) {
+    unsigned nof_lanes_group = std::min(max_nof_lanes, static_cast<unsigned>(entries.size()));
+
+    if (nof_lanes_group == 1) {
+      configuration entry_cfg   = cfg;
+      entry_cfg.nof_filler_bits = entries.front().nof_filler_bits;
+      entries.front().result    = decode(entries.front().output, entries.front().input, entries.front().crc, entry_cfg);
+    } else {
+      decode_interleaved(entries.first(nof_lanes_group), cfg);
+    }
+
+    entries = entries.last(entries.size() - nof_lanes_group);
+  }
+}
+
+void ldpc_decoder_impl::decode_interleaved(span<batch_entry> entries, const configuration& cfg)
+{
+  init(cfg, entries.size());
+
+  uint16_t message_length   = bg_K * cb_lifting_size;
+  uint16_t max_input_length = bg_N_short * cb_lifting_size;
+  uint16_t min_input_length = message_length + 2 * cb_lifting_size;
+
+  // The minimum codeblock length is message_length + four times the lifting size (that is, the length of the high-rate
+  // region).
+  unsigned min_codeblock_length = message_length + 4 * cb_lifting_size;
+
+  // Number of lifted nodes used by each of the codeblocks.
+  static_vector<unsigned, max_batch_size> cb_nof_nodes(entries.size());
+  // Codeblocks that have not reached an early stop condition yet.
+  static_vector<bool, max_batch_size> pending(entries.size());
+  // Number of significant bits of each of the codeblocks.
+  static_vector<unsigned, max_batch_size> cb_nof_significant_bits(entries.size());
+
+  unsigned nof_pending = 0;
+  unsigned nof_nodes   = 0;
+  for (unsigned i_lane = 0, i_lane_end = entries.size(); i_lane != i_lane_end; ++i_lane) {
+    batch_entry&                     entry = entries[i_lane];
+    span<const log_likelihood_ratio> input = entry.input;
+
+    ocudu_assert(entry.output.size() == message_length,
+                 "The output size {} is not equal to the message length {}.",
+                 entry.output.size(),
+                 message_length);
+    ocudu_assert(input.size() <= max_input_length,
+                 "The input size {} exceeds the maximum message length {}.",
+                 input.size(),
+                 max_input_length);
+    ocudu_assert(input.size() >= min_input_length,
+                 "The input length {} does not reach minimum {}",
+                 input.size(),
+                 min_input_length);
+
+    entry.result.reset();
+    cb_nof_significant_bits[i_lane] = bg_K * cb_lifting_size - entry.nof_filler_bits;
+
+    // Find the last soft bit in the buffer.
+    const log_likelihood_ratio* last =
+        std::find_if(input.rbegin(), input.rend(), [](const log_likelihood_ratio& in) { return in != 0; }).base();
+    unsigned input_size = std::distance(input.begin(), last);
+
+    // Skip the codeblocks that do not contain enough soft bits.
+    if ((input_size < message_length) && force_decoding) {
+      if (entry.crc == nullptr) {
+        entry.output.one();
+      }
+      pending[i_lane]      = false;
+      cb_nof_nodes[i_lane] = 0;
+      continue;
+    }
+
+    // The decoder works with a codeblock length that is a multiple of the lifting size.
+    unsigned cb_length   = std::max(input_size + 2 * cb_lifting_size, min_codeblock_length);
+    cb_nof_nodes[i_lane] = divide_ceil(cb_length, cb_lifting_size);
+    nof_nodes            = std::max(nof_nodes, cb_nof_nodes[i_lane]);
+    pending[i_lane]      = true;
+    ++nof_pending;
+  }
+
+  if (nof_pending == 0) {
+    return;
+  }
+
+  // Ensure check-to-variable messages are not initialized.
+  std::fill(is_check_to_var_initialized.begin(), is_check_to_var_initialized.end(), false);
+
+  load_interleaved_soft_bits(entries, nof_nodes);
+
+  // All codeblocks run the layers of the longest one. The extra parity nodes of the shorter codeblocks behave as
+  // punctured bits.
+  codeblock_length    = nof_nodes * cb_lifting_size;
+  unsigned nof_layers = nof_nodes - bg_K;
+
+  // Checks whether a codeblock passes its CRC or, if no CRC is provided, its syndrome.
+  auto is_codeblock_valid = [this, &entries, &cb_nof_nodes, &cb_nof_significant_bits](unsigned i_lane) {
+    batch_entry& entry = entries[i_lane];
+    if (entry.crc != nullptr) {
+      bool hard_bits_success = get_hard_bits(entry.output, i_lane);
+      return hard_bits_success && (entry.crc->calculate(entry.output.first(cb_nof_significant_bits[i_lane])) == 0);
+    }
+    bool hard_bits_success = get_hard_bits(entry.output, i_lane);
+    return hard_bits_success && check_syndrome(cb_nof_nodes[i_lane] - bg_K, i_lane);
+  };
+
+  for (unsigned i_iteration = 0; (i_iteration != max_iterations) && (nof_pending != 0); ++i_iteration) {
+    // Run all layers.
+    for (unsigned i_layer = 0; i_layer != nof_layers; ++i_layer) {
+      update_variable_to_check_messages(i_layer);
+
+      update_check_to_variable_messages(i_layer);
+
+      update_soft_bits(i_layer);
+    }
+
+    for (unsigned i_lane = 0, i_lane_end = entries.size(); i_lane != i_lane_end; ++i_lane) {
+      // Skip codeblocks that have already stopped or that do not have any early stop condition.
+      if (!pending[i_lane] || ((entries[i_lane].crc == nullptr) && !early_stop_syndrome)) {
+        continue;
+      }
+
+      if (is_codeblock_valid(i_lane)) {
+        entries[i_lane].result = i_iteration + 1;
+        pending[i_lane]        = false;
+        --nof_pending;
+      }
+    }
+  }
+
+  // Determine the result of the codeblocks without early stop condition from the syndrome.
+  for (unsigned i_lane = 0, i_lane_end = entries.size(); i_lane != i_lane_end; ++i_lane) {
+    if (!pending[i_lane] || (entries[i_lane].crc != nullptr) || early_stop_syndrome) {
+      continue;
+    }
+
+    if (is_codeblock_valid(i_lane)) {
+      entries[i_lane].result = max_iterations;
+    }
+  }
+}
+
 void ldpc_decoder_impl::load_soft_bits(span<const log_likelihood_ratio> llrs, unsigned nof_llr)
 {
   // Compute the number of data nodes fully occupied by the llrs (the + 2 is due to the shortened nodes at the beginning
@@ -193,6 +346,29 @@ void ldpc_decoder_impl::load_soft_bits(span<const log_likelihood_ratio> llrs, un
   }
 }
 
+void ldpc_decoder_impl::load_interleaved_soft_bits(span<const batch_entry> entries, unsigned nof_nodes)
+{
+  // Zero all the used nodes, including the first 2 nodes that are not transmitted and the padding.
+  span<log_likelihood_ratio> soft_bits_view = span<log_likelihood_ratio>(soft_bits).first(nof_nodes * node_size_byte);
+  ocuduvec::zero(soft_bits_view);
+
+  for (unsigned i_lane = 0, i_lane_end = entries.size(); i_lane != i_lane_end; ++i_lane) {
+    // Only the soft bits that fit in the used nodes are loaded, the rest of the input is zero.
+    span<const log_likelihood_ratio> llrs = entries[i_lane].input;
+    llrs = llrs.first(std::min(llrs.size(), static_cast<size_t>((nof_nodes - 2) * cb_lifting_size)));
+
+    // Recall that the first 2 * lifting_size bits (2 nodes) are not transmitted.
+    for (unsigned i_node = 2; !llrs.empty(); ++i_node) {
+      unsigned                   nof_llrs  = std::min(llrs.size(), static_cast<size_t>(cb_lifting_size));
+      span<log_likelihood_ratio> node_view = soft_bits_view.subspan(i_node * node_size_byte, lifting_size);
+      for (unsigned i_bit = 0; i_bit != nof_llrs; ++i_bit) {
+        node_view[i_bit * nof_lanes + i_lane] = std::clamp(llrs[i_bit], soft_bits_clamp_low, soft_bits_clamp_high);
+      }
+      llrs = llrs.last(llrs.size() - nof_llrs);
+    }
+  }
+}
+
 void ldpc_decoder_impl::update_variable_to_check_messages(unsigned check_node)
 {
   // Retrieve list of variable nodes connected to this check node.
@@ -289,8 +465,9 @@ void ldpc_decoder_impl::update_check_to_variable_messages(unsigned check_node)
   unsigned var_node = 0;
   for (const auto* this_var_index_itr = current_var_indices.cbegin(); this_var_index_itr != this_var_index_end;
        ++this_var_index_itr, ++var_node) {
-    // Rotate the variable node as specified by the base graph.
-    unsigned shift          = current_graph->get_lifted_node(check_node, *this_var_index_itr);
+    // Rotate the variable node as specified by the base graph. The shift is scaled by the number of interleaved
+    // codeblocks.
+    unsigned shift          = current_graph->get_lifted_node(check_node, *this_var_index_itr) * nof_lanes;
     unsigned v2c_base_index = std::min(*this_var_index_itr, bg_N_high_rate);
 
     span<const log_likelihood_ratio> rotated_node = get_var_to_check(v2c_base_index, shift);
@@ -311,7 +488,7 @@ void ldpc_decoder_impl::update_check_to_variable_messages(unsigned check_node)
   var_node = 0;
   for (const auto* this_var_index_itr = current_var_indices.cbegin(); this_var_index_itr != this_var_index_end;
        ++this_var_index_itr, ++var_node) {
-    unsigned shift          = current_graph->get_lifted_node(check_node, *this_var_index_itr);
+    unsigned shift          = current_graph->get_lifted_node(check_node, *this_var_index_itr) * nof_lanes;
     unsigned c2v_base_index = std::min(*this_var_index_itr, bg_N_high_rate);
 
     span<log_likelihood_ratio>       this_check_to_var = get_check_to_var(check_node, c2v_base_index);
@@ -331,41 +508,60 @@ void ldpc_decoder_impl::update_check_to_variable_messages(unsigned check_node)
   is_check_to_var_initialized[check_node] = true;
 }
 
-bool ldpc_decoder_impl::get_hard_bits(bit_buffer& out) const
+span<const log_likelihood_ratio>
+ldpc_decoder_impl::get_codeblock_soft_bits(span<log_likelihood_ratio> buffer, unsigned i_node, unsigned i_lane) const
 {
-  if (lifting_size == node_size_byte) {
+  span<const log_likelihood_ratio> node_soft_bits =
+      span<const log_likelihood_ratio>(soft_bits).subspan(node_size_byte * i_node, lifting_size);
+
+  // Without interleaving, the node soft bits are contiguous.
+  if (nof_lanes == 1) {
+    return node_soft_bits;
+  }
+
+  // Deinterleave the codeblock soft bits.
+  for (unsigned i_bit = 0; i_bit != cb_lifting_size; ++i_bit) {
+    buffer[i_bit] = node_soft_bits[i_bit * nof_lanes + i_lane];
+  }
+  return buffer;
+}
+
+bool ldpc_decoder_impl::get_hard_bits(bit_buffer& out, unsigned i_lane) const
+{
+  if ((lifting_size == node_size_byte) && (nof_lanes == 1)) {
     span<const log_likelihood_ratio> llrs = span<const log_likelihood_ratio>(soft_bits).first(out.size());
     return hard_decision(out, llrs);
   }
 
+  // Temporary buffer for deinterleaving the soft bits.
+  std::array<log_likelihood_ratio, MAX_LIFTING_SIZE> temp_soft_bits;
+  span<log_likelihood_ratio> temp_soft_bits_view = span<log_likelihood_ratio>(temp_soft_bits).first(cb_lifting_size);
+
   // Perform hard-decision of the LLRs from the soft_bits array directly into the output without any padding.
   bool valid = true;
   for (unsigned i_node = 0; i_node != bg_K; ++i_node) {
     // View over the LLR.
-    span<const log_likelihood_ratio> current_soft =
-        span<const log_likelihood_ratio>(soft_bits).subspan(node_size_byte * i_node, lifting_size);
+    span<const log_likelihood_ratio> current_soft = get_codeblock_soft_bits(temp_soft_bits_view, i_node, i_lane);
 
     // Perform hard decision of the node.
-    valid &= hard_decision(out, current_soft, lifting_size * i_node);
+    valid &= hard_decision(out, current_soft, cb_lifting_size * i_node);
   }
 
   return valid;
 }
 
-bool ldpc_decoder_impl::check_syndrome() const
+bool ldpc_decoder_impl::check_syndrome(unsigned nof_check_nodes, unsigned i_lane) const
 {
   // Temporary buffers.
-  static_vector<log_likelihood_ratio, ldpc::MAX_LIFTING_SIZE> soft_shifted_bits(lifting_size);
-  static_bit_buffer<ldpc::MAX_LIFTING_SIZE>                   hard_shifted_bits(lifting_size);
-  static_bit_buffer<ldpc::MAX_LIFTING_SIZE>                   hard_syndrome_bits(lifting_size);
+  static_vector<log_likelihood_ratio, ldpc::MAX_LIFTING_SIZE> soft_shifted_bits(cb_lifting_size);
+  static_vector<log_likelihood_ratio, ldpc::MAX_LIFTING_SIZE> temp_soft_bits(cb_lifting_size);
+  static_bit_buffer<ldpc::MAX_LIFTING_SIZE>                   hard_shifted_bits(cb_lifting_size);
+  static_bit_buffer<ldpc::MAX_LIFTING_SIZE>                   hard_syndrome_bits(cb_lifting_size);
 
   // Make sure the last byte is zero for the static bit buffers.
   hard_shifted_bits.get_buffer().back()  = 0;
   hard_syndrome_bits.get_buffer().back() = 0;
 
-  // Calculate number of layers or check nodes.
-  unsigned nof_check_nodes = codeblock_length / lifting_size - bg_K;
-
   // Iterate all check nodes.
   for (unsigned i_check_node = 0; i_check_node != nof_check_nodes; ++i_check_node) {
     // Obtain parity check node.
@@ -381,8 +577,7 @@ bool ldpc_decoder_impl::check_syndrome() const
 
       // Select view of the soft bits.
       span<const log_likelihood_ratio> this_soft_bits =
-          span<const log_likelihood_ratio>(soft_bits).subspan((*this_var_index) * node_size_byte, lifting_size);
-
+          get_codeblock_soft_bits(temp_soft_bits, *this_var_index, i_lane);
       // Circular shift of bits.
       ocuduvec::circ_shift_backward(soft_shifted_bits, this_soft_bits, shift);
 
@@ -45,9 +45,24 @@ public:
                                  crc_calculator*                  crc,
                                  const configuration&             cfg) override;
 
+  // See interface for the documentation.
+  void decode_batch(span<batch_entry> entries, const configuration& cfg) override;
+
 private:
-  /// Initializes the decoder inner variables.
-  void init(const configuration& cfg);
+  /// \brief Initializes the decoder inner variables.
+  ///
+  /// When more than one codeblock is processed at once, the codeblocks are interleaved element by element within each
+  /// lifted node. The decoder then operates on a virtual lifting size equal to the number of codeblocks times the
+  /// actual lifting size, with all the lifted node shifts scaled accordingly.
+  ///
+  /// \param[in] cfg            Decoder configuration.
+  /// \param[in] nof_codeblocks Number of codeblocks decoded jointly.
+  void init(const configuration& cfg, unsigned nof_codeblocks = 1);
+
+  /// \brief Decodes a group of codeblocks jointly.
+  ///
+  /// The number of codeblocks times the lifting size must not exceed the maximum lifting size.
+  void decode_interleaved(span<batch_entry> entries, const configuration& cfg);
 
   /// Initializes implementation-specific inner variables.
   virtual void specific_init() = 0;
@@ -58,6 +73,15 @@ private:
   /// \param[in] nof_llrs Number of significant LLRs.
   void load_soft_bits(span<const log_likelihood_ratio> llrs, unsigned nof_llrs);
 
+  /// \brief Loads the input log-likelihood ratios of several codeblocks into the soft-bit buffers.
+  ///
+  /// The soft bit \f$k\f$ of codeblock \f$b\f$ in a lifted node is stored at position \f$kB + b\f$, where \f$B\f$ is
+  /// the number of codeblocks.
+  ///
+  /// \param[in] entries   Codeblocks to load.
+  /// \param[in] nof_nodes Number of lifted nodes used by the decoder.
+  void load_interleaved_soft_bits(span<const batch_entry> entries, unsigned nof_nodes);
+
   /// \brief Updates the messages going from variable nodes to check nodes.
   /// \param[in] check_node The check node (in the base graph) the messages are directed to.
   void update_variable_to_check_messages(unsigned check_node);
@@ -169,21 +193,36 @@ private:
                                          span<const log_likelihood_ratio> this_soft_bits,
                                          span<const log_likelihood_ratio> this_check_to_var) = 0;
 
+  /// \brief Gets the soft bits of a lifted node for a single codeblock.
+  ///
+  /// \param[out] buffer  Temporary buffer used for deinterleaving the soft bits when several codeblocks are decoded
+  ///                     jointly. Its size must be equal to the codeblock lifting size.
+  /// \param[in]  i_node  Lifted node index.
+  /// \param[in]  i_lane  Codeblock index within the decoded group.
+  /// \return A view to the soft bits of the node.
+  span<const log_likelihood_ratio>
+  get_codeblock_soft_bits(span<log_likelihood_ratio> buffer, unsigned i_node, unsigned i_lane) const;
+
   /// \brief Converts soft bits into hard bits and returns the decoded message.
   ///
-  /// \param[out] out Destination bit buffer.
+  /// \param[out] out    Destination bit buffer.
+  /// \param[in]  i_lane Codeblock index within the decoded group.
   /// \return True if none of the soft bits is zero. Otherwise, false.
-  bool get_hard_bits(bit_buffer& out) const;
+  bool get_hard_bits(bit_buffer& out, unsigned i_lane = 0) const;
 
   /// \brief Checks the syndrome of the LDPC code.
+  /// \param[in] nof_check_nodes Number of base graph check nodes used by the codeblock.
+  /// \param[in] i_lane          Codeblock index within the decoded group.
   /// \return True if the syndrome check is positive: the codeblock satisfies all parity checks and the syndrome is
   /// zero. False, otherwise.
-  bool check_syndrome() const;
+  bool check_syndrome(unsigned nof_check_nodes, unsigned i_lane = 0) const;
 
 protected:
   /// Number of base graph variable nodes corresponding to information bits.
   uint16_t bg_K = 22;
-  /// Lifting size as a natural number (as opposed to an element from ocudu::ldpc::lifting_size_t).
+  /// \brief Lifting size as a natural number (as opposed to an element from ocudu::ldpc::lifting_size_t).
+  ///
+  /// When several codeblocks are decoded jointly, it is the codeblock lifting size times the number of codeblocks.
   uint16_t lifting_size = 2;
   /// Number of bytes used to store a lifted node.
   unsigned node_size_byte = 2;
@@ -208,6 +247,10 @@ private:
   uint16_t bg_N_high_rate = 26;
   /// Number of base graph check nodes.
   uint16_t bg_M = 46;
+  /// Lifting size of each of the codeblocks.
+  uint16_t cb_lifting_size = 2;
+  /// Number of codeblocks decoded jointly.
+  uint16_t nof_lanes = 1;
   /// \brief Number of used variable nodes.
   ///
   /// Instead of using all the variable nodes and setting to zero all the punctured LLRs, the decoder will work only
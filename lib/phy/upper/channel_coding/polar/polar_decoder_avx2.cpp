@@ -0,0 +1,110 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder - definition of the AVX2-optimized implementation.
+
+#include "polar_decoder_avx2.h"
+#include <immintrin.h>
+
+using namespace ocudu;
+
+/// Number of LLRs that fit in an AVX2 register.
+static constexpr unsigned AVX2_SIZE_BYTE = 32;
+
+/// \brief Saturated sum of two AVX2 registers of LLRs.
+///
+/// Replicates log_likelihood_ratio::operator+: finite results are clipped to <tt>&plusmn;LLR_MAX</tt>, infinite
+/// summands propagate and opposite summands cancel out.
+static inline __m256i llr_sum_epi8(__m256i a, __m256i b)
+{
+  const __m256i llr_max   = _mm256_set1_epi8(log_likelihood_ratio::max().to_value_type());
+  const __m256i llr_min   = _mm256_set1_epi8(log_likelihood_ratio::min().to_value_type());
+  const __m256i llr_infty = _mm256_set1_epi8(log_likelihood_ratio::infinity().to_value_type());
+
+  __m256i sum = _mm256_min_epi8(_mm256_max_epi8(_mm256_adds_epi8(a, b), llr_min), llr_max);
+  sum         = _mm256_blendv_epi8(sum, b, _mm256_cmpeq_epi8(_mm256_abs_epi8(b), llr_infty));
+  sum         = _mm256_blendv_epi8(sum, a, _mm256_cmpeq_epi8(_mm256_abs_epi8(a), llr_infty));
+  return _mm256_andnot_si256(_mm256_cmpeq_epi8(a, _mm256_sub_epi8(_mm256_setzero_si256(), b)), sum);
+}
+
+void polar_decoder_avx2::function_f(span<log_likelihood_ratio>       z,
+                                    span<const log_likelihood_ratio> x,
+                                    span<const log_likelihood_ratio> y)
+{
+  ocudu_assert(y.size() == x.size(), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX2_SIZE_BYTE) * AVX2_SIZE_BYTE; i != i_end; i += AVX2_SIZE_BYTE) {
+    __m256i x_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x.data() + i));
+    __m256i y_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y.data() + i));
+
+    // Magnitude: minimum of the absolute values.
+    __m256i abs_min = _mm256_min_epu8(_mm256_abs_epi8(x_epi8), _mm256_abs_epi8(y_epi8));
+    // Sign: negative if the input signs differ. The lowest bit is set to avoid zeroing the output.
+    __m256i sign = _mm256_or_si256(_mm256_xor_si256(x_epi8, y_epi8), _mm256_set1_epi8(1));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(z.data() + i), _mm256_sign_epi8(abs_min, sign));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_f(z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_avx2::function_g(span<log_likelihood_ratio>       z,
+                                    span<const log_likelihood_ratio> x,
+                                    span<const log_likelihood_ratio> y,
+                                    span<const uint8_t>              b)
+{
+  ocudu_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX2_SIZE_BYTE) * AVX2_SIZE_BYTE; i != i_end; i += AVX2_SIZE_BYTE) {
+    __m256i x_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x.data() + i));
+    __m256i y_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y.data() + i));
+    __m256i b_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.data() + i));
+
+    // Negate x where the estimated bit is one.
+    __m256i mask = _mm256_sub_epi8(_mm256_setzero_si256(), b_epi8);
+    x_epi8       = _mm256_sub_epi8(_mm256_xor_si256(x_epi8, mask), mask);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(z.data() + i), llr_sum_epi8(x_epi8, y_epi8));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_g(
+        z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i), b.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_avx2::hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x)
+{
+  ocudu_assert(x.size() == z.size(), "Input span sizes must be identical");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX2_SIZE_BYTE) * AVX2_SIZE_BYTE; i != i_end; i += AVX2_SIZE_BYTE) {
+    __m256i x_epi8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x.data() + i));
+
+    // The hard bit is one if the LLR is negative or null.
+    __m256i bits = _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(1), x_epi8), _mm256_set1_epi8(1));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(z.data() + i), bits);
+  }
+
+  if (i != len) {
+    polar_decoder_generic::hard_decision(z.subspan(i, len - i), x.subspan(i, len - i));
+  }
+}
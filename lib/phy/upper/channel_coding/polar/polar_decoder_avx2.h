@@ -0,0 +1,47 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder - declaration of the AVX2-optimized implementation.
+
+#pragma once
+
+#include "polar_decoder_generic.h"
+
+namespace ocudu {
+
+/// \brief Polar decoder implementation based on AVX2 intrinsics.
+///
+/// The LLR kernels process the node LLRs in AVX2 registers. The nodes that are too short to fill a register, as well
+/// as the remainder of the longer ones, are processed by the generic implementation.
+class polar_decoder_avx2 : public polar_decoder_generic
+{
+public:
+  /// Constructor: sets the polar encoder and the maximum code size, see polar_decoder_impl.
+  polar_decoder_avx2(std::unique_ptr<polar_encoder> enc_, uint8_t nMax) :
+    polar_decoder_generic(std::move(enc_), nMax)
+  {
+  }
+
+private:
+  // See polar_decoder_impl for the documentation.
+  void function_f(span<log_likelihood_ratio>       z,
+                  span<const log_likelihood_ratio> x,
+                  span<const log_likelihood_ratio> y) override;
+
+  void function_g(span<log_likelihood_ratio>       z,
+                  span<const log_likelihood_ratio> x,
+                  span<const log_likelihood_ratio> y,
+                  span<const uint8_t>              b) override;
+
+  void hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x) override;
+};
+
+} // namespace ocudu
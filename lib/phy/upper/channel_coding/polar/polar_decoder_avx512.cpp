@@ -0,0 +1,111 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder - definition of the AVX512-optimized implementation.
+
+#include "polar_decoder_avx512.h"
+#include <immintrin.h>
+
+using namespace ocudu;
+
+/// Number of LLRs that fit in an AVX512 register.
+static constexpr unsigned AVX512_SIZE_BYTE = 64;
+
+/// \brief Saturated sum of two AVX512 registers of LLRs.
+///
+/// Replicates log_likelihood_ratio::operator+: finite results are clipped to <tt>&plusmn;LLR_MAX</tt>, infinite
+/// summands propagate and opposite summands cancel out.
+static inline __m512i llr_sum_epi8(__m512i a, __m512i b)
+{
+  const __m512i llr_max   = _mm512_set1_epi8(log_likelihood_ratio::max().to_value_type());
+  const __m512i llr_min   = _mm512_set1_epi8(log_likelihood_ratio::min().to_value_type());
+  const __m512i llr_infty = _mm512_set1_epi8(log_likelihood_ratio::infinity().to_value_type());
+
+  __m512i sum = _mm512_min_epi8(_mm512_max_epi8(_mm512_adds_epi8(a, b), llr_min), llr_max);
+  sum         = _mm512_mask_mov_epi8(sum, _mm512_cmpeq_epi8_mask(_mm512_abs_epi8(b), llr_infty), b);
+  sum         = _mm512_mask_mov_epi8(sum, _mm512_cmpeq_epi8_mask(_mm512_abs_epi8(a), llr_infty), a);
+  return _mm512_maskz_mov_epi8(_mm512_cmpneq_epi8_mask(a, _mm512_sub_epi8(_mm512_setzero_si512(), b)), sum);
+}
+
+void polar_decoder_avx512::function_f(span<log_likelihood_ratio>       z,
+                                      span<const log_likelihood_ratio> x,
+                                      span<const log_likelihood_ratio> y)
+{
+  ocudu_assert(y.size() == x.size(), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX512_SIZE_BYTE) * AVX512_SIZE_BYTE; i != i_end; i += AVX512_SIZE_BYTE) {
+    __m512i x_epi8 = _mm512_loadu_si512(x.data() + i);
+    __m512i y_epi8 = _mm512_loadu_si512(y.data() + i);
+
+    // Magnitude: minimum of the absolute values.
+    __m512i abs_min = _mm512_min_epu8(_mm512_abs_epi8(x_epi8), _mm512_abs_epi8(y_epi8));
+    // Sign: negative if the input signs differ.
+    __mmask64 negative = _mm512_movepi8_mask(_mm512_xor_si512(x_epi8, y_epi8));
+
+    _mm512_storeu_si512(z.data() + i,
+                        _mm512_mask_sub_epi8(abs_min, negative, _mm512_setzero_si512(), abs_min));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_f(z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_avx512::function_g(span<log_likelihood_ratio>       z,
+                                      span<const log_likelihood_ratio> x,
+                                      span<const log_likelihood_ratio> y,
+                                      span<const uint8_t>              b)
+{
+  ocudu_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX512_SIZE_BYTE) * AVX512_SIZE_BYTE; i != i_end; i += AVX512_SIZE_BYTE) {
+    __m512i x_epi8 = _mm512_loadu_si512(x.data() + i);
+    __m512i y_epi8 = _mm512_loadu_si512(y.data() + i);
+    __m512i b_epi8 = _mm512_loadu_si512(b.data() + i);
+
+    // Negate x where the estimated bit is one.
+    __mmask64 mask = _mm512_test_epi8_mask(b_epi8, b_epi8);
+    x_epi8         = _mm512_mask_sub_epi8(x_epi8, mask, _mm512_setzero_si512(), x_epi8);
+
+    _mm512_storeu_si512(z.data() + i, llr_sum_epi8(x_epi8, y_epi8));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_g(
+        z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i), b.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_avx512::hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x)
+{
+  ocudu_assert(x.size() == z.size(), "Input span sizes must be identical");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / AVX512_SIZE_BYTE) * AVX512_SIZE_BYTE; i != i_end; i += AVX512_SIZE_BYTE) {
+    __m512i x_epi8 = _mm512_loadu_si512(x.data() + i);
+
+    // The hard bit is one if the LLR is negative or null.
+    __mmask64 bits = _mm512_cmpgt_epi8_mask(_mm512_set1_epi8(1), x_epi8);
+
+    _mm512_storeu_si512(z.data() + i, _mm512_maskz_mov_epi8(bits, _mm512_set1_epi8(1)));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::hard_decision(z.subspan(i, len - i), x.subspan(i, len - i));
+  }
+}
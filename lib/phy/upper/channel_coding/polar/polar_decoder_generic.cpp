@@ -0,0 +1,52 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder - definition of the generic implementation.
+
+#include "polar_decoder_generic.h"
+
+using namespace ocudu;
+
+/// Combines two log-likelihood ratio: constructively (sum) if b = 0, destructively (difference) if b = 1.
+static log_likelihood_ratio switch_combine(log_likelihood_ratio x, log_likelihood_ratio y, uint8_t b)
+{
+  return ((b == 0) ? (x + y) : (x - y));
+}
+
+void polar_decoder_generic::function_f(span<log_likelihood_ratio>       z,
+                                       span<const log_likelihood_ratio> x,
+                                       span<const log_likelihood_ratio> y)
+{
+  ocudu_assert(y.size() == x.size(), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  std::transform(x.begin(), x.end(), y.begin(), z.begin(), log_likelihood_ratio::soft_xor);
+}
+
+void polar_decoder_generic::function_g(span<log_likelihood_ratio>       z,
+                                       span<const log_likelihood_ratio> x,
+                                       span<const log_likelihood_ratio> y,
+                                       span<const uint8_t>              b)
+{
+  ocudu_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  for (unsigned i = 0, len = x.size(); i != len; ++i) {
+    z[i] = switch_combine(y[i], x[i], b[i]);
+  }
+}
+
+void polar_decoder_generic::hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x)
+{
+  ocudu_assert(x.size() == z.size(), "Input span sizes must be identical");
+
+  std::transform(x.begin(), x.end(), z.begin(), [](log_likelihood_ratio a) { return a.to_hard_bit(); });
+}
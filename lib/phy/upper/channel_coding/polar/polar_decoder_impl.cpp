@@ -11,51 +11,10 @@
 #include "polar_decoder_impl.h"
 #include "ocudu/ocuduvec/binary.h"
 #include "ocudu/ocuduvec/zero.h"
+#include <numeric>
 
 using namespace ocudu;
 
-/// \brief Polar decoder function \f$f\f$.
-///
-/// Vectorial form of the soft xor operation.
-static void
-vec_function_f(span<log_likelihood_ratio> z, span<const log_likelihood_ratio> x, span<const log_likelihood_ratio> y)
-{
-  ocudu_assert(y.size() == x.size(), "Input spans must have the same size.");
-  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
-
-  std::transform(x.begin(), x.end(), y.begin(), z.begin(), log_likelihood_ratio::soft_xor);
-}
-
-/// Combines two log-likelihood ratio: constructively (sum) if b = 0, destructively (difference) if b = 1.
-static log_likelihood_ratio switch_combine(log_likelihood_ratio x, log_likelihood_ratio y, uint8_t b)
-{
-  return ((b == 0) ? (x + y) : (x - y));
-}
-
-/// \brief Polar decoder function \f$g\f$.
-///
-/// Vectorial form of switch_combine.
-static void vec_function_g(span<log_likelihood_ratio>       z,
-                           span<const log_likelihood_ratio> x,
-                           span<const log_likelihood_ratio> y,
-                           span<const uint8_t>              b)
-{
-  ocudu_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
-  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
-
-  for (unsigned i = 0, len = x.size(); i != len; ++i) {
-    z[i] = switch_combine(y[i], x[i], b[i]);
-  }
-}
-
-/// Vectorial form of soft-to-hard bit conversion.
-static void vec_hard_bit(span<log_likelihood_ratio> x, span<uint8_t> z)
-{
-  ocudu_assert(x.size() == z.size(), "Input span sizes must be identical");
-
-  std::transform(x.begin(), x.end(), z.begin(), [](log_likelihood_ratio a) { return a.to_hard_bit(); });
-}
-
 polar_decoder_impl::tmp_node_s::tmp_node_s(uint8_t nMax)
 {
   unsigned max_code_size      = (1U << nMax);
@@ -66,6 +25,9 @@ polar_decoder_impl::tmp_node_s::tmp_node_s(uint8_t nMax)
 
   is_rate_1 = span<uint8_t>(&is_not_rate_0[max_code_size], max_code_size);
 
+  is_rep.resize(max_code_size);
+  is_spc.resize(max_code_size);
+
   i_odd.resize(max_code_half_size);
   i_even.resize(max_code_half_size);
 }
@@ -100,15 +62,32 @@ void polar_decoder_impl::tmp_node_s::compute(std::vector<node_rate*>& node_type,
   for (uint16_t j = 0; j != code_size; ++j) {
     // Set to: 0 if rate-0; 2 if rate-r; 3 if rate 1.
     node_type[s][j] = static_cast<node_rate>(3 * is_not_rate_0[j]);
+    // A single information bit is the last bit of a repetition code, a single frozen bit is the first bit of a single
+    // parity check code.
+    is_rep[j] = is_rate_1[j];
+    is_spc[j] = 1 - is_not_rate_0[j];
   }
   for (s = 1; s != (uint8_t)(code_size_log + 1); ++s) {
     uint16_t code_size_log_s = code_size_log - s;
     uint16_t code_stage_size = (1U << code_size_log_s);
     for (uint16_t j = 0; j != code_stage_size; ++j) {
+      // A node is a repetition node if its left child is rate-0 and its right child is a repetition node, and it is a
+      // single parity check node if its left child is a single parity check node and its right child is rate-1.
+      is_rep[j]        = (1 - is_not_rate_0[i_even[j]]) & is_rep[i_odd[j]];
+      is_spc[j]        = is_spc[i_even[j]] & is_rate_1[i_odd[j]];
       is_not_rate_0[j] = is_not_rate_0[i_even[j]] | is_not_rate_0[i_odd[j]]; // bitor
       is_rate_1[j]     = is_rate_1[i_even[j]] & is_rate_1[i_odd[j]];         // bitand
-      // Set to: 0 if rate-0; 2 if rate-r; 3 if rate 1
-      node_type[s][j] = static_cast<node_rate>(2 * is_not_rate_0[j] + is_rate_1[j]);
+      if (is_not_rate_0[j] == 0) {
+        node_type[s][j] = RATE_0;
+      } else if (is_rate_1[j] == 1) {
+        node_type[s][j] = RATE_1;
+      } else if (is_rep[j] == 1) {
+        node_type[s][j] = REP;
+      } else if (is_spc[j] == 1) {
+        node_type[s][j] = SPC;
+      } else {
+        node_type[s][j] = RATE_R;
+      }
     }
   }
 }
@@ -218,13 +197,12 @@ void polar_decoder_impl::rate_1_node(span<uint8_t> message)
   uint8_t stage = state.stage;
 
   uint16_t bit_pos         = state.active_node_per_stage[0];
-  uint16_t code_size       = param.code_stage_size[param.code_size_log];
   uint16_t code_stage_size = param.code_stage_size[stage];
 
   span<uint8_t> codeword = span<uint8_t>(est_bit).subspan(bit_pos, code_stage_size);
   ocudu_assert(llr0[stage].size() == code_stage_size, "Invalid size ({} != {})", llr0[stage].size(), code_stage_size);
 
-  vec_hard_bit(llr0[stage], codeword);
+  hard_decision(codeword, llr0[stage]);
 
   if (stage != 0) {
     span<uint8_t> message_stage = message.subspan(bit_pos, code_stage_size);
@@ -233,6 +211,62 @@ void polar_decoder_impl::rate_1_node(span<uint8_t> message)
     message[bit_pos] = codeword[0];
   }
 
+  advance_active_node();
+}
+
+void polar_decoder_impl::rep_node(span<uint8_t> message)
+{
+  uint8_t  stage           = state.stage;
+  uint16_t bit_pos         = state.active_node_per_stage[0];
+  uint16_t code_stage_size = param.code_stage_size[stage];
+
+  // The decision on the repeated bit is based on the sum of all the LLRs of the node.
+  int sum = 0;
+  for (log_likelihood_ratio llr : llr0[stage].first(code_stage_size)) {
+    sum += llr.to_int();
+  }
+  uint8_t bit = static_cast<uint8_t>(sum <= 0);
+
+  std::fill_n(est_bit.begin() + bit_pos, code_stage_size, bit);
+
+  // Only the last message bit of the node is an information bit. The others remain set to zero.
+  message[bit_pos + code_stage_size - 1] = bit;
+
+  advance_active_node();
+}
+
+void polar_decoder_impl::spc_node(span<uint8_t> message)
+{
+  uint8_t  stage           = state.stage;
+  uint16_t bit_pos         = state.active_node_per_stage[0];
+  uint16_t code_stage_size = param.code_stage_size[stage];
+
+  span<uint8_t>                    codeword = span<uint8_t>(est_bit).subspan(bit_pos, code_stage_size);
+  span<const log_likelihood_ratio> llr      = llr0[stage].first(code_stage_size);
+
+  hard_decision(codeword, llr);
+
+  // The codeword must have even parity, otherwise flip the least reliable bit.
+  uint8_t parity = std::accumulate(codeword.begin(), codeword.end(), uint8_t(0), std::bit_xor<uint8_t>());
+  if (parity != 0) {
+    const auto* least_reliable =
+        std::min_element(llr.begin(), llr.end(), [](log_likelihood_ratio a, log_likelihood_ratio b) {
+          return std::abs(a.to_int()) < std::abs(b.to_int());
+        });
+    codeword[std::distance(llr.begin(), least_reliable)] ^= 1U;
+  }
+
+  span<uint8_t> message_stage = message.subspan(bit_pos, code_stage_size);
+  enc->encode(message_stage, codeword, stage);
+
+  advance_active_node();
+}
+
+void polar_decoder_impl::advance_active_node()
+{
+  uint8_t  stage     = state.stage;
+  uint16_t code_size = param.code_stage_size[param.code_size_log];
+
   // Update active node at all the stages.
   for (uint8_t i = 0; i <= stage; ++i) {
     state.active_node_per_stage[i] += param.code_stage_size[stage - i];
@@ -255,7 +289,7 @@ void polar_decoder_impl::rate_r_node(span<uint8_t> message)
   uint16_t stage_size      = param.code_stage_size[stage];
   uint16_t stage_half_size = param.code_stage_size[stage - 1];
 
-  vec_function_f(
+  function_f(
       llr0[stage - 1].first(stage_half_size), llr0[stage].first(stage_half_size), llr1[stage].first(stage_half_size));
 
   // Move to the child node to the left (up) of the tree.
@@ -269,7 +303,7 @@ void polar_decoder_impl::rate_r_node(span<uint8_t> message)
   offset0  = bit_pos - stage_half_size;
   estbits0 = est_bit.data() + offset0;
 
-  vec_function_g(llr0[stage - 1].first(stage_half_size),
+  function_g(llr0[stage - 1].first(stage_half_size),
                  llr0[stage].first(stage_half_size),
                  llr1[stage].first(stage_half_size),
                  {estbits0, stage_half_size});
@@ -313,6 +347,12 @@ void polar_decoder_impl::simplified_node(span<uint8_t> message)
     case RATE_R:
       rate_r_node(message);
       break;
+    case REP:
+      rep_node(message);
+      break;
+    case SPC:
+      spc_node(message);
+      break;
     default:
       ocudu_assertion_failure("ERROR: wrong node type {}.", fmt::underlying(param.node_type[stage][bit_pos]));
   }
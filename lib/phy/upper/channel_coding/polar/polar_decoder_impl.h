@@ -20,11 +20,57 @@ namespace ocudu {
 
 /// \brief Polar decoder implementation.
 ///
-/// Generic polar decoder according to the specifications of TS38.212 Section 5.3.1.
+/// Fast Simplified Successive Cancellation (Fast-SSC) polar decoder according to the specifications of TS38.212
+/// Section 5.3.1. Besides the RATE_0, RATE_1 and RATE_R nodes of the SSC algorithm, repetition (REP) and single parity
+/// check (SPC) nodes are decoded without descending the decoding tree.
+///
+/// The LLR kernels (functions \f$f\f$ and \f$g\f$ and the hard decision) are implemented by the derived classes,
+/// which can take advantage of the available SIMD instruction sets.
 class polar_decoder_impl : public polar_decoder
 {
+public:
+  /// \brief Polar decoder initialization.
+  ///
+  /// Initializes all the polar decoder variables according to the Fast-SSC decoder algorithm and the maximum given
+  /// code size.
+  ///
+  /// \param[in] enc_   A polar encoder.
+  /// \param[in] nMax \f$log_2\f$ of the maximum number of bits in the codeword.
+  polar_decoder_impl(std::unique_ptr<polar_encoder> enc_, uint8_t nMax);
+
+  // See interface for the documentation.
+  void decode(span<uint8_t> data_decoded, span<const log_likelihood_ratio> input_llr, const polar_code& code) override;
+
+protected:
+  /// \brief Polar decoder function \f$f\f$.
+  ///
+  /// Vectorial form of the soft XOR operation, see log_likelihood_ratio::soft_xor.
+  /// \param[out] z Output LLRs.
+  /// \param[in]  x First input LLRs.
+  /// \param[in]  y Second input LLRs.
+  virtual void
+  function_f(span<log_likelihood_ratio> z, span<const log_likelihood_ratio> x, span<const log_likelihood_ratio> y) = 0;
+
+  /// \brief Polar decoder function \f$g\f$.
+  ///
+  /// Combines the LLRs in \c y and \c x constructively (saturated sum) if the corresponding estimated bit in \c b is
+  /// zero, destructively (saturated difference) otherwise.
+  /// \param[out] z Output LLRs.
+  /// \param[in]  x First input LLRs.
+  /// \param[in]  y Second input LLRs.
+  /// \param[in]  b Estimated bits.
+  virtual void function_g(span<log_likelihood_ratio>       z,
+                          span<const log_likelihood_ratio> x,
+                          span<const log_likelihood_ratio> y,
+                          span<const uint8_t>              b) = 0;
+
+  /// \brief Vectorial form of the soft-to-hard bit conversion, see log_likelihood_ratio::to_hard_bit.
+  /// \param[out] z Output hard bits, one bit per byte.
+  /// \param[in]  x Input LLRs.
+  virtual void hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x) = 0;
+
 private:
-  /// Types of node in an SSC decoder.
+  /// Types of node in a Fast-SSC decoder.
   enum node_rate : uint8_t {
     /// See function rate_0_node().
     RATE_0 = 0,
@@ -32,6 +78,10 @@ private:
     RATE_R = 2,
     /// See function rate_1_node().
     RATE_1 = 3,
+    /// See function rep_node().
+    REP = 4,
+    /// See function spc_node().
+    SPC = 5,
   };
 
   /// Collection of SSC polar decoder parameters.
@@ -64,6 +114,11 @@ private:
     /// \brief Denotes whether a node is of type [RATE_1](#polar_decoder_impl::node_rate) (value 1) or of another type
     /// (value 0).
     span<uint8_t> is_rate_1;
+    /// Denotes whether all the bits below a node are frozen except for the last one (value 1) or not (value 0).
+    std::vector<uint8_t> is_rep;
+    /// Denotes whether all the bits below a node are information bits except for the first one (value 1) or not (value
+    /// 0).
+    std::vector<uint8_t> is_spc;
     /// List of even-valued node indices.
     std::vector<uint16_t> i_even;
     /// List of odd-valued node indices.
@@ -122,6 +177,23 @@ private:
   /// by making a hard decision on them. RATE_1 nodes also update message bits vector.
   void rate_1_node(span<uint8_t> data_decoded);
 
+  /// \brief Updates a REP node.
+  ///
+  /// All bits below a REP node at stage \f$ s \f$ are frozen except for the last one. The \f$2^s\f$ estimated bits
+  /// are all equal to the decoded message bit, which is obtained from the hard decision on the sum of the node LLRs.
+  void rep_node(span<uint8_t> data_decoded);
+
+  /// \brief Updates an SPC node.
+  ///
+  /// All bits below an SPC node at stage \f$ s \f$ are information bits except for the first one. The \f$2^s\f$
+  /// estimated bits are obtained by hard decision on the node LLRs and, if the resulting word has odd parity, by
+  /// flipping the least reliable bit.
+  void spc_node(span<uint8_t> data_decoded);
+
+  /// Moves the active node of all stages up to the current one to the next node and checks whether the decoding is
+  /// finished.
+  void advance_active_node();
+
   /// \brief Updates a RATE_R node.
   ///
   /// RATE_R nodes at stage \f$ s \f$ return the associated \f$2^s\f$ decoded bit by calling
@@ -130,23 +202,10 @@ private:
 
   /// \brief Node processing.
   ///
-  /// Switches between the different [types of node](#polar_decoder_impl::node_rate) for the SSC algorithm.
+  /// Switches between the different [types of node](#polar_decoder_impl::node_rate) for the Fast-SSC algorithm.
   /// Nodes in the decoding tree at stage \f$ s\f$ get the \f$2^s\f$ LLRs from the parent node and
   /// return the associated \f$2^s\f$ estimated bits.
   void simplified_node(span<uint8_t> data_decoded);
-
-public:
-  /// \brief Polar decoder initialization.
-  ///
-  /// Initializes all the polar decoder variables according to the Simplified Successive
-  /// Cancellation (SSC) decoder algorithm and the maximum given code size.
-  ///
-  /// \param[in] enc_   A polar encoder.
-  /// \param[in] nMax \f$log_2\f$ of the maximum number of bits in the codeword.
-  polar_decoder_impl(std::unique_ptr<polar_encoder> enc_, uint8_t nMax);
-
-  // See interface for the documentation.
-  void decode(span<uint8_t> data_decoded, span<const log_likelihood_ratio> input_llr, const polar_code& code) override;
 };
 
 } // namespace ocudu
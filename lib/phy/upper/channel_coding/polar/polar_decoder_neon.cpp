@@ -0,0 +1,107 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder - definition of the NEON-optimized implementation.
+
+#include "polar_decoder_neon.h"
+#include <arm_neon.h>
+
+using namespace ocudu;
+
+/// Number of LLRs that fit in a NEON register.
+static constexpr unsigned NEON_SIZE_BYTE = 16;
+
+/// \brief Saturated sum of two NEON registers of LLRs.
+///
+/// Replicates log_likelihood_ratio::operator+: finite results are clipped to <tt>&plusmn;LLR_MAX</tt>, infinite
+/// summands propagate and opposite summands cancel out.
+static inline int8x16_t llr_sum_s8(int8x16_t a, int8x16_t b)
+{
+  const int8x16_t llr_max   = vdupq_n_s8(log_likelihood_ratio::max().to_value_type());
+  const int8x16_t llr_min   = vdupq_n_s8(log_likelihood_ratio::min().to_value_type());
+  const int8x16_t llr_infty = vdupq_n_s8(log_likelihood_ratio::infinity().to_value_type());
+
+  int8x16_t sum = vminq_s8(vmaxq_s8(vqaddq_s8(a, b), llr_min), llr_max);
+  sum           = vbslq_s8(vceqq_s8(vabsq_s8(b), llr_infty), b, sum);
+  sum           = vbslq_s8(vceqq_s8(vabsq_s8(a), llr_infty), a, sum);
+  return vbicq_s8(sum, vreinterpretq_s8_u8(vceqq_s8(a, vnegq_s8(b))));
+}
+
+void polar_decoder_neon::function_f(span<log_likelihood_ratio>       z,
+                                    span<const log_likelihood_ratio> x,
+                                    span<const log_likelihood_ratio> y)
+{
+  ocudu_assert(y.size() == x.size(), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / NEON_SIZE_BYTE) * NEON_SIZE_BYTE; i != i_end; i += NEON_SIZE_BYTE) {
+    int8x16_t x_s8 = vld1q_s8(reinterpret_cast<const int8_t*>(x.data() + i));
+    int8x16_t y_s8 = vld1q_s8(reinterpret_cast<const int8_t*>(y.data() + i));
+
+    // Magnitude: minimum of the absolute values.
+    int8x16_t abs_min = vminq_s8(vabsq_s8(x_s8), vabsq_s8(y_s8));
+    // Sign: negative if the input signs differ.
+    uint8x16_t negative = vcltzq_s8(veorq_s8(x_s8, y_s8));
+
+    vst1q_s8(reinterpret_cast<int8_t*>(z.data() + i), vbslq_s8(negative, vnegq_s8(abs_min), abs_min));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_f(z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_neon::function_g(span<log_likelihood_ratio>       z,
+                                    span<const log_likelihood_ratio> x,
+                                    span<const log_likelihood_ratio> y,
+                                    span<const uint8_t>              b)
+{
+  ocudu_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
+  ocudu_assert(z.size() == x.size(), "Input and output spans must have the same size.");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / NEON_SIZE_BYTE) * NEON_SIZE_BYTE; i != i_end; i += NEON_SIZE_BYTE) {
+    int8x16_t  x_s8 = vld1q_s8(reinterpret_cast<const int8_t*>(x.data() + i));
+    int8x16_t  y_s8 = vld1q_s8(reinterpret_cast<const int8_t*>(y.data() + i));
+    uint8x16_t b_u8 = vld1q_u8(b.data() + i);
+
+    // Negate x where the estimated bit is one.
+    x_s8 = vbslq_s8(vtstq_u8(b_u8, b_u8), vnegq_s8(x_s8), x_s8);
+
+    vst1q_s8(reinterpret_cast<int8_t*>(z.data() + i), llr_sum_s8(x_s8, y_s8));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::function_g(
+        z.subspan(i, len - i), x.subspan(i, len - i), y.subspan(i, len - i), b.subspan(i, len - i));
+  }
+}
+
+void polar_decoder_neon::hard_decision(span<uint8_t> z, span<const log_likelihood_ratio> x)
+{
+  ocudu_assert(x.size() == z.size(), "Input span sizes must be identical");
+
+  unsigned len = x.size();
+  unsigned i   = 0;
+  for (unsigned i_end = (len / NEON_SIZE_BYTE) * NEON_SIZE_BYTE; i != i_end; i += NEON_SIZE_BYTE) {
+    int8x16_t x_s8 = vld1q_s8(reinterpret_cast<const int8_t*>(x.data() + i));
+
+    // The hard bit is one if the LLR is negative or null.
+    vst1q_u8(z.data() + i, vandq_u8(vclezq_s8(x_s8), vdupq_n_u8(1)));
+  }
+
+  if (i != len) {
+    polar_decoder_generic::hard_decision(z.subspan(i, len - i), x.subspan(i, len - i));
+  }
+}
@@ -286,74 +286,85 @@ void pdsch_processor_flexible_impl::sync_pdsch_cb_processing()
 
 void pdsch_processor_flexible_impl::fork_cb_batches()
 {
-  // Codeword index is fix.
-  static constexpr unsigned i_cw = 0;
-
   // Homogeneous batches of CBs will be processed per thread, unless otherwise specified.
-  unsigned nof_cb_per_batch = std::max(1U, max_nof_codeblocks_per_batch);
+  nof_cb_per_batch = std::max(1U, max_nof_codeblocks_per_batch);
 
-  // Limit the number of tasks to the number of codeblock batches.
-  unsigned nof_cb_batches = divide_ceil(nof_cb, nof_cb_per_batch);
+  // Calculate the number of codeblock batches.
+  nof_cb_batches = divide_ceil(nof_cb, nof_cb_per_batch);
 
-  // Set number of codeblock batches.
+  // Reset the batch claiming index.
+  next_cb_batch = 0;
+
+  // Create as many workers as batches, the calling thread is one of them. Workers that start after all the batches
+  // are claimed finish immediately.
   cb_task_counter = nof_cb_batches;
 
-  // Spawn a task for each codeblock bactch.
-  for (unsigned i_task = 0; i_task != nof_cb_batches; ++i_task) {
-    // Queue batches in reverse order.
-    unsigned i_batch = nof_cb_batches - 1 - i_task;
-
-    // Create asynchronous task for the codeblock batch.
-    auto async_task = [this, nof_cb_per_batch, i_batch]() noexcept OCUDU_RTSAN_NONBLOCKING {
-      // Start PDSCH codeblock batch tracing.
-      trace_point cb_batch_pdsch_tp = l1_dl_tracer.now();
-
-      // Code to execute when returning.
-      auto exec_at_exit = make_scope_exit([this]() { // Decrement code block batch counter.
-        if (cb_task_counter.fetch_sub(1) == 1) {
-          // No more code block tasks pending to execute, it is now safe to discard the TB buffer.
-          data.release();
-          // Decrement asynchronous task counter.
-          if (async_task_counter.fetch_sub(1) == 1) {
-            // Notify end of the processing.
-            notifier->on_finish_processing();
-          }
-        }
-      });
+  // Spawn the asynchronous workers.
+  for (unsigned i_worker = 1; i_worker != nof_cb_batches; ++i_worker) {
+    bool successful = executor.defer([this]() noexcept OCUDU_RTSAN_NONBLOCKING { process_cb_batches(); });
 
-      // Select codeblock processor.
-      auto block_processor = block_processor_pool->get();
-      if (!block_processor) {
-        logger.error("Failed to retrieve PDSCH codeblock processor.");
-        return;
+    // The rest of the workers process the batches of the worker that could not be enqueued. The counter cannot reach
+    // zero as the calling thread has not finished yet.
+    if (!successful) {
+      cb_task_counter.fetch_sub(1);
+    }
+  }
+
+  // Process batches from the calling thread.
+  process_cb_batches();
+}
+
+void pdsch_processor_flexible_impl::process_cb_batches()
+{
+  // Codeword index is fix.
+  static constexpr unsigned i_cw = 0;
+
+  // Code to execute when returning.
+  auto exec_at_exit = make_scope_exit([this]() {
+    // Decrement codeblock worker counter.
+    if (cb_task_counter.fetch_sub(1) == 1) {
+      // No more code block tasks pending to execute, it is now safe to discard the TB buffer.
+      data.release();
+      // Decrement asynchronous task counter.
+      if (async_task_counter.fetch_sub(1) == 1) {
+        // Notify end of the processing.
+        notifier->on_finish_processing();
       }
+    }
+  });
+
+  // Skip the worker if all the batches are already claimed.
+  if (next_cb_batch.load(std::memory_order_relaxed) >= nof_cb_batches) {
+    return;
+  }
 
-      // Calculate the first codeblock index within the batch.
-      unsigned first_cb_index = i_batch * nof_cb_per_batch;
+  // Select codeblock processor.
+  auto block_processor = block_processor_pool->get();
+  if (!block_processor) {
+    logger.error("Failed to retrieve PDSCH codeblock processor.");
+    return;
+  }
 
-      // Limit batch size for the last batch.
-      unsigned next_cb_batch_length = std::min(nof_cb - first_cb_index, nof_cb_per_batch);
+  // Claim batches until all of them are processed.
+  for (unsigned i_batch = next_cb_batch.fetch_add(1, std::memory_order_relaxed); i_batch < nof_cb_batches;
+       i_batch = next_cb_batch.fetch_add(1, std::memory_order_relaxed)) {
+    // Start PDSCH codeblock batch tracing.
+    trace_point cb_batch_pdsch_tp = l1_dl_tracer.now();
 
-      // Configure new transmission.
-      resource_grid_mapper::symbol_buffer& grid_buffer = block_processor->configure_new_transmission(
-          data.get_buffer(), i_cw, config, *segment_buffer, first_cb_index, next_cb_batch_length);
+    // Calculate the first codeblock index within the batch.
+    unsigned first_cb_index = i_batch * nof_cb_per_batch;
 
-      // Map PDSCH.
-      mapper->map(*grid, grid_buffer, allocation, reserved, precoding, re_offset[first_cb_index]);
+    // Limit batch size for the last batch.
+    unsigned next_cb_batch_length = std::min(nof_cb - first_cb_index, nof_cb_per_batch);
 
-      // Trace PDSCH.
-      l1_dl_tracer << trace_event("CB batch", cb_batch_pdsch_tp);
-    };
+    // Configure new transmission.
+    resource_grid_mapper::symbol_buffer& grid_buffer = block_processor->configure_new_transmission(
+        data.get_buffer(), i_cw, config, *segment_buffer, first_cb_index, next_cb_batch_length);
 
-    // Try to execute task asynchronously.
-    bool successful = false;
-    if (nof_cb_batches > 1) {
-      successful = executor.defer(async_task);
-    }
+    // Map PDSCH.
+    mapper->map(*grid, grid_buffer, allocation, reserved, precoding, re_offset[first_cb_index]);
 
-    // Execute task locally if it was not enqueued.
-    if (!successful) {
-      async_task();
-    }
+    // Trace PDSCH.
+    l1_dl_tracer << trace_event("CB batch", cb_batch_pdsch_tp);
   }
 }
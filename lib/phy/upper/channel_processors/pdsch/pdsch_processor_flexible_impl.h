@@ -24,6 +24,10 @@ namespace ocudu {
 /// \brief Implements a flexible PDSCH processor with parameterizable concurrent codeblock processing and memory
 /// footprint.
 ///
+/// The codeblocks of a transmission are grouped in batches. The calling thread and the workers spawned in \ref executor
+/// claim the batches dynamically, so that a batch is processed by the first thread that becomes available. Each batch
+/// is mapped onto the resource grid as soon as it is encoded and modulated.
+///
 /// \remark The number of PDSCH codeblock processor instances contained in \ref block_processor_pool must be equal to or
 /// greater than the number of consumers in \ref executor. Otherwise, an assertion is triggered at runtime.
 class pdsch_processor_flexible_impl : public pdsch_processor
@@ -83,9 +87,15 @@ private:
   /// Synchronous CB processing.
   void sync_pdsch_cb_processing();
 
-  /// Creates code block processing batches and starts the asynchronous processing.
+  /// Creates the codeblock processing workers and processes codeblock batches from the calling thread.
   void fork_cb_batches();
 
+  /// \brief Processes codeblock batches until all of them are claimed.
+  ///
+  /// It runs in every codeblock processing worker. The last worker to finish notifies the end of the codeblock
+  /// processing.
+  void process_cb_batches();
+
   ocudulog::basic_logger& logger;
   /// Pointer to an LDPC segmenter.
   std::unique_ptr<ldpc_segmenter_tx> segmenter;
@@ -111,6 +121,10 @@ private:
   unsigned nof_cb = 0;
   /// Maximum number of codeblocks per batch.
   unsigned max_nof_codeblocks_per_batch;
+  /// Number of codeblocks per batch of the current transmission.
+  unsigned nof_cb_per_batch = 0;
+  /// Number of codeblock batches of the current transmission.
+  unsigned nof_cb_batches = 0;
   /// Indicates whether the current transmission is concurrent (true) or not.
   bool async_proc = false;
   /// PDSCH transmission allocation pattern.
@@ -121,7 +135,9 @@ private:
   precoding_configuration precoding;
   /// Codeblock resource block offset.
   static_vector<unsigned, MAX_NOF_SEGMENTS> re_offset;
-  /// Pending code block batch counter.
+  /// Index of the next codeblock batch to process.
+  std::atomic<unsigned> next_cb_batch;
+  /// Pending codeblock processing worker counter.
   std::atomic<unsigned> cb_task_counter;
   /// Pending asynchronous task counter (DM-RS and CB processing).
   std::atomic<unsigned> async_task_counter;
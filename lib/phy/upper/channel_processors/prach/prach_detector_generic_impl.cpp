@@ -13,19 +13,20 @@
 #include "ocudu/adt/interval.h"
 #include "ocudu/ocuduvec/accumulate.h"
 #include "ocudu/ocuduvec/add.h"
-#include "ocudu/ocuduvec/compare.h"
 #include "ocudu/ocuduvec/conversion.h"
 #include "ocudu/ocuduvec/copy.h"
-#include "ocudu/ocuduvec/division.h"
 #include "ocudu/ocuduvec/dot_prod.h"
 #include "ocudu/ocuduvec/modulus_square.h"
 #include "ocudu/ocuduvec/prod.h"
-#include "ocudu/ocuduvec/sc_prod.h"
+#include "ocudu/ocuduvec/simd.h"
 #include "ocudu/ocuduvec/zero.h"
+#include "ocudu/phy/antenna_ports.h"
 #include "ocudu/phy/upper/channel_processors/prach/prach_detector_phy_validator.h"
 #include "ocudu/ran/prach/prach_cyclic_shifts.h"
 #include "ocudu/ran/prach/prach_preamble_information.h"
 #include "ocudu/support/math/math_utils.h"
+#include <cfloat>
+#include <numeric>
 
 using namespace ocudu;
 
@@ -34,11 +35,141 @@ error_type<std::string> prach_detector_validator_impl::is_valid(const prach_dete
   return validate_prach_detector_phy(config.format, config.ra_scs, config.zero_correlation_zone, config.nof_rx_ports);
 }
 
+/// \brief Accumulates the detection metric numerator and denominator of a correlation window.
+///
+/// The correlation power, scaled by \c scaling, is accumulated in the numerator. The noise is estimated for each
+/// possible timing offset in the detection window by subtracting the scaled correlation power (roughly speaking, an
+/// estimation of the PRACH power) from \c reference (roughly speaking, the total measured energy), and it is
+/// accumulated in the denominator.
+///
+/// \param[in,out] num        Metric numerator accumulator.
+/// \param[in,out] den        Metric denominator accumulator.
+/// \param[in]     mod_square Modulus square of the correlation within the window.
+/// \param[in]     scaling    Correlation power scaling factor.
+/// \param[in]     reference  Reference power measurement, including noise.
+static void
+accumulate_window_metric(span<float> num, span<float> den, span<const float> mod_square, float scaling, float reference)
+{
+  ocudu_assert(num.size() == mod_square.size(), "Numerator and input sizes do not match.");
+  ocudu_assert(den.size() == mod_square.size(), "Denominator and input sizes do not match.");
+
+  // Noise estimate used when the difference is not a normal number.
+  static constexpr float default_noise = 1e-9F;
+
+  unsigned i = 0;
+  unsigned N = mod_square.size();
+
+#if OCUDU_SIMD_F_SIZE
+  simd_f_t scaling_simd   = ocudu_simd_f_set1(scaling);
+  simd_f_t reference_simd = ocudu_simd_f_set1(reference);
+  simd_f_t default_simd   = ocudu_simd_f_set1(default_noise);
+  // A number is normal if its magnitude is larger than the largest subnormal number and it is finite.
+  simd_f_t subnormal_simd = ocudu_simd_f_set1(std::nextafter(FLT_MIN, 0.0F));
+  simd_f_t infinity_simd  = ocudu_simd_f_set1(INFINITY);
+
+  for (unsigned i_end = (N / OCUDU_SIMD_F_SIZE) * OCUDU_SIMD_F_SIZE; i != i_end; i += OCUDU_SIMD_F_SIZE) {
+    simd_f_t value = ocudu_simd_f_mul(ocudu_simd_f_loadu(mod_square.data() + i), scaling_simd);
+
+    // Accumulate numerator.
+    ocudu_simd_f_storeu(num.data() + i, ocudu_simd_f_add(value, ocudu_simd_f_loadu(num.data() + i)));
+
+    // Estimate noise and accumulate denominator.
+    simd_f_t   diff      = ocudu_simd_f_sub(reference_simd, value);
+    simd_f_t   abs_diff  = ocudu_simd_f_abs(diff);
+    simd_sel_t is_normal = ocudu_simd_sel_and(ocudu_simd_f_max(abs_diff, subnormal_simd),
+                                              ocudu_simd_f_min(abs_diff, infinity_simd));
+    diff                 = ocudu_simd_f_select(default_simd, diff, is_normal);
+    ocudu_simd_f_storeu(den.data() + i, ocudu_simd_f_add(diff, ocudu_simd_f_loadu(den.data() + i)));
+  }
+#endif // OCUDU_SIMD_F_SIZE
+
+  for (; i != N; ++i) {
+    float value = mod_square[i] * scaling;
+    num[i]      = value + num[i];
+
+    float diff = reference - value;
+    if (!std::isnormal(diff)) {
+      diff = default_noise;
+    }
+    den[i] = diff + den[i];
+  }
+}
+
+/// \brief Computes the detection metric of a correlation window and finds its peak.
+///
+/// The metric is the ratio between the numerator and the absolute value of the denominator. It is set to zero if
+/// any of the terms is not a normal number.
+///
+/// \param[in] num Metric numerator.
+/// \param[in] den Metric denominator.
+/// \return A pair containing the delay of the metric peak, in samples, and the peak value.
+static std::pair<unsigned, float> find_metric_peak(span<const float> num, span<const float> den)
+{
+  ocudu_assert(num.size() == den.size(), "Numerator and denominator sizes do not match.");
+
+  unsigned i         = 0;
+  unsigned N         = num.size();
+  unsigned max_index = 0;
+  float    max_value = 0;
+
+#if OCUDU_SIMD_F_SIZE && OCUDU_SIMD_I_SIZE
+  // Prepare range of indexes in SIMD register.
+  alignas(SIMD_BYTE_ALIGN) std::array<int32_t, OCUDU_SIMD_I_SIZE> simd_vector_max_indexes = {};
+  std::iota(simd_vector_max_indexes.begin(), simd_vector_max_indexes.end(), 0);
+  simd_i_t simd_indexes = ocudu_simd_i_load(simd_vector_max_indexes.data());
+
+  simd_i_t simd_inc         = ocudu_simd_i_set1(OCUDU_SIMD_I_SIZE);
+  simd_i_t simd_max_indexes = ocudu_simd_i_set1(0);
+  simd_f_t simd_max_values  = ocudu_simd_f_set1(-INFINITY);
+
+  for (unsigned i_end = (N / OCUDU_SIMD_F_SIZE) * OCUDU_SIMD_F_SIZE; i != i_end; i += OCUDU_SIMD_F_SIZE) {
+    // Compute the metric.
+    simd_f_t den_simd = ocudu_simd_f_abs(ocudu_simd_f_loadu(den.data() + i));
+    simd_f_t metric   = ocudu_simd_f_mul(ocudu_simd_f_loadu(num.data() + i), ocudu_simd_f_rcp(den_simd));
+
+    // Select the indexes and values for the maximum.
+    simd_sel_t is_max = ocudu_simd_f_max(metric, simd_max_values);
+    simd_max_indexes  = ocudu_simd_i_select(simd_max_indexes, simd_indexes, is_max);
+    simd_max_values   = ocudu_simd_f_select(simd_max_values, metric, is_max);
+
+    // Increment indexes.
+    simd_indexes = ocudu_simd_i_add(simd_indexes, simd_inc);
+  }
+
+  // Find the maximum value within the SIMD registers.
+  alignas(SIMD_BYTE_ALIGN) std::array<float, OCUDU_SIMD_F_SIZE> simd_vector_max_values = {};
+  ocudu_simd_i_store(simd_vector_max_indexes.data(), simd_max_indexes);
+  ocudu_simd_f_store(simd_vector_max_values.data(), simd_max_values);
+
+  const float* it             = std::max_element(simd_vector_max_values.begin(), simd_vector_max_values.end());
+  unsigned     simd_max_index = static_cast<unsigned>(it - simd_vector_max_values.begin());
+  max_index                   = simd_vector_max_indexes[simd_max_index];
+  max_value                   = simd_vector_max_values[simd_max_index];
+#endif // OCUDU_SIMD_F_SIZE && OCUDU_SIMD_I_SIZE
+
+  for (; i != N; ++i) {
+    float abs_den = std::abs(den[i]);
+    float metric  = 0.0F;
+    if (std::isnormal(num[i]) && std::isnormal(abs_den)) {
+      metric = num[i] / abs_den;
+    }
+
+    if (metric > max_value) {
+      max_index = i;
+      max_value = metric;
+    }
+  }
+
+  return {max_index, max_value};
+}
+
 prach_detector_generic_impl::prach_detector_generic_impl(std::unique_ptr<dft_processor>   idft_long_,
                                                          std::unique_ptr<dft_processor>   idft_short_,
                                                          std::unique_ptr<prach_generator> generator_) :
+  combined_symbols({MAX_NOF_SAMPLES_PER_PORT, 1, MAX_PORTS}),
+  root_sequences({prach_constants::LONG_SEQUENCE_LENGTH, prach_constants::MAX_NUM_PREAMBLES}),
+  root_sequences_mask(prach_constants::MAX_NUM_PREAMBLES),
   temp(),
-  temp2(),
   idft_long(std::move(idft_long_)),
   idft_short(std::move(idft_short_)),
   generator(std::move(generator_))
@@ -63,6 +194,33 @@ prach_detector_generic_impl::prach_detector_generic_impl(std::unique_ptr<dft_pro
                idft_long_sz_range);
 }
 
+span<const cf_t>
+prach_detector_generic_impl::get_root_sequence(const root_sequence_cache_key& key, unsigned i_sequence, unsigned L_ra)
+{
+  // Invalidate the cache if the root sequences parameters changed.
+  if (!root_sequences_key.has_value() || !(*root_sequences_key == key)) {
+    root_sequences_key.emplace(key);
+    root_sequences_mask.reset();
+  }
+
+  span<cf_t> root = root_sequences.get_view({i_sequence}).first(L_ra);
+
+  // Generate the root sequence if it is not cached.
+  if (!root_sequences_mask.test(i_sequence)) {
+    prach_generator::configuration generator_config;
+    generator_config.format                = key.format;
+    generator_config.root_sequence_index   = key.root_sequence_index;
+    generator_config.preamble_index        = i_sequence * key.nof_shifts;
+    generator_config.restricted_set        = key.restricted_set;
+    generator_config.zero_correlation_zone = key.zero_correlation_zone;
+
+    ocuduvec::copy(root, generator->generate(generator_config));
+    root_sequences_mask.set(i_sequence);
+  }
+
+  return root;
+}
+
 prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& input, const configuration& config)
 {
   ocudu_assert(config.start_preamble_index + config.nof_preamble_indices <= prach_constants::MAX_NUM_PREAMBLES,
@@ -180,6 +338,41 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
     return result;
   }
 
+  // Convert the PRACH symbols of all receive ports and combine them, if applicable, before correlating them with the
+  // root sequences.
+  unsigned nof_combined_symbols = (combine_symbols) ? 1 : nof_symbols;
+  combined_symbols.resize({L_ra, nof_combined_symbols, config.nof_rx_ports});
+  for (unsigned i_port = 0; i_port != config.nof_rx_ports; ++i_port) {
+    for (unsigned i_symbol = 0; i_symbol != nof_combined_symbols; ++i_symbol) {
+      span<cf_t> symbol = combined_symbols.get_view({i_symbol, i_port});
+
+      // Copy the PRACH symbol.
+      ocuduvec::convert(symbol, input.get_symbol(i_port, i_td_occasion, i_fd_occasion, i_symbol));
+
+      // Combine the rest of PRACH symbols.
+      if (combine_symbols) {
+        for (unsigned i_comb_symbol = 1; i_comb_symbol != nof_symbols; ++i_comb_symbol) {
+          ocuduvec::add(symbol, symbol, input.get_symbol(i_port, i_td_occasion, i_fd_occasion, i_comb_symbol));
+        }
+      }
+    }
+  }
+
+  // Parameters identifying the root sequences.
+  root_sequence_cache_key root_key = {.format                = config.format,
+                                      .root_sequence_index   = config.root_sequence_index,
+                                      .restricted_set        = config.restricted_set,
+                                      .zero_correlation_zone = config.zero_correlation_zone,
+                                      .nof_shifts            = nof_shifts};
+
+  // Scaling of the correlation power: the modulus square is divided by the DFT size to compensate for the inherent
+  // scaling of the DFT, and by L_ra to compensate for the amplitude of the ZC sequence in the frequency domain
+  // (provided by the internal generator in the span "root").
+  float reference_scaling = 1.0F / static_cast<float>(dft_size * L_ra);
+
+  // Scaling of the correlation power within the detection windows.
+  float window_scaling = reference_scaling * static_cast<float>(dft_size) / static_cast<float>(L_ra);
+
   // Get view of the IDFT input and zero it.
   span<cf_t> idft_input = idft.get_input();
   ocuduvec::zero(idft_input);
@@ -193,16 +386,8 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
       continue;
     }
 
-    // Prepare root sequence configuration.
-    prach_generator::configuration generator_config;
-    generator_config.format                = config.format;
-    generator_config.root_sequence_index   = config.root_sequence_index;
-    generator_config.preamble_index        = i_sequence * nof_shifts;
-    generator_config.restricted_set        = config.restricted_set;
-    generator_config.zero_correlation_zone = config.zero_correlation_zone;
-
-    // Generate root sequence.
-    span<const cf_t> root = generator->generate(generator_config);
+    // Get root sequence.
+    span<const cf_t> root = get_root_sequence(root_key, i_sequence, L_ra);
 
     // Prepare metric global numerator.
     metric_global_num.resize({win_width, nof_shifts});
@@ -212,37 +397,14 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
     metric_global_den.resize({win_width, nof_shifts});
     ocuduvec::zero(metric_global_den.get_data());
 
-    // Iterate over all receive ports.
+    // Iterate over all receive ports and the PRACH symbols.
     for (unsigned i_port = 0; i_port != config.nof_rx_ports; ++i_port) {
-      // Iterate all PRACH symbols if they are not combined, otherwise process only one PRACH symbol.
-      for (unsigned i_symbol = 0, i_symbol_end = (combine_symbols) ? 1 : nof_symbols; i_symbol != i_symbol_end;
-           ++i_symbol) {
-        // Get a temporary destination for the symbol combination.
-        span<cf_t> combined_symbols = span<cf_t>(cf_temp).first(L_ra);
-
-        // Get view of the preamble.
-        span<const cbf16_t> preamble = input.get_symbol(i_port, i_td_occasion, i_fd_occasion, i_symbol);
-
-        // Copy the first PRACH symbol.
-        ocuduvec::convert(combined_symbols, preamble);
-
-        // Combine the rest of PRACH symbols.
-        if (combine_symbols && (nof_symbols > 1)) {
-          for (unsigned i_comb_symbol = 1; i_comb_symbol != nof_symbols; ++i_comb_symbol) {
-            ocuduvec::add(combined_symbols,
-                          combined_symbols,
-                          input.get_symbol(i_port, i_td_occasion, i_fd_occasion, i_comb_symbol));
-          }
-        }
+      for (unsigned i_symbol = 0; i_symbol != nof_combined_symbols; ++i_symbol) {
+        span<const cf_t> symbol = combined_symbols.get_view({i_symbol, i_port});
 
-        // Multiply the preamble by the complex conjugate of the root sequence.
-        std::array<cf_t, prach_constants::LONG_SEQUENCE_LENGTH> no_root_temp;
-        span<cf_t>                                              no_root = span<cf_t>(no_root_temp).first(L_ra);
-        ocuduvec::prod_conj(no_root, combined_symbols, root);
-
-        // Prepare IDFT for correlation.
-        ocuduvec::copy(idft_input.first(L_ra / 2 + 1), no_root.last(L_ra / 2 + 1));
-        ocuduvec::copy(idft_input.last(L_ra / 2), no_root.first(L_ra / 2));
+        // Multiply the preamble by the complex conjugate of the root sequence, directly in the IDFT input.
+        ocuduvec::prod_conj(idft_input.first(L_ra / 2 + 1), symbol.last(L_ra / 2 + 1), root.last(L_ra / 2 + 1));
+        ocuduvec::prod_conj(idft_input.last(L_ra / 2), symbol.first(L_ra / 2), root.first(L_ra / 2));
 
         // Perform IDFT.
         span<const cf_t> no_root_time_simple = idft.run();
@@ -251,11 +413,6 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
         span<float> mod_square = span<float>(temp).first(dft_size);
         ocuduvec::modulus_square(mod_square, no_root_time_simple);
 
-        // Normalize the signal: we divide by the DFT size to compensate for the inherent scaling of the DFT, and by
-        // L_ra to compensate for the amplitude of the ZC sequence in the frequency domain (provided by
-        // by the internal generator in the span "root").
-        ocuduvec::sc_prod(mod_square, mod_square, 1.0F / static_cast<float>(dft_size * L_ra));
-
         // Process each shift of the sequence.
         for (unsigned i_window = 0; i_window != nof_shifts; ++i_window) {
           // Calculate the start of the window.
@@ -272,25 +429,12 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
             }
           }
 
-          // Select modulus square view for the window.
-          span<float> window_mod_square = span<float>(temp2).first(win_width);
-
-          // Scale window.
-          ocuduvec::sc_prod(window_mod_square,
-                            mod_square.subspan(window_start, win_width),
-                            static_cast<float>(dft_size) / static_cast<float>(L_ra));
-
-          // Select metric global numerator.
-          span<float> window_metric_global_num = metric_global_num.get_view({i_window});
-
-          // Select metric global denominator.
-          span<float> window_metric_global_den = metric_global_den.get_view({i_window});
-
-          // Scale modulus square and accumulate numerator.
-          ocuduvec::add(window_metric_global_num, window_mod_square, window_metric_global_num);
-
-          // Scale modulus square and accumulate denominator.
-          vector_noise_estimation(window_metric_global_den, reference, window_mod_square);
+          // Accumulate the metric numerator and denominator.
+          accumulate_window_metric(metric_global_num.get_view({i_window}),
+                                   metric_global_den.get_view({i_window}),
+                                   mod_square.subspan(window_start, win_width),
+                                   window_scaling,
+                                   reference * reference_scaling);
         }
       }
     }
@@ -306,18 +450,11 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
       }
 
       // Select metric global.
-      span<float> metric_global            = span<float>(temp).first(win_width);
-      span<float> window_metric_global_num = metric_global_num.get_view({i_window});
-      span<float> window_metric_global_den = metric_global_den.get_view({i_window});
-
-      // Process metric global.
-      for (float& a : window_metric_global_den) {
-        a = std::abs(a);
-      }
-      ocuduvec::divide(metric_global, window_metric_global_num, window_metric_global_den);
+      span<const float> window_metric_global_num = metric_global_num.get_view({i_window});
+      span<const float> window_metric_global_den = metric_global_den.get_view({i_window});
 
-      // Find maximum.
-      std::pair<unsigned, float> max_element = ocuduvec::max_element(metric_global);
+      // Compute the metric and find its maximum.
+      std::pair<unsigned, float> max_element = find_metric_peak(window_metric_global_num, window_metric_global_den);
 
       // Extract peak value and index from the iterator.
       unsigned delay = max_element.first;
@@ -325,7 +462,7 @@ prach_detection_result prach_detector_generic_impl::detect(const prach_buffer& i
 
       // Compare with the threshold. Note that we neglect the last 1/5 of the detection window because it may contain
       // spurious peaks due to the adjacent window.
-      if ((delay < metric_global.size()) && (peak > threshold) &&
+      if ((delay < win_width) && (peak > threshold) &&
           (delay < static_cast<float>(max_delay_samples) * 0.8)) {
         prach_detection_result::preamble_indication& info = result.preambles.emplace_back();
         info.preamble_index                               = preamble_index;
@@ -10,11 +10,14 @@
 
 #pragma once
 
+#include "ocudu/adt/bounded_bitset.h"
 #include "ocudu/adt/expected.h"
 #include "ocudu/adt/tensor.h"
 #include "ocudu/phy/generic_functions/dft_processor.h"
 #include "ocudu/phy/upper/channel_processors/prach/prach_detector.h"
 #include "ocudu/phy/upper/channel_processors/prach/prach_generator.h"
+#include "ocudu/ran/prach/prach_constants.h"
+#include <optional>
 
 namespace ocudu {
 
@@ -50,26 +53,64 @@ private:
   /// Maximum IDFT size allowed.
   static constexpr unsigned MAX_IDFT_SIZE = 4096;
 
-  /// \brief Estimates and accumulates the noise estimation.
+  /// Maximum number of PRACH samples per receive port, considering all the symbols of the preamble.
+  static constexpr unsigned MAX_NOF_SAMPLES_PER_PORT =
+      std::max(prach_constants::LONG_SEQUENCE_LENGTH * prach_constants::LONG_SEQUENCE_MAX_NOF_SYMBOLS,
+               prach_constants::SHORT_SEQUENCE_LENGTH * prach_constants::SHORT_SEQUENCE_MAX_NOF_SYMBOLS);
+
+  /// Parameters that identify the root sequences stored in the cache.
+  struct root_sequence_cache_key {
+    /// Preamble format.
+    prach_format_type format;
+    /// Root sequence index.
+    unsigned root_sequence_index;
+    /// Restricted set configuration.
+    restricted_set_config restricted_set;
+    /// Cyclic shift configuration index.
+    unsigned zero_correlation_zone;
+    /// Number of preambles sharing the same root sequence.
+    unsigned nof_shifts;
+
+    /// Determines whether two keys identify the same root sequences.
+    bool operator==(const root_sequence_cache_key& other) const
+    {
+      return (format == other.format) && (root_sequence_index == other.root_sequence_index) &&
+             (restricted_set == other.restricted_set) && (zero_correlation_zone == other.zero_correlation_zone) &&
+             (nof_shifts == other.nof_shifts);
+    }
+  };
+
+  /// \brief Gets a frequency-domain root sequence.
   ///
-  /// For each possible timing offset in the detection window, the noise is estimated by subtracting \c input (roughly
-  /// speaking, an estimation of the PRACH power) from \c reference (roughly speaking, the total measured energy).
+  /// The sequence is generated only if it is not available in the cache. The cache is invalidated when the key changes.
   ///
-  /// \param[in,out] accumulator Noise estimation accumulator.
-  /// \param[in]     reference   Reference power measurement, including noise.
-  /// \param[in]     input       Input samples.
-  /// \remark The input size must be equal to the accumulator size.
-  static void vector_noise_estimation(span<float> accumulator, float reference, span<const float> input)
-  {
-    std::transform(
-        input.begin(), input.end(), accumulator.begin(), accumulator.begin(), [&reference](float value, float acc) {
-          float diff = reference - value;
-          if (!std::isnormal(diff)) {
-            diff = 1e-9F;
-          }
-          return diff + acc;
-        });
-  }
+  /// \param[in] key        Parameters identifying the root sequences.
+  /// \param[in] i_sequence Root sequence index within the PRACH occasion, {0, ..., 63}.
+  /// \param[in] L_ra       Sequence length.
+  /// \return A read-only view of the root sequence.
+  span<const cf_t> get_root_sequence(const root_sequence_cache_key& key, unsigned i_sequence, unsigned L_ra);
+
+  /// Combined symbols tensor dimensions.
+  enum class combined_symbols_dims : unsigned {
+    /// Sample within a PRACH symbol.
+    sample = 0,
+    /// PRACH symbol.
+    symbol,
+    /// Receive port.
+    port,
+    /// Total number of dimensions.
+    all
+  };
+
+  /// Root sequence tensor dimensions.
+  enum class root_sequence_dims : unsigned {
+    /// Sample within a root sequence.
+    sample = 0,
+    /// Root sequence index.
+    sequence,
+    /// Total number of dimensions.
+    all
+  };
 
   /// Correlation tensor dimensions.
   enum class metric_global_dims : unsigned {
@@ -87,10 +128,16 @@ private:
   /// Metric global denominator.
   static_tensor<static_cast<unsigned>(metric_global_dims::all), float, MAX_IDFT_SIZE, metric_global_dims>
       metric_global_den;
+  /// PRACH symbols of all receive ports, converted and, if applicable, combined.
+  dynamic_tensor<static_cast<unsigned>(combined_symbols_dims::all), cf_t, combined_symbols_dims> combined_symbols;
+  /// Cached frequency-domain root sequences.
+  dynamic_tensor<static_cast<unsigned>(root_sequence_dims::all), cf_t, root_sequence_dims> root_sequences;
+  /// Parameters of the cached root sequences.
+  std::optional<root_sequence_cache_key> root_sequences_key;
+  /// Cached root sequences mask: the entries set to true are available in the cache.
+  bounded_bitset<prach_constants::MAX_NUM_PREAMBLES> root_sequences_mask;
   /// Temporal storage.
-  std::array<cf_t, MAX_IDFT_SIZE>  cf_temp;
   std::array<float, MAX_IDFT_SIZE> temp;
-  std::array<float, MAX_IDFT_SIZE> temp2;
 
   std::unique_ptr<dft_processor>   idft_long;
   std::unique_ptr<dft_processor>   idft_short;
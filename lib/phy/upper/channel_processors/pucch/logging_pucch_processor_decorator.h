@@ -65,6 +65,70 @@ public:
     return process_(grid, config);
   }
 
+  pucch_format0_map<pucch_processor_result> process(const resource_grid_reader&        grid,
+                                                    const format0_batch_configuration& config) override
+  {
+    if (!logger.debug.enabled() && !logger.info.enabled()) {
+      return processor->process(grid, config);
+    }
+
+    pucch_format0_map<pucch_processor_result> results;
+
+    std::chrono::nanoseconds time_ns =
+        time_execution([this, &results, &grid, &config]() { results = processor->process(grid, config); });
+
+    // Iterate each of the UE dedicated configuration.
+    for (const auto& entry : config.entries) {
+      // Skip result if it is not available.
+      if (!results.contains(entry.first)) {
+        continue;
+      }
+
+      // Select configuration and results.
+      const auto& common_config = config.common_config;
+      const auto& ue_config     = entry.second;
+      const auto& result        = results[entry.first];
+
+      // Build formateable Format 0 configuraton.
+      format0_configuration all_config = {.context              = ue_config.context,
+                                          .slot                 = common_config.slot,
+                                          .cp                   = common_config.cp,
+                                          .bwp_size_rb          = common_config.bwp_size_rb,
+                                          .bwp_start_rb         = common_config.bwp_start_rb,
+                                          .starting_prb         = common_config.starting_prb,
+                                          .second_hop_prb       = common_config.second_hop_prb,
+                                          .start_symbol_index   = common_config.start_symbol_index,
+                                          .nof_symbols          = common_config.nof_symbols,
+                                          .initial_cyclic_shift = entry.first,
+                                          .n_id                 = common_config.n_id,
+                                          .nof_harq_ack         = ue_config.nof_harq_ack,
+                                          .sr_opportunity       = ue_config.sr_opportunity,
+                                          .ports                = common_config.ports};
+
+      if (logger.debug.enabled()) {
+        // Detailed log information, including a list of all PUCCH configuration and result fields.
+        logger.debug(common_config.slot.sfn(),
+                     common_config.slot.slot_index(),
+                     "PUCCH: {:s} {:s} {}\n  {:n}\n  {:n}",
+                     all_config,
+                     result,
+                     time_ns,
+                     all_config,
+                     result);
+      } else {
+        // Single line log entry.
+        logger.info(common_config.slot.sfn(),
+                    common_config.slot.slot_index(),
+                    "PUCCH: {:s} {:s} {}",
+                    all_config,
+                    result,
+                    time_ns);
+      }
+    }
+
+    return results;
+  }
+
   pucch_format1_map<pucch_processor_result> process(const resource_grid_reader&        grid,
                                                     const format1_batch_configuration& config) override
   {
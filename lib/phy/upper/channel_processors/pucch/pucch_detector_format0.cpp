@@ -99,37 +99,72 @@ static float pick_threshold(unsigned nof_ports, unsigned nof_symbols, unsigned n
   return it->second;
 }
 
+/// Selects the cyclic shift table for the given payload.
+static span<const pucch_detector_format0_entry> select_m_cs_table(unsigned nof_harq_ack, bool sr_opportunity)
+{
+  if (nof_harq_ack == 0) {
+    return pucch_detector_format0_noharq_sr;
+  }
+  if (nof_harq_ack == 1) {
+    if (sr_opportunity) {
+      return pucch_detector_format0_oneharq_onesr;
+    }
+    return pucch_detector_format0_oneharq_nosr;
+  }
+  if (nof_harq_ack == 2) {
+    if (sr_opportunity) {
+      return pucch_detector_format0_twoharq_onesr;
+    }
+    return pucch_detector_format0_twoharq_nosr;
+  }
+  return {};
+}
+
 std::pair<pucch_uci_message, channel_state_information>
 pucch_detector_format0::detect(const ocudu::resource_grid_reader&           grid,
                                const pucch_detector::format0_configuration& config)
 {
-  // Minimum noise variance.
-  static constexpr float min_noise_var = 1e-6;
+  // Extract the resource elements.
+  extract(grid, config);
 
-  // Select table.
-  span<const pucch_detector_format0_entry> m_cs_table;
-  if (config.nof_harq_ack == 0) {
-    m_cs_table = span<const pucch_detector_format0_entry>(pucch_detector_format0_noharq_sr);
-  } else if (config.nof_harq_ack == 1) {
-    if (config.sr_opportunity) {
-      m_cs_table = span<const pucch_detector_format0_entry>(pucch_detector_format0_oneharq_onesr);
-    } else {
-      m_cs_table = span<const pucch_detector_format0_entry>(pucch_detector_format0_oneharq_nosr);
-    }
-  } else if (config.nof_harq_ack == 2) {
-    if (config.sr_opportunity) {
-      m_cs_table = span<const pucch_detector_format0_entry>(pucch_detector_format0_twoharq_onesr);
-    } else {
-      m_cs_table = span<const pucch_detector_format0_entry>(pucch_detector_format0_twoharq_nosr);
-    }
+  // Detect the transmission.
+  pucch_detector::format0_mux_configuration  mux_config = {.nof_harq_ack   = config.nof_harq_ack,
+                                                           .sr_opportunity = config.sr_opportunity};
+  pucch_detector::pucch_detection_result_csi result     = detect_ue(config, config.initial_cyclic_shift, mux_config);
+
+  return std::make_pair(result.detection_result.uci_message, result.csi);
+}
+
+const pucch_format0_map<pucch_detector::pucch_detection_result_csi>&
+pucch_detector_format0::detect(const resource_grid_reader&                                         grid,
+                               const pucch_detector::format0_configuration&                        config,
+                               const pucch_format0_map<pucch_detector::format0_mux_configuration>& mux_map)
+{
+  mux_results.clear();
+
+  // Extract the resource elements once for all the multiplexed transmissions.
+  extract(grid, config);
+
+  // Detect each of the transmissions. The correlations with the cyclic shifts are shared among transmissions.
+  for (const auto& entry : mux_map) {
+    mux_results.insert(entry.first, detect_ue(config, entry.first, entry.second));
   }
 
-  unsigned nof_ports   = config.ports.size();
+  return mux_results;
+}
+
+void pucch_detector_format0::extract(const resource_grid_reader&                  grid,
+                                     const pucch_detector::format0_configuration& config)
+{
+  nof_ports            = config.ports.size();
   unsigned nof_symbols = config.nof_symbols;
 
   // Verify parameters are correct.
-  ocudu_assert(!m_cs_table.empty(), "Invalid payload combination.");
   ocudu_assert(nof_ports * nof_symbols != 0, "The number of ports or symbols is zero.");
+  ocudu_assert(pucch_constants::format0_nof_symbols_range.contains(nof_symbols),
+               "The number of symbols (i.e., {}) is out of the range {}.",
+               nof_symbols,
+               pucch_constants::format0_nof_symbols_range);
 
   // Prepare the temporary RE storage.
   temp_re.resize({NOF_SUBCARRIERS_PER_RB, nof_symbols, nof_ports});
@@ -149,17 +184,63 @@ pucch_detector_format0::detect(const ocudu::resource_grid_reader&           grid
     }
   }
 
-  // Calculate linear EPRE.
-  float epre = 0.0F;
+  // Calculate the received power and the linear EPRE.
+  epre = 0.0F;
   for (unsigned i_symbol = 0; i_symbol != nof_symbols; ++i_symbol) {
     for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
-      epre += ocuduvec::average_power(temp_re.get_view({i_symbol, i_port}));
+      rx_power[i_symbol][i_port] = ocuduvec::average_power(temp_re.get_view({i_symbol, i_port}));
+      epre += rx_power[i_symbol][i_port];
     }
+
+    // Calculate the cyclic shift hopping offset, common to all transmissions.
+    alpha_offset[i_symbol] =
+        helper.get_alpha_index(config.slot, config.cp, config.n_id, config.start_symbol_index + i_symbol, 0, 0);
+
+    // Reset the correlations.
+    correlation_mask[i_symbol].resize(NOF_SUBCARRIERS_PER_RB);
+    correlation_mask[i_symbol].reset();
   }
   epre /= static_cast<float>(nof_symbols * nof_ports);
 
+  // Compute group sequence.
+  std::tie(u, v) = helper.compute_group_sequence(pucch_group_hopping::NEITHER, config.n_id);
+}
+
+span<const cf_t> pucch_detector_format0::get_correlation(unsigned i_symbol, unsigned alpha)
+{
+  span<cf_t> symbol_correlation = span<cf_t>(correlation[i_symbol][alpha]).first(nof_ports);
+
+  // Correlate the received symbols of all ports with the cyclic shift if it was not done before.
+  if (!correlation_mask[i_symbol].test(alpha)) {
+    span<const cf_t> sequence = low_papr->get(u, v, alpha);
+    for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
+      symbol_correlation[i_port] = ocuduvec::dot_prod(temp_re.get_view({i_symbol, i_port}), sequence);
+    }
+    correlation_mask[i_symbol].set(alpha);
+  }
+
+  return symbol_correlation;
+}
+
+pucch_detector::pucch_detection_result_csi
+pucch_detector_format0::detect_ue(const pucch_detector::format0_configuration&     config,
+                                  unsigned                                         initial_cyclic_shift,
+                                  const pucch_detector::format0_mux_configuration& mux_config)
+{
+  // Minimum noise variance.
+  static constexpr float min_noise_var = 1e-6;
+
+  // Select table.
+  span<const pucch_detector_format0_entry> m_cs_table =
+      select_m_cs_table(mux_config.nof_harq_ack, mux_config.sr_opportunity);
+
+  // Verify parameters are correct.
+  ocudu_assert(!m_cs_table.empty(), "Invalid payload combination.");
+
+  unsigned nof_symbols = config.nof_symbols;
+
   // Generate default message.
-  pucch_uci_message default_message({config.sr_opportunity ? 1U : 0U, config.nof_harq_ack, 0U, 0U});
+  pucch_uci_message default_message({mux_config.sr_opportunity ? 1U : 0U, mux_config.nof_harq_ack, 0U, 0U});
   default_message.set_status(uci_status::invalid);
 
   // Correlate each of the cyclic shifts.
@@ -171,35 +252,18 @@ pucch_detector_format0::detect(const ocudu::resource_grid_reader&           grid
     float sum_noise_var = 0.0F;
 
     for (unsigned i_symbol = 0; i_symbol != nof_symbols; ++i_symbol) {
-      // Compute group sequence.
-      unsigned u;
-      unsigned v;
-      std::tie(u, v) = helper.compute_group_sequence(pucch_group_hopping::NEITHER, config.n_id);
-
       // Calculate cyclic shift.
-      unsigned         alpha    = helper.get_alpha_index(config.slot,
-                                              config.cp,
-                                              config.n_id,
-                                              i_symbol + config.start_symbol_index,
-                                              config.initial_cyclic_shift,
-                                              m_cs_entry.m_cs);
-      span<const cf_t> sequence = low_papr->get(u, v, alpha);
+      unsigned alpha = (alpha_offset[i_symbol] + initial_cyclic_shift + m_cs_entry.m_cs) % NOF_SUBCARRIERS_PER_RB;
+
+      // Correlation between received symbols and spreading sequence for each receive port.
+      span<const cf_t> rx_seq_corr = get_correlation(i_symbol, alpha);
 
       // Process each receive port.
       for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
-        // Select received symbols.
-        span<const cf_t> rx_symbols = temp_re.get_view({i_symbol, i_port});
-
-        // Received power.
-        float rx_power = ocuduvec::average_power(rx_symbols);
-
-        // Correlation between received symbols and spreading sequence.
-        cf_t rx_seq_corr = ocuduvec::dot_prod(rx_symbols, sequence);
-
         // Update cumulative values.
-        float corr_contribution = std::norm(rx_seq_corr) / static_cast<float>(NOF_SUBCARRIERS_PER_RB);
+        float corr_contribution = std::norm(rx_seq_corr[i_port]) / static_cast<float>(NOF_SUBCARRIERS_PER_RB);
         sum_corr += corr_contribution;
-        sum_noise_var += rx_power * static_cast<float>(NOF_SUBCARRIERS_PER_RB) - corr_contribution;
+        sum_noise_var += rx_power[i_symbol][i_port] * static_cast<float>(NOF_SUBCARRIERS_PER_RB) - corr_contribution;
       }
     }
 
@@ -230,5 +294,6 @@ pucch_detector_format0::detect(const ocudu::resource_grid_reader&           grid
   csi.set_rsrp_dB(convert_power_to_dB(best_rsrp));
   csi.set_epre(convert_power_to_dB(epre));
 
-  return std::make_pair(message, csi);
+  return {.detection_result = {.uci_message = message, .detection_metric = best_metric / detection_threshold},
+          .csi              = csi};
 }
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "ocudu/adt/bounded_bitset.h"
 #include "ocudu/phy/upper/channel_processors/pucch/pucch_detector.h"
 #include "ocudu/phy/upper/pucch_helper.h"
 #include "ocudu/phy/upper/sequence_generators/low_papr_sequence_collection.h"
@@ -36,7 +37,39 @@ public:
   std::pair<pucch_uci_message, channel_state_information> detect(const resource_grid_reader&                  grid,
                                                                  const pucch_detector::format0_configuration& config);
 
+  /// Detects multiplexed PUCCH Format 0 transmissions. See \ref pucch_detector for more details.
+  const pucch_format0_map<pucch_detector::pucch_detection_result_csi>&
+  detect(const resource_grid_reader&                                         grid,
+         const pucch_detector::format0_configuration&                        config,
+         const pucch_format0_map<pucch_detector::format0_mux_configuration>& mux_map);
+
 private:
+  /// \brief Extracts the resource elements of the PUCCH allocation and measures their power.
+  ///
+  /// The initial cyclic shift, the number of HARQ-ACK bits and the scheduling request opportunity in \c config are
+  /// ignored. It resets the correlations computed for a previous allocation.
+  void extract(const resource_grid_reader& grid, const pucch_detector::format0_configuration& config);
+
+  /// \brief Gets the correlation of the received resource elements with a cyclic shift of the low-PAPR sequence.
+  ///
+  /// The correlation is computed for all receive ports the first time a cyclic shift is requested for an OFDM symbol,
+  /// and it is reused for all the multiplexed transmissions.
+  ///
+  /// \param[in] i_symbol OFDM symbol index within the PUCCH allocation.
+  /// \param[in] alpha    Cyclic shift index {0, ..., 11}.
+  /// \return A view of the correlation for each receive port.
+  span<const cf_t> get_correlation(unsigned i_symbol, unsigned alpha);
+
+  /// \brief Detects a single PUCCH Format 0 transmission from the extracted resource elements.
+  /// \param[in] config               PUCCH Format 0 common configuration parameters.
+  /// \param[in] initial_cyclic_shift Initial cyclic shift of the transmission.
+  /// \param[in] mux_config           UE dedicated parameters of the transmission.
+  /// \return The detection result and the channel state information.
+  pucch_detector::pucch_detection_result_csi
+  detect_ue(const pucch_detector::format0_configuration&     config,
+            unsigned                                         initial_cyclic_shift,
+            const pucch_detector::format0_mux_configuration& mux_config);
+
   /// Maximum number of RE used for PUCCH Format 0. Recall that PUCCH format 0 occupies a single RB.
   static constexpr unsigned max_nof_re =
       NOF_SUBCARRIERS_PER_RB * MAX_PORTS * pucch_constants::format0_nof_symbols_range.stop();
@@ -51,6 +84,27 @@ private:
 
   /// Temporary storage of the resource elements.
   static_tensor<static_cast<unsigned>(dims::nof_dims), cf_t, max_nof_re, dims> temp_re;
+  /// Average received power for each OFDM symbol and receive port.
+  std::array<std::array<float, MAX_PORTS>, pucch_constants::format0_nof_symbols_range.stop()> rx_power;
+  /// Correlation with each cyclic shift, for each OFDM symbol and receive port.
+  std::array<std::array<std::array<cf_t, MAX_PORTS>, NOF_SUBCARRIERS_PER_RB>,
+             pucch_constants::format0_nof_symbols_range.stop()>
+      correlation;
+  /// Cyclic shift hopping term \f$n_{cs}\f$ (see TS38.211 Section 6.3.2.2.2) modulo 12, for each OFDM symbol.
+  std::array<unsigned, pucch_constants::format0_nof_symbols_range.stop()> alpha_offset;
+  /// Cyclic shifts with available correlation, for each OFDM symbol.
+  std::array<bounded_bitset<NOF_SUBCARRIERS_PER_RB>, pucch_constants::format0_nof_symbols_range.stop()>
+      correlation_mask;
+  /// Average received energy per resource element.
+  float epre = 0.0F;
+  /// Sequence group.
+  unsigned u = 0;
+  /// Sequence number.
+  unsigned v = 0;
+  /// Number of receive ports.
+  unsigned nof_ports = 0;
+  /// Multiplexed detection results.
+  pucch_format0_map<pucch_detector::pucch_detection_result_csi> mux_results;
 };
 
 } // namespace ocudu
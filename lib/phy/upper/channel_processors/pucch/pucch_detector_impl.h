@@ -41,6 +41,15 @@ public:
     return detector_format0->detect(grid, config);
   }
 
+  // See interface for documentation.
+  const pucch_format0_map<pucch_detection_result_csi>&
+  detect(const resource_grid_reader&                         grid,
+         const format0_configuration&                        config,
+         const pucch_format0_map<format0_mux_configuration>& mux_map) override
+  {
+    return detector_format0->detect(grid, config, mux_map);
+  }
+
   // See interface for documentation.
   const pucch_format1_map<pucch_detection_result_csi>& detect(const resource_grid_reader&        grid,
                                                               const format1_configuration&       config,
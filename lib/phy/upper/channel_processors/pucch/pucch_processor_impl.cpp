@@ -41,6 +41,7 @@ pucch_processor_result pucch_processor_impl::process(const resource_grid_reader&
 
   pucch_detector::format0_configuration detector_config;
   detector_config.slot                                                     = config.slot;
+  detector_config.cp                                                       = config.cp;
   detector_config.starting_prb                                             = config.starting_prb + config.bwp_start_rb;
   detector_config.second_hop_prb                                           = second_hop_prb;
   detector_config.start_symbol_index                                       = config.start_symbol_index;
@@ -59,6 +60,72 @@ pucch_processor_result pucch_processor_impl::process(const resource_grid_reader&
   return result;
 }
 
+pucch_format0_map<pucch_processor_result> pucch_processor_impl::process(const resource_grid_reader&        grid,
+                                                                        const format0_batch_configuration& batch_config)
+{
+  const format0_common_configuration& common_config = batch_config.common_config;
+  format0_configuration               proc_config   = {.context              = {},
+                                                       .slot                 = common_config.slot,
+                                                       .cp                   = common_config.cp,
+                                                       .bwp_size_rb          = common_config.bwp_size_rb,
+                                                       .bwp_start_rb         = common_config.bwp_start_rb,
+                                                       .starting_prb         = common_config.starting_prb,
+                                                       .second_hop_prb       = common_config.second_hop_prb,
+                                                       .start_symbol_index   = common_config.start_symbol_index,
+                                                       .nof_symbols          = common_config.nof_symbols,
+                                                       .initial_cyclic_shift = 0,
+                                                       .n_id                 = common_config.n_id,
+                                                       .nof_harq_ack         = 0,
+                                                       .sr_opportunity       = false,
+                                                       .ports                = common_config.ports};
+
+  pucch_format0_map<pucch_detector::format0_mux_configuration> mux_config;
+
+  for (const auto& this_pucch : batch_config.entries) {
+    unsigned                                               initial_cyclic_shift = this_pucch.first;
+    const format0_batch_configuration::ue_dedicated_entry& ue_config            = this_pucch.second;
+
+    proc_config.context              = ue_config.context;
+    proc_config.initial_cyclic_shift = initial_cyclic_shift;
+    proc_config.nof_harq_ack         = ue_config.nof_harq_ack;
+    proc_config.sr_opportunity       = ue_config.sr_opportunity;
+
+    [[maybe_unused]] std::string msg;
+    ocudu_assert(handle_validation(msg, pdu_validator->is_valid(proc_config)), "{}", msg);
+
+    mux_config.insert(initial_cyclic_shift,
+                      {.nof_harq_ack = ue_config.nof_harq_ack, .sr_opportunity = ue_config.sr_opportunity});
+  }
+
+  // Fill the detector configuration - recall that initial_cyclic_shift, nof_harq_ack and sr_opportunity are set via
+  // mux_config.
+  pucch_detector::format0_configuration detector_config = {
+      .slot                 = common_config.slot,
+      .cp                   = common_config.cp,
+      .starting_prb         = common_config.starting_prb + common_config.bwp_start_rb,
+      .second_hop_prb       = transform_optional(common_config.second_hop_prb, std::plus(), common_config.bwp_start_rb),
+      .start_symbol_index   = common_config.start_symbol_index,
+      .nof_symbols          = common_config.nof_symbols,
+      .initial_cyclic_shift = 0,
+      .n_id                 = common_config.n_id,
+      .nof_harq_ack         = 0,
+      .sr_opportunity       = false,
+      .ports                = common_config.ports};
+
+  const pucch_format0_map<pucch_detector::pucch_detection_result_csi>& detection_results =
+      detector->detect(grid, detector_config, mux_config);
+
+  // Create the detection results for this detection batch.
+  pucch_format0_map<pucch_processor_result> batch_results;
+  for (const auto& this_result : detection_results) {
+    batch_results.insert(this_result.first,
+                         {.csi              = this_result.second.csi,
+                          .message          = this_result.second.detection_result.uci_message,
+                          .detection_metric = this_result.second.detection_result.detection_metric});
+  }
+  return batch_results;
+}
+
 pucch_format1_map<pucch_processor_result> pucch_processor_impl::process(const resource_grid_reader&        grid,
                                                                         const format1_batch_configuration& batch_config)
 {
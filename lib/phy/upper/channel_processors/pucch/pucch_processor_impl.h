@@ -55,6 +55,10 @@ public:
   // See pucch_processor interface for documentation.
   pucch_processor_result process(const resource_grid_reader& grid, const format0_configuration& config) override;
 
+  // See pucch_processor interface for documentation.
+  pucch_format0_map<pucch_processor_result> process(const resource_grid_reader&        grid,
+                                                    const format0_batch_configuration& config) override;
+
   // See pucch_processor interface for documentation.
   pucch_format1_map<pucch_processor_result> process(const resource_grid_reader&        grid,
                                                     const format1_batch_configuration& config) override;
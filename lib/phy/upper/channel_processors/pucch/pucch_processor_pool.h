@@ -40,6 +40,20 @@ public:
     return processor->process(grid, config);
   }
 
+  // See interface for documentation.
+  pucch_format0_map<pucch_processor_result> process(const resource_grid_reader&        grid,
+                                                    const format0_batch_configuration& config) override
+  {
+    auto processor = processors->get();
+    if (!processor) {
+      logger.error(config.common_config.slot.sfn(),
+                   config.common_config.slot.slot_index(),
+                   "Failed to retrieve PUCCH processor for Format 0.");
+      return {};
+    }
+    return processor->process(grid, config);
+  }
+
   // See interface for documentation.
   pucch_format1_map<pucch_processor_result> process(const resource_grid_reader&        grid,
                                                     const format1_batch_configuration& config) override
@@ -97,6 +97,28 @@ public:
     time_return = std::chrono::steady_clock::now().time_since_epoch().count();
   }
 
+  void process(span<uint8_t>                    data_,
+               unique_rx_buffer                 rm_buffer,
+               pusch_processor_result_notifier& notifier_,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor,
+               const pdu_t&                     pdu_) override
+  {
+    notifier    = &notifier_;
+    data        = data_;
+    pdu         = pdu_;
+    time_start  = std::chrono::steady_clock::now();
+    time_uci    = std::chrono::time_point<std::chrono::steady_clock>();
+    time_return = 0;
+
+    // Clear processor results.
+    results.sch.reset();
+    results.uci.reset();
+
+    processor->process(data, std::move(rm_buffer), *this, grid, symbol_monitor, pdu);
+    time_return = std::chrono::steady_clock::now().time_since_epoch().count();
+  }
+
 private:
   void on_uci(const pusch_processor_result_control& uci) override
   {
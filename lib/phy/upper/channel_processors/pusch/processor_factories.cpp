@@ -18,6 +18,7 @@
 #include "pusch_processor_validator_impl.h"
 #include "ulsch_demultiplex_impl.h"
 #include "ocudu/phy/upper/channel_processors/pusch/factories.h"
+#include "ocudu/support/math/math_utils.h"
 
 using namespace ocudu;
 
@@ -75,6 +76,14 @@ public:
     }
 
     decoder_pool = std::make_unique<pusch_decoder_impl::codeblock_decoder_pool>(codeblock_decoders);
+
+    // Create the codeblock batcher, shared among all the PUSCH decoders. The number of batch workers is chosen so that
+    // full batches keep all the decoding threads busy.
+    if (config.max_codeblock_batch_size > 1) {
+      unsigned nof_threads = std::max(1U, config.nof_pusch_decoder_threads);
+      batcher              = std::make_shared<pusch_codeblock_batcher>(
+          config.max_codeblock_batch_size, divide_ceil(nof_threads, config.max_codeblock_batch_size));
+    }
   }
 
   std::unique_ptr<pusch_decoder> create() override
@@ -85,11 +94,12 @@ public:
     crcs.crc24B = crc_factory->create(crc_generator_poly::CRC24B);
 
     return std::make_unique<pusch_decoder_impl>(
-        segmenter_factory->create(), decoder_pool, std::move(crcs), executor, nof_prb, nof_layers);
+        segmenter_factory->create(), decoder_pool, std::move(crcs), executor, nof_prb, nof_layers, batcher);
   }
 
 private:
   std::shared_ptr<pusch_decoder_impl::codeblock_decoder_pool> decoder_pool;
+  std::shared_ptr<pusch_codeblock_batcher>                    batcher;
   std::shared_ptr<crc_calculator_factory>                     crc_factory;
   std::shared_ptr<ldpc_segmenter_rx_factory>                  segmenter_factory;
   task_executor*                                              executor;
@@ -0,0 +1,79 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "pusch_codeblock_batcher.h"
+#include "ocudu/adt/static_vector.h"
+
+using namespace ocudu;
+
+pusch_codeblock_batcher::pusch_codeblock_batcher(unsigned max_batch_size_, unsigned max_nof_batch_workers_) :
+  max_batch_size(std::min(max_batch_size_, ldpc_decoder::max_batch_size)),
+  max_nof_batch_workers(std::max(1U, max_nof_batch_workers_))
+{
+  ocudu_assert(max_batch_size > 0, "The maximum batch size must not be zero.");
+  pending.reserve(max_batch_size * max_nof_batch_workers * 4);
+}
+
+void pusch_codeblock_batcher::decode(pusch_codeblock_decoder& decoder, pusch_codeblock_decoder::batch_request& request)
+{
+  pending_request own_request;
+  own_request.request = &request;
+
+  // Queue the request and determine whether this thread becomes a batch worker.
+  bool is_worker;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.push_back(&own_request);
+    is_worker = (nof_batch_workers < max_nof_batch_workers);
+    if (is_worker) {
+      ++nof_batch_workers;
+    }
+  }
+
+  // Workers decode batches until there are no pending requests. A worker only leaves when the queue is empty, so every
+  // queued request is eventually decoded by one of the active workers.
+  while (is_worker) {
+    static_vector<pending_request*, ldpc_decoder::max_batch_size>                         batch;
+    static_vector<pusch_codeblock_decoder::batch_request*, ldpc_decoder::max_batch_size> batch_requests;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (pending.empty()) {
+        --nof_batch_workers;
+        break;
+      }
+
+      // Take the oldest pending request and the following compatible ones, keeping the order of the rest.
+      const pusch_codeblock_decoder::batch_request& reference = *pending.front()->request;
+      auto                                          new_end   = pending.begin();
+      for (pending_request* candidate : pending) {
+        if ((batch.size() != max_batch_size) &&
+            pusch_codeblock_decoder::is_batch_compatible(reference, *candidate->request)) {
+          batch.push_back(candidate);
+        } else {
+          *new_end++ = candidate;
+        }
+      }
+      pending.erase(new_end, pending.end());
+    }
+
+    for (pending_request* item : batch) {
+      batch_requests.push_back(item->request);
+    }
+    decoder.decode_batch(batch_requests);
+
+    // Hand the decoded codeblocks back to their threads. The pending requests must not be accessed after this point.
+    for (pending_request* item : batch) {
+      item->completed.post();
+    }
+  }
+
+  // Sleep until the request is decoded by any of the workers.
+  own_request.completed.wait();
+}
@@ -0,0 +1,67 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "pusch_codeblock_decoder.h"
+#include "ocudu/support/synchronization/baton.h"
+#include <mutex>
+#include <vector>
+
+namespace ocudu {
+
+/// \brief PUSCH codeblock batcher.
+///
+/// Gathers rate-dematched codeblocks from concurrent PUSCH transmissions and decodes the compatible ones (see
+/// pusch_codeblock_decoder::is_batch_compatible()) jointly, so that the LDPC decoder can process several small
+/// codeblocks in parallel.
+///
+/// The number of threads that decode concurrently is limited. Threads that cannot decode queue their codeblock and
+/// sleep until one of the decoding threads processes it in one of its batches and hands it back. Therefore, codeblocks
+/// are only batched when there are more codeblocks to decode than decoding threads, and there is no additional latency
+/// otherwise.
+class pusch_codeblock_batcher
+{
+public:
+  /// \brief Creates a codeblock batcher.
+  /// \param[in] max_batch_size_        Maximum number of codeblocks decoded jointly.
+  /// \param[in] max_nof_batch_workers_ Maximum number of threads decoding batches concurrently.
+  pusch_codeblock_batcher(unsigned max_batch_size_, unsigned max_nof_batch_workers_);
+
+  /// \brief Decodes a rate-dematched codeblock, possibly together with codeblocks from other threads.
+  ///
+  /// The function returns when the codeblock is decoded, the result is written in the request.
+  ///
+  /// \param[in]     decoder Codeblock decoder available to the calling thread.
+  /// \param[in,out] request Codeblock to decode.
+  void decode(pusch_codeblock_decoder& decoder, pusch_codeblock_decoder::batch_request& request);
+
+private:
+  /// Codeblock waiting for decoding.
+  struct pending_request {
+    /// Codeblock decoding request.
+    pusch_codeblock_decoder::batch_request* request;
+    /// Posted by the decoding thread when the codeblock has been decoded.
+    baton completed;
+  };
+
+  /// Maximum number of codeblocks decoded jointly.
+  unsigned max_batch_size;
+  /// Maximum number of threads decoding batches concurrently.
+  unsigned max_nof_batch_workers;
+  /// Protects the pending requests and the number of workers.
+  std::mutex mutex;
+  /// Codeblocks waiting for decoding, in order of arrival.
+  std::vector<pending_request*> pending;
+  /// Number of threads currently decoding batches.
+  unsigned nof_batch_workers = 0;
+};
+
+} // namespace ocudu
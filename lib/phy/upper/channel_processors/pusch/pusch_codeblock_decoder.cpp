@@ -62,3 +62,60 @@ std::optional<unsigned> pusch_codeblock_decoder::decode(bit_buffer
 
   return std::nullopt;
 }
+
+void pusch_codeblock_decoder::decode_batch(span<batch_request* const> requests)
+{
+  if (requests.empty()) {
+    return;
+  }
+
+  ocudu_assert(requests.size() <= ldpc_decoder::max_batch_size,
+               "The number of requests (i.e., {}) exceeds the maximum batch size (i.e., {}).",
+               requests.size(),
+               ldpc_decoder::max_batch_size);
+
+  // Prepare LDPC decoder configuration from the first codeblock.
+  const codeblock_metadata&   metadata = *requests.front()->metadata;
+  ldpc_decoder::configuration decoder_config;
+  decoder_config.base_graph     = metadata.tb_common.base_graph;
+  decoder_config.lifting_size   = metadata.tb_common.lifting_size;
+  decoder_config.nof_crc_bits   = metadata.cb_specific.nof_crc_bits;
+  decoder_config.max_iterations = requests.front()->nof_ldpc_iterations;
+
+  // Prepare batch entries.
+  static_vector<ldpc_decoder::batch_entry, ldpc_decoder::max_batch_size> entries(requests.size());
+  for (unsigned i_request = 0, i_request_end = requests.size(); i_request != i_request_end; ++i_request) {
+    const batch_request& request = *requests[i_request];
+    ocudu_assert(is_batch_compatible(*requests.front(), request), "Incompatible codeblocks in the same batch.");
+
+    // Select CRC calculator.
+    crc_calculator* crc = select_crc(request.crc_poly);
+    ocudu_assert(crc != nullptr, "Invalid CRC calculator.");
+
+    ldpc_decoder::batch_entry& entry = entries[i_request];
+    entry.output                     = request.cb_data;
+    entry.input                      = request.rm_buffer;
+    entry.crc                        = request.use_early_stop ? crc : nullptr;
+    entry.nof_filler_bits            = request.metadata->cb_specific.nof_filler_bits;
+  }
+
+  decoder->decode_batch(entries, decoder_config);
+
+  for (unsigned i_request = 0, i_request_end = requests.size(); i_request != i_request_end; ++i_request) {
+    batch_request&                   request = *requests[i_request];
+    const ldpc_decoder::batch_entry& entry   = entries[i_request];
+
+    // With CRC early stop, the decoder result is final. Also, skip the CRC if the syndrome check fails.
+    if (request.use_early_stop || !entry.result.has_value()) {
+      request.result = entry.result;
+      continue;
+    }
+
+    // Discard filler bits for the CRC.
+    unsigned nof_significant_bits = request.cb_data.size() - request.metadata->cb_specific.nof_filler_bits;
+    request.result.reset();
+    if (select_crc(request.crc_poly)->calculate(request.cb_data.first(nof_significant_bits)) == 0) {
+      request.result = request.nof_ldpc_iterations;
+    }
+  }
+}
@@ -26,6 +26,24 @@ namespace ocudu {
 class pusch_codeblock_decoder
 {
 public:
+  /// Describes a rate-dematched codeblock to be decoded as part of a batch, see decode_batch().
+  struct batch_request {
+    /// Code block data after decoding.
+    bit_buffer cb_data;
+    /// Rate matching buffer, it must contain the rate-dematched soft bits.
+    span<const log_likelihood_ratio> rm_buffer;
+    /// CRC polynomial used for the code block.
+    crc_generator_poly crc_poly;
+    /// Set to true to allow the LDPC decoder to stop decoding when the CRC matches.
+    bool use_early_stop;
+    /// Number of LDPC decoder iterations.
+    unsigned nof_ldpc_iterations;
+    /// Code block metadata.
+    const codeblock_metadata* metadata;
+    /// Number of iterations if the CRC matches after the LDPC decoder. Otherwise, \c std::nullopt.
+    std::optional<unsigned> result;
+  };
+
   /// CRC calculators used in shared channels.
   struct sch_crc {
     /// For short TB checksums.
@@ -111,6 +129,25 @@ public:
                                  unsigned                         nof_ldpc_iterations,
                                  const codeblock_metadata&        metadata);
 
+  /// \brief Determines whether two codeblocks can be decoded in the same batch.
+  ///
+  /// Codeblocks are compatible if they share the base graph, the lifting size and the number of LDPC iterations.
+  static bool is_batch_compatible(const batch_request& lhs, const batch_request& rhs)
+  {
+    return (lhs.metadata->tb_common.base_graph == rhs.metadata->tb_common.base_graph) &&
+           (lhs.metadata->tb_common.lifting_size == rhs.metadata->tb_common.lifting_size) &&
+           (lhs.nof_ldpc_iterations == rhs.nof_ldpc_iterations);
+  }
+
+  /// \brief Applies LDPC decoding to a batch of rate-dematched codeblocks.
+  ///
+  /// The codeblocks are decoded jointly by the LDPC decoder. The result of each codeblock is the same as if it was
+  /// decoded by decode().
+  ///
+  /// \param[in,out] requests Codeblocks to decode. All codeblocks must be compatible with each other (see
+  ///                         is_batch_compatible()) and their number must not exceed ldpc_decoder::max_batch_size.
+  void decode_batch(span<batch_request* const> requests);
+
 private:
   /// Pointer to an LDPC rate-dematcher.
   std::unique_ptr<ldpc_rate_dematcher> dematcher;
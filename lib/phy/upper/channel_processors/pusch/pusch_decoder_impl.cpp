@@ -349,7 +349,19 @@ void pusch_decoder_impl::fork_codeblock_task(unsigned cb_id)
     // Try to decode.
     std::optional<unsigned> nof_iters;
     auto                    decoder_ptr = decoder_pool->get();
-    if (decoder_ptr) {
+    if (decoder_ptr && batcher) {
+      // Dematch and decode jointly with other codeblocks, if possible.
+      decoder_ptr->rate_match(rm_buffer, cb_llrs, current_config.new_data, cb_meta);
+      pusch_codeblock_decoder::batch_request request = {.cb_data             = message,
+                                                        .rm_buffer           = rm_buffer,
+                                                        .crc_poly            = block_crc->get_generator_poly(),
+                                                        .use_early_stop      = current_config.use_early_stop,
+                                                        .nof_ldpc_iterations = current_config.nof_ldpc_iterations,
+                                                        .metadata            = &cb_meta,
+                                                        .result              = std::nullopt};
+      batcher->decode(*decoder_ptr, request);
+      nof_iters = request.result;
+    } else if (decoder_ptr) {
       nof_iters = decoder_ptr->decode(message,
                                       rm_buffer,
                                       cb_llrs,
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "pusch_codeblock_batcher.h"
 #include "pusch_codeblock_decoder.h"
 #include "ocudu/adt/mutexed_mpsc_queue.h"
 #include "ocudu/ocudulog/ocudulog.h"
@@ -52,16 +53,19 @@ public:
   /// \param[in] executor_     Task executor for asynchronous PUSCH code block decoding.
   /// \param[in] nof_prb       Number of PRBs.
   /// \param[in] nof_layers    Number of layers.
-
-  pusch_decoder_impl(std::unique_ptr<ldpc_segmenter_rx>      segmenter_,
-                     std::shared_ptr<codeblock_decoder_pool> decoder_pool_,
-                     sch_crc                                 crc_set_,
-                     task_executor*                          executor_,
-                     unsigned                                nof_prb,
-                     unsigned                                nof_layers) :
+  /// \param[in] batcher_      Optional codeblock batcher shared among PUSCH decoders. Set to \c nullptr for decoding
+  ///                          each codeblock individually.
+  pusch_decoder_impl(std::unique_ptr<ldpc_segmenter_rx>       segmenter_,
+                     std::shared_ptr<codeblock_decoder_pool>  decoder_pool_,
+                     sch_crc                                  crc_set_,
+                     task_executor*                           executor_,
+                     unsigned                                 nof_prb,
+                     unsigned                                 nof_layers,
+                     std::shared_ptr<pusch_codeblock_batcher> batcher_ = nullptr) :
     logger(ocudulog::fetch_basic_logger("PHY")),
     segmenter(std::move(segmenter_)),
     decoder_pool(std::move(decoder_pool_)),
+    batcher(std::move(batcher_)),
     crc_set(std::move(crc_set_)),
     executor(executor_),
     softbits_buffer(pusch_constants::get_max_codeword_size(nof_prb, nof_layers).value())
@@ -136,6 +140,8 @@ private:
   std::unique_ptr<ldpc_segmenter_rx> segmenter;
   /// Pointer to a codeblock decoder.
   std::shared_ptr<codeblock_decoder_pool> decoder_pool;
+  /// Optional codeblock batcher for decoding codeblocks from different transmissions jointly.
+  std::shared_ptr<pusch_codeblock_batcher> batcher;
   /// \brief Pointer to a CRC calculator for TB-wise checksum.
   ///
   /// Only the CRC calculator with generator polynomial crc_generator_poly::CRC24A, used for long transport blocks, is
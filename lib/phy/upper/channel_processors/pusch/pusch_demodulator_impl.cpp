@@ -263,6 +263,24 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
                                         const dmrs_pusch_estimator_results& est_results,
                                         const configuration&                config)
 {
+  start(codeword_buffer, notifier, grid, est_results, config);
+  demodulate_symbols(config.start_symbol_index + config.nof_symbols - 1, true);
+}
+
+void pusch_demodulator_impl::start(pusch_codeword_buffer&              codeword_buffer,
+                                   pusch_demodulator_notifier&         notifier,
+                                   const resource_grid_reader&         grid,
+                                   const dmrs_pusch_estimator_results& est_results,
+                                   const configuration&                config)
+{
+  // Save the transmission parameters.
+  current_codeword_buffer = &codeword_buffer;
+  current_notifier        = &notifier;
+  current_grid            = &grid;
+  current_est_results     = &est_results;
+  current_config          = config;
+  next_symbol_index       = config.start_symbol_index;
+
   // Number of receive antenna ports.
   auto nof_rx_ports = static_cast<unsigned>(config.rx_ports.size());
 
@@ -275,26 +293,55 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
   re_prb_mask active_re_per_prb_dmrs = ~config.dmrs_config_type.get_dmrs_prb_mask(config.nof_cdm_groups_without_data);
 
   // Prepare RE mask.
-  re_symbol_mask_type re_mask      = config.rb_mask.kronecker_product<NOF_SUBCARRIERS_PER_RB>(active_re_per_prb);
-  re_symbol_mask_type re_mask_dmrs = config.rb_mask.kronecker_product<NOF_SUBCARRIERS_PER_RB>(active_re_per_prb_dmrs);
+  data_re_mask = config.rb_mask.kronecker_product<NOF_SUBCARRIERS_PER_RB>(active_re_per_prb);
+  dmrs_re_mask = config.rb_mask.kronecker_product<NOF_SUBCARRIERS_PER_RB>(active_re_per_prb_dmrs);
 
   // Calculate the number of bits per RE and port.
-  unsigned nof_bits_per_re = config.nof_tx_layers * get_bits_per_symbol(config.modulation);
+  nof_bits_per_re = config.nof_tx_layers * get_bits_per_symbol(config.modulation);
   ocudu_assert(nof_bits_per_re > 0,
                "Invalid combination of transmit layers (i.e., {}) and modulation (i.e., {}).",
                config.nof_tx_layers,
                to_string(config.modulation));
 
-  // Stats accumulators.
-  unsigned total_evm_symbol_count     = 0;
-  unsigned total_sinr_softbit_count   = 0;
-  float    total_noise_var_accumulate = 0.0;
-  float    total_evm_accumulate       = 0.0;
+  // The interference-plus-noise covariance matrix is common to all OFDM symbols, it is only required by
+  // interference-aware equalizers.
+  use_noise_covariance = equalizer->is_interference_aware();
+  if (use_noise_covariance) {
+    est_results.get_noise_covariance(span<cf_t>(noise_covariance).first(nof_rx_ports * nof_rx_ports));
+  }
+
+  // Reset stats accumulators.
+  total_evm_symbol_count     = 0;
+  total_sinr_softbit_count   = 0;
+  total_noise_var_accumulate = 0.0;
+  total_evm_accumulate       = 0.0;
+}
+
+void pusch_demodulator_impl::demodulate_symbols(unsigned end_symbol_index, bool is_valid)
+{
+  ocudu_assert(current_codeword_buffer != nullptr, "The demodulation has not been started.");
+
+  const configuration&                config          = current_config;
+  pusch_codeword_buffer&              codeword_buffer = *current_codeword_buffer;
+  pusch_demodulator_notifier&         notifier        = *current_notifier;
+  const resource_grid_reader&         grid            = *current_grid;
+  const dmrs_pusch_estimator_results& est_results     = *current_est_results;
+
+  // Number of receive antenna ports.
+  auto nof_rx_ports = static_cast<unsigned>(config.rx_ports.size());
+
+  // View of the interference-plus-noise covariance matrix.
+  span<const cf_t> noise_covariance_view;
+  if (use_noise_covariance) {
+    noise_covariance_view = span<const cf_t>(noise_covariance).first(nof_rx_ports * nof_rx_ports);
+  }
 
   // Process each OFDM symbol.
-  for (unsigned i_symbol = config.start_symbol_index, i_symbol_end = config.start_symbol_index + config.nof_symbols;
-       i_symbol != i_symbol_end;
-       ++i_symbol) {
+  unsigned i_symbol_end = config.start_symbol_index + config.nof_symbols;
+  for (unsigned i_symbol_stop = std::min(end_symbol_index + 1, i_symbol_end); next_symbol_index < i_symbol_stop;
+       ++next_symbol_index) {
+    unsigned i_symbol = next_symbol_index;
+
     // Stats accumulators for the OFDM symbol.
     unsigned symbol_evm_symbol_count     = 0;
     unsigned symbol_sinr_softbit_count   = 0;
@@ -302,7 +349,7 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
     float    symbol_evm_accumulate       = 0.0;
 
     // Select RE mask for the symbol.
-    re_symbol_mask_type& symbol_re_mask = config.dmrs_symb_pos.test(i_symbol) ? re_mask_dmrs : re_mask;
+    re_symbol_mask_type& symbol_re_mask = config.dmrs_symb_pos.test(i_symbol) ? dmrs_re_mask : data_re_mask;
 
     // Count the amount of active RE in the symbol.
     unsigned nof_re_symbol = symbol_re_mask.count();
@@ -316,46 +363,52 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
     span<cf_t>  eq_re         = span<cf_t>(temp_eq_re).first(nof_re_symbol * config.nof_tx_layers);
     span<float> eq_noise_vars = span<float>(temp_eq_noise_vars).first(nof_re_symbol * config.nof_tx_layers);
 
-    // Look for DC (Direct Current) subcarrier only with transform precoding disabled. This step is skipped when
-    // transform precoding is used, as forcing the DC to zero in that case may introduce non-linear distortion after the
-    // inverse transform. The issue is particularly pronounced for narrowband PUSCH transmissions.
-    std::optional<unsigned> dc_position = config.enable_transform_precoding ? std::nullopt : config.dc_position;
-
-    // Extract channel estimates from the resource grid.
-    interval<unsigned>      re_interval(config.rb_mask.find_lowest() * NOF_SUBCARRIERS_PER_RB,
-                                   (config.rb_mask.find_highest() + 1) * NOF_SUBCARRIERS_PER_RB);
-    re_symbol_mask_type     symbol_re_mask_local = symbol_re_mask.slice(re_interval.start(), re_interval.stop());
-    std::optional<unsigned> dc_position_local    = std::nullopt;
-    if (dc_position.has_value() && (re_interval.contains(*dc_position))) {
-      dc_position_local = *dc_position - re_interval.start();
-    }
+    if (is_valid) {
+      // Look for DC (Direct Current) subcarrier only with transform precoding disabled. This step is skipped when
+      // transform precoding is used, as forcing the DC to zero in that case may introduce non-linear distortion after
+      // the inverse transform. The issue is particularly pronounced for narrowband PUSCH transmissions.
+      std::optional<unsigned> dc_position = config.enable_transform_precoding ? std::nullopt : config.dc_position;
+
+      // Extract channel estimates from the resource grid.
+      interval<unsigned>      re_interval(config.rb_mask.find_lowest() * NOF_SUBCARRIERS_PER_RB,
+                                     (config.rb_mask.find_highest() + 1) * NOF_SUBCARRIERS_PER_RB);
+      re_symbol_mask_type     symbol_re_mask_local = symbol_re_mask.slice(re_interval.start(), re_interval.stop());
+      std::optional<unsigned> dc_position_local    = std::nullopt;
+      if (dc_position.has_value() && (re_interval.contains(*dc_position))) {
+        dc_position_local = *dc_position - re_interval.start();
+      }
 
-    const channel_equalizer::ch_est_list& ch_estimates = get_ch_data_estimates(
-        est_results, i_symbol, config.nof_tx_layers, symbol_re_mask_local, dc_position_local, config.rx_ports);
+      const channel_equalizer::ch_est_list& ch_estimates = get_ch_data_estimates(
+          est_results, i_symbol, config.nof_tx_layers, symbol_re_mask_local, dc_position_local, config.rx_ports);
+
+      // Extract the data symbols, equalize channels and, for each Tx layer, combine contribution from all Rx antenna
+      // ports.
+      const re_buffer_reader<cbf16_t>& ch_re = get_ch_data_re(grid, i_symbol, symbol_re_mask, config.rx_ports);
+      if (use_noise_covariance) {
+        equalizer->equalize(eq_re, eq_noise_vars, ch_re, ch_estimates, noise_covariance_view, 1.0F);
+      } else {
+        // Extract the Rx port noise variances from the channel estimation.
+        for (unsigned i_port = 0; i_port != nof_rx_ports; ++i_port) {
+          noise_var_estimates[i_port] = est_results.get_noise_variance(i_port);
+        }
 
-    // Extract the Rx port noise variances from the channel estimation.
-    for (unsigned i_port = 0; i_port != nof_rx_ports; ++i_port) {
-      noise_var_estimates[i_port] = est_results.get_noise_variance(i_port);
-    }
+        equalizer->equalize(
+            eq_re, eq_noise_vars, ch_re, ch_estimates, span<float>(noise_var_estimates).first(nof_rx_ports), 1.0F);
+      }
 
-    // Extract the data symbols, equalize channels and, for each Tx layer, combine contribution from all Rx antenna
-    // ports.
-    const re_buffer_reader<cbf16_t>& ch_re = get_ch_data_re(grid, i_symbol, symbol_re_mask, config.rx_ports);
-    equalizer->equalize(
-        eq_re, eq_noise_vars, ch_re, ch_estimates, span<float>(noise_var_estimates).first(nof_rx_ports), 1.0F);
-
-    // Revert transform precoding for the entire OFDM symbol.
-    if (config.enable_transform_precoding) {
-      ocudu_assert(config.nof_tx_layers == 1,
-                   "Transform precoding is only possible with one layer (i.e. {}).",
-                   config.nof_tx_layers);
-      precoder->deprecode_ofdm_symbol(eq_re, eq_re);
-      precoder->deprecode_ofdm_symbol_noise(eq_noise_vars, eq_noise_vars);
-    }
+      // Revert transform precoding for the entire OFDM symbol.
+      if (config.enable_transform_precoding) {
+        ocudu_assert(config.nof_tx_layers == 1,
+                     "Transform precoding is only possible with one layer (i.e. {}).",
+                     config.nof_tx_layers);
+        precoder->deprecode_ofdm_symbol(eq_re, eq_re);
+        precoder->deprecode_ofdm_symbol_noise(eq_noise_vars, eq_noise_vars);
+      }
 
-    // Estimate post equalization Signal-to-Interference-plus-Noise Ratio.
-    if (compute_post_eq_sinr) {
-      symbol_noise_var_accumulate += filter_infinite_and_accumulate(symbol_sinr_softbit_count, eq_noise_vars);
+      // Estimate post equalization Signal-to-Interference-plus-Noise Ratio.
+      if (compute_post_eq_sinr) {
+        symbol_noise_var_accumulate += filter_infinite_and_accumulate(symbol_sinr_softbit_count, eq_noise_vars);
+      }
     }
 
     // Counts the number of processed RE for the OFDM symbol.
@@ -376,28 +429,34 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
                    nof_bits_per_re);
 
       // Select equalizer output.
-      unsigned          nof_block_softbits    = codeword.size();
-      unsigned          codeword_block_offset = count_re_symbol * config.nof_tx_layers;
-      unsigned          codeword_block_size   = nof_block_softbits / get_bits_per_symbol(config.modulation);
-      span<const cf_t>  eq_re_block           = eq_re.subspan(codeword_block_offset, codeword_block_size);
-      span<const float> eq_noise_vars_block   = eq_noise_vars.subspan(codeword_block_offset, codeword_block_size);
-
-      // Build LLRs from channel symbols.
-      demapper->demodulate_soft(codeword, eq_re_block, eq_noise_vars_block, config.modulation);
-
-      // Calculate EVM only if it is available.
-      if (evm_calc) {
-        symbol_evm_accumulate +=
-            static_cast<float>(codeword_block_size) * evm_calc->calculate(codeword, eq_re_block, config.modulation);
-        symbol_evm_symbol_count += codeword_block_size;
-      }
+      unsigned nof_block_softbits  = codeword.size();
+      unsigned codeword_block_size = nof_block_softbits / get_bits_per_symbol(config.modulation);
 
       // Generate scrambling sequence.
       static_bit_buffer<pusch_constants::MAX_NOF_BITS_PER_OFDM_SYMBOL> scrambling_seq(nof_block_softbits);
       descrambler->generate(scrambling_seq);
 
-      // Revert scrambling.
-      revert_scrambling(codeword, codeword, scrambling_seq);
+      if (is_valid) {
+        unsigned          codeword_block_offset = count_re_symbol * config.nof_tx_layers;
+        span<const cf_t>  eq_re_block           = eq_re.subspan(codeword_block_offset, codeword_block_size);
+        span<const float> eq_noise_vars_block   = eq_noise_vars.subspan(codeword_block_offset, codeword_block_size);
+
+        // Build LLRs from channel symbols.
+        demapper->demodulate_soft(codeword, eq_re_block, eq_noise_vars_block, config.modulation);
+
+        // Calculate EVM only if it is available.
+        if (evm_calc) {
+          symbol_evm_accumulate +=
+              static_cast<float>(codeword_block_size) * evm_calc->calculate(codeword, eq_re_block, config.modulation);
+          symbol_evm_symbol_count += codeword_block_size;
+        }
+
+        // Revert scrambling.
+        revert_scrambling(codeword, codeword, scrambling_seq);
+      } else {
+        // The soft bits of missing OFDM symbols do not carry any information.
+        std::fill(codeword.begin(), codeword.end(), log_likelihood_ratio(0));
+      }
 
       // Increment the number of processed RE within the OFDM symbol.
       count_re_symbol += nof_block_softbits / nof_bits_per_re;
@@ -405,7 +464,7 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
       // Update and notify statistics if it is the last processed block for the OFDM symbol. The provisional stats must
       // be notified earlier than the new processed block to ensure the stats are available upon the notification of the
       // results.
-      if (count_re_symbol == nof_re_symbol) {
+      if (is_valid && (count_re_symbol == nof_re_symbol)) {
         // Prepare OFDM symbol stats and report.
         pusch_demodulator_notifier::demodulation_stats stats;
         if ((symbol_sinr_softbit_count != 0) && (symbol_noise_var_accumulate > 0.0)) {
@@ -431,6 +490,11 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
     }
   }
 
+  // Wait for more OFDM symbols if the transmission is not complete.
+  if (next_symbol_index != i_symbol_end) {
+    return;
+  }
+
   pusch_demodulator_notifier::demodulation_stats stats;
   if ((total_sinr_softbit_count != 0) && (total_noise_var_accumulate > 0.0)) {
     float mean_noise_var = total_noise_var_accumulate / static_cast<float>(total_sinr_softbit_count);
@@ -442,6 +506,12 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&              code
     stats.evm.emplace(total_evm_accumulate / static_cast<float>(total_evm_symbol_count));
   }
 
+  // The transmission is complete. Release the parameters before notifying, the demodulator might be reused afterwards.
+  current_codeword_buffer = nullptr;
+  current_notifier        = nullptr;
+  current_grid            = nullptr;
+  current_est_results     = nullptr;
+
   notifier.on_end_stats(stats);
   codeword_buffer.on_end_codeword();
 }
@@ -62,6 +62,16 @@ public:
                   const dmrs_pusch_estimator_results& est_results,
                   const configuration&                config) override;
 
+  // See interface for the documentation.
+  void start(pusch_codeword_buffer&              codeword_buffer,
+             pusch_demodulator_notifier&         notifier,
+             const resource_grid_reader&         grid,
+             const dmrs_pusch_estimator_results& est_results,
+             const configuration&                config) override;
+
+  // See interface for the documentation.
+  void demodulate_symbols(unsigned end_symbol_index, bool is_valid) override;
+
 private:
   /// Data type for representing an RE mask within an OFDM symbol.
   using re_symbol_mask_type = bounded_bitset<MAX_NOF_SUBCARRIERS>;
@@ -127,9 +137,40 @@ private:
   dynamic_ch_est_list ch_estimates_copy;
   /// Buffer used to transfer noise variance estimates from the channel estimate to the equalizer.
   std::array<float, MAX_PORTS> noise_var_estimates;
+  /// Buffer used to transfer the interference-plus-noise covariance matrix from the channel estimate to the equalizer.
+  std::array<cf_t, MAX_PORTS * MAX_PORTS> noise_covariance;
 
   /// Enables post equalization SINR calculation.
   bool compute_post_eq_sinr;
+
+  /// Codeword buffer of the current transmission, set to \c nullptr when there is no transmission in progress.
+  pusch_codeword_buffer* current_codeword_buffer = nullptr;
+  /// Demodulation statistics notifier of the current transmission.
+  pusch_demodulator_notifier* current_notifier = nullptr;
+  /// Resource grid of the current transmission.
+  const resource_grid_reader* current_grid = nullptr;
+  /// Channel estimates of the current transmission.
+  const dmrs_pusch_estimator_results* current_est_results = nullptr;
+  /// Configuration of the current transmission.
+  configuration current_config;
+  /// Index of the next OFDM symbol to demodulate within the slot.
+  unsigned next_symbol_index = 0;
+  /// RE mask of the OFDM symbols without DM-RS.
+  re_symbol_mask_type data_re_mask;
+  /// RE mask of the OFDM symbols with DM-RS.
+  re_symbol_mask_type dmrs_re_mask;
+  /// Number of bits carried by each RE.
+  unsigned nof_bits_per_re = 0;
+  /// Set to true if the equalizer uses the interference-plus-noise covariance matrix.
+  bool use_noise_covariance = false;
+  /// Total number of symbols used for the EVM calculation.
+  unsigned total_evm_symbol_count = 0;
+  /// Total number of soft bits used for the SINR calculation.
+  unsigned total_sinr_softbit_count = 0;
+  /// Accumulated noise variance.
+  float total_noise_var_accumulate = 0.0;
+  /// Accumulated EVM.
+  float total_evm_accumulate = 0.0;
 };
 
 } // namespace ocudu
@@ -37,69 +37,36 @@ using namespace ocudu;
   return is_success;
 }
 
-namespace {
-class pusch_processor_csi_part1_feedback_impl : public pusch_processor_csi_part1_feedback
+void pusch_processor_csi_part1_feedback_impl::on_csi_part1(const uci_payload_type& part1)
 {
-public:
-  pusch_processor_csi_part1_feedback_impl(pusch_uci_decoder_wrapper& csi_part2_decoder_,
-                                          pusch_decoder&             ulsch_decoder_,
-                                          ulsch_demultiplex&         demultiplex_,
-                                          modulation_scheme          modulation_,
-                                          uci_part2_size_description csi_part2_size_,
-                                          ulsch_configuration        ulsch_config_) :
-    csi_part2_decoder(csi_part2_decoder_),
-    ulsch_decoder(ulsch_decoder_),
-    demultiplex(demultiplex_),
-    modulation(modulation_),
-    csi_part2_size(std::move(csi_part2_size_)),
-    ulsch_config(std::move(ulsch_config_))
-  {
-  }
-
-  void connect_notifier(pusch_processor_notifier_adaptor& notifier_) { notifier = &notifier_; }
-
-  void on_csi_part1(const uci_payload_type& part1) override
-  {
-    ocudu_assert(notifier != nullptr, "Notifier not connected.");
-
-    unsigned nof_csi_part_2_bits = uci_part2_get_size(part1, csi_part2_size);
-
-    // Skip if the number of CSI Part 2 bits is zero.
-    if (nof_csi_part_2_bits == 0) {
-      return;
-    }
+  ocudu_assert(notifier != nullptr, "Notifier not connected.");
 
-    // Update the number of CSI Part 2 bits.
-    ulsch_config.nof_csi_part2_bits = units::bits(nof_csi_part_2_bits);
+  unsigned nof_csi_part_2_bits = uci_part2_get_size(part1, csi_part2_size);
 
-    // Recalculate the UL-SCH information.
-    ulsch_information info = get_ulsch_information(ulsch_config);
+  // Skip if the number of CSI Part 2 bits is zero.
+  if (nof_csi_part_2_bits == 0) {
+    return;
+  }
 
-    // Get CSI Part 2 notifier.
-    pusch_uci_decoder_notifier& csi_part2_notifier = notifier->get_csi_part2_notifier();
+  // Update the number of CSI Part 2 bits.
+  ulsch_config.nof_csi_part2_bits = units::bits(nof_csi_part_2_bits);
 
-    // Configure CSI Part 2 decoder.
-    pusch_decoder_buffer& csi_part2_buffer =
-        csi_part2_decoder.new_transmission(nof_csi_part_2_bits, modulation, csi_part2_notifier);
+  // Recalculate the UL-SCH information.
+  ulsch_information info = get_ulsch_information(ulsch_config);
 
-    // Configure UL-SCH demultiplex.
-    demultiplex.set_csi_part2(csi_part2_buffer, nof_csi_part_2_bits, info.nof_csi_part2_bits.value());
+  // Get CSI Part 2 notifier.
+  pusch_uci_decoder_notifier& csi_part2_notifier = notifier->get_csi_part2_notifier();
 
-    // Set the number of UL-SCH softbits in the PUSCH decoder.
-    ulsch_decoder.set_nof_softbits(info.nof_ul_sch_bits);
-  }
+  // Configure CSI Part 2 decoder.
+  pusch_decoder_buffer& csi_part2_buffer =
+      csi_part2_decoder.new_transmission(nof_csi_part_2_bits, modulation, csi_part2_notifier);
 
-private:
-  pusch_processor_notifier_adaptor* notifier;
-  pusch_uci_decoder_wrapper&        csi_part2_decoder;
-  pusch_decoder&                    ulsch_decoder;
-  ulsch_demultiplex&                demultiplex;
-  modulation_scheme                 modulation;
-  uci_part2_size_description        csi_part2_size;
-  ulsch_configuration               ulsch_config;
-};
+  // Configure UL-SCH demultiplex.
+  demultiplex.set_csi_part2(csi_part2_buffer, nof_csi_part_2_bits, info.nof_csi_part2_bits.value());
 
-} // namespace
+  // Set the number of UL-SCH softbits in the PUSCH decoder.
+  ulsch_decoder.set_nof_softbits(info.nof_ul_sch_bits);
+}
 
 // Dummy PUSCH decoder buffer. Used for PUSCH transmissions without SCH data.
 static pusch_decoder_buffer_dummy decoder_buffer_dummy;
@@ -124,6 +91,26 @@ void pusch_processor_impl::process(span<uint8_t>                    data,
                                    pusch_processor_result_notifier& notifier,
                                    const resource_grid_reader&      grid,
                                    const pusch_processor::pdu_t&    pdu)
+{
+  start_processing(data, std::move(rm_buffer), notifier, grid, nullptr, pdu);
+}
+
+void pusch_processor_impl::process(span<uint8_t>                    data,
+                                   unique_rx_buffer                 rm_buffer,
+                                   pusch_processor_result_notifier& notifier,
+                                   const resource_grid_reader&      grid,
+                                   pusch_rx_symbol_monitor&         symbol_monitor_,
+                                   const pusch_processor::pdu_t&    pdu)
+{
+  start_processing(data, std::move(rm_buffer), notifier, grid, &symbol_monitor_, pdu);
+}
+
+void pusch_processor_impl::start_processing(span<uint8_t>                    data,
+                                            unique_rx_buffer                 rm_buffer,
+                                            pusch_processor_result_notifier& notifier,
+                                            const resource_grid_reader&      grid,
+                                            pusch_rx_symbol_monitor*         symbol_monitor_,
+                                            const pusch_processor::pdu_t&    pdu)
 {
   // Get dependencies.
   concurrent_dependencies_pool_type::ptr dependencies = dependencies_pool->get();
@@ -189,6 +176,9 @@ void pusch_processor_impl::process(span<uint8_t>                    data,
   ch_est_config.nof_symbols  = pdu.nof_symbols;
   ch_est_config.rx_ports.assign(pdu.rx_ports.begin(), pdu.rx_ports.end());
 
+  // Save the reception progress of the OFDM symbols, it is used after the channel estimation.
+  symbol_monitor = symbol_monitor_;
+
   // Configure and get the estimator notifier.
   dmrs_pusch_estimator&          estimator          = dependencies->get_estimator();
   dmrs_pusch_estimator_notifier& estimator_notifier = estimator_notifier_configurator.configure(
@@ -272,17 +262,17 @@ void pusch_processor_impl::process_data(span<uint8_t>                          d
   std::reference_wrapper<pusch_decoder_buffer> harq_ack_buffer(decoder_buffer_dummy);
   std::reference_wrapper<pusch_decoder_buffer> csi_part1_buffer(decoder_buffer_dummy);
 
-  // Prepare CSI Part 1 feedback.
-  pusch_processor_csi_part1_feedback_impl csi_part1_feedback(dependencies->get_csi_part2_decoder(),
-                                                             *decoder,
-                                                             dependencies->get_demultiplex(),
-                                                             pdu.mcs_descr.modulation,
-                                                             pdu.uci.csi_part2_size,
-                                                             ulsch_config);
+  // Prepare CSI Part 1 feedback. It must persist until the end of the demodulation.
+  csi_part1_feedback.emplace(dependencies->get_csi_part2_decoder(),
+                             *decoder,
+                             dependencies->get_demultiplex(),
+                             pdu.mcs_descr.modulation,
+                             pdu.uci.csi_part2_size,
+                             ulsch_config);
 
   // Prepare notifiers.
-  notifier_adaptor.new_transmission(notifier, csi_part1_feedback, csi);
-  csi_part1_feedback.connect_notifier(notifier_adaptor);
+  notifier_adaptor.new_transmission(notifier, *csi_part1_feedback, csi);
+  csi_part1_feedback->connect_notifier(notifier_adaptor);
 
   if (has_sch_data) {
     units::bits tbs            = units::bytes(data.size()).to_bits();
@@ -344,6 +334,62 @@ void pusch_processor_impl::process_data(span<uint8_t>                          d
   demod_config.dc_position                 = pdu.dc_position;
   demod_config.enable_transform_precoding  = enable_transform_precoding;
   demod_config.rx_ports                    = pdu.rx_ports;
-  dependencies->get_demodulator().demodulate(
+
+  // Demodulate all the OFDM symbols if they are available.
+  if (symbol_monitor == nullptr) {
+    dependencies->get_demodulator().demodulate(
+        demodulator_buffer, notifier_adaptor.get_demodulator_notifier(), grid, est_results, demod_config);
+    return;
+  }
+
+  // Otherwise, demodulate the OFDM symbols as they are received. The dependencies are kept until the end of the
+  // demodulation.
+  dependencies->get_demodulator().start(
       demodulator_buffer, notifier_adaptor.get_demodulator_notifier(), grid, est_results, demod_config);
+  pending_dependencies = std::move(dependencies);
+  symbol_end_index     = pdu.start_symbol_index + pdu.nof_symbols;
+  resume_demodulation();
+}
+
+void pusch_processor_impl::resume_demodulation()
+{
+  ocudu_assert(symbol_monitor != nullptr, "Invalid symbol monitor.");
+  ocudu_assert(pending_dependencies, "Invalid dependencies.");
+
+  for (;;) {
+    unsigned nof_rx_symbols = symbol_monitor->get_nof_rx_symbols();
+    bool     is_discarded   = symbol_monitor->is_discarded();
+
+    // Demodulate the rest of the transmission if it is fully received or if the slot was discarded.
+    if ((nof_rx_symbols >= symbol_end_index) || is_discarded) {
+      // Move the transmission state to the stack, the processor might be reused as soon as the codeword is complete.
+      concurrent_dependencies_pool_type::ptr dependencies      = std::move(pending_dependencies);
+      unsigned                               last_symbol_index = symbol_end_index - 1;
+      symbol_monitor                                           = nullptr;
+
+      pusch_demodulator& demodulator = dependencies->get_demodulator();
+      if (nof_rx_symbols > last_symbol_index) {
+        demodulator.demodulate_symbols(last_symbol_index, true);
+        return;
+      }
+
+      // The OFDM symbols that were not received are demodulated as invalid.
+      if (nof_rx_symbols != 0) {
+        demodulator.demodulate_symbols(nof_rx_symbols - 1, true);
+      }
+      demodulator.demodulate_symbols(last_symbol_index, false);
+      return;
+    }
+
+    // Demodulate the OFDM symbols received so far.
+    if (nof_rx_symbols != 0) {
+      pending_dependencies->get_demodulator().demodulate_symbols(nof_rx_symbols - 1, true);
+    }
+
+    // Wait for the next OFDM symbols. The processor must not be accessed after a successful request, as the
+    // notification might be already in progress in a different thread.
+    if (symbol_monitor->request_notification(nof_rx_symbols, *this)) {
+      return;
+    }
+  }
 }
@@ -15,18 +15,57 @@
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_decoder.h"
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_demodulator.h"
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_processor.h"
+#include "ocudu/phy/upper/channel_processors/pusch/pusch_rx_symbol_monitor.h"
 #include "ocudu/phy/upper/channel_processors/pusch/ulsch_demultiplex.h"
 #include "ocudu/phy/upper/channel_processors/uci/uci_decoder.h"
 #include "ocudu/phy/upper/signal_processors/pusch/dmrs_pusch_estimator.h"
 #include "ocudu/phy/upper/unique_rx_buffer.h"
 #include "ocudu/ran/pusch/pusch_constants.h"
+#include "ocudu/ran/pusch/ulsch_info.h"
 #include "ocudu/support/memory_pool/bounded_object_pool.h"
 #include <memory>
+#include <optional>
 
 namespace ocudu {
 
+/// \brief Reconfigures the CSI Part 2 decoding and the UL-SCH demultiplexing upon the reception of CSI Part 1.
+///
+/// The number of CSI Part 2 bits depends on the CSI Part 1 payload.
+class pusch_processor_csi_part1_feedback_impl : public pusch_processor_csi_part1_feedback
+{
+public:
+  pusch_processor_csi_part1_feedback_impl(pusch_uci_decoder_wrapper& csi_part2_decoder_,
+                                          pusch_decoder&             ulsch_decoder_,
+                                          ulsch_demultiplex&         demultiplex_,
+                                          modulation_scheme          modulation_,
+                                          uci_part2_size_description csi_part2_size_,
+                                          ulsch_configuration        ulsch_config_) :
+    csi_part2_decoder(csi_part2_decoder_),
+    ulsch_decoder(ulsch_decoder_),
+    demultiplex(demultiplex_),
+    modulation(modulation_),
+    csi_part2_size(std::move(csi_part2_size_)),
+    ulsch_config(std::move(ulsch_config_))
+  {
+  }
+
+  void connect_notifier(pusch_processor_notifier_adaptor& notifier_) { notifier = &notifier_; }
+
+  // See interface for documentation.
+  void on_csi_part1(const uci_payload_type& part1) override;
+
+private:
+  pusch_processor_notifier_adaptor* notifier;
+  pusch_uci_decoder_wrapper&        csi_part2_decoder;
+  pusch_decoder&                    ulsch_decoder;
+  ulsch_demultiplex&                demultiplex;
+  modulation_scheme                 modulation;
+  uci_part2_size_description        csi_part2_size;
+  ulsch_configuration               ulsch_config;
+};
+
 /// Implements a generic software PUSCH processor.
-class pusch_processor_impl : public pusch_processor
+class pusch_processor_impl : public pusch_processor, private pusch_rx_symbol_listener
 {
 public:
   /// The current maximum supported number of layers.
@@ -114,6 +153,14 @@ public:
                const resource_grid_reader&      grid,
                const pdu_t&                     pdu) override;
 
+  // See interface for documentation.
+  void process(span<uint8_t>                    data,
+               unique_rx_buffer                 rm_buffer,
+               pusch_processor_result_notifier& notifier,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor_,
+               const pdu_t&                     pdu) override;
+
 private:
   /// \brief Notifier for the PUSCH channel estimator.
   ///
@@ -235,6 +282,40 @@ private:
   channel_state_information::sinr_type csi_sinr_calc_method;
   /// Notifier adaptor.
   pusch_processor_notifier_adaptor notifier_adaptor;
+  /// CSI Part 1 feedback of the current transmission.
+  std::optional<pusch_processor_csi_part1_feedback_impl> csi_part1_feedback;
+  /// Reception progress of the OFDM symbols. Set to \c nullptr if all the OFDM symbols are available at the start.
+  pusch_rx_symbol_monitor* symbol_monitor = nullptr;
+  /// Dependencies of the transmission while it is demodulated as its OFDM symbols are received.
+  concurrent_dependencies_pool_type::ptr pending_dependencies;
+  /// End of the current transmission allocation, exclusive, as an OFDM symbol index within the slot.
+  unsigned symbol_end_index = 0;
+
+  /// \brief Starts the processing of a PUSCH transmission.
+  ///
+  /// Runs the channel estimation. The rest of the processing continues upon the estimation completion.
+  ///
+  /// \param[out]    data            Received transport block.
+  /// \param[in,out] rm_buffer       Rate matcher buffer.
+  /// \param[in]     notifier        Result notification interface.
+  /// \param[in]     grid            Source resource grid.
+  /// \param[in]     symbol_monitor_ Reception progress of the OFDM symbols, \c nullptr if they are all available.
+  /// \param[in]     pdu             Necessary parameters to process the PUSCH transmission.
+  void start_processing(span<uint8_t>                    data,
+                        unique_rx_buffer                 rm_buffer,
+                        pusch_processor_result_notifier& notifier,
+                        const resource_grid_reader&      grid,
+                        pusch_rx_symbol_monitor*         symbol_monitor_,
+                        const pdu_t&                     pdu);
+
+  /// \brief Demodulates the OFDM symbols received since the last call.
+  ///
+  /// It finishes the demodulation when the last OFDM symbol of the transmission is received or the slot is discarded.
+  /// Otherwise, it requests a notification for the next OFDM symbols.
+  void resume_demodulation();
+
+  // See interface for documentation.
+  void on_new_rx_symbols() override { resume_demodulation(); }
 
   /// \brief Processes the data in a PUSCH transmission.
   /// \param[out]    data                         Received transport block.
@@ -14,6 +14,8 @@
 #include "ocudu/ocudulog/logger.h"
 #include "ocudu/phy/upper/channel_processors/pusch/formatters.h"
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_processor.h"
+#include "ocudu/phy/upper/channel_processors/pusch/pusch_rx_symbol_monitor.h"
+#include "ocudu/phy/upper/unique_rx_buffer.h"
 #include "ocudu/support/memory_pool/bounded_object_pool.h"
 
 namespace ocudu {
@@ -53,6 +55,22 @@ public:
     processor->process(data, std::move(rm_buffer), *this, grid, pdu);
   }
 
+  // See pusch_processor interface for documentation.
+  void process(span<uint8_t>                    data,
+               unique_rx_buffer                 rm_buffer,
+               pusch_processor_result_notifier& notifier_,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor,
+               const pdu_t&                     pdu) override
+  {
+    // Save original notifier.
+    [[maybe_unused]] pusch_processor_result_notifier* prev_notifier = std::exchange(notifier, &notifier_);
+    ocudu_assert(prev_notifier == nullptr, "PUSCH processor is in use.");
+
+    // Process.
+    processor->process(data, std::move(rm_buffer), *this, grid, symbol_monitor, pdu);
+  }
+
   /// Sets the unique pointer that will be released upon the completion of the PUSCH processing.
   void set_unique_ptr(pool::ptr unique_token_) { unique_pool_ptr = std::move(unique_token_); }
 
@@ -86,11 +104,92 @@ private:
 
 /// \brief PUSCH processor pool
 ///
-/// It contains PUSCH processors that are asynchronously executed. The processing of a PUSCH transmission is dropped if
-/// there are no free PUSCH processors available.
+/// It contains PUSCH processors that are asynchronously executed. If there are no free PUSCH processors available, the
+/// UCI of a PUSCH transmission is processed synchronously and the data is dropped.
 ///
+/// A PUSCH transmission whose processing starts before the end of its allocation cannot be processed synchronously at
+/// that point. If no PUSCH processor is available, it waits for its last OFDM symbol and it is then processed as a
+/// transmission that starts at the end of its allocation.
 class pusch_processor_pool : public pusch_processor
 {
+  /// PUSCH transmission waiting for the last OFDM symbol of its allocation because no processor was available.
+  class postponed_transmission : public pusch_rx_symbol_listener
+  {
+  public:
+    /// Pool of postponed PUSCH transmissions.
+    using pool = bounded_unique_object_pool<postponed_transmission>;
+
+    /// Creates a postponed transmission that is processed by the given PUSCH processor pool.
+    explicit postponed_transmission(pusch_processor_pool* parent_) : parent(*parent_) {}
+
+    /// \brief Waits for the last OFDM symbol of the transmission and processes it.
+    ///
+    /// The transmission returns to the pool of postponed transmissions when its processing starts.
+    void postpone(pool::ptr                        unique_token_,
+                  span<uint8_t>                    data_,
+                  unique_rx_buffer                 rm_buffer_,
+                  pusch_processor_result_notifier& notifier_,
+                  const resource_grid_reader&      grid_,
+                  pusch_rx_symbol_monitor&         symbol_monitor_,
+                  const pdu_t&                     pdu_)
+    {
+      unique_pool_ptr = std::move(unique_token_);
+      data            = data_;
+      rm_buffer       = std::move(rm_buffer_);
+      notifier        = &notifier_;
+      grid            = &grid_;
+      symbol_monitor  = &symbol_monitor_;
+      pdu             = pdu_;
+
+      on_new_rx_symbols();
+    }
+
+  private:
+    // See pusch_rx_symbol_listener for documentation.
+    void on_new_rx_symbols() override
+    {
+      unsigned nof_rx_symbols = symbol_monitor->get_nof_rx_symbols();
+      unsigned end_symbol     = pdu.start_symbol_index + pdu.nof_symbols;
+      while ((nof_rx_symbols < end_symbol) && !symbol_monitor->is_discarded()) {
+        // Wait for the notification of new OFDM symbols.
+        if (symbol_monitor->request_notification(nof_rx_symbols, *this)) {
+          return;
+        }
+        nof_rx_symbols = symbol_monitor->get_nof_rx_symbols();
+      }
+
+      // Return to the pool of postponed transmissions once the processing finishes.
+      pool::ptr unique_token = std::move(unique_pool_ptr);
+
+      // The rest of the allocation will never be received.
+      if (nof_rx_symbols < end_symbol) {
+        parent.logger.warning(
+            pdu.slot.sfn(), pdu.slot.slot_index(), "Discarded slot. Dropping postponed PUSCH {:s}.", pdu);
+        notify_discarded(*notifier, pdu);
+        return;
+      }
+
+      parent.process(data, std::move(rm_buffer), *notifier, *grid, pdu);
+    }
+
+    /// Pool that processes the transmission.
+    pusch_processor_pool& parent;
+    /// Identifier within the pool of postponed transmissions.
+    pool::ptr unique_pool_ptr;
+    /// Transport block data.
+    span<uint8_t> data;
+    /// Soft-bit buffer.
+    unique_rx_buffer rm_buffer;
+    /// Result notifier.
+    pusch_processor_result_notifier* notifier = nullptr;
+    /// Resource grid.
+    const resource_grid_reader* grid = nullptr;
+    /// Reception progress of the slot OFDM symbols.
+    pusch_rx_symbol_monitor* symbol_monitor = nullptr;
+    /// PUSCH transmission parameters.
+    pdu_t pdu;
+  };
+
 public:
   /// Alias for the common UCI processor pool. The processors of this pool operate synchronously from the thread that
   /// calls processing.
@@ -99,7 +198,10 @@ public:
   /// Creates a PUSCH processor pool from a list of processors. Ownership is transferred to the pool.
   pusch_processor_pool(span<std::unique_ptr<pusch_processor_wrapper>> processors_,
                        std::shared_ptr<uci_processor_pool>            uci_processors_) :
-    logger(ocudulog::fetch_basic_logger("PHY")), processors(processors_), uci_processors(uci_processors_)
+    logger(ocudulog::fetch_basic_logger("PHY")),
+    processors(processors_),
+    uci_processors(uci_processors_),
+    postponed_transmissions(processors_.size(), this)
   {
   }
 
@@ -160,7 +262,66 @@ public:
     }
   }
 
+  // See interface for documentation.
+  void process(span<uint8_t>                    data,
+               unique_rx_buffer                 rm_buffer,
+               pusch_processor_result_notifier& notifier,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor,
+               const pdu_t&                     pdu) override
+  {
+    // Get a processor and process normally.
+    auto unique_processor = processors.get();
+    if (unique_processor) {
+      // Save reference to the processor.
+      pusch_processor& processor = *unique_processor;
+
+      // Set unique pointer, it will be returned to the pool when the processing is completed.
+      unique_processor->set_unique_ptr(std::move(unique_processor));
+
+      // Process PUSCH.
+      processor.process(data, std::move(rm_buffer), notifier, grid, symbol_monitor, pdu);
+      return;
+    }
+
+    // The UCI processors operate synchronously, they cannot wait for the rest of the OFDM symbols. Postpone the
+    // processing until the end of the allocation.
+    auto unique_transmission = postponed_transmissions.get();
+    if (unique_transmission) {
+      logger.info(pdu.slot.sfn(),
+                  pdu.slot.slot_index(),
+                  "PUSCH processing queue is full. Postponing PUSCH {:s} until the end of its allocation.",
+                  pdu);
+
+      postponed_transmission& transmission = *unique_transmission;
+      transmission.postpone(
+          std::move(unique_transmission), data, std::move(rm_buffer), notifier, grid, symbol_monitor, pdu);
+      return;
+    }
+
+    // Drop PUSCH reception.
+    logger.warning(pdu.slot.sfn(), pdu.slot.slot_index(), "PUSCH processing queue is full. Dropping PUSCH {:s}.", pdu);
+    notify_discarded(notifier, pdu);
+  }
+
 private:
+  /// Reports the discarded results of a PUSCH transmission.
+  static void notify_discarded(pusch_processor_result_notifier& notifier, const pdu_t& pdu)
+  {
+    // Report control-related discarded result if UCI is present.
+    if ((pdu.uci.nof_harq_ack != 0) || (pdu.uci.nof_csi_part1 != 0)) {
+      notifier.on_uci({.harq_ack  = {.payload = uci_payload_type(pdu.uci.nof_harq_ack), .status = uci_status::invalid},
+                       .csi_part1 = {},
+                       .csi_part2 = {},
+                       .csi       = {}});
+    }
+
+    // Report data-related discarded result if shared channel data is present. It notifies the end of the processing.
+    if (pdu.codeword.has_value()) {
+      notifier.on_sch({.data = {.tb_crc_ok = false, .nof_codeblocks_total = 0, .ldpc_decoder_stats = {}}, .csi = {}});
+    }
+  }
+
   /// Physical layer logger.
   ocudulog::basic_logger& logger;
   /// Actual PUSCH processor pool.
@@ -168,6 +329,8 @@ private:
   /// UCI processor pool, used only the normal processor pool runs out of processors or the PUSCH transmission only
   /// contains UCI.
   std::shared_ptr<uci_processor_pool> uci_processors;
+  /// Pool of PUSCH transmissions waiting for the end of their allocation because no processor was available.
+  postponed_transmission::pool postponed_transmissions;
 };
 
 } // namespace ocudu
@@ -9,7 +9,8 @@
  */
 
 /// \file
-/// \brief Channel equalizer implementation for the Zero Forcing and the Minimum Mean Square Error.
+/// \brief Channel equalizer implementation for the Zero Forcing and the Minimum Mean Square Error, with and without
+/// Interference Rejection Combining.
 
 #include "channel_equalizer_generic_impl.h"
 #include "equalize_mmse_mxn_simd.h"
@@ -17,6 +18,7 @@
 #include "equalize_zf_2xn.h"
 #include "equalize_zf_mxn_simd.h"
 #include "interleave_layers.h"
+#include "noise_whitening.h"
 #include "ocudu/adt/interval.h"
 #include "ocudu/ocuduvec/copy.h"
 #include "ocudu/phy/support/re_buffer.h"
@@ -490,6 +492,150 @@ static void equalize_mmse_4x8(span<cf_t>                            eq_symbols,
   equalize_mmse_mxn<4, 8>(eq_symbols, noise_vars, ch_symbols, ch_estimates, noise_var_est, tx_scaling);
 }
 
+/// Whitening matrix type used by the MMSE-IRC equalizer.
+using irc_whitening_matrix = noise_whitening_matrix<channel_equalizer_generic_impl::max_nof_ports>;
+
+template <unsigned NofLayers, unsigned NofPorts>
+static void equalize_mmse_irc_mxn(span<cf_t>                            eq_symbols,
+                                  span<float>                           noise_vars,
+                                  const re_buffer_reader<cbf16_t>&      ch_symbols,
+                                  const channel_equalizer::ch_est_list& ch_estimates,
+                                  const irc_whitening_matrix&           whitening,
+                                  float                                 tx_scaling)
+{
+  unsigned i_re   = 0;
+  unsigned nof_re = ch_symbols.get_nof_re();
+
+  ocudu_assert(eq_symbols.size() == NofLayers * nof_re, "Invalid equalized symbol size.");
+  ocudu_assert(noise_vars.size() == NofLayers * nof_re, "Invalid noise variance size.");
+  ocudu_assert(ch_symbols.get_nof_slices() == NofPorts,
+               "Invalid channel symbols number of ports (i.e., {}).",
+               ch_symbols.get_nof_slices());
+  ocudu_assert(ch_estimates.get_nof_rx_ports() == NofPorts,
+               "Invalid channel estimates number of ports (i.e., {}).",
+               ch_estimates.get_nof_rx_ports());
+  ocudu_assert(ch_estimates.get_nof_tx_layers() == NofLayers,
+               "Invalid channel estimates number of layers (i.e., {}).",
+               ch_estimates.get_nof_tx_layers());
+
+  // Broadcast the whitening matrix coefficients.
+  simd_cf_t whitening_simd[NofPorts][NofPorts];
+  for (unsigned i_port = 0; i_port != NofPorts; ++i_port) {
+    for (unsigned j_port = 0; j_port != NofPorts; ++j_port) {
+      whitening_simd[i_port][j_port] = ocudu_simd_cf_set1(whitening[i_port][j_port]);
+    }
+  }
+
+  // Extract views of input data.
+  std::array<span<const cbf16_t>, NofPorts>                        ch_symbols_view;
+  std::array<std::array<span<const cbf16_t>, NofLayers>, NofPorts> ch_estimates_view;
+  for (unsigned i_port = 0; i_port != NofPorts; ++i_port) {
+    ch_symbols_view[i_port] = ch_symbols.get_slice(i_port);
+    for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+      ch_estimates_view[i_port][i_layer] = ch_estimates.get_channel(i_port, i_layer);
+    }
+  }
+
+  // Process entire batches of OCUDU_SIMD_CF_SIZE batches.
+  for (unsigned nof_re_end = (nof_re / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_re != nof_re_end;
+       i_re += OCUDU_SIMD_CF_SIZE) {
+    // Prepare channel matrix.
+    simd_cf_t ch_symbols_re[NofPorts];
+    simd_cf_t ch_estimates_re[NofPorts][NofLayers];
+    for (unsigned i_port = 0; i_port != NofPorts; ++i_port) {
+      ch_symbols_re[i_port] = ocudu_simd_cbf16_loadu(&ch_symbols_view[i_port][i_re]);
+      for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+        simd_cf_t ch_estimates_simd = ocudu_simd_cbf16_loadu(&ch_estimates_view[i_port][i_layer][i_re]);
+        ch_estimates_simd *= tx_scaling;
+        ch_estimates_re[i_port][i_layer] = ch_estimates_simd;
+      }
+    }
+
+    // Whiten the interference, the equivalent noise variance becomes one.
+    whiten_simd<NofLayers, NofPorts>(ch_symbols_re, ch_estimates_re, whitening_simd);
+
+    simd_cf_t eq_symbols_re[NofLayers];
+    simd_f_t  noise_vars_re[NofLayers];
+
+    equalize_mmse_mxn_simd<NofLayers, NofPorts>(eq_symbols_re, noise_vars_re, ch_symbols_re, ch_estimates_re, 1.0F);
+
+    // Store results.
+    interleave_layers_simd<NofLayers>(eq_symbols.subspan(i_re * NofLayers, OCUDU_SIMD_CF_SIZE * NofLayers),
+                                      eq_symbols_re);
+    interleave_layers_simd<NofLayers>(noise_vars.subspan(i_re * NofLayers, OCUDU_SIMD_F_SIZE * NofLayers),
+                                      noise_vars_re);
+  }
+
+  // Calculate remainder number RE to process.
+  nof_re = nof_re - i_re;
+
+  // Prepare channel matrix.
+  simd_cf_t ch_symbols_re[NofPorts];
+  simd_cf_t ch_estimates_re[NofPorts][NofLayers];
+  for (unsigned i_port = 0; i_port != NofPorts; ++i_port) {
+    std::array<cbf16_t, OCUDU_SIMD_CF_SIZE> temp_ch_symbols = {};
+    ocuduvec::copy(span<cbf16_t>(temp_ch_symbols).first(nof_re), ch_symbols_view[i_port].last(nof_re));
+    ch_symbols_re[i_port] = ocudu_simd_cbf16_loadu(temp_ch_symbols.data());
+
+    for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+      std::array<cbf16_t, OCUDU_SIMD_CF_SIZE> temp_ch_estimates = {};
+      ocuduvec::copy(span<cbf16_t>(temp_ch_estimates).first(nof_re), ch_estimates_view[i_port][i_layer].last(nof_re));
+
+      simd_cf_t ch_estimates_simd = ocudu_simd_cbf16_loadu(temp_ch_estimates.data());
+      ch_estimates_simd *= tx_scaling;
+      ch_estimates_re[i_port][i_layer] = ch_estimates_simd;
+    }
+  }
+
+  // Whiten the interference.
+  whiten_simd<NofLayers, NofPorts>(ch_symbols_re, ch_estimates_re, whitening_simd);
+
+  simd_cf_t eq_symbols_re[NofLayers];
+  simd_f_t  noise_vars_re[NofLayers];
+
+  // Actual equalization.
+  equalize_mmse_mxn_simd<NofLayers, NofPorts>(eq_symbols_re, noise_vars_re, ch_symbols_re, ch_estimates_re, 1.0F);
+
+  // Store results.
+  interleave_layers_generic<NofLayers>(eq_symbols.subspan(i_re * NofLayers, nof_re * NofLayers), eq_symbols_re);
+  interleave_layers_generic<NofLayers>(noise_vars.subspan(i_re * NofLayers, nof_re * NofLayers), noise_vars_re);
+}
+
+/// \brief Calls the MMSE-IRC equalizer with the appropriate number of layers for the given number of ports.
+/// \return \c true if the channel dimensions are supported by the MMSE-IRC equalizer, \c false otherwise.
+template <unsigned NofPorts>
+static bool equalize_mmse_irc_xn(span<cf_t>                            eq_symbols,
+                                  span<float>                           noise_vars,
+                                  const re_buffer_reader<cbf16_t>&      ch_symbols,
+                                  const channel_equalizer::ch_est_list& ch_estimates,
+                                  const irc_whitening_matrix&           whitening,
+                                  float                                 tx_scaling)
+{
+  switch (ch_estimates.get_nof_tx_layers()) {
+    case 1:
+      equalize_mmse_irc_mxn<1, NofPorts>(eq_symbols, noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+      return true;
+    case 2:
+      equalize_mmse_irc_mxn<2, NofPorts>(eq_symbols, noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+      return true;
+    case 3:
+      if constexpr (NofPorts >= 4) {
+        equalize_mmse_irc_mxn<3, NofPorts>(eq_symbols, noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+        return true;
+      }
+      break;
+    case 4:
+      if constexpr (NofPorts >= 4) {
+        equalize_mmse_irc_mxn<4, NofPorts>(eq_symbols, noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
 bool channel_equalizer_generic_impl::is_supported(channel_equalizer_algorithm_type algorithm,
                                                   unsigned                         nof_ports,
                                                   unsigned                         nof_layers)
@@ -591,8 +737,9 @@ void channel_equalizer_generic_impl::equalize(span<cf_t>                       e
     }
   }
 
-  // Minimum Mean Square Error algorithm.
-  if (type == channel_equalizer_algorithm_type::mmse) {
+  // Minimum Mean Square Error algorithm. Without a covariance matrix, MMSE-IRC cannot reject the interference and it
+  // becomes MMSE.
+  if ((type == channel_equalizer_algorithm_type::mmse) || (type == channel_equalizer_algorithm_type::mmse_irc)) {
     // Single transmit layer and any number of receive ports.
     if (nof_tx_layers == 1) {
       // For one Tx layer, and including scaling for better LLR calculation, the MMSE equalizer is equivalent to the ZF
@@ -657,3 +804,55 @@ void channel_equalizer_generic_impl::equalize(span<cf_t>                       e
       ch_estimates.get_nof_tx_layers(),
       to_string(type));
 }
+
+void channel_equalizer_generic_impl::equalize(span<cf_t>                       eq_symbols,
+                                              span<float>                      eq_noise_vars,
+                                              const re_buffer_reader<cbf16_t>& ch_symbols,
+                                              const ch_est_list&               ch_estimates,
+                                              span<const cf_t>                 noise_covariance,
+                                              float                            tx_scaling)
+{
+  unsigned nof_rx_ports = ch_estimates.get_nof_rx_ports();
+  ocudu_assert(noise_covariance.size() == nof_rx_ports * nof_rx_ports,
+               "The covariance matrix size (i.e., {}) is not consistent with the number of receive ports (i.e., {}).",
+               noise_covariance.size(),
+               nof_rx_ports);
+
+  // Extract the noise variance of each port from the diagonal of the covariance matrix.
+  static_vector<float, max_nof_ports> noise_var_estimates(nof_rx_ports);
+  for (unsigned i_port = 0; i_port != nof_rx_ports; ++i_port) {
+    noise_var_estimates[i_port] = std::real(noise_covariance[i_port * nof_rx_ports + i_port]);
+  }
+
+  // Interference rejection combining requires more than one receive port and a positive definite covariance matrix.
+  irc_whitening_matrix whitening;
+  if ((type == channel_equalizer_algorithm_type::mmse_irc) && (nof_rx_ports > 1) &&
+      compute_noise_whitening_matrix<max_nof_ports>(whitening, noise_covariance, nof_rx_ports)) {
+    // Make sure that the input and output symbol lists and channel estimate dimensions are valid.
+    assert_sizes(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_var_estimates);
+
+    ocudu_assert(tx_scaling > 0, "Tx scaling factor must be positive.");
+
+    bool success = false;
+    switch (nof_rx_ports) {
+      case 2:
+        success = equalize_mmse_irc_xn<2>(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+        break;
+      case 4:
+        success = equalize_mmse_irc_xn<4>(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+        break;
+      case 8:
+        success = equalize_mmse_irc_xn<8>(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, whitening, tx_scaling);
+        break;
+      default:
+        break;
+    }
+
+    if (success) {
+      return;
+    }
+  }
+
+  // Equalize using only the diagonal of the covariance matrix.
+  equalize(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_var_estimates, tx_scaling);
+}
@@ -9,7 +9,8 @@
  */
 
 /// \file
-/// \brief Channel equalizer implementation for the Zero Forcing and the Minimum Mean Square Error methods.
+/// \brief Channel equalizer implementation for the Zero Forcing and the Minimum Mean Square Error methods, with and
+/// without Interference Rejection Combining.
 
 #pragma once
 
@@ -18,7 +19,7 @@
 
 namespace ocudu {
 
-/// Channel equalizer implementation for the Zero Forcing and the MMSE algorithms.
+/// Channel equalizer implementation for the Zero Forcing, the MMSE and the MMSE-IRC algorithms.
 class channel_equalizer_generic_impl : public channel_equalizer
 {
 public:
@@ -39,6 +40,17 @@ public:
                 span<const float>                noise_var_estimates,
                 float                            tx_scaling) override;
 
+  // See interface for documentation.
+  void equalize(span<cf_t>                       eq_symbols,
+                span<float>                      eq_noise_vars,
+                const re_buffer_reader<cbf16_t>& ch_symbols,
+                const ch_est_list&               ch_estimates,
+                span<const cf_t>                 noise_covariance,
+                float                            tx_scaling) override;
+
+  // See interface for documentation.
+  bool is_interference_aware() const override { return type == channel_equalizer_algorithm_type::mmse_irc; }
+
 private:
   /// Determines whether a combination of the algorithm type, number of layers, and number of ports is supported.
   static bool is_supported(channel_equalizer_algorithm_type algorithm, unsigned nof_ports, unsigned nof_layers);
@@ -0,0 +1,123 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Spatial whitening of the interference-plus-noise across receive ports.
+
+#pragma once
+
+#include "ocudu/adt/complex.h"
+#include "ocudu/adt/span.h"
+#include "ocudu/ocuduvec/simd.h"
+#include <array>
+#include <cmath>
+
+namespace ocudu {
+
+/// \brief Whitening matrix, lower triangular.
+///
+/// Inverse \f$L^{-1}\f$ of the Cholesky factor of the interference-plus-noise covariance matrix \f$R = L L^H\f$.
+template <unsigned MaxNofPorts>
+using noise_whitening_matrix = std::array<std::array<cf_t, MaxNofPorts>, MaxNofPorts>;
+
+/// \brief Computes the whitening matrix of an interference-plus-noise covariance matrix.
+///
+/// \param[out] whitening  Whitening matrix. Only the first \c nof_ports rows and columns are written.
+/// \param[in]  covariance Covariance matrix of dimensions \c nof_ports by \c nof_ports, in row-major order.
+/// \param[in]  nof_ports  Number of receive ports.
+/// \return \c true if the covariance matrix is Hermitian positive definite and the whitening matrix is valid, \c false
+///         otherwise.
+template <unsigned MaxNofPorts>
+bool compute_noise_whitening_matrix(noise_whitening_matrix<MaxNofPorts>& whitening,
+                                    span<const cf_t>                     covariance,
+                                    unsigned                             nof_ports)
+{
+  // Cholesky decomposition R = L * L^H.
+  noise_whitening_matrix<MaxNofPorts> chol = {};
+  for (unsigned j = 0; j != nof_ports; ++j) {
+    float diag = std::real(covariance[j * nof_ports + j]);
+    for (unsigned k = 0; k != j; ++k) {
+      diag -= std::norm(chol[j][k]);
+    }
+
+    // The matrix is not positive definite.
+    if (!std::isnormal(diag) || (diag < 0.0F)) {
+      return false;
+    }
+
+    chol[j][j]        = std::sqrt(diag);
+    float inv_chol_jj = 1.0F / std::real(chol[j][j]);
+    for (unsigned i = j + 1; i != nof_ports; ++i) {
+      cf_t acc = covariance[i * nof_ports + j];
+      for (unsigned k = 0; k != j; ++k) {
+        acc -= chol[i][k] * std::conj(chol[j][k]);
+      }
+      chol[i][j] = acc * inv_chol_jj;
+    }
+  }
+
+  // Invert the lower triangular factor by forward substitution.
+  for (unsigned i = 0; i != nof_ports; ++i) {
+    float inv_chol_ii = 1.0F / std::real(chol[i][i]);
+    for (unsigned j = 0; j != i; ++j) {
+      cf_t acc = 0;
+      for (unsigned k = j; k != i; ++k) {
+        acc += chol[i][k] * whitening[k][j];
+      }
+      whitening[i][j] = -acc * inv_chol_ii;
+    }
+    whitening[i][i] = inv_chol_ii;
+    for (unsigned j = i + 1; j != nof_ports; ++j) {
+      whitening[i][j] = 0;
+    }
+  }
+
+  return true;
+}
+
+#if OCUDU_SIMD_CF_SIZE
+
+/// \brief Whitens the received symbols and the channel coefficients of a block of REs.
+///
+/// The perturbation of the whitened received symbols is spatially uncorrelated and has unit variance.
+///
+/// \param[in,out] ch_symbols Received symbols for each port.
+/// \param[in,out] h          Channel coefficients for each port and layer.
+/// \param[in]     whitening  Whitening matrix coefficients for each pair of ports.
+template <unsigned NofLayers, unsigned NofPorts>
+inline void whiten_simd(simd_cf_t       ch_symbols[NofPorts],
+                        simd_cf_t       h[NofPorts][NofLayers],
+                        const simd_cf_t whitening[NofPorts][NofPorts])
+{
+  // The whitening matrix is lower triangular: processing the ports backwards allows doing it in place.
+  for (unsigned i_port = NofPorts; i_port-- != 0;) {
+    simd_cf_t symbol_acc = whitening[i_port][0] * ch_symbols[0];
+    simd_cf_t h_acc[NofLayers];
+    for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+      h_acc[i_layer] = whitening[i_port][0] * h[0][i_layer];
+    }
+
+    for (unsigned k = 1; k <= i_port; ++k) {
+      symbol_acc += whitening[i_port][k] * ch_symbols[k];
+      for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+        h_acc[i_layer] += whitening[i_port][k] * h[k][i_layer];
+      }
+    }
+
+    ch_symbols[i_port] = symbol_acc;
+    for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+      h[i_port][i_layer] = h_acc[i_layer];
+    }
+  }
+}
+
+#endif // OCUDU_SIMD_CF_SIZE
+
+} // namespace ocudu
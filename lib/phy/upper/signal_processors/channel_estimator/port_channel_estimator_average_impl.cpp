@@ -10,14 +10,11 @@
 
 #include "port_channel_estimator_average_impl.h"
 #include "port_channel_estimator_helpers.h"
-#include "ocudu/ocuduvec/add.h"
-#include "ocudu/ocuduvec/conversion.h"
+#include "port_channel_estimator_kernels.h"
 #include "ocudu/ocuduvec/dot_prod.h"
 #include "ocudu/ocuduvec/mean.h"
 #include "ocudu/ocuduvec/prod.h"
 #include "ocudu/ocuduvec/sc_prod.h"
-#include "ocudu/ocuduvec/simd.h"
-#include "ocudu/ocuduvec/subtract.h"
 #include "ocudu/ocuduvec/zero.h"
 #include "ocudu/phy/support/re_buffer.h"
 #include "ocudu/phy/support/resource_grid_reader.h"
@@ -49,6 +46,8 @@ static void average_pairs(re_measurement<cf_t>& values);
 /// \brief Estimates the noise energy of one hop and a given range of layers.
 ///
 /// The layers in the given range are assumed to transmit DM-RS on the same resources.
+/// \param[out] noise_samples        Noise samples, i.e., the difference between the regenerated pilots and the received
+///                                  ones, for each OFDM symbol containing DM-RS in the current hop.
 /// \param[in] pilots                DM-RS pilots.
 /// \param[in] rx_pilots             Received samples corresponding to DM-RS pilots.
 /// \param[in] estimates             Estimated channel frequency response.
@@ -64,7 +63,8 @@ static void average_pairs(re_measurement<cf_t>& values);
 /// \param[in] start_layer           First layer in the considered range.
 /// \param[in] stop_layer            Last layer (excluded) in the considered range.
 /// \return The noise energy for the current hop.
-static float estimate_noise(const dmrs_symbol_list&                   pilots,
+static float estimate_noise(span<cf_t>                                noise_samples,
+                            const dmrs_symbol_list&                   pilots,
                             const dmrs_symbol_list&                   rx_pilots,
                             const re_measurement<cf_t>&               estimates,
                             float                                     beta,
@@ -101,13 +101,6 @@ static void setup_auxiliary_buffers(
     unsigned                                           nof_dmrs_symbols,
     unsigned                                           nof_symbol_pilots);
 
-/// \brief Interpolates two vectors.
-/// \param[out] out   Interpolation result.
-/// \param[in] first  First vector.
-/// \param[in] second Second vector.
-/// \param[in] weight Interpolation weight.
-static void simd_vector_interpolate(span<cbf16_t> out, span<const cf_t> first, span<const cf_t> second, float weight);
-
 void port_channel_estimator_average_impl::get_symbol_ch_estimate(span<cbf16_t> symbol,
                                                                  unsigned      i_symbol,
                                                                  unsigned      tx_layer) const
@@ -143,6 +136,12 @@ void port_channel_estimator_average_impl::get_symbol_ch_estimate(span<cbf16_t> s
   unsigned first_symbol = (hop == 0) ? first_symbol_hop0 : first_symbol_hop1;
   unsigned last_symbol  = (hop == 0) ? last_symbol_hop0 : last_symbol_hop1;
 
+  // CFO to apply to the estimated channel.
+  std::optional<cf_t> cfo_phase;
+  if (compensate_cfo && cfo_normalized.has_value()) {
+    cfo_phase = std::polar(1.0F, TWOPI * symbol_start_epochs[i_symbol] * (*cfo_normalized));
+  }
+
   modular_re_measurement<const cf_t, MAX_NOF_DMRS_SYMBOLS, MAX_LAYERS> freq_response =
       (hop == 0) ? static_cast<const re_measurement<cf_t>&>(freq_response_hop0)
                  : static_cast<const re_measurement<cf_t>&>(freq_response_hop1);
@@ -168,7 +167,8 @@ void port_channel_estimator_average_impl::get_symbol_ch_estimate(span<cbf16_t> s
 
   // Straight process if the allocation is contiguous.
   if (is_contiguous) {
-    apply_td_domain_strategy(symbol, pattern.symbols, freq_response, first_symbol, last_symbol, i_symbol, tx_layer);
+    apply_td_domain_strategy(
+        symbol, pattern.symbols, freq_response, first_symbol, last_symbol, i_symbol, tx_layer, cfo_phase);
   } else {
     // TODO(david): This section needs to be double-checked. Most likely, the do_compute method also needs some changes
     // to correctly support the non-contiguous case.
@@ -180,16 +180,10 @@ void port_channel_estimator_average_impl::get_symbol_ch_estimate(span<cbf16_t> s
           modular_re_measurement<const cf_t, MAX_NOF_DMRS_SYMBOLS, MAX_LAYERS> prb_freq_response(
               freq_response, i_prb_ce * NOF_SUBCARRIERS_PER_RB, NOF_SUBCARRIERS_PER_RB);
           apply_td_domain_strategy(
-              symbol, pattern.symbols, prb_freq_response, first_symbol_, last_symbol_, i_symbol, tx_layer);
+              symbol, pattern.symbols, prb_freq_response, first_symbol_, last_symbol_, i_symbol, tx_layer, cfo_phase);
           ++i_prb_ce;
         });
   }
-
-  if (compensate_cfo && cfo_normalized.has_value()) {
-    // Apply CFO to the estimated channel.
-    float cfo = *cfo_normalized;
-    ocuduvec::sc_prod(symbol, symbol, std::polar(1.0F, TWOPI * symbol_start_epochs[i_symbol] * cfo));
-  }
 }
 
 void port_channel_estimator_average_impl::get_symbol_ch_estimate(
@@ -260,6 +254,9 @@ void port_channel_estimator_average_impl::do_compute(const resource_grid_reader&
   // Prepare symbol destination.
   rx_pilots.resize(symbols_size);
 
+  // Prepare the noise samples destination.
+  noise_samples.resize(nof_dmrs_pilots * nof_cdm);
+
   // Compute the cumulative duration of all CPs for the given subcarrier spacing.
   initialize_symbol_start_epochs(cfg_local.cp, cfg_local.scs);
 
@@ -452,7 +449,15 @@ void port_channel_estimator_average_impl::compute_hop(const ocudu::resource_grid
       hop_offset = pilots.size().nof_symbols - nof_dmrs_symbols;
     }
 
-    noise_var += estimate_noise(pilots,
+    // The noise samples are stored by hop, then by CDM group and finally by OFDM symbol.
+    unsigned   nof_cdm_groups    = divide_ceil(nof_tx_layers, 2);
+    unsigned   nof_cdm_samples   = nof_symbol_pilots * nof_dmrs_symbols;
+    unsigned   hop_samples_start = hop_offset * nof_symbol_pilots * nof_cdm_groups;
+    span<cf_t> cdm_noise_samples =
+        span<cf_t>(noise_samples).subspan(hop_samples_start + (i_layer / 2) * nof_cdm_samples, nof_cdm_samples);
+
+    noise_var += estimate_noise(cdm_noise_samples,
+                                pilots,
                                 rx_pilots,
                                 filtered_pilots_lse,
                                 beta_scaling,
@@ -517,11 +522,11 @@ std::optional<float> port_channel_estimator_average_impl::preprocess_pilots_and_
       temp_pilot_products = pilots_lse.get_symbol(1, i_layer);
     }
 
-    // Match received and transmitted pilots in the second DM-RS symbol.
-    ocuduvec::prod_conj(
-        temp_pilot_products, rx_pilots.get_symbol(1, i_cdm), pilots.get_symbol(hop_offset + 1, i_layer));
-
-    noisy_phase_acc += ocuduvec::dot_prod(temp_pilot_products, pilots_lse.get_symbol(0, i_layer));
+    // Match received and transmitted pilots in the second DM-RS symbol and correlate them with the first one.
+    noisy_phase_acc += port_channel_estimator_kernels::match_and_correlate(temp_pilot_products,
+                                                                           rx_pilots.get_symbol(1, i_cdm),
+                                                                           pilots.get_symbol(hop_offset + 1, i_layer),
+                                                                           pilots_lse.get_symbol(0, i_layer));
   }
 
   float noisy_phase = std::arg(noisy_phase_acc);
@@ -548,51 +553,42 @@ void port_channel_estimator_average_impl::compensate_cfo_and_accumulate(
   unsigned i_dmrs_0 = dmrs_mask.find_lowest(first_hop_symbol, last_hop_symbol);
   unsigned i_dmrs_1 = dmrs_mask.find_lowest(i_dmrs_0 + 1, dmrs_mask.size());
 
+  // Select the kernels for the time-domain strategy and the CFO compensation.
+  bool accumulate = (td_interpolation_strategy == port_channel_estimator_td_interpolation_strategy::average);
+  port_channel_estimator_kernels::combine_first_pilots_kernel combine_first_pilots =
+      port_channel_estimator_kernels::select_combine_first_pilots_kernel(accumulate, compensate_cfo);
+  port_channel_estimator_kernels::match_pilots_kernel match_pilots =
+      port_channel_estimator_kernels::select_match_pilots_kernel(accumulate, compensate_cfo);
+
+  // CFO compensation phase for the given OFDM symbol.
+  auto get_phase = [this, cfo_value = cfo.value()](unsigned i_symbol) {
+    return std::polar(1.0F, -TWOPI * symbol_start_epochs[i_symbol] * cfo_value);
+  };
+
+  cf_t phase_0 = get_phase(i_dmrs_0);
+  cf_t phase_1 = get_phase(i_dmrs_1);
   for (unsigned i_layer = 0; i_layer != nof_layers; ++i_layer) {
     // Select destination of temporary pilots LSE.
     span<cf_t> temp_pilot_products = pilot_products.get_slice(i_layer);
-    if (td_interpolation_strategy != port_channel_estimator_td_interpolation_strategy::average) {
+    if (!accumulate) {
       temp_pilot_products = pilots_lse.get_symbol(1, i_layer);
     }
 
-    if (compensate_cfo && cfo.has_value()) {
-      ocuduvec::sc_prod(pilots_lse.get_symbol(0, i_layer),
-                        pilots_lse.get_symbol(0, i_layer),
-                        std::polar(1.0F, -TWOPI * symbol_start_epochs[i_dmrs_0] * cfo.value()));
-      ocuduvec::sc_prod(temp_pilot_products,
-                        temp_pilot_products,
-                        std::polar(1.0F, -TWOPI * symbol_start_epochs[i_dmrs_1] * cfo.value()));
-    }
-
-    if (td_interpolation_strategy == port_channel_estimator_td_interpolation_strategy::average) {
-      ocuduvec::add(pilots_lse.get_symbol(0, i_layer), temp_pilot_products, pilots_lse.get_symbol(0, i_layer));
-    }
+    combine_first_pilots(pilots_lse.get_symbol(0, i_layer), temp_pilot_products, phase_0, phase_1);
   }
 
   unsigned hop_offset = dmrs_mask.slice(0, first_hop_symbol).count();
 
   // For each DM-RS symbol in the hop, compensate the CFO and combine with the previous DM-RS symbols.
   auto combine_pilots = [&, i_dmrs = 2](size_t i_symbol) mutable {
+    cf_t phase = get_phase(i_symbol);
     for (unsigned i_layer = 0; i_layer != nof_layers; ++i_layer) {
       unsigned i_cdm = i_layer / 2;
 
-      // Select destination of temporary pilots LSE.
-      span<cf_t> temp_pilot_products = pilot_products.get_slice(i_layer);
-      if (td_interpolation_strategy != port_channel_estimator_td_interpolation_strategy::average) {
-        temp_pilot_products = pilots_lse.get_symbol(i_dmrs, i_layer);
-      }
-
-      ocuduvec::prod_conj(
-          temp_pilot_products, rx_pilots.get_symbol(i_dmrs, i_cdm), pilots.get_symbol(hop_offset + i_dmrs, i_layer));
-      if (compensate_cfo && cfo.has_value()) {
-        ocuduvec::sc_prod(temp_pilot_products,
-                          temp_pilot_products,
-                          std::polar(1.0F, -TWOPI * symbol_start_epochs[i_symbol] * cfo.value()));
-      }
+      // Select destination: the accumulator in the first symbol or the symbol itself.
+      span<cf_t> lse = pilots_lse.get_symbol(accumulate ? 0 : i_dmrs, i_layer);
 
-      if (td_interpolation_strategy == port_channel_estimator_td_interpolation_strategy::average) {
-        ocuduvec::add(pilots_lse.get_symbol(0, i_layer), temp_pilot_products, pilots_lse.get_symbol(0, i_layer));
-      }
+      match_pilots(lse, rx_pilots.get_symbol(i_dmrs, i_cdm), pilots.get_symbol(hop_offset + i_dmrs, i_layer), phase);
     }
     ++i_dmrs;
   };
@@ -623,11 +619,20 @@ void port_channel_estimator_average_impl::apply_td_domain_strategy(span<cbf16_t>
                                                                    unsigned                          hop_first_symbol,
                                                                    unsigned                          hop_last_symbol,
                                                                    unsigned                          i_symbol,
-                                                                   unsigned                          i_layer) const
+                                                                   unsigned                          i_layer,
+                                                                   std::optional<cf_t>               cfo_phase) const
 {
+  // Select the kernels depending on whether the CFO is applied.
+  bool rotate = cfo_phase.has_value();
+  cf_t phase  = cfo_phase.value_or(1.0F);
+  port_channel_estimator_kernels::interpolate_symbol_kernel copy_symbol =
+      port_channel_estimator_kernels::select_interpolate_symbol_kernel(/* interpolate = */ false, rotate);
+  port_channel_estimator_kernels::interpolate_symbol_kernel interpolate_symbol =
+      port_channel_estimator_kernels::select_interpolate_symbol_kernel(/* interpolate = */ true, rotate);
+
   // If the time-domain strategy is average, skip all interpolation.
   if (td_interpolation_strategy == port_channel_estimator_td_interpolation_strategy::average) {
-    ocuduvec::convert(estimated_rg, freq_response_dmrs.get_symbol(0, i_layer));
+    copy_symbol(estimated_rg, freq_response_dmrs.get_symbol(0, i_layer), {}, 0, phase);
     return;
   }
 
@@ -645,7 +650,7 @@ void port_channel_estimator_average_impl::apply_td_domain_strategy(span<cbf16_t>
 
     // If there is no other DM-RS symbol, then use the same estimated channel.
     if (second_dmrs_symbol == -1) {
-      ocuduvec::convert(estimated_rg, freq_response_dmrs.get_symbol(0, i_layer));
+      copy_symbol(estimated_rg, freq_response_dmrs.get_symbol(0, i_layer), {}, 0, phase);
       return;
     }
 
@@ -661,7 +666,7 @@ void port_channel_estimator_average_impl::apply_td_domain_strategy(span<cbf16_t>
 
     // If there is no other DM-RS symbol, then use the same estimated channel.
     if (second_last_dmrs_symbol == -1) {
-      ocuduvec::convert(estimated_rg, freq_response_dmrs.get_symbol(nof_dmrs_symbols - 1, i_layer));
+      copy_symbol(estimated_rg, freq_response_dmrs.get_symbol(nof_dmrs_symbols - 1, i_layer), {}, 0, phase);
       return;
     }
 
@@ -675,10 +680,11 @@ void port_channel_estimator_average_impl::apply_td_domain_strategy(span<cbf16_t>
   float    weight = static_cast<float>(diff_dmrs_before) / static_cast<float>(dmrs_symbol_after - dmrs_symbol_before);
   unsigned i_dmrs_symbol = dmrs_mask.slice(hop_first_symbol, dmrs_symbol_before).count();
 
-  simd_vector_interpolate(estimated_rg,
-                          freq_response_dmrs.get_symbol(i_dmrs_symbol, i_layer),
-                          freq_response_dmrs.get_symbol(i_dmrs_symbol + 1, i_layer),
-                          weight);
+  interpolate_symbol(estimated_rg,
+                     freq_response_dmrs.get_symbol(i_dmrs_symbol, i_layer),
+                     freq_response_dmrs.get_symbol(i_dmrs_symbol + 1, i_layer),
+                     weight,
+                     phase);
 }
 
 static std::tuple<const bounded_bitset<MAX_NSYMB_PER_SLOT>&, unsigned, unsigned, unsigned>
@@ -766,7 +772,8 @@ static void average_pairs(re_measurement<cf_t>& values)
   }
 }
 
-static float estimate_noise(const dmrs_symbol_list&                   pilots,
+static float estimate_noise(span<cf_t>                                noise_samples,
+                            const dmrs_symbol_list&                   pilots,
                             const dmrs_symbol_list&                   rx_pilots,
                             const re_measurement<cf_t>&               estimates,
                             float                                     beta,
@@ -780,13 +787,16 @@ static float estimate_noise(const dmrs_symbol_list&                   pilots,
                             unsigned                                  start_layer,
                             unsigned                                  stop_layer)
 {
-  constexpr unsigned max_layers = 2;
+  constexpr unsigned max_layers = port_channel_estimator_kernels::MAX_CDM_LAYERS;
 
   ocudu_assert((stop_layer == start_layer + 1) || (stop_layer == start_layer + max_layers),
                "Layers must be processed either independently on in pairs, required {{{}, ..., {}}}.",
                start_layer,
                stop_layer - 1);
 
+  // Number of layers in the CDM group.
+  unsigned nof_cdm_layers = stop_layer - start_layer;
+
   // Deduce the number of RE to process.
   unsigned nof_re = estimates.size().nof_subc;
 
@@ -796,7 +806,7 @@ static float estimate_noise(const dmrs_symbol_list&                   pilots,
   // Scale channel estimates and average in time domain.
   float scaling_factor = beta / static_cast<float>(nof_lse_symbols);
 
-  static_re_buffer<max_layers, MAX_NOF_SUBCARRIERS> scaled_estimates(estimates.size().nof_slices, nof_re);
+  static_re_buffer<max_layers, MAX_NOF_SUBCARRIERS> scaled_estimates(nof_cdm_layers, nof_re);
 
   for (unsigned i_layer = start_layer; i_layer != stop_layer; ++i_layer) {
     unsigned i_helper = i_layer - start_layer;
@@ -812,51 +822,36 @@ static float estimate_noise(const dmrs_symbol_list&                   pilots,
     }
   }
 
-  // Temporary data buffers.
-  static_re_buffer<1, MAX_NOF_SUBCARRIERS> predicted_obs_buffer(1, nof_re);
-  static_re_buffer<1, MAX_NOF_SUBCARRIERS> noise_samples_buffer(1, nof_re);
+  // Select the kernel for the number of layers in the CDM group and the CFO compensation.
+  bool rotate = compensate_cfo && cfo.has_value();
+  port_channel_estimator_kernels::estimate_noise_symbol_kernel estimate_noise_symbol_kernel =
+      port_channel_estimator_kernels::select_estimate_noise_symbol_kernel(nof_cdm_layers, rotate);
+
+  std::array<span<const cf_t>, max_layers> cdm_estimates = {};
+  for (unsigned i_helper = 0; i_helper != nof_cdm_layers; ++i_helper) {
+    cdm_estimates[i_helper] = scaled_estimates.get_slice(i_helper);
+  }
 
   // Noise energy accumulator for each OFDM symbol containing DM-RS.
   float noise_energy = 0.0F;
 
   auto estimate_noise_symbol = [&, i_dmrs = 0](size_t i_symbol) mutable {
-    span<cf_t> noise_samples = noise_samples_buffer.get_slice(0);
-    for (unsigned i_layer = start_layer; i_layer != stop_layer; ++i_layer) {
-      unsigned i_helper = i_layer - start_layer;
-
-      // Select temporary buffer for the pilot symbols and channel estimates product.
-      span<cf_t> predicted_obs = predicted_obs_buffer.get_slice(0);
-
-      // Skip intermediate buffer for the first process layer.
-      if (i_layer == start_layer) {
-        predicted_obs = noise_samples;
-      }
-
-      // Get original symbol pilots.
-      span<const cf_t> symbol_pilots = pilots.get_symbol(hop_offset + i_dmrs, i_layer);
-
-      // Apply estimated channel response to the original symbol pilots.
-      ocuduvec::prod(predicted_obs, scaled_estimates.get_slice(i_helper), symbol_pilots);
+    span<cf_t> symbol_noise_samples = noise_samples.subspan(i_dmrs * nof_re, nof_re);
 
-      // Compensate for CFO only if present.
-      if (compensate_cfo && cfo.has_value()) {
-        ocuduvec::sc_prod(
-            predicted_obs, predicted_obs, std::polar(1.0F, TWOPI * symbol_start_epochs[i_symbol] * cfo.value()));
-      }
-
-      // Skip addition if the intermediate buffer is skipped.
-      if (predicted_obs.data() != noise_samples.data()) {
-        ocuduvec::add(noise_samples, predicted_obs, noise_samples);
-      }
+    // Get original symbol pilots.
+    std::array<span<const cf_t>, max_layers> symbol_pilots = {};
+    for (unsigned i_layer = start_layer; i_layer != stop_layer; ++i_layer) {
+      symbol_pilots[i_layer - start_layer] = pilots.get_symbol(hop_offset + i_dmrs, i_layer);
     }
 
-    // Estimate receiver error as the difference between the received pilots and the regenerated ones.
-    unsigned         i_cdm            = start_layer / 2;
-    span<const cf_t> symbol_rx_pilots = rx_pilots.get_symbol(i_dmrs, i_cdm);
-    ocuduvec::subtract(noise_samples, symbol_rx_pilots, noise_samples);
+    // CFO to apply to the regenerated pilots.
+    cf_t phase = rotate ? std::polar(1.0F, TWOPI * symbol_start_epochs[i_symbol] * cfo.value()) : cf_t(1.0F);
 
-    // Accumulate received power.
-    noise_energy += ocuduvec::average_power(noise_samples) * noise_samples.size();
+    // Estimate receiver error as the difference between the received pilots and the regenerated ones, and accumulate
+    // its energy.
+    unsigned i_cdm = start_layer / 2;
+    noise_energy += estimate_noise_symbol_kernel(
+        symbol_noise_samples, rx_pilots.get_symbol(i_dmrs, i_cdm), cdm_estimates, symbol_pilots, phase);
     ++i_dmrs;
   };
 
@@ -866,33 +861,3 @@ static float estimate_noise(const dmrs_symbol_list&                   pilots,
   // Return 0 if the resultant noise is NaN or infinity.
   return std::isnormal(noise_energy) ? noise_energy : 0;
 }
-
-__attribute_noinline__ static void
-simd_vector_interpolate(span<cbf16_t> out, span<const cf_t> first, span<const cf_t> second, float weight)
-{
-  unsigned size = out.size();
-  ocudu_assert(size == first.size(), "Invalid size.");
-  ocudu_assert(size == second.size(), "Invalid size.");
-
-  unsigned i = 0;
-#if OCUDU_SIMD_CF_SIZE
-  for (unsigned end = (size / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i != end; i += OCUDU_SIMD_CF_SIZE) {
-    // Load inputs.
-    simd_f_t first_0  = ocudu_simd_f_loadu(reinterpret_cast<const float*>(&first[i]));
-    simd_f_t first_1  = ocudu_simd_f_loadu(reinterpret_cast<const float*>(&first[i + OCUDU_SIMD_CF_SIZE / 2]));
-    simd_f_t second_0 = ocudu_simd_f_loadu(reinterpret_cast<const float*>(&second[i]));
-    simd_f_t second_1 = ocudu_simd_f_loadu(reinterpret_cast<const float*>(&second[i + OCUDU_SIMD_CF_SIZE / 2]));
-
-    // Calculate result.
-    simd_f_t result_0 = ocudu_simd_f_fma(first_0, ocudu_simd_f_sub(second_0, first_0), ocudu_simd_f_set1(weight));
-    simd_f_t result_1 = ocudu_simd_f_fma(first_1, ocudu_simd_f_sub(second_1, first_1), ocudu_simd_f_set1(weight));
-
-    // Store result.
-    ocudu_simd_bf16_storeu(reinterpret_cast<bf16_t*>(&out[i]), result_0, result_1);
-  }
-#endif // OCUDU_SIMD_CF_SIZE
-
-  for (; i != size; ++i) {
-    out[i] = to_cbf16(first[i] + (second[i] - first[i]) * weight);
-  }
-}
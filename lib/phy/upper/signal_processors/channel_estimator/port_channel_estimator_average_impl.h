@@ -43,6 +43,9 @@ public:
   /// Maximum number of OFDM symbols that contain DM-RS in a transmission.
   static constexpr unsigned MAX_NOF_DMRS_SYMBOLS = pusch_constants::MAX_NOF_DMRS_SYMBOLS;
 
+  /// Maximum number of noise samples, that is, one per pilot and CDM group.
+  static constexpr unsigned MAX_NOF_NOISE_SAMPLES = MAX_NOF_SUBCARRIERS * MAX_NOF_DMRS_SYMBOLS * (MAX_LAYERS / 2);
+
   /// Constructor - Sets the internal interpolator and inverse DFT processor of size \c DFT_SIZE.
   port_channel_estimator_average_impl(std::unique_ptr<interpolator>                    interp,
                                       std::unique_ptr<time_alignment_estimator>        ta_estimator_,
@@ -57,6 +60,7 @@ public:
   {
     ocudu_assert(freq_interpolator, "Invalid interpolator.");
     ocudu_assert(ta_estimator, "Invalid TA estimator.");
+    noise_samples.reserve(MAX_NOF_NOISE_SAMPLES);
   }
 
   // See the port_channel_estimator interface for documentation.
@@ -89,6 +93,9 @@ private:
   // See the port_channel_estimator_results interface for documentation.
   float get_snr() const override { return snr_linear; }
 
+  // See the port_channel_estimator_results interface for documentation.
+  span<const cf_t> get_noise_samples() const override { return noise_samples; }
+
   // See the port_channel_estimator_results interface for documentation.
   float get_rsrp(unsigned tx_layer) const override
   {
@@ -166,13 +173,15 @@ private:
   /// \param[in]  hop_last_symbol     Last symbol index for the hop within the slot.
   /// \param[in]  i_symbol            OFDM symbol index within the slot to calculate.
   /// \param[in]  i_layer             Transmission layer.
+  /// \param[in]  cfo_phase           CFO phase to apply to the estimated channel, if any.
   void apply_td_domain_strategy(span<cbf16_t>                     estimated_rg,
                                 const symbol_slot_mask&           dmrs_mask,
                                 const re_measurement<const cf_t>& freq_response_dmrs,
                                 unsigned                          hop_first_symbol,
                                 unsigned                          hop_last_symbol,
                                 unsigned                          i_symbol,
-                                unsigned                          i_layer) const;
+                                unsigned                          i_layer,
+                                std::optional<cf_t>               cfo_phase) const;
 
   /// Frequency domain smoothing strategy.
   port_channel_estimator_fd_smoothing_strategy fd_smoothing_strategy;
@@ -229,6 +238,9 @@ private:
   /// Estimated noise variance (single layer).
   float noise_var = 0;
 
+  /// Noise samples, i.e., the difference between the regenerated DM-RS pilots and the received ones.
+  std::vector<cf_t> noise_samples;
+
   /// Estimated SNR (linear scale).
   float snr_linear = 0;
 
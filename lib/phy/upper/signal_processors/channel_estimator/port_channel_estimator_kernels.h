@@ -0,0 +1,352 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Port channel estimator processing kernels.
+///
+/// The kernels fuse the element-wise operations the port channel estimator applies to each OFDM symbol carrying DM-RS.
+/// They are specialized at compile time for the number of layers sharing a CDM group, for the time-domain strategy and
+/// for the CFO compensation, so that the inner loops are free of branches. The estimator selects the specializations
+/// once per transmission through the \c select_*_kernel functions.
+
+#pragma once
+
+#include "ocudu/adt/complex.h"
+#include "ocudu/adt/span.h"
+#include "ocudu/ocuduvec/simd.h"
+#include "ocudu/support/ocudu_assert.h"
+#include <array>
+#include <numeric>
+
+namespace ocudu {
+namespace port_channel_estimator_kernels {
+
+/// Maximum number of layers sharing the same DM-RS resources, i.e., the number of layers in a CDM group.
+static constexpr unsigned MAX_CDM_LAYERS = 2;
+
+#if OCUDU_SIMD_CF_SIZE
+/// Adds up the elements of a SIMD register of complex values.
+inline cf_t simd_cf_reduce(simd_cf_t value)
+{
+  alignas(SIMD_BYTE_ALIGN) std::array<float, OCUDU_SIMD_CF_SIZE> re;
+  alignas(SIMD_BYTE_ALIGN) std::array<float, OCUDU_SIMD_CF_SIZE> im;
+  ocudu_simd_cf_store(re.data(), im.data(), value);
+  return {std::accumulate(re.begin(), re.end(), 0.0F), std::accumulate(im.begin(), im.end(), 0.0F)};
+}
+#endif // OCUDU_SIMD_CF_SIZE
+
+/// \brief Matches received and transmitted pilots and correlates the result with a reference.
+///
+/// Computes \f$\textup{lse}_i = r_i p_i^*\f$ for all pilots and returns \f$\sum_i \textup{lse}_i \textup{ref}_i^*\f$.
+/// \param[out] lse       Matched pilots.
+/// \param[in]  rx_pilots Received pilots.
+/// \param[in]  tx_pilots Transmitted pilots.
+/// \param[in]  reference Correlation reference, typically the matched pilots of a previous OFDM symbol.
+/// \return The correlation between the matched pilots and the reference.
+inline cf_t match_and_correlate(span<cf_t>       lse,
+                                span<const cf_t> rx_pilots,
+                                span<const cf_t> tx_pilots,
+                                span<const cf_t> reference)
+{
+  unsigned nof_pilots = lse.size();
+  ocudu_assert(rx_pilots.size() == nof_pilots, "Invalid number of received pilots.");
+  ocudu_assert(tx_pilots.size() == nof_pilots, "Invalid number of transmitted pilots.");
+  ocudu_assert(reference.size() == nof_pilots, "Invalid reference size.");
+
+  cf_t     result  = 0;
+  unsigned i_pilot = 0;
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t simd_result = ocudu_simd_cf_zero();
+  for (unsigned end = (nof_pilots / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_pilot != end;
+       i_pilot += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t simd_lse = ocudu_simd_cf_conjprod(ocudu_simd_cfi_loadu(&rx_pilots[i_pilot]),
+                                                ocudu_simd_cfi_loadu(&tx_pilots[i_pilot]));
+    ocudu_simd_cfi_storeu(&lse[i_pilot], simd_lse);
+    simd_result += ocudu_simd_cf_conjprod(simd_lse, ocudu_simd_cfi_loadu(&reference[i_pilot]));
+  }
+  result = simd_cf_reduce(simd_result);
+#endif // OCUDU_SIMD_CF_SIZE
+
+  for (; i_pilot != nof_pilots; ++i_pilot) {
+    lse[i_pilot] = rx_pilots[i_pilot] * std::conj(tx_pilots[i_pilot]);
+    result += lse[i_pilot] * std::conj(reference[i_pilot]);
+  }
+
+  return result;
+}
+
+/// \brief Matches received and transmitted pilots of one OFDM symbol and, optionally, compensates the CFO.
+///
+/// Computes \f$\textup{lse}_i = r_i p_i^* e^{j\phi}\f$ if \c Accumulate is false, or
+/// \f$\textup{lse}_i \mathrel{+}= r_i p_i^* e^{j\phi}\f$ otherwise.
+/// \tparam Accumulate Set to \c true to add the matched pilots to \c lse instead of overwriting it.
+/// \tparam Rotate     Set to \c true to apply the CFO compensation phase.
+/// \param[in,out] lse       Matched pilots, or pilot accumulator.
+/// \param[in]     rx_pilots Received pilots.
+/// \param[in]     tx_pilots Transmitted pilots.
+/// \param[in]     phase     CFO compensation phase \f$e^{j\phi}\f$, ignored if \c Rotate is false.
+template <bool Accumulate, bool Rotate>
+void match_pilots(span<cf_t> lse, span<const cf_t> rx_pilots, span<const cf_t> tx_pilots, cf_t phase)
+{
+  unsigned nof_pilots = lse.size();
+  ocudu_assert(rx_pilots.size() == nof_pilots, "Invalid number of received pilots.");
+  ocudu_assert(tx_pilots.size() == nof_pilots, "Invalid number of transmitted pilots.");
+
+  unsigned i_pilot = 0;
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t simd_phase = ocudu_simd_cf_set1(phase);
+  for (unsigned end = (nof_pilots / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_pilot != end;
+       i_pilot += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t simd_lse = ocudu_simd_cf_conjprod(ocudu_simd_cfi_loadu(&rx_pilots[i_pilot]),
+                                                ocudu_simd_cfi_loadu(&tx_pilots[i_pilot]));
+    if constexpr (Rotate) {
+      simd_lse = ocudu_simd_cf_prod(simd_lse, simd_phase);
+    }
+    if constexpr (Accumulate) {
+      simd_lse += ocudu_simd_cfi_loadu(&lse[i_pilot]);
+    }
+    ocudu_simd_cfi_storeu(&lse[i_pilot], simd_lse);
+  }
+#endif // OCUDU_SIMD_CF_SIZE
+
+  for (; i_pilot != nof_pilots; ++i_pilot) {
+    cf_t value = rx_pilots[i_pilot] * std::conj(tx_pilots[i_pilot]);
+    if constexpr (Rotate) {
+      value *= phase;
+    }
+    if constexpr (Accumulate) {
+      value += lse[i_pilot];
+    }
+    lse[i_pilot] = value;
+  }
+}
+
+/// \brief Compensates the CFO of the matched pilots of the first two OFDM symbols carrying DM-RS and, optionally,
+/// combines them.
+///
+/// Computes \f$\textup{first}_i = \textup{first}_i e^{j\phi_0} + \textup{second}_i e^{j\phi_1}\f$ if \c Accumulate is
+/// true. Otherwise, the two symbols are rotated in place and kept separated.
+/// \tparam Accumulate Set to \c true to combine the second OFDM symbol into the first one.
+/// \tparam Rotate     Set to \c true to apply the CFO compensation phases.
+/// \param[in,out] first  Matched pilots of the first OFDM symbol carrying DM-RS.
+/// \param[in,out] second Matched pilots of the second OFDM symbol carrying DM-RS.
+/// \param[in]     phase0 CFO compensation phase of the first OFDM symbol, ignored if \c Rotate is false.
+/// \param[in]     phase1 CFO compensation phase of the second OFDM symbol, ignored if \c Rotate is false.
+template <bool Accumulate, bool Rotate>
+void combine_first_pilots(span<cf_t> first, span<cf_t> second, cf_t phase0, cf_t phase1)
+{
+  unsigned nof_pilots = first.size();
+  ocudu_assert(second.size() == nof_pilots, "Invalid number of pilots.");
+
+  if constexpr (!Accumulate && !Rotate) {
+    return;
+  }
+
+  unsigned i_pilot = 0;
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t simd_phase0 = ocudu_simd_cf_set1(phase0);
+  simd_cf_t simd_phase1 = ocudu_simd_cf_set1(phase1);
+  for (unsigned end = (nof_pilots / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_pilot != end;
+       i_pilot += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t simd_first  = ocudu_simd_cfi_loadu(&first[i_pilot]);
+    simd_cf_t simd_second = ocudu_simd_cfi_loadu(&second[i_pilot]);
+    if constexpr (Rotate) {
+      simd_first  = ocudu_simd_cf_prod(simd_first, simd_phase0);
+      simd_second = ocudu_simd_cf_prod(simd_second, simd_phase1);
+    }
+    if constexpr (Accumulate) {
+      ocudu_simd_cfi_storeu(&first[i_pilot], simd_first + simd_second);
+    } else {
+      ocudu_simd_cfi_storeu(&first[i_pilot], simd_first);
+      ocudu_simd_cfi_storeu(&second[i_pilot], simd_second);
+    }
+  }
+#endif // OCUDU_SIMD_CF_SIZE
+
+  for (; i_pilot != nof_pilots; ++i_pilot) {
+    if constexpr (Rotate) {
+      first[i_pilot] *= phase0;
+      second[i_pilot] *= phase1;
+    }
+    if constexpr (Accumulate) {
+      first[i_pilot] += second[i_pilot];
+    }
+  }
+}
+
+/// \brief Estimates the noise samples of one OFDM symbol carrying DM-RS and returns their energy.
+///
+/// Regenerates the received pilots from the channel estimates of the layers in a CDM group and subtracts them from the
+/// actual received pilots, that is \f$n_i = r_i - e^{j\phi} \sum_l h_{l,i} p_{l,i}\f$.
+/// \tparam NofLayers Number of layers in the CDM group, either one or two.
+/// \tparam Rotate    Set to \c true to apply the CFO phase to the regenerated pilots.
+/// \param[out] noise     Noise samples.
+/// \param[in]  rx_pilots Received pilots.
+/// \param[in]  estimates Channel estimates of each layer of the CDM group. Only the first \c NofLayers are used.
+/// \param[in]  tx_pilots Transmitted pilots of each layer of the CDM group. Only the first \c NofLayers are used.
+/// \param[in]  phase     CFO phase \f$e^{j\phi}\f$, ignored if \c Rotate is false.
+/// \return The energy of the noise samples.
+template <unsigned NofLayers, bool Rotate>
+float estimate_noise_symbol(span<cf_t>                                         noise,
+                            span<const cf_t>                                   rx_pilots,
+                            const std::array<span<const cf_t>, MAX_CDM_LAYERS>& estimates,
+                            const std::array<span<const cf_t>, MAX_CDM_LAYERS>& tx_pilots,
+                            cf_t                                               phase)
+{
+  static_assert((NofLayers > 0) && (NofLayers <= MAX_CDM_LAYERS), "Invalid number of layers.");
+
+  unsigned nof_pilots = noise.size();
+  ocudu_assert(rx_pilots.size() == nof_pilots, "Invalid number of received pilots.");
+  for (unsigned i_layer = 0; i_layer != NofLayers; ++i_layer) {
+    ocudu_assert(estimates[i_layer].size() == nof_pilots, "Invalid number of channel estimates.");
+    ocudu_assert(tx_pilots[i_layer].size() == nof_pilots, "Invalid number of transmitted pilots.");
+  }
+
+  float    energy  = 0;
+  unsigned i_pilot = 0;
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t simd_phase  = ocudu_simd_cf_set1(phase);
+  simd_f_t  simd_energy = ocudu_simd_f_zero();
+  for (unsigned end = (nof_pilots / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_pilot != end;
+       i_pilot += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t simd_predicted = ocudu_simd_cf_prod(ocudu_simd_cfi_loadu(&estimates[0][i_pilot]),
+                                                  ocudu_simd_cfi_loadu(&tx_pilots[0][i_pilot]));
+    if constexpr (NofLayers == 2) {
+      simd_predicted += ocudu_simd_cf_prod(ocudu_simd_cfi_loadu(&estimates[1][i_pilot]),
+                                           ocudu_simd_cfi_loadu(&tx_pilots[1][i_pilot]));
+    }
+    if constexpr (Rotate) {
+      simd_predicted = ocudu_simd_cf_prod(simd_predicted, simd_phase);
+    }
+    simd_cf_t simd_noise = ocudu_simd_cfi_loadu(&rx_pilots[i_pilot]) - simd_predicted;
+    ocudu_simd_cfi_storeu(&noise[i_pilot], simd_noise);
+    simd_energy = ocudu_simd_f_add(ocudu_simd_cf_norm_sq(simd_noise), simd_energy);
+  }
+
+  alignas(SIMD_BYTE_ALIGN) std::array<float, OCUDU_SIMD_F_SIZE> simd_energy_sum;
+  ocudu_simd_f_store(simd_energy_sum.data(), simd_energy);
+  energy = std::accumulate(simd_energy_sum.begin(), simd_energy_sum.end(), 0.0F);
+#endif // OCUDU_SIMD_CF_SIZE
+
+  for (; i_pilot != nof_pilots; ++i_pilot) {
+    cf_t predicted = estimates[0][i_pilot] * tx_pilots[0][i_pilot];
+    if constexpr (NofLayers == 2) {
+      predicted += estimates[1][i_pilot] * tx_pilots[1][i_pilot];
+    }
+    if constexpr (Rotate) {
+      predicted *= phase;
+    }
+    noise[i_pilot] = rx_pilots[i_pilot] - predicted;
+    energy += std::norm(noise[i_pilot]);
+  }
+
+  return energy;
+}
+
+/// \brief Interpolates the channel estimates of an OFDM symbol in time domain and, optionally, applies the CFO.
+///
+/// Computes \f$y_i = (x^{(0)}_i + w (x^{(1)}_i - x^{(0)}_i)) e^{j\phi}\f$, with \f$x^{(0)}\f$ and \f$x^{(1)}\f$ the
+/// channel estimates of the OFDM symbols carrying DM-RS that surround the current one.
+/// \tparam Interpolate Set to \c false to copy \c first, in which case \c second and \c weight are ignored.
+/// \tparam Rotate      Set to \c true to apply the CFO phase.
+/// \param[out] out    Channel estimates of the OFDM symbol.
+/// \param[in]  first  Channel estimates of the first OFDM symbol carrying DM-RS.
+/// \param[in]  second Channel estimates of the second OFDM symbol carrying DM-RS.
+/// \param[in]  weight Interpolation weight.
+/// \param[in]  phase  CFO phase \f$e^{j\phi}\f$, ignored if \c Rotate is false.
+template <bool Interpolate, bool Rotate>
+void interpolate_symbol(span<cbf16_t> out, span<const cf_t> first, span<const cf_t> second, float weight, cf_t phase)
+{
+  unsigned nof_re = out.size();
+  ocudu_assert(first.size() == nof_re, "Invalid size.");
+  ocudu_assert(!Interpolate || (second.size() == nof_re), "Invalid size.");
+
+  unsigned i_re = 0;
+#if OCUDU_SIMD_CF_SIZE
+  simd_cf_t simd_phase = ocudu_simd_cf_set1(phase);
+  for (unsigned end = (nof_re / OCUDU_SIMD_CF_SIZE) * OCUDU_SIMD_CF_SIZE; i_re != end; i_re += OCUDU_SIMD_CF_SIZE) {
+    simd_cf_t simd_value = ocudu_simd_cfi_loadu(&first[i_re]);
+    if constexpr (Interpolate) {
+      simd_value += (ocudu_simd_cfi_loadu(&second[i_re]) - simd_value) * weight;
+    }
+    if constexpr (Rotate) {
+      simd_value = ocudu_simd_cf_prod(simd_value, simd_phase);
+    }
+    ocudu_simd_cbf16_storeu(&out[i_re], simd_value);
+  }
+#endif // OCUDU_SIMD_CF_SIZE
+
+  for (; i_re != nof_re; ++i_re) {
+    cf_t value = first[i_re];
+    if constexpr (Interpolate) {
+      value += (second[i_re] - value) * weight;
+    }
+    if constexpr (Rotate) {
+      value *= phase;
+    }
+    out[i_re] = to_cbf16(value);
+  }
+}
+
+/// Pilot matching kernel signature, see \ref match_pilots.
+using match_pilots_kernel = void (*)(span<cf_t>, span<const cf_t>, span<const cf_t>, cf_t);
+
+/// First pilots combining kernel signature, see \ref combine_first_pilots.
+using combine_first_pilots_kernel = void (*)(span<cf_t>, span<cf_t>, cf_t, cf_t);
+
+/// Noise estimation kernel signature, see \ref estimate_noise_symbol.
+using estimate_noise_symbol_kernel = float (*)(span<cf_t>,
+                                               span<const cf_t>,
+                                               const std::array<span<const cf_t>, MAX_CDM_LAYERS>&,
+                                               const std::array<span<const cf_t>, MAX_CDM_LAYERS>&,
+                                               cf_t);
+
+/// Time-domain interpolation kernel signature, see \ref interpolate_symbol.
+using interpolate_symbol_kernel = void (*)(span<cbf16_t>, span<const cf_t>, span<const cf_t>, float, cf_t);
+
+/// Selects the pilot matching kernel specialization.
+inline match_pilots_kernel select_match_pilots_kernel(bool accumulate, bool rotate)
+{
+  if (accumulate) {
+    return rotate ? match_pilots<true, true> : match_pilots<true, false>;
+  }
+  return rotate ? match_pilots<false, true> : match_pilots<false, false>;
+}
+
+/// Selects the first pilots combining kernel specialization.
+inline combine_first_pilots_kernel select_combine_first_pilots_kernel(bool accumulate, bool rotate)
+{
+  if (accumulate) {
+    return rotate ? combine_first_pilots<true, true> : combine_first_pilots<true, false>;
+  }
+  return rotate ? combine_first_pilots<false, true> : combine_first_pilots<false, false>;
+}
+
+/// Selects the noise estimation kernel specialization.
+inline estimate_noise_symbol_kernel select_estimate_noise_symbol_kernel(unsigned nof_layers, bool rotate)
+{
+  ocudu_assert((nof_layers > 0) && (nof_layers <= MAX_CDM_LAYERS), "Invalid number of layers {}.", nof_layers);
+  if (nof_layers == 2) {
+    return rotate ? estimate_noise_symbol<2, true> : estimate_noise_symbol<2, false>;
+  }
+  return rotate ? estimate_noise_symbol<1, true> : estimate_noise_symbol<1, false>;
+}
+
+/// Selects the time-domain interpolation kernel specialization.
+inline interpolate_symbol_kernel select_interpolate_symbol_kernel(bool interpolate, bool rotate)
+{
+  if (interpolate) {
+    return rotate ? interpolate_symbol<true, true> : interpolate_symbol<true, false>;
+  }
+  return rotate ? interpolate_symbol<false, true> : interpolate_symbol<false, false>;
+}
+
+} // namespace port_channel_estimator_kernels
+} // namespace ocudu
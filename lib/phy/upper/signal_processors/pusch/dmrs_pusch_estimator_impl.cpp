@@ -11,6 +11,7 @@
 #include "dmrs_pusch_estimator_impl.h"
 #include "../dmrs_helper.h"
 #include "ocudu/ocuduvec/copy.h"
+#include "ocudu/ocuduvec/dot_prod.h"
 #include "ocudu/ocuduvec/sc_prod.h"
 #include "ocudu/phy/upper/channel_estimation.h"
 
@@ -235,6 +236,34 @@ float dmrs_pusch_estimator_impl::get_noise_variance(unsigned rx_port) const
   return ch_est_result[rx_port]->get_noise_variance();
 }
 
+void dmrs_pusch_estimator_impl::get_noise_covariance(span<cf_t> covariance) const
+{
+  unsigned nof_ports = ch_est_result.size();
+  ocudu_assert(covariance.size() == nof_ports * nof_ports,
+               "The covariance matrix size (i.e., {}) is not consistent with the number of ports (i.e., {}).",
+               covariance.size(),
+               nof_ports);
+
+  for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
+    ocudu_assert(ch_est_result[i_port], "Invalid channel estimator results for port {}.", i_port);
+    covariance[i_port * nof_ports + i_port] = ch_est_result[i_port]->get_noise_variance();
+
+    span<const cf_t> noise_samples = ch_est_result[i_port]->get_noise_samples();
+
+    // Same normalization as the noise variance estimation.
+    float norm_factor = 1.0F / static_cast<float>(std::max(noise_samples.size(), size_t(2)) - 1);
+
+    // The covariance matrix is Hermitian, only the upper triangle is computed.
+    for (unsigned j_port = i_port + 1; j_port != nof_ports; ++j_port) {
+      ocudu_assert(ch_est_result[j_port], "Invalid channel estimator results for port {}.", j_port);
+      cf_t cross_covariance = ocuduvec::dot_prod(noise_samples, ch_est_result[j_port]->get_noise_samples());
+      cross_covariance *= norm_factor;
+      covariance[i_port * nof_ports + j_port] = cross_covariance;
+      covariance[j_port * nof_ports + i_port] = std::conj(cross_covariance);
+    }
+  }
+}
+
 float dmrs_pusch_estimator_impl::get_epre(unsigned rx_port) const
 {
   ocudu_assert(ch_est_result[rx_port], "Invalid channel estimator results for port {}.", rx_port);
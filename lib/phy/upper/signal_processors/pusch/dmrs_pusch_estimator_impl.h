@@ -83,6 +83,9 @@ private:
   // See the dmrs_pusch_estimator_results interface for the documentation.
   float get_noise_variance(unsigned rx_port) const override;
 
+  // See the dmrs_pusch_estimator_results interface for the documentation.
+  void get_noise_covariance(span<cf_t> covariance) const override;
+
   // See the dmrs_pusch_estimator_results interface for the documentation.
   float get_rsrp(unsigned rx_port, unsigned tx_layer = 0) const override;
 
@@ -27,11 +27,19 @@ class uplink_pdu_slot_repository_impl : public unique_uplink_pdu_slot_repository
                                         private shared_resource_grid::pool_interface
 {
 public:
-  /// Creates an uplink PDU slot repository.
+  /// \brief Creates an uplink PDU slot repository.
+  /// \param[in] grid_                    Resource grid associated to the uplink slot.
+  /// \param[in] grid_ref_counter_        Resource grid reference counter.
+  /// \param[in] fsm_                     Uplink processor finite-state machine notifier.
+  /// \param[in] enable_pusch_pipelining_ Set to true for processing PUSCH transmissions from their last DM-RS symbol.
   uplink_pdu_slot_repository_impl(resource_grid&                 grid_,
                                   std::atomic<unsigned>&         grid_ref_counter_,
-                                  uplink_processor_fsm_notifier& fsm_) :
-    grid(grid_), grid_ref_counter(grid_ref_counter_), fsm_notifier(fsm_)
+                                  uplink_processor_fsm_notifier& fsm_,
+                                  bool                           enable_pusch_pipelining_) :
+    grid(grid_),
+    grid_ref_counter(grid_ref_counter_),
+    fsm_notifier(fsm_),
+    enable_pusch_pipelining(enable_pusch_pipelining_)
   {
   }
 
@@ -46,6 +54,21 @@ public:
     };
   }
 
+  /// PUCCH Format 0 aggregated configuration.
+  struct pucch_f0_collection {
+    /// Pairs the reception context with the UE dedicated parameters.
+    struct ue_entry {
+      /// UE reception context.
+      ul_pucch_context context;
+      /// Transmission initial cyclic shift.
+      unsigned initial_cyclic_shift;
+    };
+    /// Common configuration.
+    pucch_processor::format0_batch_configuration config;
+    /// UE common configurations.
+    static_vector<ue_entry, MAX_PUCCH_PDUS_PER_SLOT> ue_contexts;
+  };
+
   /// PUCCH Format 1 aggregated configuration.
   struct pucch_f1_collection {
     /// Pairs the reception context with the UE dedicated parameters.
@@ -67,6 +90,11 @@ public:
   void add_pusch_pdu(const pusch_pdu& pdu) override
   {
     unsigned end_symbol_index = pdu.pdu.start_symbol_index + pdu.pdu.nof_symbols - 1;
+
+    // With pipelining, the PUSCH processing starts as soon as the last OFDM symbol carrying DM-RS is received.
+    if (enable_pusch_pipelining) {
+      end_symbol_index = static_cast<unsigned>(pdu.pdu.dmrs_symbol_mask.find_highest());
+    }
     ocudu_assert(end_symbol_index < MAX_NSYMB_PER_SLOT, "Invalid end symbol index {}.", end_symbol_index);
 
     pusch_repository[end_symbol_index].push_back(pdu);
@@ -84,6 +112,11 @@ public:
     unsigned end_symbol_index = fetch_end_symbol_index(pdu);
     ocudu_assert(end_symbol_index < MAX_NSYMB_PER_SLOT, "Invalid end symbol index {}.", end_symbol_index);
 
+    if (std::holds_alternative<pucch_processor::format0_configuration>(pdu.config)) {
+      add_pucch_f0_pdu(pdu, end_symbol_index);
+      return;
+    }
+
     if (!std::holds_alternative<pucch_processor::format1_configuration>(pdu.config)) {
       pucch_repository[end_symbol_index].push_back(pdu);
       fsm_notifier.increment_pending_pdu_count();
@@ -143,6 +176,9 @@ public:
     for (auto& entry : pucch_repository) {
       entry.clear();
     }
+    for (auto& entry : pucch_f0_repository) {
+      entry.clear();
+    }
     for (auto& entry : pucch_f1_repository) {
       entry.clear();
     }
@@ -162,7 +198,9 @@ public:
     return {*this, grid_ref_counter};
   }
 
-  /// Returns a span that contains the PUSCH PDUs for the given slot and symbol index.
+  /// \brief Returns a span that contains the PUSCH PDUs for the given slot and symbol index.
+  ///
+  /// With PUSCH pipelining, the PDUs are indexed by their last OFDM symbol carrying DM-RS instead.
   span<const pusch_pdu> get_pusch_pdus(unsigned end_symbol_index) const
   {
     ocudu_assert(end_symbol_index < MAX_NSYMB_PER_SLOT, "Invalid end symbol index {}.", end_symbol_index);
@@ -176,6 +214,13 @@ public:
     return pucch_repository[end_symbol_index];
   }
 
+  /// Returns a span that contains the PUCCH Format 0 collections for the given slot and symbol index.
+  span<const pucch_f0_collection> get_pucch_f0_repository(unsigned end_symbol_index) const
+  {
+    ocudu_assert(end_symbol_index < MAX_NSYMB_PER_SLOT, "Invalid end symbol index {}.", end_symbol_index);
+    return pucch_f0_repository[end_symbol_index];
+  }
+
   /// Returns a span that contains the PUCCH PDUs for the given slot and symbol index.
   span<const pucch_f1_collection> get_pucch_f1_repository(unsigned end_symbol_index) const
   {
@@ -191,6 +236,50 @@ public:
   }
 
 private:
+  /// \brief Adds a PUCCH Format 0 PDU to the collection that shares its time and frequency allocation.
+  ///
+  /// The PDU is queued individually if its initial cyclic shift is already in use within the collection.
+  void add_pucch_f0_pdu(const pucch_pdu& pdu, unsigned end_symbol_index)
+  {
+    const auto&                                   config = std::get<pucch_processor::format0_configuration>(pdu.config);
+    pucch_processor::format0_common_configuration common_config(config);
+    pucch_f0_collection::ue_entry                 ue_entry = {.context              = pdu.context,
+                                                              .initial_cyclic_shift = config.initial_cyclic_shift};
+
+    // Select Format 0 PUCCH configuration collection.
+    span<pucch_f0_collection> f0_collections = pucch_f0_repository[end_symbol_index];
+
+    // Find a compatible Format 0 common configuration.
+    auto* it =
+        std::find_if(f0_collections.begin(), f0_collections.end(), [&common_config](const pucch_f0_collection& entry) {
+          return common_config == entry.config.common_config;
+        });
+
+    // If the common configuration was found.
+    if (it != f0_collections.end()) {
+      // Transmissions with the same initial cyclic shift cannot be told apart, process the new one on its own.
+      if (it->config.entries.contains(config.initial_cyclic_shift)) {
+        pucch_repository[end_symbol_index].push_back(pdu);
+        fsm_notifier.increment_pending_pdu_count();
+        return;
+      }
+
+      // Push back the UE dedicated entry in the existing collection.
+      it->config.entries.insert(
+          config.initial_cyclic_shift,
+          {.context = config.context, .nof_harq_ack = config.nof_harq_ack, .sr_opportunity = config.sr_opportunity});
+      it->ue_contexts.emplace_back(ue_entry);
+      return;
+    }
+
+    // If the common configuration is not yet in the list, push back a complete new collection.
+    pucch_f0_repository[end_symbol_index].emplace_back(
+        pucch_f0_collection{.config = pucch_processor::format0_batch_configuration(config), .ue_contexts = {ue_entry}});
+
+    // Only increment per collection.
+    fsm_notifier.increment_pending_pdu_count();
+  }
+
   // See the shared_resource_grid::pool_interface interface for documentation.
   resource_grid& get() override { return grid; }
 
@@ -201,6 +290,8 @@ private:
   std::array<static_vector<pusch_pdu, MAX_PUSCH_PDUS_PER_SLOT>, MAX_NSYMB_PER_SLOT> pusch_repository;
   /// Repository that contains PUCCH PDUs.
   std::array<static_vector<pucch_pdu, MAX_PUCCH_PDUS_PER_SLOT>, MAX_NSYMB_PER_SLOT> pucch_repository;
+  /// Repository that contains collections of PUCCH Format 0.
+  std::array<static_vector<pucch_f0_collection, MAX_PUCCH_PDUS_PER_SLOT>, MAX_NSYMB_PER_SLOT> pucch_f0_repository;
   /// Repository that contains collections of PUCCH Format 1.
   std::array<static_vector<pucch_f1_collection, MAX_PUCCH_PDUS_PER_SLOT>, MAX_NSYMB_PER_SLOT> pucch_f1_repository;
   /// Repository that contains SRS PDUs.
@@ -211,5 +302,7 @@ private:
   std::atomic<unsigned>& grid_ref_counter;
   /// Notifier for the uplink processor finite-state machine.
   uplink_processor_fsm_notifier& fsm_notifier;
+  /// Set to true for processing PUSCH transmissions from their last OFDM symbol carrying DM-RS.
+  bool enable_pusch_pipelining;
 };
 } // namespace ocudu
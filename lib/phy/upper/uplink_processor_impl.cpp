@@ -47,9 +47,11 @@ uplink_processor_impl::uplink_processor_impl(std::unique_ptr<prach_detector>  pr
                                              rx_buffer_pool&                  rm_buffer_pool_,
                                              upper_phy_rx_results_notifier&   notifier_,
                                              unsigned                         max_nof_prb,
-                                             unsigned                         max_nof_layers) :
+                                             unsigned                         max_nof_layers,
+                                             bool                             enable_pusch_pipelining_) :
   grid_ref_counter(get_grid_ref_counter()),
-  pdu_repository(*grid_, grid_ref_counter, state_machine),
+  pdu_repository(*grid_, grid_ref_counter, state_machine, enable_pusch_pipelining_),
+  enable_pusch_pipelining(enable_pusch_pipelining_),
   prach(std::move(prach_)),
   pusch_proc(std::move(pusch_proc_)),
   pucch_proc(std::move(pucch_proc_)),
@@ -81,6 +83,9 @@ uplink_slot_processor& uplink_processor_impl::get_slot_processor(slot_point slot
 
 void uplink_processor_impl::stop()
 {
+  // Release the PUSCH transmissions waiting for OFDM symbols that will not be received.
+  update_rx_symbol_progress(0, true);
+
   state_machine.stop();
 }
 
@@ -104,6 +109,7 @@ unique_uplink_pdu_slot_repository uplink_processor_impl::get_pdu_slot_repository
   current_slot = slot;
   count_pusch_adaptors.store(0, std::memory_order_release);
   nof_processed_symbols = 0;
+  rx_symbol_progress.store(0);
   rx_payload_pool.reset();
   pdu_repository.clear_queues();
 
@@ -156,6 +162,12 @@ void uplink_processor_impl::handle_rx_symbol(unsigned end_symbol_index, bool is_
         }
       }
 
+      for (const auto& collection : pdu_repository.get_pucch_f0_repository(i_symbol)) {
+        if (state_machine.on_create_pdu_task()) {
+          notify_discard_pucch(collection);
+        }
+      }
+
       for (const auto& collection : pdu_repository.get_pucch_f1_repository(i_symbol)) {
         if (state_machine.on_create_pdu_task()) {
           notify_discard_pucch(collection);
@@ -175,6 +187,9 @@ void uplink_processor_impl::handle_rx_symbol(unsigned end_symbol_index, bool is_
       }
     }
 
+    // Release the PUSCH transmissions waiting for the rest of the slot.
+    update_rx_symbol_progress(nof_processed_symbols, true);
+
     return;
   }
 
@@ -184,6 +199,33 @@ void uplink_processor_impl::handle_rx_symbol(unsigned end_symbol_index, bool is_
     // Process the PDUs belonging to the received symbols.
     process_symbol_pdus(nof_processed_symbols);
   }
+
+  // Resume the PUSCH transmissions waiting for the received symbols.
+  update_rx_symbol_progress(nof_processed_symbols, false);
+}
+
+void uplink_processor_impl::update_rx_symbol_progress(unsigned nof_rx_symbols, bool is_discarded)
+{
+  if (!enable_pusch_pipelining) {
+    return;
+  }
+
+  if (is_discarded) {
+    rx_symbol_progress.fetch_or(pusch_symbol_monitor::discarded_mask);
+  } else {
+    // Do not overwrite the progress if the slot was discarded concurrently.
+    unsigned current_progress = rx_symbol_progress.load();
+    while (((current_progress & pusch_symbol_monitor::discarded_mask) == 0) &&
+           !rx_symbol_progress.compare_exchange_weak(current_progress, nof_rx_symbols)) {
+    }
+  }
+
+  // Notify the PUSCH transmissions that requested it.
+  for (unsigned i_monitor = 0, nof_monitors = count_pusch_adaptors.load(std::memory_order_acquire);
+       i_monitor != nof_monitors;
+       ++i_monitor) {
+    pusch_symbol_monitors[i_monitor].notify();
+  }
 }
 
 void uplink_processor_impl::process_symbol_pdus(unsigned end_symbol_index)
@@ -191,12 +233,20 @@ void uplink_processor_impl::process_symbol_pdus(unsigned end_symbol_index)
   // Obtain all PDUs for the given end symbol index.
   span<const uplink_pdu_slot_repository::pusch_pdu> pusch_pdus = pdu_repository.get_pusch_pdus(end_symbol_index);
   span<const uplink_pdu_slot_repository::pucch_pdu> pucch_pdus = pdu_repository.get_pucch_pdus(end_symbol_index);
+  span<const uplink_pdu_slot_repository_impl::pucch_f0_collection> pucch_f0_pdus =
+      pdu_repository.get_pucch_f0_repository(end_symbol_index);
   span<const uplink_pdu_slot_repository_impl::pucch_f1_collection> pucch_f1_pdus =
       pdu_repository.get_pucch_f1_repository(end_symbol_index);
   span<const uplink_pdu_slot_repository::srs_pdu> srs_pdus = pdu_repository.get_srs_pdus(end_symbol_index);
 
   // If the phy tap is configured, send the UL symbols through the tap interface along with their associated PDUs.
   if (ul_tap) {
+    // Extract PUCCH Format 0 common PDU parameters.
+    static_vector<pucch_processor::format0_common_configuration, MAX_PUCCH_PDUS_PER_SLOT> pucch_f0_common_configs;
+    for (const auto& pucch_f0 : pucch_f0_pdus) {
+      pucch_f0_common_configs.push_back(pucch_f0.config.common_config);
+    }
+
     // Extract PUCCH Format 1 common PDU parameters.
     static_vector<pucch_processor::format1_common_configuration, MAX_PUCCH_PDUS_PER_SLOT> pucch_f1_common_configs;
     for (const auto& pucch_f1 : pucch_f1_pdus) {
@@ -210,6 +260,7 @@ void uplink_processor_impl::process_symbol_pdus(unsigned end_symbol_index)
                              nof_processed_symbols,
                              pusch_pdus,
                              pucch_pdus,
+                             pucch_f0_common_configs,
                              pucch_f1_common_configs,
                              srs_pdus);
   }
@@ -219,6 +270,10 @@ void uplink_processor_impl::process_symbol_pdus(unsigned end_symbol_index)
     process_pucch(pdu);
   }
 
+  for (const auto& collection : pucch_f0_pdus) {
+    process_pucch_f0(collection);
+  }
+
   for (const auto& collection : pucch_f1_pdus) {
     process_pucch_f1(collection);
   }
@@ -317,7 +372,16 @@ void uplink_processor_impl::process_pusch(const uplink_pdu_slot_repository::pusc
 
     trace_point tp = l1_ul_tracer.now();
 
-    pusch_proc->process(data, std::move(rm_buffer2), processor_notifier, grid->get_reader(), pdu.pdu);
+    if (enable_pusch_pipelining) {
+      // The PUSCH transmission was enqueued before the end of its allocation, it processes the rest of the OFDM
+      // symbols as they are received.
+      pusch_rx_symbol_monitor& symbol_monitor =
+          pusch_symbol_monitors[notifier_adaptor_id].configure(rx_symbol_progress, task_executors.pusch_executor);
+      pusch_proc->process(
+          data, std::move(rm_buffer2), processor_notifier, grid->get_reader(), symbol_monitor, pdu.pdu);
+    } else {
+      pusch_proc->process(data, std::move(rm_buffer2), processor_notifier, grid->get_reader(), pdu.pdu);
+    }
 
     l1_ul_tracer << trace_event("process_pusch", tp);
   });
@@ -343,6 +407,7 @@ void uplink_processor_impl::process_pucch(const uplink_pdu_slot_repository::pucc
     // Process the PUCCH.
     switch (pdu.context.format) {
       case pucch_format::FORMAT_0: {
+        // Only the transmissions that cannot be processed in a collection.
         const auto& format0 = std::get<pucch_processor::format0_configuration>(pdu.config);
         proc_result         = pucch_proc->process(grid->get_reader(), format0);
         l1_ul_tracer << trace_event("pucch0", tp);
@@ -387,6 +452,62 @@ void uplink_processor_impl::process_pucch(const uplink_pdu_slot_repository::pucc
   }
 }
 
+void uplink_processor_impl::process_pucch_f0(const uplink_pdu_slot_repository_impl::pucch_f0_collection& collection)
+{
+  // Notify the creation of the execution task.
+  if (!state_machine.on_create_pdu_task()) {
+    return;
+  }
+
+  bool success = task_executors.pucch_executor.defer([this, &collection]() {
+    trace_point tp = l1_ul_tracer.now();
+
+    // Process all PUCCH Format 0 in one go.
+    const pucch_format0_map<pucch_processor_result>& results =
+        pucch_proc->process(grid->get_reader(), collection.config);
+
+    // Iterate each UE context.
+    for (const auto& entry : collection.ue_contexts) {
+      // Result for the given initial cyclic shift is not available.
+      if (!results.contains(entry.initial_cyclic_shift)) {
+        logger.warning(collection.config.common_config.slot.sfn(),
+                       collection.config.common_config.slot.slot_index(),
+                       "Missing PUCCH F0 result for rnti={} and cs={}.",
+                       entry.context.rnti,
+                       entry.initial_cyclic_shift);
+
+        // Obtain number of HARQ-ACK.
+        unsigned nof_harq_ack = collection.config.entries[entry.initial_cyclic_shift].nof_harq_ack;
+
+        // Report control-related discarded result if HARQ-ACK feedback is present.
+        if (nof_harq_ack > 0) {
+          ul_pucch_results discarded_results = ul_pucch_results::create_discarded(entry.context, nof_harq_ack);
+          notifier.on_new_pucch_results(discarded_results);
+        }
+        continue;
+      }
+
+      // Write the results.
+      ul_pucch_results notifier_result;
+      notifier_result.context          = entry.context;
+      notifier_result.processor_result = results[entry.initial_cyclic_shift];
+
+      // Notify the PUCCH results.
+      notifier.on_new_pucch_results(notifier_result);
+    }
+    l1_ul_tracer << trace_event("pucch0", tp);
+    state_machine.on_finish_processing_pdu();
+  });
+
+  // Notify the discarded transmissions if the executor failed.
+  if (!success) {
+    logger.warning(collection.config.common_config.slot.sfn(),
+                   collection.config.common_config.slot.slot_index(),
+                   "Failed to execute PUCCH. Ignoring processing.");
+    notify_discard_pucch(collection);
+  }
+}
+
 void uplink_processor_impl::process_pucch_f1(const uplink_pdu_slot_repository_impl::pucch_f1_collection& collection)
 {
   // Notify the creation of the execution task.
@@ -504,6 +625,22 @@ void uplink_processor_impl::notify_discard_pucch(const uplink_pdu_slot_repositor
   state_machine.on_finish_processing_pdu();
 }
 
+void uplink_processor_impl::notify_discard_pucch(const uplink_pdu_slot_repository_impl::pucch_f0_collection& collection)
+{
+  // Iterate all PUCCH Format 0 entries in the collection.
+  for (const auto& entry : collection.ue_contexts) {
+    // Obtain number of HARQ-ACK.
+    unsigned nof_harq_ack = collection.config.entries[entry.initial_cyclic_shift].nof_harq_ack;
+
+    // Report control-related discarded result if HARQ-ACK feedback is present.
+    if (nof_harq_ack > 0) {
+      ul_pucch_results discarded_results = ul_pucch_results::create_discarded(entry.context, nof_harq_ack);
+      notifier.on_new_pucch_results(discarded_results);
+    }
+  }
+  state_machine.on_finish_processing_pdu();
+}
+
 void uplink_processor_impl::notify_discard_pucch(const uplink_pdu_slot_repository_impl::pucch_f1_collection& collection)
 {
   // Iterate all PUCCH Format 1 entries in the collection.
@@ -523,6 +660,9 @@ void uplink_processor_impl::notify_discard_pucch(const uplink_pdu_slot_repositor
 
 void uplink_processor_impl::discard_slot()
 {
+  // Release the PUSCH transmissions waiting for OFDM symbols, even if the slot cannot be discarded yet.
+  update_rx_symbol_progress(0, true);
+
   // Notify to the repository the discard of the slot. It skips the discard if the current state does not require it.
   if (!state_machine.start_discard_slot()) {
     return;
@@ -540,6 +680,10 @@ void uplink_processor_impl::discard_slot()
       notify_discard_pucch(pdu);
     }
 
+    for (const auto& collection : pdu_repository.get_pucch_f0_repository(i_symbol)) {
+      notify_discard_pucch(collection);
+    }
+
     for (const auto& collection : pdu_repository.get_pucch_f1_repository(i_symbol)) {
       notify_discard_pucch(collection);
     }
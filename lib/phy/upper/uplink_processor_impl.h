@@ -17,6 +17,7 @@
 #include "ocudu/instrumentation/traces/du_traces.h"
 #include "ocudu/phy/upper/channel_processors/prach/prach_detector.h"
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_processor_result_notifier.h"
+#include "ocudu/phy/upper/channel_processors/pusch/pusch_rx_symbol_monitor.h"
 #include "ocudu/phy/upper/phy_tap/phy_tap.h"
 #include "ocudu/phy/upper/rx_buffer_pool.h"
 #include "ocudu/phy/upper/signal_processors/srs/srs_estimator.h"
@@ -179,7 +180,8 @@ public:
                         rx_buffer_pool&                  rm_buffer_pool_,
                         upper_phy_rx_results_notifier&   notifier_,
                         unsigned                         max_nof_prb,
-                        unsigned                         max_nof_layers);
+                        unsigned                         max_nof_layers,
+                        bool                             enable_pusch_pipelining_);
 
   // See uplink_processor interface for documentation.
   unique_uplink_pdu_slot_repository get_pdu_slot_repository(slot_point slot) override;
@@ -191,6 +193,75 @@ public:
   void stop() override;
 
 private:
+  /// \brief PUSCH receive symbol monitor.
+  ///
+  /// Reports the reception progress of the slot OFDM symbols to the processor of a PUSCH transmission that started
+  /// before the end of its allocation. Each PUSCH transmission of the slot uses a different monitor.
+  class pusch_symbol_monitor : public pusch_rx_symbol_monitor
+  {
+  public:
+    /// Reception progress mask indicating that the rest of the slot was discarded.
+    static constexpr unsigned discarded_mask = 0x80000000;
+
+    /// \brief Configures the monitor for a new PUSCH transmission.
+    /// \param[in] progress_ Reception progress of the slot, number of received OFDM symbols and discarded flag.
+    /// \param[in] executor_ Executor for the notifications.
+    /// \return A reference to the configured monitor.
+    pusch_rx_symbol_monitor& configure(const std::atomic<unsigned>& progress_, uplink_task_executor& executor_)
+    {
+      progress = &progress_;
+      executor = &executor_;
+      listener.store(nullptr);
+      return *this;
+    }
+
+    /// Notifies the pending listener, if any, about a change in the reception progress.
+    void notify()
+    {
+      pusch_rx_symbol_listener* current_listener = listener.exchange(nullptr);
+      if (current_listener == nullptr) {
+        return;
+      }
+
+      // Notify from the calling thread if the notification cannot be deferred, as the PUSCH transmission would never
+      // complete otherwise.
+      if (!executor->defer([current_listener]() { current_listener->on_new_rx_symbols(); })) {
+        current_listener->on_new_rx_symbols();
+      }
+    }
+
+    // See interface for documentation.
+    unsigned get_nof_rx_symbols() const override { return progress->load() & ~discarded_mask; }
+
+    // See interface for documentation.
+    bool is_discarded() const override { return (progress->load() & discarded_mask) != 0; }
+
+    // See interface for documentation.
+    bool request_notification(unsigned nof_rx_symbols, pusch_rx_symbol_listener& listener_) override
+    {
+      // Register the listener before checking the progress. The progress is updated before notifying, so either the
+      // check or the notifier see the change.
+      listener.store(&listener_);
+
+      unsigned current_progress = progress->load();
+      if (((current_progress & discarded_mask) == 0) && ((current_progress & ~discarded_mask) <= nof_rx_symbols)) {
+        return true;
+      }
+
+      // The progress changed in the meantime. Withdraw the request, unless the notifier has already taken it.
+      pusch_rx_symbol_listener* expected = &listener_;
+      return !listener.compare_exchange_strong(expected, nullptr);
+    }
+
+  private:
+    /// Reception progress of the slot.
+    const std::atomic<unsigned>* progress = nullptr;
+    /// Executor for the notifications.
+    uplink_task_executor* executor = nullptr;
+    /// Listener waiting for a notification.
+    std::atomic<pusch_rx_symbol_listener*> listener = nullptr;
+  };
+
   /// Creates a static resource grid reference counter that outlives the repository.
   static std::atomic<unsigned>& get_grid_ref_counter();
 
@@ -219,18 +290,29 @@ private:
   /// Helper method for processing PUCCH.
   void process_pucch(const uplink_pdu_slot_repository::pucch_pdu& pdu);
 
+  /// Helper method for processing PUCCH Format 0.
+  void process_pucch_f0(const uplink_pdu_slot_repository_impl::pucch_f0_collection& collection);
+
   /// Helper method for processing PUCCH Format 1.
   void process_pucch_f1(const uplink_pdu_slot_repository_impl::pucch_f1_collection& collection);
 
   /// Helper method for processing SRS.
   void process_srs(const uplink_pdu_slot_repository::srs_pdu& pdu);
 
+  /// \brief Updates the reception progress of the slot and notifies the PUSCH transmissions waiting for it.
+  /// \param[in] nof_rx_symbols Number of OFDM symbols received in order since the beginning of the slot.
+  /// \param[in] is_discarded   Set to true if the rest of the slot is discarded.
+  void update_rx_symbol_progress(unsigned nof_rx_symbols, bool is_discarded);
+
   /// Helper method for notifying a discarded PUSCH reception.
   void notify_discard_pusch(const uplink_pdu_slot_repository::pusch_pdu& pdu);
 
   /// Helper method for notifying a discarded PUCCH reception.
   void notify_discard_pucch(const uplink_pdu_slot_repository::pucch_pdu& pdu);
 
+  /// Helper method for notifying a discarded PUCCH Format 0 collection.
+  void notify_discard_pucch(const uplink_pdu_slot_repository_impl::pucch_f0_collection& collection);
+
   /// Helper method for notifying a discarded PUCCH Format 1 collection.
   void notify_discard_pucch(const uplink_pdu_slot_repository_impl::pucch_f1_collection& collection);
 
@@ -244,6 +326,15 @@ private:
   std::array<detail::pusch_processor_result_notifier_adaptor, MAX_PUSCH_PDUS_PER_SLOT> pusch_adaptors;
   /// Counter of used PUSCH adaptors. It shall not exceed \c MAX_PUSCH_PDUS_PER_SLOT.
   std::atomic<unsigned> count_pusch_adaptors;
+  /// Set to true for processing PUSCH transmissions before the end of their allocation.
+  bool enable_pusch_pipelining;
+  /// PUSCH receive symbol monitors, indexed like the PUSCH adaptors.
+  std::array<pusch_symbol_monitor, MAX_PUSCH_PDUS_PER_SLOT> pusch_symbol_monitors;
+  /// \brief Reception progress of the slot.
+  ///
+  /// Number of OFDM symbols received in order, combined with pusch_symbol_monitor::discarded_mask if the rest of the
+  /// slot is discarded.
+  std::atomic<unsigned> rx_symbol_progress = 0;
   /// PRACH detector.
   std::unique_ptr<prach_detector> prach;
   /// PUSCH processor.
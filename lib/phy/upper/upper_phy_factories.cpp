@@ -121,7 +121,8 @@ public:
                                                    config.rm_buffer_pool,
                                                    config.notifier,
                                                    config.nof_rb,
-                                                   config.max_nof_layers);
+                                                   config.max_nof_layers,
+                                                   config.enable_pusch_pipelining);
   }
 
   std::unique_ptr<uplink_processor>
@@ -159,7 +160,8 @@ public:
                                                    config.rm_buffer_pool,
                                                    config.notifier,
                                                    config.nof_rb,
-                                                   config.max_nof_layers);
+                                                   config.max_nof_layers,
+                                                   config.enable_pusch_pipelining);
   }
 
   std::unique_ptr<uplink_pdu_validator> create_pdu_validator() override
@@ -569,6 +571,8 @@ create_ul_processor_factory(const upper_phy_factory_configuration& config,
   channel_equalizer_algorithm_type pusch_equalizer_algorithm_type = channel_equalizer_algorithm_type::zf;
   if (config.pusch_channel_equalizer_algorithm == "mmse") {
     pusch_equalizer_algorithm_type = channel_equalizer_algorithm_type::mmse;
+  } else if (config.pusch_channel_equalizer_algorithm == "mmse_irc") {
+    pusch_equalizer_algorithm_type = channel_equalizer_algorithm_type::mmse_irc;
   }
 
   port_channel_estimator_fd_smoothing_strategy pusch_chan_estimator_fd_strategy =
@@ -754,6 +758,7 @@ create_ul_processor_factory(const upper_phy_factory_configuration& config,
     decoder_config.executor                  = dependencies.executors.pusch_decoder_executor.executor;
     decoder_config.nof_prb                   = config.ul_bw_rb;
     decoder_config.nof_layers                = config.pusch_max_nof_layers;
+    decoder_config.max_codeblock_batch_size  = config.pusch_max_codeblock_batch_size;
 
     if (metric_notifier) {
       decoder_config.decoder_factory = create_ldpc_decoder_metric_decorator_factory(
@@ -952,11 +957,12 @@ create_ul_processor_pool(uplink_processor_factory&              factory,
     info.scs = to_subcarrier_spacing(scs);
 
     // Prepare UL processor configuration.
-    uplink_processor_config ul_proc_config = {.notifier       = rx_results_notifier,
-                                              .rm_buffer_pool = rm_buffer_pool,
-                                              .nof_rx_ports   = config.nof_rx_ports,
-                                              .nof_rb         = config.ul_bw_rb,
-                                              .max_nof_layers = config.pusch_max_nof_layers};
+    uplink_processor_config ul_proc_config = {.notifier                = rx_results_notifier,
+                                              .rm_buffer_pool          = rm_buffer_pool,
+                                              .nof_rx_ports            = config.nof_rx_ports,
+                                              .nof_rb                  = config.ul_bw_rb,
+                                              .max_nof_layers          = config.pusch_max_nof_layers,
+                                              .enable_pusch_pipelining = config.enable_pusch_pipelining};
 
     for (unsigned count = 0; count != config.nof_ul_rg; ++count) {
       // Create an uplink processor.
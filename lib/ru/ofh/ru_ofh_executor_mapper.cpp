@@ -26,12 +26,16 @@ namespace {
 class ru_ofh_sector_executor_mapper_impl : public ru_ofh_sector_executor_mapper
 {
 public:
-  ru_ofh_sector_executor_mapper_impl(task_executor&                 txrx_exec_,
-                                     task_executor&                 downlink_exec_,
-                                     std::unique_ptr<task_executor> uplink_exec_) :
-    txrx_exec(txrx_exec_), downlink_exec(downlink_exec_), uplink_exec(std::move(uplink_exec_))
+  ru_ofh_sector_executor_mapper_impl(task_executor&                              txrx_exec_,
+                                     task_executor&                              downlink_exec_,
+                                     std::vector<std::unique_ptr<task_executor>> uplink_execs_) :
+    txrx_exec(txrx_exec_), downlink_exec(downlink_exec_), uplink_execs(std::move(uplink_execs_))
   {
-    ocudu_assert(uplink_exec, "Invalid OFH uplink executor");
+    ocudu_assert(!uplink_execs.empty(), "Invalid OFH uplink executor");
+    for (const auto& exec : uplink_execs) {
+      ocudu_assert(exec, "Invalid OFH uplink executor");
+      uplink_exec_ptrs.push_back(exec.get());
+    }
   }
 
   // See interface for documentation.
@@ -41,12 +45,19 @@ public:
   task_executor& downlink_executor() override { return downlink_exec; }
 
   // See interface for documentation.
-  task_executor& uplink_executor() override { return *uplink_exec; }
+  task_executor& uplink_executor() override { return *uplink_execs.front(); }
+
+  // See interface for documentation.
+  span<task_executor* const> additional_uplink_executors() override
+  {
+    return span<task_executor* const>(uplink_exec_ptrs).last(uplink_exec_ptrs.size() - 1);
+  }
 
 private:
-  task_executor&                 txrx_exec;
-  task_executor&                 downlink_exec;
-  std::unique_ptr<task_executor> uplink_exec;
+  task_executor&                              txrx_exec;
+  task_executor&                              downlink_exec;
+  std::vector<std::unique_ptr<task_executor>> uplink_execs;
+  std::vector<task_executor*>                 uplink_exec_ptrs;
 };
 
 /// Open Fronthaul RU executor mapper implementation managing executor mappers of the configured sectors.
@@ -62,6 +73,7 @@ public:
     report_error_if_not(config.downlink_executor, "Invalid Downlink executor");
     report_error_if_not(config.uplink_executor, "Invalid Uplink executor");
     report_error_if_not(config.timing_executor, "Invalid Timing executor");
+    report_error_if_not(config.nof_uplink_executors_per_sector > 0, "Invalid number of uplink executors per sector");
 
     report_error_if_not(!config.txrx_executors.empty(), "TXRX executors for OFH must not be empty");
     report_error_if_not(std::all_of(config.txrx_executors.begin(),
@@ -77,10 +89,15 @@ public:
             : 1;
 
     for (unsigned i = 0; i != config.nof_sectors; ++i) {
+      // Each sector decodes the received messages in parallel in several strands of the uplink executor.
+      std::vector<std::unique_ptr<task_executor>> uplink_execs;
+      for (unsigned j = 0; j != config.nof_uplink_executors_per_sector; ++j) {
+        uplink_execs.push_back(
+            make_task_strand_ptr<concurrent_queue_policy::lockfree_mpmc>(*config.uplink_executor, default_queue_size));
+      }
+
       sector_mappers.emplace_back(
-          *config.txrx_executors[i / nof_sectors_per_txrx_thread],
-          *config.downlink_executor,
-          make_task_strand_ptr<concurrent_queue_policy::lockfree_mpmc>(*config.uplink_executor, default_queue_size));
+          *config.txrx_executors[i / nof_sectors_per_txrx_thread], *config.downlink_executor, std::move(uplink_execs));
     }
   }
 
@@ -0,0 +1,165 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "cell_group_slot_workers.h"
+#include "ocudu/support/synchronization/futex_util.h"
+
+using namespace ocudu;
+
+cell_group_slot_workers::cell_group_slot_workers(unsigned nof_workers, scheduler_metrics_handler& metrics_) :
+  metrics(metrics_),
+  logger(ocudulog::fetch_basic_logger("SCHED")),
+  workers("sched_grp", nof_workers, MAX_DU_CELL_GROUPS)
+{
+}
+
+cell_group_slot_workers::~cell_group_slot_workers()
+{
+  slot_barrier.wait();
+  workers.stop();
+}
+
+void cell_group_slot_workers::add_cell(du_cell_group_index_t group_index, cell_scheduler& cell)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  cell_context& ctx = cells[cell.cell_cfg.cell_index];
+  ctx.cell          = &cell;
+  ctx.group_index   = group_index;
+  ctx.last_slot     = {};
+  ctx.pending       = false;
+}
+
+void cell_group_slot_workers::rem_cell(du_cell_index_t cell_index)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  slot_barrier.wait();
+  cells[cell_index].cell = nullptr;
+}
+
+void cell_group_slot_workers::pause_cell(du_cell_index_t cell_index)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  slot_barrier.wait();
+  cells[cell_index].last_slot = {};
+  cells[cell_index].pending   = false;
+}
+
+void cell_group_slot_workers::run_slot(slot_point_extended sl_tx, du_cell_index_t cell_index)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  cell_context&                ctx = cells[cell_index];
+
+  if (ctx.pending) {
+    // Collect the result of the slot that was dispatched for this cell.
+    const slot_point_extended dispatched_cell_slot = collect_cell_result(ctx, lock);
+    if (dispatched_cell_slot == sl_tx) {
+      return;
+    }
+
+    if (sl_tx < dispatched_cell_slot) {
+      // Do not move the slot of the cell backwards.
+      logger.warning("cell={}: Discarding slot indication for slot={}. Cause: Cell already scheduled for slot={}",
+                     fmt::underlying(cell_index),
+                     sl_tx,
+                     dispatched_cell_slot);
+      return;
+    }
+
+    // The caller skipped the dispatched slot, so its result will never be transmitted. Handle it as a discarded
+    // result, so that the HARQs and UCIs allocated in that slot are rolled back.
+    logger.info("cell={}: Discarding dispatched slot={}", fmt::underlying(cell_index), dispatched_cell_slot);
+    ctx.cell->handle_error_indication(dispatched_cell_slot.without_hyper_sfn(),
+                                      scheduler_slot_handler::error_outcome{true, true, true});
+  }
+
+  if (not is_dispatched(sl_tx)) {
+    // First slot indication of a new slot. Wait for all cell groups to complete the previous slot before dispatching.
+    slot_barrier.wait();
+    dispatch(sl_tx);
+  }
+
+  if (ctx.pending) {
+    collect_cell_result(ctx, lock);
+    return;
+  }
+
+  // The cell was not included in the dispatched slot. Schedule it inline.
+  lock.unlock();
+  ctx.cell->run_slot(sl_tx);
+  lock.lock();
+  ctx.last_slot = sl_tx;
+}
+
+void cell_group_slot_workers::dispatch(slot_point_extended sl_tx)
+{
+  dispatched_slot = sl_tx;
+  for (auto& group_cells : dispatched_groups) {
+    group_cells.clear();
+  }
+
+  for (unsigned i = 0; i != MAX_NOF_DU_CELLS; ++i) {
+    cell_context& ctx = cells[i];
+    if (ctx.cell == nullptr or ctx.pending or not ctx.last_slot.valid() or
+        ctx.last_slot.numerology() != sl_tx.numerology() or ctx.last_slot + 1 != sl_tx) {
+      continue;
+    }
+    ctx.pending   = true;
+    ctx.last_slot = sl_tx;
+    ctx.done.store(0, std::memory_order_relaxed);
+    dispatched_groups[ctx.group_index].push_back(to_du_cell_index(i));
+  }
+
+  for (unsigned i = 0; i != MAX_DU_CELL_GROUPS; ++i) {
+    if (dispatched_groups[i].empty()) {
+      continue;
+    }
+    auto group_index = static_cast<du_cell_group_index_t>(i);
+    if (not workers.push_task_blocking([this, group_index, token = slot_barrier.get_token()]() {
+          run_group(group_index);
+        })) {
+      // The workers were stopped. Schedule the group inline.
+      run_group(group_index);
+    }
+  }
+}
+
+void cell_group_slot_workers::run_group(du_cell_group_index_t group_index)
+{
+  const auto start_tp = std::chrono::steady_clock::now();
+
+  for (du_cell_index_t cell_index : dispatched_groups[group_index]) {
+    cell_context& ctx = cells[cell_index];
+    ctx.cell->run_slot(dispatched_slot);
+
+    // Signal the caller of the slot indication of the cell that the result is available.
+    ctx.done.store(1, std::memory_order_release);
+    futex_util::wake_all(ctx.done);
+  }
+
+  const auto group_latency =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_tp);
+  for (du_cell_index_t cell_index : dispatched_groups[group_index]) {
+    metrics.at(cell_index).handle_cell_group_latency(group_latency);
+  }
+}
+
+slot_point_extended cell_group_slot_workers::collect_cell_result(cell_context&                ctx,
+                                                                 std::unique_lock<std::mutex>& lock)
+{
+  // The cell stays pending while waiting, so that it is not included in any other dispatch in the meantime.
+  const slot_point_extended dispatched_cell_slot = ctx.last_slot;
+  lock.unlock();
+  while (ctx.done.load(std::memory_order_acquire) == 0) {
+    futex_util::wait(ctx.done, 0);
+  }
+  lock.lock();
+  ctx.pending = false;
+  return dispatched_cell_slot;
+}
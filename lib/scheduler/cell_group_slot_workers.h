@@ -0,0 +1,105 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "cell_scheduler.h"
+#include "logging/scheduler_metrics_handler.h"
+#include "ocudu/adt/static_vector.h"
+#include "ocudu/support/executors/task_worker_pool.h"
+#include "ocudu/support/synchronization/sync_event.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace ocudu {
+
+/// \brief Pool of dedicated workers that schedule the independent DU cell groups concurrently.
+///
+/// The first slot indication of a new slot dispatches one task per cell group to the worker pool. Each task schedules
+/// the cells of its group in increasing cell index order, which keeps the ordering within the group. The caller of each
+/// slot indication then waits for the result of its cell. A new slot is only dispatched once all the cell groups have
+/// completed the previous one, which acts as a slot-aligned barrier.
+///
+/// A cell is only included in a dispatched slot if the slot immediately follows the last slot the cell was scheduled
+/// for. Otherwise, e.g. for a newly activated cell, a cell with skipped slots or a cell whose slot indication arrives
+/// after the dispatch, the cell is scheduled inline in the context of its slot indication. If the slot indication of a
+/// cell skips the slot that was dispatched for it, the result of the dispatched slot is never transmitted and is
+/// handled like a discarded result signalled via error indication.
+class cell_group_slot_workers
+{
+public:
+  cell_group_slot_workers(unsigned nof_workers, scheduler_metrics_handler& metrics_);
+  ~cell_group_slot_workers();
+
+  /// Registers a new cell to be scheduled by the workers.
+  void add_cell(du_cell_group_index_t group_index, cell_scheduler& cell);
+
+  /// Unregisters a cell. Waits for the completion of the last dispatched slot.
+  void rem_cell(du_cell_index_t cell_index);
+
+  /// \brief Excludes a cell from the dispatched slots until it gets scheduled inline again.
+  ///
+  /// Waits for the completion of the last dispatched slot. Called when the cell is deactivated.
+  void pause_cell(du_cell_index_t cell_index);
+
+  /// \brief Schedules the given cell for the given slot.
+  ///
+  /// On return, the result of the cell for the given slot is available in the cell scheduler.
+  void run_slot(slot_point_extended sl_tx, du_cell_index_t cell_index);
+
+private:
+  struct cell_context {
+    /// Scheduler of the cell. Null if the cell does not exist.
+    cell_scheduler*       cell = nullptr;
+    du_cell_group_index_t group_index;
+    /// Last slot for which the cell was scheduled or dispatched.
+    slot_point_extended last_slot;
+    /// Whether the cell was included in a dispatched slot whose result was not collected yet.
+    bool pending = false;
+    /// Set by the worker once the result of the dispatched slot is available.
+    std::atomic<uint32_t> done{0};
+  };
+
+  /// Returns true if the given slot has already been dispatched.
+  bool is_dispatched(slot_point_extended sl_tx) const { return dispatched_slot == sl_tx; }
+
+  /// Dispatches one task per cell group to schedule the given slot.
+  void dispatch(slot_point_extended sl_tx);
+
+  /// Schedules the cells of a cell group for the last dispatched slot.
+  void run_group(du_cell_group_index_t group_index);
+
+  /// \brief Waits until the worker signals that the result of the pending cell is available.
+  ///
+  /// The lock is released while waiting. The cell is only marked as not pending once the wait completes.
+  /// \return Slot that was dispatched for the cell.
+  static slot_point_extended collect_cell_result(cell_context& ctx, std::unique_lock<std::mutex>& lock);
+
+  scheduler_metrics_handler& metrics;
+  ocudulog::basic_logger&    logger;
+
+  /// Protects the cell contexts and the dispatch state.
+  std::mutex mutex;
+
+  std::array<cell_context, MAX_NOF_DU_CELLS> cells;
+
+  /// Slot that was last dispatched to the workers.
+  slot_point_extended dispatched_slot;
+  /// Cells of each cell group included in the last dispatched slot.
+  std::array<static_vector<du_cell_index_t, MAX_NOF_DU_CELLS>, MAX_DU_CELL_GROUPS> dispatched_groups;
+
+  /// Barrier that is released once all the cell groups have completed the last dispatched slot.
+  sync_event slot_barrier;
+
+  task_worker_pool<concurrent_queue_policy::locking_mpmc> workers;
+};
+
+} // namespace ocudu
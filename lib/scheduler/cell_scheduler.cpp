@@ -18,7 +18,8 @@ cell_scheduler::cell_scheduler(const scheduler_expert_config&                  s
                                const sched_cell_configuration_request_message& msg,
                                const cell_configuration&                       cell_cfg_,
                                ue_scheduler&                                   ue_sched_,
-                               cell_metrics_handler&                           metrics_handler) :
+                               cell_metrics_handler&                           metrics_handler,
+                               scheduler_input_trace_writer*                   trace_writer) :
   cell_cfg(cell_cfg_),
   res_grid(cell_cfg),
   event_logger(cell_cfg.cell_index, cell_cfg.pci),
@@ -29,7 +30,8 @@ cell_scheduler::cell_scheduler(const scheduler_expert_config&                  s
   pdcch_sch(cell_cfg),
   si_sch(cell_cfg, pdcch_sch, msg),
   csi_sch(cell_cfg),
-  ra_sch(sched_cfg.ra, cell_cfg, pdcch_sch, event_logger, metrics),
+  common_tmpl(cell_cfg),
+  ra_sch(sched_cfg.ra, cell_cfg, pdcch_sch, event_logger, metrics, trace_writer),
   prach_sch(cell_cfg),
   pucch_alloc(cell_cfg, sched_cfg.ue.max_pucchs_per_slot, sched_cfg.ue.max_ul_grants_per_slot),
   uci_alloc(pucch_alloc),
@@ -38,8 +40,15 @@ cell_scheduler::cell_scheduler(const scheduler_expert_config&                  s
   pg_sch(cell_cfg, pdcch_sch)
 {
   // Register new cell in the UE scheduler.
-  ue_sched = ue_sched_.add_cell(ue_cell_scheduler_creation_request{
-      msg.cell_index, &pdcch_sch, &pucch_alloc, &uci_alloc, &srs_alloc, &res_grid, &metrics, &event_logger});
+  ue_sched = ue_sched_.add_cell(ue_cell_scheduler_creation_request{msg.cell_index,
+                                                                   &pdcch_sch,
+                                                                   &pucch_alloc,
+                                                                   &uci_alloc,
+                                                                   &srs_alloc,
+                                                                   &res_grid,
+                                                                   &metrics,
+                                                                   &event_logger,
+                                                                   trace_writer});
 }
 
 void cell_scheduler::handle_si_update_request(const si_scheduling_update_request& msg)
@@ -102,11 +111,8 @@ void cell_scheduler::run_slot(slot_point_extended sl_tx_ext)
   // > Start with clearing old allocations from the grid.
   reset_resource_grid(sl_tx);
 
-  // > SSB scheduling.
-  ssb_sch.run_slot(res_grid, sl_tx);
-
-  // > Schedule CSI-RS.
-  csi_sch.run_slot(res_grid[0]);
+  // > SSB and CSI-RS scheduling, copied from the precomputed slot templates.
+  common_tmpl.run_slot(res_grid);
 
   // > Schedule SIB1 and SI-message signalling.
   si_sch.run_slot(res_grid);
@@ -168,6 +174,9 @@ void cell_scheduler::start()
   active = true;
   logger.info("cell={}: Cell scheduling was activated.", fmt::underlying(cell_cfg.cell_index));
 
+  // Precompute the allocations of the periodic cell-common channels.
+  common_tmpl.build(ssb_sch, csi_sch);
+
   ue_sched->start();
 }
 
@@ -183,7 +192,7 @@ void cell_scheduler::stop()
   logger.info("cell={}: Cell scheduling was deactivated.", fmt::underlying(cell_cfg.cell_index));
 
   // Stop sub-schedulers.
-  ssb_sch.stop();
+  common_tmpl.stop();
   si_sch.stop();
   prach_sch.stop();
   ra_sch.stop();
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "cell/resource_grid.h"
+#include "common_scheduling/common_channel_slot_templates.h"
 #include "common_scheduling/csi_rs_scheduler.h"
 #include "common_scheduling/paging_scheduler.h"
 #include "common_scheduling/prach_scheduler.h"
@@ -29,6 +30,7 @@
 namespace ocudu {
 
 class cell_metrics_handler;
+class scheduler_input_trace_writer;
 
 /// \brief This class holds all the resources that are specific to a cell.
 /// This includes the SIB and RA scheduler objects, PDCCH scheduler object, the cell resource grid, etc.
@@ -39,7 +41,8 @@ public:
                           const sched_cell_configuration_request_message& msg,
                           const cell_configuration&                       cell_cfg,
                           ue_scheduler&                                   ue_sched,
-                          cell_metrics_handler&                           metrics);
+                          cell_metrics_handler&                           metrics,
+                          scheduler_input_trace_writer*                   trace_writer = nullptr);
 
   /// Handle a slot indication for this cell.
   void run_slot(slot_point_extended sl_tx);
@@ -91,6 +94,7 @@ private:
   pdcch_resource_allocator_impl pdcch_sch;
   si_scheduler                  si_sch;
   csi_rs_scheduler              csi_sch;
+  common_channel_slot_templates common_tmpl;
   ra_scheduler                  ra_sch;
   prach_scheduler               prach_sch;
   pucch_allocator_impl          pucch_alloc;
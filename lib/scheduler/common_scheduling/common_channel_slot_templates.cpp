@@ -0,0 +1,133 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "common_channel_slot_templates.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ran/ssb/ssb_properties.h"
+#include <numeric>
+
+using namespace ocudu;
+
+common_channel_slot_templates::common_channel_slot_templates(const cell_configuration& cell_cfg_) :
+  cell_cfg(cell_cfg_), logger(ocudulog::fetch_basic_logger("SCHED"))
+{
+}
+
+unsigned common_channel_slot_templates::compute_hyperperiod() const
+{
+  const subcarrier_spacing scs       = cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs;
+  const slot_point         ref_slot  = slot_point{scs, 0};
+  const unsigned           max_slots = ref_slot.nof_slots_per_hyper_system_frame();
+
+  unsigned period = ssb_periodicity_to_value(cell_cfg.ssb_cfg.ssb_period) * ref_slot.nof_slots_per_subframe();
+  for (const zp_csi_rs_resource& zp_csi : cell_cfg.zp_csi_rs_list) {
+    period = std::lcm(period, static_cast<unsigned>(*zp_csi.period));
+  }
+  for (const nzp_csi_rs_resource& nzp_csi : cell_cfg.nzp_csi_rs_list) {
+    period = std::lcm(period, static_cast<unsigned>(*nzp_csi.csi_res_period));
+  }
+  if (cell_cfg.tdd_cfg_common.has_value()) {
+    // The TDD reference SCS is never larger than the SCS of the BWP.
+    const unsigned tdd_period = nof_slots_per_tdd_period(*cell_cfg.tdd_cfg_common)
+                                << (to_numerology_value(scs) - to_numerology_value(cell_cfg.tdd_cfg_common->ref_scs));
+    period = std::lcm(period, tdd_period);
+  }
+
+  if (max_slots % period != 0) {
+    // The templates must repeat at the slot point wrap-around. Fall back to one template per slot point value.
+    logger.info("cell={}: Periodic cell-common channels hyperperiod={} does not divide the number of slot indices {}",
+                fmt::underlying(cell_cfg.cell_index),
+                period,
+                max_slots);
+    return max_slots;
+  }
+  return period;
+}
+
+void common_channel_slot_templates::build(const ssb_scheduler& ssb_sch, const csi_rs_scheduler& csi_sch)
+{
+  const unsigned           nof_slots = compute_hyperperiod();
+  const subcarrier_spacing scs       = cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs;
+
+  templates.clear();
+  templates.emplace_back();
+  slot_to_template.assign(nof_slots, 0);
+
+  // Run the SSB and CSI-RS schedulers once over a scratch slot allocator for each slot of the hyperperiod.
+  cell_slot_resource_allocator scratch{cell_cfg};
+  for (unsigned i = 0; i != nof_slots; ++i) {
+    scratch.slot_indication(slot_point{scs, i});
+    ssb_sch.schedule_ssb(scratch);
+    csi_sch.run_slot(scratch);
+    if (scratch.result.dl.bc.ssb_info.empty() and scratch.result.dl.csi_rs.empty()) {
+      continue;
+    }
+
+    common_channel_slot_template& tmpl = templates.emplace_back();
+    tmpl.ssbs                          = scratch.result.dl.bc.ssb_info;
+    tmpl.csi_rs                        = scratch.result.dl.csi_rs;
+    for (const ssb_information& ssb : tmpl.ssbs) {
+      tmpl.ssb_grants.push_back(grant_info{scs, ssb.symbols, ssb.crbs});
+    }
+    slot_to_template[i] = templates.size() - 1;
+  }
+  scratch.clear();
+
+  logger.debug("cell={}: Built {} cell-common channel slot templates over a hyperperiod of {} slots",
+               fmt::underlying(cell_cfg.cell_index),
+               templates.size() - 1,
+               nof_slots);
+}
+
+void common_channel_slot_templates::run_slot(cell_resource_allocator& res_alloc)
+{
+  if (first_run_slot) {
+    // First call to run_slot. Allocate SSBs when relevant across cell resource grid.
+    for (unsigned i = 0; i != res_alloc.max_dl_slot_alloc_delay + 1; ++i) {
+      allocate_ssbs(res_alloc[i]);
+    }
+    first_run_slot = false;
+  } else {
+    // Allocate SSBs in last scheduled slot + 1 slot if relevant.
+    allocate_ssbs(res_alloc[res_alloc.max_dl_slot_alloc_delay]);
+  }
+
+  // Allocate CSI-RS PDUs in the current slot.
+  cell_slot_resource_allocator& slot_alloc = res_alloc[0];
+  for (const csi_rs_info& csi_rs : get_slot_template(slot_alloc.slot).csi_rs) {
+    slot_alloc.result.dl.csi_rs.push_back(csi_rs);
+  }
+}
+
+void common_channel_slot_templates::stop()
+{
+  first_run_slot = true;
+}
+
+void common_channel_slot_templates::allocate_ssbs(cell_slot_resource_allocator& slot_alloc) const
+{
+  const common_channel_slot_template& tmpl = get_slot_template(slot_alloc.slot);
+  if (tmpl.ssbs.empty()) {
+    return;
+  }
+
+  ssb_information_list& ssb_list = slot_alloc.result.dl.bc.ssb_info;
+  if (ssb_list.size() + tmpl.ssbs.size() > ssb_list.capacity()) {
+    logger.error("Failed to allocate SSB");
+    return;
+  }
+  for (const ssb_information& ssb : tmpl.ssbs) {
+    ssb_list.push_back(ssb);
+  }
+  // The slot may already hold allocations, so the SSB grants are added to the grid rather than overwriting it.
+  for (const grant_info& grant : tmpl.ssb_grants) {
+    slot_alloc.dl_res_grid.fill(grant);
+  }
+}
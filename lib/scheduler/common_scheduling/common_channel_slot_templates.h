@@ -0,0 +1,85 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "../cell/resource_grid.h"
+#include "../config/cell_configuration.h"
+#include "csi_rs_scheduler.h"
+#include "ssb_scheduler.h"
+
+namespace ocudu {
+
+/// Precomputed allocations of the periodic cell-common channels for a given slot.
+struct common_channel_slot_template {
+  /// SSBs transmitted in the slot.
+  ssb_information_list ssbs;
+  /// DL resource grid grants occupied by the SSBs.
+  static_vector<grant_info, MAX_SSB_PER_SLOT> ssb_grants;
+  /// CSI-RS PDUs transmitted in the slot.
+  static_vector<csi_rs_info, MAX_CSI_RS_PDUS_PER_SLOT> csi_rs;
+
+  bool empty() const { return ssbs.empty() and csi_rs.empty(); }
+};
+
+/// \brief Table of slot templates for the periodic cell-common channels, i.e. SSB and CSI-RS.
+///
+/// The table is built at cell activation for all the slots of the hyperperiod of these channels, i.e. the least common
+/// multiple of the SSB, CSI-RS and TDD pattern periods. In each slot, the allocations of the channels are copied from
+/// the template of the slot, instead of being recomputed by the SSB and CSI-RS schedulers.
+class common_channel_slot_templates
+{
+public:
+  explicit common_channel_slot_templates(const cell_configuration& cell_cfg_);
+
+  /// \brief Builds the slot templates from the allocations of the SSB and CSI-RS schedulers.
+  ///
+  /// Called at cell activation.
+  void build(const ssb_scheduler& ssb_sch, const csi_rs_scheduler& csi_sch);
+
+  /// \brief Copies the slot templates into the cell resource grid.
+  ///
+  /// The SSBs are allocated in the last slot that can be scheduled in advance, or in all the slots up to that one
+  /// when run for the first time. The CSI-RS PDUs are allocated in the current slot.
+  void run_slot(cell_resource_allocator& res_alloc);
+
+  /// Called when cell is deactivated.
+  void stop();
+
+  /// Number of slots after which the templates repeat.
+  unsigned hyperperiod() const { return slot_to_template.size(); }
+
+  /// Gets the template of a given slot.
+  const common_channel_slot_template& get_slot_template(slot_point sl) const
+  {
+    ocudu_assert(not slot_to_template.empty(), "Slot templates were not built");
+    return templates[slot_to_template[sl.to_uint() % slot_to_template.size()]];
+  }
+
+private:
+  /// Computes the hyperperiod of the periodic cell-common channels, in slots.
+  unsigned compute_hyperperiod() const;
+
+  /// Copies the SSBs of the template into the given slot.
+  void allocate_ssbs(cell_slot_resource_allocator& slot_alloc) const;
+
+  const cell_configuration& cell_cfg;
+  ocudulog::basic_logger&   logger;
+
+  /// Templates of the slots with allocations, where the first entry is the empty template.
+  std::vector<common_channel_slot_template> templates;
+  /// Index of the template of each slot of the hyperperiod.
+  std::vector<uint32_t> slot_to_template;
+
+  /// Flag indicating whether \c run_slot is called for the first time or not.
+  bool first_run_slot{true};
+};
+
+} // namespace ocudu
@@ -70,7 +70,7 @@ csi_rs_scheduler::csi_rs_scheduler(const cell_configuration& cell_cfg_) : cell_c
   }
 }
 
-void csi_rs_scheduler::run_slot(cell_slot_resource_allocator& res_grid)
+void csi_rs_scheduler::run_slot(cell_slot_resource_allocator& res_grid) const
 {
   if (cached_csi_rs.empty()) {
     return;
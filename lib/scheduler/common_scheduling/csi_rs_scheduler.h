@@ -20,7 +20,7 @@ class csi_rs_scheduler
 public:
   explicit csi_rs_scheduler(const cell_configuration& cell_cfg);
 
-  void run_slot(cell_slot_resource_allocator& res_grid);
+  void run_slot(cell_slot_resource_allocator& res_grid) const;
 
 private:
   const cell_configuration& cell_cfg;
@@ -10,6 +10,7 @@
 
 #include "ra_scheduler.h"
 #include "../logging/scheduler_event_logger.h"
+#include "../logging/scheduler_input_trace.h"
 #include "../logging/scheduler_metrics_handler.h"
 #include "../pdcch_scheduling/pdcch_resource_allocator_impl.h"
 #include "../support/csi_rs_helpers.h"
@@ -105,12 +106,14 @@ ra_scheduler::ra_scheduler(const scheduler_ra_expert_config& sched_cfg_,
                            const cell_configuration&         cellcfg_,
                            pdcch_resource_allocator&         pdcch_sch_,
                            scheduler_event_logger&           ev_logger_,
-                           cell_metrics_handler&             metrics_hdlr_) :
+                           cell_metrics_handler&             metrics_hdlr_,
+                           scheduler_input_trace_writer*     trace_writer_) :
   sched_cfg(sched_cfg_),
   cell_cfg(cellcfg_),
   pdcch_sch(pdcch_sch_),
   ev_logger(ev_logger_),
   metrics_hdlr(metrics_hdlr_),
+  trace_writer(trace_writer_),
   ra_win_nof_slots(cell_cfg.ul_cfg_common.init_ul_bwp.rach_cfg_common->rach_cfg_generic.ra_resp_window),
   ra_crb_lims(
       pdsch_helper::get_ra_crb_limits_common(cell_cfg.dl_cfg_common.init_dl_bwp,
@@ -336,6 +339,9 @@ void ra_scheduler::handle_pending_crc_indications_impl(cell_resource_allocator&
   // Pop pending CRCs and process them.
   ul_crc_indication crc_ind;
   while (pending_crcs.try_pop(crc_ind)) {
+    if (trace_writer != nullptr) {
+      trace_writer->write_crc_indication(crc_ind);
+    }
     for (const ul_crc_pdu_indication& crc : crc_ind.crcs) {
       ocudu_assert(crc.ue_index == INVALID_DU_UE_INDEX, "Msg3 HARQ CRCs cannot have a ue index assigned yet");
       auto& pending_msg3 = pending_msg3s[to_value(crc.rnti) % MAX_NOF_MSG3];
@@ -391,6 +397,9 @@ void ra_scheduler::run_slot(cell_resource_allocator& res_alloc)
   // Pop pending RACHs and process them.
   rach_indication_message rach;
   while (pending_rachs.try_pop(rach)) {
+    if (trace_writer != nullptr) {
+      trace_writer->write_rach_indication(rach);
+    }
     handle_rach_indication_impl(rach, res_alloc.slot_tx());
   }
 
@@ -24,6 +24,7 @@
 namespace ocudu {
 
 class scheduler_event_logger;
+class scheduler_input_trace_writer;
 class cell_metrics_handler;
 struct ul_crc_indication;
 
@@ -49,7 +50,8 @@ public:
                         const cell_configuration&         cfg_,
                         pdcch_resource_allocator&         pdcch_sched_,
                         scheduler_event_logger&           ev_logger_,
-                        cell_metrics_handler&             metrics_handler_);
+                        cell_metrics_handler&             metrics_handler_,
+                        scheduler_input_trace_writer*     trace_writer_ = nullptr);
 
   /// Enqueue RACH indication
   /// \remark See TS 38.321, 5.1.3 - RAP transmission.
@@ -162,6 +164,8 @@ private:
   pdcch_resource_allocator&         pdcch_sch;
   scheduler_event_logger&           ev_logger;
   cell_metrics_handler&             metrics_hdlr;
+  /// Records the RACH and Msg3 CRC indications when they are processed. Null if the inputs are not recorded.
+  scheduler_input_trace_writer* trace_writer;
 
   // Derived from args.
   ocudulog::basic_logger& logger = ocudulog::fetch_basic_logger("SCHED");
@@ -22,25 +22,6 @@ ssb_scheduler::ssb_scheduler(const cell_configuration& cfg_) :
   ssb_period = ssb_periodicity_to_value(cell_cfg.ssb_cfg.ssb_period);
 }
 
-void ssb_scheduler::run_slot(cell_resource_allocator& res_alloc, slot_point sl_point)
-{
-  if (first_run_slot) {
-    // First call to run_slot. Schedule SSBs when relevant across cell resource grid.
-    for (unsigned i = 0; i != res_alloc.max_dl_slot_alloc_delay + 1; ++i) {
-      schedule_ssb(res_alloc[i]);
-    }
-    first_run_slot = false;
-  } else {
-    // Schedule SSB in last scheduled slot + 1 slot if relevant.
-    schedule_ssb(res_alloc[res_alloc.max_dl_slot_alloc_delay]);
-  }
-}
-
-void ssb_scheduler::stop()
-{
-  first_run_slot = true;
-}
-
 void ssb_scheduler::schedule_ssb(cell_slot_resource_allocator& res_grid) const
 {
   slot_point            sl_point = res_grid.slot;
@@ -28,17 +28,6 @@ class ssb_scheduler
 public:
   explicit ssb_scheduler(const cell_configuration& cfg_);
 
-  /// \brief Schedule grant(s) for SSB.
-  ///
-  /// The functions schedules the SSB according to a given periodicity, depending on the frequency and SSB case for up
-  /// to N slots when run for first time. In subsequent runs schedules SSB on N + 1 slot.
-  ///
-  /// \param[out] res_allocator  Cell resource grid.
-  /// \param[in]  sl_point       Slot point carrying information about current slot.
-  ///
-  /// \remark This function only works for FR1, or L_max = 4 or 8.
-  void run_slot(cell_resource_allocator& res_allocator, slot_point sl_point);
-
   /// \brief Schedule grant for SSB.
   ///
   /// The functions schedules the SSB per slot according to a given periodicity, depending on the frequency and
@@ -49,9 +38,6 @@ public:
   /// \remark This function only works for FR1, or L_max = 4 or 8.
   void schedule_ssb(cell_slot_resource_allocator& slot_allocator) const;
 
-  /// Called when cell is deactivated.
-  void stop();
-
 private:
   /// \brief Perform allocation for case A and C (both paired and unpaired spectrum) - TS 38.213, Section 4.1.
   void ssb_alloc_case_A_C(ssb_information_list& ssb_list, arfcn_t freq_arfcn_cut_off, slot_point sl_point_mod) const;
@@ -70,9 +56,6 @@ private:
                                   uint8_t               ssb_burst_symb_idx,
                                   uint8_t               ssb_idx);
 
-  /// Flag indicating whether \c run_slot is called for the first time or not.
-  bool first_run_slot{true};
-
   /// Periodicity of SSB in milliseconds (or in nof. subframes).
   uint8_t ssb_period;
 
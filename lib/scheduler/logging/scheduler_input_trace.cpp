@@ -0,0 +1,1260 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "scheduler_input_trace.h"
+#include "../config/ue_configuration.h"
+#include "ocudu/support/error_handling.h"
+#include <cstring>
+
+using namespace ocudu;
+
+namespace {
+
+/// Trace file magic number.
+constexpr uint32_t TRACE_MAGIC = 0x54495353;
+/// Trace format version.
+constexpr uint16_t TRACE_VERSION = 2;
+/// Size of the record header, that is, the record type and the payload length.
+constexpr unsigned RECORD_HEADER_SIZE = 5;
+/// Numerology value used to encode invalid slot points.
+constexpr uint8_t INVALID_NUMEROLOGY = 0xff;
+/// Number of record buffers of the writer, which bounds the number of records pending to be written.
+constexpr unsigned NOF_RECORD_BUFFERS = 8192;
+/// Initial capacity of each record buffer, which fits all the records except the cell configuration.
+constexpr unsigned RECORD_BUFFER_CAPACITY = 256;
+/// Time the writer thread sleeps when there are no pending records.
+constexpr std::chrono::microseconds WRITER_SLEEP_TIME{500};
+
+/// Buffer where the calling thread encodes a record before handing it to the writer thread.
+thread_local std::vector<uint8_t> encode_buffer;
+
+/// Types of the records of a scheduler input trace.
+enum class trace_record_type : uint8_t {
+  cell_configuration,
+  cell_removal,
+  cell_activation,
+  cell_deactivation,
+  ue_creation,
+  ue_reconfiguration,
+  ue_removal,
+  ue_config_applied,
+  ue_deactivation,
+  slot_indication,
+  slot_result,
+  error_indication,
+  dl_buffer_state_indication,
+  dl_mac_ce_indication,
+  ul_bsr_indication,
+  ul_phr_indication,
+  crc_indication,
+  uci_indication,
+  rach_indication
+};
+
+/// Returns true if the given value is within the bounds of the bounded integer type.
+template <typename Integer, Integer MinValue, Integer MaxValue>
+constexpr bool is_within_bounds(const bounded_integer<Integer, MinValue, MaxValue>* /* unused */, Integer value)
+{
+  return static_cast<int64_t>(value) >= static_cast<int64_t>(MinValue) and
+         static_cast<int64_t>(value) <= static_cast<int64_t>(MaxValue);
+}
+
+/// Returns the lower bound of the bounded integer type.
+template <typename Integer, Integer MinValue, Integer MaxValue>
+constexpr Integer get_lower_bound(const bounded_integer<Integer, MinValue, MaxValue>* /* unused */)
+{
+  return MinValue;
+}
+
+/// Appends little-endian encoded fields to a record buffer.
+class trace_encoder
+{
+public:
+  explicit trace_encoder(std::vector<uint8_t>& buffer_) : buffer(buffer_) {}
+
+  template <typename T>
+  void pack(T value)
+  {
+    if constexpr (std::is_enum_v<T>) {
+      pack(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_same_v<T, bool>) {
+      pack(static_cast<uint8_t>(value));
+    } else if constexpr (std::is_same_v<T, float>) {
+      uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      pack(bits);
+    } else {
+      static_assert(std::is_integral_v<T>, "Unsupported type");
+      auto raw = static_cast<std::make_unsigned_t<T>>(value);
+      for (unsigned i_byte = 0; i_byte != sizeof(T); ++i_byte) {
+        buffer.push_back(static_cast<uint8_t>(raw >> (8U * i_byte)));
+      }
+    }
+  }
+
+  template <typename T, typename PackFunc>
+  void pack_optional(const std::optional<T>& value, const PackFunc& pack_value)
+  {
+    pack(value.has_value());
+    if (value.has_value()) {
+      pack_value(*value);
+    }
+  }
+
+  void pack_slot(slot_point slot)
+  {
+    pack(static_cast<uint8_t>(slot.valid() ? slot.numerology() : INVALID_NUMEROLOGY));
+    pack(static_cast<uint32_t>(slot.valid() ? slot.to_uint() : 0));
+  }
+
+  void pack_time(phy_time_unit time) { pack(time.to_Tc()); }
+
+private:
+  std::vector<uint8_t>& buffer;
+};
+
+/// Extracts little-endian encoded fields from a record payload, flagging any out of bounds access.
+class trace_decoder
+{
+public:
+  explicit trace_decoder(span<const uint8_t> data_) : data(data_) {}
+
+  /// Returns true if the decoder tried to read past the payload or found an invalid value.
+  bool failed() const { return error; }
+
+  /// Flags the payload as invalid.
+  void set_failed() { error = true; }
+
+  template <typename T>
+  T unpack()
+  {
+    if constexpr (std::is_enum_v<T>) {
+      return static_cast<T>(unpack<std::underlying_type_t<T>>());
+    } else if constexpr (std::is_same_v<T, bool>) {
+      return unpack<uint8_t>() != 0;
+    } else if constexpr (std::is_same_v<T, float>) {
+      uint32_t bits = unpack<uint32_t>();
+      float    value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    } else {
+      static_assert(std::is_integral_v<T>, "Unsupported type");
+      if (offset + sizeof(T) > data.size()) {
+        error = true;
+        return T{};
+      }
+      std::make_unsigned_t<T> raw = 0;
+      for (unsigned i_byte = 0; i_byte != sizeof(T); ++i_byte) {
+        raw |= static_cast<std::make_unsigned_t<T>>(data[offset + i_byte]) << (8U * i_byte);
+      }
+      offset += sizeof(T);
+      return static_cast<T>(raw);
+    }
+  }
+
+  /// Unpacks a bounded integer, flagging the payload as invalid if the value is out of bounds.
+  template <typename Bounded>
+  Bounded unpack_bounded()
+  {
+    auto value = unpack<decltype(std::declval<const Bounded&>().value())>();
+    if (not is_within_bounds(static_cast<const Bounded*>(nullptr), value)) {
+      error = true;
+      return Bounded(get_lower_bound(static_cast<const Bounded*>(nullptr)));
+    }
+    return Bounded(value);
+  }
+
+  template <typename T, typename UnpackFunc>
+  std::optional<T> unpack_optional(const UnpackFunc& unpack_value)
+  {
+    if (not unpack<bool>()) {
+      return std::nullopt;
+    }
+    return unpack_value();
+  }
+
+  /// Unpacks the number of elements of a list, flagging the payload as invalid if it exceeds the given maximum.
+  unsigned unpack_list_size(unsigned max_size)
+  {
+    auto size = unpack<uint16_t>();
+    if (size > max_size) {
+      error = true;
+      return 0;
+    }
+    return size;
+  }
+
+  slot_point unpack_slot()
+  {
+    auto numerology = unpack<uint8_t>();
+    auto count      = unpack<uint32_t>();
+    if (numerology == INVALID_NUMEROLOGY) {
+      return {};
+    }
+    if (numerology >= NOF_NUMEROLOGIES or count >= slot_point(numerology, 0).nof_slots_per_hyper_system_frame()) {
+      error = true;
+      return {};
+    }
+    return {numerology, count};
+  }
+
+  phy_time_unit unpack_time() { return phy_time_unit::from_units_of_Tc(unpack<int64_t>()); }
+
+private:
+  span<const uint8_t> data;
+  unsigned            offset = 0;
+  bool                error  = false;
+};
+
+} // namespace
+
+static void pack_tdd_pattern(trace_encoder& enc, const tdd_ul_dl_pattern& pattern)
+{
+  enc.pack(static_cast<uint16_t>(pattern.dl_ul_tx_period_nof_slots));
+  enc.pack(static_cast<uint16_t>(pattern.nof_dl_slots));
+  enc.pack(static_cast<uint8_t>(pattern.nof_dl_symbols));
+  enc.pack(static_cast<uint16_t>(pattern.nof_ul_slots));
+  enc.pack(static_cast<uint8_t>(pattern.nof_ul_symbols));
+}
+
+static tdd_ul_dl_pattern unpack_tdd_pattern(trace_decoder& dec)
+{
+  tdd_ul_dl_pattern pattern;
+  pattern.dl_ul_tx_period_nof_slots = dec.unpack<uint16_t>();
+  pattern.nof_dl_slots              = dec.unpack<uint16_t>();
+  pattern.nof_dl_symbols            = dec.unpack<uint8_t>();
+  pattern.nof_ul_slots              = dec.unpack<uint16_t>();
+  pattern.nof_ul_symbols            = dec.unpack<uint8_t>();
+  return pattern;
+}
+
+static void pack_pucch_resources(trace_encoder& enc, const pucch_resource_builder_params& res)
+{
+  enc.pack(res.res_set_0_size.value());
+  enc.pack(res.res_set_1_size.value());
+  enc.pack(res.nof_cell_res_set_configs);
+  enc.pack(res.nof_cell_sr_resources);
+  enc.pack(res.nof_cell_csi_resources);
+  enc.pack(res.max_nof_symbols.value());
+
+  enc.pack(static_cast<uint8_t>(res.f0_or_f1_params.index()));
+  if (const auto* f1 = std::get_if<pucch_f1_params>(&res.f0_or_f1_params)) {
+    enc.pack(f1->nof_cyc_shifts);
+    enc.pack(f1->occ_supported);
+    enc.pack(f1->nof_symbols.value());
+    enc.pack(f1->intraslot_freq_hopping);
+  } else {
+    const auto& f0 = std::get<pucch_f0_params>(res.f0_or_f1_params);
+    enc.pack(f0.nof_symbols.value());
+    enc.pack(f0.intraslot_freq_hopping);
+  }
+
+  enc.pack(static_cast<uint8_t>(res.f2_or_f3_or_f4_params.index()));
+  if (const auto* f2 = std::get_if<pucch_f2_params>(&res.f2_or_f3_or_f4_params)) {
+    enc.pack(f2->nof_symbols.value());
+    enc.pack(f2->max_nof_rbs);
+    enc.pack_optional(f2->max_payload_bits, [&enc](unsigned bits) { enc.pack(bits); });
+    enc.pack(f2->max_code_rate);
+    enc.pack(f2->intraslot_freq_hopping);
+  } else if (const auto* f3 = std::get_if<pucch_f3_params>(&res.f2_or_f3_or_f4_params)) {
+    enc.pack(f3->nof_symbols.value());
+    enc.pack(f3->max_nof_rbs);
+    enc.pack_optional(f3->max_payload_bits, [&enc](unsigned bits) { enc.pack(bits); });
+    enc.pack(f3->max_code_rate);
+    enc.pack(f3->intraslot_freq_hopping);
+    enc.pack(f3->additional_dmrs);
+    enc.pack(f3->pi2_bpsk);
+  } else {
+    const auto& f4 = std::get<pucch_f4_params>(res.f2_or_f3_or_f4_params);
+    enc.pack(f4.nof_symbols.value());
+    enc.pack(f4.max_code_rate);
+    enc.pack(f4.intraslot_freq_hopping);
+    enc.pack(f4.additional_dmrs);
+    enc.pack(f4.pi2_bpsk);
+    enc.pack(f4.occ_supported);
+    enc.pack(f4.occ_length);
+  }
+}
+
+static pucch_resource_builder_params unpack_pucch_resources(trace_decoder& dec)
+{
+  pucch_resource_builder_params res;
+  res.res_set_0_size           = dec.unpack_bounded<decltype(res.res_set_0_size)>();
+  res.res_set_1_size           = dec.unpack_bounded<decltype(res.res_set_1_size)>();
+  res.nof_cell_res_set_configs = dec.unpack<unsigned>();
+  res.nof_cell_sr_resources    = dec.unpack<unsigned>();
+  res.nof_cell_csi_resources   = dec.unpack<unsigned>();
+  res.max_nof_symbols          = dec.unpack_bounded<decltype(res.max_nof_symbols)>();
+
+  if (dec.unpack<uint8_t>() == 0) {
+    pucch_f1_params f1;
+    f1.nof_cyc_shifts         = dec.unpack<pucch_nof_cyclic_shifts>();
+    f1.occ_supported          = dec.unpack<bool>();
+    f1.nof_symbols            = dec.unpack_bounded<decltype(f1.nof_symbols)>();
+    f1.intraslot_freq_hopping = dec.unpack<bool>();
+    res.f0_or_f1_params       = f1;
+  } else {
+    pucch_f0_params f0;
+    f0.nof_symbols            = dec.unpack_bounded<decltype(f0.nof_symbols)>();
+    f0.intraslot_freq_hopping = dec.unpack<bool>();
+    res.f0_or_f1_params       = f0;
+  }
+
+  switch (dec.unpack<uint8_t>()) {
+    case 0: {
+      pucch_f2_params f2;
+      f2.nof_symbols            = dec.unpack_bounded<decltype(f2.nof_symbols)>();
+      f2.max_nof_rbs            = dec.unpack<unsigned>();
+      f2.max_payload_bits       = dec.unpack_optional<unsigned>([&dec]() { return dec.unpack<unsigned>(); });
+      f2.max_code_rate          = dec.unpack<max_pucch_code_rate>();
+      f2.intraslot_freq_hopping = dec.unpack<bool>();
+      res.f2_or_f3_or_f4_params = f2;
+    } break;
+    case 1: {
+      pucch_f3_params f3;
+      f3.nof_symbols            = dec.unpack_bounded<decltype(f3.nof_symbols)>();
+      f3.max_nof_rbs            = dec.unpack<unsigned>();
+      f3.max_payload_bits       = dec.unpack_optional<unsigned>([&dec]() { return dec.unpack<unsigned>(); });
+      f3.max_code_rate          = dec.unpack<max_pucch_code_rate>();
+      f3.intraslot_freq_hopping = dec.unpack<bool>();
+      f3.additional_dmrs        = dec.unpack<bool>();
+      f3.pi2_bpsk               = dec.unpack<bool>();
+      res.f2_or_f3_or_f4_params = f3;
+    } break;
+    case 2: {
+      pucch_f4_params f4;
+      f4.nof_symbols            = dec.unpack_bounded<decltype(f4.nof_symbols)>();
+      f4.max_code_rate          = dec.unpack<max_pucch_code_rate>();
+      f4.intraslot_freq_hopping = dec.unpack<bool>();
+      f4.additional_dmrs        = dec.unpack<bool>();
+      f4.pi2_bpsk               = dec.unpack<bool>();
+      f4.occ_supported          = dec.unpack<bool>();
+      f4.occ_length             = dec.unpack<pucch_f4_occ_len>();
+      res.f2_or_f3_or_f4_params = f4;
+    } break;
+    default:
+      dec.set_failed();
+  }
+  return res;
+}
+
+static void pack_harqs(trace_encoder& enc, span<const mac_harq_ack_report_status> harqs)
+{
+  enc.pack(static_cast<uint16_t>(harqs.size()));
+  for (mac_harq_ack_report_status harq : harqs) {
+    enc.pack(harq);
+  }
+}
+
+static void pack_csi(trace_encoder& enc, const csi_report_data& csi)
+{
+  enc.pack_optional(csi.cri, [&enc](uint8_t cri) { enc.pack(cri); });
+  enc.pack_optional(csi.ri, [&enc](csi_report_data::ri_type ri) { enc.pack(ri.value()); });
+  enc.pack_optional(csi.li, [&enc](csi_report_data::li_type li) { enc.pack(li.value()); });
+  enc.pack_optional(csi.pmi, [&enc](const csi_report_pmi& pmi) {
+    enc.pack(static_cast<uint8_t>(pmi.type.index()));
+    if (const auto* two_ports = std::get_if<csi_report_pmi::two_antenna_port>(&pmi.type)) {
+      enc.pack(static_cast<uint32_t>(two_ports->pmi));
+    } else {
+      const auto& four_ports = std::get<csi_report_pmi::typeI_single_panel_4ports_mode1>(pmi.type);
+      enc.pack(static_cast<uint32_t>(four_ports.i_1_1));
+      enc.pack_optional(four_ports.i_1_3, [&enc](unsigned i_1_3) { enc.pack(static_cast<uint32_t>(i_1_3)); });
+      enc.pack(static_cast<uint32_t>(four_ports.i_2));
+    }
+  });
+  enc.pack_optional(csi.first_tb_wideband_cqi,
+                    [&enc](csi_report_data::wideband_cqi_type cqi) { enc.pack(cqi.value()); });
+  enc.pack_optional(csi.second_tb_wideband_cqi,
+                    [&enc](csi_report_data::wideband_cqi_type cqi) { enc.pack(cqi.value()); });
+  enc.pack(csi.valid);
+}
+
+static csi_report_data unpack_csi(trace_decoder& dec)
+{
+  csi_report_data csi;
+  csi.cri = dec.unpack_optional<uint8_t>([&dec]() { return dec.unpack<uint8_t>(); });
+  csi.ri  = dec.unpack_optional<csi_report_data::ri_type>(
+      [&dec]() { return dec.unpack_bounded<csi_report_data::ri_type>(); });
+  csi.li = dec.unpack_optional<csi_report_data::li_type>(
+      [&dec]() { return dec.unpack_bounded<csi_report_data::li_type>(); });
+  csi.pmi = dec.unpack_optional<csi_report_pmi>([&dec]() {
+    csi_report_pmi pmi;
+    if (dec.unpack<uint8_t>() == 0) {
+      pmi.type = csi_report_pmi::two_antenna_port{dec.unpack<uint32_t>()};
+    } else {
+      csi_report_pmi::typeI_single_panel_4ports_mode1 four_ports;
+      four_ports.i_1_1 = dec.unpack<uint32_t>();
+      four_ports.i_1_3 = dec.unpack_optional<unsigned>([&dec]() { return dec.unpack<uint32_t>(); });
+      four_ports.i_2   = dec.unpack<uint32_t>();
+      pmi.type         = four_ports;
+    }
+    return pmi;
+  });
+  csi.first_tb_wideband_cqi = dec.unpack_optional<csi_report_data::wideband_cqi_type>(
+      [&dec]() { return dec.unpack_bounded<csi_report_data::wideband_cqi_type>(); });
+  csi.second_tb_wideband_cqi = dec.unpack_optional<csi_report_data::wideband_cqi_type>(
+      [&dec]() { return dec.unpack_bounded<csi_report_data::wideband_cqi_type>(); });
+  csi.valid = dec.unpack<bool>();
+  return csi;
+}
+
+sched_trace_slot_result
+ocudu::make_sched_trace_slot_result(du_cell_index_t cell_index, slot_point slot, const sched_result& result)
+{
+  sched_trace_slot_result summary = {};
+  summary.cell_index              = cell_index;
+  summary.slot                    = slot;
+  summary.success                 = result.success;
+  if (not result.success) {
+    return summary;
+  }
+
+  summary.nof_dl_pdcchs = result.dl.dl_pdcchs.size();
+  summary.nof_ul_pdcchs = result.dl.ul_pdcchs.size();
+  summary.nof_ue_pdschs = result.dl.ue_grants.size();
+  summary.nof_rars      = result.dl.rar_grants.size();
+  summary.nof_puschs    = result.ul.puschs.size();
+  summary.nof_pucchs    = result.ul.pucchs.size();
+  for (const dl_msg_alloc& grant : result.dl.ue_grants) {
+    for (const pdsch_codeword& cw : grant.pdsch_cfg.codewords) {
+      summary.dl_tbs_bytes += cw.tb_size_bytes;
+    }
+  }
+  for (const ul_sched_info& grant : result.ul.puschs) {
+    summary.ul_tbs_bytes += grant.pusch_cfg.tb_size_bytes;
+  }
+  return summary;
+}
+
+sched_trace_cell_config ocudu::make_sched_trace_cell_config(const sched_cell_configuration_request_message& msg)
+{
+  sched_trace_cell_config cfg;
+  cfg.cell_index           = msg.cell_index;
+  cfg.cell_group_index     = msg.cell_group_index;
+  cfg.pci                  = msg.ran.pci;
+  cfg.scs_common           = msg.ran.dl_cfg_common.init_dl_bwp.generic_params.scs;
+  cfg.dl_carrier           = msg.ran.dl_carrier;
+  cfg.scs_ssb              = msg.ran.ssb_cfg.scs;
+  cfg.offset_to_point_a    = msg.ran.ssb_cfg.offset_to_point_A;
+  cfg.k_ssb                = msg.ran.ssb_cfg.k_ssb;
+  cfg.cs0_index            = msg.ran.dl_cfg_common.init_dl_bwp.pdcch_common.get_coreset0().value_or(0);
+  cfg.ss0_index            = msg.ran.dl_cfg_common.init_dl_bwp.pdcch_common.get_searchspace0().value_or(0);
+  cfg.tdd_ul_dl_cfg_common = msg.ran.tdd_ul_dl_cfg_common;
+  cfg.pucch_resources      = msg.ran.init_bwp_builder.pucch.resources;
+  cfg.csi_enabled          = msg.ran.init_bwp_builder.csi.has_value();
+  return cfg;
+}
+
+/// Extracts the logical channel identifiers of the given logical channel configuration list.
+static std::optional<std::vector<lcid_t>>
+get_lcids(const std::optional<std::vector<logical_channel_config>>& lc_config_list)
+{
+  if (not lc_config_list.has_value()) {
+    return std::nullopt;
+  }
+  std::vector<lcid_t> lcids;
+  for (const logical_channel_config& lc_cfg : *lc_config_list) {
+    lcids.push_back(lc_cfg.lcid);
+  }
+  return lcids;
+}
+
+sched_trace_ue_config ocudu::make_sched_trace_ue_config(const sched_ue_creation_request_message& msg)
+{
+  sched_trace_ue_config cfg;
+  cfg.ue_index           = msg.ue_index;
+  cfg.crnti              = msg.crnti;
+  cfg.pcell_index        = (msg.cfg.cells.has_value() and not msg.cfg.cells->empty())
+                               ? (*msg.cfg.cells)[0].serv_cell_cfg.cell_index
+                               : to_du_cell_index(0);
+  cfg.starts_in_fallback = msg.starts_in_fallback;
+  cfg.ul_ccch_slot_rx    = msg.ul_ccch_slot_rx;
+  cfg.lcids              = get_lcids(msg.cfg.lc_config_list);
+  return cfg;
+}
+
+sched_trace_ue_config ocudu::make_sched_trace_ue_config(const sched_ue_reconfiguration_message& msg)
+{
+  sched_trace_ue_config cfg;
+  cfg.ue_index           = msg.ue_index;
+  cfg.crnti              = msg.crnti;
+  cfg.pcell_index        = (msg.cfg.cells.has_value() and not msg.cfg.cells->empty())
+                               ? (*msg.cfg.cells)[0].serv_cell_cfg.cell_index
+                               : to_du_cell_index(0);
+  cfg.starts_in_fallback = false;
+  cfg.lcids              = get_lcids(msg.cfg.lc_config_list);
+  return cfg;
+}
+
+sched_trace_ue_config ocudu::make_sched_trace_ue_config(const ue_configuration&   ue_cfg,
+                                                        bool                      starts_in_fallback,
+                                                        std::optional<slot_point> ul_ccch_slot_rx)
+{
+  sched_trace_ue_config cfg;
+  cfg.ue_index           = ue_cfg.ue_index;
+  cfg.crnti              = ue_cfg.crnti;
+  cfg.pcell_index        = ue_cfg.pcell_common_cfg().cell_index;
+  cfg.starts_in_fallback = starts_in_fallback;
+  cfg.ul_ccch_slot_rx    = ul_ccch_slot_rx;
+  std::vector<lcid_t> lcids;
+  for (const auto& lc_cfg : *ue_cfg.logical_channels()) {
+    lcids.push_back(lc_cfg->lcid);
+  }
+  cfg.lcids = std::move(lcids);
+  return cfg;
+}
+
+bool scheduler_input_trace_writer::open(const std::string& filename)
+{
+  file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (file.fail()) {
+    return false;
+  }
+
+  std::vector<uint8_t> header;
+  trace_encoder        enc(header);
+  enc.pack(TRACE_MAGIC);
+  enc.pack(TRACE_VERSION);
+  file.write(reinterpret_cast<const char*>(header.data()), header.size());
+  if (file.fail()) {
+    return false;
+  }
+
+  free_buffers    = std::make_unique<record_queue>(NOF_RECORD_BUFFERS, WRITER_SLEEP_TIME);
+  pending_records = std::make_unique<record_queue>(NOF_RECORD_BUFFERS, WRITER_SLEEP_TIME);
+  for (unsigned i_buffer = 0; i_buffer != NOF_RECORD_BUFFERS; ++i_buffer) {
+    std::vector<uint8_t> buffer;
+    buffer.reserve(RECORD_BUFFER_CAPACITY);
+    report_fatal_error_if_not(free_buffers->try_push(std::move(buffer)), "Failed to allocate trace record buffers");
+  }
+  writer_thread = unique_thread("sched_trace", [this]() { run_writer(); });
+  return true;
+}
+
+void scheduler_input_trace_writer::close()
+{
+  if (writer_thread.running()) {
+    pending_records->request_stop();
+    writer_thread.join();
+  }
+  if (file.is_open()) {
+    file.flush();
+    file.close();
+  }
+  if (nof_dropped_records.load(std::memory_order_relaxed) > 0) {
+    logger.warning("Scheduler input trace is missing {} records. Cause: The trace writer could not keep up",
+                   nof_dropped_records.load(std::memory_order_relaxed));
+    nof_dropped_records.store(0, std::memory_order_relaxed);
+  }
+}
+
+void scheduler_input_trace_writer::run_writer()
+{
+  std::vector<uint8_t> buffer;
+  auto                 write_buffer = [this, &buffer]() {
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    buffer.clear();
+    // There are never more buffers than the capacity of the queue.
+    (void)free_buffers->try_push(std::move(buffer));
+  };
+
+  while (pending_records->pop_blocking(buffer)) {
+    write_buffer();
+  }
+  // Write the records enqueued before the writer was closed.
+  while (pending_records->try_pop(buffer)) {
+    write_buffer();
+  }
+}
+
+void scheduler_input_trace_writer::write_record(uint8_t type)
+{
+  uint32_t payload_size = encode_buffer.size() - RECORD_HEADER_SIZE;
+  encode_buffer[0]      = type;
+  for (unsigned i_byte = 0; i_byte != sizeof(payload_size); ++i_byte) {
+    encode_buffer[1 + i_byte] = static_cast<uint8_t>(payload_size >> (8U * i_byte));
+  }
+
+  // Swap the encoded record with a free buffer, so that the buffer capacities are recycled without allocations.
+  std::vector<uint8_t> buffer;
+  if (pending_records == nullptr or not free_buffers->try_pop(buffer)) {
+    nof_dropped_records.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  std::swap(buffer, encode_buffer);
+  (void)pending_records->try_push(std::move(buffer));
+}
+
+/// Starts a new record in the given buffer and returns an encoder for its payload.
+static trace_encoder start_record(std::vector<uint8_t>& buffer)
+{
+  buffer.assign(RECORD_HEADER_SIZE, 0);
+  return trace_encoder(buffer);
+}
+
+void scheduler_input_trace_writer::write_cell_configuration(const sched_trace_cell_config& cfg)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(cfg.cell_index);
+  enc.pack(cfg.cell_group_index);
+  enc.pack(cfg.pci);
+  enc.pack(cfg.scs_common);
+  enc.pack(cfg.dl_carrier.carrier_bw);
+  enc.pack(cfg.dl_carrier.arfcn_f_ref.value());
+  enc.pack(cfg.dl_carrier.band);
+  enc.pack(cfg.dl_carrier.nof_ant);
+  enc.pack(cfg.scs_ssb);
+  enc.pack(cfg.offset_to_point_a.value());
+  enc.pack(cfg.k_ssb.value());
+  enc.pack(cfg.cs0_index.value());
+  enc.pack(cfg.ss0_index.value());
+  enc.pack_optional(cfg.tdd_ul_dl_cfg_common, [&enc](const tdd_ul_dl_config_common& tdd) {
+    enc.pack(tdd.ref_scs);
+    pack_tdd_pattern(enc, tdd.pattern1);
+    enc.pack_optional(tdd.pattern2, [&enc](const tdd_ul_dl_pattern& pattern) { pack_tdd_pattern(enc, pattern); });
+  });
+  pack_pucch_resources(enc, cfg.pucch_resources);
+  enc.pack(cfg.csi_enabled);
+  write_record(static_cast<uint8_t>(trace_record_type::cell_configuration));
+}
+
+void scheduler_input_trace_writer::write_cell_removal(du_cell_index_t cell_index)
+{
+  start_record(encode_buffer).pack(cell_index);
+  write_record(static_cast<uint8_t>(trace_record_type::cell_removal));
+}
+
+void scheduler_input_trace_writer::write_cell_activation(du_cell_index_t cell_index)
+{
+  start_record(encode_buffer).pack(cell_index);
+  write_record(static_cast<uint8_t>(trace_record_type::cell_activation));
+}
+
+void scheduler_input_trace_writer::write_cell_deactivation(du_cell_index_t cell_index)
+{
+  start_record(encode_buffer).pack(cell_index);
+  write_record(static_cast<uint8_t>(trace_record_type::cell_deactivation));
+}
+
+/// Packs the fields of a UE configuration.
+static void pack_ue_config(trace_encoder& enc, const sched_trace_ue_config& cfg)
+{
+  enc.pack(cfg.ue_index);
+  enc.pack(cfg.crnti);
+  enc.pack(cfg.pcell_index);
+  enc.pack(cfg.starts_in_fallback);
+  enc.pack_optional(cfg.ul_ccch_slot_rx, [&enc](slot_point slot) { enc.pack_slot(slot); });
+  enc.pack_optional(cfg.lcids, [&enc](const std::vector<lcid_t>& lcids) {
+    enc.pack(static_cast<uint16_t>(lcids.size()));
+    for (lcid_t lcid : lcids) {
+      enc.pack(lcid);
+    }
+  });
+}
+
+void scheduler_input_trace_writer::write_ue_creation(const sched_trace_ue_config& cfg)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  pack_ue_config(enc, cfg);
+  write_record(static_cast<uint8_t>(trace_record_type::ue_creation));
+}
+
+void scheduler_input_trace_writer::write_ue_reconfiguration(const sched_trace_ue_config& cfg)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  pack_ue_config(enc, cfg);
+  write_record(static_cast<uint8_t>(trace_record_type::ue_reconfiguration));
+}
+
+void scheduler_input_trace_writer::write_ue_removal(du_ue_index_t ue_index)
+{
+  start_record(encode_buffer).pack(ue_index);
+  write_record(static_cast<uint8_t>(trace_record_type::ue_removal));
+}
+
+void scheduler_input_trace_writer::write_ue_config_applied(du_ue_index_t ue_index)
+{
+  start_record(encode_buffer).pack(ue_index);
+  write_record(static_cast<uint8_t>(trace_record_type::ue_config_applied));
+}
+
+void scheduler_input_trace_writer::write_ue_deactivation(du_ue_index_t ue_index)
+{
+  start_record(encode_buffer).pack(ue_index);
+  write_record(static_cast<uint8_t>(trace_record_type::ue_deactivation));
+}
+
+void scheduler_input_trace_writer::write_slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(static_cast<uint8_t>(sl_tx.numerology()));
+  enc.pack(static_cast<uint32_t>(sl_tx.count()));
+  enc.pack(cell_index);
+  write_record(static_cast<uint8_t>(trace_record_type::slot_indication));
+}
+
+void scheduler_input_trace_writer::write_slot_result(const sched_trace_slot_result& result)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(result.cell_index);
+  enc.pack_slot(result.slot);
+  enc.pack(result.success);
+  enc.pack(static_cast<uint16_t>(result.nof_dl_pdcchs));
+  enc.pack(static_cast<uint16_t>(result.nof_ul_pdcchs));
+  enc.pack(static_cast<uint16_t>(result.nof_ue_pdschs));
+  enc.pack(static_cast<uint16_t>(result.nof_rars));
+  enc.pack(static_cast<uint16_t>(result.nof_puschs));
+  enc.pack(static_cast<uint16_t>(result.nof_pucchs));
+  enc.pack(result.dl_tbs_bytes);
+  enc.pack(result.ul_tbs_bytes);
+  write_record(static_cast<uint8_t>(trace_record_type::slot_result));
+}
+
+void scheduler_input_trace_writer::write_error_indication(slot_point                            sl_tx,
+                                                          du_cell_index_t                       cell_index,
+                                                          scheduler_slot_handler::error_outcome event)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack_slot(sl_tx);
+  enc.pack(cell_index);
+  enc.pack(static_cast<bool>(event.pdcch_discarded));
+  enc.pack(static_cast<bool>(event.pdsch_discarded));
+  enc.pack(static_cast<bool>(event.pusch_and_pucch_discarded));
+  write_record(static_cast<uint8_t>(trace_record_type::error_indication));
+}
+
+void scheduler_input_trace_writer::write_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(bs.ue_index);
+  enc.pack(bs.lcid);
+  enc.pack(static_cast<uint32_t>(bs.bs));
+  enc.pack_slot(bs.hol_toa);
+  write_record(static_cast<uint8_t>(trace_record_type::dl_buffer_state_indication));
+}
+
+void scheduler_input_trace_writer::write_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(mac_ce.ue_index);
+  enc.pack(mac_ce.ce_lcid.value());
+  write_record(static_cast<uint8_t>(trace_record_type::dl_mac_ce_indication));
+}
+
+void scheduler_input_trace_writer::write_ul_bsr_indication(const ul_bsr_indication_message& bsr)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(bsr.cell_index);
+  enc.pack(bsr.ue_index);
+  enc.pack(bsr.crnti);
+  enc.pack(bsr.type);
+  enc.pack(static_cast<uint16_t>(bsr.reported_lcgs.size()));
+  for (const ul_bsr_lcg_report& report : bsr.reported_lcgs) {
+    enc.pack(report.lcg_id);
+    enc.pack(report.nof_bytes);
+  }
+  write_record(static_cast<uint8_t>(trace_record_type::ul_bsr_indication));
+}
+
+void scheduler_input_trace_writer::write_ul_phr_indication(const ul_phr_indication_message& phr_ind)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(phr_ind.cell_index);
+  enc.pack(phr_ind.ue_index);
+  enc.pack(phr_ind.rnti);
+  enc.pack_slot(phr_ind.slot_rx);
+  span<const cell_ph_report> reports = phr_ind.phr.get_phr();
+  enc.pack(static_cast<uint16_t>(reports.size()));
+  for (const cell_ph_report& report : reports) {
+    enc.pack(report.serv_cell_id);
+    enc.pack(report.ph_type);
+    enc.pack(static_cast<int32_t>(report.ph.start()));
+    enc.pack(static_cast<int32_t>(report.ph.stop()));
+    enc.pack_optional(report.p_cmax, [&enc](const p_cmax_dbm_range& p_cmax) {
+      enc.pack(static_cast<int32_t>(p_cmax.start()));
+      enc.pack(static_cast<int32_t>(p_cmax.stop()));
+    });
+  }
+  write_record(static_cast<uint8_t>(trace_record_type::ul_phr_indication));
+}
+
+void scheduler_input_trace_writer::write_crc_indication(const ul_crc_indication& crc)
+{
+  write_crc_indication(crc.cell_index, crc.sl_rx, crc.crcs);
+}
+
+void scheduler_input_trace_writer::write_crc_indication(du_cell_index_t                   cell_index,
+                                                        slot_point                        sl_rx,
+                                                        span<const ul_crc_pdu_indication> crcs)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(cell_index);
+  enc.pack_slot(sl_rx);
+  enc.pack(static_cast<uint16_t>(crcs.size()));
+  for (const ul_crc_pdu_indication& pdu : crcs) {
+    enc.pack(pdu.rnti);
+    enc.pack(pdu.ue_index);
+    enc.pack(pdu.harq_id);
+    enc.pack(pdu.tb_crc_success);
+    enc.pack_optional(pdu.ul_sinr_dB, [&enc](float value) { enc.pack(value); });
+    enc.pack_optional(pdu.ul_rsrp_dBFS, [&enc](float value) { enc.pack(value); });
+    enc.pack_optional(pdu.time_advance_offset, [&enc](phy_time_unit ta) { enc.pack_time(ta); });
+  }
+  write_record(static_cast<uint8_t>(trace_record_type::crc_indication));
+}
+
+void scheduler_input_trace_writer::write_uci_indication(const uci_indication& uci)
+{
+  write_uci_indication(uci.cell_index, uci.slot_rx, uci.ucis);
+}
+
+void scheduler_input_trace_writer::write_uci_indication(du_cell_index_t                     cell_index,
+                                                        slot_point                          slot_rx,
+                                                        span<const uci_indication::uci_pdu> ucis)
+{
+  using uci_pdu = uci_indication::uci_pdu;
+
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(cell_index);
+  enc.pack_slot(slot_rx);
+  enc.pack(static_cast<uint16_t>(ucis.size()));
+  for (const uci_pdu& pdu : ucis) {
+    enc.pack(pdu.ue_index);
+    enc.pack(pdu.crnti);
+    enc.pack(static_cast<uint8_t>(pdu.pdu.index()));
+    if (const auto* f0_f1 = std::get_if<uci_pdu::uci_pucch_f0_or_f1_pdu>(&pdu.pdu)) {
+      enc.pack(f0_f1->sr_detected);
+      pack_harqs(enc, f0_f1->harqs);
+      enc.pack_optional(f0_f1->ul_sinr_dB, [&enc](float value) { enc.pack(value); });
+      enc.pack_optional(f0_f1->time_advance_offset, [&enc](phy_time_unit ta) { enc.pack_time(ta); });
+    } else if (const auto* pusch = std::get_if<uci_pdu::uci_pusch_pdu>(&pdu.pdu)) {
+      pack_harqs(enc, pusch->harqs);
+      enc.pack_optional(pusch->csi, [&enc](const csi_report_data& csi) { pack_csi(enc, csi); });
+    } else {
+      const auto& f2_f3_f4 = std::get<uci_pdu::uci_pucch_f2_or_f3_or_f4_pdu>(pdu.pdu);
+      enc.pack(static_cast<uint8_t>(f2_f3_f4.sr_info.size()));
+      for (unsigned i_bit = 0, nof_bits = f2_f3_f4.sr_info.size(); i_bit != nof_bits; ++i_bit) {
+        enc.pack(f2_f3_f4.sr_info.test(i_bit));
+      }
+      pack_harqs(enc, f2_f3_f4.harqs);
+      enc.pack_optional(f2_f3_f4.csi, [&enc](const csi_report_data& csi) { pack_csi(enc, csi); });
+      enc.pack_optional(f2_f3_f4.ul_sinr_dB, [&enc](float value) { enc.pack(value); });
+      enc.pack_optional(f2_f3_f4.time_advance_offset, [&enc](phy_time_unit ta) { enc.pack_time(ta); });
+    }
+  }
+  write_record(static_cast<uint8_t>(trace_record_type::uci_indication));
+}
+
+void scheduler_input_trace_writer::write_rach_indication(const rach_indication_message& msg)
+{
+  trace_encoder enc = start_record(encode_buffer);
+  enc.pack(msg.cell_index);
+  enc.pack_slot(msg.slot_rx);
+  enc.pack(static_cast<uint16_t>(msg.occasions.size()));
+  for (const rach_indication_message::occasion& occasion : msg.occasions) {
+    enc.pack(static_cast<uint8_t>(occasion.start_symbol));
+    enc.pack(static_cast<uint16_t>(occasion.frequency_index));
+    enc.pack(static_cast<uint16_t>(occasion.preambles.size()));
+    for (const rach_indication_message::preamble& preamble : occasion.preambles) {
+      enc.pack(static_cast<uint8_t>(preamble.preamble_id));
+      enc.pack(preamble.tc_rnti);
+      enc.pack_time(preamble.time_advance);
+    }
+  }
+  write_record(static_cast<uint8_t>(trace_record_type::rach_indication));
+}
+
+bool scheduler_input_trace_reader::open(const std::string& filename)
+{
+  file.open(filename, std::ios::in | std::ios::binary);
+  if (file.fail()) {
+    return false;
+  }
+
+  std::array<uint8_t, sizeof(TRACE_MAGIC) + sizeof(TRACE_VERSION)> header;
+  file.read(reinterpret_cast<char*>(header.data()), header.size());
+  if (file.gcount() != static_cast<std::streamsize>(header.size())) {
+    return false;
+  }
+
+  trace_decoder dec(header);
+  return dec.unpack<uint32_t>() == TRACE_MAGIC and dec.unpack<uint16_t>() == TRACE_VERSION;
+}
+
+bool scheduler_input_trace_reader::read_next(scheduler_input_trace_handler& handler)
+{
+  if (malformed or not file.is_open()) {
+    return false;
+  }
+
+  std::array<uint8_t, RECORD_HEADER_SIZE> header;
+  file.read(reinterpret_cast<char*>(header.data()), header.size());
+  if (file.gcount() == 0) {
+    // End of the trace.
+    return false;
+  }
+  if (file.gcount() != static_cast<std::streamsize>(header.size())) {
+    malformed = true;
+    return false;
+  }
+
+  trace_decoder header_dec(header);
+  auto          type         = header_dec.unpack<uint8_t>();
+  auto          payload_size = header_dec.unpack<uint32_t>();
+
+  record_buffer.resize(payload_size);
+  file.read(reinterpret_cast<char*>(record_buffer.data()), payload_size);
+  if (file.gcount() != static_cast<std::streamsize>(payload_size) or not decode_record(type, handler)) {
+    malformed = true;
+    return false;
+  }
+  return true;
+}
+
+/// Unpacks the fields of a UE configuration.
+static sched_trace_ue_config unpack_ue_config(trace_decoder& dec)
+{
+  sched_trace_ue_config cfg;
+  cfg.ue_index           = dec.unpack<du_ue_index_t>();
+  cfg.crnti              = dec.unpack<rnti_t>();
+  cfg.pcell_index        = dec.unpack<du_cell_index_t>();
+  cfg.starts_in_fallback = dec.unpack<bool>();
+  cfg.ul_ccch_slot_rx    = dec.unpack_optional<slot_point>([&dec]() { return dec.unpack_slot(); });
+  cfg.lcids              = dec.unpack_optional<std::vector<lcid_t>>([&dec]() {
+    std::vector<lcid_t> lcids(dec.unpack_list_size(MAX_NOF_RB_LCIDS));
+    for (lcid_t& lcid : lcids) {
+      lcid = dec.unpack<lcid_t>();
+    }
+    return lcids;
+  });
+  return cfg;
+}
+
+/// Unpacks a list of HARQ-ACK report bits into the given container.
+template <typename HarqList>
+static void unpack_harqs(trace_decoder& dec, HarqList& harqs, unsigned max_nof_harqs)
+{
+  harqs.resize(dec.unpack_list_size(max_nof_harqs));
+  for (unsigned i_harq = 0, nof_harqs = harqs.size(); i_harq != nof_harqs; ++i_harq) {
+    harqs[i_harq] = dec.unpack<mac_harq_ack_report_status>();
+  }
+}
+
+static ul_phr_indication_message unpack_ul_phr_indication(trace_decoder& dec)
+{
+  ul_phr_indication_message phr_ind;
+  phr_ind.cell_index = dec.unpack<du_cell_index_t>();
+  phr_ind.ue_index   = dec.unpack<du_ue_index_t>();
+  phr_ind.rnti       = dec.unpack<rnti_t>();
+  phr_ind.slot_rx    = dec.unpack_slot();
+
+  // Only Single Entry PHRs are reported by the MAC.
+  if (dec.unpack_list_size(MAX_NOF_DU_CELLS) != 1) {
+    dec.set_failed();
+    return phr_ind;
+  }
+  cell_ph_report report;
+  report.serv_cell_id = dec.unpack<ue_cell_index_t>();
+  report.ph_type      = dec.unpack<ph_field_type_t>();
+  int ph_start        = dec.unpack<int32_t>();
+  int ph_stop         = dec.unpack<int32_t>();
+  report.ph           = ph_db_range(ph_start, ph_stop);
+  report.p_cmax       = dec.unpack_optional<p_cmax_dbm_range>([&dec]() {
+    int p_cmax_start = dec.unpack<int32_t>();
+    int p_cmax_stop  = dec.unpack<int32_t>();
+    return p_cmax_dbm_range(p_cmax_start, p_cmax_stop);
+  });
+  if (report.serv_cell_id != to_ue_cell_index(0) or report.ph_type != ph_field_type_t::type1 or
+      not report.p_cmax.has_value()) {
+    dec.set_failed();
+    return phr_ind;
+  }
+  phr_ind.phr.set_se_phr(report);
+  return phr_ind;
+}
+
+static ul_crc_indication unpack_crc_indication(trace_decoder& dec)
+{
+  ul_crc_indication crc;
+  crc.cell_index = dec.unpack<du_cell_index_t>();
+  crc.sl_rx      = dec.unpack_slot();
+  for (unsigned i_pdu = 0, nof_pdus = dec.unpack_list_size(crc.crcs.capacity()); i_pdu != nof_pdus; ++i_pdu) {
+    ul_crc_pdu_indication& pdu = crc.crcs.emplace_back();
+    pdu.rnti                   = dec.unpack<rnti_t>();
+    pdu.ue_index               = dec.unpack<du_ue_index_t>();
+    pdu.harq_id                = dec.unpack<harq_id_t>();
+    pdu.tb_crc_success         = dec.unpack<bool>();
+    pdu.ul_sinr_dB             = dec.unpack_optional<float>([&dec]() { return dec.unpack<float>(); });
+    pdu.ul_rsrp_dBFS           = dec.unpack_optional<float>([&dec]() { return dec.unpack<float>(); });
+    pdu.time_advance_offset    = dec.unpack_optional<phy_time_unit>([&dec]() { return dec.unpack_time(); });
+  }
+  return crc;
+}
+
+static void unpack_uci_indication(trace_decoder& dec, uci_indication& uci)
+{
+  using uci_pdu = uci_indication::uci_pdu;
+
+  uci.cell_index = dec.unpack<du_cell_index_t>();
+  uci.slot_rx    = dec.unpack_slot();
+  for (unsigned i_pdu = 0, nof_pdus = dec.unpack_list_size(uci.ucis.capacity()); i_pdu != nof_pdus; ++i_pdu) {
+    uci_pdu& pdu = uci.ucis.emplace_back();
+    pdu.ue_index = dec.unpack<du_ue_index_t>();
+    pdu.crnti    = dec.unpack<rnti_t>();
+    switch (dec.unpack<uint8_t>()) {
+      case 0: {
+        uci_pdu::uci_pucch_f0_or_f1_pdu f0_f1;
+        f0_f1.sr_detected = dec.unpack<bool>();
+        unpack_harqs(dec, f0_f1.harqs, f0_f1.harqs.capacity());
+        f0_f1.ul_sinr_dB          = dec.unpack_optional<float>([&dec]() { return dec.unpack<float>(); });
+        f0_f1.time_advance_offset = dec.unpack_optional<phy_time_unit>([&dec]() { return dec.unpack_time(); });
+        pdu.pdu                   = f0_f1;
+      } break;
+      case 1: {
+        uci_pdu::uci_pusch_pdu pusch;
+        unpack_harqs(dec, pusch.harqs, uci_constants::MAX_NOF_HARQ_BITS);
+        pusch.csi = dec.unpack_optional<csi_report_data>([&dec]() { return unpack_csi(dec); });
+        pdu.pdu   = std::move(pusch);
+      } break;
+      case 2: {
+        uci_pdu::uci_pucch_f2_or_f3_or_f4_pdu f2_f3_f4;
+        unsigned                              nof_sr_bits = dec.unpack<uint8_t>();
+        if (nof_sr_bits > f2_f3_f4.sr_info.max_size()) {
+          dec.set_failed();
+          return;
+        }
+        f2_f3_f4.sr_info.resize(nof_sr_bits);
+        for (unsigned i_bit = 0; i_bit != nof_sr_bits; ++i_bit) {
+          if (dec.unpack<bool>()) {
+            f2_f3_f4.sr_info.set(i_bit);
+          }
+        }
+        unpack_harqs(dec, f2_f3_f4.harqs, uci_constants::MAX_NOF_HARQ_BITS);
+        f2_f3_f4.csi        = dec.unpack_optional<csi_report_data>([&dec]() { return unpack_csi(dec); });
+        f2_f3_f4.ul_sinr_dB = dec.unpack_optional<float>([&dec]() { return dec.unpack<float>(); });
+        f2_f3_f4.time_advance_offset =
+            dec.unpack_optional<phy_time_unit>([&dec]() { return dec.unpack_time(); });
+        pdu.pdu = std::move(f2_f3_f4);
+      } break;
+      default:
+        dec.set_failed();
+        return;
+    }
+  }
+}
+
+static rach_indication_message unpack_rach_indication(trace_decoder& dec)
+{
+  rach_indication_message msg;
+  msg.cell_index = dec.unpack<du_cell_index_t>();
+  msg.slot_rx    = dec.unpack_slot();
+  for (unsigned i_occ = 0, nof_occasions = dec.unpack_list_size(msg.occasions.capacity()); i_occ != nof_occasions;
+       ++i_occ) {
+    rach_indication_message::occasion& occasion = msg.occasions.emplace_back();
+    occasion.start_symbol                       = dec.unpack<uint8_t>();
+    occasion.frequency_index                    = dec.unpack<uint16_t>();
+    for (unsigned i_preamble = 0, nof_preambles = dec.unpack_list_size(occasion.preambles.capacity());
+         i_preamble != nof_preambles;
+         ++i_preamble) {
+      rach_indication_message::preamble& preamble = occasion.preambles.emplace_back();
+      preamble.preamble_id                        = dec.unpack<uint8_t>();
+      preamble.tc_rnti                            = dec.unpack<rnti_t>();
+      preamble.time_advance                       = dec.unpack_time();
+    }
+  }
+  return msg;
+}
+
+bool scheduler_input_trace_reader::decode_record(uint8_t type, scheduler_input_trace_handler& handler)
+{
+  trace_decoder dec(record_buffer);
+
+  switch (static_cast<trace_record_type>(type)) {
+    case trace_record_type::cell_configuration: {
+      sched_trace_cell_config cfg;
+      cfg.cell_index             = dec.unpack<du_cell_index_t>();
+      cfg.cell_group_index       = dec.unpack<du_cell_group_index_t>();
+      cfg.pci                    = dec.unpack<pci_t>();
+      cfg.scs_common             = dec.unpack<subcarrier_spacing>();
+      cfg.dl_carrier.carrier_bw  = dec.unpack<bs_channel_bandwidth>();
+      cfg.dl_carrier.arfcn_f_ref = dec.unpack_bounded<arfcn_t>();
+      cfg.dl_carrier.band        = dec.unpack<nr_band>();
+      cfg.dl_carrier.nof_ant     = dec.unpack<uint16_t>();
+      cfg.scs_ssb                = dec.unpack<subcarrier_spacing>();
+      cfg.offset_to_point_a      = dec.unpack_bounded<ssb_offset_to_pointA>();
+      cfg.k_ssb                  = dec.unpack_bounded<ssb_subcarrier_offset>();
+      cfg.cs0_index              = dec.unpack_bounded<coreset0_index>();
+      cfg.ss0_index              = dec.unpack_bounded<search_space0_index>();
+      cfg.tdd_ul_dl_cfg_common   = dec.unpack_optional<tdd_ul_dl_config_common>([&dec]() {
+        tdd_ul_dl_config_common tdd;
+        tdd.ref_scs  = dec.unpack<subcarrier_spacing>();
+        tdd.pattern1 = unpack_tdd_pattern(dec);
+        tdd.pattern2 = dec.unpack_optional<tdd_ul_dl_pattern>([&dec]() { return unpack_tdd_pattern(dec); });
+        return tdd;
+      });
+      cfg.pucch_resources = unpack_pucch_resources(dec);
+      cfg.csi_enabled     = dec.unpack<bool>();
+      if (not dec.failed()) {
+        handler.on_cell_configuration(cfg);
+      }
+    } break;
+    case trace_record_type::cell_removal: {
+      auto cell_index = dec.unpack<du_cell_index_t>();
+      if (not dec.failed()) {
+        handler.on_cell_removal(cell_index);
+      }
+    } break;
+    case trace_record_type::cell_activation: {
+      auto cell_index = dec.unpack<du_cell_index_t>();
+      if (not dec.failed()) {
+        handler.on_cell_activation(cell_index);
+      }
+    } break;
+    case trace_record_type::cell_deactivation: {
+      auto cell_index = dec.unpack<du_cell_index_t>();
+      if (not dec.failed()) {
+        handler.on_cell_deactivation(cell_index);
+      }
+    } break;
+    case trace_record_type::ue_creation: {
+      sched_trace_ue_config cfg = unpack_ue_config(dec);
+      if (not dec.failed()) {
+        handler.on_ue_creation(cfg);
+      }
+    } break;
+    case trace_record_type::ue_reconfiguration: {
+      sched_trace_ue_config cfg = unpack_ue_config(dec);
+      if (not dec.failed()) {
+        handler.on_ue_reconfiguration(cfg);
+      }
+    } break;
+    case trace_record_type::ue_removal: {
+      auto ue_index = dec.unpack<du_ue_index_t>();
+      if (not dec.failed()) {
+        handler.on_ue_removal(ue_index);
+      }
+    } break;
+    case trace_record_type::ue_config_applied: {
+      auto ue_index = dec.unpack<du_ue_index_t>();
+      if (not dec.failed()) {
+        handler.on_ue_config_applied(ue_index);
+      }
+    } break;
+    case trace_record_type::ue_deactivation: {
+      auto ue_index = dec.unpack<du_ue_index_t>();
+      if (not dec.failed()) {
+        handler.on_ue_deactivation(ue_index);
+      }
+    } break;
+    case trace_record_type::slot_indication: {
+      auto numerology = dec.unpack<uint8_t>();
+      auto count      = dec.unpack<uint32_t>();
+      auto cell_index = dec.unpack<du_cell_index_t>();
+      if (numerology >= NOF_NUMEROLOGIES or
+          count >= slot_point_extended(to_subcarrier_spacing(numerology), 0).nof_slots_in_all_hyper_sfns()) {
+        dec.set_failed();
+      }
+      if (not dec.failed()) {
+        handler.on_slot_indication(slot_point_extended(to_subcarrier_spacing(numerology), count), cell_index);
+      }
+    } break;
+    case trace_record_type::slot_result: {
+      sched_trace_slot_result result;
+      result.cell_index    = dec.unpack<du_cell_index_t>();
+      result.slot          = dec.unpack_slot();
+      result.success       = dec.unpack<bool>();
+      result.nof_dl_pdcchs = dec.unpack<uint16_t>();
+      result.nof_ul_pdcchs = dec.unpack<uint16_t>();
+      result.nof_ue_pdschs = dec.unpack<uint16_t>();
+      result.nof_rars      = dec.unpack<uint16_t>();
+      result.nof_puschs    = dec.unpack<uint16_t>();
+      result.nof_pucchs    = dec.unpack<uint16_t>();
+      result.dl_tbs_bytes  = dec.unpack<uint32_t>();
+      result.ul_tbs_bytes  = dec.unpack<uint32_t>();
+      if (not dec.failed()) {
+        handler.on_slot_result(result);
+      }
+    } break;
+    case trace_record_type::error_indication: {
+      slot_point                            sl_tx      = dec.unpack_slot();
+      auto                                  cell_index = dec.unpack<du_cell_index_t>();
+      scheduler_slot_handler::error_outcome event;
+      event.pdcch_discarded           = dec.unpack<bool>();
+      event.pdsch_discarded           = dec.unpack<bool>();
+      event.pusch_and_pucch_discarded = dec.unpack<bool>();
+      if (not dec.failed()) {
+        handler.on_error_indication(sl_tx, cell_index, event);
+      }
+    } break;
+    case trace_record_type::dl_buffer_state_indication: {
+      dl_buffer_state_indication_message bs;
+      bs.ue_index = dec.unpack<du_ue_index_t>();
+      bs.lcid     = dec.unpack<lcid_t>();
+      bs.bs       = dec.unpack<uint32_t>();
+      bs.hol_toa  = dec.unpack_slot();
+      if (not dec.failed()) {
+        handler.on_dl_buffer_state_indication(bs);
+      }
+    } break;
+    case trace_record_type::dl_mac_ce_indication: {
+      dl_mac_ce_indication mac_ce;
+      mac_ce.ue_index = dec.unpack<du_ue_index_t>();
+      mac_ce.ce_lcid  = dec.unpack<std::underlying_type_t<lcid_t>>();
+      if (not dec.failed()) {
+        handler.on_dl_mac_ce_indication(mac_ce);
+      }
+    } break;
+    case trace_record_type::ul_bsr_indication: {
+      ul_bsr_indication_message bsr;
+      bsr.cell_index = dec.unpack<du_cell_index_t>();
+      bsr.ue_index   = dec.unpack<du_ue_index_t>();
+      bsr.crnti      = dec.unpack<rnti_t>();
+      bsr.type       = dec.unpack<bsr_format>();
+      for (unsigned i_lcg = 0, nof_lcgs = dec.unpack_list_size(bsr.reported_lcgs.capacity()); i_lcg != nof_lcgs;
+           ++i_lcg) {
+        ul_bsr_lcg_report& report = bsr.reported_lcgs.emplace_back();
+        report.lcg_id             = dec.unpack<lcg_id_t>();
+        report.nof_bytes          = dec.unpack<uint32_t>();
+      }
+      if (not dec.failed()) {
+        handler.on_ul_bsr_indication(bsr);
+      }
+    } break;
+    case trace_record_type::ul_phr_indication: {
+      ul_phr_indication_message phr_ind = unpack_ul_phr_indication(dec);
+      if (not dec.failed()) {
+        handler.on_ul_phr_indication(phr_ind);
+      }
+    } break;
+    case trace_record_type::crc_indication: {
+      ul_crc_indication crc = unpack_crc_indication(dec);
+      if (not dec.failed()) {
+        handler.on_crc_indication(crc);
+      }
+    } break;
+    case trace_record_type::uci_indication: {
+      uci_indication uci;
+      unpack_uci_indication(dec, uci);
+      if (not dec.failed()) {
+        handler.on_uci_indication(uci);
+      }
+    } break;
+    case trace_record_type::rach_indication: {
+      rach_indication_message msg = unpack_rach_indication(dec);
+      if (not dec.failed()) {
+        handler.on_rach_indication(msg);
+      }
+    } break;
+    default:
+      return false;
+  }
+
+  return not dec.failed();
+}
@@ -0,0 +1,226 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "ocudu/adt/mpmc_queue.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/scheduler/config/pucch_resource_builder_params.h"
+#include "ocudu/scheduler/mac_scheduler.h"
+#include "ocudu/scheduler/result/sched_result.h"
+#include "ocudu/support/executors/unique_thread.h"
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ocudu {
+
+class ue_configuration;
+
+/// \brief Cell configuration stored in a scheduler input trace.
+///
+/// Only the parameters required to rebuild an equivalent cell configuration with the default cell configuration
+/// helpers are stored.
+struct sched_trace_cell_config {
+  du_cell_index_t                        cell_index;
+  du_cell_group_index_t                  cell_group_index;
+  pci_t                                  pci;
+  subcarrier_spacing                     scs_common;
+  carrier_configuration                  dl_carrier;
+  subcarrier_spacing                     scs_ssb;
+  ssb_offset_to_pointA                   offset_to_point_a;
+  ssb_subcarrier_offset                  k_ssb;
+  coreset0_index                         cs0_index;
+  search_space0_index                    ss0_index;
+  std::optional<tdd_ul_dl_config_common> tdd_ul_dl_cfg_common;
+  /// Cell PUCCH resources, from which the UE PUCCH resources are allocated.
+  pucch_resource_builder_params          pucch_resources;
+  /// Whether the CSI-RS and CSI report parameters are configured in the cell.
+  bool                                   csi_enabled;
+};
+
+/// \brief UE configuration stored in a scheduler input trace.
+///
+/// Only the identifiers and the configured logical channels of the UE are stored. The remaining UE dedicated
+/// configuration is rebuilt with the default configuration helpers.
+struct sched_trace_ue_config {
+  du_ue_index_t             ue_index;
+  rnti_t                    crnti;
+  du_cell_index_t           pcell_index;
+  bool                      starts_in_fallback;
+  std::optional<slot_point> ul_ccch_slot_rx;
+  /// Configured logical channels. Not present if the logical channel configuration is left unchanged.
+  std::optional<std::vector<lcid_t>> lcids;
+};
+
+/// Summary of the scheduling result of a slot and cell, used to compare recorded and replayed results.
+struct sched_trace_slot_result {
+  du_cell_index_t cell_index;
+  slot_point      slot;
+  bool            success;
+  unsigned        nof_dl_pdcchs;
+  unsigned        nof_ul_pdcchs;
+  unsigned        nof_ue_pdschs;
+  unsigned        nof_rars;
+  unsigned        nof_puschs;
+  unsigned        nof_pucchs;
+  /// Sum of the transport block sizes of the UE PDSCHs.
+  uint32_t dl_tbs_bytes;
+  /// Sum of the transport block sizes of the PUSCHs.
+  uint32_t ul_tbs_bytes;
+
+  bool operator==(const sched_trace_slot_result& other) const
+  {
+    return cell_index == other.cell_index and slot == other.slot and success == other.success and
+           nof_dl_pdcchs == other.nof_dl_pdcchs and nof_ul_pdcchs == other.nof_ul_pdcchs and
+           nof_ue_pdschs == other.nof_ue_pdschs and nof_rars == other.nof_rars and nof_puschs == other.nof_puschs and
+           nof_pucchs == other.nof_pucchs and dl_tbs_bytes == other.dl_tbs_bytes and ul_tbs_bytes == other.ul_tbs_bytes;
+  }
+  bool operator!=(const sched_trace_slot_result& other) const { return not(*this == other); }
+};
+
+/// Builds the summary of the given scheduling result.
+sched_trace_slot_result
+make_sched_trace_slot_result(du_cell_index_t cell_index, slot_point slot, const sched_result& result);
+
+/// Builds the cell configuration stored in a scheduler input trace from a cell configuration request.
+sched_trace_cell_config make_sched_trace_cell_config(const sched_cell_configuration_request_message& msg);
+
+/// Builds the UE configuration stored in a scheduler input trace from a UE creation request.
+sched_trace_ue_config make_sched_trace_ue_config(const sched_ue_creation_request_message& msg);
+
+/// Builds the UE configuration stored in a scheduler input trace from a UE reconfiguration request.
+sched_trace_ue_config make_sched_trace_ue_config(const sched_ue_reconfiguration_message& msg);
+
+/// Builds the UE configuration stored in a scheduler input trace from the configuration applied by the scheduler.
+sched_trace_ue_config make_sched_trace_ue_config(const ue_configuration&   ue_cfg,
+                                                 bool                      starts_in_fallback,
+                                                 std::optional<slot_point> ul_ccch_slot_rx);
+
+/// \brief Writer of scheduler input traces.
+///
+/// A trace starts with a file header followed by a sequence of records. Each record is made of a one byte record type,
+/// a four byte payload length and the payload, where all the fields are stored in little-endian byte order.
+///
+/// The write methods are thread-safe and do not block. They encode the record in the context of the caller and push it
+/// to a lock-free queue, which is drained to the trace file by a dedicated writer thread. Records written by the same
+/// thread keep their order in the trace. If the queue is full, the record is dropped.
+class scheduler_input_trace_writer
+{
+public:
+  ~scheduler_input_trace_writer() { close(); }
+
+  /// Opens the trace file, writes the file header and starts the writer thread. Returns true on success.
+  bool open(const std::string& filename);
+
+  /// Writes the pending records, stops the writer thread and closes the trace file.
+  void close();
+
+  void write_cell_configuration(const sched_trace_cell_config& cfg);
+  void write_cell_removal(du_cell_index_t cell_index);
+  void write_cell_activation(du_cell_index_t cell_index);
+  void write_cell_deactivation(du_cell_index_t cell_index);
+  void write_ue_creation(const sched_trace_ue_config& cfg);
+  void write_ue_reconfiguration(const sched_trace_ue_config& cfg);
+  void write_ue_removal(du_ue_index_t ue_index);
+  void write_ue_config_applied(du_ue_index_t ue_index);
+  void write_ue_deactivation(du_ue_index_t ue_index);
+  void write_slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index);
+  void write_slot_result(const sched_trace_slot_result& result);
+  void write_error_indication(slot_point                            sl_tx,
+                              du_cell_index_t                       cell_index,
+                              scheduler_slot_handler::error_outcome event);
+  void write_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs);
+  void write_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce);
+  void write_ul_bsr_indication(const ul_bsr_indication_message& bsr);
+  void write_ul_phr_indication(const ul_phr_indication_message& phr_ind);
+  void write_crc_indication(const ul_crc_indication& crc);
+  void write_crc_indication(du_cell_index_t cell_index, slot_point sl_rx, span<const ul_crc_pdu_indication> crcs);
+  void write_uci_indication(const uci_indication& uci);
+  void
+  write_uci_indication(du_cell_index_t cell_index, slot_point slot_rx, span<const uci_indication::uci_pdu> ucis);
+  void write_rach_indication(const rach_indication_message& msg);
+
+private:
+  using record_queue =
+      concurrent_queue<std::vector<uint8_t>, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>;
+
+  /// Enqueues the record stored in the record buffer of the calling thread.
+  void write_record(uint8_t type);
+
+  /// Writes the enqueued records to the trace file until the writer is closed.
+  void run_writer();
+
+  ocudulog::basic_logger& logger = ocudulog::fetch_basic_logger("SCHED");
+  std::ofstream           file;
+  /// Record buffers that are free to be filled.
+  std::unique_ptr<record_queue> free_buffers;
+  /// Records pending to be written to the trace file.
+  std::unique_ptr<record_queue> pending_records;
+  unique_thread                 writer_thread;
+  /// Number of records dropped because no record buffer was available.
+  std::atomic<uint64_t> nof_dropped_records{0};
+};
+
+/// Interface to the consumer of the records of a scheduler input trace.
+class scheduler_input_trace_handler
+{
+public:
+  virtual ~scheduler_input_trace_handler() = default;
+
+  virtual void on_cell_configuration(const sched_trace_cell_config& cfg)                                       = 0;
+  virtual void on_cell_removal(du_cell_index_t cell_index)                                                     = 0;
+  virtual void on_cell_activation(du_cell_index_t cell_index)                                                  = 0;
+  virtual void on_cell_deactivation(du_cell_index_t cell_index)                                                = 0;
+  virtual void on_ue_creation(const sched_trace_ue_config& cfg)                                                = 0;
+  virtual void on_ue_reconfiguration(const sched_trace_ue_config& cfg)                                         = 0;
+  virtual void on_ue_removal(du_ue_index_t ue_index)                                                           = 0;
+  virtual void on_ue_config_applied(du_ue_index_t ue_index)                                                    = 0;
+  virtual void on_ue_deactivation(du_ue_index_t ue_index)                                                      = 0;
+  virtual void on_slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index)                       = 0;
+  virtual void on_slot_result(const sched_trace_slot_result& result)                                           = 0;
+  virtual void
+  on_error_indication(slot_point sl_tx, du_cell_index_t cell_index, scheduler_slot_handler::error_outcome event) = 0;
+  virtual void on_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs)                     = 0;
+  virtual void on_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce)                                     = 0;
+  virtual void on_ul_bsr_indication(const ul_bsr_indication_message& bsr)                                      = 0;
+  virtual void on_ul_phr_indication(const ul_phr_indication_message& phr_ind)                                  = 0;
+  virtual void on_crc_indication(const ul_crc_indication& crc)                                                 = 0;
+  virtual void on_uci_indication(const uci_indication& uci)                                                    = 0;
+  virtual void on_rach_indication(const rach_indication_message& msg)                                          = 0;
+};
+
+/// Reader of scheduler input traces.
+class scheduler_input_trace_reader
+{
+public:
+  /// Opens the trace file and checks the file header. Returns true on success, false otherwise.
+  bool open(const std::string& filename);
+
+  /// \brief Reads the next record of the trace and forwards it to the given handler.
+  ///
+  /// \return True if a record was read, false if the end of the trace was reached or the record is malformed.
+  bool read_next(scheduler_input_trace_handler& handler);
+
+  /// Returns true if the reader stopped because of a malformed record.
+  bool is_malformed() const { return malformed; }
+
+private:
+  /// Decodes the record stored in the record buffer and forwards it to the handler. Returns false if malformed.
+  bool decode_record(uint8_t type, scheduler_input_trace_handler& handler);
+
+  std::ifstream        file;
+  std::vector<uint8_t> record_buffer;
+  bool                 malformed = false;
+};
+
+} // namespace ocudu
@@ -390,6 +390,13 @@ void cell_metrics_handler::handle_late_ul_harqs()
   ++data.nof_failed_pusch_allocs_late_harqs;
 }
 
+void cell_metrics_handler::handle_cell_group_latency(std::chrono::microseconds group_latency)
+{
+  data.cell_group_latency_sum += group_latency;
+  data.max_cell_group_latency = std::max(data.max_cell_group_latency, group_latency);
+  ++data.nof_cell_group_slots;
+}
+
 void cell_metrics_handler::report_metrics()
 {
   auto next_report = notifier.get_builder();
@@ -413,6 +420,10 @@ void cell_metrics_handler::report_metrics()
   next_report->max_decision_latency      = data.max_decision_latency;
   next_report->max_decision_latency_slot = data.max_decision_latency_slot;
   next_report->latency_histogram         = data.decision_latency_hist;
+  next_report->average_cell_group_latency =
+      data.nof_cell_group_slots > 0 ? data.cell_group_latency_sum / data.nof_cell_group_slots
+                                    : std::chrono::microseconds{0};
+  next_report->max_cell_group_latency    = data.max_cell_group_latency;
   next_report->nof_prbs                  = cell_cfg.nof_dl_prbs; // TODO: to be removed from the report.
   next_report->nof_dl_slots              = data.nof_dl_slots;
   next_report->nof_ul_slots              = data.nof_ul_slots;
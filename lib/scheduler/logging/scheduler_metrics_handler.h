@@ -128,6 +128,12 @@ class cell_metrics_handler final : public sched_metrics_ue_configurator
     slot_point max_decision_latency_slot;
     // Histogram of scheduler latencies.
     std::array<unsigned, scheduler_cell_metrics::latency_hist_bins> decision_latency_hist{};
+    // Tracks the sum of the cell group scheduling latencies.
+    std::chrono::microseconds cell_group_latency_sum{0};
+    // Tracks the maximum cell group scheduling latency.
+    std::chrono::microseconds max_cell_group_latency{0};
+    // Number of slots in which the cell group was scheduled by the cell group workers.
+    unsigned nof_cell_group_slots = 0;
     // Number of slot indications considered in this report.
     unsigned nof_slots = 0;
     // Number of downlink slots.
@@ -237,6 +243,9 @@ public:
   /// \brief Handle late UL HARQ indication.
   void handle_late_ul_harqs();
 
+  /// \brief Handle the time taken by a cell group worker to schedule all the cells of the cell group in a slot.
+  void handle_cell_group_latency(std::chrono::microseconds group_latency);
+
   /// \brief Handle results stored in the scheduler result and push new entry.
   void push_result(slot_point_extended       sl_tx,
                    const sched_result&       slot_result,
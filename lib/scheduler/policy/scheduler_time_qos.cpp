@@ -13,6 +13,7 @@
 #include "../support/dmrs_helpers.h"
 #include "../ue_scheduling/grant_params_selector.h"
 #include <algorithm>
+#include <cmath>
 
 using namespace ocudu;
 
@@ -87,6 +88,48 @@ void ue_history_repository::save_ul_newtx_grants(span<const ul_sched_info> ul_gr
   }
 }
 
+ue_qos_repository::ue_qos_repository()
+{
+  ues.reserve(MAX_NOF_DU_UES);
+}
+
+void ue_qos_repository::add_ue(du_ue_index_t ue_index)
+{
+  if (ues.size() <= ue_index) {
+    ues.resize(ue_index + 1);
+  }
+  // The QoS logical channels are derived once the UE logical channels are added to the slice.
+  ues[ue_index].lc_cfgs.reset();
+  ues[ue_index].qos_lcs.clear();
+}
+
+void ue_qos_repository::rem_ue(du_ue_index_t ue_index)
+{
+  ocudu_assert(ue_index < ues.size(), "UE was not added to the QoS repository");
+  ues[ue_index].lc_cfgs.reset();
+  ues[ue_index].qos_lcs.clear();
+}
+
+span<const ue_qos_repository::qos_logical_channel> ue_qos_repository::get_qos_logical_channels(const slice_ue& u)
+{
+  ue_context&                     ctx     = ues[u.ue_index()];
+  logical_channel_config_list_ptr lc_cfgs = u.logical_channels();
+  if (ctx.lc_cfgs != lc_cfgs) {
+    // The UE was (re)configured. Rebuild the list of QoS logical channels.
+    ctx.lc_cfgs = lc_cfgs;
+    ctx.qos_lcs.clear();
+    for (logical_channel_config_ptr lc : *lc_cfgs) {
+      if (not lc->qos.has_value() or not u.contains(lc->lcid)) {
+        // No QoS config was provided for this LC or the LC is not part of the slice.
+        continue;
+      }
+      ctx.qos_lcs.push_back(qos_logical_channel{
+          lc, static_cast<uint16_t>(lc->qos->qos.priority.value() * lc->qos->arp_priority.value())});
+    }
+  }
+  return ctx.qos_lcs;
+}
+
 rate_estimator::rate_estimator(const cell_configuration& cell_cfg) :
   dl_tbs_cfg_ref{.nof_symb_sh      = NOF_OFDM_SYM_PER_SLOT_NORMAL_CP,
                  .nof_oh_prb       = 0,
@@ -118,21 +161,52 @@ rate_estimator::rate_estimator(const cell_configuration& cell_cfg) :
         pusch_td_cfg, cell_cfg.pci, cell_cfg.dmrs_typeA_pos, dmrs_cfg, nof_layers, max_layers, false);
     ul_dmrs_rbs_per_nof_layers[nof_layers - 1] = calculate_nof_dmrs_per_rb(dmrs);
   }
+
+  for (auto& layer_tbs : dl_tbs_cache) {
+    layer_tbs.fill(tbs_not_computed);
+  }
+  for (auto& layer_tbs : ul_tbs_cache) {
+    layer_tbs.fill(tbs_not_computed);
+  }
 }
 
-unsigned rate_estimator::estimate_max_dl_tbs(const ue_cell& ue_cc) const
-{
-  static constexpr unsigned        NOF_BITS_PER_BYTE = 8U;
-  static constexpr pdsch_mcs_table ref_mcs_table     = pdsch_mcs_table::qam256;
+// Reference MCS tables used in the rate estimation.
+static constexpr pdsch_mcs_table ref_dl_mcs_table = pdsch_mcs_table::qam256;
+static constexpr pusch_mcs_table ref_ul_mcs_table = pusch_mcs_table::qam256;
 
-  auto mcs = ue_cc.link_adaptation_controller().calculate_dl_mcs(ref_mcs_table);
+unsigned rate_estimator::estimate_max_dl_tbs(const ue_cell& ue_cc)
+{
+  auto mcs = ue_cc.link_adaptation_controller().calculate_dl_mcs(ref_dl_mcs_table);
   if (not mcs.has_value()) {
     // CQI is either 0 or above 15, which means no DL.
     return 0;
   }
 
-  const unsigned            nof_layers = ue_cc.channel_state_manager().get_nof_dl_layers();
-  const sch_mcs_description mcs_info   = pdsch_mcs_get_config(ref_mcs_table, mcs.value());
+  const unsigned nof_layers = ue_cc.channel_state_manager().get_nof_dl_layers();
+  unsigned&      tbs        = dl_tbs_cache[nof_layers - 1][mcs->value()];
+  if (tbs == tbs_not_computed) {
+    tbs = compute_max_dl_tbs(mcs.value(), nof_layers);
+  }
+  return tbs;
+}
+
+unsigned rate_estimator::estimate_max_ul_tbs(const ue_cell& ue_cc)
+{
+  const sch_mcs_index mcs = ue_cc.link_adaptation_controller().calculate_ul_mcs(ref_ul_mcs_table, false);
+
+  const unsigned nof_layers = ue_cc.channel_state_manager().get_nof_ul_layers();
+  unsigned&      tbs        = ul_tbs_cache[nof_layers - 1][mcs.value()];
+  if (tbs == tbs_not_computed) {
+    tbs = compute_max_ul_tbs(mcs, nof_layers);
+  }
+  return tbs;
+}
+
+unsigned rate_estimator::compute_max_dl_tbs(sch_mcs_index mcs, unsigned nof_layers) const
+{
+  static constexpr unsigned NOF_BITS_PER_BYTE = 8U;
+
+  const sch_mcs_description mcs_info = pdsch_mcs_get_config(ref_dl_mcs_table, mcs);
   const unsigned            tbs_bits =
       tbs_calculator_calculate(tbs_calculator_configuration{.nof_symb_sh  = dl_tbs_cfg_ref.nof_symb_sh,
                                                             .nof_dmrs_prb = dl_dmrs_rbs_per_nof_layers[nof_layers - 1],
@@ -144,16 +218,12 @@ unsigned rate_estimator::estimate_max_dl_tbs(const ue_cell& ue_cc) const
   return tbs_bits / NOF_BITS_PER_BYTE;
 }
 
-unsigned rate_estimator::estimate_max_ul_tbs(const ue_cell& ue_cc) const
+unsigned rate_estimator::compute_max_ul_tbs(sch_mcs_index mcs, unsigned nof_layers) const
 {
-  static constexpr pusch_mcs_table ref_mcs_table          = pusch_mcs_table::qam256;
-  static constexpr bool            use_transform_precoder = false;
-  static constexpr unsigned        NOF_BITS_PER_BYTE      = 8U;
-
-  const sch_mcs_index mcs = ue_cc.link_adaptation_controller().calculate_ul_mcs(ref_mcs_table, false);
+  static constexpr bool     use_transform_precoder = false;
+  static constexpr unsigned NOF_BITS_PER_BYTE      = 8U;
 
-  const unsigned            nof_layers = ue_cc.channel_state_manager().get_nof_ul_layers();
-  const sch_mcs_description mcs_info   = pusch_mcs_get_config(ref_mcs_table, mcs, use_transform_precoder, false);
+  const sch_mcs_description mcs_info = pusch_mcs_get_config(ref_ul_mcs_table, mcs, use_transform_precoder, false);
 
   unsigned tbs_bits =
       tbs_calculator_calculate(tbs_calculator_configuration{.nof_symb_sh  = ul_tbs_cfg_ref.nof_symb_sh,
@@ -172,52 +242,34 @@ scheduler_time_qos::scheduler_time_qos(const time_qos_scheduler_config& policy_c
                                        const cell_configuration&        cell_cfg) :
   params(policy_cfg_), rate_estim(cell_cfg)
 {
-}
-
-void scheduler_time_qos::add_ue(du_ue_index_t ue_index)
-{
-  ue_history_db.add_ue(ue_index);
-}
-
-void scheduler_time_qos::rem_ue(du_ue_index_t ue_index)
-{
-  ue_history_db.rem_ue(ue_index);
-}
-
-void scheduler_time_qos::compute_ue_dl_priorities(slot_point               pdcch_slot,
-                                                  slot_point               pdsch_slot,
-                                                  span<ue_newtx_candidate> ue_candidates)
-{
-  last_pdsch_slot = pdsch_slot;
-
-  // Compute UE candidate priorities.
-  for (auto& u : ue_candidates) {
-    u.priority = compute_dl_prio(*u.ue, pdcch_slot, pdsch_slot);
+  if (params.pf_fairness_coeff >= 0 and params.pf_fairness_coeff < MAX_PF_COEFF and
+      params.pf_fairness_coeff == std::floor(params.pf_fairness_coeff)) {
+    pf_int_exponent = static_cast<unsigned>(params.pf_fairness_coeff);
   }
+
+  // Pre-reserve memory for the priority computation of all the UE candidates.
+  batch.resize(MAX_NOF_DU_UES);
 }
 
-void scheduler_time_qos::compute_ue_ul_priorities(slot_point               pdcch_slot,
-                                                  slot_point               pusch_slot,
-                                                  span<ue_newtx_candidate> ue_candidates)
+void scheduler_time_qos::priority_batch::resize(size_t nof_candidates)
 {
-  last_pusch_slot = pusch_slot;
-
-  // Compute UE candidate priorities.
-  for (auto& u : ue_candidates) {
-    u.priority = compute_ul_prio(*u.ue, pdcch_slot, pusch_slot);
-  }
+  estim_rate.resize(nof_candidates);
+  avg_rate.resize(nof_candidates);
+  gbr_weight.resize(nof_candidates);
+  prio_delay_weight.resize(nof_candidates);
+  priority.resize(nof_candidates);
 }
 
-void scheduler_time_qos::save_dl_newtx_grants(span<const dl_msg_alloc> dl_grants)
+void scheduler_time_qos::add_ue(du_ue_index_t ue_index)
 {
-  // Save result of DL grants in UE history.
-  ue_history_db.save_dl_newtx_grants(dl_grants);
+  ue_history_db.add_ue(ue_index);
+  ue_qos_db.add_ue(ue_index);
 }
 
-void scheduler_time_qos::save_ul_newtx_grants(span<const ul_sched_info> ul_grants)
+void scheduler_time_qos::rem_ue(du_ue_index_t ue_index)
 {
-  // Save result of UL grants in UE history.
-  ue_history_db.save_ul_newtx_grants(ul_grants);
+  ue_history_db.rem_ue(ue_index);
+  ue_qos_db.rem_ue(ue_index);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,88 +278,56 @@ void scheduler_time_qos::save_ul_newtx_grants(span<const ul_sched_info> ul_grant
 // the final QoS weight computation.
 static constexpr double max_metric_weight = 1.0e12;
 
-static double compute_pf_metric(double estim_rate, double avg_rate, double fairness_coeff)
-{
-  double pf_weight = 0.0;
-  if (estim_rate > 0) {
-    if (avg_rate != 0) {
-      if (fairness_coeff >= MAX_PF_COEFF) {
-        // For very high coefficients, the pow(.) will be very high, leading to pf_weight of 0 due to lack of precision.
-        // In such scenarios, we change the way to compute the PF weight. Instead, we completely disregard the estimated
-        // rate, as its impact is minimal.
-        pf_weight = 1 / avg_rate;
-      } else {
-        pf_weight = estim_rate / std::pow(avg_rate, fairness_coeff);
-      }
-    } else {
-      // In case the avg rate is zero, the division would be inf. Instead, we give the highest priority to the UE.
-      pf_weight = max_metric_weight;
-    }
-  }
-  return pf_weight;
-}
+namespace {
 
-static double combine_qos_metrics(double                           pf_weight,
-                                  double                           gbr_weight,
-                                  double                           prio_weight,
-                                  double                           delay_weight,
-                                  const time_qos_scheduler_config& policy_params)
-{
-  if (policy_params.combine_function == time_qos_scheduler_config::combine_function_type::gbr_prioritized and
-      gbr_weight > 1.0) {
-    // GBR target has not been met and we prioritize GBR over PF.
-    pf_weight = std::max(1.0, pf_weight);
-  }
+/// Weights of a UE derived from the QoS of its logical channels.
+struct qos_weights {
+  double gbr;
+  /// Product of the priority and delay weights.
+  double prio_delay;
+};
 
-  // The return is a combination of QoS priority, ARP priority, GBR and PF weight functions.
-  return gbr_weight * pf_weight * prio_weight * delay_weight;
-}
+} // namespace
 
-/// \brief Computes DL rate weight used in computation of DL priority value for a UE in a slot.
-static double compute_dl_qos_weights(const slice_ue&                  u,
-                                     double                           estim_dl_rate,
-                                     double                           avg_dl_rate,
-                                     slot_point                       slot_tx,
-                                     const time_qos_scheduler_config& policy_params)
+/// \brief Computes DL QoS weights used in computation of DL priority value for a UE in a slot.
+static qos_weights compute_dl_qos_weights(const slice_ue&                                   u,
+                                          span<const ue_qos_repository::qos_logical_channel> qos_lcs,
+                                          slot_point                                        slot_tx,
+                                          const time_qos_scheduler_config&                  policy_params)
 {
-  if (avg_dl_rate == 0) {
-    // Highest priority to UEs that have not yet received any allocation.
-    return std::numeric_limits<double>::max();
-  }
-
   static constexpr uint16_t max_combined_prio_level = qos_prio_level_t::max() * arp_prio_level_t::max();
   uint16_t                  min_combined_prio       = max_combined_prio_level;
   double                    gbr_weight              = 0;
   double                    delay_weight            = 0;
   if (policy_params.gbr_enabled or policy_params.priority_enabled or policy_params.pdb_enabled) {
-    for (logical_channel_config_ptr lc : *u.logical_channels()) {
-      if (not lc->qos.has_value() or not u.contains(lc->lcid) or u.pending_dl_newtx_bytes(lc->lcid) == 0) {
-        // LC is not part of the slice, No QoS config was provided for this LC or there is no pending data for this LC
+    for (const auto& qos_lc : qos_lcs) {
+      const logical_channel_config& lc = *qos_lc.cfg;
+      if (u.pending_dl_newtx_bytes(lc.lcid) == 0) {
+        // There is no pending data for this LC.
         continue;
       }
 
       // Track the LC with the lowest combined priority (combining QoS and ARP priority levels).
       if (policy_params.priority_enabled) {
-        min_combined_prio = std::min(
-            static_cast<uint16_t>(lc->qos->qos.priority.value() * lc->qos->arp_priority.value()), min_combined_prio);
+        min_combined_prio = std::min(qos_lc.combined_prio, min_combined_prio);
       }
 
-      slot_point hol_toa = u.dl_hol_toa(lc->lcid);
+      slot_point hol_toa = u.dl_hol_toa(lc.lcid);
       if (hol_toa.valid() and slot_tx >= hol_toa) {
         const unsigned hol_delay_ms = (slot_tx - hol_toa) / slot_tx.nof_slots_per_subframe();
-        const unsigned pdb          = lc->qos->qos.packet_delay_budget_ms;
+        const unsigned pdb          = lc.qos->qos.packet_delay_budget_ms;
         delay_weight += hol_delay_ms / static_cast<double>(pdb);
       }
 
-      if (not lc->qos->gbr_qos_info.has_value()) {
+      if (not lc.qos->gbr_qos_info.has_value()) {
         // LC is a non-GBR flow.
         continue;
       }
 
       // GBR flow.
-      double dl_avg_rate = u.dl_avg_bit_rate(lc->lcid);
+      double dl_avg_rate = u.dl_avg_bit_rate(lc.lcid);
       if (dl_avg_rate != 0) {
-        gbr_weight += std::min(lc->qos->gbr_qos_info->gbr_dl / dl_avg_rate, max_metric_weight);
+        gbr_weight += std::min(lc.qos->gbr_qos_info->gbr_dl / dl_avg_rate, max_metric_weight);
       } else {
         gbr_weight += max_metric_weight;
       }
@@ -318,54 +338,44 @@ static double compute_dl_qos_weights(const slice_ue&                  u,
   gbr_weight   = policy_params.gbr_enabled and gbr_weight != 0 ? gbr_weight : 1.0;
   delay_weight = policy_params.pdb_enabled and delay_weight != 0 ? delay_weight : 1.0;
 
-  double pf_weight = compute_pf_metric(estim_dl_rate, avg_dl_rate, policy_params.pf_fairness_coeff);
   // If priority is disabled, set the priority weight of all UEs to 1.0.
   double prio_weight = policy_params.priority_enabled ? (max_combined_prio_level + 1 - min_combined_prio) /
                                                             static_cast<double>(max_combined_prio_level + 1)
                                                       : 1.0;
 
-  // The return is a combination of ARP and QoS priorities, GBR and PF weight functions.
-  return combine_qos_metrics(pf_weight, gbr_weight, prio_weight, delay_weight, policy_params);
+  return {gbr_weight, prio_weight * delay_weight};
 }
 
-/// \brief Computes UL weights used in computation of UL priority value for a UE in a slot.
-static double compute_ul_qos_weights(const slice_ue&                  u,
-                                     double                           estim_ul_rate,
-                                     double                           avg_ul_rate,
-                                     const time_qos_scheduler_config& policy_params)
+/// \brief Computes UL QoS weights used in computation of UL priority value for a UE in a slot.
+static qos_weights compute_ul_qos_weights(const slice_ue&                                   u,
+                                          span<const ue_qos_repository::qos_logical_channel> qos_lcs,
+                                          const time_qos_scheduler_config&                  policy_params)
 {
-  if (u.has_pending_sr() or avg_ul_rate == 0) {
-    // Highest priority to SRs and UEs that have not yet received any allocation.
-    return max_sched_priority;
-  }
-
   static constexpr uint16_t max_combined_prio_level = qos_prio_level_t::max() * arp_prio_level_t::max();
   uint16_t                  min_combined_prio       = max_combined_prio_level;
   double                    gbr_weight              = 0;
   if (policy_params.gbr_enabled or policy_params.priority_enabled) {
-    for (logical_channel_config_ptr lc : *u.logical_channels()) {
-      if (not u.contains(lc->lcid) or not lc->qos.has_value() or u.pending_ul_unacked_bytes(lc->lc_group) == 0) {
-        // LC is not part of the slice or no QoS config was provided for this LC or there are no pending bytes for this
-        // group.
+    for (const auto& qos_lc : qos_lcs) {
+      const logical_channel_config& lc = *qos_lc.cfg;
+      if (u.pending_ul_unacked_bytes(lc.lc_group) == 0) {
+        // There are no pending bytes for this group.
         continue;
       }
 
       // Track the LC with the lowest combined priority (combining QoS and ARP priority levels).
       if (policy_params.priority_enabled) {
-        min_combined_prio = std::min(
-            static_cast<uint16_t>(lc->qos->qos.priority.value() * lc->qos->arp_priority.value()), min_combined_prio);
+        min_combined_prio = std::min(qos_lc.combined_prio, min_combined_prio);
       }
 
-      if (not lc->qos->gbr_qos_info.has_value()) {
+      if (not lc.qos->gbr_qos_info.has_value()) {
         // LC is a non-GBR flow.
         continue;
       }
 
       // GBR flow.
-      lcg_id_t lcg_id  = u.get_lcg_id(lc->lcid);
-      double   ul_rate = u.ul_avg_bit_rate(lcg_id);
+      double ul_rate = u.ul_avg_bit_rate(lc.lc_group);
       if (ul_rate != 0) {
-        gbr_weight += std::min(lc->qos->gbr_qos_info->gbr_ul / ul_rate, max_metric_weight);
+        gbr_weight += std::min(lc.qos->gbr_qos_info->gbr_ul / ul_rate, max_metric_weight);
       } else {
         gbr_weight = max_metric_weight;
       }
@@ -378,47 +388,144 @@ static double compute_ul_qos_weights(const slice_ue&                  u,
   double prio_weight = policy_params.priority_enabled ? (max_combined_prio_level + 1 - min_combined_prio) /
                                                             static_cast<double>(max_combined_prio_level + 1)
                                                       : 1.0;
-  double pf_weight   = compute_pf_metric(estim_ul_rate, avg_ul_rate, policy_params.pf_fairness_coeff);
 
-  return combine_qos_metrics(pf_weight, gbr_weight, prio_weight, 1.0, policy_params);
+  return {gbr_weight, prio_weight};
+}
+
+void scheduler_time_qos::compute_ue_dl_priorities(slot_point               pdcch_slot,
+                                                  slot_point               pdsch_slot,
+                                                  span<ue_newtx_candidate> ue_candidates)
+{
+  last_pdsch_slot = pdsch_slot;
+
+  // Gather the inputs of the priority computation of each UE candidate.
+  batch.resize(ue_candidates.size());
+  for (unsigned i = 0, e = ue_candidates.size(); i != e; ++i) {
+    const slice_ue& u     = *ue_candidates[i].ue;
+    const ue_cell&  ue_cc = u.get_cc();
+    // This should be ensured at this point.
+    ocudu_sanity_check(ue_cc.is_pdsch_enabled(pdcch_slot, pdsch_slot) and ue_cc.harqs.has_empty_dl_harqs() and
+                           u.has_pending_dl_newtx_bytes(),
+                       "Invalid DL UE candidate state");
+
+    // NOTE: Estimated instantaneous DL rate is calculated assuming entire BWP CRBs are allocated to UE.
+    batch.estim_rate[i] = rate_estim.estimate_max_dl_tbs(ue_cc);
+    batch.avg_rate[i]   = ue_history_db[u.ue_index()].dl_avg_rate();
+    if (batch.estim_rate[i] == 0 or batch.avg_rate[i] == 0) {
+      // The UE gets either no priority or the highest priority, regardless of its QoS.
+      batch.gbr_weight[i]        = 1.0;
+      batch.prio_delay_weight[i] = 1.0;
+      continue;
+    }
+    const qos_weights weights =
+        compute_dl_qos_weights(u, ue_qos_db.get_qos_logical_channels(u), pdcch_slot, params);
+    batch.gbr_weight[i]        = weights.gbr;
+    batch.prio_delay_weight[i] = weights.prio_delay;
+  }
+
+  // Compute UE candidate priorities.
+  compute_batch_priorities();
+  for (unsigned i = 0, e = ue_candidates.size(); i != e; ++i) {
+    ue_candidates[i].priority = batch.priority[i];
+  }
 }
 
-ue_sched_priority scheduler_time_qos::compute_dl_prio(const slice_ue& u, slot_point pdcch_slot, slot_point pdsch_slot)
+void scheduler_time_qos::compute_ue_ul_priorities(slot_point               pdcch_slot,
+                                                  slot_point               pusch_slot,
+                                                  span<ue_newtx_candidate> ue_candidates)
 {
-  const auto&         ue_cc    = u.get_cc();
-  const du_ue_index_t ue_index = u.ue_index();
-  // This should be ensured at this point.
-  ocudu_sanity_check(ue_cc.is_pdsch_enabled(pdcch_slot, pdsch_slot) and ue_cc.harqs.has_empty_dl_harqs() and
-                         u.has_pending_dl_newtx_bytes(),
-                     "Invalid DL UE candidate state");
-
-  // Calculate DL QoS-aware priority.
-  // NOTE: Estimated instantaneous DL rate is calculated assuming entire BWP CRBs are allocated to UE.
-  const unsigned estimated_max_tbs = rate_estim.estimate_max_dl_tbs(ue_cc);
-  if (estimated_max_tbs == 0) {
-    // No DL rate can be achieved.
-    return forbid_prio;
+  last_pusch_slot = pusch_slot;
+
+  // Gather the inputs of the priority computation of each UE candidate.
+  batch.resize(ue_candidates.size());
+  for (unsigned i = 0, e = ue_candidates.size(); i != e; ++i) {
+    const slice_ue& u     = *ue_candidates[i].ue;
+    const ue_cell&  ue_cc = u.get_cc();
+    ocudu_sanity_check(not ue_cc.is_in_fallback_mode() and ue_cc.is_pusch_enabled(pdcch_slot, pusch_slot) and
+                           ue_cc.harqs.has_empty_ul_harqs() and u.pending_ul_newtx_bytes() > 0,
+                       "UE UL candidate in invalid state");
+
+    // NOTE: Estimated instantaneous UL rate is calculated assuming entire BWP CRBs are allocated to UE.
+    batch.estim_rate[i] = rate_estim.estimate_max_ul_tbs(ue_cc);
+    // SRs get the highest priority, like UEs that have not yet received any allocation.
+    batch.avg_rate[i] = u.has_pending_sr() ? 0.0 : ue_history_db[u.ue_index()].ul_avg_rate();
+    if (batch.estim_rate[i] == 0 or batch.avg_rate[i] == 0) {
+      // The UE gets either no priority or the highest priority, regardless of its QoS.
+      batch.gbr_weight[i]        = 1.0;
+      batch.prio_delay_weight[i] = 1.0;
+      continue;
+    }
+    const qos_weights weights  = compute_ul_qos_weights(u, ue_qos_db.get_qos_logical_channels(u), params);
+    batch.gbr_weight[i]        = weights.gbr;
+    batch.prio_delay_weight[i] = weights.prio_delay;
   }
 
-  const double current_total_avg_rate = ue_history_db[ue_index].dl_avg_rate();
-  return compute_dl_qos_weights(u, estimated_max_tbs, current_total_avg_rate, pdcch_slot, params);
+  // Compute UE candidate priorities.
+  compute_batch_priorities();
+  for (unsigned i = 0, e = ue_candidates.size(); i != e; ++i) {
+    ue_candidates[i].priority = batch.priority[i];
+  }
 }
 
-ue_sched_priority scheduler_time_qos::compute_ul_prio(const slice_ue& u, slot_point pdcch_slot, slot_point pusch_slot)
+void scheduler_time_qos::compute_batch_priorities()
 {
-  const ue_cell& ue_cc = u.get_cc();
-  ocudu_sanity_check(not ue_cc.is_in_fallback_mode() and ue_cc.is_pusch_enabled(pdcch_slot, pusch_slot) and
-                         ue_cc.harqs.has_empty_ul_harqs() and u.pending_ul_newtx_bytes() > 0,
-                     "UE UL candidate in invalid state");
-
-  // Calculate UL PF priority.
-  // NOTE: Estimated instantaneous UL rate is calculated assuming entire BWP CRBs are allocated to UE.
-  const unsigned estimated_max_tbs = rate_estim.estimate_max_ul_tbs(ue_cc);
-  if (estimated_max_tbs == 0) {
-    return forbid_prio;
+  const unsigned nof_candidates    = batch.priority.size();
+  const double*  estim_rate        = batch.estim_rate.data();
+  const double*  avg_rate          = batch.avg_rate.data();
+  const double*  gbr_weight        = batch.gbr_weight.data();
+  const double*  prio_delay_weight = batch.prio_delay_weight.data();
+  double*        priority          = batch.priority.data();
+
+  // Compute the proportional fair weights.
+  if (params.pf_fairness_coeff >= MAX_PF_COEFF) {
+    // For very high coefficients, the pow(.) will be very high, leading to pf_weight of 0 due to lack of precision.
+    // In such scenarios, we change the way to compute the PF weight. Instead, we completely disregard the estimated
+    // rate, as its impact is minimal.
+    for (unsigned i = 0; i != nof_candidates; ++i) {
+      priority[i] = 1.0 / avg_rate[i];
+    }
+  } else if (pf_int_exponent.has_value()) {
+    // For integer coefficients, the power of the average rate is computed with multiplications.
+    std::fill(priority, priority + nof_candidates, 1.0);
+    for (unsigned n = 0; n != *pf_int_exponent; ++n) {
+      for (unsigned i = 0; i != nof_candidates; ++i) {
+        priority[i] *= avg_rate[i];
+      }
+    }
+    for (unsigned i = 0; i != nof_candidates; ++i) {
+      priority[i] = estim_rate[i] / priority[i];
+    }
+  } else {
+    for (unsigned i = 0; i != nof_candidates; ++i) {
+      priority[i] = estim_rate[i] / std::pow(avg_rate[i], params.pf_fairness_coeff);
+    }
   }
-  const double current_avg_rate = ue_history_db[u.ue_index()].ul_avg_rate();
 
-  // Compute LC weight function.
-  return compute_ul_qos_weights(u, estimated_max_tbs, current_avg_rate, params);
+  // Combine the PF weights with the QoS weights.
+  const bool gbr_prioritized =
+      params.combine_function == time_qos_scheduler_config::combine_function_type::gbr_prioritized;
+  for (unsigned i = 0; i != nof_candidates; ++i) {
+    double pf_weight = priority[i];
+    if (gbr_prioritized) {
+      // When the GBR target has not been met, we prioritize GBR over PF.
+      pf_weight = gbr_weight[i] > 1.0 ? std::max(1.0, pf_weight) : pf_weight;
+    }
+    const double weight = gbr_weight[i] * pf_weight * prio_delay_weight[i];
+
+    // No priority is given to UEs that cannot achieve any rate. The highest priority is given to UEs with a zero
+    // average rate.
+    priority[i] = estim_rate[i] == 0 ? forbid_prio : (avg_rate[i] == 0 ? max_sched_priority : weight);
+  }
+}
+
+void scheduler_time_qos::save_dl_newtx_grants(span<const dl_msg_alloc> dl_grants)
+{
+  // Save result of DL grants in UE history.
+  ue_history_db.save_dl_newtx_grants(dl_grants);
+}
+
+void scheduler_time_qos::save_ul_newtx_grants(span<const ul_sched_info> ul_grants)
+{
+  // Save result of UL grants in UE history.
+  ue_history_db.save_ul_newtx_grants(ul_grants);
 }
@@ -10,10 +10,12 @@
 
 #pragma once
 
+#include "../config/logical_channel_list_config.h"
 #include "scheduler_policy.h"
 #include "ocudu/adt/soa_table.h"
 #include "ocudu/ran/sch/tbs_calculator.h"
 #include "ocudu/scheduler/config/scheduler_expert_config.h"
+#include <array>
 
 namespace ocudu {
 
@@ -84,24 +86,72 @@ private:
   std::vector<float> last_samples_buffer;
 };
 
+/// \brief QoS parameters of the logical channels of the UEs of a slice.
+///
+/// The parameters only depend on the UE configuration. They are derived once per UE (re)configuration, so that the
+/// per-slot priority computation only needs to visit the logical channels of the slice that have a QoS configuration.
+class ue_qos_repository
+{
+public:
+  /// Logical channel of the slice with QoS configuration.
+  struct qos_logical_channel {
+    logical_channel_config_ptr cfg;
+    /// Combination of the QoS flow priority level and the ARP priority level.
+    uint16_t                   combined_prio;
+  };
+
+  ue_qos_repository();
+
+  void add_ue(du_ue_index_t ue_index);
+  void rem_ue(du_ue_index_t ue_index);
+
+  /// \brief Returns the logical channels of the slice with QoS configuration for the given UE.
+  ///
+  /// The list is rebuilt whenever the logical channel configuration of the UE changes.
+  span<const qos_logical_channel> get_qos_logical_channels(const slice_ue& u);
+
+private:
+  struct ue_context {
+    /// Logical channel configuration from which the list of QoS logical channels was derived.
+    logical_channel_config_list_ptr  lc_cfgs;
+    std::vector<qos_logical_channel> qos_lcs;
+  };
+
+  std::vector<ue_context> ues;
+};
+
 /// \brief Class used to estimate maximum transport block sizes for a UE in a given cell (assuming all RBs are used),
 /// given the current channel conditions (e.g. MCS and RI).
 ///
-/// The result is used in the proportional fair weight computation.
+/// The result is used in the proportional fair weight computation. Given that the estimated transport block size only
+/// depends on the MCS and number of layers of the UE, which rarely change from slot to slot, the computed values are
+/// cached and reused for all UEs with the same channel conditions.
 class rate_estimator
 {
 public:
   explicit rate_estimator(const cell_configuration& cell_cfg);
 
   /// Estimate maximum DL transport block size, in bytes, for the given UE.
-  unsigned estimate_max_dl_tbs(const ue_cell& ue_cc) const;
+  unsigned estimate_max_dl_tbs(const ue_cell& ue_cc);
 
   /// Estimate maximum UL transport block size, in bytes, for the given UE.
-  unsigned estimate_max_ul_tbs(const ue_cell& ue_cc) const;
+  unsigned estimate_max_ul_tbs(const ue_cell& ue_cc);
 
 private:
   static constexpr size_t MAX_NOF_LAYERS = 4;
 
+  /// Value used to flag that the transport block size was not yet computed.
+  static constexpr unsigned tbs_not_computed = std::numeric_limits<unsigned>::max();
+
+  /// Table of estimated transport block sizes, in bytes, indexed by number of layers and MCS.
+  using tbs_table = std::array<std::array<unsigned, sch_mcs_index::max() + 1>, MAX_NOF_LAYERS>;
+
+  /// Computes the maximum DL transport block size, in bytes, for the given MCS and number of layers.
+  unsigned compute_max_dl_tbs(sch_mcs_index mcs, unsigned nof_layers) const;
+
+  /// Computes the maximum UL transport block size, in bytes, for the given MCS and number of layers.
+  unsigned compute_max_ul_tbs(sch_mcs_index mcs, unsigned nof_layers) const;
+
   /// Cached reference to TBS calculator configuration.
   const tbs_calculator_configuration dl_tbs_cfg_ref;
   const tbs_calculator_configuration ul_tbs_cfg_ref;
@@ -109,6 +159,10 @@ private:
   /// Number of DMRS resource blocks per number of layers.
   static_vector<uint8_t, MAX_NOF_LAYERS> dl_dmrs_rbs_per_nof_layers;
   static_vector<uint8_t, MAX_NOF_LAYERS> ul_dmrs_rbs_per_nof_layers;
+
+  /// Cached estimated transport block sizes.
+  tbs_table dl_tbs_cache;
+  tbs_table ul_tbs_cache;
 };
 
 /// Time-domain QoS-aware scheduler policy.
@@ -137,21 +191,46 @@ private:
   // Value used to flag that the UE cannot be allocated in a given slot.
   static constexpr double forbid_prio = std::numeric_limits<double>::lowest();
 
-  /// Computes the priority of the UE to be scheduled in DL based on the QoS and proportional fair metric.
-  [[nodiscard]] ue_sched_priority compute_dl_prio(const slice_ue& u, slot_point pdcch_slot, slot_point pdsch_slot);
+  /// \brief Per-candidate inputs and outputs of the priority computation.
+  ///
+  /// The inputs of all the candidates are gathered first, so that the proportional fair metric and the combination of
+  /// the weights are computed for all the candidates at once, in loops over contiguous columns that the compiler
+  /// vectorizes.
+  struct priority_batch {
+    /// Estimated maximum rate, in bytes per slot.
+    std::vector<double> estim_rate;
+    /// Average rate, in bytes per slot. A zero value grants the highest priority to the candidate.
+    std::vector<double> avg_rate;
+    /// GBR weight.
+    std::vector<double> gbr_weight;
+    /// Product of the priority and delay weights.
+    std::vector<double> prio_delay_weight;
+    /// Computed priority.
+    std::vector<double> priority;
+
+    void resize(size_t nof_candidates);
+  };
 
-  /// Computes the priority of the UE to be scheduled in UL based on the proportional fair metric.
-  [[nodiscard]] ue_sched_priority compute_ul_prio(const slice_ue& u, slot_point pdcch_slot, slot_point pusch_slot);
+  /// Computes the priorities of the candidates stored in the priority batch.
+  void compute_batch_priorities();
 
   // Policy parameters.
   const time_qos_scheduler_config params;
 
+  /// Exponent of the average rate in the proportional fair metric, if the fairness coefficient is an integer.
+  std::optional<unsigned> pf_int_exponent;
+
   /// Rate estimator instance.
   rate_estimator rate_estim;
 
   /// Holds historical traffic information for UEs of this slice.
   ue_history_repository ue_history_db;
 
+  /// Holds the QoS parameters of the UEs of this slice.
+  ue_qos_repository ue_qos_db;
+
+  priority_batch batch;
+
   slot_point last_pdsch_slot;
   slot_point last_pusch_slot;
 };
@@ -10,10 +10,20 @@
 
 #include "ocudu/scheduler/scheduler_factory.h"
 #include "scheduler_impl.h"
+#include "scheduler_input_recorder.h"
+#include "ocudu/support/error_handling.h"
 
 using namespace ocudu;
 
 std::unique_ptr<mac_scheduler> ocudu::create_scheduler(const scheduler_config& sched_cfg)
 {
-  return std::make_unique<scheduler_impl>(sched_cfg);
+  const std::string& trace_file = sched_cfg.expert_params.input_trace_file;
+  if (trace_file.empty()) {
+    return std::make_unique<scheduler_impl>(sched_cfg);
+  }
+
+  auto writer = std::make_unique<scheduler_input_trace_writer>();
+  report_error_if_not(writer->open(trace_file), "Failed to open scheduler input trace file \"{}\"", trace_file);
+  auto sched = std::make_unique<scheduler_impl>(sched_cfg, writer.get());
+  return std::make_unique<scheduler_input_recorder>(std::move(sched), std::move(writer));
 }
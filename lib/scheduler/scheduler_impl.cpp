@@ -15,9 +15,15 @@
 
 using namespace ocudu;
 
-scheduler_impl::scheduler_impl(const scheduler_config& sched_cfg_) :
-  expert_params(sched_cfg_.expert_params), logger(ocudulog::fetch_basic_logger("SCHED")), cfg_mng(sched_cfg_, metrics)
+scheduler_impl::scheduler_impl(const scheduler_config& sched_cfg_, scheduler_input_trace_writer* trace_writer_) :
+  expert_params(sched_cfg_.expert_params),
+  logger(ocudulog::fetch_basic_logger("SCHED")),
+  trace_writer(trace_writer_),
+  cfg_mng(sched_cfg_, metrics)
 {
+  if (expert_params.nof_cell_group_workers > 0) {
+    group_workers = std::make_unique<cell_group_slot_workers>(expert_params.nof_cell_group_workers, metrics);
+  }
 }
 
 bool scheduler_impl::handle_cell_configuration_request(const sched_cell_configuration_request_message& msg)
@@ -35,8 +41,16 @@ bool scheduler_impl::handle_cell_configuration_request(const sched_cell_configur
 
   // Create a new cell scheduler instance.
   cells.emplace(msg.cell_index,
-                std::make_unique<cell_scheduler>(
-                    expert_params, msg, *cell_cfg, *groups[msg.cell_group_index], metrics.at(msg.cell_index)));
+                std::make_unique<cell_scheduler>(expert_params,
+                                                 msg,
+                                                 *cell_cfg,
+                                                 *groups[msg.cell_group_index],
+                                                 metrics.at(msg.cell_index),
+                                                 trace_writer));
+
+  if (group_workers != nullptr) {
+    group_workers->add_cell(msg.cell_group_index, *cells[msg.cell_index]);
+  }
 
   return true;
 }
@@ -45,6 +59,11 @@ void scheduler_impl::handle_cell_removal_request(du_cell_index_t cell_index)
 {
   ocudu_assert(cells.contains(cell_index), "cell={} does not exist", fmt::underlying(cell_index));
 
+  // Stop scheduling the cell in the cell group workers.
+  if (group_workers != nullptr) {
+    group_workers->rem_cell(cell_index);
+  }
+
   // Remove cell.
   cells.erase(cell_index);
 
@@ -61,6 +80,9 @@ void scheduler_impl::handle_cell_activation_request(du_cell_index_t cell_index)
 void scheduler_impl::handle_cell_deactivation_request(du_cell_index_t cell_index)
 {
   ocudu_assert(cells.contains(cell_index), "cell={} does not exist", fmt::underlying(cell_index));
+  if (group_workers != nullptr) {
+    group_workers->pause_cell(cell_index);
+  }
   cells[cell_index]->stop();
 }
 
@@ -215,7 +237,13 @@ const sched_result& scheduler_impl::slot_indication(slot_point_extended sl_tx,
   }
 
   // > Run scheduler for the given slot and cell.
-  cell.run_slot(sl_tx);
+  if (group_workers != nullptr) {
+    // Waiting for the cell group workers is blocking by design.
+    OCUDU_RTSAN_SCOPED_DISABLER(d);
+    group_workers->run_slot(sl_tx, cell_index);
+  } else {
+    cell.run_slot(sl_tx);
+  }
 
   // Return result for the slot.
   return cell.last_result();
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "cell_group_slot_workers.h"
 #include "cell_scheduler.h"
 #include "config/sched_config_manager.h"
 #include "logging/scheduler_metrics_handler.h"
@@ -22,7 +23,9 @@ namespace ocudu {
 class scheduler_impl final : public mac_scheduler
 {
 public:
-  explicit scheduler_impl(const scheduler_config& sched_cfg);
+  /// \param[in] trace_writer Writer of the scheduler input trace, where the scheduler inputs are recorded as they are
+  /// processed. Null if the scheduler inputs are not recorded.
+  explicit scheduler_impl(const scheduler_config& sched_cfg, scheduler_input_trace_writer* trace_writer = nullptr);
 
   bool handle_cell_configuration_request(const sched_cell_configuration_request_message& msg) override;
   void handle_cell_removal_request(du_cell_index_t cell_index) override;
@@ -73,6 +76,8 @@ private:
 
   ocudulog::basic_logger& logger;
 
+  scheduler_input_trace_writer* trace_writer;
+
   // Slot metrics sink.
   scheduler_metrics_handler metrics;
 
@@ -84,6 +89,9 @@ private:
 
   /// Container of DU Cell-specific resources.
   slotted_id_table<du_cell_index_t, std::unique_ptr<cell_scheduler>, MAX_NOF_DU_CELLS> cells;
+
+  /// Dedicated workers that schedule the DU Cell Groups concurrently. Null if the cells are scheduled inline.
+  std::unique_ptr<cell_group_slot_workers> group_workers;
 };
 
 } // namespace ocudu
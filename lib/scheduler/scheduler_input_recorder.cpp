@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "scheduler_input_recorder.h"
+
+using namespace ocudu;
+
+bool scheduler_input_recorder::handle_cell_configuration_request(const sched_cell_configuration_request_message& msg)
+{
+  writer->write_cell_configuration(make_sched_trace_cell_config(msg));
+  return sched->handle_cell_configuration_request(msg);
+}
+
+void scheduler_input_recorder::handle_cell_removal_request(du_cell_index_t cell_index)
+{
+  writer->write_cell_removal(cell_index);
+  sched->handle_cell_removal_request(cell_index);
+}
+
+void scheduler_input_recorder::handle_cell_activation_request(du_cell_index_t cell_index)
+{
+  writer->write_cell_activation(cell_index);
+  sched->handle_cell_activation_request(cell_index);
+}
+
+void scheduler_input_recorder::handle_cell_deactivation_request(du_cell_index_t cell_index)
+{
+  writer->write_cell_deactivation(cell_index);
+  sched->handle_cell_deactivation_request(cell_index);
+}
+
+const sched_result& scheduler_input_recorder::slot_indication(slot_point_extended sl_tx,
+                                                              du_cell_index_t     cell_index) noexcept
+{
+  const sched_result& result = sched->slot_indication(sl_tx, cell_index);
+
+  // The slot indication is written after the inputs processed by the scheduler in this slot.
+  writer->write_slot_indication(sl_tx, cell_index);
+  writer->write_slot_result(make_sched_trace_slot_result(cell_index, sl_tx.without_hyper_sfn(), result));
+  return result;
+}
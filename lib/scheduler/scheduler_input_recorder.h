@@ -0,0 +1,123 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "logging/scheduler_input_trace.h"
+#include "ocudu/scheduler/mac_scheduler.h"
+#include <memory>
+
+namespace ocudu {
+
+/// \brief Scheduler decorator that records the scheduler inputs in a scheduler input trace.
+///
+/// The cell configuration and activity inputs are written to the trace before being forwarded to the decorated
+/// scheduler. The UE configuration and feedback inputs are queued by the scheduler until the slot indication that
+/// processes them, so they are written by the decorated scheduler at that point, which must be created with the same
+/// trace writer. The slot indication and the summary of its scheduling result are written after the slot indication
+/// returns, i.e. after the inputs it processed. Thus, replaying the trace against a fresh scheduler processes each
+/// input in the same slot as the recorded scheduler, which allows profiling scheduler changes with recorded traffic
+/// and feedback patterns.
+///
+/// \remark SRS indications, paging information, SI updates, slice reconfigurations and positioning requests are
+/// forwarded without being recorded.
+class scheduler_input_recorder final : public mac_scheduler
+{
+public:
+  scheduler_input_recorder(std::unique_ptr<mac_scheduler>                sched_,
+                           std::unique_ptr<scheduler_input_trace_writer> writer_) :
+    writer(std::move(writer_)), sched(std::move(sched_))
+  {
+  }
+
+  bool handle_cell_configuration_request(const sched_cell_configuration_request_message& msg) override;
+  void handle_cell_removal_request(du_cell_index_t cell_index) override;
+
+  // Cell activity.
+  void handle_cell_activation_request(du_cell_index_t cell_index) override;
+  void handle_cell_deactivation_request(du_cell_index_t cell_index) override;
+
+  void handle_slice_reconfiguration_request(const du_cell_slice_reconfig_request& req) override
+  {
+    sched->handle_slice_reconfiguration_request(req);
+  }
+
+  // Sys Info handling.
+  void handle_si_update_request(const si_scheduling_update_request& req) override
+  {
+    sched->handle_si_update_request(req);
+  }
+
+  // scheduler_slot_handler interface methods.
+  const sched_result& slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index) noexcept override;
+  void handle_error_indication(slot_point sl_tx, du_cell_index_t cell_index, error_outcome event) override
+  {
+    sched->handle_error_indication(sl_tx, cell_index, event);
+  }
+
+  // DU manager events.
+  void handle_ue_creation_request(const sched_ue_creation_request_message& ue_request) override
+  {
+    sched->handle_ue_creation_request(ue_request);
+  }
+  void handle_ue_reconfiguration_request(const sched_ue_reconfiguration_message& ue_request) override
+  {
+    sched->handle_ue_reconfiguration_request(ue_request);
+  }
+  void handle_ue_removal_request(du_ue_index_t ue_index) override { sched->handle_ue_removal_request(ue_index); }
+  void handle_ue_config_applied(du_ue_index_t ue_index) override { sched->handle_ue_config_applied(ue_index); }
+  void handle_ue_deactivation_request(du_ue_index_t ue_index) override
+  {
+    sched->handle_ue_deactivation_request(ue_index);
+  }
+
+  // F1 events.
+  void handle_paging_information(const sched_paging_information& pi) override { sched->handle_paging_information(pi); }
+
+  // RLC events.
+  void handle_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs) override
+  {
+    sched->handle_dl_buffer_state_indication(bs);
+  }
+
+  // MAC events.
+  void handle_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce) override
+  {
+    sched->handle_dl_mac_ce_indication(mac_ce);
+  }
+  void handle_ul_bsr_indication(const ul_bsr_indication_message& bsr) override { sched->handle_ul_bsr_indication(bsr); }
+  void handle_ul_phr_indication(const ul_phr_indication_message& phr_ind) override
+  {
+    sched->handle_ul_phr_indication(phr_ind);
+  }
+
+  // PHY events.
+  void handle_rach_indication(const rach_indication_message& msg) override { sched->handle_rach_indication(msg); }
+  void handle_crc_indication(const ul_crc_indication& crc) override { sched->handle_crc_indication(crc); }
+  void handle_uci_indication(const uci_indication& uci) override { sched->handle_uci_indication(uci); }
+  void handle_srs_indication(const srs_indication& srs) override { sched->handle_srs_indication(srs); }
+
+  // Positioning events.
+  void handle_positioning_measurement_request(const positioning_measurement_request& req) override
+  {
+    sched->handle_positioning_measurement_request(req);
+  }
+  void handle_positioning_measurement_stop(const positioning_measurement_stop_request& req) override
+  {
+    sched->handle_positioning_measurement_stop(req);
+  }
+
+private:
+  /// Trace writer, shared with the decorated scheduler. Declared first so that it outlives the decorated scheduler.
+  std::unique_ptr<scheduler_input_trace_writer> writer;
+  std::unique_ptr<mac_scheduler>                sched;
+};
+
+} // namespace ocudu
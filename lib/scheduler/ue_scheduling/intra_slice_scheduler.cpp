@@ -239,8 +239,13 @@ static std::pair<unsigned, unsigned> get_max_grants_and_rb_grant_size(span<const
 
   unsigned ues_to_alloc = max_ue_grants_to_alloc;
 
-  // [Implementation-defined] We use the same searchSpace config to determine the number of RBs available.
-  const ue_cell_configuration& ue_cfg  = ue_candidates[0].ue->get_cc().cfg();
+  // [Implementation-defined] We use the searchSpace config of the highest priority UE to determine the number of RBs
+  // available. The candidate list is not sorted at this point, so the UE is searched for.
+  const auto top_candidate =
+      std::max_element(ue_candidates.begin(), ue_candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.priority < rhs.priority;
+      });
+  const ue_cell_configuration& ue_cfg  = top_candidate->ue->get_cc().cfg();
   const search_space_id        ss_id   = ue_cfg.init_bwp().dl_ded.value()->pdcch_cfg->search_spaces.back().get_id();
   const auto*                  ss_info = ue_cfg.find_search_space(ss_id);
   if (ss_info == nullptr) {
@@ -384,6 +389,26 @@ unsigned intra_slice_scheduler::schedule_ul_retx_candidates(ul_ran_slice_candida
   return alloc_count;
 }
 
+/// \brief Sorts by priority in descending order the next batch of UE candidates that follow the already sorted ones.
+///
+/// Only the candidates that are visited during the allocation need to be sorted. So, rather than sorting the whole
+/// candidate list, the candidates with the highest priority are selected in batches with an O(N) partial selection.
+/// \return Number of sorted candidates at the beginning of the list.
+static unsigned
+sort_next_newtx_candidates(span<ue_newtx_candidate> candidates, unsigned nof_sorted, unsigned batch_size)
+{
+  auto cmp = [](const ue_newtx_candidate& a, const ue_newtx_candidate& b) { return a.priority > b.priority; };
+
+  auto first = candidates.begin() + nof_sorted;
+  auto last  = first + std::min(std::max(batch_size, 1U), static_cast<unsigned>(candidates.size()) - nof_sorted);
+  if (last != candidates.end()) {
+    // Move the candidates with the highest priority to the batch.
+    std::nth_element(first, last - 1, candidates.end(), cmp);
+  }
+  std::sort(first, last, cmp);
+  return last - candidates.begin();
+}
+
 void intra_slice_scheduler::prepare_newtx_dl_candidates(const dl_ran_slice_candidate& slice,
                                                         scheduler_policy&             dl_policy)
 {
@@ -400,16 +425,11 @@ void intra_slice_scheduler::prepare_newtx_dl_candidates(const dl_ran_slice_candi
   // Compute priorities using the provided policy.
   dl_policy.compute_ue_dl_priorities(pdcch_slot, pdsch_slot, newtx_candidates);
 
-  // Sort candidates by priority in descending order.
-  std::sort(newtx_candidates.begin(), newtx_candidates.end(), [](const auto& a, const auto& b) {
-    return a.priority > b.priority;
-  });
-
-  // Remove candidates with forbid priority.
-  auto rit = std::find_if(newtx_candidates.rbegin(), newtx_candidates.rend(), [](const auto& cand) {
-    return cand.priority != forbid_sched_priority;
+  // Remove candidates with forbid priority. The remaining candidates are sorted by priority lazily, during allocation.
+  auto it = std::remove_if(newtx_candidates.begin(), newtx_candidates.end(), [](const auto& cand) {
+    return cand.priority == forbid_sched_priority;
   });
-  newtx_candidates.erase(rit.base(), newtx_candidates.end());
+  newtx_candidates.erase(it, newtx_candidates.end());
 }
 
 void intra_slice_scheduler::prepare_newtx_ul_candidates(const ul_ran_slice_candidate& slice,
@@ -428,16 +448,11 @@ void intra_slice_scheduler::prepare_newtx_ul_candidates(const ul_ran_slice_candi
   // Compute priorities using the provided policy.
   ul_policy.compute_ue_ul_priorities(pdcch_slot, pusch_slot, newtx_candidates);
 
-  // Sort candidates by priority in descending order.
-  std::sort(newtx_candidates.begin(), newtx_candidates.end(), [](const auto& a, const auto& b) {
-    return a.priority > b.priority;
+  // Remove candidates with forbid priority. The remaining candidates are sorted by priority lazily, during allocation.
+  auto it = std::remove_if(newtx_candidates.begin(), newtx_candidates.end(), [](const auto& cand) {
+    return cand.priority == forbid_sched_priority;
   });
-
-  // Remove candidates with forbid priority.
-  auto rit = std::find_if(newtx_candidates.rbegin(), newtx_candidates.rend(), [](const auto& cand) {
-    return cand.priority != forbid_sched_priority;
-  });
-  newtx_candidates.erase(rit.base(), newtx_candidates.end());
+  newtx_candidates.erase(it, newtx_candidates.end());
 }
 
 unsigned intra_slice_scheduler::schedule_dl_newtx_candidates(dl_ran_slice_candidate& slice,
@@ -458,9 +473,21 @@ unsigned intra_slice_scheduler::schedule_dl_newtx_candidates(dl_ran_slice_candid
   }
 
   // Stage 1: Pre-select UEs with the highest priority and reserve control-plane space for their DL grants.
+  // [Implementation-defined] The candidates are sorted in batches of twice the number of grants to allocate, bounded by
+  // the remaining allocation attempts, as allocation failures are expected to be rare.
+  const unsigned batch_size = std::min(2 * max_ue_grants_to_alloc,
+                                       expert_cfg.max_pdcch_alloc_attempts_per_slot -
+                                           std::min(dl_attempts_count, expert_cfg.max_pdcch_alloc_attempts_per_slot));
+
+  unsigned nof_sorted                 = 0;
   unsigned rb_count                   = 0;
   bool     pucch_grant_limit_exceeded = false;
-  for (const auto& ue_candidate : newtx_candidates) {
+  for (unsigned cand_idx = 0, nof_cands = newtx_candidates.size(); cand_idx != nof_cands; ++cand_idx) {
+    if (cand_idx == nof_sorted) {
+      nof_sorted = sort_next_newtx_candidates(newtx_candidates, nof_sorted, batch_size);
+    }
+    const auto& ue_candidate = newtx_candidates[cand_idx];
+
     if (pucch_grant_limit_exceeded) {
       // The PUCCH is likely saturated and there is no space for new PUCCHs.
       // As a heuristic, we only allocate DL grants to UEs which already have a PUCCH or a PUSCH in a future slot that
@@ -589,8 +616,20 @@ unsigned intra_slice_scheduler::schedule_ul_newtx_candidates(ul_ran_slice_candid
   }
 
   // Stage 1: Pre-select UEs with the highest priority and reserve control-plane space for their UL grants.
-  unsigned rb_count = 0;
-  for (const auto& ue_candidate : newtx_candidates) {
+  // [Implementation-defined] The candidates are sorted in batches of twice the number of grants to allocate, bounded by
+  // the remaining allocation attempts, as allocation failures are expected to be rare.
+  const unsigned batch_size = std::min(2 * max_ue_grants_to_alloc,
+                                       expert_cfg.max_pdcch_alloc_attempts_per_slot -
+                                           std::min(ul_attempts_count, expert_cfg.max_pdcch_alloc_attempts_per_slot));
+
+  unsigned nof_sorted = 0;
+  unsigned rb_count   = 0;
+  for (unsigned cand_idx = 0, nof_cands = newtx_candidates.size(); cand_idx != nof_cands; ++cand_idx) {
+    if (cand_idx == nof_sorted) {
+      nof_sorted = sort_next_newtx_candidates(newtx_candidates, nof_sorted, batch_size);
+    }
+    const auto& ue_candidate = newtx_candidates[cand_idx];
+
     // Create UL grant builder.
     // NOTE: the symbols passed to the grant are the symbols that are available for PUSCH and for which the used VRBs
     // have been computed.
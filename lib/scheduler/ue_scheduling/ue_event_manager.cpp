@@ -10,6 +10,7 @@
 
 #include "ue_event_manager.h"
 #include "../logging/scheduler_event_logger.h"
+#include "../logging/scheduler_input_trace.h"
 #include "../logging/scheduler_metrics_handler.h"
 #include "../srs/srs_scheduler.h"
 #include "../support/sr_helper.h"
@@ -82,6 +83,10 @@ public:
         continue;
       }
 
+      if (parent.trace_writer != nullptr) {
+        parent.trace_writer->write_dl_buffer_state_indication(dl_bo);
+      }
+
       // Retrieve UE.
       if (not parent.ue_db.contains(dl_bo.ue_index)) {
         parent.logger.warning("ue={}: Discarding DL buffer occupancy update. Cause: UE not recognized",
@@ -207,6 +212,7 @@ ue_cell_event_manager::ue_cell_event_manager(ue_event_manager&          parent_,
   srs_sched(cell_ev.srs_sched),
   metrics(cell_ev.metrics),
   ev_logger(cell_ev.ev_logger),
+  trace_writer(cell_ev.trace_writer),
   ind_pdu_pool(std::make_unique<pdu_indication_pool>(logger)),
   dl_bo_mng(std::make_unique<ue_dl_buffer_occupancy_manager>(*this)),
   pending_events(CELL_EVENT_LIST_SIZE)
@@ -263,6 +269,13 @@ void ue_cell_event_manager::handle_ue_creation(ue_config_update_event ev)
   auto handle_ue_creation_impl = [this, ev = std::move(ev)]() mutable {
     const du_ue_index_t ue_index = ev.get_ue_index();
     const rnti_t        crnti    = ev.next_config().crnti;
+    if (trace_writer != nullptr) {
+      const slot_point ul_ccch_slot_rx = ev.get_ul_ccch_slot_rx();
+      trace_writer->write_ue_creation(make_sched_trace_ue_config(
+          ev.next_config(),
+          ev.get_fallback_command().value_or(false),
+          ul_ccch_slot_rx.valid() ? std::optional<slot_point>{ul_ccch_slot_rx} : std::nullopt));
+    }
     if (ue_db.contains(ue_index)) {
       logger.error("ue={} rnti={}: Discarding UE creation. Cause: A UE with the same index already exists",
                    fmt::underlying(ue_index),
@@ -306,6 +319,9 @@ void ue_cell_event_manager::handle_ue_reconfiguration(ue_config_update_event ev)
 
   auto handle_ue_reconf_impl = [this, ev = std::move(ev)]() mutable {
     const du_ue_index_t ue_idx = ev.get_ue_index();
+    if (trace_writer != nullptr) {
+      trace_writer->write_ue_reconfiguration(make_sched_trace_ue_config(ev.next_config(), false, std::nullopt));
+    }
     if (not ue_db.contains(ue_idx)) {
       return event_result::invalid_ue;
     }
@@ -343,6 +359,9 @@ void ue_cell_event_manager::handle_ue_deletion(ue_config_delete_event ev)
 
   auto handle_ue_deletion_impl = [this, ev = std::move(ev)]() mutable {
     const du_ue_index_t ue_idx = ev.ue_index();
+    if (trace_writer != nullptr) {
+      trace_writer->write_ue_removal(ue_idx);
+    }
     if (not ue_db.contains(ue_idx)) {
       return event_result::invalid_ue;
     }
@@ -371,6 +390,10 @@ void ue_cell_event_manager::handle_ue_deletion(ue_config_delete_event ev)
 void ue_cell_event_manager::handle_ue_config_applied(du_cell_index_t pcell_idx, du_ue_index_t ue_idx)
 {
   auto handle_ue_config_applied_impl = [this, ue_idx]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_ue_config_applied(ue_idx);
+    }
+
     // Confirm that UE applied new config.
     ue_db.ue_config_applied(ue_idx);
 
@@ -389,6 +412,9 @@ void ue_cell_event_manager::handle_ue_config_applied(du_cell_index_t pcell_idx,
 void ue_cell_event_manager::handle_ue_deactivation_request(du_cell_index_t pcell_idx, du_ue_index_t ue_idx)
 {
   auto handle_ue_deactivation_impl = [this, ue_idx]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_ue_deactivation(ue_idx);
+    }
     if (not ue_db.contains(ue_idx)) {
       return event_result::invalid_ue;
     }
@@ -419,6 +445,9 @@ void ue_cell_event_manager::handle_ul_bsr_indication(const ul_bsr_indication_mes
   const du_ue_index_t   ue_index    = bsr_ind.ue_index;
 
   auto handle_ul_bsr_ind_impl = [this, bsr_ind = std::move(bsr_ind_ptr)]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_ul_bsr_indication(*bsr_ind);
+    }
     if (not ue_db.contains(bsr_ind->ue_index)) {
       return event_result::invalid_ue;
     }
@@ -461,6 +490,9 @@ void ue_cell_event_manager::handle_crc_indication(const ul_crc_indication& crc_i
     }
 
     auto crc_handle_impl = [this, sl_rx = crc_ind.sl_rx, crc_ptr = std::move(crc_ind_ptr)]() -> event_result {
+      if (trace_writer != nullptr) {
+        trace_writer->write_crc_indication(cfg.cell_index, sl_rx, span<const ul_crc_pdu_indication>(&*crc_ptr, 1));
+      }
       if (not ue_db.contains(crc_ptr->ue_index)) {
         return event_result::invalid_ue;
       }
@@ -511,6 +543,10 @@ void ue_cell_event_manager::handle_uci_indication(const uci_indication& ind)
     }
 
     auto uci_handle_impl = [this, uci_sl = ind.slot_rx, uci_pdu = std::move(uci_ptr)]() {
+      if (trace_writer != nullptr) {
+        trace_writer->write_uci_indication(cfg.cell_index, uci_sl, span<const uci_indication::uci_pdu>(&*uci_pdu, 1));
+      }
+
       // Fetch UE objects.
       if (not ue_db.contains(uci_pdu->ue_index)) {
         return event_result::invalid_ue;
@@ -701,6 +737,10 @@ void ue_cell_event_manager::handle_ul_phr_indication(const ul_phr_indication_mes
   const du_ue_index_t   ue_index    = phr_ind.ue_index;
 
   auto handle_phr_impl = [this, phr_ind = std::move(phr_ind_ptr)]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_ul_phr_indication(*phr_ind);
+    }
+
     // Fetch UE objects.
     if (not ue_db.contains(phr_ind->ue_index)) {
       return event_result::invalid_ue;
@@ -737,6 +777,9 @@ void ue_cell_event_manager::handle_ul_phr_indication(const ul_phr_indication_mes
 void ue_cell_event_manager::handle_dl_mac_ce_indication(const dl_mac_ce_indication& ce)
 {
   auto handle_mac_ce_impl = [this, ce]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_dl_mac_ce_indication(ce);
+    }
     if (not ue_db.contains(ce.ue_index)) {
       return event_result::invalid_ue;
     }
@@ -853,6 +896,10 @@ static void handle_discarded_pucch(const cell_slot_resource_allocator& prev_slot
 void ue_cell_event_manager::handle_error_indication(slot_point sl_tx, scheduler_slot_handler::error_outcome event)
 {
   auto handle_error_impl = [this, sl_tx, event]() {
+    if (trace_writer != nullptr) {
+      trace_writer->write_error_indication(sl_tx, cfg.cell_index, event);
+    }
+
     // Handle Error Indication.
 
     const cell_slot_resource_allocator* prev_slot_result = res_grid.get_history(sl_tx);
@@ -23,6 +23,7 @@ namespace ocudu {
 
 class cell_metrics_handler;
 class scheduler_event_logger;
+class scheduler_input_trace_writer;
 class uci_scheduler_impl;
 class cell_harq_manager;
 class srs_scheduler;
@@ -37,6 +38,8 @@ struct cell_creation_event {
   srs_scheduler&           srs_sched;
   cell_metrics_handler&    metrics;
   scheduler_event_logger&  ev_logger;
+  /// Writer of the scheduler input trace. Null if the scheduler inputs are not recorded.
+  scheduler_input_trace_writer* trace_writer = nullptr;
 };
 
 class ue_event_manager;
@@ -156,6 +159,8 @@ private:
   srs_scheduler&            srs_sched;
   cell_metrics_handler&     metrics;
   scheduler_event_logger&   ev_logger;
+  /// Records the events in the scheduler input trace when they are processed. Null if the inputs are not recorded.
+  scheduler_input_trace_writer* trace_writer;
 
   std::unique_ptr<pdu_indication_pool> ind_pdu_pool;
 
@@ -21,6 +21,7 @@ class pdcch_resource_allocator;
 struct cell_resource_allocator;
 class sched_ue_configuration_handler;
 class scheduler_event_logger;
+class scheduler_input_trace_writer;
 class cell_metrics_handler;
 
 /// Request to create a new cell handler in the UE scheduler.
@@ -40,6 +41,8 @@ struct ue_cell_scheduler_creation_request {
   cell_metrics_handler* cell_metrics;
   /// Logger of events for the cell.
   scheduler_event_logger* ev_logger;
+  /// Writer of the scheduler input trace. Null if the scheduler inputs are not recorded.
+  scheduler_input_trace_writer* trace_writer = nullptr;
 };
 
 /// Handler of UE grant scheduling for a given cell.
@@ -31,7 +31,8 @@ ue_cell_scheduler* ue_scheduler_impl::do_add_cell(const ue_cell_scheduler_creati
                                                        cell.slice_sched,
                                                        cell.srs_sched,
                                                        *params.cell_metrics,
-                                                       *params.ev_logger});
+                                                       *params.ev_logger,
+                                                       params.trace_writer});
 
   return &cell;
 }
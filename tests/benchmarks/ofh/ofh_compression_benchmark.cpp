@@ -36,7 +36,7 @@ static void usage(const char* prog)
 {
   fmt::print("Usage: {} [-R repetitions] [-T compression type] [-F factory type] [-s silent]\n", prog);
   fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
-  fmt::print("\t-T Type of compression [{{'none', 'bfp'}}, default is {}]\n", method);
+  fmt::print("\t-T Type of compression [{{'none', 'bfp', 'block scaling', 'mu law'}}, default is {}]\n", method);
   fmt::print("\t-F Select compression factory [Default {}]\n", impl_type);
   fmt::print("\t-B Channel bandwidth [Default {}]\n", fmt::underlying(bw));
   fmt::print("\t-C Subcarrier spacing. [Default {}]\n", to_string(scs));
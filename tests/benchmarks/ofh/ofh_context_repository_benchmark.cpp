@@ -0,0 +1,273 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Benchmark of the Open Fronthaul uplink context repository under contention.
+///
+/// Several receiver threads write the User-Plane sections of a slot into the repository concurrently, as the Open
+/// Fronthaul receivers of a multi-queue Ethernet interface do, and try to pop the symbols as soon as they are complete.
+
+#include "../../../lib/ofh/support/uplink_context_repository.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/phy/support/resource_grid_pool.h"
+#include "ocudu/phy/support/support_factories.h"
+#include "ocudu/support/benchmark_utils.h"
+#include <atomic>
+#include <getopt.h>
+#include <random>
+#include <thread>
+
+using namespace ocudu;
+using namespace ofh;
+
+// Random generator.
+static std::mt19937 rgen(0);
+
+static unsigned nof_repetitions       = 1000;
+static bool     silent                = false;
+static unsigned max_nof_threads       = 4;
+static unsigned nof_ports             = 2;
+static unsigned nof_prbs              = 273;
+static unsigned nof_prbs_per_section  = 16;
+static unsigned nof_symbols_per_slot  = get_nsymb_per_slot(cyclic_prefix::NORMAL);
+static unsigned repository_size_slots = 80;
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} [-R repetitions] [-T threads] [-P ports] [-B PRBs] [-S section PRBs] [-s silent]\n", prog);
+  fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
+  fmt::print("\t-T Maximum number of receiver threads [Default {}]\n", max_nof_threads);
+  fmt::print("\t-P Number of ports [from 1 to {}, default {}]\n", MAX_NOF_SUPPORTED_EAXC, nof_ports);
+  fmt::print("\t-B Number of PRBs of the resource grid [Default {}]\n", nof_prbs);
+  fmt::print("\t-S Number of PRBs per User-Plane section [Default {}]\n", nof_prbs_per_section);
+  fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int  opt         = 0;
+  bool invalid_arg = false;
+  while ((opt = getopt(argc, argv, "R:T:P:B:S:sh")) != -1) {
+    switch (opt) {
+      case 'R':
+        nof_repetitions = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'T':
+        max_nof_threads = std::strtol(optarg, nullptr, 10);
+        if (max_nof_threads == 0) {
+          fmt::print("Invalid number of threads\n");
+          invalid_arg = true;
+        }
+        break;
+      case 'P':
+        nof_ports = std::strtol(optarg, nullptr, 10);
+        if ((nof_ports < 1) || (nof_ports > MAX_NOF_SUPPORTED_EAXC)) {
+          fmt::print("Invalid number of ports\n");
+          invalid_arg = true;
+        }
+        break;
+      case 'B':
+        nof_prbs = std::strtol(optarg, nullptr, 10);
+        if ((nof_prbs < 1) || (nof_prbs > MAX_NOF_PRBS)) {
+          fmt::print("Invalid number of PRBs\n");
+          invalid_arg = true;
+        }
+        break;
+      case 'S':
+        nof_prbs_per_section = std::strtol(optarg, nullptr, 10);
+        if (nof_prbs_per_section == 0) {
+          fmt::print("Invalid number of PRBs per section\n");
+          invalid_arg = true;
+        }
+        break;
+      case 's':
+        silent = (!silent);
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        std::exit(0);
+    }
+    if (invalid_arg) {
+      usage(argv[0]);
+      std::exit(0);
+    }
+  }
+}
+
+namespace {
+
+/// User-Plane section written by the receiver threads.
+struct uplane_section {
+  unsigned symbol;
+  unsigned port;
+  unsigned start_re;
+  unsigned nof_re;
+};
+
+/// \brief Pool of receiver threads writing the sections of a slot into the uplink context repository.
+///
+/// The sections are distributed among the threads in round-robin. Every thread tries to pop the symbol after writing
+/// a section, like the Open Fronthaul receiver does.
+class receiver_thread_pool
+{
+public:
+  receiver_thread_pool(unsigned                   nof_threads,
+                       uplink_context_repository& repo_,
+                       span<const uplane_section> sections_,
+                       span<const cbf16_t>        iq_data_,
+                       std::atomic<unsigned>&     nof_popped_symbols_) :
+    repo(repo_), sections(sections_), iq_data(iq_data_), nof_popped_symbols(nof_popped_symbols_)
+  {
+    for (unsigned i_thread = 0; i_thread != nof_threads; ++i_thread) {
+      workers.emplace_back([this, i_thread, nof_threads]() { run(i_thread, nof_threads); });
+    }
+  }
+
+  ~receiver_thread_pool()
+  {
+    quit.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  /// Writes all the sections of the given slot and returns when all the threads have finished.
+  void write_slot(slot_point slot)
+  {
+    current_slot = slot;
+    nof_finished.store(0, std::memory_order_relaxed);
+    round.fetch_add(1, std::memory_order_release);
+    while (nof_finished.load(std::memory_order_acquire) != workers.size()) {
+      std::this_thread::yield();
+    }
+  }
+
+private:
+  void run(unsigned i_thread, unsigned nof_threads)
+  {
+    unsigned last_round = 0;
+    for (;;) {
+      while (round.load(std::memory_order_acquire) == last_round) {
+        if (quit.load(std::memory_order_acquire)) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+      ++last_round;
+
+      for (unsigned i_section = i_thread, nof_sections = sections.size(); i_section < nof_sections;
+           i_section += nof_threads) {
+        const uplane_section& section = sections[i_section];
+        repo.write_grid(
+            current_slot, section.port, section.symbol, section.start_re, iq_data.first(section.nof_re));
+        if (repo.try_popping_complete_resource_grid_symbol(current_slot, section.symbol)) {
+          nof_popped_symbols.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+
+      nof_finished.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  uplink_context_repository& repo;
+  span<const uplane_section> sections;
+  span<const cbf16_t>        iq_data;
+  std::atomic<unsigned>&     nof_popped_symbols;
+  std::vector<std::thread>   workers;
+  slot_point                 current_slot;
+  std::atomic<unsigned>      round        = {0};
+  std::atomic<unsigned>      nof_finished = {0};
+  std::atomic<bool>          quit         = {false};
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  ocudulog::init();
+  ocudulog::basic_logger& logger = ocudulog::fetch_basic_logger("TEST", false);
+  logger.set_level(ocudulog::basic_levels::none);
+
+  // Create a pool of resource grids. One grid per repository slot is enough to never reuse a grid that is still in
+  // the repository.
+  std::shared_ptr<resource_grid_factory> grid_factory = create_resource_grid_factory();
+  ocudu_assert(grid_factory, "Failed to create resource grid factory");
+  std::vector<std::unique_ptr<resource_grid>> grids;
+  for (unsigned i_grid = 0; i_grid != repository_size_slots; ++i_grid) {
+    grids.push_back(grid_factory->create(nof_ports, nof_symbols_per_slot, nof_prbs * NOF_SUBCARRIERS_PER_RB));
+  }
+  std::unique_ptr<resource_grid_pool> grid_pool = create_generic_resource_grid_pool(std::move(grids));
+  ocudu_assert(grid_pool, "Failed to create resource grid pool");
+
+  // Random IQ data of one section.
+  std::uniform_real_distribution<float> dist(-1.0, +1.0);
+  std::vector<cbf16_t>                  iq_data(nof_prbs_per_section * NOF_SUBCARRIERS_PER_RB);
+  std::generate(iq_data.begin(), iq_data.end(), [&]() { return cbf16_t{dist(rgen), dist(rgen)}; });
+
+  // Sections of a slot, ordered as the RU transmits them.
+  std::vector<uplane_section> sections;
+  unsigned                    nof_re_per_slot = 0;
+  for (unsigned i_symbol = 0; i_symbol != nof_symbols_per_slot; ++i_symbol) {
+    for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
+      for (unsigned start_prb = 0; start_prb < nof_prbs; start_prb += nof_prbs_per_section) {
+        unsigned section_nof_prbs = std::min(nof_prbs_per_section, nof_prbs - start_prb);
+        unsigned start_re         = start_prb * NOF_SUBCARRIERS_PER_RB;
+        unsigned section_nof_re   = section_nof_prbs * NOF_SUBCARRIERS_PER_RB;
+        sections.push_back({i_symbol, i_port, start_re, section_nof_re});
+        nof_re_per_slot += section_nof_re;
+      }
+    }
+  }
+
+  // Measure with a number of threads doubling up to the maximum.
+  std::vector<unsigned> thread_counts;
+  for (unsigned nof_threads = 1; nof_threads < max_nof_threads; nof_threads *= 2) {
+    thread_counts.push_back(nof_threads);
+  }
+  thread_counts.push_back(max_nof_threads);
+
+  benchmarker perf_meas("OFH uplink context repository", nof_repetitions);
+
+  for (unsigned nof_threads : thread_counts) {
+    uplink_context_repository repo(repository_size_slots);
+    std::atomic<unsigned>     nof_popped_symbols = {0};
+    receiver_thread_pool      pool(nof_threads, repo, sections, iq_data, nof_popped_symbols);
+
+    slot_point slot(to_numerology_value(subcarrier_spacing::kHz30), 0, 0);
+
+    std::string meas_descr = fmt::format("{} threads, {} ports, {} sections", nof_threads, nof_ports, sections.size());
+
+    perf_meas.new_measure_with_context(
+        meas_descr,
+        nof_re_per_slot,
+        [&]() {
+          // Add the slot context to the repository, as the uplink request handler does.
+          ++slot;
+          resource_grid_context context = {slot, 0};
+          repo.add(context, grid_pool->allocate_resource_grid(slot), {0, nof_symbols_per_slot}, logger);
+          repo.process_pending_contexts();
+        },
+        [&]() { pool.write_slot(slot); });
+
+    ocudu_assert(nof_popped_symbols == nof_repetitions * nof_symbols_per_slot,
+                 "Popped {} symbols while expecting {}",
+                 nof_popped_symbols.load(),
+                 nof_repetitions * nof_symbols_per_slot);
+  }
+
+  if (!silent) {
+    perf_meas.print_percentiles_time("microseconds", 1e-3);
+    perf_meas.print_percentiles_throughput("samples");
+  }
+}
@@ -12,6 +12,7 @@
 #include "ocudu/support/benchmark_utils.h"
 #include "ocudu/support/ocudu_assert.h"
 #include <getopt.h>
+#include <optional>
 #include <random>
 
 using namespace ocudu;
@@ -19,6 +20,7 @@ using namespace ocudu;
 // Random generator.
 static std::mt19937 rgen(0);
 
+static std::string dft_factory_str            = "all";
 static std::string fftw_optimization_str      = "estimate";
 static double      fftw_plan_creation_timeout = 1.0;
 static unsigned    nof_repetitions            = 1000;
@@ -27,6 +29,7 @@ static bool        silent                     = false;
 static void usage(const char* prog)
 {
   fmt::print("Usage: {} [-F DFT factory] [-R repetitions]\n", prog);
+  fmt::print("\t-F Select DFT factory (generic, fftw, fftz, ci16, all) [Default {}]\n", dft_factory_str);
   fmt::print("\t-O Select FFTW optimization flag (estimate, measure, exhaustive) [Default {}]\n",
              fftw_optimization_str);
   fmt::print("\t-T Select FFTW plan creation maximum time in seconds, set to zero or lower for infinite [Default {}]\n",
@@ -39,8 +42,11 @@ static void usage(const char* prog)
 static void parse_args(int argc, char** argv)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:O:T:sh")) != -1) {
+  while ((opt = getopt(argc, argv, "F:R:O:T:sh")) != -1) {
     switch (opt) {
+      case 'F':
+        dft_factory_str = std::string(optarg);
+        break;
       case 'R':
         nof_repetitions = std::strtol(optarg, nullptr, 10);
         break;
@@ -61,27 +67,71 @@ static void parse_args(int argc, char** argv)
   }
 }
 
+// Determines whether a DFT factory is selected for benchmarking.
+static bool is_factory_selected(const std::string& factory_str)
+{
+  return (dft_factory_str == "all") || (dft_factory_str == factory_str);
+}
+
 int main(int argc, char** argv)
 {
   parse_args(argc, argv);
 
   std::uniform_real_distribution<float> dist(-1.0, +1.0);
 
-  std::shared_ptr<dft_processor_factory> generic_dft_factory = create_dft_processor_factory_generic();
+  std::shared_ptr<dft_processor_factory> generic_dft_factory;
+  if (is_factory_selected("generic")) {
+    generic_dft_factory = create_dft_processor_factory_generic();
+  }
 
-  std::shared_ptr<dft_processor_factory> fftw_dft_factory =
-      create_dft_processor_factory_fftw(fftw_optimization_str, fftw_plan_creation_timeout);
+  std::shared_ptr<dft_processor_factory> fftw_dft_factory;
+  if (is_factory_selected("fftw")) {
+    fftw_dft_factory = create_dft_processor_factory_fftw(fftw_optimization_str, fftw_plan_creation_timeout);
+  }
 
-  // Create DFT for 16-bit complex integers. It might not be available for machines other than x86.
-  std::shared_ptr<dft_processor_ci16_factory> dft_ci16_factory = create_dft_processor_ci16_factory_avx2();
+  // Create DFT for 16-bit complex integers. The AVX2 implementation might not be available for machines other than
+  // x86, in which case the generic implementation is used.
+  std::shared_ptr<dft_processor_ci16_factory> dft_ci16_factory;
+  if (is_factory_selected("ci16")) {
+    dft_ci16_factory = create_dft_processor_ci16_factory_avx2();
+    if (!dft_ci16_factory) {
+      dft_ci16_factory = create_dft_processor_ci16_factory_generic();
+    }
+  }
 
-  std::shared_ptr<dft_processor_factory> fftz_dft_factory = create_dft_processor_factory_fftz();
+  std::shared_ptr<dft_processor_factory> fftz_dft_factory;
+  if (is_factory_selected("fftz")) {
+    fftz_dft_factory = create_dft_processor_factory_fftz();
+  }
 
   benchmarker perf_meas("DFT", nof_repetitions);
 
-  // Test for the most common DFT sizes
-  for (unsigned size :
-       {128, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 4608, 6144, 9216, 12288, 18432, 24576, 36864, 49152}) {
+  // Average execution time in nanoseconds of the generic and FFTW implementations for each DFT size and direction.
+  std::vector<std::tuple<unsigned, dft_processor::direction, double, double>> comparison;
+
+  // Measures a floating point DFT and returns its average execution time in nanoseconds.
+  auto measure_dft = [&perf_meas, &dist](dft_processor& dft, const std::string& factory_str) {
+    // Get DFT input buffer
+    span<cf_t> input = dft.get_input();
+
+    // Generate input random data.
+    for (cf_t& value : input) {
+      value = {dist(rgen), dist(rgen)};
+    }
+
+    // Measure performance.
+    uint64_t total_time_ns = perf_meas.get_total_meas_time_ns();
+    perf_meas.new_measure(
+        fmt::format("{} {} {}", factory_str, dft.get_size(), dft_processor::direction_to_string(dft.get_direction())),
+        dft.get_size(),
+        [&dft]() { dft.run(); });
+    return static_cast<double>(perf_meas.get_total_meas_time_ns() - total_time_ns) /
+           static_cast<double>(nof_repetitions);
+  };
+
+  // Test for the most common DFT sizes and the PRACH sequence lengths.
+  for (unsigned size : {128,  139,  256,  384,  512,   768,   839,   1024,  1536,  2048,  3072,
+                        4096, 4608, 6144, 9216, 12288, 18432, 24576, 36864, 49152}) {
     for (dft_processor::direction direction : {dft_processor::direction::DIRECT, dft_processor::direction::INVERSE}) {
       // Create FFTW configuration;
       dft_processor::configuration config;
@@ -89,59 +139,32 @@ int main(int argc, char** argv)
       config.dir  = direction;
 
       // Benchmark generic DFT if available.
-      {
+      std::optional<double> generic_time_ns;
+      if (generic_dft_factory) {
         std::unique_ptr<dft_processor> dft = generic_dft_factory->create(config);
         if (dft != nullptr) {
-          // Get DFT input buffer
-          span<cf_t> input = dft->get_input();
-
-          // Generate input random data.
-          for (cf_t& value : input) {
-            value = {dist(rgen), dist(rgen)};
-          }
-
-          // Measure performance.
-          perf_meas.new_measure(fmt::format("generic {} {}", size, dft_processor::direction_to_string(direction)),
-                                size,
-                                [&dft]() { dft->run(); });
+          generic_time_ns = measure_dft(*dft, "generic");
         }
       }
 
       // Benchmark FFTW DFT if available.
+      std::optional<double> fftw_time_ns;
       if (fftw_dft_factory) {
         std::unique_ptr<dft_processor> dft = fftw_dft_factory->create(config);
         if (dft != nullptr) {
-          // Get DFT input buffer
-          span<cf_t> input = dft->get_input();
-
-          // Generate input random data.
-          for (cf_t& value : input) {
-            value = {dist(rgen), dist(rgen)};
-          }
-
-          // Measure performance.
-          perf_meas.new_measure(fmt::format("fftw {} {}", size, dft_processor::direction_to_string(direction)),
-                                size,
-                                [&dft]() { dft->run(); });
+          fftw_time_ns = measure_dft(*dft, "fftw");
         }
       }
 
+      if (generic_time_ns.has_value() && fftw_time_ns.has_value()) {
+        comparison.emplace_back(size, direction, *generic_time_ns, *fftw_time_ns);
+      }
+
       // Benchmark FFTZ DFT if available.
       if (fftz_dft_factory) {
         std::unique_ptr<dft_processor> dft = fftz_dft_factory->create(config);
         if (dft != nullptr) {
-          // Get DFT input buffer
-          span<cf_t> input = dft->get_input();
-
-          // Generate input random data.
-          for (cf_t& value : input) {
-            value = {dist(rgen), dist(rgen)};
-          }
-
-          // Measure performance.
-          perf_meas.new_measure(fmt::format("fftz {} {}", size, dft_processor::direction_to_string(direction)),
-                                size,
-                                [&dft]() { dft->run(); });
+          measure_dft(*dft, "fftz");
         }
       }
 
@@ -172,6 +195,19 @@ int main(int argc, char** argv)
 
   if (!silent) {
     perf_meas.print_percentiles_throughput("samples");
+
+    // Print the comparison between the generic and the FFTW implementations.
+    if (!comparison.empty()) {
+      fmt::print("\n{:>6} {:>8} {:>14} {:>14} {:>8}\n", "size", "dir", "generic [ns]", "fftw [ns]", "speedup");
+      for (const auto& [size, direction, generic_time_ns, fftw_time_ns] : comparison) {
+        fmt::print("{:>6} {:>8} {:>14.1f} {:>14.1f} {:>8.2f}\n",
+                   size,
+                   dft_processor::direction_to_string(direction),
+                   generic_time_ns,
+                   fftw_time_ns,
+                   fftw_time_ns / generic_time_ns);
+      }
+    }
   }
 
   return 0;
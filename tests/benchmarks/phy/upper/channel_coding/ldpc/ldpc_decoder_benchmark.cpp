@@ -25,6 +25,7 @@ static unsigned     nof_iterations  = 6;
 static bool         silent          = false;
 static bool         use_crc         = false;
 static unsigned     l_size          = 0;
+static unsigned     batch_size      = 1;
 
 static void usage(const char* prog)
 {
@@ -35,13 +36,14 @@ static void usage(const char* prog)
   fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
   fmt::print("\t-C Toggle early stopping with CRC [Default {}]\n", use_crc);
   fmt::print("\t-L Lifting size - 0 for all [Default {}]\n", l_size);
+  fmt::print("\t-B Number of codeblocks decoded in a batch [Default {}]\n", batch_size);
   fmt::print("\t-h Show this message\n");
 }
 
 static void parse_args(int argc, char** argv)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:T:I:L:Csh")) != -1) {
+  while ((opt = getopt(argc, argv, "R:T:I:L:B:Csh")) != -1) {
     switch (opt) {
       case 'R':
         nof_repetitions = std::strtol(optarg, nullptr, 10);
@@ -55,6 +57,9 @@ static void parse_args(int argc, char** argv)
       case 'L':
         l_size = std::strtol(optarg, nullptr, 10);
         break;
+      case 'B':
+        batch_size = std::strtol(optarg, nullptr, 10);
+        break;
       case 'C':
         use_crc = (!use_crc);
         break;
@@ -76,8 +81,13 @@ int main(int argc, char** argv)
 {
   parse_args(argc, argv);
 
-  benchmarker perf_meas_generic(fmt::format("LDPC decoder {}, {} MS iterations", dec_type, nof_iterations),
-                                nof_repetitions);
+  TESTASSERT((batch_size > 0) && (batch_size <= ldpc_decoder::max_batch_size),
+             "The batch size must be between 1 and {}.",
+             ldpc_decoder::max_batch_size);
+
+  benchmarker perf_meas_generic(
+      fmt::format("LDPC decoder {}, {} MS iterations, batch of {}", dec_type, nof_iterations, batch_size),
+      nof_repetitions);
 
   span<const lifting_size_t>    use_ls;
   std::array<lifting_size_t, 1> one_ls = {lifting_size_t::LS384};
@@ -167,6 +177,15 @@ int main(int argc, char** argv)
         // Prepare message storage.
         dynamic_bit_buffer message(msg_length);
 
+        // Prepare the batch, all the codeblocks share the same soft bits.
+        std::vector<dynamic_bit_buffer>        batch_messages(batch_size, dynamic_bit_buffer(msg_length));
+        std::vector<ldpc_decoder::batch_entry> batch(batch_size);
+        for (unsigned i_cb = 0; i_cb != batch_size; ++i_cb) {
+          batch[i_cb].output = batch_messages[i_cb];
+          batch[i_cb].input  = codeblock;
+          batch[i_cb].crc    = crc16.get();
+        }
+
         ocudu::ldpc_decoder::configuration cfg_dec = {.base_graph      = bg,
                                                       .lifting_size    = ls,
                                                       .nof_filler_bits = 0,
@@ -180,8 +199,12 @@ int main(int argc, char** argv)
                        fmt::underlying(ls),
                        cb_length,
                        static_cast<double>(msg_length) / static_cast<double>(cb_length));
-        perf_meas_generic.new_measure(to_string(descr_buffer), msg_length, [&]() {
-          decoder->decode(message, codeblock, crc16.get(), cfg_dec);
+        perf_meas_generic.new_measure(to_string(descr_buffer), msg_length * batch_size, [&]() {
+          if (batch_size == 1) {
+            decoder->decode(message, codeblock, crc16.get(), cfg_dec);
+          } else {
+            decoder->decode_batch(batch, cfg_dec);
+          }
           do_not_optimize(codeblock);
         });
       }
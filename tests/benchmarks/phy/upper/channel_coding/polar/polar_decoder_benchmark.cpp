@@ -0,0 +1,133 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder benchmark.
+
+#include "ocudu/phy/upper/channel_coding/channel_coding_factories.h"
+#include "ocudu/support/benchmark_utils.h"
+#include "ocudu/support/ocudu_test.h"
+#include <getopt.h>
+#include <random>
+
+static std::mt19937 rgen(0);
+static std::string  dec_type        = "generic";
+static unsigned     nof_repetitions = 1000;
+static bool         silent          = false;
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} [-R repetitions] [-T decoder type] [-s silent]\n", prog);
+  fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
+  fmt::print("\t-T Decoder type generic, avx2, avx512, neon or auto [Default {}]\n", dec_type);
+  fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "R:T:sh")) != -1) {
+    switch (opt) {
+      case 'R':
+        nof_repetitions = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'T':
+        dec_type = std::string(optarg);
+        break;
+      case 's':
+        silent = (!silent);
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        std::exit(0);
+    }
+  }
+}
+
+using namespace ocudu;
+
+namespace {
+
+/// Benchmark case: polar code parameters and a short description of the channel using them.
+struct benchmark_case {
+  const char*     channel;
+  unsigned        K;
+  unsigned        E;
+  uint8_t         nMax;
+  polar_code_ibil ibil;
+};
+
+} // namespace
+
+static const std::vector<benchmark_case> benchmark_cases = {
+    {"PBCH", 56, 864, 9, polar_code_ibil::not_present},
+    {"PDCCH", 40, 108, 9, polar_code_ibil::not_present},
+    {"PDCCH", 64, 864, 9, polar_code_ibil::not_present},
+    {"PDCCH", 164, 1728, 9, polar_code_ibil::not_present},
+    {"UCI", 20, 256, 10, polar_code_ibil::present},
+    {"UCI", 100, 512, 10, polar_code_ibil::present},
+    {"UCI", 300, 1024, 10, polar_code_ibil::present},
+    {"UCI", 1000, 4096, 10, polar_code_ibil::present},
+};
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  benchmarker perf_meas(fmt::format("Polar decoder {}", dec_type), nof_repetitions);
+
+  std::shared_ptr<polar_factory> factory = create_polar_factory_sw(dec_type);
+  TESTASSERT(factory);
+
+  std::unique_ptr<polar_code> code = factory->create_code();
+  TESTASSERT(code);
+  std::unique_ptr<polar_allocator> allocator = factory->create_allocator();
+  TESTASSERT(allocator);
+  std::unique_ptr<polar_encoder> encoder = factory->create_encoder();
+  TESTASSERT(encoder);
+
+  for (const benchmark_case& bench_case : benchmark_cases) {
+    std::unique_ptr<polar_decoder> decoder = factory->create_decoder(bench_case.nMax);
+    TESTASSERT(decoder, "Decoder type {} is not supported.", dec_type);
+
+    code->set(bench_case.K, bench_case.E, bench_case.nMax, bench_case.ibil);
+    unsigned N = code->get_N();
+
+    // Generate a random message, allocate and encode it.
+    std::vector<uint8_t> message(bench_case.K);
+    std::generate(message.begin(), message.end(), []() { return rgen() & 1; });
+    std::vector<uint8_t> allocated(N);
+    allocator->allocate(allocated, message, *code);
+    std::vector<uint8_t> encoded(N);
+    encoder->encode(encoded, allocated, code->get_n());
+
+    // Convert the codeword to noisy LLRs.
+    std::normal_distribution<float>   noise(0.0F, 4.0F);
+    std::vector<log_likelihood_ratio> llr(N);
+    std::transform(encoded.begin(), encoded.end(), llr.begin(), [&noise](uint8_t bit) {
+      return log_likelihood_ratio::quantize((1.0F - 2.0F * bit) * 10.0F + noise(rgen), 40.0F);
+    });
+
+    std::vector<uint8_t> decoded(N);
+    perf_meas.new_measure(
+        fmt::format("{:<5} K={:<4} E={:<4} N={:<4}", bench_case.channel, bench_case.K, bench_case.E, N),
+        bench_case.K,
+        [&]() {
+          decoder->decode(decoded, llr, *code);
+          do_not_optimize(decoded);
+        });
+  }
+
+  if (!silent) {
+    perf_meas.print_percentiles_throughput("bits");
+  }
+}
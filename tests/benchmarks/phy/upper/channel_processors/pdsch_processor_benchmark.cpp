@@ -86,6 +86,7 @@ static constexpr auto sleep_duration = std::chrono::microseconds(10);
 static uint64_t                           nof_repetitions             = 10;
 static uint64_t                           nof_threads                 = max_nof_threads;
 static uint64_t                           batch_size_per_thread       = 100;
+static unsigned                           nof_pdsch_per_slot          = 1;
 static std::string                        selected_profile_name       = "default";
 static std::string                        ldpc_encoder_type           = "auto";
 static std::string                        pdsch_processor_type        = "flexible";
@@ -274,8 +275,8 @@ static const std::vector<test_profile> profile_set = {
 
 static void usage(const char* prog)
 {
-  fmt::print("Usage: {} [-m benchmark mode] [-R repetitions] [-B Batch size per thread] [-T number of threads] [-D "
-             "LDPC type] [-M rate "
+  fmt::print("Usage: {} [-m benchmark mode] [-R repetitions] [-B Batch size per thread] [-T number of threads] [-U "
+             "PDSCH per slot] [-D LDPC type] [-M rate "
              "matcher type] [-P profile] [-w] [-x] [-y] [-z error|warning|info|debug] [-h] [eal_args ...]\n",
              prog);
   fmt::print("\t-m Benchmark mode. [Default {}]\n", to_string(benchmark_mode));
@@ -289,6 +290,8 @@ static void usage(const char* prog)
   fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
   fmt::print("\t-B Batch size [Default {}]\n", batch_size_per_thread);
   fmt::print("\t-T Number of threads [Default {}, max. {}]\n", nof_threads, max_nof_threads);
+  fmt::print("\t-U Number of PDSCH transmissions per slot, they share the bandwidth evenly. [Default {}]\n",
+             nof_pdsch_per_slot);
   fmt::print("\t-D LDPC encoder type. [Default {}]\n", ldpc_encoder_type);
   fmt::print("\t-t PDSCH processor type. [Default {}]\n", pdsch_processor_type);
   fmt::print("\t\t generic        Unoptimized generic implementation.\n");
@@ -346,7 +349,7 @@ static std::string capture_eal_args(int* argc, char*** argv)
 static int parse_args(int argc, char** argv)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:T:B:D:P:m:t:o:wxyz:h")) != -1) {
+  while ((opt = getopt(argc, argv, "R:T:B:U:D:P:m:t:o:wxyz:h")) != -1) {
     switch (opt) {
       case 'R':
         nof_repetitions = std::strtol(optarg, nullptr, 10);
@@ -357,6 +360,9 @@ static int parse_args(int argc, char** argv)
       case 'B':
         batch_size_per_thread = std::strtol(optarg, nullptr, 10);
         break;
+      case 'U':
+        nof_pdsch_per_slot = std::max(1L, std::strtol(optarg, nullptr, 10));
+        break;
       case 'D':
         ldpc_encoder_type = std::string(optarg);
         break;
@@ -460,11 +466,17 @@ static std::vector<test_case_type> generate_test_cases(const test_profile& profi
 
   for (sch_mcs_description mcs : profile.mcs_set) {
     for (unsigned nof_prb : profile.nof_prb_set) {
+      // Number of PRB allocated to each PDSCH transmission of the slot.
+      unsigned nof_prb_pdsch = nof_prb / nof_pdsch_per_slot;
+      if (nof_prb_pdsch == 0) {
+        continue;
+      }
+
       for (unsigned i_rv : profile.rv_set) {
         // Determine the Transport Block Size.
         tbs_calculator_configuration tbs_config = {};
         tbs_config.mcs_descr                    = mcs;
-        tbs_config.n_prb                        = nof_prb;
+        tbs_config.n_prb                        = nof_prb_pdsch;
         tbs_config.nof_layers                   = precoding_config.get_nof_layers();
         tbs_config.nof_symb_sh                  = profile.nof_symbols;
         tbs_config.nof_dmrs_prb = dmrs.nof_dmrs_per_rb() * dmrs_symbol_mask.count() * nof_cdm_groups_without_data;
@@ -486,7 +498,7 @@ static std::vector<test_case_type> generate_test_cases(const test_profile& profi
             .scrambling_id               = 0,
             .n_scid                      = false,
             .nof_cdm_groups_without_data = nof_cdm_groups_without_data,
-            .freq_alloc                  = rb_allocation::make_type1(config.bwp_start_rb, nof_prb),
+            .freq_alloc                  = rb_allocation::make_type1(config.bwp_start_rb, nof_prb_pdsch),
             .start_symbol_index          = profile.start_symbol,
             .nof_symbols                 = profile.nof_symbols,
             .ldpc_base_graph             = get_ldpc_base_graph(mcs.get_normalised_target_code_rate(), units::bits(tbs)),
@@ -659,7 +671,7 @@ static pdsch_processor_factory& get_processor_factory()
 
     // When required create a synchronous PDSCH processor pool.
     if (nof_threads > 1) {
-      pdsch_proc_factory = create_pdsch_processor_pool(std::move(pdsch_proc_factory), nof_threads);
+      pdsch_proc_factory = create_pdsch_processor_pool(std::move(pdsch_proc_factory), nof_threads * nof_pdsch_per_slot);
       TESTASSERT(pdsch_proc_factory);
     }
 
@@ -703,8 +715,8 @@ static pdsch_processor_factory& get_processor_factory()
                                                                   nof_concurrent_pdsch,
                                                                   cb_batch_length);
 
-  // Wrap the PDSCH processor with a pool. It assumes that each thread will only spawn one PDSCH transmission.
-  pdsch_proc_factory = create_pdsch_processor_pool(std::move(pdsch_proc_factory), nof_threads);
+  // Wrap the PDSCH processor with a pool. It assumes that each thread spawns the PDSCH transmissions of one slot.
+  pdsch_proc_factory = create_pdsch_processor_pool(std::move(pdsch_proc_factory), nof_threads * nof_pdsch_per_slot);
 
   TESTASSERT(pdsch_proc_factory);
 
@@ -784,10 +796,11 @@ int main(int argc, char** argv)
     if (ldpc_encoder_type == "acc100") {
       hwacc_verbose = fmt::format(" ({} VFs)", nof_threads);
     }
-    fmt::print("Launching benchmark for {} threads, {} times per thread, and {} repetitions. Using {} profile, and {} "
-               "LDPC encoder{}.\n",
+    fmt::print("Launching benchmark for {} threads, {} slots of {} PDSCH per thread, and {} repetitions. Using {} "
+               "profile, and {} LDPC encoder{}.\n",
                nof_threads,
                batch_size_per_thread,
+               nof_pdsch_per_slot,
                nof_repetitions,
                selected_profile_name,
                ldpc_encoder_type,
@@ -812,8 +825,8 @@ int main(int argc, char** argv)
   pdsch_worker_pool = std::make_unique<task_worker_pool<queue_policy>>("worker", nof_threads, 1024, sleep_duration);
   pdsch_executor    = std::make_unique<task_worker_pool_executor<queue_policy>>(*pdsch_worker_pool);
 
-  // Prepare PDSCH processor notifiers.
-  std::vector<pdsch_processor_notifier_spy> notifiers(nof_threads);
+  // Prepare PDSCH processor notifiers, one for each PDSCH transmission of the slot.
+  std::vector<pdsch_processor_notifier_spy> notifiers(nof_threads * nof_pdsch_per_slot);
 
   for (const test_case_type& test_case : test_case_set) {
     // Get the PDSCH configuration.
@@ -822,6 +835,15 @@ int main(int argc, char** argv)
     // Get the TBS in bits.
     unsigned tbs = std::get<1>(test_case);
 
+    // Prepare the configuration of each PDSCH transmission of the slot. They use contiguous allocations.
+    unsigned                            nof_prb_pdsch = config.freq_alloc.get_nof_rb();
+    std::vector<pdsch_processor::pdu_t> pdus(nof_pdsch_per_slot, config);
+    for (unsigned i_pdsch = 0; i_pdsch != nof_pdsch_per_slot; ++i_pdsch) {
+      pdus[i_pdsch].rnti        = 1 + i_pdsch;
+      pdus[i_pdsch].bwp_size_rb = nof_prb_pdsch * nof_pdsch_per_slot;
+      pdus[i_pdsch].freq_alloc  = rb_allocation::make_type1(i_pdsch * nof_prb_pdsch, nof_prb_pdsch);
+    }
+
     // Create transport block.
     std::vector<uint8_t> data_vector(tbs / 8);
     std::generate(data_vector.begin(), data_vector.end(), [&rgen]() { return static_cast<uint8_t>(rgen() & 0xff); });
@@ -831,17 +853,20 @@ int main(int argc, char** argv)
 
     std::unique_ptr<pdsch_pdu_validator> validator = create_validator();
 
-    // Make sure the configuration is valid.
-    TESTASSERT(validator->is_valid(config));
+    // Make sure the configurations are valid.
+    for (const pdsch_processor::pdu_t& pdu : pdus) {
+      TESTASSERT(validator->is_valid(pdu));
+    }
 
     // Calculate the peak throughput, considering that the number of bits is for a slot.
     double slot_duration_us     = 1e3 / static_cast<double>(pow2(config.slot.numerology()));
-    double peak_throughput_Mbps = static_cast<double>(tbs) / slot_duration_us;
+    double peak_throughput_Mbps = static_cast<double>(tbs * nof_pdsch_per_slot) / slot_duration_us;
 
     // Measurement description.
     fmt::memory_buffer meas_description;
     fmt::format_to(std::back_inserter(meas_description),
-                   "PDSCH RB={:<3} Mod={:<6} rv={} - {:>5.1f} Mbps",
+                   "PDSCH UE={} RB={:<3} Mod={:<6} rv={} - {:>5.1f} Mbps",
+                   nof_pdsch_per_slot,
                    config.freq_alloc.get_nof_rb(),
                    to_string(config.codewords.front().modulation),
                    config.codewords.front().rv,
@@ -851,31 +876,36 @@ int main(int argc, char** argv)
 
     // Create benchmark routine.
     auto benchmark_task =
-        [&notifiers, &grids, &data, &config, &proc, &completion_counter]() noexcept OCUDU_RTSAN_NONBLOCKING {
+        [&notifiers, &grids, &data, &pdus, &proc, &completion_counter]() noexcept OCUDU_RTSAN_NONBLOCKING {
           // Reset counter.
           completion_counter = 0;
 
           // Spawn tasks for each therad.
           for (unsigned i_thread = 0; i_thread != nof_threads; ++i_thread) {
-            // Select notifier.
-            pdsch_processor_notifier_spy& notifier = notifiers[i_thread];
+            // Select the notifiers of the thread.
+            span<pdsch_processor_notifier_spy> pdsch_notifiers =
+                span<pdsch_processor_notifier_spy>(notifiers).subspan(i_thread * nof_pdsch_per_slot,
+                                                                      nof_pdsch_per_slot);
 
             bool success = pdsch_executor->execute(
-                [&notifier, &grids, &data, &config, &proc, &completion_counter]() noexcept OCUDU_RTSAN_NONBLOCKING {
+                [pdsch_notifiers, &grids, &data, &pdus, &proc, &completion_counter]() noexcept OCUDU_RTSAN_NONBLOCKING {
                   // Get a resource grid.
                   auto grid = grids.get();
                   report_fatal_error_if_not(grid, "Failed to retrieve resource grid.");
 
-                  // Repeat PDSCH transmission.
-                  for (unsigned i_pdsch = 0; i_pdsch != batch_size_per_thread; ++i_pdsch) {
-                    // Reset notifier.
-                    notifier.reset();
-
-                    // Process PDSCH transmission.
-                    proc->process(grid->get_writer(), notifier, {shared_transport_block(data)}, config);
-
-                    // Wait for notifier before starting next PDSCH transmission.
-                    notifier.wait_for_finished();
+                  // Repeat slot.
+                  for (unsigned i_slot = 0; i_slot != batch_size_per_thread; ++i_slot) {
+                    // Process all the PDSCH transmissions of the slot.
+                    for (unsigned i_pdsch = 0; i_pdsch != nof_pdsch_per_slot; ++i_pdsch) {
+                      pdsch_notifiers[i_pdsch].reset();
+                      proc->process(
+                          grid->get_writer(), pdsch_notifiers[i_pdsch], {shared_transport_block(data)}, pdus[i_pdsch]);
+                    }
+
+                    // Wait for all the PDSCH transmissions before starting the next slot.
+                    for (pdsch_processor_notifier_spy& notifier : pdsch_notifiers) {
+                      notifier.wait_for_finished();
+                    }
                   }
 
                   // Count the completion of the thread.
@@ -892,7 +922,8 @@ int main(int argc, char** argv)
         };
 
     // Run the benchmark.
-    perf_meas.new_measure(to_string(meas_description), nof_threads * batch_size_per_thread * tbs, benchmark_task);
+    perf_meas.new_measure(
+        to_string(meas_description), nof_threads * batch_size_per_thread * nof_pdsch_per_slot * tbs, benchmark_task);
   }
 
   // Print latency.
@@ -15,6 +15,7 @@
 #include "ocudu/support/error_handling.h"
 #include "ocudu/support/math/complex_normal_random.h"
 #include <getopt.h>
+#include <map>
 #include <random>
 #include <set>
 
@@ -76,6 +77,9 @@ static prach_detector_factory& get_detector_factory()
   }
 
   std::shared_ptr<dft_processor_factory> dft_proc_factory = create_dft_processor_factory_fftw_fast();
+  if (!dft_proc_factory) {
+    dft_proc_factory = create_dft_processor_factory_generic();
+  }
   report_fatal_error_if_not(dft_proc_factory, "Failed to create DFT processor factory.");
 
   std::shared_ptr<prach_generator_factory> prach_gen_factory = create_prach_generator_factory_sw();
@@ -191,6 +195,9 @@ int main(int argc, char** argv)
   // Create detector.
   std::unique_ptr<prach_detector> detector = create_detector();
 
+  // Total processing time in nanoseconds and number of processed occasions for each PRACH format.
+  std::map<prach_format_type, std::pair<uint64_t, uint64_t>> format_meas;
+
   for (const prach_detector::configuration& config : configurations) {
     // Make sure PRACH configuration is valid.
     report_fatal_error_if_not(validator->is_valid(config), "Invalid PRACH detector configuration {}.", config);
@@ -204,12 +211,26 @@ int main(int argc, char** argv)
     fmt::format_to(std::back_inserter(meas_description), "{}", config);
 
     // Run the benchmark.
+    uint64_t meas_time_ns = perf_meas.get_total_meas_time_ns();
     perf_meas.new_measure(
         to_string(meas_description), 1, [&detector, &buffer, &config]() { detector->detect(*buffer, config); });
+
+    // Accumulate the processing time of the PRACH format.
+    std::pair<uint64_t, uint64_t>& meas = format_meas[config.format];
+    meas.first += perf_meas.get_total_meas_time_ns() - meas_time_ns;
+    meas.second += nof_repetitions;
   }
 
   // Print processing time.
   perf_meas.print_percentiles_time("microseconds", 1e-3);
 
+  // Print the average number of PRACH occasions processed per second for each format.
+  fmt::print("\nPRACH detector throughput:\n");
+  for (const auto& [format, meas] : format_meas) {
+    fmt::print(" Format {:<3}: {:.1f} occasions per second\n",
+               to_string(format),
+               static_cast<double>(meas.second) * 1e9 / static_cast<double>(meas.first));
+  }
+
   return 0;
 }
@@ -82,6 +82,7 @@ static constexpr unsigned           max_nof_ports         = 4;
 static uint64_t                     nof_repetitions       = 1000;
 static uint64_t                     nof_threads           = 1;
 static uint64_t                     batch_size_per_thread = 100;
+static unsigned                     nof_ues_per_prb       = 1;
 static std::string                  selected_profile_name = "all";
 static benchmark_modes              benchmark_mode        = benchmark_modes::latency;
 
@@ -210,8 +211,8 @@ static const auto profile_set = to_array<test_profile>({
 
 static void usage(const char* prog)
 {
-  fmt::print("Usage: {} [-m benchmark mode] [-R repetitions] [-B Batch size per thread] [-T number of threads] [-P "
-             "profile] [-h]\n",
+  fmt::print("Usage: {} [-m benchmark mode] [-R repetitions] [-B Batch size per thread] [-T number of threads] [-U "
+             "UEs per PRB] [-P profile] [-h]\n",
              prog);
   fmt::print("\t-m Benchmark mode. [Default {}]\n", to_string(benchmark_mode));
   fmt::print("\t\t {:<20}It does not print any result.\n", to_string(benchmark_modes::silent));
@@ -223,6 +224,7 @@ static void usage(const char* prog)
   fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
   fmt::print("\t-B Batch size [Default {}]\n", batch_size_per_thread);
   fmt::print("\t-T Number of threads [Default {}, max. {}]\n", nof_threads, max_nof_threads);
+  fmt::print("\t-U Number of multiplexed PUCCH Format 0 and 1 transmissions per PRB [Default {}]\n", nof_ues_per_prb);
   fmt::print("\t-P Benchmark profile. [Default {}]\n", selected_profile_name);
   for (const test_profile& profile : profile_set) {
     fmt::print("\t\t {:<40} {}\n", profile.name, profile.description);
@@ -234,7 +236,7 @@ static void usage(const char* prog)
 static int parse_args(int argc, char** argv)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:T:B:P:m:h")) != -1) {
+  while ((opt = getopt(argc, argv, "R:T:B:U:P:m:h")) != -1) {
     switch (opt) {
       case 'R':
         nof_repetitions = std::strtol(optarg, nullptr, 10);
@@ -245,6 +247,9 @@ static int parse_args(int argc, char** argv)
       case 'B':
         batch_size_per_thread = std::strtol(optarg, nullptr, 10);
         break;
+      case 'U':
+        nof_ues_per_prb = std::strtol(optarg, nullptr, 10);
+        break;
       case 'P':
         selected_profile_name = std::string(optarg);
         break;
@@ -304,6 +309,9 @@ static pucch_processor_factory& get_pucch_processor_factory()
   TESTASSERT(prg_factory);
 
   std::shared_ptr<dft_processor_factory> dft_factory = create_dft_processor_factory_fftw_slow();
+  if (!dft_factory) {
+    dft_factory = create_dft_processor_factory_generic();
+  }
   TESTASSERT(dft_factory);
 
   std::shared_ptr<transform_precoder_factory> precoding_factory =
@@ -401,7 +409,44 @@ std::optional<ConfigType> get_config(const pucch_configuration& test_case)
   return std::nullopt;
 }
 
-static void thread_process(pucch_processor& proc, const pucch_configuration& config, const resource_grid_reader& grid)
+// Creates a batch of PUCCH Format 0 transmissions sharing the same resources, one per initial cyclic shift.
+static pucch_processor::format0_batch_configuration
+create_batch_config(const pucch_processor::format0_configuration& config, pucch_pdu_validator& validator)
+{
+  pucch_processor::format0_batch_configuration batch_config(config);
+  for (unsigned i_ue = 1; i_ue != nof_ues_per_prb; ++i_ue) {
+    pucch_processor::format0_configuration ue_config = config;
+    ue_config.initial_cyclic_shift                   = (config.initial_cyclic_shift + i_ue) % NOF_SUBCARRIERS_PER_RB;
+    TESTASSERT(validator.is_valid(ue_config));
+    batch_config.entries.insert(
+        ue_config.initial_cyclic_shift,
+        {.context = std::nullopt, .nof_harq_ack = ue_config.nof_harq_ack, .sr_opportunity = ue_config.sr_opportunity});
+  }
+  return batch_config;
+}
+
+// Creates a batch of PUCCH Format 1 transmissions sharing the same resources and time domain OCC, one per initial
+// cyclic shift.
+static pucch_processor::format1_batch_configuration
+create_batch_config(const pucch_processor::format1_configuration& config, pucch_pdu_validator& validator)
+{
+  pucch_processor::format1_batch_configuration batch_config(config);
+  for (unsigned i_ue = 1; i_ue != nof_ues_per_prb; ++i_ue) {
+    pucch_processor::format1_configuration ue_config = config;
+    ue_config.initial_cyclic_shift                   = (config.initial_cyclic_shift + i_ue) % NOF_SUBCARRIERS_PER_RB;
+    TESTASSERT(validator.is_valid(ue_config));
+    batch_config.entries.insert(ue_config.initial_cyclic_shift,
+                                ue_config.time_domain_occ,
+                                {.context = std::nullopt, .nof_harq_ack = ue_config.nof_harq_ack});
+  }
+  return batch_config;
+}
+
+static void thread_process(pucch_processor&                                    proc,
+                           const pucch_configuration&                          config,
+                           const pucch_processor::format0_batch_configuration& pucch0_batch,
+                           const pucch_processor::format1_batch_configuration& pucch1_batch,
+                           const resource_grid_reader&                         grid)
 {
   while (!thread_quit) {
     // If the pending count is equal to or lower than zero, wait for a new start.
@@ -418,10 +463,10 @@ static void thread_process(pucch_processor& proc, const pucch_configuration& con
       }
     }
 
-    if (auto pucch0 = get_config<pucch_processor::format0_configuration>(config)) {
-      proc.process(grid, *pucch0);
-    } else if (auto pucch1 = get_config<pucch_processor::format1_configuration>(config)) {
-      proc.process(grid, pucch_processor::format1_batch_configuration(*pucch1));
+    if (std::holds_alternative<pucch_processor::format0_configuration>(config)) {
+      proc.process(grid, pucch0_batch);
+    } else if (std::holds_alternative<pucch_processor::format1_configuration>(config)) {
+      proc.process(grid, pucch1_batch);
     } else if (auto pucch2 = get_config<pucch_processor::format2_configuration>(config)) {
       proc.process(grid, *pucch2);
     } else if (auto pucch3 = get_config<pucch_processor::format3_configuration>(config)) {
@@ -451,13 +496,23 @@ int main(int argc, char** argv)
     return ret;
   }
 
+  if ((nof_ues_per_prb == 0) || (nof_ues_per_prb > pucch_constants::format0_initial_cyclic_shift_range.stop())) {
+    fmt::print(stderr,
+               "Invalid number of UEs per PRB {}, it must be in the range (0, {}].\n",
+               nof_ues_per_prb,
+               pucch_constants::format0_initial_cyclic_shift_range.stop());
+    return -1;
+  }
+
   // Inform of the benchmark configuration.
   if (benchmark_mode != benchmark_modes::silent) {
-    fmt::print("Launching benchmark for {} threads, {} times per thread, and {} repetitions. Using {} profile.\n",
+    fmt::print("Launching benchmark for {} threads, {} times per thread, and {} repetitions. Using {} profile with {} "
+               "PUCCH Format 0 and 1 UEs per PRB.\n",
                nof_threads,
                batch_size_per_thread,
                nof_repetitions,
-               selected_profile_name);
+               selected_profile_name,
+               nof_ues_per_prb);
   }
 
   benchmarker perf_meas("pucch processor", nof_repetitions);
@@ -497,11 +552,20 @@ int main(int argc, char** argv)
     // Get the pucch configuration.
     const pucch_configuration& config = profile.pucch_config;
 
+    // Multiplexed Format 0 and 1 transmissions are processed together, the rest one by one.
+    pucch_processor::format0_batch_configuration pucch0_batch;
+    pucch_processor::format1_batch_configuration pucch1_batch;
+    unsigned                                     nof_tx_per_process = 1;
+
     // Make sure the configuration is valid.
     if (auto pucch0 = get_config<pucch_processor::format0_configuration>(config)) {
       TESTASSERT(validator->is_valid(*pucch0));
+      pucch0_batch       = create_batch_config(*pucch0, *validator);
+      nof_tx_per_process = nof_ues_per_prb;
     } else if (auto pucch1 = get_config<pucch_processor::format1_configuration>(config)) {
       TESTASSERT(validator->is_valid(*pucch1));
+      pucch1_batch       = create_batch_config(*pucch1, *validator);
+      nof_tx_per_process = nof_ues_per_prb;
     } else if (auto pucch2 = get_config<pucch_processor::format2_configuration>(config)) {
       TESTASSERT(validator->is_valid(*pucch2));
     } else if (auto pucch3 = get_config<pucch_processor::format3_configuration>(config)) {
@@ -522,9 +586,10 @@ int main(int argc, char** argv)
       unique_thread& thread = threads[thread_id];
 
       // Create thread.
-      thread = unique_thread("thread_" + std::to_string(thread_id), [&proc = *processor, &config, &grid] {
-        thread_process(proc, config, grid.get()->get_reader());
-      });
+      thread = unique_thread(
+          "thread_" + std::to_string(thread_id), [&proc = *processor, &config, &pucch0_batch, &pucch1_batch, &grid] {
+            thread_process(proc, config, pucch0_batch, pucch1_batch, grid.get()->get_reader());
+          });
     }
 
     // Wait for finish thread init.
@@ -533,7 +598,8 @@ int main(int argc, char** argv)
     }
 
     // Run the benchmark.
-    perf_meas.new_measure(profile.name, nof_threads * batch_size_per_thread, []() mutable {
+    // Throughput accounts for all the multiplexed transmissions, latency for each processing call.
+    perf_meas.new_measure(profile.name, nof_threads * batch_size_per_thread * nof_tx_per_process, []() mutable {
       // Notify start.
       finish_count  = 0;
       pending_count = nof_threads * batch_size_per_thread;
@@ -33,9 +33,10 @@ static void usage(const char* prog)
 {
   fmt::print("Usage: {} [-R repetitions] [-s silent]\n", prog);
   fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
-  fmt::print("\t-T Equalizer algorithm type {} or {} [Default {}]\n",
+  fmt::print("\t-T Equalizer algorithm type {}, {} or {} [Default {}]\n",
              to_string(channel_equalizer_algorithm_type::zf),
              to_string(channel_equalizer_algorithm_type::mmse),
+             to_string(channel_equalizer_algorithm_type::mmse_irc),
              to_string(equalizer_type));
   fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
   fmt::print("\t-h Show this message\n");
@@ -54,6 +55,8 @@ static void parse_args(int argc, char** argv)
           equalizer_type = channel_equalizer_algorithm_type::zf;
         } else if (std::strcmp(to_string(channel_equalizer_algorithm_type::mmse), optarg) == 0) {
           equalizer_type = channel_equalizer_algorithm_type::mmse;
+        } else if (std::strcmp(to_string(channel_equalizer_algorithm_type::mmse_irc), optarg) == 0) {
+          equalizer_type = channel_equalizer_algorithm_type::mmse_irc;
         } else {
           fmt::print("Invalid aLgorithm.\n");
           usage(argv[0]);
@@ -146,6 +149,12 @@ int main(int argc, char** argv)
     // Set the port noise variances.
     std::vector<float> noise_var_ests(nof_rx_ports, 0.1F);
 
+    // Set the interference-plus-noise covariance matrix, with some correlation between ports.
+    std::vector<cf_t> noise_covariance(nof_rx_ports * nof_rx_ports, 0.02F);
+    for (unsigned i_rx_port = 0; i_rx_port != nof_rx_ports; ++i_rx_port) {
+      noise_covariance[i_rx_port * nof_rx_ports + i_rx_port] = noise_var_ests[i_rx_port];
+    }
+
     // Number of equalized resource elements.
     unsigned nof_processed_re = nof_subcarriers * nof_ofdm_symbols * nof_tx_layers;
 
@@ -153,13 +162,16 @@ int main(int argc, char** argv)
     std::string meas_descr = std::string(to_string(equalizer_type)) + " " + fmt::to_string(nof_tx_layers) + "x" +
                              fmt::to_string(nof_rx_ports);
 
-    // Equalize.
-    perf_meas.new_measure(meas_descr,
-                          nof_processed_re,
-                          [&eq_symbols, &eq_noise_vars, &rx_symbols, &channel_ests, &noise_var_ests, &equalizer]() {
-                            equalizer->equalize(
-                                eq_symbols, eq_noise_vars, rx_symbols, channel_ests, noise_var_ests, 1.0F);
-                          });
+    // Equalize. Interference-aware equalizers take the covariance matrix instead of the noise variances.
+    if (equalizer->is_interference_aware()) {
+      perf_meas.new_measure(meas_descr, nof_processed_re, [&]() {
+        equalizer->equalize(eq_symbols, eq_noise_vars, rx_symbols, channel_ests, noise_covariance, 1.0F);
+      });
+    } else {
+      perf_meas.new_measure(meas_descr, nof_processed_re, [&]() {
+        equalizer->equalize(eq_symbols, eq_noise_vars, rx_symbols, channel_ests, noise_var_ests, 1.0F);
+      });
+    }
   }
 
   if (!silent) {
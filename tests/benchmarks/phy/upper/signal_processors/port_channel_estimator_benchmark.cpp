@@ -0,0 +1,193 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ocudu/phy/support/resource_grid.h"
+#include "ocudu/phy/support/resource_grid_writer.h"
+#include "ocudu/phy/support/support_factories.h"
+#include "ocudu/phy/upper/signal_processors/channel_estimator/factories.h"
+#include "ocudu/ran/cyclic_prefix.h"
+#include "ocudu/support/benchmark_utils.h"
+#include "ocudu/support/math/complex_normal_random.h"
+#include "ocudu/support/ocudu_test.h"
+#include <getopt.h>
+#include <random>
+
+using namespace ocudu;
+
+static unsigned nof_repetitions = 1000;
+static unsigned nof_rb          = 52;
+static bool     silent          = false;
+
+// DM-RS configuration of a benchmark case.
+struct dmrs_configuration {
+  // Number of transmit layers.
+  unsigned nof_layers;
+  // OFDM symbols carrying DM-RS.
+  std::vector<unsigned> dmrs_symbols;
+  // Time domain interpolation strategy.
+  port_channel_estimator_td_interpolation_strategy td_strategy;
+};
+
+static const std::vector<dmrs_configuration> dmrs_configuration_list = {
+    {1, {2}, port_channel_estimator_td_interpolation_strategy::average},
+    {1, {2, 11}, port_channel_estimator_td_interpolation_strategy::average},
+    {2, {2, 11}, port_channel_estimator_td_interpolation_strategy::average},
+    {2, {2, 7, 11}, port_channel_estimator_td_interpolation_strategy::interpolate},
+    {4, {2, 11}, port_channel_estimator_td_interpolation_strategy::average},
+    {4, {2, 5, 8, 11}, port_channel_estimator_td_interpolation_strategy::interpolate},
+};
+
+// DM-RS type 1 RE patterns for CDM groups 0 and 1.
+static const std::array<bounded_bitset<NOF_SUBCARRIERS_PER_RB>, 2> re_patterns = {
+    bounded_bitset<NOF_SUBCARRIERS_PER_RB>{true, false, true, false, true, false, true, false, true, false, true, false},
+    bounded_bitset<NOF_SUBCARRIERS_PER_RB>{false, true, false, true, false, true, false, true, false, true, false, true}};
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} [-n number of RB] [-R repetitions] [-s silent]\n", prog);
+  fmt::print("\t-n Number of resource blocks [Default {}]\n", nof_rb);
+  fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
+  fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "n:R:sh")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_rb = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'R':
+        nof_repetitions = std::strtol(optarg, nullptr, 10);
+        break;
+      case 's':
+        silent = (!silent);
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        std::exit(0);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::mt19937 rgen(0);
+
+  parse_args(argc, argv);
+
+  std::shared_ptr<dft_processor_factory> dft_factory = create_dft_processor_factory_fftw_slow();
+  if (!dft_factory) {
+    dft_factory = create_dft_processor_factory_generic();
+  }
+  TESTASSERT(dft_factory);
+
+  std::shared_ptr<time_alignment_estimator_factory> ta_est_factory =
+      create_time_alignment_estimator_dft_factory(dft_factory);
+  TESTASSERT(ta_est_factory);
+
+  std::shared_ptr<port_channel_estimator_factory> estimator_factory =
+      create_port_channel_estimator_factory_sw(ta_est_factory);
+  TESTASSERT(estimator_factory);
+
+  benchmarker perf_meas("Port channel estimator", nof_repetitions);
+
+  // Grid dimensions for all test cases.
+  unsigned grid_nof_symbols = get_nsymb_per_slot(cyclic_prefix::NORMAL);
+  unsigned grid_nof_subcs   = nof_rb * NOF_SUBCARRIERS_PER_RB;
+
+  // Create resource grid.
+  std::shared_ptr<resource_grid_factory> rg_factory = create_resource_grid_factory();
+  TESTASSERT(rg_factory);
+  std::unique_ptr<resource_grid> grid = rg_factory->create(1, grid_nof_symbols, grid_nof_subcs);
+  TESTASSERT(grid);
+
+  // Fill the grid with random RE.
+  complex_normal_distribution<cf_t> c_normal_dist = {};
+  for (unsigned i_symbol = 0; i_symbol != grid_nof_symbols; ++i_symbol) {
+    span<cbf16_t> re_view = grid->get_writer().get_view(0, i_symbol);
+    std::generate(re_view.begin(), re_view.end(), [&rgen, &c_normal_dist]() { return c_normal_dist(rgen); });
+  }
+
+  // Buffer for reading back the channel estimates.
+  std::vector<cbf16_t> ch_estimates(grid_nof_subcs);
+
+  for (const dmrs_configuration& dmrs_config : dmrs_configuration_list) {
+    std::unique_ptr<port_channel_estimator> estimator = estimator_factory->create(
+        port_channel_estimator_fd_smoothing_strategy::filter, dmrs_config.td_strategy, /* compensate_cfo = */ true);
+    TESTASSERT(estimator);
+
+    port_channel_estimator::configuration config;
+    config.scs          = subcarrier_spacing::kHz30;
+    config.cp           = cyclic_prefix::NORMAL;
+    config.first_symbol = 0;
+    config.nof_symbols  = grid_nof_symbols;
+    config.rx_ports     = {0};
+    config.scaling      = 1.0F;
+
+    bounded_bitset<MAX_NSYMB_PER_SLOT> symbol_mask(grid_nof_symbols);
+    for (unsigned i_symbol : dmrs_config.dmrs_symbols) {
+      symbol_mask.set(i_symbol);
+    }
+
+    crb_bitmap rb_mask(nof_rb);
+    rb_mask.fill(0, nof_rb);
+    for (unsigned i_layer = 0; i_layer != dmrs_config.nof_layers; ++i_layer) {
+      config.dmrs_pattern.push_back({.symbols              = symbol_mask,
+                                     .rb_mask              = rb_mask,
+                                     .rb_mask2             = {},
+                                     .hopping_symbol_index = std::nullopt,
+                                     .re_pattern           = re_patterns[i_layer / 2]});
+    }
+
+    // Generate random QPSK pilots.
+    dmrs_symbol_list pilots({.nof_subc    = grid_nof_subcs / 2,
+                             .nof_symbols = static_cast<unsigned>(dmrs_config.dmrs_symbols.size()),
+                             .nof_slices  = dmrs_config.nof_layers});
+    std::uniform_int_distribution<unsigned> qpsk_dist(0, 3);
+    for (unsigned i_layer = 0; i_layer != dmrs_config.nof_layers; ++i_layer) {
+      for (unsigned i_dmrs = 0, i_dmrs_end = dmrs_config.dmrs_symbols.size(); i_dmrs != i_dmrs_end; ++i_dmrs) {
+        span<cf_t> symbol_pilots = pilots.get_symbol(i_dmrs, i_layer);
+        std::generate(symbol_pilots.begin(), symbol_pilots.end(), [&rgen, &qpsk_dist]() {
+          unsigned value = qpsk_dist(rgen);
+          return cf_t((value & 1U) ? M_SQRT1_2 : -M_SQRT1_2, (value & 2U) ? M_SQRT1_2 : -M_SQRT1_2);
+        });
+      }
+    }
+
+    std::string meas_descr = fmt::format("layers={} dmrs_symbols={} td={}",
+                                         dmrs_config.nof_layers,
+                                         dmrs_config.dmrs_symbols.size(),
+                                         (dmrs_config.td_strategy ==
+                                          port_channel_estimator_td_interpolation_strategy::average)
+                                             ? "average"
+                                             : "interpolate");
+
+    // Measure the estimation and the read back of all the channel estimates of the slot.
+    perf_meas.new_measure(meas_descr, nof_rb * dmrs_config.nof_layers, [&]() {
+      const port_channel_estimator_results& results = estimator->compute(grid->get_reader(), 0, pilots, config);
+      for (unsigned i_layer = 0; i_layer != dmrs_config.nof_layers; ++i_layer) {
+        for (unsigned i_symbol = 0; i_symbol != grid_nof_symbols; ++i_symbol) {
+          results.get_symbol_ch_estimate(ch_estimates, i_symbol, i_layer);
+        }
+      }
+      do_not_optimize(results.get_noise_variance());
+    });
+  }
+
+  if (!silent) {
+    perf_meas.print_percentiles_time("microseconds", 1e-3);
+  }
+
+  return 0;
+}
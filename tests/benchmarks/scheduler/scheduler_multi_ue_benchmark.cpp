@@ -29,16 +29,24 @@ struct bench_params {
   unsigned nof_ues                = 32;
   unsigned dl_bs                  = 1000000;
   unsigned max_dl_grants_per_slot = 100;
+  unsigned ue_group_size          = 32;
+  unsigned nof_cells              = 1;
+  unsigned nof_workers            = 0;
   bool     debug                  = false;
 };
 
 static void usage(const char* prog, const bench_params& params)
 {
-  fmt::print("Usage: {} [-R repetitions] [-u UEs] [-b DL buffer] [-m Max DL UEs per slot] [-d]\n", prog);
+  fmt::print("Usage: {} [-R repetitions] [-u UEs] [-b DL buffer] [-m Max DL UEs per slot] [-g UE group size] "
+             "[-c cells] [-w workers] [-d]\n",
+             prog);
   fmt::print("\t-R Repetitions [Default {}]\n", params.nof_repetitions);
   fmt::print("\t-u Number of UEs [Default {}]\n", params.nof_ues);
   fmt::print("\t-b Average RLC DL buffer state [Default {}]\n", params.dl_bs);
   fmt::print("\t-m Maximum number of DL UE grants per slot [Default {}]\n", params.max_dl_grants_per_slot);
+  fmt::print("\t-g Number of UEs considered for newTx allocation in a slot [Default {}]\n", params.ue_group_size);
+  fmt::print("\t-c Number of cells, each in its own cell group [Default {}]\n", params.nof_cells);
+  fmt::print("\t-w Number of scheduler cell group workers [Default {}]\n", params.nof_workers);
   fmt::print("\t-d Debug mode [Default {}]\n", params.debug);
   fmt::print("\t-h Show this message\n");
 }
@@ -46,7 +54,7 @@ static void usage(const char* prog, const bench_params& params)
 static void parse_args(int argc, char** argv, bench_params& params)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:u:b:m:d:h")) != -1) {
+  while ((opt = getopt(argc, argv, "R:u:b:m:g:c:w:d:h")) != -1) {
     switch (opt) {
       case 'R':
         params.nof_repetitions = std::strtol(optarg, nullptr, 10);
@@ -60,6 +68,15 @@ static void parse_args(int argc, char** argv, bench_params& params)
       case 'm':
         params.max_dl_grants_per_slot = std::strtol(optarg, nullptr, 10);
         break;
+      case 'g':
+        params.ue_group_size = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'c':
+        params.nof_cells = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'w':
+        params.nof_workers = std::strtol(optarg, nullptr, 10);
+        break;
       case 'd':
         params.debug = std::strtol(optarg, nullptr, 10) > 0;
         break;
@@ -75,42 +92,56 @@ class multi_ue_sched_simulator
 {
 public:
   multi_ue_sched_simulator(const scheduler_expert_config&    expert_cfg_,
-                           const cell_config_builder_params& builder_params_) :
+                           const cell_config_builder_params& builder_params_,
+                           unsigned                          nof_cells) :
     expert_cfg(expert_cfg_),
     builder_params(builder_params_),
     logger(ocudulog::fetch_basic_logger("SCHED")),
     pucch_res_mng(expert_cfg_.ue.max_pucchs_per_slot),
     sch(create_scheduler(scheduler_config{expert_cfg, cfg_notif})),
-    next_sl_tx(builder_params.scs_common, 0)
+    next_sl_tx(builder_params.scs_common, 0),
+    results(nof_cells, nullptr),
+    sched_results(nof_cells)
   {
-    sched_cell_configuration_request_message cell_cfg_msg =
-        sched_config_helper::make_default_sched_cell_configuration_request(builder_params);
-    cell_cfg_msg.ran      = config_helpers::make_default_ran_cell_config(builder_params);
-    auto& pucch_resources = cell_cfg_msg.ran.init_bwp_builder.pucch.resources;
-    std::get<pucch_f2_params>(pucch_resources.f2_or_f3_or_f4_params).max_code_rate = max_pucch_code_rate::dot_35;
-    pucch_resources.nof_cell_csi_resources                                         = 4;
-    pucch_resources.nof_cell_sr_resources                                          = 2;
-    pucch_resources.res_set_0_size                                                 = 3;
-    pucch_resources.res_set_1_size                                                 = 6;
-
-    cell_cfgs = {cell_cfg_msg.ran};
-
-    sch->handle_cell_configuration_request(cell_cfg_msg);
-
-    pucch_res_mng.add_cell(to_du_cell_index(0), cell_cfgs[0]);
+    for (unsigned cell_idx = 0; cell_idx != nof_cells; ++cell_idx) {
+      cell_config_builder_params& cell_params = cell_builder_params.emplace_back(builder_params);
+      cell_params.pci                         = builder_params.pci + cell_idx;
+
+      sched_cell_configuration_request_message cell_cfg_msg =
+          sched_config_helper::make_default_sched_cell_configuration_request(cell_params);
+      cell_cfg_msg.ran              = config_helpers::make_default_ran_cell_config(cell_params);
+      cell_cfg_msg.cell_index       = to_du_cell_index(cell_idx);
+      cell_cfg_msg.cell_group_index = static_cast<du_cell_group_index_t>(cell_idx);
+      auto& pucch_resources         = cell_cfg_msg.ran.init_bwp_builder.pucch.resources;
+      std::get<pucch_f2_params>(pucch_resources.f2_or_f3_or_f4_params).max_code_rate = max_pucch_code_rate::dot_35;
+      pucch_resources.nof_cell_csi_resources                                         = 4;
+      pucch_resources.nof_cell_sr_resources                                          = 2;
+      pucch_resources.res_set_0_size                                                 = 3;
+      pucch_resources.res_set_1_size                                                 = 6;
+
+      cell_cfgs.push_back(cell_cfg_msg.ran);
+
+      sch->handle_cell_configuration_request(cell_cfg_msg);
+
+      pucch_res_mng.add_cell(to_du_cell_index(cell_idx), cell_cfgs.back());
+    }
 
     logger.set_context(next_sl_tx.sfn(), next_sl_tx.slot_index());
   }
 
   void add_ue()
   {
+    // Distribute the UEs among the cells.
+    const du_cell_index_t cell_index = to_du_cell_index(ue_count % cell_cfgs.size());
+
     sched_ue_creation_request_message ue_cfg_msg = sched_config_helper::create_default_sched_ue_creation_request(
-        builder_params, {lcid_t::LCID_SRB2, lcid_t::LCID_MIN_DRB});
+        cell_builder_params[cell_index], {lcid_t::LCID_SRB2, lcid_t::LCID_MIN_DRB});
     ue_cfg_msg.ue_index           = to_du_ue_index(ue_count);
     ue_cfg_msg.crnti              = to_rnti(0x4601 + ue_count);
     ue_cfg_msg.starts_in_fallback = false;
 
-    auto& pcell = (*ue_cfg_msg.cfg.cells)[0];
+    auto& pcell                    = (*ue_cfg_msg.cfg.cells)[0];
+    pcell.serv_cell_cfg.cell_index = cell_index;
 
     // Generate PUCCH resources for the UE.
     odu::cell_group_config cell_group;
@@ -135,25 +166,42 @@ public:
     }
   }
 
-  void run_slot() { result = &sch->slot_indication(next_sl_tx, to_du_cell_index(0)); }
+  void run_slot()
+  {
+    for (unsigned cell_idx = 0, nof_cells = results.size(); cell_idx != nof_cells; ++cell_idx) {
+      results[cell_idx] = &sch->slot_indication(next_sl_tx, to_du_cell_index(cell_idx));
+    }
+  }
 
   void process_results()
   {
     slot_point_extended result_sl_tx = next_sl_tx;
     ++next_sl_tx;
 
+    for (unsigned cell_idx = 0, nof_cells = results.size(); cell_idx != nof_cells; ++cell_idx) {
+      process_cell_results(to_du_cell_index(cell_idx), result_sl_tx);
+    }
+
+    logger.set_context(next_sl_tx.sfn(), next_sl_tx.slot_index());
+  }
+
+  mac_scheduler& sched() const { return *sch; }
+
+private:
+  void process_cell_results(du_cell_index_t cell_index, slot_point_extended result_sl_tx)
+  {
     // Store previous results if any.
-    if (result != nullptr) {
-      sched_results[result_sl_tx.count()] = *result;
+    if (results[cell_index] != nullptr) {
+      sched_results[cell_index][result_sl_tx.count()] = *results[cell_index];
     }
 
     // Process past UCI results.
     slot_point          sl_rx = next_sl_tx.without_hyper_sfn() - dl_pipeline_delay - uci_process_delay;
-    const sched_result& res   = sched_results[sl_rx.to_uint()];
+    const sched_result& res   = sched_results[cell_index][sl_rx.to_uint()];
     if (res.success) {
       uci_indication ind;
       ind.slot_rx    = sl_rx;
-      ind.cell_index = to_du_cell_index(0);
+      ind.cell_index = cell_index;
       for (const auto& pucch : res.ul.pucchs) {
         uci_indication::uci_pdu pdu;
         pdu.ue_index = to_du_ue_index(static_cast<unsigned>(pucch.crnti) - 0x4601);
@@ -218,37 +266,35 @@ public:
       // Forward UCI indication to scheduler.
       sch->handle_uci_indication(ind);
     }
-
-    logger.set_context(next_sl_tx.sfn(), next_sl_tx.slot_index());
   }
 
-  mac_scheduler& sched() const { return *sch; }
-
-private:
   const unsigned dl_pipeline_delay = 4;
   const unsigned uci_process_delay = 2;
 
-  sched_cfg_dummy_notifier       cfg_notif;
-  sched_dummy_metric_notifier    metric_notif;
-  scheduler_expert_config        expert_cfg;
-  cell_config_builder_params     builder_params;
-  std::vector<ran_cell_config>   cell_cfgs;
-  ocudulog::basic_logger&        logger;
-  odu::du_pucch_resource_manager pucch_res_mng;
+  sched_cfg_dummy_notifier                cfg_notif;
+  sched_dummy_metric_notifier             metric_notif;
+  scheduler_expert_config                 expert_cfg;
+  cell_config_builder_params              builder_params;
+  std::vector<cell_config_builder_params> cell_builder_params;
+  std::vector<ran_cell_config>            cell_cfgs;
+  ocudulog::basic_logger&                 logger;
+  odu::du_pucch_resource_manager          pucch_res_mng;
 
   std::unique_ptr<mac_scheduler> sch;
 
-  unsigned            ue_count = 0;
-  slot_point_extended next_sl_tx;
-  const sched_result* result = nullptr;
+  unsigned                         ue_count = 0;
+  slot_point_extended              next_sl_tx;
+  std::vector<const sched_result*> results;
 
-  circular_array<sched_result, 64> sched_results{};
+  std::vector<circular_array<sched_result, 64>> sched_results;
 };
 
 void benchmark_tdd(benchmarker& bm, const bench_params& params)
 {
   scheduler_expert_config sched_cfg              = config_helpers::make_default_scheduler_expert_config();
   sched_cfg.ue.max_pdcch_alloc_attempts_per_slot = params.max_dl_grants_per_slot;
+  sched_cfg.ue.pre_policy_rr_ue_group_size       = params.ue_group_size;
+  sched_cfg.nof_cell_group_workers               = params.nof_workers;
 
   cell_config_builder_params builder_params =
       cell_config_builder_profiles::create(duplex_mode::TDD, frequency_range::FR1, bs_channel_bandwidth::MHz100);
@@ -256,7 +302,8 @@ void benchmark_tdd(benchmarker& bm, const bench_params& params)
   builder_params.dl_carrier.nof_ant   = 4;
 
   // Instantiate the simulator on the heap because of huge object size
-  std::unique_ptr<multi_ue_sched_simulator> sim = std::make_unique<multi_ue_sched_simulator>(sched_cfg, builder_params);
+  std::unique_ptr<multi_ue_sched_simulator> sim =
+      std::make_unique<multi_ue_sched_simulator>(sched_cfg, builder_params, params.nof_cells);
 
   // Add UEs.
   for (unsigned ue_count = 0; ue_count != params.nof_ues; ++ue_count) {
@@ -268,7 +315,11 @@ void benchmark_tdd(benchmarker& bm, const bench_params& params)
 
   // Run benchmark.
   bm.new_measure(
-      fmt::format("TDD scheduling {} UEs", params.nof_ues),
+      fmt::format("TDD scheduling {} UEs {} group size {} cells {} workers",
+                  params.nof_ues,
+                  params.ue_group_size,
+                  params.nof_cells,
+                  params.nof_workers),
       1,
       [&sim]() mutable { sim->run_slot(); },
       [&]() {
@@ -0,0 +1,411 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Replays a scheduler input trace against a fresh scheduler.
+///
+/// The trace is recorded by the scheduler when the scheduler input trace file is configured. The inputs are recorded
+/// when the scheduler processes them, and each slot indication after the inputs processed in that slot. The recorded
+/// inputs are forwarded to the scheduler at full speed and in the recorded order, so that each input is processed in
+/// the same slot as in the recording. The tool reports the distribution of the slot indication latencies and the
+/// differences between the recorded and the replayed scheduling results.
+///
+/// The cells and UEs are rebuilt with the default configuration helpers from the parameters stored in the trace.
+/// Therefore, the replayed results only match the recorded ones when the recording scheduler used the same defaults.
+
+#include "lib/du/du_high/du_manager/ran_resource_management/du_pucch_resource_manager.h"
+#include "lib/scheduler/logging/scheduler_input_trace.h"
+#include "scheduler_test_doubles.h"
+#include "tests/test_doubles/scheduler/scheduler_config_helper.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/scheduler/config/logical_channel_config_factory.h"
+#include "ocudu/scheduler/config/sched_cell_config_helpers.h"
+#include "ocudu/scheduler/config/scheduler_expert_config_factory.h"
+#include "ocudu/scheduler/scheduler_factory.h"
+#include <chrono>
+#include <getopt.h>
+#include <map>
+
+using namespace ocudu;
+
+struct replay_params {
+  std::string trace_file;
+  unsigned    max_printed_diffs = 10;
+  bool        debug             = false;
+};
+
+static void usage(const char* prog, const replay_params& params)
+{
+  fmt::print("Usage: {} -f trace file [-n Max printed diffs] [-d]\n", prog);
+  fmt::print("\t-f Scheduler input trace file\n");
+  fmt::print("\t-n Maximum number of result differences to print [Default {}]\n", params.max_printed_diffs);
+  fmt::print("\t-d Debug mode [Default {}]\n", params.debug);
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv, replay_params& params)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "f:n:dh")) != -1) {
+    switch (opt) {
+      case 'f':
+        params.trace_file = optarg;
+        break;
+      case 'n':
+        params.max_printed_diffs = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'd':
+        params.debug = true;
+        break;
+      case 'h':
+      default:
+        usage(argv[0], params);
+        std::exit(0);
+    }
+  }
+  if (params.trace_file.empty()) {
+    usage(argv[0], params);
+    std::exit(1);
+  }
+}
+
+namespace {
+
+/// Histogram of the slot indication latencies.
+class slot_latency_histogram
+{
+public:
+  void add(std::chrono::nanoseconds latency) { latencies_ns.push_back(latency.count()); }
+
+  void print()
+  {
+    if (latencies_ns.empty()) {
+      fmt::print("No slot indications replayed.\n");
+      return;
+    }
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+
+    auto percentile = [this](double value) {
+      return latencies_ns[std::min<size_t>(latencies_ns.size() * value / 100.0, latencies_ns.size() - 1)] / 1000.0;
+    };
+    fmt::print("Slot indication latency [us] over {} slots:\n", latencies_ns.size());
+    fmt::print("  min={:.1f} p50={:.1f} p90={:.1f} p99={:.1f} p99.9={:.1f} p99.99={:.1f} max={:.1f}\n",
+               latencies_ns.front() / 1000.0,
+               percentile(50),
+               percentile(90),
+               percentile(99),
+               percentile(99.9),
+               percentile(99.99),
+               latencies_ns.back() / 1000.0);
+
+    // Print the number of slots per latency bin.
+    fmt::print("Slot indication latency histogram:\n");
+    uint64_t lower_edge_us = 0;
+    for (uint64_t upper_edge_us : bin_upper_edges_us) {
+      print_bin(lower_edge_us, upper_edge_us);
+      lower_edge_us = upper_edge_us;
+    }
+    print_bin(lower_edge_us, std::numeric_limits<uint64_t>::max() / 1000);
+  }
+
+private:
+  void print_bin(uint64_t lower_edge_us, uint64_t upper_edge_us) const
+  {
+    auto     first     = std::lower_bound(latencies_ns.begin(), latencies_ns.end(), lower_edge_us * 1000);
+    auto     last      = std::lower_bound(latencies_ns.begin(), latencies_ns.end(), upper_edge_us * 1000);
+    uint64_t nof_slots = std::distance(first, last);
+    double   ratio     = 100.0 * nof_slots / latencies_ns.size();
+    if (upper_edge_us == std::numeric_limits<uint64_t>::max() / 1000) {
+      fmt::print("  [{:>5}, inf) us: {:>10} ({:5.2f}%)\n", lower_edge_us, nof_slots, ratio);
+    } else {
+      fmt::print("  [{:>5}, {:>5}) us: {:>10} ({:5.2f}%)\n", lower_edge_us, upper_edge_us, nof_slots, ratio);
+    }
+  }
+
+  static constexpr std::array<uint64_t, 10> bin_upper_edges_us = {5, 10, 20, 50, 100, 200, 300, 500, 1000, 2000};
+
+  std::vector<uint64_t> latencies_ns;
+};
+
+/// Drives a scheduler with the records of a scheduler input trace.
+class scheduler_trace_replayer final : public scheduler_input_trace_handler
+{
+public:
+  scheduler_trace_replayer(const scheduler_expert_config& expert_cfg_, unsigned max_printed_diffs_) :
+    expert_cfg(expert_cfg_),
+    max_printed_diffs(max_printed_diffs_),
+    pucch_res_mng(expert_cfg.ue.max_pucchs_per_slot),
+    sch(create_scheduler(scheduler_config{expert_cfg, cfg_notif}))
+  {
+  }
+
+  void on_cell_configuration(const sched_trace_cell_config& cfg) override
+  {
+    cell_config_builder_params params;
+    params.pci                  = cfg.pci;
+    params.scs_common           = cfg.scs_common;
+    params.dl_carrier           = cfg.dl_carrier;
+    params.scs_ssb              = cfg.scs_ssb;
+    params.offset_to_point_a    = cfg.offset_to_point_a;
+    params.k_ssb                = cfg.k_ssb;
+    params.cs0_index            = cfg.cs0_index;
+    params.ss0_index            = cfg.ss0_index;
+    params.tdd_ul_dl_cfg_common = cfg.tdd_ul_dl_cfg_common;
+
+    sched_cell_configuration_request_message msg =
+        sched_config_helper::make_default_sched_cell_configuration_request(params);
+    msg.cell_index                           = cfg.cell_index;
+    msg.cell_group_index                     = cfg.cell_group_index;
+    msg.ran.init_bwp_builder.pucch.resources = cfg.pucch_resources;
+    if (not cfg.csi_enabled) {
+      msg.ran.init_bwp_builder.csi.reset();
+    }
+
+    pucch_res_mng.add_cell(cfg.cell_index, msg.ran);
+    cell_params.emplace(cfg.cell_index, params);
+    sch->handle_cell_configuration_request(msg);
+  }
+
+  void on_cell_removal(du_cell_index_t cell_index) override
+  {
+    cell_params.erase(cell_index);
+    sch->handle_cell_removal_request(cell_index);
+  }
+
+  void on_cell_activation(du_cell_index_t cell_index) override { sch->handle_cell_activation_request(cell_index); }
+
+  void on_cell_deactivation(du_cell_index_t cell_index) override { sch->handle_cell_deactivation_request(cell_index); }
+
+  void on_ue_creation(const sched_trace_ue_config& cfg) override
+  {
+    auto cell_it = cell_params.find(cfg.pcell_index);
+    if (cell_it == cell_params.end()) {
+      fmt::print("Skipping creation of ue={}. Cause: Unknown PCell={}\n",
+                 fmt::underlying(cfg.ue_index),
+                 fmt::underlying(cfg.pcell_index));
+      return;
+    }
+
+    sched_ue_creation_request_message msg = sched_config_helper::create_default_sched_ue_creation_request(
+        cell_it->second, cfg.lcids.has_value() ? span<const lcid_t>(*cfg.lcids) : span<const lcid_t>{});
+    msg.ue_index           = cfg.ue_index;
+    msg.crnti              = cfg.crnti;
+    msg.starts_in_fallback = cfg.starts_in_fallback;
+    msg.ul_ccch_slot_rx    = cfg.ul_ccch_slot_rx;
+
+    // Allocate the PUCCH resources of the UE, as the DU manager does.
+    auto& pcell                        = (*msg.cfg.cells)[0];
+    pcell.serv_cell_cfg.cell_index     = cfg.pcell_index;
+    odu::cell_group_config& cell_group = ue_cell_groups[cfg.ue_index];
+    cell_group.cells.emplace(0);
+    cell_group.cells[0].serv_cell_cfg = pcell.serv_cell_cfg;
+    if (not pucch_res_mng.alloc_resources(cell_group)) {
+      fmt::print("Skipping creation of ue={}. Cause: Failed to allocate PUCCH resources\n",
+                 fmt::underlying(cfg.ue_index));
+      ue_cell_groups.erase(cfg.ue_index);
+      return;
+    }
+    pcell.serv_cell_cfg = cell_group.cells[0].serv_cell_cfg;
+
+    sch->handle_ue_creation_request(msg);
+  }
+
+  void on_ue_reconfiguration(const sched_trace_ue_config& cfg) override
+  {
+    sched_ue_reconfiguration_message msg{};
+    msg.ue_index = cfg.ue_index;
+    msg.crnti    = cfg.crnti;
+    if (cfg.lcids.has_value()) {
+      msg.cfg.lc_config_list.emplace();
+      for (lcid_t lcid : *cfg.lcids) {
+        msg.cfg.lc_config_list->push_back(config_helpers::create_default_logical_channel_config(lcid));
+      }
+    }
+    sch->handle_ue_reconfiguration_request(msg);
+  }
+
+  void on_ue_removal(du_ue_index_t ue_index) override
+  {
+    auto ue_it = ue_cell_groups.find(ue_index);
+    if (ue_it != ue_cell_groups.end()) {
+      pucch_res_mng.dealloc_resources(ue_it->second);
+      ue_cell_groups.erase(ue_it);
+    }
+    sch->handle_ue_removal_request(ue_index);
+  }
+
+  void on_ue_config_applied(du_ue_index_t ue_index) override { sch->handle_ue_config_applied(ue_index); }
+
+  void on_ue_deactivation(du_ue_index_t ue_index) override { sch->handle_ue_deactivation_request(ue_index); }
+
+  void on_slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index) override
+  {
+    ocudulog::fetch_basic_logger("SCHED").set_context(sl_tx.sfn(), sl_tx.slot_index());
+
+    auto                start  = std::chrono::steady_clock::now();
+    const sched_result& result = sch->slot_indication(sl_tx, cell_index);
+    auto                stop   = std::chrono::steady_clock::now();
+
+    latencies.add(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start));
+    last_results[cell_index] = make_sched_trace_slot_result(cell_index, sl_tx.without_hyper_sfn(), result);
+  }
+
+  void on_slot_result(const sched_trace_slot_result& recorded) override
+  {
+    auto result_it = last_results.find(recorded.cell_index);
+    if (result_it == last_results.end() or result_it->second.slot != recorded.slot) {
+      return;
+    }
+    const sched_trace_slot_result& replayed = result_it->second;
+
+    ++nof_compared_slots;
+    recorded_totals.add(recorded);
+    replayed_totals.add(replayed);
+    if (replayed == recorded) {
+      return;
+    }
+
+    ++nof_diff_slots;
+    if (nof_diff_slots <= max_printed_diffs) {
+      fmt::print("Result mismatch cell={} slot={}:\n", fmt::underlying(recorded.cell_index), recorded.slot);
+      fmt::print("  recorded: {}\n", to_string(recorded));
+      fmt::print("  replayed: {}\n", to_string(replayed));
+    }
+  }
+
+  void on_error_indication(slot_point                            sl_tx,
+                           du_cell_index_t                       cell_index,
+                           scheduler_slot_handler::error_outcome event) override
+  {
+    sch->handle_error_indication(sl_tx, cell_index, event);
+  }
+
+  void on_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs) override
+  {
+    sch->handle_dl_buffer_state_indication(bs);
+  }
+
+  void on_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce) override
+  {
+    sch->handle_dl_mac_ce_indication(mac_ce);
+  }
+
+  void on_ul_bsr_indication(const ul_bsr_indication_message& bsr) override { sch->handle_ul_bsr_indication(bsr); }
+
+  void on_ul_phr_indication(const ul_phr_indication_message& phr_ind) override
+  {
+    sch->handle_ul_phr_indication(phr_ind);
+  }
+
+  void on_crc_indication(const ul_crc_indication& crc) override { sch->handle_crc_indication(crc); }
+
+  void on_uci_indication(const uci_indication& uci) override { sch->handle_uci_indication(uci); }
+
+  void on_rach_indication(const rach_indication_message& msg) override { sch->handle_rach_indication(msg); }
+
+  /// Prints the latency histogram and the comparison of the recorded and the replayed results.
+  void print_report()
+  {
+    latencies.print();
+
+    fmt::print("Scheduling results: {} slots compared, {} slots differ\n", nof_compared_slots, nof_diff_slots);
+    fmt::print("  recorded: {}\n", recorded_totals.to_string());
+    fmt::print("  replayed: {}\n", replayed_totals.to_string());
+  }
+
+private:
+  /// Accumulated scheduling results over the replayed slots.
+  struct result_totals {
+    uint64_t nof_ue_pdschs = 0;
+    uint64_t nof_puschs    = 0;
+    uint64_t dl_tbs_bytes  = 0;
+    uint64_t ul_tbs_bytes  = 0;
+
+    void add(const sched_trace_slot_result& result)
+    {
+      nof_ue_pdschs += result.nof_ue_pdschs;
+      nof_puschs += result.nof_puschs;
+      dl_tbs_bytes += result.dl_tbs_bytes;
+      ul_tbs_bytes += result.ul_tbs_bytes;
+    }
+
+    std::string to_string() const
+    {
+      return fmt::format(
+          "ue_pdschs={} puschs={} dl_tbs={}B ul_tbs={}B", nof_ue_pdschs, nof_puschs, dl_tbs_bytes, ul_tbs_bytes);
+    }
+  };
+
+  static std::string to_string(const sched_trace_slot_result& result)
+  {
+    return fmt::format("success={} dl_pdcchs={} ul_pdcchs={} ue_pdschs={} rars={} puschs={} pucchs={} dl_tbs={}B "
+                       "ul_tbs={}B",
+                       result.success,
+                       result.nof_dl_pdcchs,
+                       result.nof_ul_pdcchs,
+                       result.nof_ue_pdschs,
+                       result.nof_rars,
+                       result.nof_puschs,
+                       result.nof_pucchs,
+                       result.dl_tbs_bytes,
+                       result.ul_tbs_bytes);
+  }
+
+  const scheduler_expert_config expert_cfg;
+  const unsigned                max_printed_diffs;
+
+  sched_cfg_dummy_notifier                              cfg_notif;
+  odu::du_pucch_resource_manager                        pucch_res_mng;
+  std::unique_ptr<mac_scheduler>                        sch;
+  std::map<du_cell_index_t, cell_config_builder_params> cell_params;
+  std::map<du_ue_index_t, odu::cell_group_config>       ue_cell_groups;
+  std::map<du_cell_index_t, sched_trace_slot_result>    last_results;
+  slot_latency_histogram                                latencies;
+  uint64_t                                              nof_compared_slots = 0;
+  uint64_t                                              nof_diff_slots     = 0;
+  result_totals                                         recorded_totals;
+  result_totals                                         replayed_totals;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ocudulog::init();
+
+  replay_params params{};
+  parse_args(argc, argv, params);
+
+  ocudulog::fetch_basic_logger("SCHED", true)
+      .set_level(params.debug ? ocudulog::basic_levels::debug : ocudulog::basic_levels::warning);
+
+  scheduler_input_trace_reader reader;
+  if (not reader.open(params.trace_file)) {
+    fmt::print("Failed to open scheduler input trace \"{}\"\n", params.trace_file);
+    return 1;
+  }
+
+  // Instantiate the replayer on the heap because of huge object size.
+  auto replayer = std::make_unique<scheduler_trace_replayer>(config_helpers::make_default_scheduler_expert_config(),
+                                                             params.max_printed_diffs);
+
+  uint64_t nof_records = 0;
+  while (reader.read_next(*replayer)) {
+    ++nof_records;
+  }
+  if (reader.is_malformed()) {
+    fmt::print("Stopped replay after {} records. Cause: Malformed record\n", nof_records);
+  }
+
+  fmt::print("Replayed {} records from \"{}\"\n", nof_records, params.trace_file);
+  replayer->print_report();
+
+  ocudulog::flush();
+}
@@ -81,6 +81,28 @@ TEST_P(OcuduvecScProdFixture, OcuduvecScProdBrainFloatComplex)
   }
 }
 
+TEST_P(OcuduvecScProdFixture, OcuduvecScProdFloatComplexToBrainFloat)
+{
+  std::uniform_real_distribution<float> dist(-1.0, 1.0);
+
+  std::vector<cf_t> x(size);
+  for (cf_t& v : x) {
+    v = {dist(rgen), dist(rgen)};
+  }
+
+  cf_t h = {dist(rgen), dist(rgen)};
+
+  std::vector<cbf16_t> z(size);
+
+  ocuduvec::sc_prod(z, x, h);
+
+  for (size_t i = 0; i != size; i++) {
+    cf_t  gold_z = x[i] * h;
+    float err    = std::abs(gold_z - to_cf(z[i]));
+    TESTASSERT(err < 5e-3, " err={}", err);
+  }
+}
+
 TEST_P(OcuduvecScProdFixture, OcuduvecScProdBrainFloatComplexReal)
 {
   std::uniform_real_distribution<float> dist(-1.0, 1.0);
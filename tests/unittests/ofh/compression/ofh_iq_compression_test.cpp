@@ -0,0 +1,215 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/compression/compression_factory.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/support/test_utils.h"
+#include <gtest/gtest.h>
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// Number of resource blocks compressed by each test.
+constexpr unsigned nof_prbs = 51;
+
+/// SIMD implementations compared against the generic one. Unsupported implementations fall back to the generic one.
+const std::vector<std::string> simd_impl_types = {"avx2", "avx512", "neon"};
+
+using iq_compression_test_params = std::tuple<compression_type, unsigned>;
+
+class ofh_iq_compression_fixture : public ::testing::TestWithParam<iq_compression_test_params>
+{
+protected:
+  ofh_iq_compression_fixture() : params{std::get<0>(GetParam()), std::get<1>(GetParam())}
+  {
+    buffer.resize(get_compressed_prb_size(params).value() * nof_prbs);
+  }
+
+  /// \brief Generates random IQ samples.
+  ///
+  /// The amplitude of the samples varies across resource blocks to cover the whole range of block exponents. Some
+  /// resource blocks are left empty.
+  static std::vector<cbf16_t> generate_random_samples()
+  {
+    std::vector<cbf16_t> samples(nof_prbs * NOF_SUBCARRIERS_PER_RB);
+    for (unsigned i_prb = 0; i_prb != nof_prbs; ++i_prb) {
+      float amplitude = (i_prb % 17 == 0) ? 0.0F : std::ldexp(1.0F, -static_cast<int>(i_prb % 17));
+      std::uniform_real_distribution<float> dist(-amplitude, amplitude);
+      for (unsigned i_re = 0; i_re != NOF_SUBCARRIERS_PER_RB; ++i_re) {
+        samples[i_prb * NOF_SUBCARRIERS_PER_RB + i_re] = {dist(test_rgen::get()), dist(test_rgen::get())};
+      }
+    }
+    return samples;
+  }
+
+  /// Generates IQ samples at or beyond the full scale, including the most negative quantized value.
+  static std::vector<cbf16_t> generate_saturated_samples()
+  {
+    static constexpr std::array<float, 6> values = {1.0F, -1.0F, 2.0F, -2.0F, 0.5F, -0.25F};
+
+    std::vector<cbf16_t> samples(nof_prbs * NOF_SUBCARRIERS_PER_RB);
+    for (cbf16_t& sample : samples) {
+      sample = {values[test_rgen::uniform_int<unsigned>(0, values.size() - 1)],
+                values[test_rgen::uniform_int<unsigned>(0, values.size() - 1)]};
+    }
+    return samples;
+  }
+
+  /// Compresses the given samples with the given implementation and returns the compressed buffer.
+  std::vector<uint8_t> compress(span<const cbf16_t> samples, const std::string& impl_type)
+  {
+    std::vector<uint8_t> out(buffer.size());
+    create_iq_compressor(params.type, logger, 1.0F, impl_type)->compress(out, samples, params);
+    return out;
+  }
+
+  /// Decompresses the given buffer with the given implementation and returns the samples.
+  std::vector<cbf16_t> decompress(span<const uint8_t> compressed, const std::string& impl_type)
+  {
+    std::vector<cbf16_t> out(nof_prbs * NOF_SUBCARRIERS_PER_RB);
+    create_iq_decompressor(params.type, logger, impl_type)->decompress(out, compressed, params);
+    return out;
+  }
+
+  ocudulog::basic_logger& logger = ocudulog::fetch_basic_logger("TEST");
+  ru_compression_params   params;
+  std::vector<uint8_t>    buffer;
+};
+
+/// \brief Returns the maximum error of a decompressed sample.
+///
+/// \param[in] value     Original sample value.
+/// \param[in] peak      Largest magnitude of the resource block of the sample.
+/// \param[in] params    Compression parameters.
+float get_max_error(float value, float peak, const ru_compression_params& params)
+{
+  // Half a step of the 16-bit quantizer and of the brain float output.
+  float error = 1.0F / 32767.0F + std::abs(value) * std::ldexp(1.0F, -8);
+  if (params.type == compression_type::mu_law) {
+    // Half a step of the mantissa, relative to the magnitude of the sample or to the smallest segment.
+    unsigned mantissa_width = params.data_width - 4;
+    return error + std::ldexp(std::abs(value) + std::ldexp(peak, -7), -static_cast<int>(mantissa_width));
+  }
+  // One step of the compressed samples, as the peak may be clipped. The Q1.7 block scaler rounds the peak up.
+  return error + std::ldexp(peak + std::ldexp(1.0F, -7), -static_cast<int>(params.data_width - 1));
+}
+
+} // namespace
+
+TEST_P(ofh_iq_compression_fixture, generic_round_trip_error_is_bounded)
+{
+  std::vector<cbf16_t> samples      = generate_random_samples();
+  std::vector<cbf16_t> decompressed = decompress(compress(samples, "generic"), "generic");
+
+  for (unsigned i_prb = 0; i_prb != nof_prbs; ++i_prb) {
+    span<const cbf16_t> prb_in  = span<const cbf16_t>(samples).subspan(i_prb * NOF_SUBCARRIERS_PER_RB,
+                                                                      NOF_SUBCARRIERS_PER_RB);
+    span<const cbf16_t> prb_out = span<const cbf16_t>(decompressed).subspan(i_prb * NOF_SUBCARRIERS_PER_RB,
+                                                                           NOF_SUBCARRIERS_PER_RB);
+
+    float peak = 0;
+    for (cbf16_t sample : prb_in) {
+      peak = std::max({peak, std::abs(to_float(sample.real)), std::abs(to_float(sample.imag))});
+    }
+
+    for (unsigned i_re = 0; i_re != NOF_SUBCARRIERS_PER_RB; ++i_re) {
+      cf_t in  = to_cf(prb_in[i_re]);
+      cf_t out = to_cf(prb_out[i_re]);
+      ASSERT_LE(std::abs(in.real() - out.real()), get_max_error(in.real(), peak, params))
+          << fmt::format("prb={} re={} in={} out={}", i_prb, i_re, in, out);
+      ASSERT_LE(std::abs(in.imag() - out.imag()), get_max_error(in.imag(), peak, params))
+          << fmt::format("prb={} re={} in={} out={}", i_prb, i_re, in, out);
+    }
+  }
+}
+
+TEST_P(ofh_iq_compression_fixture, simd_implementations_match_generic_on_random_samples)
+{
+  std::vector<cbf16_t> samples          = generate_random_samples();
+  std::vector<uint8_t> expected         = compress(samples, "generic");
+  std::vector<cbf16_t> expected_samples = decompress(expected, "generic");
+
+  for (const std::string& impl_type : simd_impl_types) {
+    ASSERT_EQ(compress(samples, impl_type), expected) << impl_type;
+    std::vector<cbf16_t> decompressed = decompress(expected, impl_type);
+    ASSERT_TRUE(std::equal(decompressed.begin(), decompressed.end(), expected_samples.begin())) << impl_type;
+  }
+}
+
+TEST_P(ofh_iq_compression_fixture, simd_implementations_match_generic_on_saturated_samples)
+{
+  std::vector<cbf16_t> samples          = generate_saturated_samples();
+  std::vector<uint8_t> expected         = compress(samples, "generic");
+  std::vector<cbf16_t> expected_samples = decompress(expected, "generic");
+
+  for (const std::string& impl_type : simd_impl_types) {
+    ASSERT_EQ(compress(samples, impl_type), expected) << impl_type;
+    std::vector<cbf16_t> decompressed = decompress(expected, impl_type);
+    ASSERT_TRUE(std::equal(decompressed.begin(), decompressed.end(), expected_samples.begin())) << impl_type;
+  }
+
+  // The saturated samples decompress to the full scale with the sign of the input.
+  for (unsigned i = 0; i != samples.size(); ++i) {
+    cf_t in  = to_cf(samples[i]);
+    cf_t out = to_cf(expected_samples[i]);
+    if (std::abs(in.real()) >= 1.0F) {
+      ASSERT_NEAR(out.real(), std::copysign(1.0F, in.real()), get_max_error(1.0F, 1.0F, params)) << i;
+    }
+    if (std::abs(in.imag()) >= 1.0F) {
+      ASSERT_NEAR(out.imag(), std::copysign(1.0F, in.imag()), get_max_error(1.0F, 1.0F, params)) << i;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ofh_iq_compression,
+                         ofh_iq_compression_fixture,
+                         ::testing::Combine(::testing::Values(compression_type::block_scaling,
+                                                              compression_type::mu_law),
+                                            ::testing::Values(5, 8, 9, 12, 14, 16)));
+
+TEST(ofh_iq_compression_mu_law, ud_comp_param_carries_bit_width_and_comp_shift)
+{
+  ocudulog::basic_logger& logger = ocudulog::fetch_basic_logger("TEST");
+
+  // Peak amplitude of the resource block and the compShift that brings it to the 15 magnitude bits.
+  const std::vector<std::pair<float, unsigned>> peak_to_comp_shift = {
+      {0.0F, 15}, {1.0F, 0}, {-1.0F, 0}, {2.0F, 0}, {-2.0F, 0}, {0.5F, 0}, {0.25F, 1}, {1.0F / 64.0F, 5}};
+
+  for (unsigned data_width : {5, 9, 14, 16}) {
+    ru_compression_params params = {compression_type::mu_law, data_width};
+    std::vector<uint8_t>  buffer(get_compressed_prb_size(params).value());
+
+    for (const char* impl_type : {"generic", "avx2", "avx512", "neon"}) {
+      std::unique_ptr<iq_compressor>   compressor   = create_iq_compressor(params.type, logger, 1.0F, impl_type);
+      std::unique_ptr<iq_decompressor> decompressor = create_iq_decompressor(params.type, logger, impl_type);
+
+      for (const auto& [peak, comp_shift] : peak_to_comp_shift) {
+        std::vector<cbf16_t> samples(NOF_SUBCARRIERS_PER_RB, cbf16_t{peak / 4, -peak / 8});
+        samples[3] = {0.0F, peak};
+        compressor->compress(buffer, samples, params);
+
+        // The bit width is in the 4 MSBs, where 16 bits is encoded as zero, and the compShift in the 4 LSBs.
+        uint8_t ud_comp_param = buffer[0];
+        ASSERT_EQ(ud_comp_param >> 4U, data_width % 16) << fmt::format("impl={} peak={}", impl_type, peak);
+        ASSERT_EQ(ud_comp_param & 0xfU, comp_shift) << fmt::format("impl={} peak={}", impl_type, peak);
+
+        // The decompressor undoes the compShift.
+        std::vector<cbf16_t> decompressed(NOF_SUBCARRIERS_PER_RB);
+        decompressor->decompress(decompressed, buffer, params);
+        float expected = std::clamp(peak, -1.0F, 1.0F);
+        ASSERT_NEAR(to_float(decompressed[3].imag), expected, get_max_error(expected, std::abs(expected), params))
+            << fmt::format("impl={} peak={}", impl_type, peak);
+      }
+    }
+  }
+}
@@ -0,0 +1,218 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Tests the shared-memory Ethernet transmitter and receiver.
+
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_factories.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_notifier.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/support/executors/task_worker.h"
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <mutex>
+#include <thread>
+
+using namespace ocudu;
+using namespace ether;
+
+namespace {
+
+/// Frame notifier that stores a copy of the received frames.
+class frame_notifier_spy : public frame_notifier
+{
+public:
+  // See interface for documentation.
+  void on_new_frame(unique_rx_buffer buffer) override
+  {
+    span<const uint8_t>         data = buffer.data();
+    std::lock_guard<std::mutex> lock(mutex);
+    frames.emplace_back(data.begin(), data.end());
+  }
+
+  /// Returns the number of received frames.
+  unsigned get_nof_frames() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frames.size();
+  }
+
+  /// Returns the received frames.
+  std::vector<std::vector<uint8_t>> get_frames() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frames;
+  }
+
+private:
+  mutable std::mutex                mutex;
+  std::vector<std::vector<uint8_t>> frames;
+};
+
+class EthernetShmFixture : public ::testing::Test
+{
+protected:
+  static void SetUpTestSuite() { ocudulog::init(); }
+
+  void TearDown() override
+  {
+    for (auto& rx : receivers) {
+      rx->get_operation_controller().stop();
+    }
+    rx_worker.stop();
+
+    ::shm_unlink(("/ocudu_ofh_" + link_name + "_dl").c_str());
+    ::shm_unlink(("/ocudu_ofh_" + link_name + "_ul").c_str());
+  }
+
+  /// Creates a transmitter of the given link endpoint.
+  std::unique_ptr<transmitter> create_shm_transmitter(shm_link_endpoint endpoint)
+  {
+    transmitter_config tx_config;
+    tx_config.interface       = link_name;
+    tx_config.mtu_size        = units::bytes(9000);
+    tx_config.mac_dst_address = dst_mac;
+    tx_config.mode            = socket_mode::shared_memory;
+    tx_config.shm_endpoint    = endpoint;
+    return create_transmitter(tx_config, logger);
+  }
+
+  /// Creates and starts a receiver of the given link endpoint.
+  void start_shm_receiver(shm_link_endpoint endpoint)
+  {
+    receiver_config rx_config = {link_name, false, false, socket_mode::shared_memory, endpoint};
+    receivers.push_back(create_receiver(rx_config, rx_executor, logger));
+    receivers.back()->get_operation_controller().start(notifier);
+  }
+
+  /// Builds an eCPRI Ethernet frame of the given size filled with the given identifier.
+  static std::vector<uint8_t> build_frame(unsigned size, uint8_t id)
+  {
+    std::vector<uint8_t> frame(size, id);
+    std::copy(dst_mac.begin(), dst_mac.end(), frame.begin());
+    std::copy(src_mac.begin(), src_mac.end(), frame.begin() + ETH_ADDR_LEN);
+    frame[2 * ETH_ADDR_LEN]     = ECPRI_ETH_TYPE >> 8U;
+    frame[2 * ETH_ADDR_LEN + 1] = ECPRI_ETH_TYPE & 0xffU;
+    return frame;
+  }
+
+  /// Waits until the given number of frames have been received or a timeout expires.
+  void wait_for_frames(unsigned nof_frames)
+  {
+    for (unsigned i = 0; i != 1000 && notifier.get_nof_frames() < nof_frames; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  static constexpr mac_address dst_mac = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+  static constexpr mac_address src_mac = {0x80, 0x61, 0x5f, 0x0d, 0xdf, 0xaa};
+
+  const std::string                      link_name = "test" + std::to_string(::getpid());
+  ocudulog::basic_logger&                logger    = ocudulog::fetch_basic_logger("TEST");
+  task_worker                            rx_worker{"rx_worker", 16};
+  task_worker_executor                   rx_executor{rx_worker};
+  frame_notifier_spy                     notifier;
+  std::vector<std::unique_ptr<receiver>> receivers;
+};
+
+} // namespace
+
+TEST_F(EthernetShmFixture, du_burst_is_received_by_ru)
+{
+  static constexpr unsigned nof_frames = 32;
+
+  auto tx = create_shm_transmitter(shm_link_endpoint::du);
+  start_shm_receiver(shm_link_endpoint::ru);
+
+  std::vector<std::vector<uint8_t>> frames;
+  std::vector<span<const uint8_t>>  burst;
+  for (unsigned i = 0; i != nof_frames; ++i) {
+    frames.push_back(build_frame(64 + i * 128, i));
+  }
+  for (const auto& frame : frames) {
+    burst.emplace_back(frame);
+  }
+
+  tx->send(burst);
+  wait_for_frames(nof_frames);
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), nof_frames);
+  for (unsigned i = 0; i != nof_frames; ++i) {
+    ASSERT_EQ(received[i], frames[i]) << fmt::format("Mismatch in frame {}.", i);
+  }
+}
+
+TEST_F(EthernetShmFixture, du_does_not_receive_its_own_frames)
+{
+  auto tx = create_shm_transmitter(shm_link_endpoint::du);
+  start_shm_receiver(shm_link_endpoint::du);
+
+  std::vector<uint8_t>             frame = build_frame(128, 1);
+  std::vector<span<const uint8_t>> burst = {frame};
+  tx->send(burst);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_EQ(notifier.get_nof_frames(), 0);
+}
+
+TEST_F(EthernetShmFixture, vlan_tag_is_removed)
+{
+  auto tx = create_shm_transmitter(shm_link_endpoint::ru);
+  start_shm_receiver(shm_link_endpoint::du);
+
+  std::vector<uint8_t> frame = build_frame(128, 7);
+  std::vector<uint8_t> tagged_frame(frame.begin(), frame.begin() + 2 * ETH_ADDR_LEN);
+  tagged_frame.insert(tagged_frame.end(), {0x81, 0x00, 0x00, 0x02});
+  tagged_frame.insert(tagged_frame.end(), frame.begin() + 2 * ETH_ADDR_LEN, frame.end());
+
+  std::vector<span<const uint8_t>> burst = {tagged_frame};
+  tx->send(burst);
+  wait_for_frames(1);
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), 1);
+  ASSERT_EQ(received.front(), frame);
+}
+
+TEST_F(EthernetShmFixture, bursts_wrapping_the_ring_are_received)
+{
+  static constexpr unsigned nof_bursts       = 40;
+  static constexpr unsigned nof_burst_frames = 128;
+  static constexpr unsigned frame_size       = 8000;
+
+  auto tx = create_shm_transmitter(shm_link_endpoint::du);
+  start_shm_receiver(shm_link_endpoint::ru);
+
+  std::vector<std::vector<uint8_t>> frames;
+  std::vector<span<const uint8_t>>  burst;
+  for (unsigned i = 0; i != nof_burst_frames; ++i) {
+    frames.push_back(build_frame(frame_size, i));
+  }
+  for (const auto& frame : frames) {
+    burst.emplace_back(frame);
+  }
+
+  for (unsigned i_burst = 0; i_burst != nof_bursts; ++i_burst) {
+    tx->send(burst);
+    wait_for_frames((i_burst + 1) * nof_burst_frames);
+  }
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), nof_bursts * nof_burst_frames);
+  for (unsigned i = 0, e = received.size(); i != e; ++i) {
+    ASSERT_EQ(received[i], frames[i % nof_burst_frames]) << fmt::format("Mismatch in frame {}.", i);
+  }
+}
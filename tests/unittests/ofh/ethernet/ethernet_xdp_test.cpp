@@ -0,0 +1,281 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Tests the AF_XDP Ethernet transmitter and receiver over a virtual Ethernet pair.
+///
+/// The tests are skipped when the virtual Ethernet pair cannot be created or AF_XDP sockets are not supported, for
+/// example, due to lack of privileges.
+
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_factories.h"
+#include "ocudu/ofh/ethernet/ethernet_frame_notifier.h"
+#include "ocudu/ofh/ethernet/ethernet_properties.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver.h"
+#include "ocudu/ofh/ethernet/ethernet_transmitter.h"
+#include "ocudu/support/executors/task_worker.h"
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <mutex>
+#include <thread>
+
+using namespace ocudu;
+using namespace ether;
+
+static const std::string tx_interface = "ocudu_xdp0";
+static const std::string rx_interface = "ocudu_xdp1";
+
+namespace {
+
+/// Frame notifier that stores a copy of the received frames.
+class frame_notifier_spy : public frame_notifier
+{
+public:
+  // See interface for documentation.
+  void on_new_frame(unique_rx_buffer buffer) override
+  {
+    span<const uint8_t>         data = buffer.data();
+    std::lock_guard<std::mutex> lock(mutex);
+    frames.emplace_back(data.begin(), data.end());
+  }
+
+  /// Returns the number of received frames.
+  unsigned get_nof_frames() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frames.size();
+  }
+
+  /// Returns the received frames.
+  std::vector<std::vector<uint8_t>> get_frames() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frames;
+  }
+
+private:
+  mutable std::mutex                mutex;
+  std::vector<std::vector<uint8_t>> frames;
+};
+
+class EthernetXdpFixture : public ::testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    ocudulog::init();
+
+    std::string cmd = "ip link add " + tx_interface + " type veth peer name " + rx_interface +
+                      " > /dev/null 2>&1 && ip link set " + tx_interface + " up && ip link set " + rx_interface +
+                      " mtu 9000 up";
+    veth_available = (std::system(cmd.c_str()) == 0);
+
+    int fd        = ::socket(AF_XDP, SOCK_RAW, 0);
+    xdp_available = (fd >= 0);
+    if (xdp_available) {
+      ::close(fd);
+    }
+  }
+
+  static void TearDownTestSuite()
+  {
+    if (veth_available) {
+      std::string cmd = "ip link del " + tx_interface + " > /dev/null 2>&1";
+      std::system(cmd.c_str());
+    }
+  }
+
+  void SetUp() override
+  {
+    if (!veth_available) {
+      GTEST_SKIP() << "Unable to create the virtual Ethernet pair.";
+    }
+    if (!xdp_available) {
+      GTEST_SKIP() << "AF_XDP sockets are not supported.";
+    }
+
+    tx = create_transmitter(build_tx_config(tx_interface, socket_mode::af_xdp), logger);
+    ASSERT_NE(tx, nullptr);
+
+    receiver_config rx_config = {rx_interface, true, false, socket_mode::af_xdp};
+    rx                        = create_receiver(rx_config, rx_executor, logger);
+    ASSERT_NE(rx, nullptr);
+
+    rx->get_operation_controller().start(notifier);
+  }
+
+  void TearDown() override
+  {
+    if (rx) {
+      rx->get_operation_controller().stop();
+    }
+    rx_worker.stop();
+  }
+
+  /// Builds the configuration of a transmitter using the given interface and mode.
+  static transmitter_config build_tx_config(const std::string& interface, socket_mode mode)
+  {
+    transmitter_config tx_config;
+    tx_config.interface                    = interface;
+    tx_config.is_promiscuous_mode_enabled  = false;
+    tx_config.is_link_status_check_enabled = false;
+    tx_config.are_metrics_enabled          = false;
+    tx_config.mtu_size                     = units::bytes(9000);
+    tx_config.mac_dst_address              = dst_mac;
+    tx_config.mode                         = mode;
+    return tx_config;
+  }
+
+  /// Builds an eCPRI Ethernet frame of the given size filled with the given identifier.
+  static std::vector<uint8_t> build_frame(unsigned size, uint8_t id)
+  {
+    std::vector<uint8_t> frame(size, id);
+    std::copy(dst_mac.begin(), dst_mac.end(), frame.begin());
+    std::copy(src_mac.begin(), src_mac.end(), frame.begin() + ETH_ADDR_LEN);
+    frame[2 * ETH_ADDR_LEN]     = ECPRI_ETH_TYPE >> 8U;
+    frame[2 * ETH_ADDR_LEN + 1] = ECPRI_ETH_TYPE & 0xffU;
+    return frame;
+  }
+
+  /// Waits until the given notifier has received the given number of frames or a timeout expires.
+  static void wait_for_frames(const frame_notifier_spy& spy, unsigned nof_frames)
+  {
+    for (unsigned i = 0; i != 1000 && spy.get_nof_frames() < nof_frames; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  /// Waits until the given number of frames have been received or a timeout expires.
+  void wait_for_frames(unsigned nof_frames) { wait_for_frames(notifier, nof_frames); }
+
+  static constexpr mac_address dst_mac = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+  static constexpr mac_address src_mac = {0x80, 0x61, 0x5f, 0x0d, 0xdf, 0xaa};
+
+  static bool                  veth_available;
+  static bool                  xdp_available;
+  ocudulog::basic_logger&      logger = ocudulog::fetch_basic_logger("TEST");
+  task_worker                  rx_worker{"rx_worker", 16};
+  task_worker_executor         rx_executor{rx_worker};
+  frame_notifier_spy           notifier;
+  std::unique_ptr<transmitter> tx;
+  std::unique_ptr<receiver>    rx;
+};
+
+bool EthernetXdpFixture::veth_available = false;
+bool EthernetXdpFixture::xdp_available  = false;
+
+} // namespace
+
+TEST_F(EthernetXdpFixture, burst_is_received)
+{
+  static constexpr unsigned nof_frames = 32;
+
+  std::vector<std::vector<uint8_t>> frames;
+  std::vector<span<const uint8_t>>  burst;
+  for (unsigned i = 0; i != nof_frames; ++i) {
+    frames.push_back(build_frame(64 + i * 128, i));
+  }
+  for (const auto& frame : frames) {
+    burst.emplace_back(frame);
+  }
+
+  tx->send(burst);
+  wait_for_frames(nof_frames);
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), nof_frames);
+  for (unsigned i = 0; i != nof_frames; ++i) {
+    ASSERT_EQ(received[i], frames[i]) << fmt::format("Mismatch in frame {}.", i);
+  }
+}
+
+TEST_F(EthernetXdpFixture, bursts_wrapping_the_umem_are_received)
+{
+  static constexpr unsigned nof_bursts       = 40;
+  static constexpr unsigned nof_burst_frames = 64;
+  static constexpr unsigned frame_size       = 8000;
+
+  std::vector<std::vector<uint8_t>> frames;
+  std::vector<span<const uint8_t>>  burst;
+  for (unsigned i = 0; i != nof_burst_frames; ++i) {
+    frames.push_back(build_frame(frame_size, i));
+  }
+  for (const auto& frame : frames) {
+    burst.emplace_back(frame);
+  }
+
+  for (unsigned i_burst = 0; i_burst != nof_bursts; ++i_burst) {
+    tx->send(burst);
+    wait_for_frames((i_burst + 1) * nof_burst_frames);
+  }
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), nof_bursts * nof_burst_frames);
+  for (unsigned i = 0, e = received.size(); i != e; ++i) {
+    ASSERT_EQ(received[i], frames[i % nof_burst_frames]) << fmt::format("Mismatch in frame {}.", i);
+  }
+}
+
+TEST_F(EthernetXdpFixture, vlan_tag_is_stripped)
+{
+  std::vector<uint8_t> frame = build_frame(1000, 0xab);
+
+  // Insert a VLAN tag with identifier 2 between the MAC addresses and the Ethernet type.
+  std::vector<uint8_t> tagged_frame = frame;
+  tagged_frame.insert(tagged_frame.begin() + 2 * ETH_ADDR_LEN, {0x81, 0x00, 0x00, 0x02});
+
+  std::vector<span<const uint8_t>> burst = {tagged_frame};
+  tx->send(burst);
+  wait_for_frames(1);
+
+  std::vector<std::vector<uint8_t>> received = notifier.get_frames();
+  ASSERT_EQ(received.size(), 1);
+  ASSERT_EQ(received.front(), frame);
+}
+
+TEST_F(EthernetXdpFixture, transmitter_and_receiver_share_the_interface)
+{
+  // Release the interface of the fixture transmitter, so that a transmitter and a receiver can be opened on it.
+  tx.reset();
+
+  receiver_config rx_config = {tx_interface, true, false, socket_mode::af_xdp};
+  auto [shared_tx, shared_rx] =
+      create_txrx(build_tx_config(tx_interface, socket_mode::af_xdp), rx_config, rx_executor, logger);
+  ASSERT_NE(shared_tx, nullptr);
+  ASSERT_NE(shared_rx, nullptr);
+
+  frame_notifier_spy shared_notifier;
+  shared_rx->get_operation_controller().start(shared_notifier);
+
+  // The peer interface is already used by the fixture receiver, so the peer transmits through a regular socket.
+  auto peer_tx = create_transmitter(build_tx_config(rx_interface, socket_mode::standard), logger);
+  ASSERT_NE(peer_tx, nullptr);
+
+  std::vector<uint8_t>             tx_frame = build_frame(1000, 0x01);
+  std::vector<uint8_t>             rx_frame = build_frame(6000, 0x02);
+  std::vector<span<const uint8_t>> tx_burst = {tx_frame};
+  std::vector<span<const uint8_t>> rx_burst = {rx_frame};
+  shared_tx->send(tx_burst);
+  peer_tx->send(rx_burst);
+  wait_for_frames(1);
+  wait_for_frames(shared_notifier, 1);
+
+  shared_rx->get_operation_controller().stop();
+
+  std::vector<std::vector<uint8_t>> transmitted = notifier.get_frames();
+  ASSERT_EQ(transmitted.size(), 1);
+  ASSERT_EQ(transmitted.front(), tx_frame);
+
+  std::vector<std::vector<uint8_t>> received = shared_notifier.get_frames();
+  ASSERT_EQ(received.size(), 1);
+  ASSERT_EQ(received.front(), rx_frame);
+}
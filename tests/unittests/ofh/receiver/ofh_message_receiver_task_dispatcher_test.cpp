@@ -0,0 +1,159 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "../../../../lib/ofh/operation_controller_dummy.h"
+#include "../../../../lib/ofh/receiver/ofh_message_receiver_task_dispatcher.h"
+#include "../../support/task_executor_test_doubles.h"
+#include "ocudu/ofh/ethernet/ethernet_controller.h"
+#include "ocudu/ofh/ethernet/ethernet_receiver_metrics_collector.h"
+#include "ocudu/ofh/ethernet/ethernet_unique_buffer.h"
+#include <gtest/gtest.h>
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// Dummy Ethernet receive buffer.
+class dummy_eth_rx_buffer : public ether::rx_buffer
+{
+public:
+  explicit dummy_eth_rx_buffer(std::vector<uint8_t>&& init_values) { buffer = init_values; }
+
+  span<const uint8_t> data() const override { return buffer; }
+
+private:
+  std::vector<uint8_t> buffer;
+};
+
+/// Dummy Ethernet receiver.
+class dummy_eth_receiver : public ether::receiver, public ether::receiver_operation_controller
+{
+  // See interface for documentation.
+  void start(ether::frame_notifier& notifier) override {}
+
+  // See interface for documentation.
+  void stop() override {}
+
+  // See interface for documentation.
+  ether::receiver_operation_controller& get_operation_controller() override { return *this; }
+
+  // See interface for documentation.
+  ether::receiver_metrics_collector* get_metrics_collector() override { return nullptr; }
+};
+
+/// Message receiver spy that records the eAxC of the received frames.
+class message_receiver_spy : public message_receiver
+{
+public:
+  // See interface for documentation.
+  void on_new_frame(ether::unique_rx_buffer buffer) override
+  {
+    span<const uint8_t> frame = buffer.data();
+    eaxcs.push_back((frame[EAXC_OFFSET] << 8U) | frame[EAXC_OFFSET + 1]);
+  }
+
+  // See interface for documentation.
+  operation_controller& get_operation_controller() override { return controller; }
+
+  // See interface for documentation.
+  message_receiver_metrics_collector* get_metrics_collector() override { return nullptr; }
+
+  /// Returns the eAxCs of the received frames.
+  const std::vector<unsigned>& get_received_eaxcs() const { return eaxcs; }
+
+  /// Byte offset of the eAxC within the frames.
+  static constexpr unsigned EAXC_OFFSET = 18;
+
+private:
+  std::vector<unsigned>      eaxcs;
+  operation_controller_dummy controller;
+};
+
+/// Builds an Ethernet frame carrying an eCPRI IQ data message of the given eAxC.
+ether::unique_rx_buffer build_frame(unsigned eaxc)
+{
+  std::vector<uint8_t> frame(64, 0);
+  frame[message_receiver_spy::EAXC_OFFSET]     = eaxc >> 8U;
+  frame[message_receiver_spy::EAXC_OFFSET + 1] = eaxc & 0xffU;
+
+  return ether::unique_rx_buffer(dummy_eth_rx_buffer(std::move(frame)));
+}
+
+} // namespace
+
+class ofh_message_receiver_task_dispatcher_fixture : public ::testing::Test
+{
+protected:
+  static constexpr unsigned                                             nof_lanes  = 2;
+  std::vector<unsigned>                                                 ul_eaxc    = {4, 5, 6, 7};
+  std::vector<unsigned>                                                 prach_eaxc = {8, 9};
+  std::array<message_receiver_spy, nof_lanes>                           receivers;
+  std::vector<std::unique_ptr<manual_task_worker_always_enqueue_tasks>> executors;
+  std::unique_ptr<ofh_message_receiver_task_dispatcher>                 dispatcher;
+
+  ofh_message_receiver_task_dispatcher_fixture()
+  {
+    std::vector<message_receiver_lane> lanes;
+    for (unsigned i_lane = 0; i_lane != nof_lanes; ++i_lane) {
+      executors.push_back(std::make_unique<manual_task_worker_always_enqueue_tasks>(16));
+      lanes.push_back({&receivers[i_lane], executors.back().get()});
+    }
+
+    dispatcher = std::make_unique<ofh_message_receiver_task_dispatcher>(ocudulog::fetch_basic_logger("TEST"),
+                                                                        std::move(lanes),
+                                                                        ul_eaxc,
+                                                                        prach_eaxc,
+                                                                        0,
+                                                                        std::make_unique<dummy_eth_receiver>());
+    dispatcher->start();
+  }
+
+  /// Runs the pending tasks of all the lanes.
+  void run_pending_tasks()
+  {
+    for (auto& executor : executors) {
+      executor->run_pending_tasks();
+    }
+  }
+};
+
+TEST_F(ofh_message_receiver_task_dispatcher_fixture, eaxcs_are_distributed_among_lanes)
+{
+  for (unsigned eaxc : {4, 5, 6, 7, 8, 9}) {
+    dispatcher->on_new_frame(build_frame(eaxc));
+  }
+  run_pending_tasks();
+
+  ASSERT_EQ(receivers[0].get_received_eaxcs(), std::vector<unsigned>({4, 6, 8}));
+  ASSERT_EQ(receivers[1].get_received_eaxcs(), std::vector<unsigned>({5, 7, 9}));
+}
+
+TEST_F(ofh_message_receiver_task_dispatcher_fixture, frames_of_an_eaxc_keep_their_order_in_the_same_lane)
+{
+  for (unsigned i = 0; i != 4; ++i) {
+    dispatcher->on_new_frame(build_frame(5));
+    dispatcher->on_new_frame(build_frame(4));
+  }
+  run_pending_tasks();
+
+  ASSERT_EQ(receivers[0].get_received_eaxcs(), std::vector<unsigned>(4, 4));
+  ASSERT_EQ(receivers[1].get_received_eaxcs(), std::vector<unsigned>(4, 5));
+}
+
+TEST_F(ofh_message_receiver_task_dispatcher_fixture, unknown_eaxcs_are_dispatched_to_first_lane)
+{
+  dispatcher->on_new_frame(build_frame(3));
+  dispatcher->on_new_frame(build_frame(1000));
+  run_pending_tasks();
+
+  ASSERT_EQ(receivers[0].get_received_eaxcs(), std::vector<unsigned>({3, 1000}));
+  ASSERT_TRUE(receivers[1].get_received_eaxcs().empty());
+}
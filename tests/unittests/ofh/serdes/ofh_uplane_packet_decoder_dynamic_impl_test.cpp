@@ -453,6 +453,54 @@ TEST(ofh_uplane_packet_decoder_dynamic_impl, bfp_with_15_bits_without_ud_comp_pa
   ASSERT_FALSE(decode_result);
 }
 
+TEST(ofh_uplane_packet_decoder_dynamic_impl, mu_law_with_9_bits_should_pass)
+{
+  std::vector<uint8_t> packet = {0x10, 0x02, 0x40, 0x42, 0x00, 0x70, 0x24, 0x01, 0x93, 0x00, 0x00, 0x01, 0x7c, 0x01,
+                                 0x7c, 0x01, 0x86, 0x01, 0x86, 0x01, 0x90, 0x01, 0x90, 0x01, 0x9a, 0x01, 0x9a, 0x01,
+                                 0xa4, 0x01, 0xa4, 0x01, 0xae, 0x01, 0xae, 0x01, 0xb8, 0x01, 0xb8, 0x01, 0xc2, 0x01,
+                                 0xc2, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xd6, 0x01, 0xd6, 0x01, 0xe0, 0x01, 0xe0, 0x01};
+
+  const ru_compression_params                     compr_params = {compression_type::mu_law, 9};
+  uplane_message_decoder_dynamic_compression_impl decoder(ocudulog::fetch_basic_logger("TEST"),
+                                                          subcarrier_spacing::kHz30,
+                                                          get_nsymb_per_slot(cyclic_prefix::NORMAL),
+                                                          273,
+                                                          0,
+                                                          std::make_unique<iq_decompressor_dummy>());
+
+  uplane_message_decoder_results results;
+  bool                           decode_result = decoder.decode(results, packet);
+
+  ASSERT_TRUE(decode_result);
+  const uplane_section_params& section = results.sections.front();
+  ASSERT_EQ(section.ud_comp_hdr.data_width, compr_params.data_width);
+  ASSERT_EQ(section.ud_comp_hdr.type, compr_params.type);
+}
+
+TEST(ofh_uplane_packet_decoder_dynamic_impl, mu_law_with_less_than_5_bits_must_fail)
+{
+  std::vector<uint8_t> packet = {0x10, 0x02, 0x40, 0x42, 0x00, 0x70, 0x24, 0x01, 0x93, 0x00, 0x00, 0x01, 0x7c, 0x01,
+                                 0x7c, 0x01, 0x86, 0x01, 0x86, 0x01, 0x90, 0x01, 0x90, 0x01, 0x9a, 0x01, 0x9a, 0x01,
+                                 0xa4, 0x01, 0xa4, 0x01, 0xae, 0x01, 0xae, 0x01, 0xb8, 0x01, 0xb8, 0x01, 0xc2, 0x01,
+                                 0xc2, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xd6, 0x01, 0xd6, 0x01, 0xe0, 0x01, 0xe0, 0x01};
+
+  uplane_message_decoder_dynamic_compression_impl decoder(ocudulog::fetch_basic_logger("TEST"),
+                                                          subcarrier_spacing::kHz30,
+                                                          get_nsymb_per_slot(cyclic_prefix::NORMAL),
+                                                          273,
+                                                          0,
+                                                          std::make_unique<iq_decompressor_dummy>());
+
+  // A bit width of 0 stands for 16 bits.
+  for (unsigned i = 1; i != MIN_MU_LAW_IQ_WIDTH; ++i) {
+    packet[8] = (i << 4U) | to_value(compression_type::mu_law);
+    uplane_message_decoder_results results;
+    bool                           decode_result = decoder.decode(results, packet);
+
+    ASSERT_FALSE(decode_result) << fmt::format("data_width={}", i);
+  }
+}
+
 TEST(ofh_uplane_packet_decoder_dynamic_impl, if_message_num_prbs_equals_zero_decoder_uses_configured_ru_nof_prbs)
 {
   std::vector<uint8_t> packet = {0x10, 0x02, 0x40, 0x42, 0x00, 0x70, 0x24, 0x00, 0x91, 0x00, 0x00, 0x01, 0x7c, 0x01,
@@ -0,0 +1,56 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#pragma once
+
+#include "../../../../lib/ofh/timing/ofh_timing_clock.h"
+
+namespace ocudu {
+namespace ofh {
+namespace testing {
+
+/// \brief Simulated timing clock.
+///
+/// The time of the clock only advances when it is read or when a thread sleeps on it, so the timing worker runs as
+/// fast as possible while observing a deterministic time.
+class simulated_timing_clock : public timing_clock
+{
+public:
+  /// \brief Constructs a simulated clock.
+  ///
+  /// \param[in] start_time_      Initial time of the clock.
+  /// \param[in] read_duration_   Time advanced by every clock reading.
+  /// \param[in] sleep_overshoot_ Time a sleeping thread oversleeps the requested duration.
+  simulated_timing_clock(std::chrono::nanoseconds start_time_,
+                         std::chrono::nanoseconds read_duration_,
+                         std::chrono::nanoseconds sleep_overshoot_) :
+    current_time(start_time_), read_duration(read_duration_), sleep_overshoot(sleep_overshoot_)
+  {
+  }
+
+  // See interface for documentation.
+  std::chrono::nanoseconds now() override
+  {
+    current_time += read_duration;
+    return current_time;
+  }
+
+  // See interface for documentation.
+  void sleep_for(std::chrono::nanoseconds duration) override { current_time += duration + sleep_overshoot; }
+
+private:
+  std::chrono::nanoseconds       current_time;
+  const std::chrono::nanoseconds read_duration;
+  const std::chrono::nanoseconds sleep_overshoot;
+};
+
+} // namespace testing
+} // namespace ofh
+} // namespace ocudu
@@ -0,0 +1,131 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "../../../../lib/ofh/timing/realtime_timing_worker.h"
+#include "ofh_timing_clock_test_doubles.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/timing/ofh_ota_symbol_boundary_notifier.h"
+#include "ocudu/ofh/timing/ofh_timing_metrics.h"
+#include "ocudu/support/executors/task_worker.h"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <thread>
+
+using namespace ocudu;
+using namespace ofh;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// OTA symbol boundary notifier spy that records the first notified symbols.
+class ota_symbol_boundary_notifier_spy : public ota_symbol_boundary_notifier
+{
+public:
+  explicit ota_symbol_boundary_notifier_spy(unsigned max_nof_symbols_) : max_nof_symbols(max_nof_symbols_)
+  {
+    symbols.reserve(max_nof_symbols);
+  }
+
+  // See interface for documentation.
+  void on_new_symbol(const slot_symbol_point_context& symbol_point_context) override
+  {
+    if (symbols.size() == max_nof_symbols) {
+      return;
+    }
+    symbols.push_back(symbol_point_context.symbol_point);
+    nof_symbols.store(symbols.size(), std::memory_order_release);
+  }
+
+  /// Returns true when the maximum number of symbols has been recorded.
+  bool is_full() const { return nof_symbols.load(std::memory_order_acquire) == max_nof_symbols; }
+
+  /// Returns the recorded symbols.
+  const std::vector<slot_symbol_point>& get_symbols() const { return symbols; }
+
+private:
+  const unsigned                 max_nof_symbols;
+  std::vector<slot_symbol_point> symbols;
+  std::atomic<unsigned>          nof_symbols = {0};
+};
+
+} // namespace
+
+class realtime_timing_worker_fixture : public ::testing::Test
+{
+protected:
+  static constexpr unsigned nof_symbols = 1000;
+
+  task_worker                      worker{"timing", 16};
+  task_worker_executor             executor{worker};
+  ota_symbol_boundary_notifier_spy notifier{nof_symbols};
+
+  /// Runs a timing worker with the given clock until the notifier records all the symbols and returns its metrics.
+  timing_metrics run(timing_clock& clock, std::chrono::microseconds spin_margin)
+  {
+    realtime_worker_cfg cfg = {cyclic_prefix::NORMAL, subcarrier_spacing::kHz30, 0, 0, false};
+    cfg.spin_margin         = spin_margin;
+
+    realtime_timing_worker timing_worker(ocudulog::fetch_basic_logger("TEST"), executor, clock, cfg);
+
+    std::vector<ota_symbol_boundary_notifier*> notifiers = {&notifier};
+    timing_worker.subscribe(notifiers);
+    timing_worker.start();
+    while (!notifier.is_full()) {
+      std::this_thread::yield();
+    }
+    timing_worker.stop();
+
+    timing_metrics metrics;
+    timing_worker.get_metrics_collector().collect_metrics(metrics);
+    return metrics;
+  }
+};
+
+TEST_F(realtime_timing_worker_fixture, symbols_are_notified_consecutively)
+{
+  ofh::testing::simulated_timing_clock clock(1'700'000'000s, 100ns, 0ns);
+  timing_metrics                       metrics = run(clock, 10us);
+
+  const std::vector<slot_symbol_point>& symbols = notifier.get_symbols();
+  for (unsigned i_symbol = 1; i_symbol != nof_symbols; ++i_symbol) {
+    ASSERT_EQ(symbols[i_symbol], symbols[i_symbol - 1] + 1);
+  }
+  ASSERT_EQ(metrics.nof_skipped_symbols, 0U);
+}
+
+TEST_F(realtime_timing_worker_fixture, oversleeping_is_reported_as_wakeup_jitter)
+{
+  // Without spin margin, the worker wakes up after every symbol boundary by the time the clock oversleeps.
+  ofh::testing::simulated_timing_clock clock(1'700'000'000s, 100ns, 3us);
+  timing_metrics                       metrics = run(clock, 0us);
+
+  unsigned nof_wakeups =
+      std::accumulate(metrics.wakeup_jitter_histogram.begin(), metrics.wakeup_jitter_histogram.end(), 0U);
+  ASSERT_GE(nof_wakeups, nof_symbols);
+  // Jitter between 2 and 5 microseconds.
+  ASSERT_EQ(metrics.wakeup_jitter_histogram[2], nof_wakeups);
+  ASSERT_GE(metrics.wakeup_jitter_min_us, 3.0);
+  ASSERT_LE(metrics.wakeup_jitter_min_us, metrics.wakeup_jitter_max_us);
+  ASSERT_LT(metrics.wakeup_jitter_max_us, 4.0);
+}
+
+TEST_F(realtime_timing_worker_fixture, spin_margin_absorbs_oversleeping)
+{
+  // The worker wakes up before the symbol boundary and polls the clock until the boundary.
+  ofh::testing::simulated_timing_clock clock(1'700'000'000s, 100ns, 3us);
+  timing_metrics                       metrics = run(clock, 10us);
+
+  unsigned nof_wakeups =
+      std::accumulate(metrics.wakeup_jitter_histogram.begin(), metrics.wakeup_jitter_histogram.end(), 0U);
+  ASSERT_GE(nof_wakeups, nof_symbols);
+  // Jitter below 1 microsecond.
+  ASSERT_EQ(metrics.wakeup_jitter_histogram[0], nof_wakeups);
+  ASSERT_LT(metrics.wakeup_jitter_max_us, 1.0);
+}
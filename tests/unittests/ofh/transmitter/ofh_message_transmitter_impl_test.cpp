@@ -0,0 +1,179 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "../../../../lib/ofh/transmitter/ofh_message_transmitter_impl.h"
+#include "ocudu/ofh/transmitter/ofh_transmitter_metrics.h"
+#include "ocudu/support/executors/manual_task_worker.h"
+#include <gtest/gtest.h>
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// Ethernet transmitter spy that records the size of the transmitted bursts.
+class ethernet_transmitter_spy : public ether::transmitter
+{
+public:
+  explicit ethernet_transmitter_spy(std::vector<unsigned>& burst_sizes_) : burst_sizes(burst_sizes_) {}
+
+  // See interface for documentation.
+  void send(span<span<const uint8_t>> frames) override { burst_sizes.push_back(frames.size()); }
+
+  // See interface for documentation.
+  ether::transmitter_metrics_collector* get_metrics_collector() override { return nullptr; }
+
+private:
+  std::vector<unsigned>& burst_sizes;
+};
+
+} // namespace
+
+class ofh_message_transmitter_impl_fixture : public ::testing::Test
+{
+protected:
+  static constexpr units::bytes mtu{9000};
+
+  ocudulog::basic_logger&                logger = ocudulog::fetch_basic_logger("TEST");
+  std::vector<unsigned>                  burst_sizes;
+  manual_task_worker                     worker{16};
+  std::shared_ptr<ether::eth_frame_pool> pool_dl_cp =
+      std::make_shared<ether::eth_frame_pool>(logger, mtu, 2, message_type::control_plane, data_direction::downlink);
+  std::shared_ptr<ether::eth_frame_pool> pool_ul_cp =
+      std::make_shared<ether::eth_frame_pool>(logger, mtu, 2, message_type::control_plane, data_direction::uplink);
+  std::shared_ptr<ether::eth_frame_pool> pool_dl_up =
+      std::make_shared<ether::eth_frame_pool>(logger, mtu, 2, message_type::user_plane, data_direction::downlink);
+  slot_symbol_point symbol_point{slot_point(1, 10, 1), 3, 14};
+
+  /// Creates a message transmitter that sends the frames of a symbol in the given number of batches.
+  std::unique_ptr<message_transmitter_impl> create_transmitter(unsigned nof_batches)
+  {
+    tx_window_timing_parameters timing_params = {};
+    tx_pacing_parameters        pacing_params = {nof_batches, std::chrono::microseconds(10)};
+
+    return std::make_unique<message_transmitter_impl>(logger,
+                                                      worker,
+                                                      timing_params,
+                                                      pacing_params,
+                                                      true,
+                                                      std::make_unique<ethernet_transmitter_spy>(burst_sizes),
+                                                      pool_dl_cp,
+                                                      pool_ul_cp,
+                                                      pool_dl_up);
+  }
+
+  /// Writes the given number of User-Plane frames in the pool for the test symbol.
+  void write_frames(unsigned nof_frames)
+  {
+    for (unsigned i_frame = 0; i_frame != nof_frames; ++i_frame) {
+      ether::scoped_frame_buffer buffer = pool_dl_up->reserve(symbol_point);
+      ASSERT_TRUE(buffer);
+      buffer->set_size(128);
+    }
+  }
+};
+
+TEST_F(ofh_message_transmitter_impl_fixture, frames_are_sent_in_one_burst_without_pacing)
+{
+  auto transmitter = create_transmitter(1);
+  write_frames(5);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now()});
+
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({5}));
+
+  message_transmitter_metrics metrics;
+  transmitter->get_metrics_collector().collect_metrics(metrics);
+  ASSERT_EQ(metrics.max_symbol_burst_size, 5);
+  ASSERT_FLOAT_EQ(metrics.avg_symbol_burst_size, 5.F);
+  ASSERT_EQ(metrics.nof_on_time_batches + metrics.nof_late_batches, 0);
+}
+
+TEST_F(ofh_message_transmitter_impl_fixture, frames_are_distributed_evenly_among_batches)
+{
+  auto transmitter = create_transmitter(2);
+  write_frames(5);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now()});
+  worker.run_pending_tasks();
+
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({2, 3}));
+
+  message_transmitter_metrics metrics;
+  transmitter->get_metrics_collector().collect_metrics(metrics);
+  ASSERT_EQ(metrics.max_symbol_burst_size, 5);
+  ASSERT_EQ(metrics.nof_on_time_batches + metrics.nof_late_batches, 2);
+}
+
+TEST_F(ofh_message_transmitter_impl_fixture, number_of_batches_is_limited_by_number_of_frames)
+{
+  auto transmitter = create_transmitter(4);
+  write_frames(3);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now()});
+  worker.run_pending_tasks();
+
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({1, 1, 1}));
+}
+
+TEST_F(ofh_message_transmitter_impl_fixture, batches_of_a_past_symbol_are_late)
+{
+  auto transmitter = create_transmitter(2);
+  write_frames(4);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now() - std::chrono::seconds(1)});
+
+  // All the batches of a past symbol are due, so they are sent without deferring any task.
+  ASSERT_FALSE(worker.has_pending_tasks());
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({2, 2}));
+
+  message_transmitter_metrics metrics;
+  transmitter->get_metrics_collector().collect_metrics(metrics);
+  ASSERT_EQ(metrics.nof_on_time_batches, 0);
+  ASSERT_EQ(metrics.nof_late_batches, 2);
+}
+
+TEST_F(ofh_message_transmitter_impl_fixture, batches_are_deferred_until_due)
+{
+  auto transmitter = create_transmitter(2);
+  write_frames(4);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now() + std::chrono::milliseconds(1)});
+
+  // No batch is due yet, so the transmission is deferred in the executor.
+  ASSERT_TRUE(burst_sizes.empty());
+  ASSERT_TRUE(worker.has_pending_tasks());
+
+  worker.run_pending_tasks();
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({2, 2}));
+}
+
+TEST_F(ofh_message_transmitter_impl_fixture, pending_batches_are_flushed_by_next_symbol)
+{
+  auto transmitter = create_transmitter(2);
+  write_frames(4);
+
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now() + std::chrono::seconds(1)});
+  ASSERT_TRUE(burst_sizes.empty());
+
+  // The frames of the next symbol are sent after the pending batches of the previous one.
+  write_frames(2);
+  transmitter->on_new_symbol({symbol_point, 0, std::chrono::system_clock::now() - std::chrono::seconds(1)});
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({2, 2, 1, 1}));
+
+  // The deferred task finds no pending batches.
+  worker.run_pending_tasks();
+  ASSERT_EQ(burst_sizes, std::vector<unsigned>({2, 2, 1, 1}));
+
+  message_transmitter_metrics metrics;
+  transmitter->get_metrics_collector().collect_metrics(metrics);
+  ASSERT_EQ(metrics.nof_on_time_batches, 2);
+  ASSERT_EQ(metrics.nof_late_batches, 2);
+}
@@ -0,0 +1,152 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "../../../../lib/ofh/transmitter/ofh_uplane_header_template_cache.h"
+#include "ocudu/ofh/compression/compression_factory.h"
+#include "ocudu/ofh/compression/compression_properties.h"
+#include "ocudu/ofh/ecpri/ecpri_factories.h"
+#include "ocudu/ofh/ethernet/ethernet_factories.h"
+#include "ocudu/ocudulog/ocudulog.h"
+#include "ocudu/ofh/serdes/ofh_serdes_factories.h"
+#include "ocudu/ran/resource_block.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace ocudu;
+using namespace ofh;
+
+namespace {
+
+/// Test parameters: compression parameters, static compression header flag and VLAN tag flag.
+using test_params = std::tuple<ru_compression_params, bool, bool>;
+
+} // namespace
+
+class ofh_uplane_header_template_cache_fixture : public ::testing::TestWithParam<test_params>
+{
+protected:
+  const ru_compression_params             compr_params         = std::get<0>(GetParam());
+  const bool                              is_static_compr_hdr  = std::get<1>(GetParam());
+  const bool                              is_vlan_enabled      = std::get<2>(GetParam());
+  const std::vector<unsigned>             eaxcs                = {0, 1, 7, 31};
+  ocudulog::basic_logger&                 logger               = ocudulog::fetch_basic_logger("TEST");
+  std::unique_ptr<iq_compressor>          compressor           = create_iq_compressor(compr_params.type, logger);
+  std::unique_ptr<ether::frame_builder>   eth_builder          = create_eth_builder();
+  std::unique_ptr<ecpri::packet_builder>  ecpri_builder        = ecpri::create_ecpri_packet_builder();
+  std::unique_ptr<uplane_message_builder> up_builder           = create_up_builder();
+  uplane_header_template_cache            templates{*eth_builder, *ecpri_builder, *up_builder, compr_params, eaxcs};
+  std::mt19937                            rgen{0};
+
+  std::unique_ptr<ether::frame_builder> create_eth_builder() const
+  {
+    ether::vlan_frame_params params;
+    params.mac_dst_address = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0x11};
+    params.mac_src_address = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0x22};
+    params.eth_type        = 0xaefe;
+    if (is_vlan_enabled) {
+      params.tci = 6;
+      return ether::create_vlan_frame_builder(params);
+    }
+    return ether::create_frame_builder(params);
+  }
+
+  std::unique_ptr<uplane_message_builder> create_up_builder()
+  {
+    return is_static_compr_hdr ? create_static_compr_method_ofh_user_plane_packet_builder(logger, *compressor)
+                               : create_dynamic_compr_method_ofh_user_plane_packet_builder(logger, *compressor);
+  }
+
+  /// Builds a message field by field with the builders and returns its size.
+  unsigned build_reference(span<uint8_t>                buffer,
+                           span<const cbf16_t>          iq_data,
+                           const uplane_message_params& params,
+                           unsigned                     eaxc,
+                           uint16_t                     seq_id)
+  {
+    unsigned eth_size   = eth_builder->get_header_size().value();
+    unsigned ecpri_size = ecpri_builder->get_header_size(ecpri::message_type::iq_data).value();
+    unsigned nof_bytes  = up_builder->build_message(buffer.last(buffer.size() - eth_size - ecpri_size), iq_data, params);
+    ecpri_builder->build_data_packet(buffer.subspan(eth_size, ecpri_size + nof_bytes),
+                                     {static_cast<uint16_t>(eaxc), seq_id});
+    eth_builder->build_frame(buffer.first(eth_size + ecpri_size + nof_bytes));
+
+    return eth_size + ecpri_size + nof_bytes;
+  }
+
+  /// Builds a message from the header template and returns its size.
+  unsigned build_from_template(span<uint8_t>                buffer,
+                               span<const cbf16_t>          iq_data,
+                               const uplane_message_params& params,
+                               unsigned                     eaxc,
+                               uint16_t                     seq_id)
+  {
+    units::bytes  payload_size = get_compressed_prb_size(compr_params) * params.nof_prb;
+    span<uint8_t> frame        = buffer.first((templates.get_header_size() + payload_size).value());
+    compressor->compress(frame.last(payload_size.value()), iq_data, compr_params);
+    templates.write_header(frame, eaxc, seq_id, params.slot, params.symbol_id, params.start_prb, params.nof_prb);
+
+    return frame.size();
+  }
+};
+
+TEST_P(ofh_uplane_header_template_cache_fixture, messages_match_field_by_field_builders)
+{
+  static constexpr unsigned nof_prbs = 273;
+
+  std::uniform_real_distribution<float> dist(-1.0, +1.0);
+  std::vector<cbf16_t>                  iq_data(nof_prbs * NOF_SUBCARRIERS_PER_RB);
+  std::generate(iq_data.begin(), iq_data.end(), [&]() { return cbf16_t{dist(rgen), dist(rgen)}; });
+
+  std::vector<uint8_t> expected(16384);
+  std::vector<uint8_t> actual(16384);
+
+  std::uniform_int_distribution<unsigned> eaxc_dist(0, eaxcs.size() - 1);
+  std::uniform_int_distribution<unsigned> prb_dist(0, nof_prbs - 1);
+  std::uniform_int_distribution<unsigned> seq_dist(0, std::numeric_limits<uint16_t>::max());
+
+  for (unsigned i_slot = 0; i_slot < 2 * 10240; i_slot += 37) {
+    slot_point slot(to_numerology_value(subcarrier_spacing::kHz60), i_slot);
+    for (unsigned symbol_id = 0; symbol_id != MAX_NSYMB_PER_SLOT; ++symbol_id) {
+      unsigned start_prb = prb_dist(rgen);
+      unsigned nof_prb   = std::uniform_int_distribution<unsigned>(1, nof_prbs - start_prb)(rgen);
+      unsigned eaxc      = eaxcs[eaxc_dist(rgen)];
+      uint16_t seq_id    = seq_dist(rgen);
+
+      uplane_message_params params;
+      params.direction                     = data_direction::downlink;
+      params.slot                          = slot;
+      params.filter_index                  = filter_index_type::standard_channel_filter;
+      params.start_prb                     = start_prb;
+      params.nof_prb                       = nof_prb;
+      params.symbol_id                     = symbol_id;
+      params.sect_type                     = section_type::type_1;
+      params.compression_params.type       = compr_params.type;
+      params.compression_params.data_width = compr_params.data_width;
+
+      span<const cbf16_t> section_iq = span<const cbf16_t>(iq_data).subspan(start_prb * NOF_SUBCARRIERS_PER_RB,
+                                                                              nof_prb * NOF_SUBCARRIERS_PER_RB);
+
+      unsigned expected_size = build_reference(expected, section_iq, params, eaxc, seq_id);
+      unsigned actual_size   = build_from_template(actual, section_iq, params, eaxc, seq_id);
+
+      ASSERT_EQ(expected_size, actual_size);
+      ASSERT_EQ(span<const uint8_t>(expected).first(expected_size), span<const uint8_t>(actual).first(actual_size))
+          << fmt::format("slot={} symbol={} prbs={}:{} eaxc={}", slot, symbol_id, start_prb, nof_prb, eaxc);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ofh_uplane_header_template_cache,
+                         ofh_uplane_header_template_cache_fixture,
+                         ::testing::Combine(::testing::Values(ru_compression_params{compression_type::none, 16},
+                                                              ru_compression_params{compression_type::BFP, 9},
+                                                              ru_compression_params{compression_type::BFP, 14}),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()));
@@ -25,6 +25,9 @@ static std::mt19937 rgen(0);
 
 static std::set<unsigned> dft_required_sizes = {4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192};
 
+// DFT sizes for the generic DFT, which include the PRACH sequence lengths.
+static std::set<unsigned> dft_generic_required_sizes = {128, 139, 256, 512, 768, 839, 1024, 1536, 2048, 3072, 4096};
+
 // Maximum allowed peak error.
 static float ASSERT_MAX_ERROR = 10;
 
@@ -67,6 +70,8 @@ protected:
     const std::string& dft_factory_str = std::get<0>(GetParam());
     if (dft_factory_str == "avx2") {
       dft_factory = create_dft_processor_ci16_factory_avx2();
+    } else if (dft_factory_str == "generic") {
+      dft_factory = create_dft_processor_ci16_factory_generic();
     }
   }
 
@@ -175,9 +180,18 @@ TEST_P(DFTprocessorFixture, DFTProcessorUnittest)
 }
 
 // Creates test suite that combines all possible parameters.
+#ifdef __x86_64__
 INSTANTIATE_TEST_SUITE_P(DFTProcessorTest,
                          DFTprocessorFixture,
                          ::testing::Combine(::testing::Values("avx2"),
                                             ::testing::ValuesIn(dft_required_sizes),
                                             ::testing::Values(dft_processor_ci16::direction::direct,
                                                               dft_processor_ci16::direction::inverse)));
+#endif // __x86_64__
+
+INSTANTIATE_TEST_SUITE_P(DFTProcessorGenericTest,
+                         DFTprocessorFixture,
+                         ::testing::Combine(::testing::Values("generic"),
+                                            ::testing::ValuesIn(dft_generic_required_sizes),
+                                            ::testing::Values(dft_processor_ci16::direction::direct,
+                                                              dft_processor_ci16::direction::inverse)));
@@ -38,6 +38,10 @@ static std::set<unsigned> dft_required_sizes = []() {
     dft_sizes.emplace(nof_prb * NOF_SUBCARRIERS_PER_RB);
   }
 
+  // Append PRACH sequence lengths, which are prime numbers.
+  dft_sizes.emplace(139);
+  dft_sizes.emplace(839);
+
   return dft_sizes;
 }();
 
@@ -63,98 +63,105 @@ int main()
           continue;
         }
 
-        // Reset spies.
-        dft_factory->clear_entries();
-
-        // Create OFDM demodulator configuration. Use minimum number of RB.
-        ofdm_demodulator_configuration ofdm_config;
-        ofdm_config.numerology                = to_numerology_value(scs);
-        ofdm_config.bw_rb                     = 11;
-        ofdm_config.dft_size                  = dft_size;
-        ofdm_config.cp                        = cp;
-        ofdm_config.nof_samples_window_offset = 0;
-        ofdm_config.scale                     = dist_rg(rgen);
-        ofdm_config.center_freq_Hz            = 0.0;
-
-        unsigned nsubc = ofdm_config.bw_rb * NOF_SUBCARRIERS_PER_RB;
-
-        // Create OFDM demodulator.
-        std::unique_ptr<ofdm_slot_demodulator> ofdm = ofdm_factory->create_ofdm_slot_demodulator(ofdm_config);
-        TESTASSERT(ofdm != nullptr);
-
-        // Check is a DFT processor is created and not used.
-        auto& dft_processor_factory_entry = dft_factory->get_entries();
-        TESTASSERT(dft_processor_factory_entry.size() == 1);
-        dft_processor_spy& dft = *dft_processor_factory_entry[0].dft;
-        TESTASSERT(dft.get_entries().empty());
-
-        // Iterate all slots within a subframe.
-        for (unsigned slot_idx = 0, nslot = get_nof_slots_per_subframe(scs); slot_idx != nslot; ++slot_idx) {
-          // Select a random port.
-          unsigned port_idx = dist_port(rgen);
-
-          // Generate random time domain data.
-          unsigned          nsymb = get_nsymb_per_slot(cp);
-          std::vector<cf_t> time_data;
-          // Iterate all symbols in the slot.
-          for (unsigned symbol_idx = 0; symbol_idx != nsymb; ++symbol_idx) {
-            // Get the size of the current time-domain symbol.
-            unsigned nsamples =
-                cp.get_length(nsymb * slot_idx + symbol_idx, scs).to_samples(sampling_rate_Hz) + dft_size;
-            for (unsigned sample_idx = 0; sample_idx != nsamples; ++sample_idx) {
-              cf_t random_value = {dist_rg(rgen), dist_rg(rgen)};
-              time_data.push_back(random_value);
+        // Iterate without and with DFT window offset.
+        for (unsigned window_offset : {0U, (36 * dft_size) / 2048}) {
+          // Reset spies.
+          dft_factory->clear_entries();
+
+          // Create OFDM demodulator configuration. Use minimum number of RB.
+          ofdm_demodulator_configuration ofdm_config;
+          ofdm_config.numerology                = to_numerology_value(scs);
+          ofdm_config.bw_rb                     = 11;
+          ofdm_config.dft_size                  = dft_size;
+          ofdm_config.cp                        = cp;
+          ofdm_config.nof_samples_window_offset = window_offset;
+          ofdm_config.scale                     = dist_rg(rgen);
+          ofdm_config.center_freq_Hz            = 0.0;
+
+          unsigned nsubc = ofdm_config.bw_rb * NOF_SUBCARRIERS_PER_RB;
+
+          // Discrete frequency of the DFT window offset phase compensation.
+          float window_omega =
+              static_cast<float>(window_offset) * static_cast<float>(2.0 * M_PI) / static_cast<float>(dft_size);
+
+          // Create OFDM demodulator.
+          std::unique_ptr<ofdm_slot_demodulator> ofdm = ofdm_factory->create_ofdm_slot_demodulator(ofdm_config);
+          TESTASSERT(ofdm != nullptr);
+
+          // Check is a DFT processor is created and not used.
+          auto& dft_processor_factory_entry = dft_factory->get_entries();
+          TESTASSERT(dft_processor_factory_entry.size() == 1);
+          dft_processor_spy& dft = *dft_processor_factory_entry[0].dft;
+          TESTASSERT(dft.get_entries().empty());
+
+          // Iterate all slots within a subframe.
+          for (unsigned slot_idx = 0, nslot = get_nof_slots_per_subframe(scs); slot_idx != nslot; ++slot_idx) {
+            // Select a random port.
+            unsigned port_idx = dist_port(rgen);
+
+            // Generate random time domain data.
+            unsigned          nsymb = get_nsymb_per_slot(cp);
+            std::vector<cf_t> time_data;
+            // Iterate all symbols in the slot.
+            for (unsigned symbol_idx = 0; symbol_idx != nsymb; ++symbol_idx) {
+              // Get the size of the current time-domain symbol.
+              unsigned nsamples =
+                  cp.get_length(nsymb * slot_idx + symbol_idx, scs).to_samples(sampling_rate_Hz) + dft_size;
+              for (unsigned sample_idx = 0; sample_idx != nsamples; ++sample_idx) {
+                cf_t random_value = {dist_rg(rgen), dist_rg(rgen)};
+                time_data.push_back(random_value);
+              }
             }
-          }
 
-          // Reset DFT spy entries.
-          dft.clear_entries();
-
-          // Demodulate signal.
-          resource_grid_writer_spy rg(MAX_PORTS, MAX_NSYMB_PER_SLOT, ofdm_config.bw_rb);
-          ofdm->demodulate(rg, time_data, port_idx, slot_idx);
-
-          // Check the number of calls to DFT processor match with the number of symbols.
-          TESTASSERT(dft.get_entries().size() == nsymb);
-
-          // Iterate all symbols.
-          std::vector<resource_grid_writer_spy::expected_entry_t> expected_rg;
-          unsigned                                                offset      = 0;
-          auto                                                    dft_entries = dft.get_entries();
-          for (unsigned symbol_idx = 0; symbol_idx != nsymb; ++symbol_idx) {
-            // Get the size of the current time-domain symbol.
-            unsigned symb_size =
-                cp.get_length(nsymb * slot_idx + symbol_idx, scs).to_samples(sampling_rate_Hz) + dft_size;
-
-            // Get input time data.
-            span<cf_t> time_data_symbol(&time_data[offset], symb_size);
-
-            // Get DFT input.
-            span<const cf_t> dft_input = dft_entries[symbol_idx].input;
-
-            // Verify DFT input.
-            TESTASSERT(ocuduvec::equal(time_data_symbol.last(dft_size), dft_input.first(dft_size)));
-
-            // Generate ideal frequency domain outputs.
-            for (unsigned subc_idx = 0; subc_idx != nsubc; ++subc_idx) {
-              resource_grid_writer_spy::expected_entry_t entry = {};
-              entry.port                                       = port_idx;
-              entry.symbol                                     = symbol_idx;
-              entry.subcarrier                                 = subc_idx;
-              if (subc_idx < nsubc / 2) {
-                entry.value = dft_entries[symbol_idx].output[dft_size - (nsubc / 2) + subc_idx] * ofdm_config.scale;
-              } else {
-                entry.value = dft_entries[symbol_idx].output[subc_idx - (nsubc / 2)] * ofdm_config.scale;
+            // Reset DFT spy entries.
+            dft.clear_entries();
+
+            // Demodulate signal.
+            resource_grid_writer_spy rg(MAX_PORTS, MAX_NSYMB_PER_SLOT, ofdm_config.bw_rb);
+            ofdm->demodulate(rg, time_data, port_idx, slot_idx);
+
+            // Check the number of calls to DFT processor match with the number of symbols.
+            TESTASSERT(dft.get_entries().size() == nsymb);
+
+            // Iterate all symbols.
+            std::vector<resource_grid_writer_spy::expected_entry_t> expected_rg;
+            unsigned                                                offset      = 0;
+            auto                                                    dft_entries = dft.get_entries();
+            for (unsigned symbol_idx = 0; symbol_idx != nsymb; ++symbol_idx) {
+              // Get the size of the current time-domain symbol.
+              unsigned symb_size =
+                  cp.get_length(nsymb * slot_idx + symbol_idx, scs).to_samples(sampling_rate_Hz) + dft_size;
+
+              // Get input time data.
+              span<cf_t> time_data_symbol(&time_data[offset], symb_size);
+
+              // Get DFT input.
+              span<const cf_t> dft_input = dft_entries[symbol_idx].input;
+
+              // Verify DFT input, which starts the DFT window offset before the end of the cyclic prefix.
+              TESTASSERT(ocuduvec::equal(time_data_symbol.subspan(symb_size - dft_size - window_offset, dft_size),
+                                         dft_input.first(dft_size)));
+
+              // Generate ideal frequency domain outputs.
+              for (unsigned subc_idx = 0; subc_idx != nsubc; ++subc_idx) {
+                resource_grid_writer_spy::expected_entry_t entry = {};
+                entry.port                                       = port_idx;
+                entry.symbol                                     = symbol_idx;
+                entry.subcarrier                                 = subc_idx;
+                unsigned i_bin =
+                    (subc_idx < nsubc / 2) ? (dft_size - (nsubc / 2) + subc_idx) : (subc_idx - (nsubc / 2));
+                entry.value = dft_entries[symbol_idx].output[i_bin] * ofdm_config.scale *
+                              std::polar(1.0F, window_omega * static_cast<float>(i_bin));
+                expected_rg.push_back(entry);
               }
-              expected_rg.push_back(entry);
+
+              // Increment OFDM symbol offset.
+              offset += symb_size;
             }
 
-            // Increment OFDM symbol offset.
-            offset += symb_size;
+            // Assert resource grid entries.
+            rg.assert_entries(expected_rg);
           }
-
-          // Assert resource grid entries.
-          rg.assert_entries(expected_rg);
         }
       }
     }
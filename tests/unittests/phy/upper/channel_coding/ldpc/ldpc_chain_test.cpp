@@ -368,6 +368,90 @@ TEST_P(LDPCChainFixture, LDPCChainTest)
   }
 }
 
+TEST_P(LDPCChainFixture, LDPCBatchDecoderTest)
+{
+  const test_parameters& tp = GetParam();
+
+  // Number of REs used for transmission.
+  constexpr unsigned nof_scs_per_rb = 12;
+  constexpr unsigned nof_ofdm_syms  = 12;
+  unsigned           nof_res        = tp.nof_rb * nof_scs_per_rb * nof_ofdm_syms * tp.nof_layers;
+
+  // Pick a reasonable transport block size from the parameters.
+  auto     tbs_bits  = static_cast<unsigned>(nof_res * get_bits_per_symbol(tp.modulation) * tp.code_rate);
+  unsigned tbs_bytes = tbs_bits / 8;
+
+  // The base graph depends on the TBS and the coding rate.
+  ldpc_base_graph_type bg = ldpc_base_graph_type::BG1;
+  if ((tbs_bytes <= 36) || ((tbs_bytes <= 478) && (tp.code_rate <= 0.67)) || (tp.code_rate <= 0.25)) {
+    bg = ldpc_base_graph_type::BG2;
+  }
+
+  // Configure the segmenter.
+  segmenter_config cfg_seg = {
+      .base_graph = bg, .rv = 0, .mod = tp.modulation, .nof_layers = tp.nof_layers, .nof_ch_symbols = nof_res};
+
+  // Fill the transport block with random bits.
+  std::vector<uint8_t> transport_block(tbs_bytes);
+  std::generate(transport_block.begin(), transport_block.end(), []() { return byte_gen(rgen); });
+
+  // Encode and rate match the first codeblock only.
+  const ldpc_segmenter_buffer& segment_buffer = segmenter_tx->new_transmission(transport_block, cfg_seg);
+  codeblock_metadata           metadata       = segment_buffer.get_cb_metadata(0);
+  dynamic_bit_buffer           message_packed(segment_buffer.get_segment_length().value());
+  segment_buffer.read_codeblock(message_packed, transport_block, 0);
+
+  ldpc_encoder::configuration cfg_enc   = {.base_graph   = metadata.tb_common.base_graph,
+                                           .lifting_size = metadata.tb_common.lifting_size};
+  const ldpc_encoder_buffer&  rm_buffer = encoder_test->encode(message_packed, cfg_enc);
+
+  unsigned           rm_length = segment_buffer.get_rm_length(0);
+  dynamic_bit_buffer codeblock_packed(rm_length);
+  rate_matcher->rate_match(codeblock_packed, rm_buffer, metadata);
+  std::vector<uint8_t> codeblock(rm_length);
+  ocuduvec::bit_unpack(codeblock, codeblock_packed);
+
+  // Generate a different noisy version of the codeblock for each entry of the batch.
+  std::uniform_int_distribution<int> amplitude_dist(-4, 12);
+  auto [msg_length, data_length] = get_nof_data_bits(metadata);
+  std::vector<std::vector<log_likelihood_ratio>> llrs_dematched(ldpc_decoder::max_batch_size);
+  std::vector<dynamic_bit_buffer>                expected_bits(ldpc_decoder::max_batch_size);
+  std::vector<dynamic_bit_buffer>                decoded_bits(ldpc_decoder::max_batch_size);
+  std::vector<std::optional<unsigned>>           expected_results(ldpc_decoder::max_batch_size);
+  std::vector<ldpc_decoder::batch_entry>         entries(ldpc_decoder::max_batch_size);
+
+  ldpc_decoder::configuration cfg_dec = {.base_graph      = metadata.tb_common.base_graph,
+                                         .lifting_size    = metadata.tb_common.lifting_size,
+                                         .nof_filler_bits = metadata.cb_specific.nof_filler_bits};
+  for (unsigned i_entry = 0; i_entry != ldpc_decoder::max_batch_size; ++i_entry) {
+    std::vector<log_likelihood_ratio> llr(rm_length);
+    std::transform(codeblock.begin(), codeblock.end(), llr.begin(), [&amplitude_dist](uint8_t b) {
+      // Negative amplitudes introduce bit errors.
+      return log_likelihood_ratio((1 - 2 * b) * amplitude_dist(rgen));
+    });
+
+    llrs_dematched[i_entry].resize(metadata.cb_specific.full_length);
+    rate_dematcher->rate_dematch(llrs_dematched[i_entry], llr, /*new_data=*/true, metadata);
+
+    // Decode each codeblock individually.
+    expected_bits[i_entry].resize(msg_length);
+    expected_results[i_entry] = decoder_test->decode(expected_bits[i_entry], llrs_dematched[i_entry], nullptr, cfg_dec);
+
+    decoded_bits[i_entry].resize(msg_length);
+    entries[i_entry].output          = decoded_bits[i_entry];
+    entries[i_entry].input           = llrs_dematched[i_entry];
+    entries[i_entry].nof_filler_bits = metadata.cb_specific.nof_filler_bits;
+  }
+
+  // Decode all the codeblocks in a batch.
+  decoder_test->decode_batch(entries, cfg_dec);
+
+  for (unsigned i_entry = 0; i_entry != ldpc_decoder::max_batch_size; ++i_entry) {
+    ASSERT_EQ(entries[i_entry].result, expected_results[i_entry]) << fmt::format("Entry {}.", i_entry);
+    ASSERT_EQ(decoded_bits[i_entry], expected_bits[i_entry]) << fmt::format("Entry {}.", i_entry);
+  }
+}
+
 static std::vector<test_parameters> generate_cases()
 {
   std::vector<test_parameters> out;
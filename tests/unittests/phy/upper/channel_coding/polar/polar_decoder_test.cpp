@@ -0,0 +1,102 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Polar decoder unit test.
+///
+/// Random noisy codewords are decoded by the generic polar decoder and by all the SIMD-optimized decoders supported by
+/// the CPU. The decoded messages must be identical, since all the implementations share the same LLR arithmetic.
+
+#include "ocudu/phy/upper/channel_coding/channel_coding_factories.h"
+#include "ocudu/support/ocudu_test.h"
+#include <random>
+
+using namespace ocudu;
+
+static std::mt19937 rgen(1234);
+
+namespace {
+
+/// Polar code parameters.
+struct test_case_t {
+  unsigned        K;
+  unsigned        E;
+  uint8_t         nMax;
+  polar_code_ibil ibil;
+};
+
+} // namespace
+
+static const std::vector<test_case_t> test_cases = {
+    // BCH.
+    {56, 864, 9, polar_code_ibil::not_present},
+    // DCI.
+    {40, 100, 9, polar_code_ibil::not_present},
+    {164, 432, 9, polar_code_ibil::not_present},
+    // UCI.
+    {20, 256, 10, polar_code_ibil::present},
+    {18, 45, 10, polar_code_ibil::present},
+    {18, 38, 10, polar_code_ibil::present},
+    {200, 1024, 10, polar_code_ibil::present},
+    {500, 2048, 10, polar_code_ibil::present},
+};
+
+static constexpr unsigned nof_repetitions = 50;
+
+int main()
+{
+  std::uniform_int_distribution<int> llr_dist(-log_likelihood_ratio::max().to_int(),
+                                              log_likelihood_ratio::max().to_int());
+
+  std::shared_ptr<polar_factory> reference_factory = create_polar_factory_sw("generic");
+  TESTASSERT(reference_factory);
+  std::unique_ptr<polar_code> code = reference_factory->create_code();
+  TESTASSERT(code);
+
+  for (const char* dec_type : {"avx2", "avx512", "neon", "auto"}) {
+    std::shared_ptr<polar_factory> factory = create_polar_factory_sw(dec_type);
+    TESTASSERT(factory);
+
+    for (const test_case_t& test_case : test_cases) {
+      std::unique_ptr<polar_decoder> reference = reference_factory->create_decoder(test_case.nMax);
+      TESTASSERT(reference);
+
+      // Skip the decoder types that are not supported by the CPU.
+      std::unique_ptr<polar_decoder> decoder = factory->create_decoder(test_case.nMax);
+      if (!decoder) {
+        continue;
+      }
+
+      code->set(test_case.K, test_case.E, test_case.nMax, test_case.ibil);
+      unsigned N = code->get_N();
+
+      std::vector<log_likelihood_ratio> llr(N);
+      std::vector<uint8_t>              expected(N);
+      std::vector<uint8_t>              decoded(N);
+
+      for (unsigned i_rep = 0; i_rep != nof_repetitions; ++i_rep) {
+        // Random LLRs, including a few infinite ones.
+        std::generate(llr.begin(), llr.end(), [&llr_dist]() { return llr_dist(rgen); });
+        llr[rgen() % N] = log_likelihood_ratio::infinity();
+        llr[rgen() % N] = -log_likelihood_ratio::infinity();
+
+        reference->decode(expected, llr, *code);
+        decoder->decode(decoded, llr, *code);
+
+        TESTASSERT(std::equal(expected.begin(), expected.end(), decoded.begin()),
+                   "Decoder type {} mismatch for K={}, E={}, nMax={}.",
+                   dec_type,
+                   test_case.K,
+                   test_case.E,
+                   test_case.nMax);
+      }
+    }
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Tests that the detection of multiplexed PUCCH Format 0 transmissions matches the detection of each
+/// transmission on its own.
+
+#include "ocudu/phy/support/resource_grid.h"
+#include "ocudu/phy/support/resource_grid_reader.h"
+#include "ocudu/phy/support/resource_grid_writer.h"
+#include "ocudu/phy/support/support_factories.h"
+#include "ocudu/phy/upper/channel_processors/pucch/factories.h"
+#include "ocudu/support/math/complex_normal_random.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace ocudu;
+
+static constexpr unsigned nof_repetitions = 50;
+
+namespace {
+
+class PucchDetectorFormat0Fixture : public ::testing::TestWithParam<unsigned>
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    if (detector_factory) {
+      return;
+    }
+
+    std::shared_ptr<low_papr_sequence_generator_factory> lpg_factory = create_low_papr_sequence_generator_sw_factory();
+    ASSERT_NE(lpg_factory, nullptr) << "Cannot create low-PAPR sequence generator factory.";
+
+    std::shared_ptr<low_papr_sequence_collection_factory> lpc_factory =
+        create_low_papr_sequence_collection_sw_factory(lpg_factory);
+    ASSERT_NE(lpc_factory, nullptr) << "Cannot create low-PAPR sequence collection factory.";
+
+    std::shared_ptr<pseudo_random_generator_factory> prg_factory = create_pseudo_random_generator_sw_factory();
+    ASSERT_NE(prg_factory, nullptr) << "Cannot create pseudo random generator factory.";
+
+    std::shared_ptr<channel_equalizer_factory> equalizer_factory = create_channel_equalizer_generic_factory();
+    ASSERT_NE(equalizer_factory, nullptr) << "Cannot create equalizer factory.";
+
+    std::shared_ptr<dft_processor_factory> dft_factory = create_dft_processor_factory_generic();
+    ASSERT_NE(dft_factory, nullptr) << "Cannot create DFT processor factory.";
+
+    detector_factory = create_pucch_detector_factory_sw(lpc_factory, prg_factory, equalizer_factory, dft_factory);
+    ASSERT_NE(detector_factory, nullptr) << "Cannot create PUCCH detector factory.";
+
+    std::shared_ptr<resource_grid_factory> grid_factory = create_resource_grid_factory();
+    ASSERT_NE(grid_factory, nullptr) << "Cannot create resource grid factory.";
+
+    grid = grid_factory->create(MAX_PORTS, MAX_NSYMB_PER_SLOT, MAX_NOF_PRBS * NOF_SUBCARRIERS_PER_RB);
+    ASSERT_NE(grid, nullptr) << "Cannot create resource grid.";
+  }
+
+  void SetUp() override
+  {
+    ASSERT_NE(detector_factory, nullptr) << "Cannot create PUCCH detector factory.";
+
+    detector = detector_factory->create();
+    ASSERT_NE(detector, nullptr) << "Cannot create PUCCH detector.";
+
+    // Fill the resource grid with random RE.
+    complex_normal_distribution<cf_t> c_normal_dist = {};
+    for (unsigned i_port = 0; i_port != MAX_PORTS; ++i_port) {
+      for (unsigned i_symbol = 0; i_symbol != MAX_NSYMB_PER_SLOT; ++i_symbol) {
+        span<cbf16_t> re_view = grid->get_writer().get_view(i_port, i_symbol);
+        std::generate(re_view.begin(), re_view.end(), [this, &c_normal_dist]() { return c_normal_dist(rgen); });
+      }
+    }
+  }
+
+  pucch_detector::format0_configuration get_common_config()
+  {
+    std::uniform_int_distribution<unsigned> bool_dist(0, 1);
+    std::uniform_int_distribution<unsigned> numerology_dist(0, 4);
+    std::uniform_int_distribution<unsigned> slot_dist(0, 160 * 1024 - 1);
+    std::uniform_int_distribution<unsigned> prb_dist(0, MAX_NOF_PRBS - 1);
+    std::uniform_int_distribution<unsigned> nof_symbols_dist(1, 2);
+    std::uniform_int_distribution<unsigned> n_id_dist(0, 1023);
+    std::uniform_int_distribution<unsigned> nof_ports_dist(1, 4);
+
+    pucch_detector::format0_configuration config;
+    config.cp           = (bool_dist(rgen) == 0) ? cyclic_prefix::NORMAL : cyclic_prefix::EXTENDED;
+    unsigned numerology = (config.cp == cyclic_prefix::EXTENDED) ? 2 : numerology_dist(rgen);
+    config.slot =
+        slot_point(numerology, slot_dist(rgen) % slot_point(numerology, 0).nof_slots_per_hyper_system_frame());
+    config.starting_prb = prb_dist(rgen);
+    config.nof_symbols  = nof_symbols_dist(rgen);
+    if ((config.nof_symbols == 2) && (bool_dist(rgen) == 1)) {
+      config.second_hop_prb.emplace(prb_dist(rgen));
+    }
+    std::uniform_int_distribution<unsigned> start_symbol_dist(0, get_nsymb_per_slot(config.cp) - config.nof_symbols);
+    config.start_symbol_index   = start_symbol_dist(rgen);
+    config.initial_cyclic_shift = 0;
+    config.n_id                 = n_id_dist(rgen);
+    config.nof_harq_ack         = 0;
+    config.sr_opportunity       = false;
+    for (unsigned i_port = 0, nof_ports = nof_ports_dist(rgen); i_port != nof_ports; ++i_port) {
+      config.ports.push_back(i_port);
+    }
+    return config;
+  }
+
+  pucch_format0_map<pucch_detector::format0_mux_configuration> get_mux_config()
+  {
+    std::uniform_int_distribution<unsigned> bool_dist(0, 1);
+    std::uniform_int_distribution<unsigned> nof_harq_ack_dist(0, 2);
+
+    pucch_format0_map<pucch_detector::format0_mux_configuration> mux_config;
+    for (unsigned initial_cyclic_shift = pucch_constants::format0_initial_cyclic_shift_range.start(),
+                  initial_cyclic_shift_end = pucch_constants::format0_initial_cyclic_shift_range.stop();
+         initial_cyclic_shift != initial_cyclic_shift_end;
+         ++initial_cyclic_shift) {
+      // Occupy roughly half of the initial cyclic shifts.
+      if (bool_dist(rgen) == 0) {
+        continue;
+      }
+
+      unsigned nof_harq_ack   = nof_harq_ack_dist(rgen);
+      bool     sr_opportunity = (nof_harq_ack == 0) || (bool_dist(rgen) == 1);
+      mux_config.insert(initial_cyclic_shift, {.nof_harq_ack = nof_harq_ack, .sr_opportunity = sr_opportunity});
+    }
+    return mux_config;
+  }
+
+  static std::shared_ptr<pucch_detector_factory> detector_factory;
+  static std::unique_ptr<resource_grid>          grid;
+  std::unique_ptr<pucch_detector>                detector;
+  std::mt19937                                   rgen{GetParam()};
+};
+
+std::shared_ptr<pucch_detector_factory> PucchDetectorFormat0Fixture::detector_factory = nullptr;
+std::unique_ptr<resource_grid>          PucchDetectorFormat0Fixture::grid             = nullptr;
+
+} // namespace
+
+TEST_P(PucchDetectorFormat0Fixture, BatchMatchesIndividual)
+{
+  pucch_detector::format0_configuration                        config     = get_common_config();
+  pucch_format0_map<pucch_detector::format0_mux_configuration> mux_config = get_mux_config();
+
+  // Detect all multiplexed transmissions together and keep a copy of the results.
+  pucch_format0_map<pucch_detector::pucch_detection_result_csi> batch_results =
+      detector->detect(grid->get_reader(), config, mux_config);
+  ASSERT_EQ(batch_results.size(), mux_config.size());
+
+  // Detect each transmission on its own and compare.
+  for (const auto& entry : mux_config) {
+    config.initial_cyclic_shift = entry.first;
+    config.nof_harq_ack         = entry.second.nof_harq_ack;
+    config.sr_opportunity       = entry.second.sr_opportunity;
+
+    std::pair<pucch_uci_message, channel_state_information> result = detector->detect(grid->get_reader(), config);
+
+    ASSERT_TRUE(batch_results.contains(entry.first)) << fmt::format("Missing cyclic shift {}.", entry.first);
+    const pucch_detector::pucch_detection_result_csi& batch_result = batch_results[entry.first];
+
+    const pucch_uci_message& message       = result.first;
+    const pucch_uci_message& batch_message = batch_result.detection_result.uci_message;
+    ASSERT_EQ(batch_message.get_status(), message.get_status());
+    ASSERT_EQ(batch_message.get_expected_nof_bits_full_payload(), message.get_expected_nof_bits_full_payload());
+    ASSERT_TRUE(std::equal(batch_message.get_harq_ack_bits().begin(),
+                           batch_message.get_harq_ack_bits().end(),
+                           message.get_harq_ack_bits().begin(),
+                           message.get_harq_ack_bits().end()));
+    ASSERT_TRUE(std::equal(batch_message.get_sr_bits().begin(),
+                           batch_message.get_sr_bits().end(),
+                           message.get_sr_bits().begin(),
+                           message.get_sr_bits().end()));
+    ASSERT_EQ(batch_result.csi.get_epre_dB(), result.second.get_epre_dB());
+    ASSERT_EQ(batch_result.csi.get_sinr_dB(), result.second.get_sinr_dB());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PucchDetectorFormat0,
+                         PucchDetectorFormat0Fixture,
+                         ::testing::Range(0U, nof_repetitions));
@@ -34,6 +34,14 @@ public:
     return {};
   }
 
+  const pucch_format0_map<pucch_detector::pucch_detection_result_csi>&
+  detect(const resource_grid_reader&                         grid,
+         const format0_configuration&                        config,
+         const pucch_format0_map<format0_mux_configuration>& mux_map) override
+  {
+    return format0_results;
+  }
+
   const pucch_format1_map<pucch_detector::pucch_detection_result_csi>&
   detect(const resource_grid_reader&                  grid,
          const pucch_detector::format1_configuration& config,
@@ -73,8 +81,9 @@ public:
   void clear() { entries_format1.clear(); }
 
 private:
-  std::mt19937               rgen;
-  std::vector<entry_format1> entries_format1;
+  std::mt19937                                                  rgen;
+  std::vector<entry_format1>                                    entries_format1;
+  pucch_format0_map<pucch_detector::pucch_detection_result_csi> format0_results;
 };
 
 PHY_SPY_FACTORY_TEMPLATE(pucch_detector);
@@ -22,6 +22,12 @@ public:
     return {};
   }
 
+  pucch_format0_map<pucch_processor_result> process(const resource_grid_reader&        grid,
+                                                    const format0_batch_configuration& config) override
+  {
+    return {};
+  }
+
   pucch_format1_map<pucch_processor_result> process(const resource_grid_reader&        grid,
                                                     const format1_batch_configuration& config) override
   {
@@ -0,0 +1,183 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Tests that codeblocks decoded jointly by the PUSCH codeblock batcher give the same results as decoding them
+/// individually.
+
+#include "../../../../../../lib/phy/upper/channel_processors/pusch/pusch_codeblock_batcher.h"
+#include "ocudu/phy/upper/channel_coding/channel_coding_factories.h"
+#include "ocudu/phy/upper/channel_coding/ldpc/ldpc_encoder_buffer.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+
+using namespace ocudu;
+
+namespace {
+
+// Number of threads submitting codeblocks concurrently.
+constexpr unsigned nof_threads = 4;
+// Number of codeblocks submitted by each thread.
+constexpr unsigned nof_codeblocks_per_thread = 16;
+// Number of LDPC iterations.
+constexpr unsigned nof_ldpc_iterations = 6;
+
+// Codeblock under test, with the expected decoding results.
+struct test_codeblock {
+  codeblock_metadata                metadata;
+  std::vector<log_likelihood_ratio> llrs;
+  bool                              use_early_stop;
+  dynamic_bit_buffer                expected_data;
+  std::optional<unsigned>           expected_result;
+  dynamic_bit_buffer                data;
+  std::optional<unsigned>           result;
+};
+
+class PuschCodeblockBatcherFixture : public ::testing::TestWithParam<ldpc::lifting_size_t>
+{
+protected:
+  void SetUp() override
+  {
+    crc_factory = create_crc_calculator_factory_sw("auto");
+    ASSERT_NE(crc_factory, nullptr);
+    ldpc_dec_factory = create_ldpc_decoder_factory_sw("auto", {});
+    ASSERT_NE(ldpc_dec_factory, nullptr);
+    dematcher_factory = create_ldpc_rate_dematcher_factory_sw("auto");
+    ASSERT_NE(dematcher_factory, nullptr);
+    std::shared_ptr<ldpc_encoder_factory> encoder_factory = create_ldpc_encoder_factory_sw("auto");
+    ASSERT_NE(encoder_factory, nullptr);
+    encoder = encoder_factory->create();
+    ASSERT_NE(encoder, nullptr);
+  }
+
+  std::unique_ptr<pusch_codeblock_decoder> create_codeblock_decoder()
+  {
+    pusch_codeblock_decoder::sch_crc crcs;
+    crcs.crc16  = crc_factory->create(crc_generator_poly::CRC16);
+    crcs.crc24A = crc_factory->create(crc_generator_poly::CRC24A);
+    crcs.crc24B = crc_factory->create(crc_generator_poly::CRC24B);
+    return std::make_unique<pusch_codeblock_decoder>(
+        dematcher_factory->create(), ldpc_dec_factory->create(), crcs);
+  }
+
+  // Generates a noisy codeblock with a CRC16 checksum.
+  test_codeblock generate_codeblock(ldpc::lifting_size_t lifting_size)
+  {
+    static constexpr unsigned nof_crc_bits = 16;
+
+    test_codeblock cb;
+    cb.metadata.tb_common.base_graph     = ldpc_base_graph_type::BG2;
+    cb.metadata.tb_common.lifting_size   = lifting_size;
+    cb.metadata.cb_specific.nof_crc_bits = nof_crc_bits;
+
+    unsigned msg_length                 = 10 * lifting_size;
+    unsigned cb_length                  = 50 * lifting_size;
+    cb.metadata.cb_specific.full_length = cb_length;
+    cb.metadata.cb_specific.rm_length   = cb_length;
+
+    // Generate a random message and append its CRC.
+    std::unique_ptr<crc_calculator> crc16 = crc_factory->create(crc_generator_poly::CRC16);
+    dynamic_bit_buffer              message(msg_length);
+    for (unsigned i_bit = 0; i_bit != msg_length - nof_crc_bits; ++i_bit) {
+      message.insert(rgen() & 1, i_bit, 1);
+    }
+    unsigned checksum = crc16->calculate(message.first(msg_length - nof_crc_bits));
+    message.insert(checksum, msg_length - nof_crc_bits, nof_crc_bits);
+
+    // Encode.
+    const ldpc_encoder_buffer& rm_buffer =
+        encoder->encode(message, {.base_graph = ldpc_base_graph_type::BG2, .lifting_size = lifting_size});
+    std::vector<uint8_t> encoded(cb_length);
+    rm_buffer.write_codeblock(encoded, 0);
+
+    // Convert to soft bits, negative amplitudes introduce bit errors.
+    cb.llrs.resize(cb_length);
+    std::transform(encoded.begin(), encoded.end(), cb.llrs.begin(), [this](uint8_t bit) {
+      return log_likelihood_ratio((1 - 2 * bit) * amplitude_dist(rgen));
+    });
+
+    cb.use_early_stop = (rgen() & 1) != 0;
+    cb.expected_data.resize(msg_length);
+    cb.data.resize(msg_length);
+    return cb;
+  }
+
+  static pusch_codeblock_decoder::batch_request make_request(test_codeblock& cb, bool expected)
+  {
+    return {.cb_data             = expected ? cb.expected_data : cb.data,
+            .rm_buffer           = cb.llrs,
+            .crc_poly            = crc_generator_poly::CRC16,
+            .use_early_stop      = cb.use_early_stop,
+            .nof_ldpc_iterations = nof_ldpc_iterations,
+            .metadata            = &cb.metadata,
+            .result              = std::nullopt};
+  }
+
+  std::mt19937                                 rgen{1234};
+  std::uniform_int_distribution<int>           amplitude_dist{-3, 10};
+  std::shared_ptr<crc_calculator_factory>      crc_factory;
+  std::shared_ptr<ldpc_decoder_factory>        ldpc_dec_factory;
+  std::shared_ptr<ldpc_rate_dematcher_factory> dematcher_factory;
+  std::unique_ptr<ldpc_encoder>                encoder;
+};
+
+} // namespace
+
+TEST_P(PuschCodeblockBatcherFixture, ConcurrentDecoding)
+{
+  std::vector<std::vector<test_codeblock>> codeblocks(nof_threads);
+  for (std::vector<test_codeblock>& thread_codeblocks : codeblocks) {
+    for (unsigned i_cb = 0; i_cb != nof_codeblocks_per_thread; ++i_cb) {
+      thread_codeblocks.emplace_back(generate_codeblock(GetParam()));
+    }
+  }
+
+  // Decode each codeblock individually.
+  std::unique_ptr<pusch_codeblock_decoder> reference_decoder = create_codeblock_decoder();
+  for (std::vector<test_codeblock>& thread_codeblocks : codeblocks) {
+    for (test_codeblock& cb : thread_codeblocks) {
+      pusch_codeblock_decoder::batch_request                 request  = make_request(cb, true);
+      std::array<pusch_codeblock_decoder::batch_request*, 1> requests = {&request};
+      reference_decoder->decode_batch(requests);
+      cb.expected_result = request.result;
+    }
+  }
+
+  // Decode the codeblocks from several threads with a single batch worker, so that codeblocks are batched.
+  pusch_codeblock_batcher  batcher(ldpc_decoder::max_batch_size, 1);
+  std::vector<std::thread> threads;
+  for (std::vector<test_codeblock>& thread_codeblocks : codeblocks) {
+    threads.emplace_back([&batcher, &thread_codeblocks, decoder = create_codeblock_decoder()]() {
+      for (test_codeblock& cb : thread_codeblocks) {
+        pusch_codeblock_decoder::batch_request request = make_request(cb, false);
+        batcher.decode(*decoder, request);
+        cb.result = request.result;
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (unsigned i_thread = 0; i_thread != nof_threads; ++i_thread) {
+    for (unsigned i_cb = 0; i_cb != nof_codeblocks_per_thread; ++i_cb) {
+      const test_codeblock& cb = codeblocks[i_thread][i_cb];
+      ASSERT_EQ(cb.result, cb.expected_result) << fmt::format("Thread {}, codeblock {}.", i_thread, i_cb);
+      if (cb.expected_result.has_value()) {
+        ASSERT_EQ(cb.data, cb.expected_data) << fmt::format("Thread {}, codeblock {}.", i_thread, i_cb);
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PuschCodeblockBatcher,
+                         PuschCodeblockBatcherFixture,
+                         ::testing::Values(ldpc::LS2, ldpc::LS20, ldpc::LS52, ldpc::LS384));
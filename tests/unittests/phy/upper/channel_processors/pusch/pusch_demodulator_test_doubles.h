@@ -38,6 +38,16 @@ public:
                   const resource_grid_reader&         grid,
                   const dmrs_pusch_estimator_results& est_results,
                   const configuration&                config) override
+  {
+    start(codeword_buffer, notifier, grid, est_results, config);
+    demodulate_symbols(config.start_symbol_index + config.nof_symbols - 1, true);
+  }
+
+  void start(pusch_codeword_buffer&              codeword_buffer,
+             pusch_demodulator_notifier&         notifier,
+             const resource_grid_reader&         grid,
+             const dmrs_pusch_estimator_results& est_results,
+             const configuration&                config) override
   {
     entries.emplace_back();
     entry_t& entry = entries.back();
@@ -47,11 +57,27 @@ public:
     entry.est_results = &est_results;
     entry.config      = config;
 
+    current_codeword_buffer = &codeword_buffer;
+    current_notifier        = &notifier;
+  }
+
+  void demodulate_symbols(unsigned end_symbol_index, bool is_valid) override
+  {
+    ocudu_assert(current_codeword_buffer != nullptr, "The demodulation has not been started.");
+    entry_t& entry = entries.back();
+
+    // Wait for the last OFDM symbol of the transmission.
+    if (end_symbol_index + 1 < entry.config.start_symbol_index + entry.config.nof_symbols) {
+      return;
+    }
+
     std::generate(
         entry.codeword.begin(), entry.codeword.end(), [this]() { return log_likelihood_ratio(llr_dist(rgen)); });
     std::generate(entry.scrambling_seq.get_buffer().begin(), entry.scrambling_seq.get_buffer().end(), [this]() {
       return rgen();
     });
+    pusch_codeword_buffer&      codeword_buffer = *std::exchange(current_codeword_buffer, nullptr);
+    pusch_demodulator_notifier& notifier        = *std::exchange(current_notifier, nullptr);
     codeword_buffer.on_new_block(entry.codeword, entry.scrambling_seq);
     codeword_buffer.on_end_codeword();
 
@@ -68,6 +94,8 @@ public:
 private:
   unsigned                                                        codeword_size = 0;
   std::vector<entry_t>                                            entries;
+  pusch_codeword_buffer*                                          current_codeword_buffer = nullptr;
+  pusch_demodulator_notifier*                                     current_notifier        = nullptr;
   std::mt19937                                                    rgen;
   std::uniform_int_distribution<log_likelihood_ratio::value_type> llr_dist;
 };
@@ -11,11 +11,12 @@
 #pragma once
 
 #include "ocudu/phy/upper/channel_processors/pusch/pusch_processor.h"
+#include "ocudu/phy/upper/channel_processors/pusch/pusch_rx_symbol_monitor.h"
 #include "ocudu/phy/upper/unique_rx_buffer.h"
 
 namespace ocudu {
 
-class pusch_processor_spy : public pusch_processor
+class pusch_processor_spy : public pusch_processor, private pusch_rx_symbol_listener
 {
 public:
   void process(span<uint8_t>                    data,
@@ -35,10 +36,51 @@ public:
     notifier.on_sch({});
   }
 
+  void process(span<uint8_t>                    data,
+               unique_rx_buffer                 buffer,
+               pusch_processor_result_notifier& notifier,
+               const resource_grid_reader&      grid,
+               pusch_rx_symbol_monitor&         symbol_monitor_,
+               const pdu_t&                     pdu) override
+  {
+    processed_method_been_called = true;
+    symbol_monitor               = &symbol_monitor_;
+    pending_notifier             = &notifier;
+    pending_has_uci              = (pdu.uci.nof_harq_ack != 0) || (pdu.uci.nof_csi_part1 != 0);
+    pending_nof_symbols          = pdu.start_symbol_index + pdu.nof_symbols;
+
+    // Wait for the reception of all the OFDM symbols of the transmission before notifying the completion.
+    on_new_rx_symbols();
+  }
+
   bool has_process_method_been_called() const { return processed_method_been_called; }
 
+  pusch_rx_symbol_monitor* get_symbol_monitor() const { return symbol_monitor; }
+
 private:
-  bool processed_method_been_called = false;
+  // See interface for documentation.
+  void on_new_rx_symbols() override
+  {
+    while (!symbol_monitor->is_discarded() && (symbol_monitor->get_nof_rx_symbols() < pending_nof_symbols)) {
+      if (symbol_monitor->request_notification(symbol_monitor->get_nof_rx_symbols(), *this)) {
+        return;
+      }
+    }
+
+    // Notify completion of PUSCH UCI.
+    if (pending_has_uci) {
+      pending_notifier->on_uci({});
+    }
+
+    // Notify completion of PUSCH data.
+    pending_notifier->on_sch({});
+  }
+
+  bool                             processed_method_been_called = false;
+  pusch_rx_symbol_monitor*         symbol_monitor               = nullptr;
+  pusch_processor_result_notifier* pending_notifier             = nullptr;
+  bool                             pending_has_uci              = false;
+  unsigned                         pending_nof_symbols          = 0;
 };
 
 } // namespace ocudu
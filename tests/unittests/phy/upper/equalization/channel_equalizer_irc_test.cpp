@@ -0,0 +1,173 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+/// \file
+/// \brief Tests the MMSE-IRC channel equalizer against the MMSE one, with and without spatially correlated
+/// interference.
+
+#include "ocudu/phy/support/re_buffer.h"
+#include "ocudu/phy/upper/equalization/dynamic_ch_est_list.h"
+#include "ocudu/phy/upper/equalization/equalization_factories.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace ocudu;
+
+namespace {
+
+// Number of resource elements.
+constexpr unsigned nof_re = 1000;
+// Maximum number of receive ports.
+constexpr unsigned max_nof_rx_ports = 8;
+// Maximum number of transmit layers.
+constexpr unsigned max_nof_layers = 4;
+// Noise variance of each receive port.
+constexpr float noise_var = 0.01F;
+// Interferer power, relative to the power of each layer.
+constexpr float interference_power = 10.0F;
+
+using ChannelEqualizerIrcParams = std::tuple<unsigned, unsigned>;
+
+class ChannelEqualizerIrcFixture : public ::testing::TestWithParam<ChannelEqualizerIrcParams>
+{
+protected:
+  void SetUp() override
+  {
+    std::shared_ptr<channel_equalizer_factory> mmse_factory =
+        create_channel_equalizer_generic_factory(channel_equalizer_algorithm_type::mmse);
+    ASSERT_NE(mmse_factory, nullptr);
+    mmse_equalizer = mmse_factory->create();
+    ASSERT_NE(mmse_equalizer, nullptr);
+    ASSERT_FALSE(mmse_equalizer->is_interference_aware());
+
+    std::shared_ptr<channel_equalizer_factory> irc_factory =
+        create_channel_equalizer_generic_factory(channel_equalizer_algorithm_type::mmse_irc);
+    ASSERT_NE(irc_factory, nullptr);
+    irc_equalizer = irc_factory->create();
+    ASSERT_NE(irc_equalizer, nullptr);
+    ASSERT_TRUE(irc_equalizer->is_interference_aware());
+  }
+
+  // Generates a transmission through a random channel, with an optional interferer. Returns the exact
+  // interference-plus-noise covariance matrix.
+  std::vector<cf_t> generate(bool with_interference)
+  {
+    auto [nof_rx_ports, nof_layers] = GetParam();
+
+    tx_symbols.resize(nof_re * nof_layers);
+    rx_symbols.resize(nof_rx_ports, nof_re);
+    ch_estimates.resize(nof_re, nof_rx_ports, nof_layers);
+
+    std::generate(tx_symbols.begin(), tx_symbols.end(), [this]() { return qpsk(); });
+
+    // Flat channel for the desired layers and for the interferer.
+    std::vector<cf_t> channel(nof_rx_ports * nof_layers);
+    std::generate(channel.begin(), channel.end(), [this]() { return cf_t(normal(rgen), normal(rgen)) * M_SQRT1_2f32; });
+    std::vector<cf_t> interferer_channel(nof_rx_ports);
+    float             interferer_amplitude = with_interference ? std::sqrt(interference_power) : 0.0F;
+    std::generate(interferer_channel.begin(), interferer_channel.end(), [this, interferer_amplitude]() {
+      return cf_t(normal(rgen), normal(rgen)) * M_SQRT1_2f32 * interferer_amplitude;
+    });
+
+    for (unsigned i_re = 0; i_re != nof_re; ++i_re) {
+      cf_t interferer_symbol = qpsk();
+      for (unsigned i_port = 0; i_port != nof_rx_ports; ++i_port) {
+        cf_t rx = interferer_channel[i_port] * interferer_symbol +
+                  cf_t(normal(rgen), normal(rgen)) * std::sqrt(noise_var / 2.0F);
+        for (unsigned i_layer = 0; i_layer != nof_layers; ++i_layer) {
+          rx += channel[i_port * nof_layers + i_layer] * tx_symbols[i_re * nof_layers + i_layer];
+          ch_estimates.get_channel(i_port, i_layer)[i_re] = channel[i_port * nof_layers + i_layer];
+        }
+        rx_symbols.get_slice(i_port)[i_re] = rx;
+      }
+    }
+
+    std::vector<cf_t> covariance(nof_rx_ports * nof_rx_ports);
+    for (unsigned i_port = 0; i_port != nof_rx_ports; ++i_port) {
+      for (unsigned j_port = 0; j_port != nof_rx_ports; ++j_port) {
+        covariance[i_port * nof_rx_ports + j_port] =
+            interferer_channel[i_port] * std::conj(interferer_channel[j_port]) + ((i_port == j_port) ? noise_var : 0);
+      }
+    }
+    return covariance;
+  }
+
+  // Computes the mean squared error of the equalized symbols.
+  float compute_mse(span<const cf_t> eq_symbols) const
+  {
+    float error = 0;
+    for (unsigned i = 0, i_end = eq_symbols.size(); i != i_end; ++i) {
+      error += std::norm(eq_symbols[i] - tx_symbols[i]);
+    }
+    return error / static_cast<float>(eq_symbols.size());
+  }
+
+  cf_t qpsk() { return cf_t((rgen() & 1) ? M_SQRT1_2f32 : -M_SQRT1_2f32, (rgen() & 1) ? M_SQRT1_2f32 : -M_SQRT1_2f32); }
+
+  std::mt19937                       rgen{4321};
+  std::normal_distribution<float>    normal{0.0F, 1.0F};
+  std::unique_ptr<channel_equalizer> mmse_equalizer;
+  std::unique_ptr<channel_equalizer> irc_equalizer;
+  std::vector<cf_t>                  tx_symbols;
+  dynamic_re_buffer<cbf16_t>         rx_symbols{max_nof_rx_ports, nof_re};
+  dynamic_ch_est_list                ch_estimates{nof_re, max_nof_rx_ports, max_nof_layers};
+};
+
+} // namespace
+
+TEST_P(ChannelEqualizerIrcFixture, WhiteNoise)
+{
+  auto [nof_rx_ports, nof_layers] = GetParam();
+  std::vector<cf_t> covariance    = generate(false);
+
+  std::vector<cf_t>  mmse_symbols(nof_re * nof_layers);
+  std::vector<float> mmse_noise_vars(nof_re * nof_layers);
+  std::vector<float> noise_vars(nof_rx_ports, noise_var);
+  mmse_equalizer->equalize(mmse_symbols, mmse_noise_vars, rx_symbols, ch_estimates, noise_vars, 1.0F);
+
+  std::vector<cf_t>  irc_symbols(nof_re * nof_layers);
+  std::vector<float> irc_noise_vars(nof_re * nof_layers);
+  irc_equalizer->equalize(irc_symbols, irc_noise_vars, rx_symbols, ch_estimates, covariance, 1.0F);
+
+  // Without interference, both equalizers are equivalent.
+  for (unsigned i = 0, i_end = nof_re * nof_layers; i != i_end; ++i) {
+    ASSERT_NEAR(std::abs(irc_symbols[i] - mmse_symbols[i]), 0.0F, 1e-3F * (1.0F + std::abs(mmse_symbols[i])))
+        << fmt::format("RE {}.", i);
+    ASSERT_NEAR(irc_noise_vars[i], mmse_noise_vars[i], 1e-3F * (1.0F + mmse_noise_vars[i])) << fmt::format("RE {}.", i);
+  }
+}
+
+TEST_P(ChannelEqualizerIrcFixture, InterferenceRejection)
+{
+  auto [nof_rx_ports, nof_layers] = GetParam();
+  std::vector<cf_t> covariance    = generate(true);
+
+  // The MMSE equalizer only knows the interference-plus-noise variance of each port.
+  std::vector<cf_t>  mmse_symbols(nof_re * nof_layers);
+  std::vector<float> mmse_noise_vars(nof_re * nof_layers);
+  mmse_equalizer->equalize(mmse_symbols, mmse_noise_vars, rx_symbols, ch_estimates, covariance, 1.0F);
+
+  std::vector<cf_t>  irc_symbols(nof_re * nof_layers);
+  std::vector<float> irc_noise_vars(nof_re * nof_layers);
+  irc_equalizer->equalize(irc_symbols, irc_noise_vars, rx_symbols, ch_estimates, covariance, 1.0F);
+
+  float mmse_mse = compute_mse(mmse_symbols);
+  float irc_mse  = compute_mse(irc_symbols);
+  ASSERT_LT(irc_mse, mmse_mse / 2.0F) << fmt::format("MSE: MMSE={}, MMSE-IRC={}.", mmse_mse, irc_mse);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChannelEqualizerIrc,
+                         ChannelEqualizerIrcFixture,
+                         ::testing::Values(std::make_tuple(2U, 1U),
+                                           std::make_tuple(4U, 1U),
+                                           std::make_tuple(4U, 2U),
+                                           std::make_tuple(4U, 3U),
+                                           std::make_tuple(8U, 2U),
+                                           std::make_tuple(8U, 4U)));
@@ -22,6 +22,8 @@ std::ostream& operator<<(std::ostream& os, channel_equalizer_algorithm_type type
       return os << "ZF";
     case channel_equalizer_algorithm_type::mmse:
       return os << "MMSE";
+    case channel_equalizer_algorithm_type::mmse_irc:
+      return os << "MMSE_IRC";
   }
   return os;
 }
@@ -83,4 +85,5 @@ INSTANTIATE_TEST_SUITE_P(ChannelEqualizerTest,
                          ::testing::Combine(::testing::Range(0U, 8U),
                                             ::testing::Range(0U, 8U),
                                             ::testing::Values(channel_equalizer_algorithm_type::zf,
-                                                              channel_equalizer_algorithm_type::mmse)));
+                                                              channel_equalizer_algorithm_type::mmse,
+                                                              channel_equalizer_algorithm_type::mmse_irc)));
@@ -25,6 +25,7 @@ public:
                         unsigned                                                  symbol,
                         span<const uplink_pdu_slot_repository::pusch_pdu>         pusch_pdus,
                         span<const uplink_pdu_slot_repository::pucch_pdu>         pucch_pdus,
+                        span<const pucch_processor::format0_common_configuration> pucch_f0_pdus,
                         span<const pucch_processor::format1_common_configuration> pucch_f1_pdus,
                         span<const uplink_pdu_slot_repository::srs_pdu>           srs_pdus) override
   {
@@ -21,6 +21,8 @@ class dmrs_pusch_estimator_results_dummy : public dmrs_pusch_estimator_results
 public:
   float get_noise_variance(unsigned rx_port) const override { return {}; }
 
+  void get_noise_covariance(span<cf_t> covariance) const override {}
+
   float get_rsrp(unsigned rx_port, unsigned tx_layer = 0) const override { return {}; }
 
   static_vector<float, MAX_PORTS> get_rsrp_all_ports(unsigned tx_layer = 0) const override { return {}; }
@@ -76,7 +76,8 @@ public:
                                                            buffer_pool_spy,
                                                            results_notifier,
                                                            max_nof_prb,
-                                                           max_nof_layers);
+                                                           max_nof_layers,
+                                                           enable_pusch_pipelining);
 
     buffer_pool_spy.clear();
   }
@@ -87,6 +88,8 @@ protected:
   static constexpr unsigned   max_nof_symbols = 14;
   static constexpr slot_point slot            = {0, 9};
 
+  bool enable_pusch_pipelining = false;
+
   const uplink_pdu_slot_repository::pusch_pdu pusch_pdu = {
       .harq_id = 0,
       .tb_size = units::bytes(8),
@@ -150,6 +153,12 @@ protected:
   phy_tap_spy*             tap_spy;
 };
 
+class UplinkProcessorPuschPipeliningFixture : public UplinkProcessorFixture
+{
+public:
+  UplinkProcessorPuschPipeliningFixture() { enable_pusch_pipelining = true; }
+};
+
 TEST_F(UplinkProcessorFixture, prach_normal_workflow)
 {
   ul_processor->get_pdu_slot_repository(slot);
@@ -749,4 +758,108 @@ TEST_F(UplinkProcessorFixture, pusch_discard_slot_after_stop)
   ASSERT_EQ(tap_spy->get_handle_quiet_grid_count(), 0);
 }
 
+TEST_F(UplinkProcessorPuschPipeliningFixture, pusch_normal_workflow)
+{
+  // Get PDU repository, add PDU and release repository. Keep the grid alive until the end of the test.
+  unique_uplink_pdu_slot_repository repository = ul_processor->get_pdu_slot_repository(slot);
+  repository->add_pusch_pdu(pusch_pdu);
+  shared_resource_grid grid = repository.release();
+
+  unsigned last_dmrs_symbol_index = pusch_pdu.pdu.dmrs_symbol_mask.find_highest();
+  unsigned end_symbol_index       = pusch_pdu.pdu.start_symbol_index + pusch_pdu.pdu.nof_symbols - 1;
+
+  // Notify reception of the symbol before the last DM-RS symbol and check that nothing happened.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(last_dmrs_symbol_index - 1, true);
+  ASSERT_FALSE(pusch_executor.has_pending_tasks());
+
+  // Notify reception of the last DM-RS symbol. The PUSCH processing is enqueued before the end of the allocation.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(last_dmrs_symbol_index, true);
+  ASSERT_TRUE(pusch_executor.has_pending_tasks());
+  pusch_executor.run_pending_tasks();
+
+  // Check the processor has been given a symbol monitor with the reception progress, and that it waits for the rest
+  // of the symbols.
+  ASSERT_TRUE(pusch_spy->has_process_method_been_called());
+  pusch_rx_symbol_monitor* symbol_monitor = pusch_spy->get_symbol_monitor();
+  ASSERT_NE(symbol_monitor, nullptr);
+  ASSERT_EQ(symbol_monitor->get_nof_rx_symbols(), last_dmrs_symbol_index + 1);
+  ASSERT_FALSE(symbol_monitor->is_discarded());
+  ASSERT_FALSE(pusch_executor.has_pending_tasks());
+  ASSERT_FALSE(results_notifier.has_pusch_data_result_been_notified());
+  ASSERT_FALSE(results_notifier.has_pusch_uci_result_been_notified());
+
+  // Notify reception of the last symbol. The processor is resumed from the PUSCH executor.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(end_symbol_index, true);
+  ASSERT_EQ(symbol_monitor->get_nof_rx_symbols(), end_symbol_index + 1);
+  ASSERT_FALSE(results_notifier.has_pusch_data_result_been_notified());
+  ASSERT_TRUE(pusch_executor.has_pending_tasks());
+  pusch_executor.run_pending_tasks();
+
+  // Check the result has been notified.
+  ASSERT_TRUE(results_notifier.has_pusch_data_result_been_notified());
+  ASSERT_TRUE(results_notifier.has_pusch_uci_result_been_notified());
+}
+
+TEST_F(UplinkProcessorPuschPipeliningFixture, pusch_invalid_symbol)
+{
+  // Get PDU repository, add PDU and release repository. Keep the grid alive until the end of the test.
+  unique_uplink_pdu_slot_repository repository = ul_processor->get_pdu_slot_repository(slot);
+  repository->add_pusch_pdu(pusch_pdu);
+  shared_resource_grid grid = repository.release();
+
+  unsigned last_dmrs_symbol_index = pusch_pdu.pdu.dmrs_symbol_mask.find_highest();
+
+  // Notify reception of the last DM-RS symbol and start processing the PUSCH transmission.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(last_dmrs_symbol_index, true);
+  pusch_executor.run_pending_tasks();
+  pusch_rx_symbol_monitor* symbol_monitor = pusch_spy->get_symbol_monitor();
+  ASSERT_NE(symbol_monitor, nullptr);
+  ASSERT_FALSE(results_notifier.has_pusch_data_result_been_notified());
+
+  // Notify an invalid symbol. The rest of the slot is discarded and the processor is resumed.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(last_dmrs_symbol_index + 1, false);
+  ASSERT_TRUE(symbol_monitor->is_discarded());
+  ASSERT_EQ(symbol_monitor->get_nof_rx_symbols(), last_dmrs_symbol_index + 1);
+  ASSERT_TRUE(pusch_executor.has_pending_tasks());
+  pusch_executor.run_pending_tasks();
+
+  // Check the result has been notified.
+  ASSERT_TRUE(results_notifier.has_pusch_data_result_been_notified());
+  ASSERT_TRUE(results_notifier.has_pusch_uci_result_been_notified());
+}
+
+TEST_F(UplinkProcessorPuschPipeliningFixture, pusch_stop_while_waiting_symbols)
+{
+  // Get PDU repository, add PDU and release repository.
+  {
+    unique_uplink_pdu_slot_repository repository = ul_processor->get_pdu_slot_repository(slot);
+    repository->add_pusch_pdu(pusch_pdu);
+  }
+
+  // Notify reception of the last DM-RS symbol and start processing the PUSCH transmission.
+  ul_processor->get_slot_processor(slot).handle_rx_symbol(pusch_pdu.pdu.dmrs_symbol_mask.find_highest(), true);
+  pusch_executor.run_pending_tasks();
+  ASSERT_FALSE(results_notifier.has_pusch_data_result_been_notified());
+
+  // Create asynchronous task - it will block until the PUSCH transmission is completed.
+  std::atomic<bool> stop_thread_started = false;
+  std::thread       stop_thread([this, &stop_thread_started]() {
+    stop_thread_started = true;
+    ul_processor->stop();
+  });
+
+  // Wait for the stop to resume the processor.
+  while (!stop_thread_started || !pusch_executor.has_pending_tasks()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  pusch_executor.run_pending_tasks();
+
+  // Synchronize stopping thread.
+  stop_thread.join();
+
+  // Check the result has been notified.
+  ASSERT_TRUE(results_notifier.has_pusch_data_result_been_notified());
+  ASSERT_TRUE(results_notifier.has_pusch_uci_result_been_notified());
+}
+
 } // namespace
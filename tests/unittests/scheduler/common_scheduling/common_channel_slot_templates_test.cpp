@@ -0,0 +1,158 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "lib/scheduler/common_scheduling/common_channel_slot_templates.h"
+#include "tests/test_doubles/scheduler/scheduler_config_helper.h"
+#include "ocudu/scheduler/config/scheduler_expert_config_factory.h"
+#include "ocudu/support/test_utils.h"
+#include <gtest/gtest.h>
+
+using namespace ocudu;
+
+namespace {
+
+struct slot_templates_test_params {
+  subcarrier_spacing   scs;
+  nr_band              band;
+  arfcn_t              arfcn;
+  bs_channel_bandwidth bw;
+};
+
+class common_channel_slot_templates_test : public ::testing::TestWithParam<slot_templates_test_params>
+{
+protected:
+  common_channel_slot_templates_test() :
+    cell_cfg(expert_cfg, sched_config_helper::make_default_sched_cell_configuration_request([]() {
+               cell_config_builder_params params{};
+               params.scs_common             = GetParam().scs;
+               params.dl_carrier.band        = GetParam().band;
+               params.dl_carrier.arfcn_f_ref = GetParam().arfcn;
+               params.dl_carrier.carrier_bw  = GetParam().bw;
+               return params;
+             }())),
+    ssb_sch(cell_cfg),
+    csi_sch(cell_cfg),
+    templates(cell_cfg),
+    res_grid(cell_cfg)
+  {
+    templates.build(ssb_sch, csi_sch);
+  }
+
+  /// Checks that the template of the given slot matches the allocations made by the SSB and CSI-RS schedulers.
+  void check_slot(slot_point sl)
+  {
+    cell_slot_resource_allocator expected{cell_cfg};
+    expected.slot_indication(sl);
+    ssb_sch.schedule_ssb(expected);
+    csi_sch.run_slot(expected);
+
+    cell_slot_resource_allocator actual{cell_cfg};
+    actual.slot_indication(sl);
+    const common_channel_slot_template& tmpl = templates.get_slot_template(sl);
+    for (const ssb_information& ssb : tmpl.ssbs) {
+      actual.result.dl.bc.ssb_info.push_back(ssb);
+    }
+    for (const grant_info& grant : tmpl.ssb_grants) {
+      actual.dl_res_grid.fill(grant);
+    }
+
+    const auto& expected_ssbs = expected.result.dl.bc.ssb_info;
+    ASSERT_EQ(tmpl.ssbs.size(), expected_ssbs.size()) << fmt::format("slot={}", sl);
+    for (unsigned i = 0; i != expected_ssbs.size(); ++i) {
+      ASSERT_EQ(tmpl.ssbs[i].ssb_index, expected_ssbs[i].ssb_index);
+      ASSERT_EQ(tmpl.ssbs[i].crbs, expected_ssbs[i].crbs);
+      ASSERT_EQ(tmpl.ssbs[i].symbols, expected_ssbs[i].symbols);
+    }
+
+    const auto& expected_csi_rs = expected.result.dl.csi_rs;
+    ASSERT_EQ(tmpl.csi_rs.size(), expected_csi_rs.size()) << fmt::format("slot={}", sl);
+    for (unsigned i = 0; i != expected_csi_rs.size(); ++i) {
+      ASSERT_EQ(tmpl.csi_rs[i].type, expected_csi_rs[i].type);
+      ASSERT_EQ(tmpl.csi_rs[i].crbs, expected_csi_rs[i].crbs);
+      ASSERT_EQ(tmpl.csi_rs[i].symbol0, expected_csi_rs[i].symbol0);
+      ASSERT_EQ(tmpl.csi_rs[i].scrambling_id, expected_csi_rs[i].scrambling_id);
+    }
+
+    const bwp_configuration& bwp_cfg = cell_cfg.dl_cfg_common.init_dl_bwp.generic_params;
+    for (unsigned symb = 0; symb != NOF_OFDM_SYM_PER_SLOT_NORMAL_CP; ++symb) {
+      const ofdm_symbol_range symbols{symb, symb + 1};
+      ASSERT_EQ(actual.dl_res_grid.used_crbs(bwp_cfg, symbols), expected.dl_res_grid.used_crbs(bwp_cfg, symbols))
+          << fmt::format("slot={} symbol={}", sl, symb);
+    }
+  }
+
+  scheduler_expert_config       expert_cfg{config_helpers::make_default_scheduler_expert_config()};
+  cell_configuration            cell_cfg;
+  ssb_scheduler                 ssb_sch;
+  csi_rs_scheduler              csi_sch;
+  common_channel_slot_templates templates;
+  cell_resource_allocator       res_grid;
+  const subcarrier_spacing      scs = cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs;
+};
+
+} // namespace
+
+TEST_P(common_channel_slot_templates_test, hyperperiod_divides_slot_index_wrap_around)
+{
+  const slot_point sl{scs, 0};
+  ASSERT_GT(templates.hyperperiod(), 0);
+  ASSERT_EQ(sl.nof_slots_per_hyper_system_frame() % templates.hyperperiod(), 0);
+  ASSERT_LT(templates.hyperperiod(), sl.nof_slots_per_hyper_system_frame());
+}
+
+TEST_P(common_channel_slot_templates_test, templates_match_ssb_and_csi_rs_schedulers)
+{
+  const unsigned nof_slots = 2 * templates.hyperperiod();
+  const unsigned max_count = slot_point{scs, 0}.nof_slots_per_hyper_system_frame();
+
+  // Start at a random slot, and also cover the slot index wrap-around.
+  slot_point sl{scs, test_rgen::uniform_int<unsigned>(0, max_count - 1)};
+  for (unsigned i = 0; i != nof_slots; ++i, ++sl) {
+    check_slot(sl);
+  }
+  sl = slot_point{scs, max_count - nof_slots / 2};
+  for (unsigned i = 0; i != nof_slots; ++i, ++sl) {
+    check_slot(sl);
+  }
+}
+
+TEST_P(common_channel_slot_templates_test, run_slot_allocates_ssbs_in_advance_and_csi_rs_in_current_slot)
+{
+  slot_point sl_tx{scs, 0};
+  unsigned   nof_ssbs = 0, nof_csi_rs = 0;
+  for (unsigned i = 0; i != 2 * templates.hyperperiod(); ++i, ++sl_tx) {
+    res_grid.slot_indication(sl_tx);
+    templates.run_slot(res_grid);
+
+    // On the first run, all the slots that can be scheduled in advance get their SSBs allocated.
+    const unsigned first_ssb_slot = i == 0 ? 0 : res_grid.max_dl_slot_alloc_delay;
+    for (unsigned k = first_ssb_slot; k != res_grid.max_dl_slot_alloc_delay + 1; ++k) {
+      const cell_slot_resource_allocator& slot_alloc = res_grid[k];
+      ASSERT_EQ(slot_alloc.result.dl.bc.ssb_info.size(), templates.get_slot_template(slot_alloc.slot).ssbs.size());
+    }
+    ASSERT_EQ(res_grid[0].result.dl.csi_rs.size(), templates.get_slot_template(sl_tx).csi_rs.size());
+    nof_ssbs += res_grid[0].result.dl.bc.ssb_info.size();
+    nof_csi_rs += res_grid[0].result.dl.csi_rs.size();
+  }
+  ASSERT_GT(nof_ssbs, 0);
+  ASSERT_GT(nof_csi_rs, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    common_channel_slot_templates,
+    common_channel_slot_templates_test,
+    ::testing::Values(slot_templates_test_params{.scs   = subcarrier_spacing::kHz15,
+                                                 .band  = nr_band::n3,
+                                                 .arfcn = arfcn_t{365000},
+                                                 .bw    = bs_channel_bandwidth::MHz10},
+                      slot_templates_test_params{.scs   = subcarrier_spacing::kHz30,
+                                                 .band  = nr_band::n41,
+                                                 .arfcn = arfcn_t{520002},
+                                                 .bw    = bs_channel_bandwidth::MHz100}));
@@ -171,7 +171,7 @@ protected:
     return CUTOFF_FREQ_ARFCN_CASE_A_B_C;
   }
 
-  void run_slot() { ssb_sched.run_slot(res_grid, current_sl_tx); }
+  void run_slot() { ssb_sched.schedule_ssb(res_grid[0]); }
 
   void slot_indication() { sched_basic_custom_test_bench::slot_indication(++current_sl_tx); }
 
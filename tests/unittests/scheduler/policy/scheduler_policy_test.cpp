@@ -546,6 +546,26 @@ TEST_F(scheduler_round_robin_test, round_robin_must_not_attempt_to_allocate_twic
   }
 }
 
+TEST_F(scheduler_round_robin_test, round_robin_allocates_all_ues_when_candidates_exceed_grants_per_slot)
+{
+  const lcg_id_t lcg_id  = uint_to_lcg_id(2);
+  const unsigned nof_ues = sched_cfg.ue.pre_policy_rr_ue_group_size;
+  for (unsigned i = 0; i != nof_ues; ++i) {
+    const ue& u = add_ue(make_ue_create_req(to_du_ue_index(i), to_rnti(0x4601 + i), {uint_to_lcid(5)}, lcg_id));
+    push_dl_bs(u.ue_index, uint_to_lcid(5), 1000000);
+  }
+
+  // Only a subset of the UE candidates is sorted by priority in each slot. All the UEs must still be served.
+  bounded_bitset<MAX_NOF_DU_UES> served_ues(nof_ues);
+  const bool                     all_served = run_until([&]() {
+    for (const auto& grant : res_grid[0].result.dl.ue_grants) {
+      served_ues.set(grant.context.ue_index);
+    }
+    return served_ues.all();
+  });
+  ASSERT_TRUE(all_served) << fmt::format("Served UEs: {}", served_ues);
+}
+
 class scheduler_pf_test : public base_scheduler_policy_test, public ::testing::Test
 {
 protected:
@@ -0,0 +1,271 @@
+/*
+ *
+ * Copyright 2021-2026 Software Radio Systems Limited
+ *
+ * By using this file, you agree to the terms and conditions set
+ * forth in the LICENSE file which can be found at the top level of
+ * the distribution.
+ *
+ */
+
+#include "lib/scheduler/logging/scheduler_input_trace.h"
+#include "tests/test_doubles/scheduler/scheduler_config_helper.h"
+#include "tests/unittests/scheduler/test_utils/dummy_test_components.h"
+#include "ocudu/scheduler/config/scheduler_expert_config_factory.h"
+#include "ocudu/scheduler/scheduler_factory.h"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace ocudu;
+
+namespace {
+
+/// Trace handler that stores the decoded records.
+class trace_handler_spy : public scheduler_input_trace_handler
+{
+public:
+  std::vector<sched_trace_cell_config>                cells;
+  std::vector<sched_trace_ue_config>                  ues;
+  std::vector<std::pair<slot_point, du_cell_index_t>> slots;
+  std::vector<sched_trace_slot_result>                results;
+  std::vector<dl_buffer_state_indication_message>     dl_bs;
+  std::vector<ul_bsr_indication_message>              bsrs;
+  std::vector<ul_crc_indication>                      crcs;
+  std::vector<du_ue_index_t>                          removed_ues;
+  /// Types of the decoded records, in trace order.
+  std::vector<std::string> record_types;
+
+  void on_cell_configuration(const sched_trace_cell_config& cfg) override { cells.push_back(cfg); }
+  void on_cell_removal(du_cell_index_t cell_index) override {}
+  void on_cell_activation(du_cell_index_t cell_index) override {}
+  void on_cell_deactivation(du_cell_index_t cell_index) override {}
+  void on_ue_creation(const sched_trace_ue_config& cfg) override
+  {
+    ues.push_back(cfg);
+    record_types.emplace_back("ue_creation");
+  }
+  void on_ue_reconfiguration(const sched_trace_ue_config& cfg) override {}
+  void on_ue_removal(du_ue_index_t ue_index) override { removed_ues.push_back(ue_index); }
+  void on_ue_config_applied(du_ue_index_t ue_index) override {}
+  void on_ue_deactivation(du_ue_index_t ue_index) override {}
+  void on_slot_indication(slot_point_extended sl_tx, du_cell_index_t cell_index) override
+  {
+    slots.emplace_back(sl_tx.without_hyper_sfn(), cell_index);
+    record_types.emplace_back("slot_indication");
+  }
+  void on_slot_result(const sched_trace_slot_result& result) override { results.push_back(result); }
+  void on_error_indication(slot_point                            sl_tx,
+                           du_cell_index_t                       cell_index,
+                           scheduler_slot_handler::error_outcome event) override
+  {
+  }
+  void on_dl_buffer_state_indication(const dl_buffer_state_indication_message& bs) override
+  {
+    dl_bs.push_back(bs);
+    record_types.emplace_back("dl_bs");
+  }
+  void on_dl_mac_ce_indication(const dl_mac_ce_indication& mac_ce) override {}
+  void on_ul_bsr_indication(const ul_bsr_indication_message& bsr) override
+  {
+    bsrs.push_back(bsr);
+    record_types.emplace_back("bsr");
+  }
+  void on_ul_phr_indication(const ul_phr_indication_message& phr_ind) override {}
+  void on_crc_indication(const ul_crc_indication& crc) override { crcs.push_back(crc); }
+  void on_uci_indication(const uci_indication& uci) override {}
+  void on_rach_indication(const rach_indication_message& msg) override {}
+};
+
+} // namespace
+
+class scheduler_input_trace_test : public ::testing::Test
+{
+protected:
+  ~scheduler_input_trace_test() override { std::remove(filename.c_str()); }
+
+  /// Reads all the records of the trace into the handler spy.
+  void read_trace()
+  {
+    scheduler_input_trace_reader reader;
+    ASSERT_TRUE(reader.open(filename));
+    while (reader.read_next(spy)) {
+    }
+    ASSERT_FALSE(reader.is_malformed());
+  }
+
+  std::string       filename = "scheduler_input_trace_test.bin";
+  trace_handler_spy spy;
+};
+
+TEST_F(scheduler_input_trace_test, recorded_inputs_are_read_back_in_order)
+{
+  cell_config_builder_params params{};
+  params.tdd_ul_dl_cfg_common = std::nullopt;
+  sched_cell_configuration_request_message cell_msg =
+      sched_config_helper::make_default_sched_cell_configuration_request(params);
+  sched_ue_creation_request_message ue_msg =
+      sched_config_helper::create_default_sched_ue_creation_request(params, {LCID_MIN_DRB});
+  ue_msg.ue_index = to_du_ue_index(3);
+  ue_msg.crnti    = to_rnti(0x4603);
+
+  slot_point              sl{subcarrier_spacing::kHz15, 5, 3};
+  sched_trace_slot_result slot_result{to_du_cell_index(0), sl, true, 2, 1, 1, 0, 1, 3, 1500, 300};
+
+  ul_bsr_indication_message bsr{to_du_cell_index(0), ue_msg.ue_index, ue_msg.crnti, bsr_format::LONG_BSR, {}};
+  bsr.reported_lcgs.push_back({uint_to_lcg_id(0), 100});
+  bsr.reported_lcgs.push_back({uint_to_lcg_id(2), 20000});
+
+  ul_crc_indication crc{to_du_cell_index(0), sl, {}};
+  crc.crcs.push_back({ue_msg.crnti, ue_msg.ue_index, to_harq_id(4), false, 12.5F, std::nullopt, std::nullopt});
+
+  {
+    scheduler_input_trace_writer writer;
+    ASSERT_TRUE(writer.open(filename));
+    writer.write_cell_configuration(make_sched_trace_cell_config(cell_msg));
+    writer.write_ue_creation(make_sched_trace_ue_config(ue_msg));
+    writer.write_slot_indication(slot_point_extended{sl, 0}, to_du_cell_index(0));
+    writer.write_dl_buffer_state_indication({ue_msg.ue_index, LCID_MIN_DRB, 4000, sl - 2});
+    writer.write_ul_bsr_indication(bsr);
+    writer.write_crc_indication(crc);
+    writer.write_slot_result(slot_result);
+    writer.write_ue_removal(ue_msg.ue_index);
+  }
+  read_trace();
+
+  ASSERT_EQ(spy.cells.size(), 1);
+  ASSERT_EQ(spy.cells[0].pci, cell_msg.ran.pci);
+  ASSERT_EQ(spy.cells[0].dl_carrier.arfcn_f_ref, cell_msg.ran.dl_carrier.arfcn_f_ref);
+  ASSERT_FALSE(spy.cells[0].tdd_ul_dl_cfg_common.has_value());
+  ASSERT_EQ(spy.cells[0].pucch_resources.nof_cell_sr_resources,
+            cell_msg.ran.init_bwp_builder.pucch.resources.nof_cell_sr_resources);
+  ASSERT_EQ(spy.cells[0].csi_enabled, cell_msg.ran.init_bwp_builder.csi.has_value());
+
+  ASSERT_EQ(spy.ues.size(), 1);
+  ASSERT_EQ(spy.ues[0].ue_index, ue_msg.ue_index);
+  ASSERT_EQ(spy.ues[0].crnti, ue_msg.crnti);
+  ASSERT_TRUE(spy.ues[0].lcids.has_value());
+
+  ASSERT_EQ(spy.slots.size(), 1);
+  ASSERT_EQ(spy.slots[0].first, sl);
+
+  ASSERT_EQ(spy.dl_bs.size(), 1);
+  ASSERT_EQ(spy.dl_bs[0].bs, 4000);
+  ASSERT_EQ(spy.dl_bs[0].hol_toa, sl - 2);
+
+  ASSERT_EQ(spy.bsrs.size(), 1);
+  ASSERT_EQ(spy.bsrs[0].type, bsr_format::LONG_BSR);
+  ASSERT_EQ(spy.bsrs[0].reported_lcgs.size(), 2);
+  ASSERT_EQ(spy.bsrs[0].reported_lcgs[1].nof_bytes, 20000);
+
+  ASSERT_EQ(spy.crcs.size(), 1);
+  ASSERT_EQ(spy.crcs[0].crcs.size(), 1);
+  ASSERT_EQ(spy.crcs[0].crcs[0].harq_id, to_harq_id(4));
+  ASSERT_FALSE(spy.crcs[0].crcs[0].tb_crc_success);
+  ASSERT_EQ(spy.crcs[0].crcs[0].ul_sinr_dB, 12.5F);
+
+  ASSERT_EQ(spy.results.size(), 1);
+  ASSERT_EQ(spy.results[0], slot_result);
+
+  ASSERT_EQ(spy.removed_ues, std::vector<du_ue_index_t>{ue_msg.ue_index});
+}
+
+TEST_F(scheduler_input_trace_test, truncated_trace_is_reported_as_malformed)
+{
+  {
+    scheduler_input_trace_writer writer;
+    ASSERT_TRUE(writer.open(filename));
+    writer.write_ue_removal(to_du_ue_index(1));
+    writer.write_ue_removal(to_du_ue_index(2));
+  }
+  // Drop the last byte of the trace.
+  std::FILE* fp = std::fopen(filename.c_str(), "rb");
+  ASSERT_NE(fp, nullptr);
+  std::vector<char> contents(1024);
+  contents.resize(std::fread(contents.data(), 1, contents.size(), fp));
+  std::fclose(fp);
+  fp = std::fopen(filename.c_str(), "wb");
+  std::fwrite(contents.data(), 1, contents.size() - 1, fp);
+  std::fclose(fp);
+
+  scheduler_input_trace_reader reader;
+  ASSERT_TRUE(reader.open(filename));
+  ASSERT_TRUE(reader.read_next(spy));
+  ASSERT_FALSE(reader.read_next(spy));
+  ASSERT_TRUE(reader.is_malformed());
+  ASSERT_EQ(spy.removed_ues, std::vector<du_ue_index_t>{to_du_ue_index(1)});
+}
+
+TEST_F(scheduler_input_trace_test, file_without_trace_header_is_rejected)
+{
+  std::FILE* fp = std::fopen(filename.c_str(), "wb");
+  ASSERT_NE(fp, nullptr);
+  std::fputs("not a trace", fp);
+  std::fclose(fp);
+
+  scheduler_input_trace_reader reader;
+  ASSERT_FALSE(reader.open(filename));
+}
+
+TEST_F(scheduler_input_trace_test, records_written_concurrently_keep_the_order_of_each_thread)
+{
+  static constexpr unsigned nof_threads = 4, nof_records_per_thread = 200;
+  {
+    scheduler_input_trace_writer writer;
+    ASSERT_TRUE(writer.open(filename));
+    std::vector<std::thread> threads;
+    for (unsigned i_thread = 0; i_thread != nof_threads; ++i_thread) {
+      threads.emplace_back([&writer, i_thread]() {
+        for (unsigned i = 0; i != nof_records_per_thread; ++i) {
+          writer.write_ue_removal(to_du_ue_index(i_thread * nof_records_per_thread + i));
+        }
+      });
+    }
+    for (std::thread& t : threads) {
+      t.join();
+    }
+  }
+
+  read_trace();
+  ASSERT_EQ(spy.removed_ues.size(), nof_threads * nof_records_per_thread);
+  std::vector<int> last_record(nof_threads, -1);
+  for (du_ue_index_t ue_index : spy.removed_ues) {
+    unsigned i_thread = ue_index / nof_records_per_thread;
+    int      i_record = ue_index % nof_records_per_thread;
+    ASSERT_EQ(i_record, last_record[i_thread] + 1) << "Records of the same thread are out of order";
+    last_record[i_thread] = i_record;
+  }
+}
+
+TEST_F(scheduler_input_trace_test, inputs_are_recorded_before_the_slot_indication_that_processes_them)
+{
+  scheduler_expert_config expert_cfg = config_helpers::make_default_scheduler_expert_config();
+  expert_cfg.input_trace_file        = filename;
+  sched_cfg_dummy_notifier notif;
+  slot_point_extended      sl_tx{subcarrier_spacing::kHz15, 0, 0, 1};
+  {
+    std::unique_ptr<mac_scheduler> sched = create_scheduler(scheduler_config{expert_cfg, notif});
+    sched->handle_cell_configuration_request(sched_config_helper::make_default_sched_cell_configuration_request());
+
+    sched_ue_creation_request_message ue_msg = sched_config_helper::create_default_sched_ue_creation_request();
+    sched->handle_ue_creation_request(ue_msg);
+    sched->slot_indication(sl_tx++, to_du_cell_index(0));
+
+    // The inputs received while no slot is being scheduled are processed in the next slot.
+    ul_bsr_indication_message bsr{to_du_cell_index(0), ue_msg.ue_index, ue_msg.crnti, bsr_format::SHORT_BSR, {}};
+    bsr.reported_lcgs.push_back({uint_to_lcg_id(0), 100});
+    sched->handle_ul_bsr_indication(bsr);
+    // The DL buffer state updates of the same bearer are merged by the scheduler, so only the merged one is recorded.
+    sched->handle_dl_buffer_state_indication({ue_msg.ue_index, LCID_SRB1, 100, {}});
+    sched->handle_dl_buffer_state_indication({ue_msg.ue_index, LCID_SRB1, 200, {}});
+    sched->slot_indication(sl_tx++, to_du_cell_index(0));
+    sched->slot_indication(sl_tx++, to_du_cell_index(0));
+  }
+
+  read_trace();
+  ASSERT_EQ(spy.record_types,
+            (std::vector<std::string>{
+                "ue_creation", "slot_indication", "bsr", "dl_bs", "slot_indication", "slot_indication"}));
+  ASSERT_EQ(spy.dl_bs[0].bs, 200);
+  ASSERT_EQ(spy.results.size(), 3);
+}
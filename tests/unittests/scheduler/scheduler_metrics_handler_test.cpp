@@ -307,6 +307,40 @@ TEST_F(scheduler_metrics_handler_tester, compute_latency_metric)
   }
 }
 
+TEST_F(scheduler_metrics_handler_tester, compute_cell_group_latency_metric)
+{
+  using usecs = std::chrono::microseconds;
+
+  // Discard first report, as it may have not enough slots.
+  get_next_metric();
+  ASSERT_EQ(metrics_notif.last_report.max_cell_group_latency.count(), 0) << "Cell group latency is not measured";
+  metrics_notif.last_report = {};
+
+  sched_result sched_res;
+  sched_res.dl.nof_dl_symbols = 14;
+  sched_res.ul.nof_ul_symbols = 14;
+
+  // Only half of the slots are scheduled by the cell group workers.
+  unsigned nof_group_slots = 0;
+  usecs    group_latency_sum{0};
+  usecs    max_group_latency{0};
+  for (unsigned i = 0, e = report_period.count(); i != e; ++i) {
+    ASSERT_TRUE(metrics_notif.last_report.ue_metrics.empty());
+    if (i % 2 == 0) {
+      usecs group_latency{test_rgen::uniform_int<unsigned>(1, 1000)};
+      metrics.handle_cell_group_latency(group_latency);
+      group_latency_sum += group_latency;
+      max_group_latency = std::max(max_group_latency, group_latency);
+      ++nof_group_slots;
+    }
+    this->run_slot(sched_res);
+  }
+  ASSERT_FALSE(metrics_notif.last_report.ue_metrics.empty());
+
+  ASSERT_EQ(metrics_notif.last_report.average_cell_group_latency, group_latency_sum / nof_group_slots);
+  ASSERT_EQ(metrics_notif.last_report.max_cell_group_latency, max_group_latency);
+}
+
 TEST_F(scheduler_metrics_handler_tester, compute_error_indications)
 {
   metrics.handle_error_indication();
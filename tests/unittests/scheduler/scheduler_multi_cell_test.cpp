@@ -15,21 +15,32 @@
 #include "tests/unittests/scheduler/test_utils/scheduler_test_simulator.h"
 #include "ocudu/ran/duplex_mode.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 
 using namespace ocudu;
 
 struct multi_cell_scheduler_test_params {
   duplex_mode dplx_mode;
   unsigned    nof_cells = 2;
+  /// Number of dedicated workers that schedule the cell groups concurrently.
+  unsigned nof_cell_group_workers = 0;
 };
 
+static scheduler_test_sim_config make_multi_cell_sim_config(const multi_cell_scheduler_test_params& test_params)
+{
+  scheduler_test_sim_config cfg;
+  cfg.sched_cfg                        = make_custom_scheduler_expert_config(true);
+  cfg.sched_cfg.nof_cell_group_workers = test_params.nof_cell_group_workers;
+  cfg.max_scs = test_params.dplx_mode == duplex_mode::FDD ? subcarrier_spacing::kHz15 : subcarrier_spacing::kHz30;
+  return cfg;
+}
+
 class base_multi_cell_scheduler_tester : public scheduler_test_simulator
 {
 protected:
   base_multi_cell_scheduler_tester(const multi_cell_scheduler_test_params& test_params) :
-    scheduler_test_simulator(4,
-                             test_params.dplx_mode == duplex_mode::FDD ? subcarrier_spacing::kHz15
-                                                                       : subcarrier_spacing::kHz30)
+    scheduler_test_simulator(make_multi_cell_sim_config(test_params))
   {
     cell_config_builder_params params = cell_config_builder_profiles::create(test_params.dplx_mode);
 
@@ -151,8 +162,10 @@ protected:
 /// Formatter for test params.
 void PrintTo(const multi_cell_scheduler_test_params& value, ::std::ostream* os)
 {
-  *os << fmt::format(
-      "duplex_mode={} nof_cells={}", value.dplx_mode == duplex_mode::FDD ? "FDD" : "TDD", value.nof_cells);
+  *os << fmt::format("duplex_mode={} nof_cells={} nof_cell_group_workers={}",
+                     value.dplx_mode == duplex_mode::FDD ? "FDD" : "TDD",
+                     value.nof_cells,
+                     value.nof_cell_group_workers);
 }
 
 class multi_cell_scheduler_tester : public base_multi_cell_scheduler_tester,
@@ -374,7 +387,44 @@ TEST_P(multi_cell_scheduler_tester, test_ul_scheduling_for_ues_in_different_cell
   }
 }
 
+TEST_P(multi_cell_scheduler_tester, results_match_requested_slots_with_concurrent_callers_and_skipped_slots)
+{
+  static constexpr unsigned test_run_nof_slots = 400;
+  const unsigned            nof_cells          = cell_cfg_builder_params_list.size();
+  const slot_point_extended start_slot         = next_slot;
+
+  // Each cell gets its slot indications from a different thread. Each cell, except the first one, skips one slot with a
+  // different cadence, which discards the slots that were dispatched for it in advance.
+  std::atomic<unsigned>    nof_mismatches{0};
+  std::vector<std::thread> callers;
+  for (unsigned cell_idx = 0; cell_idx != nof_cells; ++cell_idx) {
+    callers.emplace_back([this, cell_idx, start_slot, &nof_mismatches]() {
+      const du_cell_index_t     cell_index = to_du_cell_index(cell_idx);
+      const unsigned            skip_every = cell_idx == 0 ? test_run_nof_slots : 7 + cell_idx;
+      slot_point_extended       sl_tx      = start_slot;
+      const cell_configuration& cfg        = cell_cfg(cell_index);
+      for (unsigned count = 1; count != test_run_nof_slots; ++count, ++sl_tx) {
+        if (count % skip_every == 0) {
+          continue;
+        }
+        const sched_result& res = sched->slot_indication(sl_tx, cell_index);
+        if (res.dl.nof_dl_symbols != cfg.get_nof_dl_symbol_per_slot(sl_tx.without_hyper_sfn()) or
+            res.ul.nof_ul_symbols != cfg.get_nof_ul_symbol_per_slot(sl_tx.without_hyper_sfn())) {
+          ++nof_mismatches;
+        }
+      }
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+
+  ASSERT_EQ(nof_mismatches.load(), 0) << "Scheduling results do not correspond to the requested slots";
+}
+
 INSTANTIATE_TEST_SUITE_P(multi_cell_scheduler_test,
                          multi_cell_scheduler_tester,
                          testing::Values(multi_cell_scheduler_test_params{ocudu::duplex_mode::FDD, 3},
-                                         multi_cell_scheduler_test_params{ocudu::duplex_mode::TDD, 2}));
+                                         multi_cell_scheduler_test_params{ocudu::duplex_mode::TDD, 2},
+                                         multi_cell_scheduler_test_params{ocudu::duplex_mode::FDD, 3, 2},
+                                         multi_cell_scheduler_test_params{ocudu::duplex_mode::TDD, 4, 4}));